@@ -0,0 +1,93 @@
+//------------------------------------------------------------------------------
+// Copyright 2018 H2O.ai
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//------------------------------------------------------------------------------
+#include "blockindex.h"
+#include "column.h"
+namespace dt {
+
+
+BlockIndex::BlockIndex(std::vector<Block>&& blocks_,
+                       const MemoryRange& databuf_, selector_fn selector_)
+  : blocks(std::move(blocks_)), databuf(databuf_),
+    selector(std::move(selector_)), nrows(0)
+{
+  for (const Block& b : blocks) nrows += b.nrows;
+}
+
+
+/**
+ * Return true if this BlockIndex still describes the column `col`: the
+ * column must not be a view, and its data buffer must be the same one that
+ * the index was created for (any modification of the column's data either
+ * replaces the buffer, or makes a copy of it).
+ */
+bool BlockIndex::describes(const Column* col) const {
+  return !col->rowindex() &&
+         col->nrows == nrows &&
+         col->data_buf() == databuf;
+}
+
+
+bool BlockIndex::same_layout(const BlockIndex& other) const {
+  if (blocks.size() != other.blocks.size()) return false;
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    if (blocks[i].nrows != other.blocks[i].nrows) return false;
+  }
+  return true;
+}
+
+
+Column* BlockIndex::select(const std::vector<size_t>& ids) const {
+  return selector(ids);
+}
+
+
+// Runs of consecutive blocks are merged into a single slice.
+RowIndex BlockIndex::rows(const std::vector<size_t>& ids) const {
+  std::vector<size_t> offsets(blocks.size() + 1);
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    offsets[i + 1] = offsets[i] + blocks[i].nrows;
+  }
+  std::vector<size_t> runstarts, runends;
+  for (size_t k = 0; k < ids.size(); ++k) {
+    if (k == 0 || ids[k] != ids[k - 1] + 1) {
+      runstarts.push_back(offsets[ids[k]]);
+      runends.push_back(0);
+    }
+    runends.back() = offsets[ids[k] + 1];
+  }
+  size_t nruns = runstarts.size();
+  if (nruns <= 1) {
+    return nruns? RowIndex(runstarts[0], runends[0] - runstarts[0], 1)
+                : RowIndex(0, 0, 1);
+  }
+  arr64_t starts(nruns), counts(nruns), steps(nruns);
+  for (size_t k = 0; k < nruns; ++k) {
+    starts[k] = static_cast<int64_t>(runstarts[k]);
+    counts[k] = static_cast<int64_t>(runends[k] - runstarts[k]);
+    steps[k] = 1;
+  }
+  return RowIndex(starts, counts, steps);
+}
+
+
+
+}  // namespace dt
@@ -0,0 +1,90 @@
+//------------------------------------------------------------------------------
+// Copyright 2018 H2O.ai
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//------------------------------------------------------------------------------
+#ifndef dt_BLOCKINDEX_h
+#define dt_BLOCKINDEX_h
+#include <cstdint>
+#include <functional>   // std::function
+#include <vector>
+#include "memrange.h"   // MemoryRange
+#include "rowindex.h"   // RowIndex
+class Column;
+namespace dt {
+
+
+/**
+ * Description of how a column's data is split into blocks ("row groups"),
+ * together with the per-block stats. This information is available for the
+ * columns opened from a file that stores the data in blocks (such as Jay),
+ * and it allows the `i` filter `DT[f.A > 5, :]` to skip the blocks that
+ * cannot contain any matching rows, without loading their data.
+ *
+ * Each block records its number of rows, the count of NAs, and the min/max
+ * of its non-NA values. The min/max are kept both as `int64_t` (for integer
+ * and boolean columns) and as `double` (for all numeric columns); blocks of
+ * string columns, or blocks where all values are NA, have no range.
+ *
+ * The `selector` function creates a new Column containing only the given
+ * (sorted) subset of blocks. Usually, this column is lazy: the blocks are
+ * not loaded until the data is actually accessed.
+ *
+ * The BlockIndex describes the data of a particular buffer `databuf`, and
+ * becomes stale once the column's data is modified. Thus, it should be
+ * accessed via `Column::get_block_index()`, which performs such a check.
+ */
+class BlockIndex {
+  public:
+    struct Block {
+      size_t nrows;
+      size_t nullcount;
+      int64_t imin, imax;
+      double fmin, fmax;
+      bool has_range;
+      size_t : 56;
+    };
+    using selector_fn = std::function<Column*(const std::vector<size_t>&)>;
+
+  private:
+    std::vector<Block> blocks;
+    MemoryRange databuf;
+    selector_fn selector;
+    size_t nrows;
+
+  public:
+    BlockIndex(std::vector<Block>&& blocks, const MemoryRange& databuf,
+               selector_fn selector);
+
+    size_t nblocks() const noexcept { return blocks.size(); }
+    const Block& block(size_t i) const { return blocks[i]; }
+    bool describes(const Column* col) const;
+    bool same_layout(const BlockIndex& other) const;
+
+    // Create a new column containing only the blocks `ids` of the original.
+    Column* select(const std::vector<size_t>& ids) const;
+
+    // RowIndex of the rows in the blocks `ids`, relative to the whole column.
+    RowIndex rows(const std::vector<size_t>& ids) const;
+};
+
+
+
+}  // namespace dt
+#endif
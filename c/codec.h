@@ -0,0 +1,160 @@
+//------------------------------------------------------------------------------
+// Copyright 2018 H2O.ai
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//------------------------------------------------------------------------------
+#ifndef dt_CODEC_h
+#define dt_CODEC_h
+#include <cstdint>
+#include <memory>       // std::shared_ptr
+#include <string>
+#include "memrange.h"   // MemoryRange
+class Column;
+namespace dt {
+
+
+/**
+ * Lightweight compression schemes for the data of fixed-width columns:
+ *
+ *   FOR  - "frame of reference": the rows are split into blocks of
+ *          `Codec::BLOCK_SIZE`, and within each block the values are stored
+ *          as bit-packed offsets from the block's minimum. Integer columns
+ *          only.
+ *
+ *   RLE  - run-length encoding: each run of identical values is stored as
+ *          the value and the index of the run's end. Best for sorted or
+ *          keyed columns.
+ *
+ *   DICT - dictionary encoding: the distinct values are stored once, and
+ *          each row keeps a bit-packed index into this dictionary.
+ *
+ * All encodings are lossless (floating-point values are compared by their
+ * bits). NAs are encoded as regular values.
+ */
+enum class Encoding : uint8_t {
+  NONE = 0,
+  FOR  = 1,
+  RLE  = 2,
+  DICT = 3,
+};
+
+const char* encoding_name(Encoding enc);
+
+// Parse the name of the compression method, as given to `Frame.compress()`.
+// Method "auto" is represented as `Encoding::NONE`.
+Encoding encoding_from_name(const std::string& name);
+
+
+
+/**
+ * Compressed representation of the values of a fixed-width column. A Codec
+ * can decode any range of rows, and in addition it can evaluate some of the
+ * operations directly on the compressed data:
+ *
+ * summarize()
+ *   Compute the count of non-NA values, their sum, min, max, mean and the
+ *   sum of squared deviations from the mean. The sum of integer columns is
+ *   computed exactly (modulo 2^64), as in the `sum()` reducer.
+ *
+ * compare()
+ *   Evaluate `x <op> value` for all rows `x`, writing 0/1 results into the
+ *   `out` array. The comparison is performed in the domain given by the
+ *   `Comparison` (as in the binary operators): int64, float or double.
+ *   Comparisons with NAs are false, except for the `!=` operator.
+ */
+class Codec {
+  public:
+    static constexpr size_t BLOCK_SIZE = 4096;
+
+    struct Summary {
+      size_t count;
+      int64_t isum, imin, imax;
+      double fsum, fmin, fmax;
+      double mean, m2;
+    };
+
+    enum class CmpOp : uint8_t { EQ, NE, GT, LT, GE, LE };
+    enum class CmpDomain : uint8_t { INT64, FLOAT32, FLOAT64 };
+    struct Comparison {
+      int64_t ivalue;
+      double fvalue;
+      CmpOp op;
+      CmpDomain domain;
+      size_t : 48;
+    };
+
+  protected:
+    size_t nrows;
+
+  public:
+    explicit Codec(size_t n) : nrows(n) {}
+    virtual ~Codec();
+
+    virtual Encoding kind() const noexcept = 0;
+    virtual size_t nbytes() const noexcept = 0;
+    size_t size() const noexcept { return nrows; }
+
+    // Write the values of rows `[row0, row0 + n)` into `out`
+    virtual void decode(size_t row0, size_t n, void* out) const = 0;
+    virtual void summarize(Summary* out) const = 0;
+    virtual void compare(const Comparison& cmp, int8_t* out) const = 0;
+};
+
+
+
+/**
+ * The Codec attached to a column, together with the data buffer that it
+ * encodes. The column's own data buffer is lazy: it is decoded from the
+ * Codec (block-wise, in parallel) only when some code requests direct
+ * access to the data. At that moment the encoding is dropped, and the
+ * Codec is released: from then on the column is an ordinary uncompressed
+ * column, and `Frame.compress()` has to be called again in order to
+ * re-compress it. Thus the memory is never held twice, for both the raw
+ * and the encoded data.
+ *
+ * Similar to `BlockIndex`, the encoding becomes stale once the column's data
+ * is modified, and should be accessed via `Column::get_codec()`. The Codec
+ * is returned as a shared pointer, so that it remains valid for the
+ * duration of the operation that uses it, even if the data is decoded
+ * concurrently.
+ */
+class ColumnEncoding {
+  private:
+    std::shared_ptr<const Codec> codec;
+    MemoryRange databuf;
+
+  public:
+    // Create the encoding together with the lazy buffer that holds the
+    // decoded data, of `elemsize` bytes per row.
+    static std::shared_ptr<ColumnEncoding>
+    make(std::shared_ptr<const Codec> codec, size_t elemsize);
+
+    std::shared_ptr<const Codec> get() const;
+    const MemoryRange& buffer() const noexcept { return databuf; }
+    bool describes(const Column* col) const;
+
+  private:
+    explicit ColumnEncoding(std::shared_ptr<const Codec> codec);
+    void release();
+};
+
+
+
+}  // namespace dt
+#endif
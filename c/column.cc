@@ -5,9 +5,14 @@
 //
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
+#include <algorithm>   // std::min
 #include <cstdlib>     // atoll
+#include <cstring>     // std::memset
+#include "blockindex.h"
+#include "codec.h"
 #include "column.h"
 #include "datatablemodule.h"
+#include "parallel/api.h"
 #include "rowindex.h"
 #include "sort.h"
 #include "utils/assert.h"
@@ -39,8 +44,18 @@ Column* Column::new_column(SType stype) {
     case SType::INT64:   return new IntColumn<int64_t>();
     case SType::FLOAT32: return new RealColumn<float>();
     case SType::FLOAT64: return new RealColumn<double>();
+    case SType::DEC16:   return new DecimalColumn<int16_t>();
+    case SType::DEC32:   return new DecimalColumn<int32_t>();
+    case SType::DEC64:   return new DecimalColumn<int64_t>();
     case SType::STR32:   return new StringColumn<uint32_t>();
     case SType::STR64:   return new StringColumn<uint64_t>();
+    case SType::FSTR:    return new FixedStringColumn();
+    case SType::CAT8:    return new CategoricalColumn<uint8_t>();
+    case SType::CAT16:   return new CategoricalColumn<uint16_t>();
+    case SType::CAT32:   return new CategoricalColumn<uint32_t>();
+    case SType::DATE64:  return new DatetimeColumn<SType::DATE64>();
+    case SType::TIME32:  return new DatetimeColumn<SType::TIME32>();
+    case SType::DATE32:  return new DatetimeColumn<SType::DATE32>();
     case SType::OBJ:     return new PyObjectColumn();
     default:
       throw ValueError() << "Unable to create a column of SType = " << stype;
@@ -142,13 +157,39 @@ Column* Column::shallowcopy(const RowIndex& new_rowindex) const {
   if (new_rowindex) {
     col->ri = new_rowindex;
     col->nrows = new_rowindex.size();
-  } else if (ri) {
-    col->ri = ri;
+    // A slice of an NA-free column is NA-free too; whereas an array rowindex
+    // may contain NA entries.
+    if (!ri && new_rowindex.isslice() && is_na_free()) col->set_na_free();
+  } else {
+    if (ri) col->ri = ri;
+    if (is_na_free()) col->set_na_free();
+    col->blockindex = blockindex;
+    col->encoding = encoding;
   }
   return col;
 }
 
 
+void Column::set_block_index(std::shared_ptr<dt::BlockIndex> bi) {
+  blockindex = std::move(bi);
+}
+
+const dt::BlockIndex* Column::get_block_index() const {
+  if (blockindex && blockindex->describes(this)) return blockindex.get();
+  return nullptr;
+}
+
+
+bool Column::compress(dt::Encoding) {
+  return false;
+}
+
+std::shared_ptr<const dt::Codec> Column::get_codec() const {
+  if (encoding && encoding->describes(this)) return encoding->get();
+  return nullptr;
+}
+
+
 size_t Column::alloc_size() const {
   return mbuf.size();
 }
@@ -168,6 +209,7 @@ RowIndex Column::remove_rowindex() {
 void Column::replace_rowindex(const RowIndex& newri) {
   ri = newri;
   nrows = ri.size();
+  if (stats) stats->reset();
 }
 
 
@@ -179,6 +221,97 @@ void Column::replace_rowindex(const RowIndex& newri) {
 size_t Column::countna() const { return get_stats()->countna(this); }
 size_t Column::nunique() const { return get_stats()->nunique(this); }
 size_t Column::nmodal() const  { return get_stats()->nmodal(this); }
+size_t Column::nunique_approx() const { return get_stats()->nunique_approx(this); }
+
+void Column::set_na_free() const {
+  Stats* s = get_stats();
+  if (s) s->set_countna(0);
+}
+
+
+
+//------------------------------------------------------------------------------
+// Validity bitmap
+//------------------------------------------------------------------------------
+
+// Fill the words of the validity bitmap, given a function `isvalid(j)` that
+// checks whether the element at index `j` in the data buffer is not NA.
+template <typename F>
+static void fill_validity(const Column* col, uint64_t* words, size_t nwords,
+                          F isvalid)
+{
+  const RowIndex& ri = col->rowindex();
+  size_t nrows = col->nrows;
+  dt::parallel_for_static(nwords,
+    [&](size_t w) {
+      size_t row0 = w * 64;
+      size_t row1 = std::min(row0 + 64, nrows);
+      uint64_t word = 0;
+      ri.iterate(row0, row1, 1,
+        [&](size_t i, size_t j) {
+          bool valid = (j != RowIndex::NA) && isvalid(j);
+          word |= static_cast<uint64_t>(valid) << (i - row0);
+        });
+      words[w] = word;
+    });
+}
+
+template <typename T>
+static void fill_validity_fw(const Column* col, uint64_t* words, size_t nw) {
+  const T* data = static_cast<const T*>(col->data());
+  fill_validity(col, words, nw, [=](size_t j) { return !ISNA<T>(data[j]); });
+}
+
+template <typename T>
+static void fill_validity_str(const Column* col, uint64_t* words, size_t nw) {
+  const T* offs = static_cast<const StringColumn<T>*>(col)->offsets();
+  fill_validity(col, words, nw, [=](size_t j) { return !ISNA<T>(offs[j]); });
+}
+
+
+MemoryRange Column::validity_bitmap() const {
+  size_t nwords = (nrows + 63) / 64;
+  MemoryRange res = MemoryRange::mem(nwords * sizeof(uint64_t));
+  uint64_t* words = static_cast<uint64_t*>(res.wptr());
+  switch (stype()) {
+    case SType::BOOL:
+    case SType::INT8:    fill_validity_fw<int8_t>(this, words, nwords); break;
+    case SType::INT16:
+    case SType::DEC16:   fill_validity_fw<int16_t>(this, words, nwords); break;
+    case SType::INT32:
+    case SType::DEC32:
+    case SType::TIME32:
+    case SType::DATE32:  fill_validity_fw<int32_t>(this, words, nwords); break;
+    case SType::INT64:
+    case SType::DEC64:
+    case SType::DATE64:  fill_validity_fw<int64_t>(this, words, nwords); break;
+    case SType::FLOAT32: fill_validity_fw<float>(this, words, nwords); break;
+    case SType::FLOAT64: fill_validity_fw<double>(this, words, nwords); break;
+    case SType::STR32:   fill_validity_str<uint32_t>(this, words, nwords); break;
+    case SType::STR64:   fill_validity_str<uint64_t>(this, words, nwords); break;
+    case SType::FSTR: {
+      auto xcol = static_cast<const FixedStringColumn*>(this);
+      const char* chars = xcol->chars();
+      size_t width = xcol->get_width();
+      fill_validity(this, words, nwords,
+        [=](size_t j) { return !FixedStringColumn::isna(chars + j * width); });
+      break;
+    }
+    case SType::CAT8:    fill_validity_fw<uint8_t>(this, words, nwords); break;
+    case SType::CAT16:   fill_validity_fw<uint16_t>(this, words, nwords); break;
+    case SType::CAT32:   fill_validity_fw<uint32_t>(this, words, nwords); break;
+    case SType::OBJ:     fill_validity_fw<PyObject*>(this, words, nwords); break;
+    default:
+      std::memset(words, 0, nwords * sizeof(uint64_t));
+      return res;
+  }
+  size_t nvalid = 0;
+  for (size_t w = 0; w < nwords; ++w) {
+    nvalid += static_cast<size_t>(__builtin_popcountll(words[w]));
+  }
+  get_stats()->set_countna(nrows - nvalid);
+  return res;
+}
 
 
 
@@ -21,6 +21,7 @@
 //------------------------------------------------------------------------------
 #ifndef dt_COLUMN_h
 #define dt_COLUMN_h
+#include <memory>
 #include <string>
 #include <vector>
 #include <Python.h>
@@ -38,8 +39,18 @@ class PyObjectColumn;
 class FreadReader;  // used as a friend
 class iterable;     // helper for Column::from_py_iterable
 template <typename T> class IntColumn;
+namespace dt {
+  class BlockIndex;
+  class Codec;
+  class ColumnEncoding;
+  enum class Encoding : uint8_t;
+}
 template <typename T> class RealColumn;
 template <typename T> class StringColumn;
+template <typename T> class CategoricalColumn;
+class FixedStringColumn;
+template <SType s> class DatetimeColumn;
+template <typename T> class DecimalColumn;
 
 
 /**
@@ -60,8 +71,18 @@ template <> struct _colt<SType::INT32>   { using t = IntColumn<int32_t>; };
 template <> struct _colt<SType::INT64>   { using t = IntColumn<int64_t>; };
 template <> struct _colt<SType::FLOAT32> { using t = RealColumn<float>; };
 template <> struct _colt<SType::FLOAT64> { using t = RealColumn<double>; };
+template <> struct _colt<SType::DEC16>   { using t = DecimalColumn<int16_t>; };
+template <> struct _colt<SType::DEC32>   { using t = DecimalColumn<int32_t>; };
+template <> struct _colt<SType::DEC64>   { using t = DecimalColumn<int64_t>; };
 template <> struct _colt<SType::STR32>   { using t = StringColumn<uint32_t>; };
 template <> struct _colt<SType::STR64>   { using t = StringColumn<uint64_t>; };
+template <> struct _colt<SType::FSTR>    { using t = FixedStringColumn; };
+template <> struct _colt<SType::CAT8>    { using t = CategoricalColumn<uint8_t>; };
+template <> struct _colt<SType::CAT16>   { using t = CategoricalColumn<uint16_t>; };
+template <> struct _colt<SType::CAT32>   { using t = CategoricalColumn<uint32_t>; };
+template <> struct _colt<SType::DATE64>  { using t = DatetimeColumn<SType::DATE64>; };
+template <> struct _colt<SType::TIME32>  { using t = DatetimeColumn<SType::TIME32>; };
+template <> struct _colt<SType::DATE32>  { using t = DatetimeColumn<SType::DATE32>; };
 template <> struct _colt<SType::OBJ>     { using t = PyObjectColumn; };
 
 template <SType s>
@@ -75,8 +96,17 @@ template <> struct _elt<SType::INT32>   { using t = int32_t; };
 template <> struct _elt<SType::INT64>   { using t = int64_t; };
 template <> struct _elt<SType::FLOAT32> { using t = float; };
 template <> struct _elt<SType::FLOAT64> { using t = double; };
+template <> struct _elt<SType::DEC16>   { using t = int16_t; };
+template <> struct _elt<SType::DEC32>   { using t = int32_t; };
+template <> struct _elt<SType::DEC64>   { using t = int64_t; };
 template <> struct _elt<SType::STR32>   { using t = uint32_t; };
 template <> struct _elt<SType::STR64>   { using t = uint64_t; };
+template <> struct _elt<SType::CAT8>    { using t = uint8_t; };
+template <> struct _elt<SType::CAT16>   { using t = uint16_t; };
+template <> struct _elt<SType::CAT32>   { using t = uint32_t; };
+template <> struct _elt<SType::DATE64>  { using t = int64_t; };
+template <> struct _elt<SType::TIME32>  { using t = int32_t; };
+template <> struct _elt<SType::DATE32>  { using t = int32_t; };
 template <> struct _elt<SType::OBJ>     { using t = PyObject*; };
 
 template <SType s>
@@ -131,6 +161,8 @@ protected:
   MemoryRange mbuf;
   RowIndex ri;
   mutable Stats* stats;
+  std::shared_ptr<dt::BlockIndex> blockindex;
+  std::shared_ptr<dt::ColumnEncoding> encoding;
 
 public:  // TODO: convert this into private
   size_t nrows;
@@ -283,6 +315,32 @@ public:
   size_t countna() const;
   size_t nunique() const;
   size_t nmodal() const;
+  size_t nunique_approx() const;
+
+  /**
+   * is_na_free()
+   *   Return true if the column is known to contain no NA values. This is a
+   *   cheap check that relies on the column's Stats: if the NA count was not
+   *   computed yet, the method returns false. Kernels may use it to select
+   *   faster code paths that skip the per-element NA checks.
+   *
+   * set_na_free()
+   *   Mark the column as having no NA values. This should only be called
+   *   when this is known for certain, for example when the column was
+   *   produced by an operation that cannot generate NAs from NA-free inputs.
+   *
+   * validity_bitmap()
+   *   Return the validity bitmap of the column: bit `i` (in LSB order within
+   *   each 64-bit word) is set if the value in row `i` is not NA. The bitmap
+   *   is padded to a whole number of 64-bit words, with the padding bits
+   *   cleared. NAs are stored as sentinel values within the column's data,
+   *   so the bitmap is derived from the data on each call; as a by-product,
+   *   the NA count stat is filled in. This layout is compatible with Arrow,
+   *   and the NAs of several columns can be combined via a word-wise AND.
+   */
+  bool is_na_free() const { return stats && stats->is_na_free(); }
+  void set_na_free() const;
+  MemoryRange validity_bitmap() const;
   virtual int64_t min_int64() const { return GETNA<int64_t>(); }
   virtual int64_t max_int64() const { return GETNA<int64_t>(); }
 
@@ -305,6 +363,36 @@ public:
   virtual Stats* get_stats() const = 0;
   Stats* get_stats_if_exist() const { return stats; }
 
+  /**
+   * set_block_index()
+   *   Attach the description of the column's blocks and their stats (see
+   *   "blockindex.h"). This is done when the column is opened from a file
+   *   that stores the data in blocks.
+   *
+   * get_block_index()
+   *   Return the column's BlockIndex, or nullptr if there is none, or if it
+   *   no longer describes the column (for example, if the data was modified
+   *   since the column was opened).
+   */
+  void set_block_index(std::shared_ptr<dt::BlockIndex> bi);
+  const dt::BlockIndex* get_block_index() const;
+
+  /**
+   * compress(method)
+   *   Replace the column's data with its compressed representation (see
+   *   "codec.h"). With `Encoding::NONE` the method chooses the encoding
+   *   that gives the smallest size, and leaves the column as-is if none of
+   *   them is smaller than the raw data. A view column is materialized
+   *   first. Returns true if the column was compressed.
+   *
+   * get_codec()
+   *   Return the Codec of the compressed column, or nullptr if the column
+   *   is not compressed, or if its data was modified or decoded after
+   *   compression.
+   */
+  virtual bool compress(dt::Encoding method);
+  std::shared_ptr<const dt::Codec> get_codec() const;
+
   virtual void fill_na_mask(int8_t* outmask, size_t row0, size_t row1) = 0;
 
 protected:
@@ -357,6 +445,7 @@ public:
   void replace_values(const RowIndex& at, T with);
   virtual RowIndex join(const Column* keycol) const override;
   void fill_na_mask(int8_t* outmask, size_t row0, size_t row1) override;
+  bool compress(dt::Encoding method) override;
 
 protected:
   void init_data() override;
@@ -374,12 +463,16 @@ protected:
 
 
 template <> void FwColumn<PyObject*>::set_elem(size_t, PyObject*);
+template <> bool FwColumn<PyObject*>::compress(dt::Encoding);
 extern template class FwColumn<int8_t>;
 extern template class FwColumn<int16_t>;
 extern template class FwColumn<int32_t>;
 extern template class FwColumn<int64_t>;
 extern template class FwColumn<float>;
 extern template class FwColumn<double>;
+extern template class FwColumn<uint8_t>;
+extern template class FwColumn<uint16_t>;
+extern template class FwColumn<uint32_t>;
 extern template class FwColumn<PyObject*>;
 
 
@@ -478,6 +571,108 @@ extern template class RealColumn<double>;
 
 
 
+//==============================================================================
+// Temporal columns
+//==============================================================================
+
+/**
+ * Column of stype DATE32, DATE64 or TIME32 (see "types.h" for the encoding
+ * of each). The values are plain integers, so the column reuses all the
+ * machinery of `IntColumn`: sorting, grouping, joining and the stats min /
+ * max / mode work on the underlying integers directly, and only conversions
+ * to python / strings need to know that the values are dates or times.
+ */
+template <SType s> class DatetimeColumn : public IntColumn<element_t<s>>
+{
+public:
+  using IntColumn<element_t<s>>::IntColumn;
+  SType stype() const noexcept override;
+
+  py::oobj get_value_at_index(size_t i) const override;
+};
+
+extern template class DatetimeColumn<SType::DATE64>;
+extern template class DatetimeColumn<SType::TIME32>;
+extern template class DatetimeColumn<SType::DATE32>;
+
+
+
+//==============================================================================
+// Decimal columns
+//==============================================================================
+
+/**
+ * Column of stype DEC16, DEC32 or DEC64. Each value is stored as an integer
+ * `x`, and the column has a common `scale`, so that the represented numbers
+ * are x * 10^-scale (for example, 7.11 is stored as 711 with scale 2). The
+ * scale may not exceed the number of decimal digits that fit into T: 4 for
+ * DEC16, 9 for DEC32 and 18 for DEC64.
+ *
+ * As with the temporal columns, sorting, grouping and the stats min / max /
+ * mode / sum work on the underlying integers directly. The scale is carried
+ * along with the column's data, so every operation that creates a new
+ * decimal column must set it; `new_decimal_column()` is the preferred way
+ * of doing so.
+ */
+template <typename T> class DecimalColumn : public IntColumn<T>
+{
+  int scale;
+  int : 32;
+
+public:
+  DecimalColumn(size_t nrows, int scale, MemoryRange&& mr = MemoryRange());
+  SType stype() const noexcept override;
+
+  int get_scale() const { return scale; }
+  Column* shallowcopy(const RowIndex& new_rowindex) const override;
+  void replace_values(RowIndex at, const Column* with) override;
+  void verify_integrity(const std::string& name) const override;
+
+  py::oobj get_value_at_index(size_t i) const override;
+
+protected:
+  DecimalColumn();
+  void rbind_impl(std::vector<const Column*>& columns, size_t nrows,
+                  bool isempty) override;
+
+  using Column::stats;
+  using Column::mbuf;
+  friend Column;
+};
+
+extern template class DecimalColumn<int16_t>;
+extern template class DecimalColumn<int32_t>;
+extern template class DecimalColumn<int64_t>;
+
+
+/**
+ * Create a decimal column of the given stype and scale, with data buffer
+ * `mr` (if empty, a new buffer is allocated).
+ */
+Column* new_decimal_column(SType stype, size_t nrows, int scale,
+                           MemoryRange&& mr = MemoryRange());
+
+/**
+ * Convert column `col` into a decimal column of the given `stype` and
+ * `scale`. If `scale` is -1, then it is chosen automatically: integers get
+ * scale 0, decimals keep their scale, and strings / floats get the smallest
+ * scale at which all their values are represented exactly. The scale is
+ * capped at `decimal_max_scale(stype)` in all cases.
+ *
+ * Values that do not fit into the target stype, and strings that cannot be
+ * parsed as numbers become NAs.
+ */
+Column* decimal_column(const Column* col, SType stype, int scale = -1);
+
+/**
+ * Scale of the decimal column `col`, and the largest scale supported by
+ * the decimal `stype`.
+ */
+int decimal_scale(const Column* col);
+int decimal_max_scale(SType stype);
+
+
+
 //==============================================================================
 
 /**
@@ -545,7 +740,7 @@ public:
   void apply_na_mask(const BoolColumn* mask) override;
   RowIndex join(const Column* keycol) const override;
 
-  MemoryRange str_buf() { return strbuf; }
+  MemoryRange str_buf() const { return strbuf; }
   size_t datasize() const;
   size_t data_nrows() const override;
   const char* strdata() const;
@@ -597,6 +792,204 @@ extern template class StringColumn<uint64_t>;
 
 
 
+//==============================================================================
+// Categorical column
+//==============================================================================
+
+/**
+ * Column of stype CAT8, CAT16 or CAT32, storing strings as categorical codes
+ * of type `T` (uint8_t, uint16_t or uint32_t respectively).
+ *
+ * The `mbuf` holds the codes, one per row, and the distinct strings are kept
+ * in the `levels` column: a string column without a rowindex, whose values
+ * are sorted and unique, and which has no NAs. Code `k` refers to the `k`-th
+ * level; the NA code is `GETNA<T>()`. Since the levels are sorted, the codes
+ * can be sorted and compared directly, without looking at the strings.
+ *
+ * The levels column is never modified after it was created, and is shared
+ * by all shallow copies of the column (and also by its casts into other
+ * categorical types). The levels may include strings that do not appear in
+ * the column (for example, after the column was filtered).
+ */
+template <typename T> class CategoricalColumn : public FwColumn<T>
+{
+  std::shared_ptr<Column> levels;
+
+public:
+  // Maximum number of levels that can be encoded with type `T`
+  static constexpr size_t MAX_LEVELS = static_cast<size_t>(GETNA<T>());
+
+  CategoricalColumn(size_t nrows, MemoryRange&& codes,
+                    std::shared_ptr<Column> levels);
+  SType stype() const noexcept override;
+  bool is_fixedwidth() const override;
+
+  const std::shared_ptr<Column>& get_levels() const { return levels; }
+  size_t nlevels() const { return levels->nrows; }
+  CString level(size_t k) const;
+  size_t find_level(const CString& value) const;
+  CString mode() const;
+
+  Column* shallowcopy(const RowIndex& new_rowindex) const override;
+  void replace_values(RowIndex at, const Column* with) override;
+  RowIndex join(const Column* keycol) const override;
+  CategoricalStats<T>* get_stats() const override;
+  size_t memory_footprint() const override;
+  void verify_integrity(const std::string& name) const override;
+
+  py::oobj get_value_at_index(size_t i) const override;
+
+protected:
+  CategoricalColumn();
+  void rbind_impl(std::vector<const Column*>& columns, size_t nrows,
+                  bool isempty) override;
+
+  using Column::mbuf;
+  using Column::ri;
+  using Column::stats;
+  friend Column;
+};
+
+
+/**
+ * Create a categorical column of the given `stype` out of the `codes`
+ * buffer and the `levels` string column (see CategoricalColumn).
+ */
+Column* new_categorical_column(SType stype, MemoryRange&& codes,
+                               std::shared_ptr<Column> levels);
+
+/**
+ * Convert string column `col` into a categorical column of type `stype`, or
+ * of a wider categorical type if `col` has too many distinct values. If
+ * `max_levels` is non-zero and the column has more distinct values than
+ * that, then nullptr is returned instead.
+ */
+Column* categorize(const Column* col, SType stype, size_t max_levels = 0);
+
+/**
+ * Combine the (sorted) levels of several categorical columns into a single
+ * sorted levels column. For each input, the vector `maps[i]` is filled with
+ * the new code of each of its levels. If all inputs are the same levels
+ * column, then that column is returned.
+ */
+std::shared_ptr<Column> merge_levels(
+    const std::vector<std::shared_ptr<Column>>& levels,
+    std::vector<std::vector<uint32_t>>& maps);
+
+/**
+ * For each level of categorical column `col`, find the code of the same
+ * string among the levels of categorical column `target`. The strings that
+ * are not among the target's levels are given the code `target.nlevels`.
+ */
+std::vector<uint32_t> match_levels(const Column* col, const Column* target);
+
+/**
+ * Levels column of categorical column `col` (of any categorical stype).
+ */
+const std::shared_ptr<Column>& categorical_levels(const Column* col);
+
+/**
+ * Write the codes of categorical column `col` (with its rowindex applied)
+ * into array `out`, translating them with one of the `maps` produced by
+ * merge_levels(). NA codes are written as `GETNA<T>()`.
+ */
+template <typename T>
+void recode_categorical(const Column* col, const std::vector<uint32_t>& map,
+                        T* out);
+
+/**
+ * Return the smallest categorical stype, not narrower than `stype`, that can
+ * accommodate `nlevels` levels.
+ */
+SType categorical_stype(size_t nlevels, SType stype = SType::CAT8);
+
+template <> SType CategoricalColumn<uint8_t>::stype() const noexcept;
+template <> SType CategoricalColumn<uint16_t>::stype() const noexcept;
+template <> SType CategoricalColumn<uint32_t>::stype() const noexcept;
+extern template class CategoricalColumn<uint8_t>;
+extern template class CategoricalColumn<uint16_t>;
+extern template class CategoricalColumn<uint32_t>;
+
+
+
+//==============================================================================
+// Fixed-width string column
+//==============================================================================
+
+/**
+ * Column of stype FSTR, storing strings inline as `char[width]` arrays, one
+ * per row. Strings shorter than `width` bytes are padded with \0s, and NAs
+ * are encoded as `width` bytes 0xFF (see SType::FSTR). Since the padded
+ * strings order the same way as the strings themselves, rows can be copied,
+ * compared, hashed and sorted as blocks of memory, without the indirection
+ * through the offsets of a StringColumn. The flip side is that trailing \0
+ * characters of a string cannot be represented: `fixed_width_strings()`
+ * throws an error for such values, rather than truncating them.
+ *
+ * The `width` (in bytes) is a property of each column. The columns created
+ * via `Column::new_data_column(SType::FSTR, n)` have width 1, in all other
+ * cases the width should be given explicitly.
+ */
+class FixedStringColumn : public Column
+{
+  size_t width;
+
+public:
+  static constexpr uint8_t NA_BYTE = 0xFF;
+
+  FixedStringColumn(size_t nrows, size_t width,
+                    MemoryRange&& data = MemoryRange());
+  SType stype() const noexcept override;
+  size_t elemsize() const override;
+  bool is_fixedwidth() const override;
+
+  size_t get_width() const { return width; }
+  const char* chars() const;
+  CString get_string(size_t j) const;
+  CString mode() const;
+  static bool isna(const char* x) { return uint8_t(*x) == NA_BYTE; }
+
+  size_t data_nrows() const override;
+  void materialize() override;
+  void resize_and_fill(size_t nrows) override;
+  void apply_na_mask(const BoolColumn* mask) override;
+  Column* shallowcopy(const RowIndex& new_rowindex) const override;
+  void replace_values(RowIndex at, const Column* with) override;
+  RowIndex join(const Column* keycol) const override;
+  FixedStringStats* get_stats() const override;
+  void verify_integrity(const std::string& name) const override;
+
+  py::oobj get_value_at_index(size_t i) const override;
+  void fill_na_mask(int8_t* outmask, size_t row0, size_t row1) override;
+
+protected:
+  FixedStringColumn();
+  void init_data() override;
+  void init_mmap(const std::string& filename) override;
+  void open_mmap(const std::string& filename, bool recode) override;
+  void init_xbuf(Py_buffer* pybuffer) override;
+  void rbind_impl(std::vector<const Column*>& columns, size_t nrows,
+                  bool isempty) override;
+  void fill_na() override;
+
+  friend Column;
+};
+
+
+/**
+ * Convert column `col` into an FSTR column of the given `width`, or of the
+ * width of its longest value if `width` is 0. Non-string columns are
+ * converted via their string representation. Values longer than `width`
+ * bytes, and values ending with a \0 character are not allowed.
+ */
+Column* fixed_width_strings(const Column* col, size_t width = 0);
+
+/**
+ * Width of the FSTR column `col`.
+ */
+size_t fstr_width(const Column* col);
+
+
 //==============================================================================
 
 // "Fake" column, its only use is to serve as a placeholder for a Column with an
@@ -0,0 +1,517 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include <algorithm>                // std::sort
+#include <cstring>                  // std::memcmp
+#include <numeric>                  // std::iota
+#include <unordered_map>            // std::unordered_map
+#include "models/murmurhash.h"      // hash_murmur2
+#include "parallel/api.h"           // dt::parallel_for_static
+#include "parallel/string_utils.h"  // dt::generate_string_column
+#include "python/obj.h"
+#include "utils/assert.h"
+#include "utils/exceptions.h"
+#include "column.h"
+
+
+//------------------------------------------------------------------------------
+// Helpers
+//------------------------------------------------------------------------------
+
+// Strings are ordered byte-wise (as unsigned chars), with a prefix sorting
+// before any longer string. This is the same order as used by sort.cc.
+static inline bool str_less(const CString& a, const CString& b) {
+  size_t n = static_cast<size_t>(std::min(a.size, b.size));
+  int c = n? std::memcmp(a.ch, b.ch, n) : 0;
+  return c < 0 || (c == 0 && a.size < b.size);
+}
+
+static inline bool str_equal(const CString& a, const CString& b) {
+  return a.size == b.size &&
+         (a.size == 0 ||
+          std::memcmp(a.ch, b.ch, static_cast<size_t>(a.size)) == 0);
+}
+
+struct StrHash {
+  size_t operator()(const CString& s) const {
+    return hash_murmur2(s.ch, static_cast<uint64_t>(s.size), 0);
+  }
+};
+
+struct StrEqual {
+  bool operator()(const CString& a, const CString& b) const {
+    return str_equal(a, b);
+  }
+};
+
+
+// Return the `i`-th string in the data of string column `col` (ignoring
+// its rowindex), or an NA CString.
+template <typename O>
+static inline CString str_at(const Column* col, size_t i) {
+  auto scol = static_cast<const StringColumn<O>*>(col);
+  const O* offsets = scol->offsets();
+  O end = offsets[i];
+  if (ISNA<O>(end)) return CString();
+  O start = offsets[i - 1] & ~GETNA<O>();
+  const char* strdata = scol->strdata();
+  return CString(strdata? strdata + start : "",
+                 static_cast<int64_t>(end - start));
+}
+
+static CString level_at(const Column* levels, size_t k) {
+  return levels->stype() == SType::STR32? str_at<uint32_t>(levels, k)
+                                        : str_at<uint64_t>(levels, k);
+}
+
+
+// Binary search for `value` among the `levels`; returns the number of levels
+// if the value is not found.
+static size_t find_in_levels(const Column* levels, const CString& value) {
+  size_t n = levels->nrows;
+  if (value.isna()) return n;
+  size_t start = 0, end = n;
+  while (start < end) {
+    size_t mid = (start + end) >> 1;
+    if (str_less(level_at(levels, mid), value)) start = mid + 1;
+    else end = mid;
+  }
+  return (start < n && str_equal(level_at(levels, start), value))? start : n;
+}
+
+
+static std::shared_ptr<Column> empty_levels() {
+  MemoryRange offsets = MemoryRange::mem(sizeof(uint32_t));
+  offsets.set_element<uint32_t>(0, 0);
+  return std::shared_ptr<Column>(
+            new_string_column(0, std::move(offsets), MemoryRange()));
+}
+
+// Create the levels column out of the list of strings `strs`, taken in the
+// (sorted) order given by `order`.
+static std::shared_ptr<Column> make_levels(const std::vector<CString>& strs,
+                                           const std::vector<uint32_t>& order)
+{
+  if (order.empty()) return empty_levels();
+  Column* res = dt::generate_string_column(
+    [&](size_t k, dt::string_buf* buf) {
+      const CString& s = strs[order[k]];
+      buf->write(s.ch, static_cast<size_t>(s.size));
+    },
+    order.size());
+  return std::shared_ptr<Column>(res);
+}
+
+
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+template <> SType CategoricalColumn<uint8_t>::stype() const noexcept {
+  return SType::CAT8;
+}
+
+template <> SType CategoricalColumn<uint16_t>::stype() const noexcept {
+  return SType::CAT16;
+}
+
+template <> SType CategoricalColumn<uint32_t>::stype() const noexcept {
+  return SType::CAT32;
+}
+
+
+template <typename T>
+CategoricalColumn<T>::CategoricalColumn()
+  : FwColumn<T>(), levels(empty_levels()) {}
+
+template <typename T>
+CategoricalColumn<T>::CategoricalColumn(size_t nrows_, MemoryRange&& codes,
+                                        std::shared_ptr<Column> levels_)
+  : FwColumn<T>(nrows_, std::move(codes)), levels(std::move(levels_))
+{
+  xassert(levels && !levels->rowindex());
+  xassert(levels->stype() == SType::STR32 || levels->stype() == SType::STR64);
+  xassert(levels->nrows <= MAX_LEVELS);
+}
+
+
+Column* new_categorical_column(SType stype, MemoryRange&& codes,
+                               std::shared_ptr<Column> levels)
+{
+  size_t elemsize = info(stype).elemsize();
+  size_t nrows = codes.size() / elemsize;
+  switch (stype) {
+    case SType::CAT8:
+      return new CategoricalColumn<uint8_t>(nrows, std::move(codes), levels);
+    case SType::CAT16:
+      return new CategoricalColumn<uint16_t>(nrows, std::move(codes), levels);
+    case SType::CAT32:
+      return new CategoricalColumn<uint32_t>(nrows, std::move(codes), levels);
+    default:
+      throw ValueError() << "Invalid categorical stype " << stype;
+  }
+}
+
+
+SType categorical_stype(size_t nlevels, SType stype) {
+  xassert(is_categorical(stype));
+  SType res = nlevels <= CategoricalColumn<uint8_t>::MAX_LEVELS?  SType::CAT8 :
+              nlevels <= CategoricalColumn<uint16_t>::MAX_LEVELS? SType::CAT16 :
+                                                                  SType::CAT32;
+  if (nlevels > CategoricalColumn<uint32_t>::MAX_LEVELS) {
+    throw ValueError() << "Too many distinct values (" << nlevels
+        << ") for a categorical column";
+  }
+  return std::max(res, stype);
+}
+
+
+const std::shared_ptr<Column>& categorical_levels(const Column* col) {
+  switch (col->stype()) {
+    case SType::CAT8:
+      return static_cast<const CategoricalColumn<uint8_t>*>(col)->get_levels();
+    case SType::CAT16:
+      return static_cast<const CategoricalColumn<uint16_t>*>(col)->get_levels();
+    case SType::CAT32:
+      return static_cast<const CategoricalColumn<uint32_t>*>(col)->get_levels();
+    default:
+      throw ValueError() << "Column of stype " << col->stype()
+          << " is not categorical";
+  }
+}
+
+
+
+//------------------------------------------------------------------------------
+// Properties
+//------------------------------------------------------------------------------
+
+// The codes are fixed-width, but the values of the column are strings
+template <typename T>
+bool CategoricalColumn<T>::is_fixedwidth() const {
+  return false;
+}
+
+
+template <typename T>
+CString CategoricalColumn<T>::level(size_t k) const {
+  xassert(k < nlevels());
+  return level_at(levels.get(), k);
+}
+
+
+template <typename T>
+size_t CategoricalColumn<T>::find_level(const CString& value) const {
+  return find_in_levels(levels.get(), value);
+}
+
+
+template <typename T>
+CString CategoricalColumn<T>::mode() const {
+  T m = get_stats()->mode(this);
+  return ISNA<T>(m)? CString(nullptr, -1) : level(m);
+}
+
+
+template <typename T>
+CategoricalStats<T>* CategoricalColumn<T>::get_stats() const {
+  if (stats == nullptr) stats = new CategoricalStats<T>();
+  return static_cast<CategoricalStats<T>*>(stats);
+}
+
+
+template <typename T>
+size_t CategoricalColumn<T>::memory_footprint() const {
+  return Column::memory_footprint() + levels->memory_footprint();
+}
+
+
+template <typename T>
+py::oobj CategoricalColumn<T>::get_value_at_index(size_t i) const {
+  size_t j = (this->ri)[i];
+  if (j == RowIndex::NA) return py::None();
+  T x = this->elements_r()[j];
+  return ISNA<T>(x)? py::None() : levels->get_value_at_index(x);
+}
+
+
+
+//------------------------------------------------------------------------------
+// Modification
+//------------------------------------------------------------------------------
+
+template <typename T>
+Column* CategoricalColumn<T>::shallowcopy(const RowIndex& new_rowindex) const {
+  Column* col = Column::shallowcopy(new_rowindex);
+  static_cast<CategoricalColumn<T>*>(col)->levels = levels;
+  return col;
+}
+
+
+// Write the codes of categorical column `col` (with its rowindex applied)
+// into `out`, translating them with the `map` produced by merge_levels().
+template <typename U, typename T>
+static void _recode(const Column* col, const std::vector<uint32_t>& map,
+                    T* out)
+{
+  const U* codes = static_cast<const U*>(col->data());
+  const RowIndex& rowindex = col->rowindex();
+  const uint32_t* mapping = map.data();
+  dt::parallel_for_static(col->nrows,
+    [&](size_t i) {
+      size_t j = rowindex[i];
+      U x = (j == RowIndex::NA)? GETNA<U>() : codes[j];
+      out[i] = ISNA<U>(x)? GETNA<T>() : static_cast<T>(mapping[x]);
+    });
+}
+
+template <typename T>
+void recode_categorical(const Column* col, const std::vector<uint32_t>& map,
+                        T* out)
+{
+  switch (col->stype()) {
+    case SType::CAT8:  return _recode<uint8_t, T>(col, map, out);
+    case SType::CAT16: return _recode<uint16_t, T>(col, map, out);
+    case SType::CAT32: return _recode<uint32_t, T>(col, map, out);
+    default:
+      throw ValueError() << "Column of stype " << col->stype()
+          << " is not categorical";
+  }
+}
+
+
+/**
+ * The replacement values are converted into a categorical column, and then
+ * the levels of both columns are merged. The codes of this column are
+ * rewritten if its levels change.
+ */
+template <typename T>
+void CategoricalColumn<T>::replace_values(
+    RowIndex replace_at, const Column* replace_with)
+{
+  this->materialize();
+  if (!replace_with || replace_with->stype() == SType::VOID) {
+    return FwColumn<T>::replace_values(replace_at, GETNA<T>());
+  }
+  std::unique_ptr<Column> tmp;
+  if (!is_categorical(replace_with->stype())) {
+    tmp.reset(replace_with->cast(SType::CAT8));
+    replace_with = tmp.get();
+  }
+  std::vector<std::vector<uint32_t>> maps;
+  auto new_levels = merge_levels(
+      {levels, categorical_levels(replace_with)}, maps);
+  if (new_levels->nrows > MAX_LEVELS) {
+    throw ValueError() << "Cannot replace values in a " << stype()
+        << " column: the number of distinct values would become "
+        << new_levels->nrows << ", exceeding the maximum of " << MAX_LEVELS;
+  }
+  if (new_levels != levels) {
+    std::vector<T> codes(this->nrows);
+    recode_categorical<T>(this, maps[0], codes.data());
+    std::memcpy(this->elements_w(), codes.data(), this->nrows * sizeof(T));
+    levels = std::move(new_levels);
+  }
+
+  size_t replace_n = replace_at.size();
+  std::vector<T> values(replace_with->nrows);
+  recode_categorical<T>(replace_with, maps[1], values.data());
+  if (replace_with->nrows == 1) {
+    return FwColumn<T>::replace_values(replace_at, values[0]);
+  }
+  xassert(replace_with->nrows == replace_n);
+  T* data_dest = this->elements_w();
+  replace_at.iterate(0, replace_n, 1,
+    [&](size_t i, size_t j) {
+      if (j == RowIndex::NA) return;
+      data_dest[j] = values[i];
+    });
+  if (stats) stats->reset();
+}
+
+
+template <typename T>
+RowIndex CategoricalColumn<T>::join(const Column* keycol) const {
+  std::unique_ptr<Column> lhs(this->cast(SType::STR64));
+  std::unique_ptr<Column> rhs(keycol->cast(SType::STR64));
+  return lhs->join(rhs.get());
+}
+
+
+
+//------------------------------------------------------------------------------
+// Categorization
+//------------------------------------------------------------------------------
+
+/**
+ * Each distinct string is first assigned an id in the order of appearance.
+ * The distinct strings are then sorted, and the final codes are obtained by
+ * mapping the ids into the ranks of the corresponding strings.
+ */
+template <typename O, typename T>
+static Column* _make_codes(const std::vector<uint32_t>& ids,
+                           const std::vector<uint32_t>& rank,
+                           std::shared_ptr<Column> levels)
+{
+  size_t nrows = ids.size();
+  MemoryRange codes = MemoryRange::mem(nrows * sizeof(T));
+  T* out = static_cast<T*>(codes.xptr());
+  dt::parallel_for_static(nrows,
+    [&](size_t i) {
+      uint32_t id = ids[i];
+      out[i] = (id == NA_U4)? GETNA<T>() : static_cast<T>(rank[id]);
+    });
+  return new CategoricalColumn<T>(nrows, std::move(codes), std::move(levels));
+}
+
+template <typename O>
+static Column* _categorize(const Column* col, SType stype, size_t max_levels) {
+  const RowIndex& rowindex = col->rowindex();
+  size_t nrows = col->nrows;
+  std::unordered_map<CString, uint32_t, StrHash, StrEqual> index;
+  std::vector<CString> uniques;
+  std::vector<uint32_t> ids(nrows);
+  for (size_t i = 0; i < nrows; ++i) {
+    size_t j = rowindex[i];
+    CString s = (j == RowIndex::NA)? CString() : str_at<O>(col, j);
+    if (s.isna()) {
+      ids[i] = NA_U4;
+      continue;
+    }
+    auto it = index.find(s);
+    if (it != index.end()) {
+      ids[i] = it->second;
+      continue;
+    }
+    size_t n = uniques.size();
+    if (max_levels && n == max_levels) return nullptr;
+    if (n == CategoricalColumn<uint32_t>::MAX_LEVELS) {
+      throw ValueError() << "Too many distinct values in a column to "
+          "convert it into " << stype;
+    }
+    index.emplace(s, static_cast<uint32_t>(n));
+    uniques.push_back(s);
+    ids[i] = static_cast<uint32_t>(n);
+  }
+
+  size_t nlevels = uniques.size();
+  std::vector<uint32_t> order(nlevels);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(),
+            [&](uint32_t a, uint32_t b) {
+              return str_less(uniques[a], uniques[b]);
+            });
+  std::vector<uint32_t> rank(nlevels);
+  for (size_t k = 0; k < nlevels; ++k) {
+    rank[order[k]] = static_cast<uint32_t>(k);
+  }
+  auto levels = make_levels(uniques, order);
+
+  switch (categorical_stype(nlevels, stype)) {
+    case SType::CAT8:  return _make_codes<O, uint8_t>(ids, rank, levels);
+    case SType::CAT16: return _make_codes<O, uint16_t>(ids, rank, levels);
+    default:           return _make_codes<O, uint32_t>(ids, rank, levels);
+  }
+}
+
+
+Column* categorize(const Column* col, SType stype, size_t max_levels) {
+  xassert(is_categorical(stype));
+  switch (col->stype()) {
+    case SType::STR32: return _categorize<uint32_t>(col, stype, max_levels);
+    case SType::STR64: return _categorize<uint64_t>(col, stype, max_levels);
+    default:
+      throw ValueError() << "Cannot categorize a column of stype "
+          << col->stype();
+  }
+}
+
+
+std::vector<uint32_t> match_levels(const Column* col, const Column* target) {
+  const Column* levels = categorical_levels(col).get();
+  const Column* target_levels = categorical_levels(target).get();
+  size_t n = levels->nrows;
+  std::vector<uint32_t> map(n);
+  if (levels == target_levels) {
+    std::iota(map.begin(), map.end(), 0);
+  } else {
+    dt::parallel_for_static(n,
+      [&](size_t k) {
+        CString value = level_at(levels, k);
+        map[k] = static_cast<uint32_t>(find_in_levels(target_levels, value));
+      });
+  }
+  return map;
+}
+
+
+/**
+ * All levels are collected and sorted together; then the equal strings are
+ * assigned the same new code. When all inputs share the same levels column,
+ * it is returned as-is, with identity maps.
+ */
+std::shared_ptr<Column> merge_levels(
+    const std::vector<std::shared_ptr<Column>>& levels,
+    std::vector<std::vector<uint32_t>>& maps)
+{
+  size_t n = levels.size();
+  xassert(n > 0);
+  maps.clear();
+  maps.resize(n);
+  bool all_same = true;
+  for (size_t i = 1; i < n; ++i) all_same &= (levels[i] == levels[0]);
+  if (all_same) {
+    for (size_t i = 0; i < n; ++i) {
+      maps[i].resize(levels[i]->nrows);
+      std::iota(maps[i].begin(), maps[i].end(), 0);
+    }
+    return levels[0];
+  }
+
+  struct Entry { CString str; uint32_t src; uint32_t idx; };
+  std::vector<Entry> entries;
+  for (size_t i = 0; i < n; ++i) {
+    size_t nl = levels[i]->nrows;
+    maps[i].resize(nl);
+    for (size_t k = 0; k < nl; ++k) {
+      entries.push_back(Entry { level_at(levels[i].get(), k),
+                                static_cast<uint32_t>(i),
+                                static_cast<uint32_t>(k) });
+    }
+  }
+  std::stable_sort(entries.begin(), entries.end(),
+                   [](const Entry& a, const Entry& b) {
+                     return str_less(a.str, b.str);
+                   });
+  std::vector<CString> uniques;
+  for (const Entry& e : entries) {
+    if (uniques.empty() || !str_equal(uniques.back(), e.str)) {
+      uniques.push_back(e.str);
+    }
+    maps[e.src][e.idx] = static_cast<uint32_t>(uniques.size() - 1);
+  }
+  std::vector<uint32_t> order(uniques.size());
+  std::iota(order.begin(), order.end(), 0);
+  return make_levels(uniques, order);
+}
+
+
+
+//------------------------------------------------------------------------------
+// Explicit instantiation of templates
+//------------------------------------------------------------------------------
+
+template class CategoricalColumn<uint8_t>;
+template class CategoricalColumn<uint16_t>;
+template class CategoricalColumn<uint32_t>;
+template void recode_categorical(const Column*, const std::vector<uint32_t>&,
+                                 uint8_t*);
+template void recode_categorical(const Column*, const std::vector<uint32_t>&,
+                                 uint16_t*);
+template void recode_categorical(const Column*, const std::vector<uint32_t>&,
+                                 uint32_t*);
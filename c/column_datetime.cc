@@ -0,0 +1,39 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include "column.h"
+#include "python/datetime.h"
+
+
+
+template <SType s>
+SType DatetimeColumn<s>::stype() const noexcept {
+  return s;
+}
+
+
+template <SType s>
+py::oobj DatetimeColumn<s>::get_value_at_index(size_t i) const {
+  using T = element_t<s>;
+  size_t j = (this->ri)[i];
+  T x = this->elements_r()[j];
+  if (ISNA<T>(x)) return py::None();
+  switch (s) {
+    case SType::DATE64: return py::odatetime(static_cast<int64_t>(x));
+    case SType::TIME32: return py::otime(static_cast<int32_t>(x));
+    default:            return py::odate(static_cast<int32_t>(x));
+  }
+}
+
+
+
+//------------------------------------------------------------------------------
+
+// Explicit instantiation of the template
+template class DatetimeColumn<SType::DATE64>;
+template class DatetimeColumn<SType::TIME32>;
+template class DatetimeColumn<SType::DATE32>;
@@ -0,0 +1,286 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include <algorithm>                // std::max, std::min
+#include <cmath>                    // std::fabs, std::llround
+#include <limits>                   // std::numeric_limits
+#include <memory>                   // std::unique_ptr
+#include <mutex>                    // std::mutex, std::lock_guard
+#include "parallel/api.h"           // dt::parallel_for_static
+#include "python/decimal.h"         // py::odecimal
+#include "utils/assert.h"
+#include "utils/decimal.h"
+#include "column.h"
+
+
+//------------------------------------------------------------------------------
+// Helpers
+//------------------------------------------------------------------------------
+
+int decimal_max_scale(SType stype) {
+  switch (stype) {
+    case SType::DEC16: return 4;
+    case SType::DEC32: return 9;
+    case SType::DEC64: return 18;
+    default: throw ValueError() << "Stype " << stype << " is not decimal";
+  }
+}
+
+
+int decimal_scale(const Column* col) {
+  switch (col->stype()) {
+    case SType::DEC16: return static_cast<const DecimalColumn<int16_t>*>(col)->get_scale();
+    case SType::DEC32: return static_cast<const DecimalColumn<int32_t>*>(col)->get_scale();
+    case SType::DEC64: return static_cast<const DecimalColumn<int64_t>*>(col)->get_scale();
+    default: throw ValueError() << "Column of stype " << col->stype()
+                                << " is not decimal";
+  }
+}
+
+
+Column* new_decimal_column(SType stype, size_t nrows, int scale,
+                           MemoryRange&& mr)
+{
+  xassert(scale >= 0 && scale <= decimal_max_scale(stype));
+  switch (stype) {
+    case SType::DEC16: return new DecimalColumn<int16_t>(nrows, scale, std::move(mr));
+    case SType::DEC32: return new DecimalColumn<int32_t>(nrows, scale, std::move(mr));
+    case SType::DEC64: return new DecimalColumn<int64_t>(nrows, scale, std::move(mr));
+    default: throw ValueError() << "Stype " << stype << " is not decimal";
+  }
+}
+
+
+
+//------------------------------------------------------------------------------
+// Conversion into decimals
+//------------------------------------------------------------------------------
+
+// Each "reader" below provides the values of the source column as integers
+// with a scale. Method `get(i, target, &x, &s)` returns false if the i-th
+// value is NA (or cannot be represented), otherwise it stores the value in
+// `x` with scale `s`. The `target` scale is a hint: readers that have to
+// round anyway (floats) produce their values directly at that scale. When
+// `target` is negative, only the scale `s` is required.
+//
+// Property `scale` is the common scale of all values, or -1 if the values
+// may have different scales.
+
+template <typename T>
+struct int_reader {
+  const T* data;
+  const RowIndex& ri;
+  int scale;
+
+  int_reader(const Column* col, int scale_)
+    : data(static_cast<const T*>(col->data())), ri(col->rowindex()),
+      scale(scale_) {}
+
+  bool get(size_t i, int, int64_t* x, int* s) const {
+    size_t j = ri[i];
+    if (j == RowIndex::NA || ISNA<T>(data[j])) return false;
+    *x = static_cast<int64_t>(data[j]);
+    *s = scale;
+    return true;
+  }
+};
+
+
+template <typename T>
+struct real_reader {
+  const T* data;
+  const RowIndex& ri;
+  int scale;
+  int maxscale;
+
+  real_reader(const Column* col, int maxscale_)
+    : data(static_cast<const T*>(col->data())), ri(col->rowindex()),
+      scale(-1), maxscale(maxscale_) {}
+
+  bool get(size_t i, int target, int64_t* x, int* s) const {
+    size_t j = ri[i];
+    if (j == RowIndex::NA || ISNA<T>(data[j])) return false;
+    double v = static_cast<double>(data[j]);
+    if (target < 0) {
+      *s = dt::decimal_scale_of(v, maxscale);
+      return true;
+    }
+    double y = v * static_cast<double>(dt::pow10i(target));
+    if (!(std::fabs(y) < 9.2e18)) return false;
+    *x = std::llround(y);
+    *s = target;
+    return true;
+  }
+};
+
+
+template <typename T>
+struct str_reader {
+  const T* offsets;
+  const char* strdata;
+  const RowIndex& ri;
+  int scale;
+
+  explicit str_reader(const Column* col)
+    : offsets(static_cast<const StringColumn<T>*>(col)->offsets()),
+      strdata(static_cast<const StringColumn<T>*>(col)->strdata()),
+      ri(col->rowindex()), scale(-1) {}
+
+  bool get(size_t i, int, int64_t* x, int* s) const {
+    size_t j = ri[i];
+    if (j == RowIndex::NA || ISNA<T>(offsets[j])) return false;
+    T start = offsets[j - 1] & ~GETNA<T>();
+    const char* ch = strdata + start;
+    const char* end = strdata + offsets[j];
+    return dt::parse_decimal(ch, end, '.', 18, x, s) && ch == end;
+  }
+};
+
+
+template <typename T, typename R>
+static Column* _make_decimal(const R& reader, size_t nrows, SType stype,
+                             int scale)
+{
+  int maxscale = decimal_max_scale(stype);
+  if (scale < 0) {
+    scale = reader.scale;
+    if (scale < 0) {
+      std::mutex m;
+      scale = 0;
+      dt::parallel_region(
+        [&] {
+          int tscale = 0;
+          int64_t x;
+          int s;
+          dt::parallel_for_static(nrows,
+            [&](size_t i) {
+              if (reader.get(i, -1, &x, &s)) tscale = std::max(tscale, s);
+            });
+          std::lock_guard<std::mutex> lock(m);
+          scale = std::max(scale, tscale);
+        });
+    }
+    scale = std::min(scale, maxscale);
+  }
+
+  constexpr int64_t tmax = std::numeric_limits<T>::max();
+  Column* res = new_decimal_column(stype, nrows, scale);
+  T* out = static_cast<T*>(res->data_w());
+  dt::parallel_for_static(nrows,
+    [&](size_t i) {
+      int64_t x, y;
+      int s;
+      bool ok = reader.get(i, scale, &x, &s) &&
+                dt::rescale_decimal(x, s, scale, &y) &&
+                y <= tmax && y >= -tmax;
+      out[i] = ok? static_cast<T>(y) : GETNA<T>();
+    });
+  return res;
+}
+
+
+template <typename T>
+static Column* _to_decimal(const Column* col, SType stype, int scale) {
+  size_t n = col->nrows;
+  int maxscale = decimal_max_scale(stype);
+  switch (col->stype()) {
+    case SType::BOOL:
+    case SType::INT8:  return _make_decimal<T>(int_reader<int8_t>(col, 0), n, stype, scale);
+    case SType::INT16: return _make_decimal<T>(int_reader<int16_t>(col, 0), n, stype, scale);
+    case SType::INT32: return _make_decimal<T>(int_reader<int32_t>(col, 0), n, stype, scale);
+    case SType::INT64: return _make_decimal<T>(int_reader<int64_t>(col, 0), n, stype, scale);
+    case SType::DEC16: return _make_decimal<T>(int_reader<int16_t>(col, decimal_scale(col)), n, stype, scale);
+    case SType::DEC32: return _make_decimal<T>(int_reader<int32_t>(col, decimal_scale(col)), n, stype, scale);
+    case SType::DEC64: return _make_decimal<T>(int_reader<int64_t>(col, decimal_scale(col)), n, stype, scale);
+    case SType::FLOAT32: return _make_decimal<T>(real_reader<float>(col, maxscale), n, stype, scale);
+    case SType::FLOAT64: return _make_decimal<T>(real_reader<double>(col, maxscale), n, stype, scale);
+    case SType::STR32: return _make_decimal<T>(str_reader<uint32_t>(col), n, stype, scale);
+    case SType::STR64: return _make_decimal<T>(str_reader<uint64_t>(col), n, stype, scale);
+    default: {
+      std::unique_ptr<Column> tmp(col->cast(SType::STR32));
+      return _make_decimal<T>(str_reader<uint32_t>(tmp.get()), n, stype, scale);
+    }
+  }
+}
+
+
+Column* decimal_column(const Column* col, SType stype, int scale) {
+  if (col->stype() == stype && !col->rowindex() &&
+      (scale < 0 || scale == decimal_scale(col))) {
+    return col->shallowcopy();
+  }
+  switch (stype) {
+    case SType::DEC16: return _to_decimal<int16_t>(col, stype, scale);
+    case SType::DEC32: return _to_decimal<int32_t>(col, stype, scale);
+    case SType::DEC64: return _to_decimal<int64_t>(col, stype, scale);
+    default: throw ValueError() << "Stype " << stype << " is not decimal";
+  }
+}
+
+
+
+//------------------------------------------------------------------------------
+// DecimalColumn
+//------------------------------------------------------------------------------
+
+template <typename T>
+DecimalColumn<T>::DecimalColumn() : IntColumn<T>(), scale(0) {}
+
+template <typename T>
+DecimalColumn<T>::DecimalColumn(size_t nrows_, int scale_, MemoryRange&& mr)
+  : IntColumn<T>(nrows_, std::move(mr)), scale(scale_) {}
+
+
+template <typename T>
+SType DecimalColumn<T>::stype() const noexcept {
+  return sizeof(T) == 2? SType::DEC16 :
+         sizeof(T) == 4? SType::DEC32 :
+         sizeof(T) == 8? SType::DEC64 : SType::VOID;
+}
+
+
+template <typename T>
+py::oobj DecimalColumn<T>::get_value_at_index(size_t i) const {
+  size_t j = (this->ri)[i];
+  if (j == RowIndex::NA) return py::None();
+  T x = this->elements_r()[j];
+  return ISNA<T>(x)? py::None() : py::odecimal(static_cast<int64_t>(x), scale);
+}
+
+
+template <typename T>
+Column* DecimalColumn<T>::shallowcopy(const RowIndex& new_rowindex) const {
+  Column* col = Column::shallowcopy(new_rowindex);
+  static_cast<DecimalColumn<T>*>(col)->scale = scale;
+  return col;
+}
+
+
+/**
+ * The replacement values are converted into decimals with the scale of this
+ * column (rounding them if necessary).
+ */
+template <typename T>
+void DecimalColumn<T>::replace_values(RowIndex replace_at,
+                                      const Column* replace_with)
+{
+  std::unique_ptr<Column> tmp;
+  if (replace_with && replace_with->stype() != SType::VOID) {
+    tmp.reset(decimal_column(replace_with, stype(), scale));
+    replace_with = tmp.get();
+  }
+  FwColumn<T>::replace_values(replace_at, replace_with);
+}
+
+
+
+//------------------------------------------------------------------------------
+
+// Explicit instantiation of the template
+template class DecimalColumn<int16_t>;
+template class DecimalColumn<int32_t>;
+template class DecimalColumn<int64_t>;
@@ -6,12 +6,18 @@
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
 #include "column.h"
+#include <algorithm>       // std::max
 #include <cstdlib>         // std::abs
 #include <limits>          // std::numeric_limits
+#include <memory>          // std::unique_ptr
 #include <type_traits>     // std::is_same
 #include "python/_all.h"
+#include "python/datetime.h"
+#include "python/decimal.h"
 #include "python/list.h"   // py::olist
 #include "python/string.h" // py::ostring
+#include "utils/datetime.h"
+#include "utils/decimal.h"
 #include "utils/exceptions.h"
 #include "utils/misc.h"
 
@@ -448,6 +454,181 @@ static void force_as_str(const iterable* list, MemoryRange& offbuf,
 
 
 
+//------------------------------------------------------------------------------
+// Date / time
+//------------------------------------------------------------------------------
+
+// Convert a python date / datetime / time object `item`, whose stype is
+// `item_stype`, into a value of the temporal stype `s`. Returns false if
+// such conversion is not possible without loss of information.
+template <SType s>
+static bool temporal_value(const py::robj& item, SType item_stype,
+                           element_t<s>* out)
+{
+  if (s == SType::DATE64) {
+    if (item_stype == SType::DATE64) {
+      *out = static_cast<element_t<s>>(py::datetime_value(item));
+      return true;
+    }
+    if (item_stype == SType::DATE32) {
+      *out = static_cast<element_t<s>>(py::date_value(item) *
+                                       dt::MICROS_PER_DAY);
+      return true;
+    }
+    return false;
+  }
+  if (item_stype != s) return false;
+  *out = static_cast<element_t<s>>(s == SType::DATE32? py::date_value(item)
+                                                     : py::time_value(item));
+  return true;
+}
+
+
+/**
+ * Convert python list into a column of temporal stype `s`, if possible. The
+ * parser recognizes python `None`, and `datetime.date` objects for DATE32,
+ * `datetime.time` objects for TIME32, and `datetime.datetime` objects for
+ * DATE64. The latter also accepts `datetime.date`s (as midnight), provided
+ * that at least one datetime is present in the list: a list with dates only
+ * is parsed as DATE32 instead.
+ */
+template <SType s>
+static bool parse_as_temporal(const iterable* list, MemoryRange& membuf,
+                              size_t& from)
+{
+  using T = element_t<s>;
+  size_t nrows = list->size();
+  membuf.resize(nrows * sizeof(T));
+  T* outdata = static_cast<T*>(membuf.wptr());
+
+  bool has_datetime = false;
+  for (int j = 0; j < 2; ++j) {
+    size_t ifrom = j ? 0 : from;
+    size_t ito   = j ? from : nrows;
+    for (size_t i = ifrom; i < ito; ++i) {
+      py::robj item = list->item(i);
+      if (item.is_none()) {
+        outdata[i] = GETNA<T>();
+        continue;
+      }
+      SType item_stype = py::temporal_stype(item);
+      if (temporal_value<s>(item, item_stype, outdata + i)) {
+        has_datetime |= (item_stype == SType::DATE64);
+        continue;
+      }
+      from = i;
+      return false;
+    }
+  }
+  return s != SType::DATE64 || has_datetime;
+}
+
+
+// Parse the entire string [ch, end) as an ISO-8601 value of stype `s`.
+static bool parse_iso(SType s, const char* ch, const char* end, int32_t* out) {
+  bool ok = s == SType::DATE32? dt::parse_date32(ch, end, out)
+                              : dt::parse_time32(ch, end, out);
+  return ok && ch == end;
+}
+
+static bool parse_iso(SType, const char* ch, const char* end, int64_t* out) {
+  return dt::parse_date64(ch, end, out, true) && ch == end;
+}
+
+
+/**
+ * Force-convert python list into a temporal column of stype `s`. In addition
+ * to the objects recognized by `parse_as_temporal()`, this also accepts
+ * strings in ISO-8601 format; a datetime is truncated to its date (for
+ * DATE32) or to its time (for TIME32). All other values become NAs.
+ */
+template <SType s>
+static void force_as_temporal(const iterable* list, MemoryRange& membuf)
+{
+  using T = element_t<s>;
+  size_t nrows = list->size();
+  membuf.resize(nrows * sizeof(T));
+  T* outdata = static_cast<T*>(membuf.wptr());
+
+  for (size_t i = 0; i < nrows; ++i) {
+    py::robj item = list->item(i);
+    T& out = outdata[i];
+    out = GETNA<T>();
+    if (item.is_none()) continue;
+    SType item_stype = py::temporal_stype(item);
+    if (temporal_value<s>(item, item_stype, &out)) continue;
+    if (item_stype == SType::DATE64) {
+      int64_t t = py::datetime_value(item);
+      out = static_cast<T>(
+          s == SType::DATE32? dt::date64_days(t)
+                            : dt::date64_time(t) / dt::MICROS_PER_MILLI);
+    }
+    else if (item.is_string()) {
+      CString cstr = item.to_cstring();
+      T value;
+      if (parse_iso(s, cstr.ch, cstr.ch + cstr.size, &value)) out = value;
+    }
+  }
+}
+
+
+
+//------------------------------------------------------------------------------
+// Decimal
+//------------------------------------------------------------------------------
+
+// Convert a python `decimal.Decimal` or `int` into an integer with a scale.
+// Returns false if the item is neither, or its value cannot be represented.
+static bool decimal_item(const py::robj& item, int64_t* value, int* scale) {
+  if (py::is_pydecimal(item)) {
+    return py::decimal_value(item, value, scale);
+  }
+  if (item.is_int()) {
+    int overflow = 0;
+    *value = item.to_pyint().ovalue<int64_t>(&overflow);
+    *scale = 0;
+    return !overflow && !ISNA<int64_t>(*value);
+  }
+  return false;
+}
+
+
+/**
+ * Convert python list into a DEC64 column, if possible. The parser recognizes
+ * python `None`, `decimal.Decimal` objects, and integers (a list that has no
+ * Decimals at all never reaches this parser, since it would have been parsed
+ * as an integer column already). The scale of the column is the largest
+ * scale among its values.
+ */
+static bool parse_as_decimal(const iterable* list, MemoryRange& membuf,
+                             int* scale)
+{
+  size_t nrows = list->size();
+  membuf.resize(nrows * sizeof(int64_t));
+  int64_t* outdata = static_cast<int64_t*>(membuf.wptr());
+
+  int maxscale = 0;
+  int64_t x;
+  int s;
+  for (size_t i = 0; i < nrows; ++i) {
+    py::robj item = list->item(i);
+    if (item.is_none()) continue;
+    if (!decimal_item(item, &x, &s)) return false;
+    maxscale = std::max(maxscale, s);
+  }
+  for (size_t i = 0; i < nrows; ++i) {
+    py::robj item = list->item(i);
+    outdata[i] = GETNA<int64_t>();
+    if (item.is_none()) continue;
+    decimal_item(item, &x, &s);
+    if (!dt::rescale_decimal(x, s, maxscale, outdata + i)) return false;
+  }
+  *scale = maxscale;
+  return true;
+}
+
+
+
 //------------------------------------------------------------------------------
 // Object
 //------------------------------------------------------------------------------
@@ -497,11 +678,29 @@ static SType find_next_stype(SType curr_stype, int stype0) {
 
 Column* Column::from_py_iterable(const iterable* il, int stype0)
 {
+  if (stype0 > 0 && is_categorical(static_cast<SType>(stype0))) {
+    // Categorical columns are built out of the string representation of
+    // the values.
+    std::unique_ptr<Column> strcol(from_py_iterable(il, int(SType::STR32)));
+    return categorize(strcol.get(), static_cast<SType>(stype0));
+  }
+  if (stype0 == int(SType::FSTR)) {
+    // The width of an fstr column is that of its longest value.
+    std::unique_ptr<Column> strcol(from_py_iterable(il, int(SType::STR32)));
+    return fixed_width_strings(strcol.get());
+  }
+  if (stype0 > 0 && is_decimal(static_cast<SType>(stype0))) {
+    // Decimal values are converted from their python objects, which are
+    // parsed as strings if they are not numbers already.
+    std::unique_ptr<Column> objcol(from_py_iterable(il, int(SType::OBJ)));
+    return decimal_column(objcol.get(), static_cast<SType>(stype0));
+  }
   MemoryRange membuf;
   MemoryRange strbuf;
   // TODO: Perhaps `stype` and `curr_stype` should have type SType ?
   SType stype = find_next_stype(SType::VOID, stype0);
   size_t i = 0;
+  int scale = 0;
   while (stype != SType::VOID) {
     SType next_stype = find_next_stype(stype, stype0);
     if (stype == next_stype) {
@@ -515,6 +714,9 @@ Column* Column::from_py_iterable(const iterable* il, int stype0)
         case SType::FLOAT64: force_as_real<double>(il, membuf); break;
         case SType::STR32:   force_as_str<uint32_t>(il, membuf, strbuf); break;
         case SType::STR64:   force_as_str<uint64_t>(il, membuf, strbuf); break;
+        case SType::DATE64:  force_as_temporal<SType::DATE64>(il, membuf); break;
+        case SType::TIME32:  force_as_temporal<SType::TIME32>(il, membuf); break;
+        case SType::DATE32:  force_as_temporal<SType::DATE32>(il, membuf); break;
         case SType::OBJ:     parse_as_pyobj(il, membuf); break;
         default:
           throw RuntimeError()
@@ -530,8 +732,12 @@ Column* Column::from_py_iterable(const iterable* il, int stype0)
         case SType::INT32:   ret = parse_as_int<int32_t>(il, membuf, i); break;
         case SType::INT64:   ret = parse_as_int<int64_t>(il, membuf, i); break;
         case SType::FLOAT64: ret = parse_as_double(il, membuf, i); break;
+        case SType::DEC64:   ret = parse_as_decimal(il, membuf, &scale); break;
         case SType::STR32:   ret = parse_as_str<uint32_t>(il, membuf, strbuf); break;
         case SType::STR64:   ret = parse_as_str<uint64_t>(il, membuf, strbuf); break;
+        case SType::DATE64:  ret = parse_as_temporal<SType::DATE64>(il, membuf, i); break;
+        case SType::TIME32:  ret = parse_as_temporal<SType::TIME32>(il, membuf, i); break;
+        case SType::DATE32:  ret = parse_as_temporal<SType::DATE32>(il, membuf, i); break;
         case SType::OBJ:     ret = parse_as_pyobj(il, membuf); break;
         default: /* do nothing -- not all STypes are currently implemented. */ break;
       }
@@ -543,6 +749,9 @@ Column* Column::from_py_iterable(const iterable* il, int stype0)
     size_t nrows = il->size();
     return new_string_column(nrows, std::move(membuf), std::move(strbuf));
   }
+  else if (stype == SType::DEC64) {
+    return new_decimal_column(stype, il->size(), scale, std::move(membuf));
+  }
   else {
     if (stype == SType::OBJ) {
       membuf.set_pyobjects(/* clear_data = */ false);
@@ -586,10 +795,15 @@ static Column* _make_range_column(
 {
   Column* col = Column::new_data_column(stype, static_cast<size_t>(length));
   T* elems = static_cast<T*>(col->data_w());
+  size_t countna = 0;
   for (int64_t i = 0, j = start; i < length; ++i) {
     elems[i] = static_cast<T>(j);
+    countna += ISNA<T>(elems[i]);
     j += step;
   }
+  // The NA count is recorded so that kernels can rely on the column being
+  // NA-free (values may only become NA if they overflow type T).
+  col->get_stats()->set_countna(countna);
   return col;
 }
 
@@ -0,0 +1,385 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include <algorithm>                // std::max
+#include <atomic>                   // std::atomic
+#include <cstring>                  // std::memcpy, std::memset
+#include <memory>                   // std::unique_ptr
+#include <mutex>                    // std::mutex, std::lock_guard
+#include "parallel/api.h"           // dt::parallel_for_static
+#include "python/string.h"          // py::ostring
+#include "utils/assert.h"
+#include "utils/exceptions.h"
+#include "column.h"
+
+
+//------------------------------------------------------------------------------
+// Helpers
+//------------------------------------------------------------------------------
+
+// Copy the values of FSTR column `col` (with its rowindex applied) into the
+// buffer `out` having `width` bytes per row. The width of `col` may not be
+// larger than `width`.
+static void copy_padded(const FixedStringColumn* col, char* out, size_t width)
+{
+  size_t srcwidth = col->get_width();
+  xassert(srcwidth <= width);
+  const char* src = col->chars();
+  const RowIndex& rowindex = col->rowindex();
+  dt::parallel_for_static(col->nrows,
+    [&](size_t i) {
+      size_t j = rowindex[i];
+      char* dest = out + i * width;
+      if (j == RowIndex::NA || FixedStringColumn::isna(src + j * srcwidth)) {
+        std::memset(dest, FixedStringColumn::NA_BYTE, width);
+      } else {
+        std::memcpy(dest, src + j * srcwidth, srcwidth);
+        std::memset(dest + srcwidth, 0, width - srcwidth);
+      }
+    });
+}
+
+
+// Return the `j`-th string in the data of string column `col` (ignoring its
+// rowindex), or an NA CString.
+template <typename T>
+static inline CString str_at(const StringColumn<T>* col, size_t j) {
+  const T* offsets = col->offsets();
+  T end = offsets[j];
+  if (ISNA<T>(end)) return CString();
+  T start = offsets[j - 1] & ~GETNA<T>();
+  // The string data buffer may be empty (and null) if all strings are empty
+  const char* strdata = col->strdata();
+  return CString(strdata? strdata + start : "",
+                 static_cast<int64_t>(end - start));
+}
+
+
+template <typename T>
+static Column* _from_strings(const Column* col, size_t width) {
+  auto scol = static_cast<const StringColumn<T>*>(col);
+  const RowIndex& rowindex = col->rowindex();
+  size_t nrows = col->nrows;
+
+  if (width == 0) {
+    std::mutex m;
+    dt::parallel_region(
+      [&] {
+        size_t tmaxlen = 0;
+        dt::parallel_for_static(nrows,
+          [&](size_t i) {
+            size_t j = rowindex[i];
+            if (j == RowIndex::NA) return;
+            CString s = str_at<T>(scol, j);
+            tmaxlen = std::max(tmaxlen, static_cast<size_t>(s.size));
+          });
+        std::lock_guard<std::mutex> lock(m);
+        width = std::max(width, tmaxlen);
+      });
+    if (width == 0) width = 1;
+  }
+
+  MemoryRange data = MemoryRange::mem(nrows * width);
+  char* out = static_cast<char*>(data.xptr());
+  std::atomic<size_t> too_long { size_t(-1) };
+  std::atomic<size_t> ends_with_nul { size_t(-1) };
+  dt::parallel_for_static(nrows,
+    [&](size_t i) {
+      size_t j = rowindex[i];
+      char* dest = out + i * width;
+      CString s = (j == RowIndex::NA)? CString() : str_at<T>(scol, j);
+      if (s.isna()) {
+        std::memset(dest, FixedStringColumn::NA_BYTE, width);
+        return;
+      }
+      size_t len = static_cast<size_t>(s.size);
+      if (len > width) {
+        too_long = i;
+        len = width;
+      }
+      if (len && s.ch[len - 1] == '\0') ends_with_nul = i;
+      if (len) std::memcpy(dest, s.ch, len);
+      std::memset(dest + len, 0, width - len);
+    });
+  size_t irow = too_long.load();
+  if (irow != size_t(-1)) {
+    throw ValueError() << "Value in row " << irow << " is longer than "
+        << width << " bytes, and cannot be stored in an fstr column of "
+           "this width";
+  }
+  irow = ends_with_nul.load();
+  if (irow != size_t(-1)) {
+    throw ValueError() << "Value in row " << irow << " ends with a \\0 "
+        "character, and cannot be stored in an fstr column, where the values "
+        "are padded with \\0s";
+  }
+  return new FixedStringColumn(nrows, width, std::move(data));
+}
+
+
+Column* fixed_width_strings(const Column* col, size_t width) {
+  switch (col->stype()) {
+    case SType::FSTR: {
+      auto xcol = static_cast<const FixedStringColumn*>(col);
+      size_t srcwidth = xcol->get_width();
+      if (width == 0 || width == srcwidth) {
+        if (!col->rowindex()) return col->shallowcopy();
+        width = srcwidth;
+      }
+      if (width >= srcwidth) {
+        MemoryRange data = MemoryRange::mem(col->nrows * width);
+        copy_padded(xcol, static_cast<char*>(data.xptr()), width);
+        return new FixedStringColumn(col->nrows, width, std::move(data));
+      }
+      // Narrowing requires checking the actual lengths of all values
+      std::unique_ptr<Column> tmp(col->cast(SType::STR32));
+      return _from_strings<uint32_t>(tmp.get(), width);
+    }
+    case SType::STR32: return _from_strings<uint32_t>(col, width);
+    case SType::STR64: return _from_strings<uint64_t>(col, width);
+    default: {
+      std::unique_ptr<Column> tmp(col->cast(SType::STR32));
+      return _from_strings<uint32_t>(tmp.get(), width);
+    }
+  }
+}
+
+
+size_t fstr_width(const Column* col) {
+  xassert(col->stype() == SType::FSTR);
+  return static_cast<const FixedStringColumn*>(col)->get_width();
+}
+
+
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+FixedStringColumn::FixedStringColumn() : Column(0), width(1) {}
+
+FixedStringColumn::FixedStringColumn(size_t nrows_, size_t width_,
+                                     MemoryRange&& data)
+  : Column(nrows_), width(width_)
+{
+  xassert(width > 0);
+  size_t req_size = nrows_ * width;
+  if (data) {
+    xassert(data.size() == req_size);
+  } else {
+    data.resize(req_size);
+  }
+  mbuf = std::move(data);
+}
+
+
+void FixedStringColumn::init_data() {
+  xassert(!ri);
+  mbuf.resize(nrows * width);
+}
+
+void FixedStringColumn::init_mmap(const std::string& filename) {
+  xassert(!ri);
+  mbuf = MemoryRange::mmap(filename, nrows * width);
+}
+
+void FixedStringColumn::open_mmap(const std::string& filename, bool) {
+  xassert(!ri);
+  mbuf = MemoryRange::mmap(filename);
+}
+
+void FixedStringColumn::init_xbuf(Py_buffer*) {
+  throw Error() << "Cannot create an fstr column from a buffer";
+}
+
+
+
+//------------------------------------------------------------------------------
+// Properties
+//------------------------------------------------------------------------------
+
+SType FixedStringColumn::stype() const noexcept {
+  return SType::FSTR;
+}
+
+size_t FixedStringColumn::elemsize() const {
+  return width;
+}
+
+// The values of the column are strings, even though they are stored in
+// fixed-width slots.
+bool FixedStringColumn::is_fixedwidth() const {
+  return false;
+}
+
+size_t FixedStringColumn::data_nrows() const {
+  return mbuf.size() / width;
+}
+
+const char* FixedStringColumn::chars() const {
+  return static_cast<const char*>(mbuf.rptr());
+}
+
+
+// Return the string stored at index `j` in the data buffer (the rowindex
+// is not applied), without its padding.
+CString FixedStringColumn::get_string(size_t j) const {
+  const char* x = chars() + j * width;
+  if (isna(x)) return CString(nullptr, -1);
+  size_t len = width;
+  while (len && x[len - 1] == '\0') len--;
+  return CString(x, static_cast<int64_t>(len));
+}
+
+
+CString FixedStringColumn::mode() const {
+  return get_stats()->mode(this);
+}
+
+
+FixedStringStats* FixedStringColumn::get_stats() const {
+  if (stats == nullptr) stats = new FixedStringStats();
+  return static_cast<FixedStringStats*>(stats);
+}
+
+
+py::oobj FixedStringColumn::get_value_at_index(size_t i) const {
+  size_t j = ri[i];
+  if (j == RowIndex::NA) return py::None();
+  CString s = get_string(j);
+  if (s.isna()) return py::None();
+  return py::ostring(s.ch, static_cast<size_t>(s.size));
+}
+
+
+void FixedStringColumn::fill_na_mask(int8_t* outmask, size_t row0,
+                                     size_t row1)
+{
+  const char* data = chars();
+  ri.iterate(row0, row1, 1,
+    [&](size_t i, size_t j) {
+      outmask[i] = (j == RowIndex::NA) || isna(data + j * width);
+    });
+}
+
+
+
+//------------------------------------------------------------------------------
+// Modification
+//------------------------------------------------------------------------------
+
+void FixedStringColumn::materialize() {
+  if (!ri) return;
+  MemoryRange newmr = MemoryRange::mem(nrows * width);
+  copy_padded(this, static_cast<char*>(newmr.xptr()), width);
+  mbuf = std::move(newmr);
+  ri.clear();
+}
+
+
+void FixedStringColumn::resize_and_fill(size_t new_nrows) {
+  if (new_nrows == nrows) return;
+  materialize();
+
+  mbuf.resize(width * new_nrows);
+  if (new_nrows > nrows) {
+    char* data = static_cast<char*>(mbuf.wptr());
+    if (nrows == 1) {
+      for (size_t i = 1; i < new_nrows; ++i) {
+        std::memcpy(data + i * width, data, width);
+      }
+    } else {
+      std::memset(data + nrows * width, NA_BYTE, (new_nrows - nrows) * width);
+    }
+  }
+  nrows = new_nrows;
+
+  // TODO(#301): Temporary fix.
+  if (stats != nullptr) stats->reset();
+}
+
+
+void FixedStringColumn::apply_na_mask(const BoolColumn* mask) {
+  materialize();
+  const int8_t* maskdata = mask->elements_r();
+  char* data = static_cast<char*>(mbuf.wptr());
+  size_t w = width;
+  dt::parallel_for_static(nrows,
+    [=](size_t i) {
+      if (maskdata[i] == 1) std::memset(data + i * w, NA_BYTE, w);
+    });
+  if (stats != nullptr) stats->reset();
+}
+
+
+void FixedStringColumn::fill_na() {
+  xassert(!ri);
+  std::memset(mbuf.wptr(), NA_BYTE, mbuf.size());
+}
+
+
+Column* FixedStringColumn::shallowcopy(const RowIndex& new_rowindex) const {
+  Column* col = Column::shallowcopy(new_rowindex);
+  static_cast<FixedStringColumn*>(col)->width = width;
+  return col;
+}
+
+
+/**
+ * The replacement values are converted into FSTR. If they are wider than
+ * this column, then the column is re-laid out with the larger width first.
+ */
+void FixedStringColumn::replace_values(
+    RowIndex replace_at, const Column* replace_with)
+{
+  materialize();
+  std::unique_ptr<Column> tmp;
+  if (replace_with && replace_with->stype() != SType::VOID) {
+    tmp.reset(fixed_width_strings(replace_with));
+    size_t rwidth = fstr_width(tmp.get());
+    if (rwidth > width) {
+      MemoryRange newmr = MemoryRange::mem(nrows * rwidth);
+      copy_padded(this, static_cast<char*>(newmr.xptr()), rwidth);
+      mbuf = std::move(newmr);
+      width = rwidth;
+    } else if (rwidth < width) {
+      tmp.reset(fixed_width_strings(tmp.get(), width));
+    }
+  }
+
+  char* dest = static_cast<char*>(mbuf.wptr());
+  const size_t w = width;
+  if (!tmp || tmp->nrows == 1) {
+    std::string value(w, static_cast<char>(NA_BYTE));
+    if (tmp) {
+      tmp->materialize();
+      std::memcpy(&value[0], tmp->data(), w);
+    }
+    replace_at.iterate(0, replace_at.size(), 1,
+      [&](size_t, size_t j) {
+        if (j == RowIndex::NA) return;
+        std::memcpy(dest + j * w, value.data(), w);
+      });
+  } else {
+    xassert(tmp->nrows == replace_at.size());
+    tmp->materialize();
+    const char* src = static_cast<const char*>(tmp->data());
+    replace_at.iterate(0, replace_at.size(), 1,
+      [&](size_t i, size_t j) {
+        if (j == RowIndex::NA) return;
+        std::memcpy(dest + j * w, src + i * w, w);
+      });
+  }
+  if (stats) stats->reset();
+}
+
+
+RowIndex FixedStringColumn::join(const Column* keycol) const {
+  std::unique_ptr<Column> lhs(this->cast(SType::STR64));
+  std::unique_ptr<Column> rhs(keycol->cast(SType::STR64));
+  return lhs->join(rhs.get());
+}
@@ -5,10 +5,18 @@
 //
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
+#include <algorithm>       // std::min, std::upper_bound
+#include <cstring>         // std::memcpy, std::memset
+#include <limits>          // std::numeric_limits
+#include <memory>          // std::shared_ptr, std::make_shared
+#include <mutex>           // std::mutex, std::lock_guard
 #include <type_traits>
+#include <unordered_map>   // std::unordered_map
+#include <vector>          // std::vector
 #include "utils/assert.h"
 #include "utils/misc.h"
 #include "parallel/api.h"  // dt::parallel_for_static
+#include "codec.h"
 #include "column.h"
 
 
@@ -332,6 +340,836 @@ void FwColumn<T>::fill_na_mask(int8_t* outmask, size_t row0, size_t row1) {
 }
 
 
+//==============================================================================
+// Compression
+//==============================================================================
+namespace dt {
+
+constexpr size_t Codec::BLOCK_SIZE;
+static constexpr size_t BLOCK_SIZE = Codec::BLOCK_SIZE;
+
+// Maximum size of the dictionary that the "auto" method would consider
+static constexpr size_t AUTO_DICT_MAXSIZE = 65536;
+
+Codec::~Codec() {}
+
+
+const char* encoding_name(Encoding enc) {
+  switch (enc) {
+    case Encoding::FOR:  return "for";
+    case Encoding::RLE:  return "rle";
+    case Encoding::DICT: return "dict";
+    default:             return "none";
+  }
+}
+
+Encoding encoding_from_name(const std::string& name) {
+  if (name == "auto") return Encoding::NONE;
+  if (name == "for")  return Encoding::FOR;
+  if (name == "rle")  return Encoding::RLE;
+  if (name == "dict") return Encoding::DICT;
+  throw ValueError() << "Unknown compression method `" << name << "`: "
+      "expected one of \"auto\", \"for\", \"rle\" or \"dict\"";
+}
+
+
+//------------------------------------------------------------------------------
+// Helpers
+//------------------------------------------------------------------------------
+
+// Blocks are processed in parallel, unless the call was made from within
+// a parallel region.
+static void for_each_block(size_t n, function<void(size_t)> fn) {
+  if (n > 1 && num_threads_in_team() == 0) {
+    parallel_for_dynamic(n, fn);
+  } else {
+    for (size_t i = 0; i < n; ++i) fn(i);
+  }
+}
+
+static size_t nblocks_of(size_t n) {
+  return (n + BLOCK_SIZE - 1) / BLOCK_SIZE;
+}
+
+
+
+//------------------------------------------------------------------------------
+// ColumnEncoding
+//------------------------------------------------------------------------------
+
+ColumnEncoding::ColumnEncoding(std::shared_ptr<const Codec> c)
+  : codec(std::move(c)) {}
+
+std::shared_ptr<ColumnEncoding>
+ColumnEncoding::make(std::shared_ptr<const Codec> codec, size_t elemsize) {
+  std::shared_ptr<ColumnEncoding> enc(new ColumnEncoding(codec));
+  // The loader refers to the encoding weakly, since the encoding owns the
+  // buffer (and hence the loader). The Codec captured by the loader is
+  // released once the data is loaded.
+  std::weak_ptr<ColumnEncoding> wenc = enc;
+  enc->databuf = MemoryRange::lazy(codec->size() * elemsize,
+    [codec, elemsize, wenc](void* out) {
+      size_t n = codec->size();
+      for_each_block(nblocks_of(n),
+        [&](size_t b) {
+          size_t row0 = b * BLOCK_SIZE;
+          codec->decode(row0, std::min(BLOCK_SIZE, n - row0),
+                        static_cast<char*>(out) + row0 * elemsize);
+        });
+      auto e = wenc.lock();
+      if (e) e->release();
+    });
+  return enc;
+}
+
+std::shared_ptr<const Codec> ColumnEncoding::get() const {
+  return std::atomic_load(&codec);
+}
+
+void ColumnEncoding::release() {
+  std::atomic_store(&codec, std::shared_ptr<const Codec>());
+}
+
+bool ColumnEncoding::describes(const Column* col) const {
+  return !col->rowindex() &&
+         col->data_buf() == databuf &&
+         col->nrows * col->elemsize() == databuf.size();
+}
+
+// Number of bits needed to represent all integers in the range `[0, x]`
+static int bit_width(uint64_t x) {
+  int w = 0;
+  for (; x; x >>= 1) w++;
+  return w;
+}
+
+static size_t packed_words(size_t n, int width) {
+  return (n * static_cast<size_t>(width) + 63) / 64;
+}
+
+// Store `width`-bit value `x` at bit position `pos` in the (zero-filled)
+// array `words`. The values may span the boundary between two words.
+static inline void put_bits(uint64_t* words, size_t pos, int width,
+                            uint64_t x)
+{
+  if (width == 0) return;
+  size_t k = pos >> 6;
+  int shift = static_cast<int>(pos & 63);
+  words[k] |= x << shift;
+  if (shift + width > 64) words[k + 1] |= x >> (64 - shift);
+}
+
+// Call `fn(i, code)` for each of the `n` consecutive `width`-bit codes
+// starting at bit position `pos` within `words`. The array must be padded
+// with one extra word at the end, since the word following the last code
+// may be read.
+template <typename F>
+static inline void unpack_bits(const uint64_t* words, size_t pos, int width,
+                               size_t n, F fn)
+{
+  if (width == 0) {
+    for (size_t i = 0; i < n; ++i) fn(i, uint64_t(0));
+    return;
+  }
+  uint64_t mask = (width == 64)? ~uint64_t(0) : (uint64_t(1) << width) - 1;
+  const uint64_t* p = words + (pos >> 6);
+  int shift = static_cast<int>(pos & 63);
+  uint64_t cur = *p;
+  for (size_t i = 0; i < n; ++i) {
+    uint64_t x = cur >> shift;
+    shift += width;
+    if (shift >= 64) {
+      shift -= 64;
+      cur = *++p;
+      if (shift) x |= cur << (width - shift);
+    }
+    fn(i, x & mask);
+  }
+}
+
+
+// Values are compared by their bit patterns, so that the encodings of
+// floating-point columns are lossless (including -0.0 and NaN payloads).
+template <typename T>
+using bits_t = typename std::conditional<sizeof(T) == 1, uint8_t,
+               typename std::conditional<sizeof(T) == 2, uint16_t,
+               typename std::conditional<sizeof(T) == 4, uint32_t,
+                                         uint64_t>::type>::type>::type;
+
+template <typename T>
+static inline bits_t<T> bits_of(T x) {
+  bits_t<T> res;
+  std::memcpy(&res, &x, sizeof(T));
+  return res;
+}
+
+
+
+//------------------------------------------------------------------------------
+// Summaries and comparisons
+//------------------------------------------------------------------------------
+
+static void summary_init(Codec::Summary* s) {
+  s->count = 0;
+  s->isum = 0;
+  s->imin = std::numeric_limits<int64_t>::max();
+  s->imax = std::numeric_limits<int64_t>::min();
+  s->fsum = 0;
+  s->fmin = std::numeric_limits<double>::infinity();
+  s->fmax = -std::numeric_limits<double>::infinity();
+  s->mean = 0;
+  s->m2 = 0;
+}
+
+// Merge summary `o` into `s`, using the formula of Chan et al. for the
+// sum of squared deviations.
+static void summary_merge(Codec::Summary* s, const Codec::Summary& o) {
+  if (o.count == 0) return;
+  size_t count = s->count + o.count;
+  double delta = o.mean - s->mean;
+  double ratio = static_cast<double>(o.count) / static_cast<double>(count);
+  s->mean += delta * ratio;
+  s->m2 += o.m2 + delta * delta * ratio * static_cast<double>(s->count);
+  s->count = count;
+  s->isum = static_cast<int64_t>(static_cast<uint64_t>(s->isum) +
+                                 static_cast<uint64_t>(o.isum));
+  s->fsum += o.fsum;
+  s->imin = std::min(s->imin, o.imin);
+  s->imax = std::max(s->imax, o.imax);
+  s->fmin = std::min(s->fmin, o.fmin);
+  s->fmax = std::max(s->fmax, o.fmax);
+}
+
+// Summary of the values `value(j)` taken with multiplicities `count(j)`,
+// for `j` in `[0, k)`. The sum of squared deviations is computed in the
+// second pass, once the mean is known.
+template <typename T, typename V, typename C>
+static Codec::Summary summarize_values(size_t k, V value, C count) {
+  Codec::Summary s;
+  summary_init(&s);
+  for (size_t j = 0; j < k; ++j) {
+    T x = value(j);
+    size_t c = count(j);
+    if (c == 0 || ISNA<T>(x)) continue;
+    double f = static_cast<double>(x);
+    int64_t i = std::is_integral<T>::value? static_cast<int64_t>(x) : 0;
+    s.count += c;
+    s.isum = static_cast<int64_t>(static_cast<uint64_t>(s.isum) +
+                                  static_cast<uint64_t>(i) * c);
+    s.fsum += f * static_cast<double>(c);
+    if (i < s.imin) s.imin = i;
+    if (i > s.imax) s.imax = i;
+    if (f < s.fmin) s.fmin = f;
+    if (f > s.fmax) s.fmax = f;
+  }
+  if (s.count == 0) return s;
+  s.mean = s.fsum / static_cast<double>(s.count);
+  for (size_t j = 0; j < k; ++j) {
+    T x = value(j);
+    size_t c = count(j);
+    if (c == 0 || ISNA<T>(x)) continue;
+    double d = static_cast<double>(x) - s.mean;
+    s.m2 += d * d * static_cast<double>(c);
+  }
+  return s;
+}
+
+
+template <typename V>
+static inline int8_t compare_values(Codec::CmpOp op, V x, V v) {
+  switch (op) {
+    case Codec::CmpOp::EQ: return x == v;
+    case Codec::CmpOp::NE: return x != v;
+    case Codec::CmpOp::GT: return x > v;
+    case Codec::CmpOp::LT: return x < v;
+    case Codec::CmpOp::GE: return x >= v;
+    case Codec::CmpOp::LE: return x <= v;
+  }
+  return 0;
+}
+
+// Function object evaluating the comparison for a single value `x`
+template <typename T>
+struct comparator {
+  Codec::Comparison cmp;
+
+  explicit comparator(const Codec::Comparison& c) : cmp(c) {}
+
+  comparator with_op(Codec::CmpOp op) const {
+    comparator res(cmp);
+    res.cmp.op = op;
+    return res;
+  }
+
+  int8_t operator()(T x) const {
+    if (ISNA<T>(x)) return cmp.op == Codec::CmpOp::NE;
+    switch (cmp.domain) {
+      case Codec::CmpDomain::INT64:
+        return compare_values<int64_t>(cmp.op, static_cast<int64_t>(x),
+                                       cmp.ivalue);
+      case Codec::CmpDomain::FLOAT32:
+        return compare_values<float>(cmp.op, static_cast<float>(x),
+                                     static_cast<float>(cmp.ivalue));
+      case Codec::CmpDomain::FLOAT64:
+        return compare_values<double>(cmp.op, static_cast<double>(x),
+                                      cmp.fvalue);
+    }
+    return 0;
+  }
+};
+
+// If the comparison gives the same result for all (non-NA) values within
+// the range `[lo, hi]`, store that result in `*res` and return true.
+template <typename T>
+static bool range_result(const comparator<T>& pred, T lo, T hi, int8_t* res)
+{
+  using Op = Codec::CmpOp;
+  Op op = pred.cmp.op;
+  if (op == Op::EQ || op == Op::NE) {
+    if (pred.with_op(Op::LT)(hi) || pred.with_op(Op::GT)(lo)) {
+      *res = (op == Op::NE);
+      return true;
+    }
+    if (lo == hi) {
+      *res = pred(lo);
+      return true;
+    }
+    return false;
+  }
+  int8_t rlo = pred(lo);
+  int8_t rhi = pred(hi);
+  if (rlo != rhi) return false;
+  *res = rlo;
+  return true;
+}
+
+
+// Evaluate the comparison for each of the values `data[0], ..., data[n-1]`.
+// The operator and the domain are resolved once for the whole array.
+template <typename T, typename V, typename F>
+static void compare_array(const T* data, size_t n, V v, int8_t na_res,
+                          int8_t* out, F op)
+{
+  for (size_t i = 0; i < n; ++i) {
+    T x = data[i];
+    out[i] = ISNA<T>(x)? na_res : op(static_cast<V>(x), v);
+  }
+}
+
+template <typename T, typename V>
+static void compare_array(const T* data, size_t n, Codec::CmpOp op, V v,
+                          int8_t* out)
+{
+  int8_t na = (op == Codec::CmpOp::NE);
+  switch (op) {
+    case Codec::CmpOp::EQ:
+      return compare_array(data, n, v, na, out, [](V x, V y){ return x == y; });
+    case Codec::CmpOp::NE:
+      return compare_array(data, n, v, na, out, [](V x, V y){ return x != y; });
+    case Codec::CmpOp::GT:
+      return compare_array(data, n, v, na, out, [](V x, V y){ return x > y; });
+    case Codec::CmpOp::LT:
+      return compare_array(data, n, v, na, out, [](V x, V y){ return x < y; });
+    case Codec::CmpOp::GE:
+      return compare_array(data, n, v, na, out, [](V x, V y){ return x >= y; });
+    case Codec::CmpOp::LE:
+      return compare_array(data, n, v, na, out, [](V x, V y){ return x <= y; });
+  }
+}
+
+template <typename T>
+static void compare_array(const T* data, size_t n,
+                          const Codec::Comparison& cmp, int8_t* out)
+{
+  switch (cmp.domain) {
+    case Codec::CmpDomain::INT64:
+      return compare_array<T, int64_t>(data, n, cmp.op, cmp.ivalue, out);
+    case Codec::CmpDomain::FLOAT32:
+      return compare_array<T, float>(data, n, cmp.op,
+                                     static_cast<float>(cmp.ivalue), out);
+    case Codec::CmpDomain::FLOAT64:
+      return compare_array<T, double>(data, n, cmp.op, cmp.fvalue, out);
+  }
+}
+
+
+//------------------------------------------------------------------------------
+// Run-length encoding
+//------------------------------------------------------------------------------
+
+template <typename T>
+class RleCodec : public Codec {
+  private:
+    std::vector<T> values;
+    std::vector<size_t> ends;  // index of the row after the end of each run
+
+  public:
+    RleCodec(const T* data, size_t n) : Codec(n) {
+      for (size_t i = 0; i < n; ) {
+        size_t j = i + 1;
+        while (j < n && bits_of(data[j]) == bits_of(data[i])) j++;
+        values.push_back(data[i]);
+        ends.push_back(j);
+        i = j;
+      }
+      values.shrink_to_fit();
+      ends.shrink_to_fit();
+    }
+
+    // Estimated size of the encoding, or SIZE_MAX if it exceeds `limit`
+    static size_t estimate(const T* data, size_t n, size_t limit) {
+      size_t maxruns = limit / (sizeof(T) + sizeof(size_t));
+      size_t nruns = (n > 0);
+      for (size_t i = 1; i < n && nruns <= maxruns; ++i) {
+        nruns += (bits_of(data[i]) != bits_of(data[i - 1]));
+      }
+      if (nruns > maxruns) return size_t(-1);
+      return sizeof(RleCodec<T>) + nruns * (sizeof(T) + sizeof(size_t));
+    }
+
+    Encoding kind() const noexcept override { return Encoding::RLE; }
+
+    size_t nbytes() const noexcept override {
+      return sizeof(*this) + values.capacity() * sizeof(T) +
+             ends.capacity() * sizeof(size_t);
+    }
+
+    void decode(size_t row0, size_t n, void* out) const override {
+      T* dest = static_cast<T*>(out) - row0;
+      size_t k = static_cast<size_t>(
+          std::upper_bound(ends.begin(), ends.end(), row0) - ends.begin());
+      size_t row1 = row0 + n;
+      for (size_t i = row0; i < row1; ++k) {
+        size_t j = std::min(ends[k], row1);
+        std::fill(dest + i, dest + j, values[k]);
+        i = j;
+      }
+    }
+
+    void summarize(Summary* out) const override {
+      *out = summarize_values<T>(values.size(),
+          [&](size_t k) { return values[k]; },
+          [&](size_t k) { return ends[k] - (k? ends[k - 1] : 0); });
+    }
+
+    // The comparison is evaluated once per run
+    void compare(const Comparison& cmp, int8_t* out) const override {
+      comparator<T> pred(cmp);
+      size_t nruns = values.size();
+      size_t nchunks = (nruns + BLOCK_SIZE - 1) / BLOCK_SIZE;
+      for_each_block(nchunks,
+        [&](size_t c) {
+          size_t k1 = std::min(nruns, (c + 1) * BLOCK_SIZE);
+          for (size_t k = c * BLOCK_SIZE; k < k1; ++k) {
+            size_t start = k? ends[k - 1] : 0;
+            if (ends[k] - start == 1) out[start] = pred(values[k]);
+            else std::memset(out + start, pred(values[k]), ends[k] - start);
+          }
+        });
+    }
+};
+
+
+
+//------------------------------------------------------------------------------
+// Dictionary encoding
+//------------------------------------------------------------------------------
+
+template <typename T>
+class DictCodec : public Codec {
+  public:
+    using index_t = std::unordered_map<bits_t<T>, uint32_t>;
+
+  private:
+    std::vector<T> dict;
+    std::vector<uint64_t> codes;
+    int width;
+    int : 32;
+
+  public:
+    DictCodec(const T* data, size_t n, std::vector<T>&& dict_,
+              const index_t& index)
+      : Codec(n), dict(std::move(dict_))
+    {
+      width = bit_width(dict.size() - 1);
+      // The codes of each block occupy exactly `64 * width` words, so the
+      // blocks can be packed in parallel.
+      codes.resize(packed_words(nblocks_of(n) * BLOCK_SIZE, width) + 1);
+      for_each_block(nblocks_of(n),
+        [&](size_t b) {
+          size_t i1 = std::min(n, (b + 1) * BLOCK_SIZE);
+          for (size_t i = b * BLOCK_SIZE; i < i1; ++i) {
+            uint64_t code = index.at(bits_of(data[i]));
+            put_bits(codes.data(), i * static_cast<size_t>(width), width,
+                     code);
+          }
+        });
+    }
+
+    // Collect the distinct values of `data` in the order of their first
+    // appearance. Returns false if there are more than `maxsize` of them.
+    static bool collect(const T* data, size_t n, size_t maxsize,
+                        std::vector<T>& dict, index_t& index)
+    {
+      for (size_t i = 0; i < n; ++i) {
+        auto r = index.emplace(bits_of(data[i]),
+                               static_cast<uint32_t>(dict.size()));
+        if (r.second) {
+          if (dict.size() == maxsize) return false;
+          dict.push_back(data[i]);
+        }
+      }
+      return true;
+    }
+
+    static size_t estimate(size_t n, size_t ndict) {
+      int w = bit_width(ndict - 1);
+      return sizeof(DictCodec<T>) + ndict * sizeof(T) +
+             (packed_words(nblocks_of(n) * BLOCK_SIZE, w) + 1) *
+             sizeof(uint64_t);
+    }
+
+    Encoding kind() const noexcept override { return Encoding::DICT; }
+
+    size_t nbytes() const noexcept override {
+      return sizeof(*this) + dict.capacity() * sizeof(T) +
+             codes.capacity() * sizeof(uint64_t);
+    }
+
+    void decode(size_t row0, size_t n, void* out) const override {
+      T* dest = static_cast<T*>(out);
+      const T* values = dict.data();
+      unpack_bits(codes.data(), row0 * static_cast<size_t>(width), width, n,
+                  [&](size_t i, uint64_t code) { dest[i] = values[code]; });
+    }
+
+    // Each dictionary entry is added to the summary once, with the count of
+    // its occurrences
+    void summarize(Summary* out) const override {
+      std::vector<size_t> counts(dict.size(), 0);
+      std::mutex m;
+      size_t w = static_cast<size_t>(width);
+      parallel_region(
+        [&] {
+          std::vector<size_t> tcounts(dict.size(), 0);
+          size_t* tc = tcounts.data();
+          parallel_for_static(nblocks_of(nrows),
+            [&](size_t b) {
+              size_t i0 = b * BLOCK_SIZE;
+              unpack_bits(codes.data(), i0 * w, width,
+                          std::min(BLOCK_SIZE, nrows - i0),
+                          [&](size_t, uint64_t code) { tc[code]++; });
+            });
+          std::lock_guard<std::mutex> lock(m);
+          for (size_t k = 0; k < counts.size(); ++k) counts[k] += tcounts[k];
+        });
+      *out = summarize_values<T>(dict.size(),
+          [&](size_t k) { return dict[k]; },
+          [&](size_t k) { return counts[k]; });
+    }
+
+    // The comparison is evaluated once per dictionary entry
+    void compare(const Comparison& cmp, int8_t* out) const override {
+      comparator<T> pred(cmp);
+      std::vector<int8_t> table(dict.size());
+      for (size_t k = 0; k < dict.size(); ++k) table[k] = pred(dict[k]);
+      const int8_t* tbl = table.data();
+      size_t w = static_cast<size_t>(width);
+      for_each_block(nblocks_of(nrows),
+        [&](size_t b) {
+          size_t i0 = b * BLOCK_SIZE;
+          int8_t* dest = out + i0;
+          unpack_bits(codes.data(), i0 * w, width,
+                      std::min(BLOCK_SIZE, nrows - i0),
+                      [&](size_t i, uint64_t code) { dest[i] = tbl[code]; });
+        });
+    }
+};
+
+
+
+//------------------------------------------------------------------------------
+// Frame-of-reference encoding
+//------------------------------------------------------------------------------
+
+template <typename T>
+class ForCodec : public Codec {
+  private:
+    struct Block {
+      int64_t ref;      // min of the non-NA values; codes are `x - ref`
+      int64_t max;
+      uint64_t nacode;  // code of the NA values
+      size_t offset;    // position of the block's codes within `words`
+      size_t nacount;
+      int width;
+      int : 32;
+    };
+    std::vector<Block> blocks;
+    std::vector<uint64_t> words;
+
+  public:
+    ForCodec(const T* data, size_t n) : Codec(n) {
+      size_t nblocks = nblocks_of(n);
+      blocks.resize(nblocks);
+      for_each_block(nblocks,
+        [&](size_t b) {
+          size_t i0 = b * BLOCK_SIZE;
+          blocks[b] = scan_block(data + i0, std::min(BLOCK_SIZE, n - i0));
+        });
+      size_t total = 0;
+      for (size_t b = 0; b < nblocks; ++b) {
+        blocks[b].offset = total;
+        total += packed_words(std::min(BLOCK_SIZE, n - b * BLOCK_SIZE),
+                              blocks[b].width);
+      }
+      words.resize(total + 1, 0);
+      for_each_block(nblocks,
+        [&](size_t b) {
+          const Block& blk = blocks[b];
+          if (blk.width == 0) return;
+          uint64_t* dest = words.data() + blk.offset;
+          size_t w = static_cast<size_t>(blk.width);
+          size_t i0 = b * BLOCK_SIZE;
+          size_t m = std::min(BLOCK_SIZE, n - i0);
+          for (size_t i = 0; i < m; ++i) {
+            T x = data[i0 + i];
+            uint64_t code = ISNA<T>(x)? blk.nacode
+                : static_cast<uint64_t>(static_cast<int64_t>(x)) -
+                  static_cast<uint64_t>(blk.ref);
+            put_bits(dest, i * w, blk.width, code);
+          }
+        });
+    }
+
+    static size_t estimate(const T* data, size_t n) {
+      size_t nblocks = nblocks_of(n);
+      std::vector<size_t> sizes(nblocks);
+      for_each_block(nblocks,
+        [&](size_t b) {
+          size_t i0 = b * BLOCK_SIZE;
+          size_t m = std::min(BLOCK_SIZE, n - i0);
+          sizes[b] = packed_words(m, scan_block(data + i0, m).width);
+        });
+      size_t total = sizeof(ForCodec<T>) + nblocks * sizeof(Block) +
+                     sizeof(uint64_t);
+      for (size_t s : sizes) total += s * sizeof(uint64_t);
+      return total;
+    }
+
+    Encoding kind() const noexcept override { return Encoding::FOR; }
+
+    size_t nbytes() const noexcept override {
+      return sizeof(*this) + blocks.capacity() * sizeof(Block) +
+             words.capacity() * sizeof(uint64_t);
+    }
+
+    void decode(size_t row0, size_t n, void* out) const override {
+      T* dest = static_cast<T*>(out);
+      size_t row1 = row0 + n;
+      for (size_t i = row0; i < row1; ) {
+        size_t b = i / BLOCK_SIZE;
+        size_t start = b * BLOCK_SIZE;
+        size_t end = std::min(start + BLOCK_SIZE, row1);
+        const Block& blk = blocks[b];
+        uint64_t ref = static_cast<uint64_t>(blk.ref);
+        uint64_t nacode = blk.nacode;
+        unpack_bits(words.data() + blk.offset,
+                    (i - start) * static_cast<size_t>(blk.width), blk.width,
+                    end - i,
+                    [&](size_t j, uint64_t code) {
+                      dest[j] = (code == nacode)
+                          ? GETNA<T>()
+                          : static_cast<T>(static_cast<int64_t>(ref + code));
+                    });
+        dest += end - i;
+        i = end;
+      }
+    }
+
+    void summarize(Summary* out) const override {
+      size_t nblocks = blocks.size();
+      std::vector<Summary> parts(nblocks);
+      for_each_block(nblocks,
+        [&](size_t b) {
+          T buf[BLOCK_SIZE];
+          size_t i0 = b * BLOCK_SIZE;
+          size_t m = std::min(BLOCK_SIZE, nrows - i0);
+          decode(i0, m, buf);
+          parts[b] = summarize_values<T>(m,
+              [&](size_t j) { return buf[j]; },
+              [](size_t) { return size_t(1); });
+        });
+      summary_init(out);
+      for (const Summary& part : parts) summary_merge(out, part);
+    }
+
+    // Blocks whose range of values determines the result of the comparison
+    // are filled without decoding
+    void compare(const Comparison& cmp, int8_t* out) const override {
+      comparator<T> pred(cmp);
+      int8_t na_res = (cmp.op == CmpOp::NE);
+      for_each_block(blocks.size(),
+        [&](size_t b) {
+          const Block& blk = blocks[b];
+          size_t i0 = b * BLOCK_SIZE;
+          size_t m = std::min(BLOCK_SIZE, nrows - i0);
+          int8_t res = na_res;
+          bool constant = (blk.nacount == m) ||
+              (range_result<T>(pred, static_cast<T>(blk.ref),
+                               static_cast<T>(blk.max), &res) &&
+               (blk.nacount == 0 || res == na_res));
+          if (constant) {
+            std::memset(out + i0, res, m);
+            return;
+          }
+          T buf[BLOCK_SIZE];
+          decode(i0, m, buf);
+          compare_array<T>(buf, m, cmp, out + i0);
+        });
+    }
+
+  private:
+    static Block scan_block(const T* data, size_t n) {
+      Block blk;
+      blk.ref = std::numeric_limits<int64_t>::max();
+      blk.max = std::numeric_limits<int64_t>::min();
+      blk.nacount = 0;
+      blk.offset = 0;
+      for (size_t i = 0; i < n; ++i) {
+        T x = data[i];
+        if (ISNA<T>(x)) { blk.nacount++; continue; }
+        int64_t v = static_cast<int64_t>(x);
+        if (v < blk.ref) blk.ref = v;
+        if (v > blk.max) blk.max = v;
+      }
+      if (blk.nacount == n) {
+        blk.ref = blk.max = 0;
+        blk.nacode = 0;
+        blk.width = 0;
+        return blk;
+      }
+      uint64_t range = static_cast<uint64_t>(blk.max) -
+                       static_cast<uint64_t>(blk.ref);
+      if (blk.nacount) {
+        blk.nacode = range + 1;
+        blk.width = bit_width(range + 1);
+      } else {
+        blk.nacode = std::numeric_limits<uint64_t>::max();
+        blk.width = bit_width(range);
+      }
+      return blk;
+    }
+};
+
+
+
+//------------------------------------------------------------------------------
+// Choosing the encoding
+//------------------------------------------------------------------------------
+
+// FOR encoding is available for integer columns only
+template <typename T>
+static std::shared_ptr<Codec> make_for_codec(const T* data, size_t n,
+                                             std::true_type) {
+  return std::make_shared<ForCodec<T>>(data, n);
+}
+
+template <typename T>
+static std::shared_ptr<Codec> make_for_codec(const T*, size_t,
+                                             std::false_type) {
+  return nullptr;
+}
+
+template <typename T>
+static size_t estimate_for(const T* data, size_t n, std::true_type) {
+  return ForCodec<T>::estimate(data, n);
+}
+
+template <typename T>
+static size_t estimate_for(const T*, size_t, std::false_type) {
+  return size_t(-1);
+}
+
+
+template <typename T>
+static std::shared_ptr<Codec> make_dict_codec(const T* data, size_t n,
+                                              size_t maxsize)
+{
+  std::vector<T> dict;
+  typename DictCodec<T>::index_t index;
+  if (!DictCodec<T>::collect(data, n, maxsize, dict, index)) return nullptr;
+  return std::make_shared<DictCodec<T>>(data, n, std::move(dict), index);
+}
+
+
+/**
+ * Encode the array `data` of `n` values with the given `method`. Returns
+ * nullptr if the method is not applicable to this data, or, when the method
+ * is "auto", if none of the encodings is smaller than the raw data.
+ */
+template <typename T>
+static std::shared_ptr<Codec> encode(const T* data, size_t n,
+                                     Encoding method)
+{
+  using is_int = std::is_integral<T>;
+  switch (method) {
+    case Encoding::FOR:  return make_for_codec<T>(data, n, is_int());
+    case Encoding::RLE:  return std::make_shared<RleCodec<T>>(data, n);
+    case Encoding::DICT: return make_dict_codec<T>(data, n, 0xFFFFFFFFu);
+    case Encoding::NONE: break;
+  }
+  size_t best = n * sizeof(T);
+  Encoding choice = Encoding::NONE;
+  size_t sz = RleCodec<T>::estimate(data, n, best);
+  if (sz < best) { best = sz; choice = Encoding::RLE; }
+  sz = estimate_for<T>(data, n, is_int());
+  if (sz < best) { best = sz; choice = Encoding::FOR; }
+  std::vector<T> dict;
+  typename DictCodec<T>::index_t index;
+  if (DictCodec<T>::collect(data, n, AUTO_DICT_MAXSIZE, dict, index)) {
+    sz = DictCodec<T>::estimate(n, dict.size());
+    if (sz < best) {
+      return std::make_shared<DictCodec<T>>(data, n, std::move(dict), index);
+    }
+  }
+  if (choice == Encoding::NONE) return nullptr;
+  return encode<T>(data, n, choice);
+}
+
+
+}  // namespace dt
+
+
+
+/**
+ * The compressed column's data buffer is decoded lazily from the codec,
+ * so that only the encoded data stays in memory until some operation
+ * requires the raw values. After that the column is no longer compressed
+ * (see `dt::ColumnEncoding`).
+ */
+template <typename T>
+bool FwColumn<T>::compress(dt::Encoding method) {
+  auto current = get_codec();
+  if (current && (method == dt::Encoding::NONE || method == current->kind())) {
+    return true;
+  }
+  if (nrows == 0) return false;
+  materialize();
+  std::shared_ptr<const dt::Codec> codec =
+      dt::encode<T>(elements_r(), nrows, method);
+  if (!codec) return false;
+
+  encoding = dt::ColumnEncoding::make(std::move(codec), sizeof(T));
+  mbuf = encoding->buffer();
+  return true;
+}
+
+template <>
+bool FwColumn<PyObject*>::compress(dt::Encoding) {
+  return false;
+}
+
+
 // Explicit instantiations
 template class FwColumn<int8_t>;
 template class FwColumn<int16_t>;
@@ -339,4 +1177,7 @@ template class FwColumn<int32_t>;
 template class FwColumn<int64_t>;
 template class FwColumn<float>;
 template class FwColumn<double>;
+template class FwColumn<uint8_t>;
+template class FwColumn<uint16_t>;
+template class FwColumn<uint32_t>;
 template class FwColumn<PyObject*>;
@@ -2,9 +2,11 @@
 // Original version of this file was contributed by Matt Dowle from R data.table
 // project (https://github.com/Rdatatable/data.table)
 //------------------------------------------------------------------------------
+#include <algorithm>                           // std::min, std::max
 #include "csv/reader_fread.h"                  // FreadReader
 #include "read/fread/fread_parallel_reader.h"  // FreadParallelReader
 #include "read/fread/fread_tokenizer.h"        // FreadTokenizer
+#include "utils/assert.h"                      // xassert
 #include "utils/misc.h"                        // wallclock
 #include "datatable.h"                         // DataTable
 
@@ -18,6 +20,82 @@
 //
 //==============================================================================
 std::unique_ptr<DataTable> FreadReader::read_all()
+{
+  prepare();
+
+  if (verbose) {
+    size_t ncols = columns.size();
+    size_t ndropped = ncols - columns.nColumnsInOutput();
+    trace("Allocating %zu column slots with %zu rows",
+          ncols - ndropped, allocnrow);
+  }
+  allocate_columns(allocnrow);
+
+  read_data();
+
+  trace("[7] Finalize the datatable");
+  std::unique_ptr<DataTable> res = makeDatatable();
+  if (verbose) fo.report();
+  return res;
+}
+
+
+
+/**
+ * Read the next `chunk_nrows` rows from the input, and return them as a new
+ * DataTable. The first call to this method detects the parse parameters and
+ * column types, exactly as `read_all()` does; the subsequent calls continue
+ * reading from the place where the previous chunk ended, using the same
+ * parameters and column types. A column's type is bumped only by the rows
+ * within the current chunk (see `ParallelReader::read_all()`), and the
+ * bumped type is then carried forward into the subsequent chunks. Thus the
+ * chunks already returned keep their types, and the stypes of the chunks
+ * may differ.
+ *
+ * At least one DataTable (possibly with 0 rows) is always returned; after
+ * that the method returns nullptr once the input has been exhausted, or
+ * once `max_nrows` rows were read.
+ */
+std::unique_ptr<DataTable> FreadReader::read_next_chunk(size_t chunk_nrows)
+{
+  xassert(chunk_nrows > 0);
+  if (nchunks_read == 0) {
+    prepare();
+  } else if (sof >= eof || max_nrows == 0) {
+    return nullptr;
+  }
+
+  // The output is allocated for no more than `chunk_nrows` rows, and the
+  // parallel reader is limited to the same number of rows, so that the
+  // memory footprint of the chunk does not depend on the size of the input.
+  size_t nrows_remaining = max_nrows;
+  size_t nrows_requested = std::min(chunk_nrows, nrows_remaining);
+  size_t nrows_estimated = (nchunks_read == 0)? allocnrow :
+      static_cast<size_t>(1.1 * static_cast<double>(eof - sof) /
+                          std::max(meanLineLen, 1.0)) + 1;
+  max_nrows = nrows_requested;
+  allocate_columns(std::min(nrows_requested, nrows_estimated));
+  trace("[6] Read chunk %zu (up to %zu rows)", nchunks_read, nrows_requested);
+  const char* end = read_data();
+
+  size_t nrows = columns.get_nrows();
+  max_nrows = nrows_remaining - nrows;
+  sof = end;
+  line += nrows;
+  nchunks_read++;
+  return makeDatatable();
+}
+
+
+
+//==============================================================================
+//
+// Detect the parse parameters, the column names and types; then apply the
+// user overrides on the column types. This function corresponds to steps
+// [1] - [5] of the reading process.
+//
+//==============================================================================
+void FreadReader::prepare()
 {
   detect_lf();
   skip_preamble();
@@ -46,60 +124,82 @@ std::unique_ptr<DataTable> FreadReader::read_all()
 
 
   //*********************************************************************************************
-  // [5] Allow user to override column types; then allocate the DataTable
+  // [5] Allow user to override column types
   //*********************************************************************************************
-  {
-    if (verbose) trace("[5] Apply user overrides on column types");
-    std::unique_ptr<PT[]> oldtypes = columns.getTypes();
-
-    report_columns_to_python();
-
-    size_t ncols = columns.size();
-    size_t ndropped = 0;
-    int nUserBumped = 0;
-    for (size_t i = 0; i < ncols; i++) {
-      dt::read::Column& col = columns[i];
-      col.reset_type_bumped();
-      if (col.is_dropped()) {
-        ndropped++;
-        continue;
-      } else {
-        if (col.get_ptype() < oldtypes[i]) {
-          // FIXME: if the user wants to override the type, let them
-          throw RuntimeError()
-              << "Attempt to override column " << i + 1 << " \"" << col.repr_name(*this)
-              << "\" with detected type '" << ParserLibrary::info(oldtypes[i]).cname()
-              << "' down to '" << col.typeName() << "' which will lose accuracy. "
-                 "If this was intended, please coerce to the lower type afterwards. Only "
-                 "overrides to a higher type are permitted.";
-        }
-        nUserBumped += (col.get_ptype() != oldtypes[i]);
-      }
-    }
-    if (verbose) {
-      if (nUserBumped || ndropped) {
-        trace("After %d type and %d drop user overrides : %s",
-              nUserBumped, ndropped, columns.printTypes());
+  if (verbose) trace("[5] Apply user overrides on column types");
+  std::unique_ptr<PT[]> oldtypes = columns.getTypes();
+
+  report_columns_to_python();
+
+  size_t ncols = columns.size();
+  size_t ndropped = 0;
+  int nUserBumped = 0;
+  for (size_t i = 0; i < ncols; i++) {
+    dt::read::Column& col = columns[i];
+    col.reset_type_bumped();
+    if (col.is_dropped()) {
+      ndropped++;
+      continue;
+    } else {
+      // Decimals are not auto-detected by default, so a column of floats
+      // may still be requested as dec64.
+      bool dec_override = col.get_ptype() == PT::Dec64 &&
+                          oldtypes[i] <= PT::Float64Hex;
+      if (col.get_ptype() < oldtypes[i] && !dec_override) {
+        // FIXME: if the user wants to override the type, let them
+        throw RuntimeError()
+            << "Attempt to override column " << i + 1 << " \"" << col.repr_name(*this)
+            << "\" with detected type '" << ParserLibrary::info(oldtypes[i]).cname()
+            << "' down to '" << col.typeName() << "' which will lose accuracy. "
+               "If this was intended, please coerce to the lower type afterwards. Only "
+               "overrides to a higher type are permitted.";
       }
-      trace("Allocating %d column slots with %zd rows",
-            ncols - ndropped, allocnrow);
+      nUserBumped += (col.get_ptype() != oldtypes[i]);
     }
+  }
+  if (verbose && (nUserBumped || ndropped)) {
+    trace("After %d type and %d drop user overrides : %s",
+          nUserBumped, ndropped, columns.printTypes());
+  }
+}
 
-    columns.set_nrows(allocnrow);
 
-    if (verbose) {
-      fo.t_frame_allocated = wallclock();
-      fo.n_rows_allocated = allocnrow;
-      fo.n_cols_allocated = ncols - ndropped;
-      fo.allocation_size = columns.totalAllocSize();
-    }
+
+/**
+ * Allocate the output columns for `nrows` rows. All columns that are present
+ * in the output are also marked as being present in the buffer (the reading
+ * of the previous chunk may have left only the type-bumped columns there).
+ */
+void FreadReader::allocate_columns(size_t nrows)
+{
+  size_t ncols = columns.size();
+  for (size_t i = 0; i < ncols; i++) {
+    dt::read::Column& col = columns[i];
+    col.set_in_buffer(col.is_in_output());
   }
+  columns.set_nrows(nrows);
 
+  if (verbose) {
+    fo.t_frame_allocated = wallclock();
+    fo.n_rows_allocated = nrows;
+    fo.n_cols_allocated = columns.nColumnsInOutput();
+    fo.allocation_size = columns.totalAllocSize();
+  }
+}
 
-  //****************************************************************************
-  // [6] Read the data
-  //****************************************************************************
+
+
+//==============================================================================
+//
+// [6] Read the data from `sof` into the allocated columns, re-reading the
+// columns whose types had to be bumped in the process. Returns the pointer
+// to the position in the input right after the last row read.
+//
+//==============================================================================
+const char* FreadReader::read_data()
+{
   bool firstTime = true;
+  const char* end_of_data = nullptr;
 
   std::unique_ptr<PT[]> typesPtr = columns.getTypes();
   PT* types = typesPtr.get();  // This pointer is valid until `typesPtr` goes out of scope
@@ -109,6 +209,7 @@ std::unique_ptr<DataTable> FreadReader::read_all()
   {
     dt::read::FreadParallelReader scr(*this, types);
     scr.read_all();
+    end_of_data = scr.get_end_of_data();
 
     if (firstTime) {
       fo.t_data_read = fo.t_data_reread = wallclock();
@@ -141,10 +242,5 @@ std::unique_ptr<DataTable> FreadReader::read_all()
     fo.n_rows_read = columns.get_nrows();
     fo.n_cols_read = columns.nColumnsInOutput();
   }
-
-
-  trace("[7] Finalize the datatable");
-  std::unique_ptr<DataTable> res = makeDatatable();
-  if (verbose) fo.report();
-  return res;
+  return end_of_data;
 }
@@ -7,6 +7,7 @@
 //------------------------------------------------------------------------------
 #include <vector>
 #include <stdlib.h>
+#include "csv/py_csv.h"
 #include "csv/reader.h"
 #include "frame/py_frame.h"
 #include "python/string.h"
@@ -42,6 +43,66 @@ static oobj read_csv(const PKArgs& args)
 
 
 
+
+
+//------------------------------------------------------------------------------
+// ChunkedReader
+//------------------------------------------------------------------------------
+
+PKArgs ChunkedReader::Type::args___init__(
+  2, 0, 0, false, false, {"reader", "chunk_nrows"}, "__init__", nullptr);
+
+const char* ChunkedReader::Type::classname() {
+  return "datatable.internal.ChunkedReader";
+}
+
+const char* ChunkedReader::Type::classdoc() {
+  return "Reader of a csv input in chunks of limited number of rows.";
+}
+
+
+static PKArgs args_read_next(
+  0, 0, 0, false, false, {}, "read_next",
+
+R"(read_next(self)
+--
+
+Read the next chunk of rows from the input, and return it as a Frame.
+Returns None when there is no more data to read.
+)");
+
+
+void ChunkedReader::Type::init_methods_and_getsets(Methods& mm, GetSetters&) {
+  ADD_METHOD(mm, &ChunkedReader::read_next, args_read_next);
+}
+
+
+void ChunkedReader::m__init__(PKArgs& args) {
+  reader = nullptr;
+  size_t n = args[1].to_size_t();
+  if (n == 0) {
+    throw ValueError() << "Parameter `chunk_nrows` should be positive";
+  }
+  chunk_nrows = n;
+  reader = new GenericReader(args[0].to_pyobj());
+}
+
+
+void ChunkedReader::m__dealloc__() {
+  delete reader;
+  reader = nullptr;
+}
+
+
+oobj ChunkedReader::read_next(const PKArgs&) {
+  std::unique_ptr<DataTable> dtptr = reader->read_next_chunk(chunk_nrows);
+  if (!dtptr) return None();
+  return oobj::from_new_reference(
+          Frame::from_datatable(dtptr.release()));
+}
+
+
+
 void DatatableModule::init_methods_csv() {
   ADD_FN(&read_csv, args_read_csv);
 }
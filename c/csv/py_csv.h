@@ -0,0 +1,49 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#ifndef dt_CSV_PY_CSV_h
+#define dt_CSV_PY_CSV_h
+#include <Python.h>
+#include "python/ext_type.h"
+
+class GenericReader;
+
+namespace py {
+
+
+/**
+ * Python object that reads a csv input in chunks: each call to `read_next()`
+ * returns a Frame with at most `chunk_nrows` rows, continuing from the place
+ * where the previous chunk has ended. The parse parameters and column types
+ * are detected once, when reading the first chunk.
+ *
+ * This object holds the `GenericReader` (and hence the memory-mapped input)
+ * for as long as it is alive. It is used by the python function `iread()`.
+ */
+class ChunkedReader : public PyObject {
+  private:
+    GenericReader* reader;
+    size_t chunk_nrows;
+
+  public:
+    class Type : public ExtType<ChunkedReader> {
+      public:
+        static PKArgs args___init__;
+        static const char* classname();
+        static const char* classdoc();
+        static void init_methods_and_getsets(Methods&, GetSetters&);
+    };
+
+    void m__init__(PKArgs&);
+    void m__dealloc__();
+
+    oobj read_next(const PKArgs&);
+};
+
+
+}  // namespace py
+#endif
@@ -7,14 +7,20 @@
 //------------------------------------------------------------------------------
 #include <stdlib.h>             // strtod
 #include <strings.h>            // strcasecmp
+#include <algorithm>            // std::max
+#include <atomic>               // std::atomic
 #include <cerrno>               // errno
-#include <cstring>              // std::memcmp
+#include <cstring>              // std::memcmp, std::memcpy
+#include <mutex>                // std::mutex, std::lock_guard
 #include "csv/reader.h"
 #include "csv/reader_arff.h"
 #include "csv/reader_fread.h"
+#include "csv/reader_parquet.h"
+#include "csv/reader_parsers.h"
 #include "parallel/api.h"
 #include "python/_all.h"
 #include "python/string.h"
+#include "utils/decimal.h"
 #include "utils/exceptions.h"
 #include "utils/misc.h"         // wallclock
 #include "datatable.h"
@@ -28,6 +34,8 @@
 
 static bool log_anonymize = false;
 static bool log_escape_unicode = false;
+static double categorical_threshold = 0.0;
+static bool read_decimals = false;
 
 void GenericReader::init_options() {
   dt::register_option(
@@ -56,6 +64,34 @@ void GenericReader::init_options() {
     "in hexadecimal notation. Use this option if your terminal cannot\n"
     "print unicode, or if the output gets somehow corrupted because of\n"
     "the unicode characters.");
+
+  dt::register_option(
+    "fread.categorical_threshold",
+    []{ return py::ofloat(categorical_threshold); },
+    [](py::oobj value) {
+      double x = value.to_double();
+      if (!(x >= 0.0 && x <= 1.0)) {
+        throw ValueError() << "Invalid fread.categorical_threshold parameter: "
+            << x << "; it should be a number between 0 and 1";
+      }
+      categorical_threshold = x;
+    },
+    "String columns where the number of distinct values does not exceed\n"
+    "this fraction of the number of rows will be read as categorical\n"
+    "(cat8/cat16/cat32) columns. The value of 0 (default) disables this\n"
+    "conversion.");
+
+  dt::register_option(
+    "fread.decimals",
+    []{ return py::obool(read_decimals); },
+    [](py::oobj value){ read_decimals = value.to_bool_strict(); },
+    "If True, columns of fixed-point numbers with at most 17 significant\n"
+    "digits will be read as dec64, which keeps their values exact. By\n"
+    "default such columns are read as float64.");
+}
+
+bool GenericReader::decimals_enabled() {
+  return read_decimals;
 }
 
 
@@ -317,15 +353,11 @@ void GenericReader::init_overridecolumntypes() {
 
 std::unique_ptr<DataTable> GenericReader::read_all()
 {
-  open_input();
-  detect_and_skip_bom();
-  skip_to_line_number();
-  skip_to_line_with_string();
-  skip_initial_whitespace();
-  skip_trailing_whitespace();
+  prepare_input();
 
   std::unique_ptr<DataTable> dt(nullptr);
   if (!dt) dt = read_empty_input();
+  if (!dt) dt = ParquetReader(*this).read_all();
   if (!dt) detect_improper_files();
   if (!dt) dt = FreadReader(*this).read_all();
   // if (!dt) dt = ArffReader(*this).read_all();
@@ -336,6 +368,43 @@ std::unique_ptr<DataTable> GenericReader::read_all()
 }
 
 
+/**
+ * Read the input in chunks of at most `chunk_nrows` rows each: every call
+ * returns the next chunk as a new DataTable, or nullptr when the input has
+ * been exhausted. The input is opened (and the parse parameters detected)
+ * during the first call; the state needed to continue reading is kept in
+ * the `chunk_reader` object between the calls.
+ */
+std::unique_ptr<DataTable> GenericReader::read_next_chunk(size_t chunk_nrows)
+{
+  if (chunk_reader) {
+    return chunk_reader->read_next_chunk(chunk_nrows);
+  }
+  if (reading_chunks) return nullptr;  // the input was empty
+  reading_chunks = true;
+
+  prepare_input();
+  std::unique_ptr<DataTable> dt = read_empty_input();
+  if (dt) return dt;
+  if (ParquetReader(*this).is_parquet()) {
+    throw NotImplError() << "Parquet files cannot be read in chunks";
+  }
+  detect_improper_files();
+  chunk_reader.reset(new FreadReader(*this));
+  return chunk_reader->read_next_chunk(chunk_nrows);
+}
+
+
+void GenericReader::prepare_input() {
+  open_input();
+  detect_and_skip_bom();
+  skip_to_line_number();
+  skip_to_line_with_string();
+  skip_initial_whitespace();
+  skip_trailing_whitespace();
+}
+
+
 
 //------------------------------------------------------------------------------
 
@@ -544,7 +613,11 @@ void GenericReader::open_input() {
     input_is_string = true;
 
   } else if ((filename = file_arg.to_cstring().ch)) {
-    input_mbuf = MemoryRange::overmap(filename, /* extra = */ 1);
+    if (freader.get_attr("_compression").is_none()) {
+      input_mbuf = MemoryRange::overmap(filename, /* extra = */ 1);
+    } else {
+      open_compressed_input(filename);
+    }
     size_t sz = input_mbuf.size();
     if (sz > 0) {
       sz--;
@@ -823,10 +896,84 @@ dtptr GenericReader::makeDatatable() {
     MemoryRange strbuf = col.extract_strbuf();
     SType stype = col.get_stype();
     ccols.push_back((stype == SType::STR32 || stype == SType::STR64)
-      ? new_string_column(nrows, std::move(databuf), std::move(strbuf))
+      ? maybe_categorize(
+          new_string_column(nrows, std::move(databuf), std::move(strbuf)))
+      : (stype == SType::DEC64)
+      ? make_decimal_column(nrows, std::move(databuf))
       : Column::new_mbuf_column(stype, std::move(databuf))
     );
   }
   py::olist names = freader.get_attr("_colnames").to_pylist();
   return dtptr(new DataTable(std::move(ccols), names));
 }
+
+
+Column* GenericReader::make_decimal_column(size_t nrows,
+                                           MemoryRange&& databuf)
+{
+  int64_t* data = static_cast<int64_t*>(databuf.wptr());
+  auto scale_of = [](int64_t x) {
+    return static_cast<int>(x & DEC64_SCALE_MASK);
+  };
+  auto value_of = [](int64_t x) {
+    return (x - (x & DEC64_SCALE_MASK)) / (DEC64_SCALE_MASK + 1);
+  };
+
+  std::mutex m;
+  int scale = 0;
+  dt::parallel_region(
+    [&] {
+      int tscale = 0;
+      dt::parallel_for_static(nrows,
+        [&](size_t i) {
+          if (!ISNA<int64_t>(data[i])) tscale = std::max(tscale, scale_of(data[i]));
+        });
+      std::lock_guard<std::mutex> lock(m);
+      scale = std::max(scale, tscale);
+    });
+
+  std::atomic<bool> fits { true };
+  dt::parallel_for_static(nrows,
+    [&](size_t i) {
+      int64_t x = data[i], y;
+      if (ISNA<int64_t>(x)) return;
+      if (!dt::rescale_decimal(value_of(x), scale_of(x), scale, &y) ||
+          ISNA<int64_t>(y)) fits = false;
+    });
+
+  if (fits) {
+    dt::parallel_for_static(nrows,
+      [&](size_t i) {
+        int64_t x = data[i];
+        if (!ISNA<int64_t>(x)) {
+          dt::rescale_decimal(value_of(x), scale_of(x), scale, data + i);
+        }
+      });
+    return new_decimal_column(SType::DEC64, nrows, scale, std::move(databuf));
+  }
+  // The values cannot be brought to a common scale: store them as doubles
+  // in the same buffer instead.
+  dt::parallel_for_static(nrows,
+    [&](size_t i) {
+      int64_t x = data[i];
+      double v = ISNA<int64_t>(x)
+          ? GETNA<double>()
+          : static_cast<double>(value_of(x)) /
+            static_cast<double>(dt::pow10i(scale_of(x)));
+      std::memcpy(data + i, &v, sizeof(double));
+    });
+  return Column::new_mbuf_column(SType::FLOAT64, std::move(databuf));
+}
+
+
+Column* GenericReader::maybe_categorize(Column* col) const {
+  size_t nrows = col->nrows;
+  if (categorical_threshold == 0.0 || nrows == 0) return col;
+  size_t max_levels = static_cast<size_t>(
+      categorical_threshold * static_cast<double>(nrows));
+  if (max_levels == 0) return col;
+  Column* res = categorize(col, SType::CAT8, max_levels);
+  if (!res) return col;
+  delete col;
+  return res;
+}
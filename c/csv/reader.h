@@ -13,6 +13,7 @@
 #include "read/columns.h"   // dt::read::Columns
 
 class DataTable;
+class FreadReader;
 using dtptr = std::unique_ptr<DataTable>;
 
 
@@ -96,6 +97,12 @@ class GenericReader
     py::oobj skipstring_arg;
     py::oobj tempstr;
 
+    // Reader used by `read_next_chunk()`: it is created when the first chunk
+    // is requested, and then persists until the input is exhausted.
+    std::unique_ptr<FreadReader> chunk_reader;
+    bool reading_chunks{ false };
+    int : 24;
+
     // If `trace()` cannot display a message immediately (because it was not
     // sent from the main thread), it will be temporarily stored in this
     // variable. Call `emit_delayed_messages()` from the master thread to send
@@ -110,6 +117,7 @@ class GenericReader
     virtual ~GenericReader();
 
     dtptr read_all();
+    dtptr read_next_chunk(size_t chunk_nrows);
 
     /**
      * Return the pointer to the input data buffer and its size. The method
@@ -146,6 +154,10 @@ class GenericReader
     // Called once during module initialization
     static void init_options();
 
+    // Whether columns of fixed-point numbers are detected as decimals (see
+    // option `fread.decimals`).
+    static bool decimals_enabled();
+
   // Helper functions
   private:
     void init_verbose();
@@ -164,7 +176,9 @@ class GenericReader
     void init_overridecolumntypes();
 
   protected:
+    void prepare_input();
     void open_input();
+    void open_compressed_input(const char* filename);
     void detect_and_skip_bom();
     void skip_initial_whitespace();
     void skip_trailing_whitespace();
@@ -182,6 +196,16 @@ class GenericReader
   protected:
     GenericReader(const GenericReader&);
     dtptr makeDatatable();
+
+    // Convert string column `col` into a categorical column if it has few
+    // distinct values (see option `fread.categorical_threshold`). The
+    // argument is consumed, and the new column is returned.
+    Column* maybe_categorize(Column* col) const;
+
+    // Create a DEC64 column from the values read by the Dec64 parser, which
+    // carry their own scales. If the values cannot be represented at a
+    // common scale, a FLOAT64 column is returned instead.
+    static Column* make_decimal_column(size_t nrows, MemoryRange&& databuf);
 };
 
 
@@ -0,0 +1,191 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include <algorithm>           // std::min
+#include <cstdio>              // std::remove
+#include <cstdlib>             // mkstemp
+#include <unistd.h>            // close
+#include "csv/reader.h"
+#include "python/_all.h"
+#include "python/string.h"
+#include "utils/exceptions.h"
+#include "utils/misc.h"        // wallclock
+#include "writebuf.h"
+
+// Size of the blocks in which the compressed input is fed to the decompressor,
+// and also the maximum size of the output of a single `.decompress()` call.
+static constexpr size_t DECOMPRESS_BLOCK_SIZE = 1 << 20;
+
+
+/**
+ * Create a streaming decompressor object for the given `codec`. The
+ * decompressors are taken from the Python standard library (modules `zlib`,
+ * `bz2` and `lzma`), which wrap the respective C libraries. This way
+ * datatable does not need to link to those libraries directly. All these
+ * objects share the same interface: method `.decompress(bytes, max_length)`
+ * returns the next portion of the output (of at most `max_length` bytes),
+ * and properties `.eof` / `.unused_data` describe the end of the compressed
+ * stream.
+ *
+ * The objects differ in how they keep the input that was not consumed
+ * because of the `max_length` limit: zlib returns it in property
+ * `.unconsumed_tail`, and it has to be passed back in the next call; bz2 and
+ * lzma buffer it internally, and report `.needs_input == False` while there
+ * is more output to be produced.
+ */
+static py::oobj make_decompressor(const std::string& codec) {
+  if (codec == "gzip") {
+    // wbits=47 (32 + 15) allows both gzip and zlib headers
+    return py::oobj::import("zlib", "decompressobj").call({py::oint(47)});
+  }
+  if (codec == "deflate") {
+    // Raw deflate stream, as used in zip archives
+    return py::oobj::import("zlib", "decompressobj").call({py::oint(-15)});
+  }
+  if (codec == "bz2") {
+    return py::oobj::import("bz2", "BZ2Decompressor").call();
+  }
+  if (codec == "xz") {
+    return py::oobj::import("lzma", "LZMADecompressor").call();
+  }
+  throw ValueError() << "Unknown compression method `" << codec << "`";
+}
+
+
+/**
+ * Write the decompressed content of `length` bytes of `codec`-compressed data
+ * at `inp` into the file `outname`, and return the size of the decompressed
+ * data. Parameter `filename` is only used for error messages.
+ *
+ * Each call to the decompressor produces at most DECOMPRESS_BLOCK_SIZE bytes
+ * of output, so that even a highly compressible block of input does not
+ * expand in memory all at once.
+ */
+static size_t decompress_to_file(const std::string& codec, const char* inp,
+                               size_t length, const std::string& outname,
+                               const char* filename)
+{
+  auto wb = WritableBuffer::create_target(outname, 0,
+                                          WritableBuffer::Strategy::Write);
+  if (codec == "stored") {
+    for (size_t pos = 0; pos < length; pos += DECOMPRESS_BLOCK_SIZE) {
+      wb->write(std::min(DECOMPRESS_BLOCK_SIZE, length - pos), inp + pos);
+    }
+  } else {
+    bool is_zlib = (codec == "gzip" || codec == "deflate");
+    py::oobj max_length = py::oint(DECOMPRESS_BLOCK_SIZE);
+    py::oobj empty = py::oobj::from_new_reference(
+        PyBytes_FromStringAndSize(nullptr, 0));
+    py::oobj decompressor = make_decompressor(codec);
+    bool stream_ended = false;
+    for (size_t pos = 0; pos < length; pos += DECOMPRESS_BLOCK_SIZE) {
+      size_t n = std::min(DECOMPRESS_BLOCK_SIZE, length - pos);
+      py::oobj block = py::oobj::from_new_reference(
+          PyBytes_FromStringAndSize(inp + pos, static_cast<Py_ssize_t>(n)));
+      while (true) {
+        if (stream_ended) {
+          decompressor = make_decompressor(codec);
+          stream_ended = false;
+        }
+        py::oobj out = decompressor.invoke("decompress",
+                                           py::otuple(block, max_length));
+        CString outstr = out.to_cstring();
+        if (outstr.size > 0) {
+          wb->write(static_cast<size_t>(outstr.size), outstr.ch);
+        }
+        if (decompressor.get_attr("eof").to_bool_strict()) {
+          // The end of the compressed stream was reached: the remaining data
+          // (if any) is the beginning of the next stream.
+          stream_ended = true;
+          block = decompressor.get_attr("unused_data");
+          if (block.to_cstring().size == 0) break;
+          continue;
+        }
+        // Otherwise, keep going for as long as the decompressor may have
+        // more output for the current block.
+        if (is_zlib) {
+          block = decompressor.get_attr("unconsumed_tail");
+          bool full = static_cast<size_t>(outstr.size) == DECOMPRESS_BLOCK_SIZE;
+          if (block.to_cstring().size == 0 && !full) break;
+        } else {
+          if (decompressor.get_attr("needs_input").to_bool_strict()) break;
+          block = empty;
+        }
+      }
+    }
+    if (!stream_ended && length > 0) {
+      throw IOError() << "Compressed file " << filename << " ended before "
+          "the end-of-stream marker was reached";
+    }
+  }
+  wb->finalize();
+  return wb->size();
+}
+
+
+/**
+ * Decompress the content of file `filename` into a temporary file, and then
+ * memory-map that temporary file as the input buffer.
+ *
+ * The compressed data is processed in blocks of DECOMPRESS_BLOCK_SIZE bytes,
+ * and each decompressed portion is written out immediately. Thus the amount
+ * of memory used does not depend on the size of the data: the decompressed
+ * text is backed by the file system (and the OS page cache), rather than by
+ * the process' heap.
+ *
+ * Files consisting of several concatenated compressed streams (such as those
+ * produced by `pigz`, `pbzip2`, or by simply concatenating .gz files) are
+ * read in full.
+ *
+ * The properties `_compression` and `_compression_range` of the python
+ * reader give the codec, and the (offset, length) of the compressed data
+ * within the file (this is used for members of zip archives).
+ */
+void GenericReader::open_compressed_input(const char* filename) {
+  std::string codec = freader.get_attr("_compression").to_string();
+  py::oobj range = freader.get_attr("_compression_range");
+
+  MemoryRange src = MemoryRange::mmap(filename);
+  size_t offset = 0;
+  size_t length = src.size();
+  if (!range.is_none()) {
+    py::otuple r = range.to_otuple();
+    offset = r[0].to_size_t();
+    length = r[1].to_size_t();
+    if (offset + length > src.size()) {
+      throw IOError() << "Compressed data in file " << filename
+          << " is truncated";
+    }
+  }
+  const char* inp = static_cast<const char*>(src.rptr()) + offset;
+
+  // The temporary file gets a unique name, so that concurrent readers (or
+  // other processes) sharing the same `tempdir` do not clobber each other.
+  std::string outname =
+      freader.get_attr("tempdir").to_string() + "/fread-input-XXXXXX";
+  int fd = mkstemp(&outname[0]);
+  if (fd == -1) {
+    throw IOError() << "Cannot create temporary file " << outname
+        << ": " << Errno;
+  }
+  close(fd);
+  trace("Decompressing %s data from file %s into %s",
+        codec.data(), filename, outname.data());
+  size_t outsize = 0;
+  try {
+    outsize = decompress_to_file(codec, inp, length, outname, filename);
+    input_mbuf = MemoryRange::overmap(outname, /* extra = */ 1);
+    // Force the memory-mapping (which is otherwise lazy): the file itself is
+    // no longer needed once it was mapped into memory.
+    input_mbuf.rptr();
+  } catch (...) {
+    std::remove(outname.data());
+    throw;
+  }
+  std::remove(outname.data());
+  trace("Decompressed %zu bytes into %zu bytes", length, outsize);
+}
@@ -33,6 +33,7 @@ FreadReader::FreadReader(const GenericReader& g)
   whiteChar = '\0';
   quoteRule = -1;
   cr_is_newline = true;
+  nchunks_read = 0;
   fo.input_size = input_size;
 }
 
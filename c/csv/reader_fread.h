@@ -113,11 +113,16 @@ class FreadReader : public GenericReader
   int8_t quoteRule;
   int64_t : 48;
 
+  // nchunks_read:
+  //   Number of chunks already returned by `read_next_chunk()`.
+  size_t nchunks_read;
+
 public:
   explicit FreadReader(const GenericReader&);
   virtual ~FreadReader() override;
 
   std::unique_ptr<DataTable> read_all();
+  std::unique_ptr<DataTable> read_next_chunk(size_t chunk_nrows);
 
   // Simple getters
   double get_mean_line_len() const { return meanLineLen; }
@@ -126,6 +131,10 @@ public:
   dt::read::FreadTokenizer makeTokenizer(dt::read::field64* target, const char* anchor) const;
 
 private:
+  void prepare();
+  void allocate_columns(size_t nrows);
+  const char* read_data();
+
   void parse_column_names(dt::read::FreadTokenizer& ctx);
   void detect_sep(dt::read::FreadTokenizer& ctx);
 
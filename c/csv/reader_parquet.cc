@@ -0,0 +1,936 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include <algorithm>              // std::min
+#include <cmath>                  // std::pow
+#include <cstring>                // std::memcmp, std::memcpy
+#include <limits>                 // std::numeric_limits
+#include <type_traits>            // std::is_integral, std::is_floating_point
+#include "csv/reader_parquet.h"
+#include "csv/reader_parsers.h"   // PT
+#include "parallel/api.h"         // dt::parallel_for_dynamic
+#include "read/parquet/snappy.h"
+#include "utils/exceptions.h"
+#include "utils/misc.h"           // wallclock
+#include "column.h"
+#include "datatable.h"
+
+namespace pq = dt::read::parquet;
+
+
+//------------------------------------------------------------------------------
+// Decoding helpers
+//------------------------------------------------------------------------------
+namespace {
+
+[[noreturn]] void corrupt(const char* what) {
+  throw IOError() << "Invalid Parquet file: " << what;
+}
+
+uint32_t read_u32le(const uint8_t* p) {
+  return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+         (static_cast<uint32_t>(p[2]) << 16) |
+         (static_cast<uint32_t>(p[3]) << 24);
+}
+
+int bit_width(uint32_t maxvalue) {
+  int w = 0;
+  while (maxvalue) { w++; maxvalue >>= 1; }
+  return w;
+}
+
+
+/**
+ * Decoder of the "RLE / bit-packed hybrid" encoding, which is used for the
+ * definition levels, dictionary indices and booleans. The data is a sequence
+ * of runs, each starting with a varint header: if its lowest bit is 0, then
+ * the run is a single value repeated `header >> 1` times; otherwise the run
+ * contains `8 * (header >> 1)` values bit-packed with `bit_width` bits each.
+ */
+class HybridDecoder {
+  private:
+    const uint8_t* ptr;
+    const uint8_t* end;
+    const uint8_t* packed;  // start of the current bit-packed run
+    size_t run_left;        // number of values remaining in the current run
+    size_t bitpos;          // position within the bit-packed run
+    uint32_t value;         // the value of the current RLE run
+    int width;
+    bool is_packed;
+    int : 24;
+
+  public:
+    HybridDecoder(const uint8_t* data, size_t size, int bit_width)
+      : ptr(data), end(data + size), packed(nullptr), run_left(0),
+        bitpos(0), value(0), width(bit_width), is_packed(false)
+    {
+      if (width > 32) corrupt("bit width of encoded values exceeds 32");
+    }
+
+    uint32_t next() {
+      while (!run_left) start_run();
+      run_left--;
+      if (!is_packed) return value;
+      size_t byte = bitpos >> 3;
+      int shift = static_cast<int>(bitpos & 7);
+      int nbytes = (shift + width + 7) >> 3;
+      uint64_t v = 0;
+      for (int i = 0; i < nbytes; ++i) {
+        v |= static_cast<uint64_t>(packed[byte + static_cast<size_t>(i)])
+             << (8 * i);
+      }
+      bitpos += static_cast<size_t>(width);
+      return static_cast<uint32_t>((v >> shift) & ((1ull << width) - 1));
+    }
+
+  private:
+    uint64_t read_varint() {
+      uint64_t res = 0;
+      for (int shift = 0; shift < 64; shift += 7) {
+        if (ptr == end) break;
+        uint8_t b = *ptr++;
+        res |= static_cast<uint64_t>(b & 0x7F) << shift;
+        if (!(b & 0x80)) return res;
+      }
+      corrupt("encoded values are truncated");
+    }
+
+    void start_run() {
+      if (ptr >= end) corrupt("encoded values are truncated");
+      uint64_t header = read_varint();
+      if (header & 1) {
+        size_t ngroups = static_cast<size_t>(header >> 1);
+        size_t nbytes = ngroups * static_cast<size_t>(width);
+        // The last run may be cut short, if it was padded with zeros
+        nbytes = std::min(nbytes, static_cast<size_t>(end - ptr));
+        is_packed = true;
+        packed = ptr;
+        bitpos = 0;
+        run_left = width? nbytes * 8 / static_cast<size_t>(width)
+                        : ngroups * 8;
+        ptr += nbytes;
+      } else {
+        size_t nbytes = static_cast<size_t>(width + 7) / 8;
+        if (static_cast<size_t>(end - ptr) < nbytes) {
+          corrupt("encoded values are truncated");
+        }
+        is_packed = false;
+        run_left = static_cast<size_t>(header >> 1);
+        value = 0;
+        for (size_t i = 0; i < nbytes; ++i) {
+          value |= static_cast<uint32_t>(ptr[i]) << (8 * i);
+        }
+        ptr += nbytes;
+      }
+    }
+};
+
+
+struct StrRef {
+  const char* ptr;
+  size_t len;
+};
+
+
+// Convert a value of physical type P into the output type T. Integers are
+// converted into floating-point values only for the DECIMAL columns, in
+// which case `div` is 10^scale.
+template <typename T, typename P>
+inline T convert(P x, double div) {
+  return (std::is_floating_point<T>::value && std::is_integral<P>::value)
+           ? static_cast<T>(static_cast<double>(x) / div)
+           : static_cast<T>(x);
+}
+
+
+//---- Sources of the values within a page -------------------------------------
+
+template <typename P, typename T>
+class PlainSource {
+  const uint8_t* ptr;
+  const uint8_t* end;
+  double div;
+  public:
+    PlainSource(const uint8_t* data, size_t size, double d)
+      : ptr(data), end(data + size), div(d) {}
+    T next() {
+      if (static_cast<size_t>(end - ptr) < sizeof(P)) {
+        corrupt("a data page is truncated");
+      }
+      P x;
+      std::memcpy(&x, ptr, sizeof(P));
+      ptr += sizeof(P);
+      return convert<T, P>(x, div);
+    }
+};
+
+class PlainStringSource {
+  const uint8_t* ptr;
+  const uint8_t* end;
+  public:
+    PlainStringSource(const uint8_t* data, size_t size)
+      : ptr(data), end(data + size) {}
+    StrRef next() {
+      if (end - ptr < 4) corrupt("a data page is truncated");
+      size_t len = read_u32le(ptr);
+      ptr += 4;
+      if (static_cast<size_t>(end - ptr) < len) {
+        corrupt("a data page is truncated");
+      }
+      StrRef res { reinterpret_cast<const char*>(ptr), len };
+      ptr += len;
+      return res;
+    }
+};
+
+class PlainBoolSource {
+  const uint8_t* ptr;
+  size_t size;
+  size_t i;
+  public:
+    PlainBoolSource(const uint8_t* data, size_t n)
+      : ptr(data), size(n), i(0) {}
+    int8_t next() {
+      if ((i >> 3) >= size) corrupt("a data page is truncated");
+      int8_t res = (ptr[i >> 3] >> (i & 7)) & 1;
+      i++;
+      return res;
+    }
+};
+
+class RleBoolSource {
+  HybridDecoder dec;
+  public:
+    RleBoolSource(const uint8_t* data, size_t n) : dec(data, n, 1) {}
+    int8_t next() { return static_cast<int8_t>(dec.next()); }
+};
+
+template <typename T>
+class DictSource {
+  HybridDecoder dec;
+  const std::vector<T>& dict;
+  public:
+    DictSource(const uint8_t* data, size_t n, const std::vector<T>& d)
+      : dec(data + 1, n? n - 1 : 0, n? data[0] : 0), dict(d) {}
+    T next() {
+      size_t i = dec.next();
+      if (i >= dict.size()) corrupt("dictionary index is out of bounds");
+      return dict[i];
+    }
+};
+
+
+//---- Destinations of the values ----------------------------------------------
+
+template <typename T>
+class FixedSink {
+  T* out;
+  public:
+    explicit FixedSink(T* data) : out(data) {}
+    void put(size_t i, T x) { out[i] = x; }
+    void put_na(size_t i) { out[i] = GETNA<T>(); }
+};
+
+
+// String data of a column chunk: the end offset of each string within
+// `chars` (the highest bit marks NA strings).
+struct StrChunk {
+  static constexpr uint64_t NA_BIT = 1ull << 63;
+  std::string chars;
+  std::vector<uint64_t> ends;
+};
+
+class StrSink {
+  StrChunk& out;
+  public:
+    explicit StrSink(StrChunk& sc) : out(sc) {}
+    void put(size_t i, StrRef x) {
+      out.chars.append(x.ptr, x.len);
+      out.ends[i] = out.chars.size();
+    }
+    void put_na(size_t i) {
+      out.ends[i] = out.chars.size() | StrChunk::NA_BIT;
+    }
+};
+
+
+// Write `n` values starting at row `row0` into the `sink`; `valid` tells
+// which of the rows are not null (if null, then all rows are valid).
+template <typename Source, typename Sink>
+void fill(Source&& src, Sink& sink, size_t row0, size_t n,
+          const uint8_t* valid)
+{
+  for (size_t i = 0; i < n; ++i) {
+    if (valid && !valid[i]) sink.put_na(row0 + i);
+    else sink.put(row0 + i, src.next());
+  }
+}
+
+
+
+//------------------------------------------------------------------------------
+// Value decoders for different types of columns
+//------------------------------------------------------------------------------
+
+// Decoder of a fixed-width column with physical type P, into an output
+// column of type T.
+template <typename P, typename T>
+class FixedDecoder {
+  FixedSink<T> sink;
+  std::vector<T> dict;
+  double div;
+  public:
+    FixedDecoder(T* out, double d) : sink(out), div(d) {}
+
+    void dictionary(const uint8_t* data, size_t size, size_t n) {
+      PlainSource<P, T> src(data, size, div);
+      dict.resize(n);
+      for (size_t i = 0; i < n; ++i) dict[i] = src.next();
+    }
+
+    void values(int32_t encoding, const uint8_t* data, size_t size,
+                size_t row0, size_t n, const uint8_t* valid)
+    {
+      switch (encoding) {
+        case pq::PLAIN:
+          return fill(PlainSource<P, T>(data, size, div), sink, row0, n, valid);
+        case pq::PLAIN_DICTIONARY:
+        case pq::RLE_DICTIONARY:
+          return fill(DictSource<T>(data, size, dict), sink, row0, n, valid);
+        default:
+          throw NotImplError() << "Parquet encoding " << encoding
+              << " is not supported for numeric columns";
+      }
+    }
+};
+
+
+// Convert `n` timestamps in the given TimeUnit into microseconds, in place.
+// The nanoseconds are rounded down; the milliseconds which would overflow
+// become NAs.
+static void to_microseconds(int64_t* data, size_t n, int32_t unit) {
+  constexpr int64_t MAX = std::numeric_limits<int64_t>::max() / 1000;
+  for (size_t i = 0; i < n; ++i) {
+    int64_t x = data[i];
+    if (ISNA<int64_t>(x)) continue;
+    if (unit == pq::TU_MILLIS) {
+      data[i] = (x > MAX || x < -MAX)? GETNA<int64_t>() : x * 1000;
+    } else if (unit == pq::TU_NANOS) {
+      data[i] = x / 1000 - (x % 1000 < 0);
+    }
+  }
+}
+
+
+class BoolDecoder {
+  FixedSink<int8_t> sink;
+  public:
+    explicit BoolDecoder(int8_t* out) : sink(out) {}
+
+    void dictionary(const uint8_t*, size_t, size_t) {
+      corrupt("boolean columns cannot be dictionary-encoded");
+    }
+
+    void values(int32_t encoding, const uint8_t* data, size_t size,
+                size_t row0, size_t n, const uint8_t* valid)
+    {
+      switch (encoding) {
+        case pq::PLAIN:
+          return fill(PlainBoolSource(data, size), sink, row0, n, valid);
+        case pq::RLE: {
+          // The RLE-encoded booleans are prefixed with the data's length
+          if (size < 4) corrupt("a data page is truncated");
+          size_t len = std::min<size_t>(read_u32le(data), size - 4);
+          return fill(RleBoolSource(data + 4, len), sink, row0, n, valid);
+        }
+        default:
+          throw NotImplError() << "Parquet encoding " << encoding
+              << " is not supported for boolean columns";
+      }
+    }
+};
+
+
+class StringDecoder {
+  StrSink sink;
+  std::vector<StrRef> dict;
+  public:
+    explicit StringDecoder(StrChunk& out) : sink(out) {}
+
+    // The dictionary refers to the data of the dictionary page, which is
+    // kept alive while the column chunk is being decoded.
+    void dictionary(const uint8_t* data, size_t size, size_t n) {
+      PlainStringSource src(data, size);
+      dict.resize(n);
+      for (size_t i = 0; i < n; ++i) dict[i] = src.next();
+    }
+
+    void values(int32_t encoding, const uint8_t* data, size_t size,
+                size_t row0, size_t n, const uint8_t* valid)
+    {
+      switch (encoding) {
+        case pq::PLAIN:
+          return fill(PlainStringSource(data, size), sink, row0, n, valid);
+        case pq::PLAIN_DICTIONARY:
+        case pq::RLE_DICTIONARY:
+          return fill(DictSource<StrRef>(data, size, dict), sink, row0, n,
+                      valid);
+        default:
+          throw NotImplError() << "Parquet encoding " << encoding
+              << " is not supported for string columns";
+      }
+    }
+};
+
+
+const char* codec_name(int32_t codec) {
+  switch (codec) {
+    case pq::UNCOMPRESSED: return "uncompressed";
+    case pq::SNAPPY:       return "snappy";
+    case pq::GZIP:         return "gzip";
+    case pq::LZO:          return "lzo";
+    case pq::BROTLI:       return "brotli";
+    case pq::LZ4:          return "lz4";
+    case pq::ZSTD:         return "zstd";
+    case pq::LZ4_RAW:      return "lz4_raw";
+    default:               return "unknown";
+  }
+}
+
+}  // namespace
+
+
+
+//------------------------------------------------------------------------------
+// Column chunk
+//------------------------------------------------------------------------------
+
+/**
+ * Reader of a single column chunk (i.e. the data of one column within one
+ * row group). It walks through the pages of the chunk, decompresses them,
+ * decodes the definition levels, and passes the values to the `Decoder`.
+ */
+class ParquetChunkReader {
+  private:
+    const uint8_t* data;   // start of the chunk
+    size_t size;           // size of the chunk
+    size_t nrows;          // number of rows to read
+    int32_t codec;
+    int32_t max_def;
+    const Compressor* compressor;
+    std::vector<uint8_t> valid;
+    std::vector<char> dictbuf, pagebuf;
+
+  public:
+    ParquetChunkReader(const uint8_t* chunk, size_t chunksize, size_t n,
+                       int32_t codec_, int32_t maxdef, const Compressor* cmp)
+      : data(chunk), size(chunksize), nrows(n), codec(codec_),
+        max_def(maxdef), compressor(cmp) {}
+
+    template <typename Decoder>
+    void read(Decoder& dec) {
+      size_t pos = 0;
+      size_t row = 0;
+      while (row < nrows) {
+        if (pos >= size) corrupt("a column chunk has fewer values than rows");
+        pq::PageHeader ph = pq::read_page_header(data + pos, size - pos);
+        pos += ph.header_size;
+        size_t csize = static_cast<size_t>(ph.compressed_size);
+        size_t usize = static_cast<size_t>(ph.uncompressed_size);
+        if (ph.compressed_size < 0 || ph.uncompressed_size < 0 ||
+            ph.num_values < 0 || csize > size - pos) {
+          corrupt("a page is outside of its column chunk");
+        }
+        const uint8_t* page = data + pos;
+        pos += csize;
+
+        if (ph.type == pq::DICTIONARY_PAGE) {
+          const uint8_t* buf = decompress(page, csize, usize, dictbuf);
+          dec.dictionary(buf, usize, static_cast<size_t>(ph.num_values));
+          continue;
+        }
+        if (ph.type != pq::DATA_PAGE && ph.type != pq::DATA_PAGE_V2) {
+          continue;  // index pages are not needed
+        }
+        size_t nvalues = static_cast<size_t>(ph.num_values);
+        size_t n = std::min(nvalues, nrows - row);
+        const uint8_t* values;
+        size_t valsize;
+        bool has_nulls = false;
+        if (ph.type == pq::DATA_PAGE) {
+          // The levels are compressed together with the values; the
+          // definition levels are prefixed with their length
+          values = decompress(page, csize, usize, pagebuf);
+          valsize = usize;
+          if (max_def) {
+            if (valsize < 4) corrupt("a data page is truncated");
+            size_t len = read_u32le(values);
+            if (len > valsize - 4) corrupt("a data page is truncated");
+            has_nulls = read_levels(values + 4, len, n);
+            values += 4 + len;
+            valsize -= 4 + len;
+          }
+        } else {
+          size_t replen = static_cast<size_t>(ph.rep_levels_length);
+          size_t deflen = static_cast<size_t>(ph.def_levels_length);
+          if (ph.rep_levels_length < 0 || ph.def_levels_length < 0 ||
+              replen + deflen > csize || replen + deflen > usize) {
+            corrupt("a data page is truncated");
+          }
+          if (max_def) has_nulls = read_levels(page + replen, deflen, n);
+          size_t skip = replen + deflen;
+          valsize = usize - skip;
+          values = ph.is_compressed
+                     ? decompress(page + skip, csize - skip, valsize, pagebuf)
+                     : page + skip;
+          if (!ph.is_compressed && valsize != csize - skip) {
+            corrupt("an uncompressed data page has invalid size");
+          }
+        }
+        dec.values(ph.encoding, values, valsize, row, n,
+                   has_nulls? valid.data() : nullptr);
+        row += n;
+      }
+    }
+
+  private:
+    // Decode the definition levels of `n` values into the `valid` array.
+    // Returns false if all values are valid.
+    bool read_levels(const uint8_t* levels, size_t len, size_t n) {
+      HybridDecoder dec(levels, len, bit_width(static_cast<uint32_t>(max_def)));
+      valid.resize(n);
+      bool has_nulls = false;
+      for (size_t i = 0; i < n; ++i) {
+        bool v = (dec.next() == static_cast<uint32_t>(max_def));
+        valid[i] = v;
+        has_nulls |= !v;
+      }
+      return has_nulls;
+    }
+
+    const uint8_t* decompress(const uint8_t* src, size_t srcsize,
+                              size_t dstsize, std::vector<char>& buf)
+    {
+      if (codec == pq::UNCOMPRESSED) {
+        if (srcsize != dstsize) {
+          corrupt("an uncompressed page has invalid size");
+        }
+        return src;
+      }
+      buf.resize(dstsize);
+      const char* csrc = reinterpret_cast<const char*>(src);
+      if (codec == pq::SNAPPY) {
+        pq::snappy_decompress(csrc, srcsize, buf.data(), dstsize);
+      } else {
+        compressor->decompress(csrc, srcsize, buf.data(), dstsize);
+      }
+      return reinterpret_cast<const uint8_t*>(buf.data());
+    }
+};
+
+
+
+//------------------------------------------------------------------------------
+// ParquetReader
+//------------------------------------------------------------------------------
+
+ParquetReader::ParquetReader(const GenericReader& g) : GenericReader(g) {}
+
+ParquetReader::~ParquetReader() {}
+
+
+bool ParquetReader::is_parquet() const {
+  size_t size = datasize();
+  return size >= 12 && std::memcmp(sof, "PAR1", 4) == 0 &&
+                       std::memcmp(eof - 4, "PAR1", 4) == 0;
+}
+
+
+void ParquetReader::read_metadata() {
+  const uint8_t* end = reinterpret_cast<const uint8_t*>(eof);
+  size_t metasize = read_u32le(end - 8);
+  if (metasize > datasize() - 12) {
+    corrupt("the size of the metadata exceeds the size of the file");
+  }
+  meta = pq::read_file_metadata(end - 8 - metasize, metasize);
+  trace("Parquet file created by %s: %zu row groups, %lld rows",
+        meta.created_by.empty()? "an unknown writer" : meta.created_by.c_str(),
+        meta.row_groups.size(), static_cast<long long>(meta.num_rows));
+}
+
+
+// The unit of a timestamp column, or TU_NONE if the column is not a
+// timestamp. Older writers only set the converted type, while the newer ones
+// set the logical type as well (and only the logical type for nanoseconds).
+static int32_t parquet_time_unit(const pq::SchemaElement& el) {
+  if (el.type != pq::INT64) return pq::TU_NONE;
+  if (el.logical_type == pq::LT_TIMESTAMP) return el.time_unit;
+  if (el.converted_type == pq::CT_TIMESTAMP_MILLIS) return pq::TU_MILLIS;
+  if (el.converted_type == pq::CT_TIMESTAMP_MICROS) return pq::TU_MICROS;
+  return pq::TU_NONE;
+}
+
+
+// Dates are stored as the number of days since 1970-01-01, same as DATE32;
+// timestamps are converted into the microseconds of DATE64.
+static SType parquet_stype(const pq::SchemaElement& el) {
+  int32_t ct = el.converted_type;
+  switch (el.type) {
+    case pq::BOOLEAN: return SType::BOOL;
+    case pq::INT32:
+      if (ct == pq::CT_DATE || el.logical_type == pq::LT_DATE) {
+        return SType::DATE32;
+      }
+      if (ct == pq::CT_DECIMAL) return SType::FLOAT64;
+      if (ct == pq::CT_INT_8) return SType::INT8;
+      if (ct == pq::CT_INT_16 || ct == pq::CT_UINT_8) return SType::INT16;
+      if (ct == pq::CT_UINT_32) return SType::INT64;
+      return SType::INT32;
+    case pq::INT64:
+      switch (parquet_time_unit(el)) {
+        case pq::TU_NONE: break;
+        case pq::TU_MILLIS:
+        case pq::TU_MICROS:
+        case pq::TU_NANOS: return SType::DATE64;
+        default: return SType::VOID;
+      }
+      if (ct == pq::CT_DECIMAL) return SType::FLOAT64;
+      if (ct == pq::CT_UINT_64) return SType::VOID;
+      return SType::INT64;
+    case pq::FLOAT: return SType::FLOAT32;
+    case pq::DOUBLE: return SType::FLOAT64;
+    case pq::BYTE_ARRAY: return SType::STR32;
+    default: return SType::VOID;
+  }
+}
+
+
+// The parse type which is reported to python as the column's type.
+static PT stype_to_ptype(SType stype) {
+  switch (stype) {
+    case SType::BOOL:    return PT::Bool01;
+    case SType::INT8:
+    case SType::INT16:
+    case SType::INT32:   return PT::Int32;
+    case SType::INT64:   return PT::Int64;
+    case SType::FLOAT32: return PT::Float32Hex;
+    case SType::FLOAT64: return PT::Float64Plain;
+    case SType::DATE32:  return PT::Date32;
+    case SType::DATE64:  return PT::Date64;
+    default:             return PT::Str32;
+  }
+}
+
+
+/**
+ * Walk the schema tree (which is stored in depth-first order), and collect
+ * its leaves into the `leaves` vector and the `columns` of the reader.
+ */
+void ParquetReader::detect_columns() {
+  const auto& schema = meta.schema;
+  if (schema.empty()) corrupt("the schema is empty");
+
+  struct Group {
+    size_t children_left;
+    std::string prefix;
+    int32_t def;
+    bool repeated;
+    int : 24;
+  };
+  std::vector<Group> stack;
+  stack.push_back(Group {static_cast<size_t>(schema[0].num_children), "", 0,
+                         false});
+  for (size_t i = 1; i < schema.size(); ++i) {
+    while (!stack.empty() && stack.back().children_left == 0) stack.pop_back();
+    if (stack.empty()) corrupt("the schema has too many elements");
+    Group& parent = stack.back();
+    parent.children_left--;
+    const pq::SchemaElement& el = schema[i];
+    std::string name = parent.prefix + el.name;
+    int32_t def = parent.def + (el.repetition != pq::REQUIRED);
+    bool repeated = parent.repeated || el.repetition == pq::REPEATED;
+    if (el.num_children > 0) {
+      stack.push_back(Group {static_cast<size_t>(el.num_children),
+                             name + ".", def, repeated});
+      continue;
+    }
+    Leaf leaf;
+    leaf.name = name;
+    leaf.physical_type = el.type;
+    leaf.converted_type = el.converted_type;
+    leaf.scale = el.scale;
+    leaf.max_def = def;
+    leaf.time_unit = parquet_time_unit(el);
+    leaf.stype = parquet_stype(el);
+    leaf.repeated = repeated;
+    leaves.push_back(std::move(leaf));
+  }
+
+  size_t ncols = leaves.size();
+  columns.add_columns(ncols);
+  for (size_t j = 0; j < ncols; ++j) {
+    std::string name = leaves[j].name;
+    columns[j].set_name(std::move(name));
+    columns[j].force_ptype(stype_to_ptype(leaves[j].stype));
+  }
+}
+
+
+void ParquetReader::prepare_codecs(const std::vector<size_t>& selected) {
+  for (const pq::RowGroup& rg : meta.row_groups) {
+    if (rg.columns.size() != leaves.size()) {
+      corrupt("a row group has invalid number of columns");
+    }
+    for (size_t j : selected) {
+      const pq::ColumnChunk& cc = rg.columns[j];
+      if (cc.external) {
+        throw NotImplError() << "Column `" << leaves[j].name << "` in the "
+            "Parquet file is stored in an external file, which is not "
+            "supported";
+      }
+      if (cc.type != leaves[j].physical_type) {
+        corrupt("type of a column chunk does not match the schema");
+      }
+      switch (cc.codec) {
+        case pq::UNCOMPRESSED:
+        case pq::SNAPPY: break;
+        case pq::GZIP: if (!gzip) gzip = Compressor::make("gzip"); break;
+        case pq::ZSTD: if (!zstd) zstd = Compressor::make("zstd"); break;
+        default:
+          throw NotImplError() << "Compression codec `"
+              << codec_name(cc.codec) << "` used in column `"
+              << leaves[j].name << "` of the Parquet file is not supported";
+      }
+    }
+  }
+}
+
+
+dtptr ParquetReader::read_all() {
+  if (!is_parquet()) return nullptr;
+  double t0 = wallclock();
+  trace("[Parquet reader]");
+  read_metadata();
+  detect_columns();
+  report_columns_to_python();
+
+  // Select the columns to be read
+  std::vector<size_t> selected;
+  for (size_t j = 0; j < leaves.size(); ++j) {
+    if (!columns[j].is_in_output()) continue;
+    const Leaf& leaf = leaves[j];
+    if (leaf.repeated) {
+      throw NotImplError() << "Column `" << leaf.name << "` in the Parquet "
+          "file is repeated (a list), which is not supported";
+    }
+    if (leaf.stype == SType::VOID) {
+      throw NotImplError() << "Column `" << leaf.name << "` in the Parquet "
+          "file has physical type " << leaf.physical_type << " and converted "
+          "type " << leaf.converted_type << ", which are not supported";
+    }
+    if (columns[j].get_ptype() != stype_to_ptype(leaf.stype)) {
+      warn("Column `%s` in the Parquet file will be read with its native "
+           "type %s: type overrides are not supported",
+           leaf.name.c_str(), info(leaf.stype).name());
+    }
+    selected.push_back(j);
+  }
+  prepare_codecs(selected);
+
+  // Row groups to be read, and their starting rows
+  size_t nrows = 0;
+  std::vector<size_t> rowstarts;
+  for (const pq::RowGroup& rg : meta.row_groups) {
+    if (nrows >= max_nrows) break;
+    if (rg.num_rows < 0) corrupt("a row group has negative number of rows");
+    rowstarts.push_back(nrows);
+    nrows += static_cast<size_t>(rg.num_rows);
+  }
+  nrows = std::min(nrows, max_nrows);
+  size_t nrgs = rowstarts.size();
+  size_t nsel = selected.size();
+  trace("Reading %zu column%s from %zu row group%s (%zu rows)",
+        nsel, nsel == 1? "" : "s", nrgs, nrgs == 1? "" : "s", nrows);
+
+  // Allocate the output. The string columns are first decoded into
+  // separate chunks (one per row group), since their sizes are not known.
+  std::vector<MemoryRange> outbufs(nsel);
+  std::vector<std::vector<StrChunk>> strchunks(nsel);
+  for (size_t k = 0; k < nsel; ++k) {
+    SType stype = leaves[selected[k]].stype;
+    if (stype == SType::STR32) {
+      strchunks[k].resize(nrgs);
+    } else {
+      outbufs[k] = MemoryRange::mem(nrows * info(stype).elemsize());
+    }
+  }
+  std::vector<void*> outptrs(nsel);
+  for (size_t k = 0; k < nsel; ++k) {
+    outptrs[k] = outbufs[k].size()? outbufs[k].xptr() : nullptr;
+  }
+
+  const uint8_t* filedata = reinterpret_cast<const uint8_t*>(sof);
+  size_t datalimit = datasize() - 8;
+  size_t nth = static_cast<size_t>(nthreads);
+  dt::parallel_for_dynamic(nrgs * nsel, nth,
+    [&](size_t task) {
+      size_t r = task / nsel;
+      size_t k = task % nsel;
+      const Leaf& leaf = leaves[selected[k]];
+      const pq::ColumnChunk& cc = meta.row_groups[r].columns[selected[k]];
+      size_t row0 = rowstarts[r];
+      size_t n = std::min(static_cast<size_t>(meta.row_groups[r].num_rows),
+                          nrows - row0);
+
+      int64_t start = cc.data_page_offset;
+      if (cc.dictionary_page_offset > 0 && cc.dictionary_page_offset < start) {
+        start = cc.dictionary_page_offset;
+      }
+      if (start < 4 || cc.total_compressed_size < 0 ||
+          static_cast<size_t>(start) > datalimit ||
+          static_cast<size_t>(cc.total_compressed_size) >
+              datalimit - static_cast<size_t>(start)) {
+        corrupt("a column chunk is outside of the file");
+      }
+      const Compressor* cmp = cc.codec == pq::GZIP? gzip.get() : zstd.get();
+      ParquetChunkReader rdr(filedata + start,
+                             static_cast<size_t>(cc.total_compressed_size),
+                             n, cc.codec, leaf.max_def, cmp);
+      double div = std::pow(10.0, leaf.scale);
+      void* out = outptrs[k];
+      switch (leaf.stype) {
+        case SType::BOOL: {
+          BoolDecoder dec(static_cast<int8_t*>(out) + row0);
+          rdr.read(dec);
+          break;
+        }
+        case SType::INT8: {
+          FixedDecoder<int32_t, int8_t> dec(static_cast<int8_t*>(out) + row0,
+                                            div);
+          rdr.read(dec);
+          break;
+        }
+        case SType::INT16: {
+          FixedDecoder<int32_t, int16_t> dec(
+              static_cast<int16_t*>(out) + row0, div);
+          rdr.read(dec);
+          break;
+        }
+        case SType::INT32:
+        case SType::DATE32: {
+          FixedDecoder<int32_t, int32_t> dec(
+              static_cast<int32_t*>(out) + row0, div);
+          rdr.read(dec);
+          break;
+        }
+        case SType::INT64: {
+          int64_t* dst = static_cast<int64_t*>(out) + row0;
+          if (leaf.physical_type == pq::INT32) {  // UINT_32
+            FixedDecoder<uint32_t, int64_t> dec(dst, div);
+            rdr.read(dec);
+          } else {
+            FixedDecoder<int64_t, int64_t> dec(dst, div);
+            rdr.read(dec);
+          }
+          break;
+        }
+        case SType::DATE64: {
+          int64_t* dst = static_cast<int64_t*>(out) + row0;
+          FixedDecoder<int64_t, int64_t> dec(dst, div);
+          rdr.read(dec);
+          to_microseconds(dst, n, leaf.time_unit);
+          break;
+        }
+        case SType::FLOAT32: {
+          FixedDecoder<float, float> dec(static_cast<float*>(out) + row0,
+                                         div);
+          rdr.read(dec);
+          break;
+        }
+        case SType::FLOAT64: {
+          double* dst = static_cast<double*>(out) + row0;
+          if (leaf.physical_type == pq::INT32) {  // DECIMAL
+            FixedDecoder<int32_t, double> dec(dst, div);
+            rdr.read(dec);
+          } else if (leaf.physical_type == pq::INT64) {
+            FixedDecoder<int64_t, double> dec(dst, div);
+            rdr.read(dec);
+          } else {
+            FixedDecoder<double, double> dec(dst, div);
+            rdr.read(dec);
+          }
+          break;
+        }
+        case SType::STR32: {
+          StrChunk& sc = strchunks[k][r];
+          sc.ends.resize(n);
+          StringDecoder dec(sc);
+          rdr.read(dec);
+          break;
+        }
+        default:
+          throw RuntimeError() << "Unexpected stype "
+              << static_cast<int>(leaf.stype);
+      }
+    });
+
+  // Assemble the output columns
+  std::vector<Column*> ccols;
+  for (size_t k = 0; k < nsel; ++k) {
+    if (strchunks[k].empty() && leaves[selected[k]].stype != SType::STR32) {
+      ccols.push_back(Column::new_mbuf_column(leaves[selected[k]].stype,
+                                              std::move(outbufs[k])));
+      continue;
+    }
+    auto& chunks = strchunks[k];
+    std::vector<size_t> charstarts(nrgs + 1, 0);
+    for (size_t r = 0; r < nrgs; ++r) {
+      charstarts[r + 1] = charstarts[r] + chunks[r].chars.size();
+    }
+    size_t strsize = charstarts[nrgs];
+    bool str64 = strsize > Column::MAX_STR32_BUFFER_SIZE ||
+                 nrows > Column::MAX_STR32_NROWS;
+    size_t elemsize = str64? 8 : 4;
+    MemoryRange offbuf = MemoryRange::mem((nrows + 1) * elemsize);
+    MemoryRange strbuf = MemoryRange::mem(strsize);
+    void* offptr = offbuf.xptr();
+    char* strptr = strsize? static_cast<char*>(strbuf.xptr()) : nullptr;
+    if (str64) static_cast<uint64_t*>(offptr)[0] = 0;
+    else       static_cast<uint32_t*>(offptr)[0] = 0;
+    dt::parallel_for_dynamic(nrgs, nth,
+      [&](size_t r) {
+        StrChunk& sc = chunks[r];
+        uint64_t base = charstarts[r];
+        size_t row1 = rowstarts[r] + 1;
+        if (str64) {
+          uint64_t* dst = static_cast<uint64_t*>(offptr) + row1;
+          for (size_t i = 0; i < sc.ends.size(); ++i) {
+            uint64_t e = sc.ends[i];
+            dst[i] = ((e & ~StrChunk::NA_BIT) + base) |
+                     ((e & StrChunk::NA_BIT)? GETNA<uint64_t>() : 0);
+          }
+        } else {
+          uint32_t* dst = static_cast<uint32_t*>(offptr) + row1;
+          for (size_t i = 0; i < sc.ends.size(); ++i) {
+            uint64_t e = sc.ends[i];
+            dst[i] = static_cast<uint32_t>((e & ~StrChunk::NA_BIT) + base) |
+                     ((e & StrChunk::NA_BIT)? GETNA<uint32_t>() : 0);
+          }
+        }
+        if (!sc.chars.empty()) {
+          std::memcpy(strptr + base, sc.chars.data(), sc.chars.size());
+        }
+        StrChunk().chars.swap(sc.chars);  // release the memory
+      });
+    ccols.push_back(maybe_categorize(
+        new_string_column(nrows, std::move(offbuf), std::move(strbuf))));
+  }
+
+  py::olist names = pyreader().get_attr("_colnames").to_pylist();
+  trace("Parquet file read in %.3fs", wallclock() - t0);
+  return dtptr(new DataTable(std::move(ccols), names));
+}
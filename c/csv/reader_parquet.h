@@ -0,0 +1,72 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#ifndef dt_CSV_READER_PARQUET_h
+#define dt_CSV_READER_PARQUET_h
+#include <memory>                 // std::unique_ptr
+#include <string>                 // std::string
+#include <vector>                 // std::vector
+#include "csv/reader.h"           // GenericReader
+#include "csv/reader_parsers.h"   // ParserLibrary
+#include "read/parquet/metadata.h"
+#include "utils/compress.h"       // Compressor
+#include "types.h"                // SType
+
+
+/**
+ * Reader for files in Apache Parquet format.
+ *
+ * The file's footer is decoded first, which gives the schema and the
+ * locations of all column chunks. The (flat) schema is reported to the
+ * python side the same way as the columns detected by fread, so that the
+ * `columns=` parameter can be used to select, drop or rename the columns.
+ * Only the selected columns are read from the file.
+ *
+ * The column chunks of all row groups are then decoded in parallel, each
+ * directly into its place within the output column's buffer. Supported are
+ * the PLAIN and dictionary encodings of the values, and the RLE / bit-packed
+ * hybrid encoding of the definition levels and booleans; the pages may be
+ * compressed with snappy, gzip or zstd.
+ */
+class ParquetReader : public GenericReader
+{
+  // A "leaf" of the schema, i.e. a column of data in the file. Columns
+  // nested within (non-repeated) groups are named "group.column".
+  struct Leaf {
+    std::string name;
+    int32_t physical_type;
+    int32_t converted_type;
+    int32_t scale;
+    int32_t max_def;       // maximum definition level
+    int32_t time_unit;     // TimeUnit of the timestamp (DATE64) columns
+    SType stype;           // VOID if the column's type is not supported
+    bool repeated;         // repeated columns (lists) are not supported
+    int : 16;
+  };
+
+  ParserLibrary parserlib;
+  dt::read::parquet::FileMetaData meta;
+  std::vector<Leaf> leaves;
+  std::unique_ptr<Compressor> gzip;
+  std::unique_ptr<Compressor> zstd;
+
+  public:
+    explicit ParquetReader(const GenericReader&);
+    ~ParquetReader() override;
+
+    // Returns nullptr if the input is not a Parquet file.
+    dtptr read_all();
+    bool is_parquet() const;
+
+  private:
+    void read_metadata();
+    void detect_columns();
+    void prepare_codecs(const std::vector<size_t>& selected);
+};
+
+
+#endif
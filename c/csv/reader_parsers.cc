@@ -5,11 +5,18 @@
 //
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
+#include <cstdlib>                       // std::strtod
+#include <cstring>                       // std::memcpy
 #include <limits>                        // std::numeric_limits
+#include <string>                        // std::string, std::to_string
 #include "csv/reader_parsers.h"
+#include "read/fread/fread_scan.h"       // find_structural
+#include "read/fread/fread_swar.h"       // read_digits
 #include "read/fread/fread_tokenizer.h"  // FreadTokenizer
-#include "read/constants.h"              // hexdigits, pow10lookup
+#include "read/constants.h"              // hexdigits, pow5_128
 #include "utils/assert.h"                // xassert
+#include "utils/datetime.h"              // parse_date32, parse_date64, ...
+#include "utils/decimal.h"               // parse_decimal
 
 static constexpr int8_t   NA_BOOL8 = -128;
 static constexpr int32_t  NA_INT32 = INT32_MIN;
@@ -118,8 +125,6 @@ void parse_int_simple(FreadTokenizer& ctx) {
   ch += (negative || *ch == '+');
   const char* start = ch;     // to check if at least one digit is present
   uint64_t value = 0;         // value accumulator
-  uint8_t  digit;             // current digit being read
-  int sd = 0;                 // number of significant digits (without initial 0s)
 
   if (allow_leading_zeroes) {
     while (*ch == '0') ch++;  // skip leading zeros
@@ -128,14 +133,15 @@ void parse_int_simple(FreadTokenizer& ctx) {
     ctx.ch = ch + 1;
     return;
   }
-  while ((digit = static_cast<uint8_t>(ch[sd] - '0')) < 10) {
-    value = 10*value + digit;
-    sd++;
-  }
+  // Digits are read 8 at a time (see "fread_swar.h"). Reading stops after
+  // MAX_DIGITS + 1 digits: such a number cannot be valid anyway. Here `sd` is
+  // the number of significant digits (without initial 0s).
+  int sd = read_digits(ch, ctx.eof, value, MAX_DIGITS + 1);
   ch += sd;
   // Usually `0 < sd < MAX_DIGITS`, and no other checks are needed.
   // If `sd == 0` then the input is valid iff it is "0" (or multiple 0s,
   // possibly with a sign), which can be checked via `ch > start`.
+  // If `sd > MAX_DIGITS`, then the number is too large for the type T.
   // If `sd == MAX_DIGITS`, then we need to check that the value did not
   // overflow. Since the accumulator is uint64_t, it can hold integer
   // values up to 18446744073709551615. This is enough to fit any 10- or
@@ -228,6 +234,30 @@ void parse_intNN_grouped(FreadTokenizer& ctx) {
 
 
 
+//------------------------------------------------------------------------------
+// Dec64
+//------------------------------------------------------------------------------
+
+/**
+ * Parse a fixed-point number with at most 17 significant digits, and store
+ * it together with its scale (see DEC64_SCALE_BITS). Numbers that need a
+ * scale larger than 18, or have too many digits, are left to the float
+ * parsers.
+ */
+void parse_dec64(FreadTokenizer& ctx) {
+  const char* ch = ctx.ch;
+  int64_t value;
+  int scale;
+  if (dt::parse_decimal(ch, ctx.eof, ctx.dec, 17, &value, &scale)) {
+    ctx.target->int64 = value * (DEC64_SCALE_MASK + 1) + scale;
+    ctx.ch = ch;
+  } else {
+    ctx.target->int64 = NA_INT64;
+  }
+}
+
+
+
 //------------------------------------------------------------------------------
 // Float32
 //------------------------------------------------------------------------------
@@ -296,6 +326,126 @@ void parse_float32_hex(FreadTokenizer& ctx) {
 // Float64
 //------------------------------------------------------------------------------
 
+static constexpr double EXACT_POW10[23] = {
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+
+/**
+ * Eisel-Lemire algorithm: compute the double nearest to `w`·10ᵠ by
+ * multiplying `w` with a 128-bit approximation of 5ᵠ (see D.Lemire, "Number
+ * Parsing at a Gigabyte per Second", 2021). The result is written into `bits`
+ * as the binary representation of a double.
+ *
+ * Returns false if the product is not precise enough to decide the rounding,
+ * or if the result is subnormal, zero, or infinite. These (rare) cases have to
+ * be handled by the caller.
+ */
+static bool eisel_lemire(uint64_t w, int q, uint64_t* bits) {
+  #ifdef __SIZEOF_INT128__
+    using uint128_t = unsigned __int128;
+    if (w == 0 || q < -342 || q > 308) return false;
+    int lz = __builtin_clzll(w);
+    w <<= lz;
+    size_t idx = 2 * static_cast<size_t>(q + 342);
+    uint128_t product = static_cast<uint128_t>(w) * dt::read::pow5_128[idx];
+    uint64_t hi = static_cast<uint64_t>(product >> 64);
+    uint64_t lo = static_cast<uint64_t>(product);
+    // If the bits below the 55 bits of the result (53 bits of mantissa plus
+    // 2 bits for rounding) are all 1s, refine the product using the lower
+    // 64 bits of 5ᵠ.
+    if ((hi & 0x1FF) == 0x1FF) {
+      uint128_t product2 = static_cast<uint128_t>(w) * dt::read::pow5_128[idx + 1];
+      uint64_t hi2 = static_cast<uint64_t>(product2 >> 64);
+      lo += hi2;
+      if (hi2 > lo) hi++;
+    }
+    if (lo == ~uint64_t(0) && (q < -27 || q > 55)) return false;
+
+    int upperbit = static_cast<int>(hi >> 63);
+    int shift = upperbit + 9;
+    uint64_t mantissa = hi >> shift;
+    // floor(log2(10ᵠ)) == floor(q * 217706 / 2¹⁶)
+    int power2 = ((217706 * q) >> 16) + 63 + upperbit - lz + 1023;
+    if (power2 <= 0) return false;
+    // Exact halfway cases can only occur for small q; they are rounded to even
+    if (lo <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1 &&
+        (mantissa << shift) == hi) {
+      mantissa &= ~uint64_t(1);
+    }
+    mantissa += (mantissa & 1);
+    mantissa >>= 1;
+    if (mantissa >= (uint64_t(2) << 52)) {
+      mantissa = uint64_t(1) << 52;
+      power2++;
+    }
+    if (power2 >= 0x7FF) return false;
+    mantissa &= ~(uint64_t(1) << 52);
+    *bits = (static_cast<uint64_t>(power2) << 52) | mantissa;
+    return true;
+  #else
+    (void) w; (void) q; (void) bits;
+    return false;
+  #endif
+}
+
+
+/**
+ * Convert the decimal number `acc`·10ᵉ into the nearest double, if this can
+ * be done quickly. If `truncated` is true, then some of the trailing digits of
+ * the number were discarded, and the exact value lies somewhere between
+ * `acc`·10ᵉ and (`acc` + 1)·10ᵉ.
+ *
+ * When both `acc` and 10ᵉ are exactly representable as doubles, a single
+ * floating-point operation gives the correctly rounded result (the "Clinger's
+ * fast path"). Otherwise, the Eisel-Lemire algorithm is used.
+ */
+static bool fast_decimal_to_double(uint64_t acc, int e, bool truncated,
+                                   double* out)
+{
+  if (!truncated && acc <= (uint64_t(1) << 53) && e >= -22 && e <= 22) {
+    double d = static_cast<double>(acc);
+    *out = e < 0? d / EXACT_POW10[-e] : d * EXACT_POW10[e];
+    return true;
+  }
+  uint64_t bits, bits2;
+  if (!eisel_lemire(acc, e, &bits)) return false;
+  if (truncated) {
+    if (!eisel_lemire(acc + 1, e, &bits2) || bits != bits2) return false;
+  }
+  std::memcpy(out, &bits, sizeof(double));
+  return true;
+}
+
+
+/**
+ * Convert the decimal number given by the digits in `[start, end)` (which may
+ * include the decimal separator `dec`), multiplied by 10ᵉˣᵖ, into the nearest
+ * double. This is the exact, but slow path for the numbers that
+ * `fast_decimal_to_double()` cannot handle (usually those with more than 18
+ * significant digits whose value lies too close to the midpoint between two
+ * doubles).
+ *
+ * The digits are copied without the decimal separator, and with an explicit
+ * exponent, so that the result of `strtod()` (which is correctly rounded)
+ * does not depend on the current locale.
+ */
+static double slow_decimal_to_double(const char* start, const char* end,
+                                     char dec, int exp)
+{
+  std::string buf;
+  buf.reserve(static_cast<size_t>(end - start) + 8);
+  for (const char* p = start; p < end; ++p) {
+    if (*p == dec) exp -= static_cast<int>(end - p - 1);
+    else buf += *p;
+  }
+  buf += 'e';
+  buf += std::to_string(exp);
+  return std::strtod(buf.c_str(), nullptr);
+}
+
+
 /**
  * Parse "usual" double literals, in the form
  *
@@ -303,6 +453,10 @@ void parse_float32_hex(FreadTokenizer& ctx) {
  *
  * where `NNN`, `MMM`, `EEE` are one or more decimal digits, representing the
  * whole part, fractional part, and the exponent respectively.
+ *
+ * The parsed number is converted into a double with `fast_decimal_to_double()`
+ * and, in the rare cases when that function gives up, with
+ * `slow_decimal_to_double()`. Either way the result is correctly rounded.
  */
 void parse_float64_simple(FreadTokenizer& ctx) {
   constexpr int MAX_DIGITS = 18;
@@ -313,10 +467,13 @@ void parse_float64_simple(FreadTokenizer& ctx) {
   ch += (neg = *ch=='-') + (*ch=='+');
 
   const char* start = ch; // beginning of the number, without the initial sign
-  uint_fast64_t acc = 0;  // mantissa NNN.MMM as a single 64-bit integer NNNMMM
+  uint64_t acc = 0;       // mantissa NNN.MMM as a single 64-bit integer NNNMMM
   int_fast32_t e = 0;     // the number's exponent. The value being parsed is
                           // equal to acc·10ᵉ
   uint_fast8_t digit;     // temporary variable, holds last scanned digit.
+  bool truncated = false; // were any digits beyond MAX_DIGITS discarded?
+  const char* mend;       // end of the mantissa NNN.MMM
+  int_fast32_t exp = 0;   // the explicit exponent EEE
 
   // Skip leading zeros
   while (*ch == '0') ch++;
@@ -340,6 +497,7 @@ void parse_float64_simple(FreadTokenizer& ctx) {
       e++;
     }
     if (*ch != ctx.dec) goto fail;
+    truncated = true;
   }
 
   // Read the fractional part of the number, if it's present
@@ -353,19 +511,17 @@ void parse_float64_simple(FreadTokenizer& ctx) {
       ch += k;
       e = -k;
     }
-    // Now read the significant digits in the fractional part of the number
-    int_fast32_t k = 0;
-    while ((digit = static_cast<uint_fast8_t>(ch[k] - '0')) < 10 && sflimit) {
-      acc = 10*acc + digit;
-      k++;
-      sflimit--;
-    }
+    // Now read the significant digits in the fractional part of the number.
+    // The fractional part is often long, so it is read 8 digits at a time.
+    int k = read_digits(ch, ctx.eof, acc, static_cast<int>(sflimit));
     ch += k;
     e -= k;
+    sflimit -= k;
     // If more digits are present, skip them
     if (sflimit == 0 && static_cast<uint_fast8_t>(*ch - '0') < 10) {
       ch++;
       while (static_cast<uint_fast8_t>(*ch - '0') < 10) ch++;
+      truncated = true;
     }
     // Check that at least 1 digit was present either in the integer or
     // fractional part ("+1" here accounts for the decimal point symbol).
@@ -378,9 +534,10 @@ void parse_float64_simple(FreadTokenizer& ctx) {
   }
 
   // Now scan the "exponent" part of the number (if present)
+  mend = ch;
   if (*ch == 'E' || *ch == 'e') {
     ch += 1/*E*/ + (Eneg = (ch[1]=='-')) + (ch[1]=='+');
-    int_fast32_t exp = 0;
+    exp = 0;
     if ((digit = static_cast<uint_fast8_t>(*ch - '0')) < 10) {
       exp = digit;
       ch++;
@@ -395,12 +552,14 @@ void parse_float64_simple(FreadTokenizer& ctx) {
     } else {
       goto fail;
     }
-    e += Eneg? -exp : exp;
+    if (Eneg) exp = -exp;
+    e += exp;
   }
-  e += 350; // lookup table is arranged from -350 (0) to +350 (700)
-  if (e < 0 || e > 700) goto fail;
+  if (e < -350 || e > 350) goto fail;
 
-  r = static_cast<double>(static_cast<long double>(acc) * dt::read::pow10lookup[e]);
+  if (!fast_decimal_to_double(acc, static_cast<int>(e), truncated, &r)) {
+    r = slow_decimal_to_double(start, mend, ctx.dec, static_cast<int>(exp));
+  }
   ctx.target->float64 = neg? -r : r;
   ctx.ch = ch;
   return;
@@ -580,15 +739,14 @@ void parse_string(FreadTokenizer& ctx) {
     // If field contains sep|eol then it should have been quoted and we do not
     // try to heal that.
     while (1) {
+      ch = dt::read::find_structural<true>(ch, ctx.eof, sep, sep);
       if (*ch == sep) break;
-      if (static_cast<uint8_t>(*ch) <= 13) {
-        if (*ch == '\n' || ch == ctx.eof) break;
-        if (*ch == '\r') {
-          if (ctx.cr_is_newline || ch[1] == '\n') break;
-          const char *tch = ch + 1;
-          while (*tch == '\r') tch++;
-          if (*tch == '\n') break;
-        }
+      if (*ch == '\n' || ch == ctx.eof) break;
+      if (*ch == '\r') {
+        if (ctx.cr_is_newline || ch[1] == '\n') break;
+        const char *tch = ch + 1;
+        while (*tch == '\r') tch++;
+        if (*tch == '\n') break;
       }
       ch++;  // sep, \r, \n or \0 will end
     }
@@ -615,19 +773,16 @@ void parse_string(FreadTokenizer& ctx) {
   switch(ctx.quoteRule) {
   case 0:  // quoted with embedded quotes doubled; the final unescaped " must be followed by sep|eol
     while (true) {
-      ch++;
-      if (*ch == '\0' && ch == ctx.eof) {
-        break;
-      } else if (*ch == quote) {
-        if (ch[1] == quote) { ch++; continue; }
-        break;  // found undoubled closing quote
-      }
+      ch = dt::read::find_structural<false>(ch + 1, ctx.eof, quote, quote);
+      if (ch == ctx.eof) break;
+      if (ch[1] == quote) { ch++; continue; }
+      break;  // found undoubled closing quote
     }
     break;
   case 1:  // quoted with embedded quotes escaped; the final unescaped " must be followed by sep|eol
     while (true) {
-      ch++;
-      if (*ch == '\0' && ch == ctx.eof) break;
+      ch = dt::read::find_structural<false>(ch + 1, ctx.eof, quote, '\\');
+      if (ch == ctx.eof) break;
       if (*ch=='\\' && (ch[1]==quote || ch[1]=='\\')) { ch++; continue; }
       if (*ch==quote) break;
     }
@@ -698,6 +853,48 @@ void parse_string(FreadTokenizer& ctx) {
 
 
 
+//------------------------------------------------------------------------------
+// Date / time
+//------------------------------------------------------------------------------
+
+// ISO-8601 dates "YYYY-MM-DD", timestamps "YYYY-MM-DD[T ]hh:mm[:ss[.f]][Z]"
+// and times "hh:mm[:ss[.f]]". The fixed-width parts of each value are
+// validated 8 characters at a time (see "utils/datetime.cc"), so that a
+// column that is not temporal is rejected after a single check of its first
+// value. A space between the date and the time is only allowed when the
+// space is not the field separator.
+
+void parse_date32_iso(FreadTokenizer& ctx) {
+  const char* ch = ctx.ch;
+  if (dt::parse_date32(ch, ctx.eof, &ctx.target->int32)) {
+    ctx.ch = ch;
+  } else {
+    ctx.target->int32 = NA_INT32;
+  }
+}
+
+
+void parse_date64_iso(FreadTokenizer& ctx) {
+  const char* ch = ctx.ch;
+  if (dt::parse_date64(ch, ctx.eof, &ctx.target->int64, ctx.sep != ' ')) {
+    ctx.ch = ch;
+  } else {
+    ctx.target->int64 = NA_INT64;
+  }
+}
+
+
+void parse_time32_iso(FreadTokenizer& ctx) {
+  const char* ch = ctx.ch;
+  if (dt::parse_time32(ch, ctx.eof, &ctx.target->int32)) {
+    ctx.ch = ch;
+  } else {
+    ctx.target->int32 = NA_INT32;
+  }
+}
+
+
+
 //------------------------------------------------------------------------------
 // ParserLibrary
 //------------------------------------------------------------------------------
@@ -728,10 +925,14 @@ void ParserLibrary::init_parsers() {
   add(PT::Int32Sep,     "Int32/grouped",   'i', 4, SType::INT32,   parse_intNN_grouped<int32_t>);
   add(PT::Int64,        "Int64",           'I', 8, SType::INT64,   parse_int_simple<int64_t, true>);
   add(PT::Int64Sep,     "Int64/grouped",   'I', 8, SType::INT64,   parse_intNN_grouped<int64_t>);
+  add(PT::Dec64,        "Dec64",           'n', 8, SType::DEC64,   parse_dec64);
   add(PT::Float32Hex,   "Float32/hex",     'f', 4, SType::FLOAT32, parse_float32_hex);
   add(PT::Float64Plain, "Float64",         'F', 8, SType::FLOAT64, parse_float64_simple);
   add(PT::Float64Ext,   "Float64/ext",     'F', 8, SType::FLOAT64, parse_float64_extended);
   add(PT::Float64Hex,   "Float64/hex",     'F', 8, SType::FLOAT64, parse_float64_hex);
+  add(PT::Date32,       "Date32/iso",      'd', 4, SType::DATE32,  parse_date32_iso);
+  add(PT::Date64,       "Date64/iso",      'D', 8, SType::DATE64,  parse_date64_iso);
+  add(PT::Time32,       "Time32/iso",      't', 4, SType::TIME32,  parse_time32_iso);
   add(PT::Str32,        "Str32",           's', 4, SType::STR32,   parse_string);
   add(PT::Str64,        "Str64",           'S', 8, SType::STR64,   parse_string);
 }
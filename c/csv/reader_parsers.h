@@ -35,10 +35,14 @@ void parse_bool8_lowercase(dt::read::FreadTokenizer&);
 void parse_bool8_titlecase(dt::read::FreadTokenizer&);
 void parse_int32_simple(dt::read::FreadTokenizer&);
 void parse_int64_simple(dt::read::FreadTokenizer&);
+void parse_dec64(dt::read::FreadTokenizer&);
 void parse_float32_hex(dt::read::FreadTokenizer&);
 void parse_float64_simple(dt::read::FreadTokenizer& ctx);
 void parse_float64_extended(dt::read::FreadTokenizer& ctx);
 void parse_float64_hex(dt::read::FreadTokenizer&);
+void parse_date32_iso(dt::read::FreadTokenizer&);
+void parse_date64_iso(dt::read::FreadTokenizer&);
+void parse_time32_iso(dt::read::FreadTokenizer&);
 void parse_string(dt::read::FreadTokenizer&);
 
 
@@ -60,11 +64,15 @@ enum PT : uint8_t {
   Int32Sep,
   Int64,
   Int64Sep,
+  Dec64,
   // Float32Plain,
   Float32Hex,
   Float64Plain,
   Float64Ext,
   Float64Hex,
+  Date32,
+  Date64,
+  Time32,
   Str32,
   Str64,
 };
@@ -106,9 +114,23 @@ enum RT : uint8_t {
   RStr     = 9,
   RStr32   = 10,
   RStr64   = 11,
+  RDate32  = 12,
+  RDate64  = 13,
+  RTime32  = 14,
+  RDec64   = 15,
 };
 
 
+/**
+ * The Dec64 parser stores each value together with its own scale, as
+ * `value * 32 + scale` (the value has at most 17 digits, so this fits into
+ * int64). Once all the values are read, they are brought to a common scale
+ * by `GenericReader::make_decimal_column()`.
+ */
+constexpr int DEC64_SCALE_BITS = 5;
+constexpr int64_t DEC64_SCALE_MASK = (1 << DEC64_SCALE_BITS) - 1;
+
+
 
 //------------------------------------------------------------------------------
 // ParserInfo
@@ -5,6 +5,7 @@
 //
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
+#include <memory>       // std::unique_ptr
 #include <new>          // placement new
 #include <stdexcept>    // std::runtime_error
 #include <math.h>
@@ -14,6 +15,8 @@
 #include "csv/writer.h"
 #include "parallel/api.h"
 #include "utils/alloc.h"
+#include "utils/datetime.h"
+#include "utils/decimal.h"
 #include "utils/misc.h"
 #include "column.h"
 #include "datatable.h"
@@ -37,11 +40,16 @@ class CsvColumn {
 public:
   const void* data;
   const char* strbuf;
+  size_t width;  // for fstr columns only
+  int scale;     // for decimal columns only
+  int : 32;
   writer_fn writer;
+  std::unique_ptr<CsvColumn> levels;  // for categorical columns only
 
   explicit CsvColumn(Column* col) {
     data = col->data();
     strbuf = nullptr;
+    width = 0;
     writer = writers_per_stype[static_cast<int>(col->stype())];
     if (!writer) {
       throw ValueError() << "Cannot write type " << col->stype();
@@ -54,6 +62,15 @@ public:
       strbuf = static_cast<StringColumn<uint64_t>*>(col)->strdata();
       data = static_cast<StringColumn<uint64_t>*>(col)->offsets();
     }
+    else if (col->stype() == SType::FSTR) {
+      width = fstr_width(col);
+    }
+    else if (is_categorical(col->stype())) {
+      levels.reset(new CsvColumn(categorical_levels(col).get()));
+    }
+    else if (is_decimal(col->stype())) {
+      scale = decimal_scale(col);
+    }
     TRACK(this, sizeof(*this), "write::CsvColumn");
   }
 
@@ -97,22 +114,46 @@ void write_iN(char** pch, CsvColumn* col, size_t row) {
 }
 
 
+// Dates and times are written in ISO-8601 format
+static void write_date32(char** pch, CsvColumn* col, size_t row) {
+  int32_t value = static_cast<const int32_t*>(col->data)[row];
+  if (ISNA<int32_t>(value)) return;
+  *pch = dt::format_date32(*pch, value);
+}
+
+static void write_date64(char** pch, CsvColumn* col, size_t row) {
+  int64_t value = static_cast<const int64_t*>(col->data)[row];
+  if (ISNA<int64_t>(value)) return;
+  *pch = dt::format_date64(*pch, value);
+}
+
+static void write_time32(char** pch, CsvColumn* col, size_t row) {
+  int32_t value = static_cast<const int32_t*>(col->data)[row];
+  if (ISNA<int32_t>(value)) return;
+  *pch = dt::format_time32(*pch, value);
+}
+
+
+// Decimals are written with exactly `scale` digits after the decimal point
 template <typename T>
-void write_str(char** pch, CsvColumn* col, size_t row)
+void write_dec(char** pch, CsvColumn* col, size_t row) {
+  T value = static_cast<const T*>(col->data)[row];
+  if (ISNA<T>(value)) return;
+  *pch = dt::format_decimal(*pch, static_cast<int64_t>(value), col->scale);
+}
+
+
+// Write a non-NA string value, quoting it if necessary.
+static inline void write_strval(char** pch, const uint8_t* strstart,
+                                const uint8_t* strend)
 {
-  T offset1 = (static_cast<const T*>(col->data))[row];
-  T offset0 = (static_cast<const T*>(col->data))[row - 1] & ~GETNA<T>();
   char *ch = *pch;
-
-  if (ISNA<T>(offset1)) return;
-  if (offset0 == offset1) {
+  if (strstart == strend) {
     ch[0] = '"';
     ch[1] = '"';
     *pch = ch + 2;
     return;
   }
-  const uint8_t* strstart = reinterpret_cast<const uint8_t*>(col->strbuf) + offset0;
-  const uint8_t* strend = reinterpret_cast<const uint8_t*>(col->strbuf) + offset1;
   const uint8_t* sch = strstart;
   if (*sch == 32) goto quote;
   while (sch < strend) {  // ',' is 44, '"' is 34
@@ -138,6 +179,63 @@ void write_str(char** pch, CsvColumn* col, size_t row)
 }
 
 
+template <typename T>
+void write_str(char** pch, CsvColumn* col, size_t row)
+{
+  T offset1 = (static_cast<const T*>(col->data))[row];
+  T offset0 = (static_cast<const T*>(col->data))[row - 1] & ~GETNA<T>();
+  if (ISNA<T>(offset1)) return;
+  const uint8_t* strbuf = reinterpret_cast<const uint8_t*>(col->strbuf);
+  write_strval(pch, strbuf + offset0, strbuf + offset1);
+}
+
+
+// Fixed-width strings are written without their trailing \0 padding.
+void write_fstr(char** pch, CsvColumn* col, size_t row)
+{
+  size_t width = col->width;
+  const uint8_t* strstart =
+      static_cast<const uint8_t*>(col->data) + row * width;
+  if (strstart[0] == FixedStringColumn::NA_BYTE) return;
+  const uint8_t* strend = strstart + width;
+  while (strend > strstart && strend[-1] == 0) strend--;
+  write_strval(pch, strstart, strend);
+}
+
+
+// Categorical values are written as their level strings.
+template <typename T>
+void write_cat(char** pch, CsvColumn* col, size_t row)
+{
+  T code = static_cast<const T*>(col->data)[row];
+  if (ISNA<T>(code)) return;
+  col->levels->write(pch, static_cast<size_t>(code));
+}
+
+
+// Upper bound on the size of any level of a categorical column, when written
+// out (all characters escaped, plus the quotes).
+template <typename T>
+static size_t max_strsize(const Column* col) {
+  auto scol = static_cast<const StringColumn<T>*>(col);
+  const T* offsets = scol->offsets();
+  size_t maxsize = 0;
+  for (size_t i = 0; i < col->nrows; ++i) {
+    size_t len = static_cast<size_t>(
+        (offsets[i] - offsets[i - 1]) & ~GETNA<T>());
+    if (len > maxsize) maxsize = len;
+  }
+  return maxsize;
+}
+
+static size_t max_level_size(const Column* col) {
+  const Column* lcol = categorical_levels(col).get();
+  size_t maxsize = lcol->stype() == SType::STR32? max_strsize<uint32_t>(lcol)
+                                                : max_strsize<uint64_t>(lcol);
+  return 2 * maxsize + 2;
+}
+
+
 static char hexdigits16[] = {'0', '1', '2', '3', '4', '5', '6', '7',
                            '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
 static void write_f8_hex(char** pch, CsvColumn* col, size_t row)
@@ -292,11 +390,22 @@ CsvWriter::CsvWriter(DataTable *dt_, const std::string& path_)
     nthreads(1),
     usehex(false),
     wb(nullptr),
+    compressor(nullptr),
     fixed_size_per_row(0),
     t_last(0)
 {}
 
 
+/**
+ * Compress the output with the given `method` ("gzip" or "zstd"). Each chunk
+ * of the output is compressed by the thread that has produced it, so that the
+ * compression runs in parallel too.
+ */
+void CsvWriter::set_compression(const std::string& method) {
+  compressor = Compressor::make(method);
+}
+
+
 CsvWriter::~CsvWriter()
 {
   for (size_t i = 0; i < columns.size(); i++)
@@ -329,6 +438,9 @@ void CsvWriter::write()
   create_column_writers(ncols);
   nstrcols32 = strcolumns32.size();
   nstrcols64 = strcolumns64.size();
+  if (compressor) {
+    log() << "Each chunk will be compressed with " << compressor->name();
+  }
 
   // Start writing the CSV
   dt::parallel_for_ordered(
@@ -343,6 +455,8 @@ void CsvWriter::write()
       }
       // Initialize thread-local variables
       dt::array<char> thbuf(bytes_per_chunk * 2);
+      dt::array<char> thzbuf;
+      const char* th_output = nullptr;
       size_t th_write_at = 0;
       size_t th_write_size = 0;
       std::vector<size_t> js(rcs.size());
@@ -396,14 +510,24 @@ void CsvWriter::write()
             }
           }
           th_write_size = static_cast<size_t>(thch - thbuf.data());
+          th_output = thbuf.data();
+
+          // Compress the chunk into a standalone gzip member / zstd frame
+          if (compressor) {
+            size_t zsize = compressor->max_compressed_size(th_write_size);
+            thzbuf.ensuresize(zsize);
+            th_write_size = compressor->compress(th_output, th_write_size,
+                                                 thzbuf.data(), zsize);
+            th_output = thzbuf.data();
+          }
         }, // end of pre-ordered
 
         [&](size_t) {  // ordered
-          th_write_at = wb->prep_write(th_write_size, thbuf.data());
+          th_write_at = wb->prep_write(th_write_size, th_output);
         },
 
         [&](size_t) {  // post-ordered
-          wb->write_at(th_write_at, th_write_size, thbuf.data());
+          wb->write_at(th_write_at, th_write_size, th_output);
           th_write_size = 0;
         }
       );
@@ -413,9 +537,10 @@ void CsvWriter::write()
   t_write_data = checkpoint();
 
   // Done writing; if writing to stdout then append '\0' to make it a regular
-  // C string; otherwise truncate WritableBuffer to the final size.
+  // C string (unless the output is compressed); otherwise truncate
+  // WritableBuffer to the final size.
   log() << "Finalizing output at size " << filesize_to_str(wb->size());
-  if (path.empty()) {
+  if (path.empty() && !compressor) {
     char c = '\0';
     wb->write(1, &c);
   }
@@ -474,6 +599,13 @@ size_t CsvWriter::estimate_output_size()
     }
     SType stype = col->stype();
     fixed_size_per_row += bytes_per_stype[static_cast<int>(stype)];
+    if (is_categorical(stype)) {
+      fixed_size_per_row += max_level_size(col);
+    }
+    if (stype == SType::FSTR) {
+      // All characters escaped, plus the quotes
+      fixed_size_per_row += 2 * fstr_width(col) + 2;
+    }
     total_columns_size += column_names[i].size() + 1;
   }
   size_t bytes_total = fixed_size_per_row * nrows
@@ -519,13 +651,30 @@ void CsvWriter::write_column_names()
     ch[-1] = '\n';
 
     // Write this string buffer into the target.
-    wb->write(static_cast<size_t>(ch - ch0), ch0);
+    write_block(static_cast<size_t>(ch - ch0), ch0);
     delete[] ch0;
     UNTRACK(ch0);
   }
 }
 
 
+/**
+ * Write `n` bytes of `data` into the output from a single thread,
+ * compressing them first if necessary.
+ */
+void CsvWriter::write_block(size_t n, const char* data)
+{
+  if (compressor) {
+    size_t zsize = compressor->max_compressed_size(n);
+    dt::array<char> zbuf(zsize);
+    zsize = compressor->compress(data, n, zbuf.data(), zsize);
+    wb->write(zsize, zbuf.data());
+  } else {
+    wb->write(n, data);
+  }
+}
+
+
 /**
  * Compute parameters for writing the file: how many chunks to use, how many
  * rows per chunk, etc.
@@ -619,6 +768,12 @@ void init_csvwrite_constants() {
   bytes_per_stype[int(SType::FLOAT64)] = 25; // -1.1234567890123457e+307, -0x1.23456789ABCDEp+1022
   bytes_per_stype[int(SType::STR32)]   = 2;  // ""
   bytes_per_stype[int(SType::STR64)]   = 2;  // ""
+  bytes_per_stype[int(SType::DATE64)]  = dt::DATE64_MAXLEN;
+  bytes_per_stype[int(SType::TIME32)]  = dt::TIME32_MAXLEN;
+  bytes_per_stype[int(SType::DATE32)]  = dt::DATE32_MAXLEN;
+  bytes_per_stype[int(SType::DEC16)]   = dt::DECIMAL_MAXLEN;
+  bytes_per_stype[int(SType::DEC32)]   = dt::DECIMAL_MAXLEN;
+  bytes_per_stype[int(SType::DEC64)]   = dt::DECIMAL_MAXLEN;
 
   writers_per_stype[int(SType::BOOL)]    = write_b1;
   writers_per_stype[int(SType::INT8)]    = write_iN<int8_t>;
@@ -629,4 +784,14 @@ void init_csvwrite_constants() {
   writers_per_stype[int(SType::FLOAT64)] = write_f8_dec;
   writers_per_stype[int(SType::STR32)]   = write_str<uint32_t>;
   writers_per_stype[int(SType::STR64)]   = write_str<uint64_t>;
+  writers_per_stype[int(SType::FSTR)]    = write_fstr;
+  writers_per_stype[int(SType::CAT8)]    = write_cat<uint8_t>;
+  writers_per_stype[int(SType::CAT16)]   = write_cat<uint16_t>;
+  writers_per_stype[int(SType::CAT32)]   = write_cat<uint32_t>;
+  writers_per_stype[int(SType::DATE64)]  = write_date64;
+  writers_per_stype[int(SType::TIME32)]  = write_time32;
+  writers_per_stype[int(SType::DATE32)]  = write_date32;
+  writers_per_stype[int(SType::DEC16)]   = write_dec<int16_t>;
+  writers_per_stype[int(SType::DEC32)]   = write_dec<int32_t>;
+  writers_per_stype[int(SType::DEC64)]   = write_dec<int64_t>;
 }
@@ -10,6 +10,7 @@
 #include <iomanip>
 #include <string>
 #include <vector>
+#include "utils/compress.h"
 #include "python/obj.h"
 #include "python/string.h"
 #include "utils/logger.h"
@@ -33,6 +34,7 @@ class CsvWriter {
 
   // Runtime values used while writing the file
   std::unique_ptr<WritableBuffer> wb;
+  std::unique_ptr<Compressor> compressor;
   size_t fixed_size_per_row;
   double rows_per_chunk;
   size_t bytes_per_chunk;
@@ -55,6 +57,7 @@ public:
   void set_nthreads(size_t n) { nthreads = n; }
   void set_usehex(bool v) { usehex = v; }
   void set_strategy(WritableBuffer::Strategy s) { strategy = s; }
+  void set_compression(const std::string& method);
 
   void write();
   WritableBuffer* get_output_buffer() { return wb.release(); }
@@ -64,6 +67,7 @@ private:
   size_t estimate_output_size();
   void create_target(size_t size);
   void write_column_names();
+  void write_block(size_t n, const char* data);
   void determine_chunking_strategy(size_t size, size_t nrows);
   void create_column_writers(size_t ncols);
   LogMessage log() const;
@@ -35,6 +35,24 @@ struct sort_spec {
     : col_index(i), descending(desc), na_last(nalast), sort_only(sort) {}
 };
 
+/**
+ * Parameters for saving a DataTable into Jay format:
+ *   - `compression`: the codec used for the column blocks, either "lz4" or
+ *     "zstd". If empty, the data is stored uncompressed;
+ *   - `rowgroup_size`: the number of rows in each row group. Each column is
+ *     stored as a sequence of blocks, one per row group, and each block
+ *     carries its own min/max/nullcount stats;
+ *   - `append`: add the rows to an existing Jay file, as new row groups
+ *     written after the existing data.
+ */
+struct JayOptions {
+  static constexpr size_t DEFAULT_ROWGROUP_SIZE = 1 << 16;
+  std::string compression;
+  size_t rowgroup_size = DEFAULT_ROWGROUP_SIZE;
+  bool append = false;
+  size_t : 56;
+};
+
 struct RowColIndex {
   RowIndex rowindex;
   std::vector<size_t> colindices;
@@ -118,6 +136,21 @@ class DataTable {
     std::pair<RowIndex, Groupby>
     group(const std::vector<sort_spec>& spec, bool as_view = false) const;
 
+    /**
+     * Group the DataTable by the specified columns using hash tables instead
+     * of a full radix sort. The resulting RowIndex+Groupby are the same as
+     * those returned by `group()`, but only the distinct keys get sorted.
+     * The `spec` may not contain any `sort_only` entries.
+     *
+     * `prefers_hash_grouping()` returns true if `group_hashed()` supports
+     * the given `spec`, and the number of groups (estimated from the stats
+     * that were already computed) is small enough for hashing to be faster
+     * than sorting.
+     */
+    std::pair<RowIndex, Groupby>
+    group_hashed(const std::vector<sort_spec>& spec) const;
+    bool prefers_hash_grouping(const std::vector<sort_spec>& spec) const;
+
     // Names
     const strvec& get_names() const;
     py::otuple get_pynames() const;
@@ -141,8 +174,9 @@ class DataTable {
     static DataTable* load(DataTable* schema, size_t nrows,
                            const std::string& path, bool recode);
 
-    MemoryRange save_jay();
-    void save_jay(const std::string& path, WritableBuffer::Strategy);
+    MemoryRange save_jay(const JayOptions& = JayOptions());
+    void save_jay(const std::string& path, WritableBuffer::Strategy,
+                  const JayOptions& = JayOptions());
 
     std::vector<RowColIndex> split_columns_by_rowindices() const;
 
@@ -172,7 +206,8 @@ class DataTable {
     void _integrity_check_pynames() const;
 
     DataTable* _statdt(colmakerfn f) const;
-    void save_jay_impl(WritableBuffer*);
+    void save_jay_impl(WritableBuffer*, const JayOptions&);
+    void append_jay_impl(const std::string& path, const JayOptions&);
 
     #ifdef DTTEST
       friend void dttest::cover_names_integrity_checks();
@@ -183,10 +218,21 @@ class DataTable {
 DataTable* open_jay_from_file(const std::string& path);
 DataTable* open_jay_from_bytes(const char* ptr, size_t len);
 DataTable* open_jay_from_mbuf(const MemoryRange&);
+namespace jay { struct Frame; }
+const jay::Frame* read_jay_meta(const MemoryRange&, size_t* meta_offset);
 
 DataTable* apply_rowindex(const DataTable*, const RowIndex& ri);
 
-RowIndex natural_join(const DataTable* xdt, const DataTable* jdt);
+enum class JoinType : uint8_t {
+  INNER = 0,
+  LEFT  = 1,
+  RIGHT = 2,
+  OUTER = 3
+};
+
+std::pair<RowIndex, RowIndex> hash_join(
+    const DataTable* xdt, const DataTable* jdt,
+    const intvec& xcols, const intvec& jcols, JoinType how);
 
 
 //==============================================================================
@@ -14,6 +14,7 @@
 #include <utility>         // std::pair, std::make_pair, std::move
 #include <Python.h>
 #include "../datatable/include/datatable.h"
+#include "csv/py_csv.h"
 #include "csv/reader.h"
 #include "expr/base_expr.h"
 #include "expr/by_node.h"
@@ -28,8 +29,11 @@
 #include "parallel/thread_pool.h"
 #include "python/_all.h"
 #include "python/string.h"
+#include "utils/cpu.h"
 #include "utils/assert.h"
+#include "codec.h"
 #include "datatablemodule.h"
+#include "mmm.h"
 #include "options.h"
 #include "sort.h"
 #include "py_encodings.h"
@@ -80,6 +84,23 @@ static py::oobj frame_column_rowindex(const py::PKArgs& args) {
 }
 
 
+static py::PKArgs args_frame_column_encoding(
+    2, 0, 0, false, false, {"frame", "i"},
+    "frame_column_encoding",
+R"(frame_column_encoding(frame, i)
+--
+
+Return the name of the encoding of the compressed column `frame[i]` ("for",
+"rle" or "dict"), or None if that column is not compressed.
+)");
+
+static py::oobj frame_column_encoding(const py::PKArgs& args) {
+  auto u = _unpack_frame_column_args(args);
+  auto codec = u.first->columns[u.second]->get_codec();
+  return codec? py::ostring(dt::encoding_name(codec->kind())) : py::None();
+}
+
+
 static py::PKArgs args_frame_column_data_r(
     2, 0, 0, false, false, {"frame", "i"},
     "frame_column_data_r",
@@ -136,6 +157,22 @@ static py::oobj in_debug_mode(const py::PKArgs&) {
 
 
 
+static py::PKArgs args_mmap_resident_size(
+    0, 0, 0, false, false, {}, "mmap_resident_size",
+R"(mmap_resident_size()
+--
+
+Return the total size (in bytes) of the memory-mapped column data that is
+currently considered resident in memory, for the purposes of the option
+`memory.mmap_budget`. This is always 0 when the budget is not set.
+)");
+
+static py::oobj mmap_resident_size(const py::PKArgs&) {
+  return py::oint(MemoryMapManager::get()->get_resident_size());
+}
+
+
+
 static py::PKArgs args_get_thread_ids(
     0, 0, 0, false, false, {}, "get_thread_ids",
 R"(Return system ids of all threads used internally by datatable)");
@@ -224,6 +261,9 @@ static void initialize_options(const py::PKArgs& args) {
   py::Frame::init_names_options();
   GenericReader::init_options();
   sort_init_options();
+  groupby_hash_init_options();
+  dt::cpu_init_options();
+  mmm_init_options();
 }
 
 
@@ -305,13 +345,16 @@ void py::DatatableModule::init_methods() {
   ADD_FN(&_register_function, args__register_function);
   ADD_FN(&in_debug_mode, args_in_debug_mode);
   ADD_FN(&frame_column_rowindex, args_frame_column_rowindex);
+  ADD_FN(&frame_column_encoding, args_frame_column_encoding);
   ADD_FN(&frame_column_data_r, args_frame_column_data_r);
   ADD_FN(&_column_save_to_disk, args__column_save_to_disk);
   ADD_FN(&frame_integrity_check, args_frame_integrity_check);
   ADD_FN(&get_thread_ids, args_get_thread_ids);
+  ADD_FN(&mmap_resident_size, args_mmap_resident_size);
   ADD_FN(&initialize_options, args_initialize_options);
 
   init_methods_aggregate();
+  init_methods_arrow();
   init_methods_buffers();
   init_methods_cbind();
   init_methods_csv();
@@ -355,6 +398,7 @@ PyMODINIT_FUNC PyInit__datatable() noexcept
 
     py::Frame::Type::init(m);
     py::Ftrl::Type::init(m);
+    py::ChunkedReader::Type::init(m);
     py::base_expr::Type::init(m);
     py::config_option::Type::init(m);
     py::orowindex::pyobject::Type::init(m);
@@ -19,8 +19,11 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 //------------------------------------------------------------------------------
+#include <cstring>            // std::memcpy
 #include <memory>             // std::unique_ptr
 #include <stdlib.h>
+#include "blockindex.h"
+#include "codec.h"
 #include "datatable.h"
 #include "datatablemodule.h"
 #include "expr/base_expr.h"
@@ -43,6 +46,11 @@ base_expr::~base_expr() {
   UNTRACK(this);
 }
 
+bool base_expr::prune_blocks(const workframe&, const BlockIndex&,
+                             std::vector<int8_t>&) {
+  return false;
+}
+
 bool base_expr::is_column_expr() const { return false; }
 
 bool base_expr::is_negated_expr() const { return false; }
@@ -51,6 +59,15 @@ pexpr base_expr::get_negated_expr() { return pexpr(); }
 
 size_t base_expr::get_col_index(const workframe&) { return size_t(-1); }
 
+SType base_expr::prepare_fused(fused_plan&, workframe&) {
+  return SType::VOID;
+}
+
+const void* base_expr::evaluate_block(fused_context&, size_t, size_t, void*) {
+  xassert(false);  // should never be called if prepare_fused() failed
+  return nullptr;
+}
+
 
 
 //------------------------------------------------------------------------------
@@ -58,7 +75,9 @@ size_t base_expr::get_col_index(const workframe&) { return size_t(-1); }
 //------------------------------------------------------------------------------
 
 expr_column::expr_column(size_t dfid, const py::robj& col)
-  : frame_id(dfid), col_id(size_t(-1)), col_selector(col) {}
+  : frame_id(dfid), col_id(size_t(-1)), col_selector(col),
+    fused_data(nullptr), fused_codec(nullptr), fused_offset(0),
+    fused_elemsize(0), fused_stype(SType::VOID) {}
 
 
 size_t expr_column::get_frame_id() const noexcept {
@@ -127,6 +146,49 @@ colptr expr_column::evaluate_eager(workframe& wf) {
 }
 
 
+SType expr_column::prepare_fused(fused_plan& plan, workframe& wf) {
+  const DataTable* dt = wf.get_datatable(frame_id);
+  const Column* rcol = dt->columns[get_col_index(wf)];
+  SType stype = rcol->stype();
+  if (!is_fusable_stype(stype)) return SType::VOID;
+
+  const RowIndex& dt_ri = wf.get_rowindex(frame_id);
+  const RowIndex& col_ri = rcol->rowindex();
+  fused_ri = dt_ri? wf._product(dt_ri, col_ri) : col_ri;
+  if (!plan.set_nrows(fused_ri? fused_ri.size() : rcol->nrows)) {
+    return SType::VOID;
+  }
+  fused_stype = stype;
+  fused_elemsize = rcol->elemsize();
+  fused_offset = 0;
+  if (fused_ri && fused_ri.is_simple_slice()) {
+    // Contiguous range of rows: the data can be read directly.
+    fused_offset = fused_ri.slice_start();
+    fused_ri = RowIndex();
+  }
+  // A compressed column is decoded one block at a time, without
+  // decompressing the entire column.
+  fused_codec = fused_ri? nullptr : rcol->get_codec();
+  fused_data = fused_codec? nullptr
+      : static_cast<const char*>(rcol->data()) + fused_offset * fused_elemsize;
+  return stype;
+}
+
+
+const void* expr_column::evaluate_block(fused_context&, size_t row0, size_t n,
+                                        void* out)
+{
+  if (fused_codec) {
+    fused_codec->decode(fused_offset + row0, n, out);
+    return out;
+  }
+  if (fused_ri) {
+    return gather_block(fused_data, fused_stype, fused_ri, row0, n, out);
+  }
+  return static_cast<const char*>(fused_data) + row0 * fused_elemsize;
+}
+
+
 
 //------------------------------------------------------------------------------
 // expr_binaryop
@@ -152,13 +214,23 @@ static void init_binops() {
   constexpr SType int64 = SType::INT64;
   constexpr SType flt32 = SType::FLOAT32;
   constexpr SType flt64 = SType::FLOAT64;
+  constexpr SType dec16 = SType::DEC16;
+  constexpr SType dec32 = SType::DEC32;
+  constexpr SType dec64 = SType::DEC64;
   constexpr SType str32 = SType::STR32;
   constexpr SType str64 = SType::STR64;
+  constexpr SType fstr  = SType::FSTR;
+  constexpr SType cat8  = SType::CAT8;
+  constexpr SType cat16 = SType::CAT16;
+  constexpr SType cat32 = SType::CAT32;
+  constexpr SType dat64 = SType::DATE64;
+  constexpr SType tim32 = SType::TIME32;
+  constexpr SType dat32 = SType::DATE32;
 
   using styvec = std::vector<SType>;
   styvec integer_stypes = {int8, int16, int32, int64};
   styvec numeric_stypes = {bool8, int8, int16, int32, int64, flt32, flt64};
-  styvec string_types = {str32, str64};
+  styvec string_types = {str32, str64, fstr, cat8, cat16, cat32};
 
   for (SType st1 : numeric_stypes) {
     for (SType st2 : numeric_stypes) {
@@ -185,10 +257,52 @@ static void init_binops() {
       binop_rules[id(biop::RIGHT_SHIFT, st1, st2)] = stm;
     }
   }
+  // Strings are ordered byte-wise; categoricals are compared by their strings
   for (SType st1 : string_types) {
     for (SType st2 : string_types) {
       binop_rules[id(biop::REL_EQ, st1, st2)] = bool8;
       binop_rules[id(biop::REL_NE, st1, st2)] = bool8;
+      binop_rules[id(biop::REL_LT, st1, st2)] = bool8;
+      binop_rules[id(biop::REL_GT, st1, st2)] = bool8;
+      binop_rules[id(biop::REL_LE, st1, st2)] = bool8;
+      binop_rules[id(biop::REL_GE, st1, st2)] = bool8;
+    }
+  }
+  for (SType st : {dat64, tim32, dat32}) {
+    binop_rules[id(biop::MINUS, st, st)] = st == dat64? int64 : int32;
+    binop_rules[id(biop::REL_EQ, st, st)] = bool8;
+    binop_rules[id(biop::REL_NE, st, st)] = bool8;
+    binop_rules[id(biop::REL_LT, st, st)] = bool8;
+    binop_rules[id(biop::REL_GT, st, st)] = bool8;
+    binop_rules[id(biop::REL_LE, st, st)] = bool8;
+    binop_rules[id(biop::REL_GE, st, st)] = bool8;
+  }
+  for (SType st1 : {dat64, dat32}) {
+    for (SType st2 : {bool8, int8, int16, int32, int64}) {
+      binop_rules[id(biop::PLUS, st1, st2)] = st1;
+      binop_rules[id(biop::PLUS, st2, st1)] = st1;
+      binop_rules[id(biop::MINUS, st1, st2)] = st1;
+    }
+  }
+  // Decimals combined with integers or decimals stay exact (the result is
+  // DEC64), except for division. Combined with floats they become floats.
+  for (SType st1 : {dec16, dec32, dec64}) {
+    for (SType st2 : {bool8, int8, int16, int32, int64, flt32, flt64,
+                      dec16, dec32, dec64}) {
+      bool exact = !(st2 == flt32 || st2 == flt64);
+      for (auto op : {biop::PLUS, biop::MINUS, biop::MULTIPLY}) {
+        binop_rules[id(op, st1, st2)] = exact? dec64 : flt64;
+        binop_rules[id(op, st2, st1)] = exact? dec64 : flt64;
+      }
+      for (auto op : {biop::DIVIDE, biop::POWER}) {
+        binop_rules[id(op, st1, st2)] = flt64;
+        binop_rules[id(op, st2, st1)] = flt64;
+      }
+      for (auto op : {biop::REL_EQ, biop::REL_NE, biop::REL_LT,
+                      biop::REL_GT, biop::REL_LE, biop::REL_GE}) {
+        binop_rules[id(op, st1, st2)] = bool8;
+        binop_rules[id(op, st2, st1)] = bool8;
+      }
     }
   }
   binop_rules[id(biop::LOGICAL_AND, bool8, bool8)] = bool8;
@@ -220,23 +334,61 @@ class expr_binaryop : public base_expr {
     pexpr lhs;
     pexpr rhs;
     size_t binop_code;
+    expr::mapperfn fused_fn;
+    size_t lhs_slot;
+    size_t rhs_slot;
 
   public:
     expr_binaryop(size_t opcode, pexpr&& l, pexpr&& r);
     SType resolve(const workframe& wf) override;
     GroupbyMode get_groupby_mode(const workframe&) const override;
     colptr evaluate_eager(workframe& wf) override;
+    SType prepare_fused(fused_plan&, workframe&) override;
+    const void* evaluate_block(fused_context&, size_t, size_t, void*) override;
+    bool prune_blocks(const workframe&, const BlockIndex&,
+                      std::vector<int8_t>&) override;
+
+  private:
+    colptr evaluate_compressed(workframe& wf);
 };
 
 
 expr_binaryop::expr_binaryop(size_t opcode, pexpr&& l, pexpr&& r)
-  : lhs(std::move(l)), rhs(std::move(r)), binop_code(opcode) {}
+  : lhs(std::move(l)), rhs(std::move(r)), binop_code(opcode),
+    fused_fn(nullptr), lhs_slot(0), rhs_slot(0) {}
+
+
+// Columns of these stypes cannot be compared with booleans, however they
+// can be compared with `None` (which is a BOOL literal): `col == None`
+// is the same as `isna(col)`.
+static bool is_na_comparable(SType st) {
+  switch (st) {
+    case SType::STR32:
+    case SType::STR64:
+    case SType::FSTR:
+    case SType::CAT8:
+    case SType::CAT16:
+    case SType::CAT32:
+    case SType::DATE64:
+    case SType::TIME32:
+    case SType::DATE32: return true;
+    default:            return false;
+  }
+}
+
+static bool is_none_literal(const base_expr* e);
 
 
 SType expr_binaryop::resolve(const workframe& wf) {
   SType lhs_stype = lhs->resolve(wf);
   SType rhs_stype = rhs->resolve(wf);
   size_t triple = id(static_cast<biop>(binop_code), lhs_stype, rhs_stype);
+  auto op = static_cast<biop>(binop_code);
+  if ((op == biop::REL_EQ || op == biop::REL_NE) &&
+      ((is_na_comparable(lhs_stype) && is_none_literal(rhs.get())) ||
+       (is_na_comparable(rhs_stype) && is_none_literal(lhs.get())))) {
+    return SType::BOOL;
+  }
   if (binop_rules.count(triple) == 0) {
     throw TypeError() << "Binary operator `" << binop_names[binop_code]
         << "` cannot be applied to columns with stypes `" << lhs_stype
@@ -254,9 +406,48 @@ GroupbyMode expr_binaryop::get_groupby_mode(const workframe& wf) const {
 
 
 colptr expr_binaryop::evaluate_eager(workframe& wf) {
-  auto lhs_res = lhs->evaluate_eager(wf);
-  auto rhs_res = rhs->evaluate_eager(wf);
-  return colptr(expr::binaryop(binop_code, lhs_res.get(), rhs_res.get()));
+  colptr res = evaluate_compressed(wf);
+  if (!res) res = evaluate_fused(this, wf);
+  if (!res) {
+    auto lhs_res = lhs->evaluate_eager(wf);
+    auto rhs_res = rhs->evaluate_eager(wf);
+    res = colptr(expr::binaryop(binop_code, lhs_res.get(), rhs_res.get()));
+  }
+  // Relational operators always produce 0/1 values, never NAs
+  auto op = static_cast<biop>(binop_code);
+  if (op >= biop::REL_EQ && op <= biop::REL_LE) res->set_na_free();
+  return res;
+}
+
+
+SType expr_binaryop::prepare_fused(fused_plan& plan, workframe& wf) {
+  size_t mark = plan.nslots;
+  lhs_slot = plan.add_slot();
+  SType lhs_stype = lhs->prepare_fused(plan, wf);
+  if (lhs_stype == SType::VOID) return SType::VOID;
+  rhs_slot = plan.add_slot();
+  SType rhs_stype = rhs->prepare_fused(plan, wf);
+  if (rhs_stype == SType::VOID) return SType::VOID;
+  plan.release_slots(mark);
+
+  SType res_stype = SType::VOID;
+  fused_fn = expr::binaryop_mapper(binop_code, lhs_stype, rhs_stype,
+                                   &res_stype);
+  return fused_fn? res_stype : SType::VOID;
+}
+
+
+const void* expr_binaryop::evaluate_block(fused_context& ctx, size_t row0,
+                                          size_t n, void* out)
+{
+  void* params[3];
+  params[0] = const_cast<void*>(
+                lhs->evaluate_block(ctx, row0, n, ctx.buffer(lhs_slot)));
+  params[1] = const_cast<void*>(
+                rhs->evaluate_block(ctx, row0, n, ctx.buffer(rhs_slot)));
+  params[2] = out;
+  fused_fn(0, static_cast<int64_t>(n), params);
+  return out;
 }
 
 
@@ -268,12 +459,16 @@ colptr expr_binaryop::evaluate_eager(workframe& wf) {
 class expr_literal : public base_expr {
   private:
     colptr col;
+    std::unique_ptr<double[]> fused_values;
 
   public:
     explicit expr_literal(const py::robj&);
     SType resolve(const workframe&) override;
     GroupbyMode get_groupby_mode(const workframe&) const override;
     colptr evaluate_eager(workframe&) override;
+    SType prepare_fused(fused_plan&, workframe&) override;
+    const void* evaluate_block(fused_context&, size_t, size_t, void*) override;
+    const Column* get_column() const { return col.get(); }
 };
 
 
@@ -289,6 +484,14 @@ SType expr_literal::resolve(const workframe&) {
 }
 
 
+static bool is_none_literal(const base_expr* e) {
+  auto lit = dynamic_cast<const expr_literal*>(e);
+  if (!lit) return false;
+  const Column* col = lit->get_column();
+  return col->stype() == SType::BOOL && col->countna() == col->nrows;
+}
+
+
 GroupbyMode expr_literal::get_groupby_mode(const workframe&) const {
   return GroupbyMode::GtoONE;
 }
@@ -299,6 +502,227 @@ colptr expr_literal::evaluate_eager(workframe&) {
 }
 
 
+// In fused mode the literal is broadcast into a block of constant values,
+// which is shared (read-only) by all threads.
+SType expr_literal::prepare_fused(fused_plan&, workframe&) {
+  SType stype = col->stype();
+  if (!is_fusable_stype(stype)) return SType::VOID;
+  if (!fused_values) {
+    constexpr size_t n = fused_plan::BLOCK_SIZE;
+    size_t elemsize = col->elemsize();
+    fused_values.reset(new double[n]);
+    auto src = static_cast<const char*>(col->data());
+    auto dest = reinterpret_cast<char*>(fused_values.get());
+    for (size_t i = 0; i < n; ++i) {
+      std::memcpy(dest + i * elemsize, src, elemsize);
+    }
+  }
+  return stype;
+}
+
+
+const void* expr_literal::evaluate_block(fused_context&, size_t, size_t,
+                                         void*)
+{
+  return fused_values.get();
+}
+
+
+
+//------------------------------------------------------------------------------
+// Block pruning
+//------------------------------------------------------------------------------
+
+// Can a block whose non-NA values are within `[lo, hi]` contain values `x`
+// such that `x <op> v` is true? Comparisons with NAs are false, except for
+// the `!=` operator.
+template <typename V>
+static bool block_may_match(biop op, V lo, V hi, bool hasna, V v) {
+  switch (op) {
+    case biop::REL_EQ: return lo <= v && v <= hi;
+    case biop::REL_NE: return hasna || !(lo == v && hi == v);
+    case biop::REL_GT: return hi > v;
+    case biop::REL_LT: return lo < v;
+    case biop::REL_GE: return hi >= v;
+    case biop::REL_LE: return lo <= v;
+    default:           return true;
+  }
+}
+
+
+/**
+ * Extract the value of the numeric literal `lit`, both as an integer (if
+ * the literal is boolean or integer, in which case `*lit_int` is set) and
+ * as a double. Returns false if the literal is not numeric, or is NA.
+ */
+static bool literal_value(const Column* lit, bool* lit_int, int64_t* ival,
+                          double* fval)
+{
+  LType llt = lit->ltype();
+  *lit_int = (llt == LType::BOOL || llt == LType::INT);
+  if (!(*lit_int || llt == LType::REAL)) return false;
+  py::oobj value = lit->get_value_at_index(0);
+  if (value.is_none()) return false;
+
+  *ival = 0;
+  if (value.is_bool()) {
+    *ival = value.is_true();
+    *fval = static_cast<double>(*ival);
+  } else if (*lit_int) {
+    *ival = value.to_int64_strict();
+    *fval = static_cast<double>(*ival);
+  } else {
+    *fval = value.to_double();
+    if (ISNA<double>(*fval)) return false;
+  }
+  return true;
+}
+
+
+/**
+ * Clear in `mask` the blocks of column `col` where `col <op> lit` is false
+ * for all rows. The values are compared in the same domain as when the
+ * operator is evaluated: int64 if both operands are integer, float if the
+ * column is float32 and the literal is an integer, and double otherwise.
+ */
+static bool prune_comparison(biop op, const Column* col, const Column* lit,
+                             const BlockIndex& bi, std::vector<int8_t>& mask)
+{
+  SType cst = col->stype();
+  bool col_int = (cst == SType::BOOL || info(cst).ltype() == LType::INT);
+  if (!(col_int || info(cst).ltype() == LType::REAL)) return false;
+  bool lit_int;
+  int64_t ival;
+  double fval;
+  if (!literal_value(lit, &lit_int, &ival, &fval)) return false;
+
+  for (size_t i = 0; i < bi.nblocks(); ++i) {
+    const BlockIndex::Block& b = bi.block(i);
+    bool hasna = b.nullcount > 0;
+    bool ok;
+    if (!b.has_range) {
+      ok = (b.nullcount < b.nrows) || (op == biop::REL_NE && hasna);
+    } else if (col_int && lit_int) {
+      ok = block_may_match<int64_t>(op, b.imin, b.imax, hasna, ival);
+    } else if (cst == SType::FLOAT32 && lit_int) {
+      ok = block_may_match<float>(op, static_cast<float>(b.fmin),
+                                  static_cast<float>(b.fmax), hasna,
+                                  static_cast<float>(ival));
+    } else {
+      ok = block_may_match<double>(op, b.fmin, b.fmax, hasna, fval);
+    }
+    if (!ok) mask[i] = 0;
+  }
+  return true;
+}
+
+
+/**
+ * Represent the comparison `lhs <op> rhs` in the form `column <op> literal`,
+ * where the column belongs to the main frame. If the literal is on the left,
+ * the operator is flipped. Returns false if the operands are not of this
+ * form.
+ */
+static bool column_vs_literal(base_expr* lhs, base_expr* rhs, biop* op,
+                              expr_column** pcol, expr_literal** plit)
+{
+  if (!lhs->is_column_expr()) {
+    std::swap(lhs, rhs);
+    *op = (*op == biop::REL_GT)? biop::REL_LT :
+          (*op == biop::REL_LT)? biop::REL_GT :
+          (*op == biop::REL_GE)? biop::REL_LE :
+          (*op == biop::REL_LE)? biop::REL_GE : *op;
+  }
+  *pcol = dynamic_cast<expr_column*>(lhs);
+  *plit = dynamic_cast<expr_literal*>(rhs);
+  return *pcol && *plit && (*pcol)->get_frame_id() == 0;
+}
+
+
+bool expr_binaryop::prune_blocks(const workframe& wf, const BlockIndex& layout,
+                                 std::vector<int8_t>& mask)
+{
+  auto op = static_cast<biop>(binop_code);
+  if (op == biop::LOGICAL_AND) {
+    bool lres = lhs->prune_blocks(wf, layout, mask);
+    bool rres = rhs->prune_blocks(wf, layout, mask);
+    return lres || rres;
+  }
+  if (op == biop::LOGICAL_OR) {
+    std::vector<int8_t> lmask(mask.size(), 1);
+    std::vector<int8_t> rmask(mask.size(), 1);
+    if (!lhs->prune_blocks(wf, layout, lmask) ||
+        !rhs->prune_blocks(wf, layout, rmask)) return false;
+    for (size_t i = 0; i < mask.size(); ++i) {
+      mask[i] &= (lmask[i] | rmask[i]);
+    }
+    return true;
+  }
+  if (op < biop::REL_EQ || op > biop::REL_LE) return false;
+
+  // Only comparisons of the form `column <op> literal` can be analyzed
+  expr_column* pcol;
+  expr_literal* plit;
+  if (!column_vs_literal(lhs.get(), rhs.get(), &op, &pcol, &plit)) {
+    return false;
+  }
+  const DataTable* dt = wf.get_datatable(0);
+  const Column* col = dt->columns[pcol->get_col_index(wf)];
+  const BlockIndex* bi = col->get_block_index();
+  if (!bi || !bi->same_layout(layout)) return false;
+  return prune_comparison(op, col, plit->get_column(), *bi, mask);
+}
+
+
+
+//------------------------------------------------------------------------------
+// Comparisons of compressed columns
+//------------------------------------------------------------------------------
+
+/**
+ * Evaluate the comparison `column <op> literal` directly on the compressed
+ * data of the column (see "codec.h"): for example, for a run-length encoded
+ * column the literal is compared once per run. The values are compared in
+ * the same domain as in `prune_comparison()`. Returns an empty pointer if
+ * the expression is not of this form, or the column is not compressed.
+ */
+colptr expr_binaryop::evaluate_compressed(workframe& wf) {
+  auto op = static_cast<biop>(binop_code);
+  if (op < biop::REL_EQ || op > biop::REL_LE) return colptr();
+  expr_column* pcol;
+  expr_literal* plit;
+  if (!column_vs_literal(lhs.get(), rhs.get(), &op, &pcol, &plit) ||
+      wf.get_rowindex(0)) return colptr();
+
+  const DataTable* dt = wf.get_datatable(0);
+  const Column* col = dt->columns[pcol->get_col_index(wf)];
+  auto codec = col->get_codec();
+  if (!codec) return colptr();
+  SType cst = col->stype();
+  bool col_int = (cst == SType::BOOL || info(cst).ltype() == LType::INT);
+  if (!(col_int || cst == SType::FLOAT32 || cst == SType::FLOAT64)) {
+    return colptr();
+  }
+  Codec::Comparison cmp;
+  bool lit_int;
+  if (!literal_value(plit->get_column(), &lit_int, &cmp.ivalue, &cmp.fvalue)) {
+    return colptr();
+  }
+  cmp.domain = (col_int && lit_int)? Codec::CmpDomain::INT64 :
+               (cst == SType::FLOAT32 && lit_int)? Codec::CmpDomain::FLOAT32 :
+                                                   Codec::CmpDomain::FLOAT64;
+  cmp.op = (op == biop::REL_EQ)? Codec::CmpOp::EQ :
+           (op == biop::REL_NE)? Codec::CmpOp::NE :
+           (op == biop::REL_GT)? Codec::CmpOp::GT :
+           (op == biop::REL_LT)? Codec::CmpOp::LT :
+           (op == biop::REL_GE)? Codec::CmpOp::GE : Codec::CmpOp::LE;
+
+  colptr res(Column::new_data_column(SType::BOOL, col->nrows));
+  codec->compare(cmp, static_cast<int8_t*>(res->data_w()));
+  return res;
+}
+
+
 
 //------------------------------------------------------------------------------
 // expr_unaryop
@@ -322,15 +746,26 @@ static void init_unops() {
   constexpr SType int64 = SType::INT64;
   constexpr SType flt32 = SType::FLOAT32;
   constexpr SType flt64 = SType::FLOAT64;
+  constexpr SType dec16 = SType::DEC16;
+  constexpr SType dec32 = SType::DEC32;
+  constexpr SType dec64 = SType::DEC64;
   constexpr SType str32 = SType::STR32;
   constexpr SType str64 = SType::STR64;
+  constexpr SType fstr  = SType::FSTR;
+  constexpr SType cat8  = SType::CAT8;
+  constexpr SType cat16 = SType::CAT16;
+  constexpr SType cat32 = SType::CAT32;
+  constexpr SType dat64 = SType::DATE64;
+  constexpr SType tim32 = SType::TIME32;
+  constexpr SType dat32 = SType::DATE32;
 
   using styvec = std::vector<SType>;
   styvec integer_stypes = {int8, int16, int32, int64};
   styvec numeric_stypes = {bool8, int8, int16, int32, int64, flt32, flt64};
   styvec string_types = {str32, str64};
   styvec all_stypes = {bool8, int8, int16, int32, int64,
-                       flt32, flt64, str32, str64};
+                       flt32, flt64, dec16, dec32, dec64, str32, str64, fstr,
+                       cat8, cat16, cat32, dat64, tim32, dat32};
 
   for (SType st : all_stypes) {
     unop_rules[id(unop::ISNA, st)] = bool8;
@@ -346,14 +781,36 @@ static void init_unops() {
     unop_rules[id(unop::LOGE, st)] = flt64;
     unop_rules[id(unop::LOG10, st)] = flt64;
   }
+  for (SType st : {dec16, dec32, dec64}) {
+    unop_rules[id(unop::MINUS, st)] = st;
+    unop_rules[id(unop::PLUS, st)] = st;
+    unop_rules[id(unop::ABS, st)] = st;
+    unop_rules[id(unop::EXP, st)] = flt64;
+    unop_rules[id(unop::LOGE, st)] = flt64;
+    unop_rules[id(unop::LOG10, st)] = flt64;
+  }
   unop_rules[id(unop::MINUS, bool8)] = int8;
   unop_rules[id(unop::PLUS, bool8)] = int8;
   unop_rules[id(unop::ABS, bool8)] = int8;
   unop_rules[id(unop::INVERT, bool8)] = bool8;
   unop_rules[id(unop::LEN, str32)] = int32;
   unop_rules[id(unop::LEN, str64)] = int64;
+  unop_rules[id(unop::LEN, fstr)] = int32;
+  unop_rules[id(unop::LEN, cat8)] = int32;
+  unop_rules[id(unop::LEN, cat16)] = int32;
+  unop_rules[id(unop::LEN, cat32)] = int32;
+  for (SType st : {dat64, dat32}) {
+    unop_rules[id(unop::YEAR, st)] = int32;
+    unop_rules[id(unop::MONTH, st)] = int32;
+    unop_rules[id(unop::DAY, st)] = int32;
+  }
+  for (SType st : {dat64, tim32}) {
+    unop_rules[id(unop::HOUR, st)] = int32;
+    unop_rules[id(unop::MINUTE, st)] = int32;
+    unop_rules[id(unop::SECOND, st)] = int32;
+  }
 
-  unop_names.resize(1 + id(unop::LEN));
+  unop_names.resize(1 + id(unop::SECOND));
   unop_names[id(unop::ISNA)]   = "isna";
   unop_names[id(unop::MINUS)]  = "-";
   unop_names[id(unop::PLUS)]   = "+";
@@ -363,6 +820,12 @@ static void init_unops() {
   unop_names[id(unop::LOGE)]   = "log";
   unop_names[id(unop::LOG10)]  = "log10";
   unop_names[id(unop::LEN)]    = "len";
+  unop_names[id(unop::YEAR)]   = "year";
+  unop_names[id(unop::MONTH)]  = "month";
+  unop_names[id(unop::DAY)]    = "day";
+  unop_names[id(unop::HOUR)]   = "hour";
+  unop_names[id(unop::MINUTE)] = "minute";
+  unop_names[id(unop::SECOND)] = "second";
 }
 
 
@@ -371,6 +834,8 @@ class expr_unaryop : public base_expr {
   private:
     pexpr arg;
     unop unop_code;
+    expr::mapperfn fused_fn;
+    size_t arg_slot;
 
   public:
     expr_unaryop(size_t opcode, pexpr a);
@@ -379,11 +844,14 @@ class expr_unaryop : public base_expr {
     SType resolve(const workframe& wf) override;
     GroupbyMode get_groupby_mode(const workframe&) const override;
     colptr evaluate_eager(workframe& wf) override;
+    SType prepare_fused(fused_plan&, workframe&) override;
+    const void* evaluate_block(fused_context&, size_t, size_t, void*) override;
 };
 
 
 expr_unaryop::expr_unaryop(size_t opcode, pexpr a)
-  : arg(std::move(a)), unop_code(static_cast<unop>(opcode)) {}
+  : arg(std::move(a)), unop_code(static_cast<unop>(opcode)),
+    fused_fn(nullptr), arg_slot(0) {}
 
 
 bool expr_unaryop::is_negated_expr() const {
@@ -417,11 +885,48 @@ GroupbyMode expr_unaryop::get_groupby_mode(const workframe& wf) const {
 
 
 colptr expr_unaryop::evaluate_eager(workframe& wf) {
+  if (unop_code != unop::PLUS) {
+    colptr res = evaluate_fused(this, wf);
+    if (res) return res;
+  }
   auto arg_res = arg->evaluate_eager(wf);
   return colptr(expr::unaryop(unop_code, arg_res.get()));
 }
 
 
+SType expr_unaryop::prepare_fused(fused_plan& plan, workframe& wf) {
+  if (unop_code == unop::PLUS) {
+    // Unary plus is a no-op: the argument's values are passed through
+    fused_fn = nullptr;
+    return arg->prepare_fused(plan, wf);
+  }
+  size_t mark = plan.nslots;
+  arg_slot = plan.add_slot();
+  SType arg_stype = arg->prepare_fused(plan, wf);
+  if (arg_stype == SType::VOID) return SType::VOID;
+  plan.release_slots(mark);
+
+  SType res_stype = SType::VOID;
+  fused_fn = expr::unaryop_mapper(unop_code, arg_stype, &res_stype);
+  return fused_fn? res_stype : SType::VOID;
+}
+
+
+const void* expr_unaryop::evaluate_block(fused_context& ctx, size_t row0,
+                                         size_t n, void* out)
+{
+  if (!fused_fn) {
+    return arg->evaluate_block(ctx, row0, n, out);
+  }
+  void* params[2];
+  params[0] = const_cast<void*>(
+                arg->evaluate_block(ctx, row0, n, ctx.buffer(arg_slot)));
+  params[1] = out;
+  fused_fn(0, static_cast<int64_t>(n), params);
+  return out;
+}
+
+
 
 
 //------------------------------------------------------------------------------
@@ -614,6 +1119,14 @@ void py::base_expr::m__init__(py::PKArgs& args) {
       expr = dt::expr_string_fn(op, std::move(arg), params).release();
       break;
     }
+    case dt::exprCode::WINDOW: {
+      check_args_count(va, 3);
+      size_t op = va[0].to_size_t();
+      dt::pexpr arg;
+      if (!va[1].is_none()) arg = to_base_expr(va[1]);
+      expr = dt::expr_window_fn(op, std::move(arg), va[2]).release();
+      break;
+    }
   }
 }
 
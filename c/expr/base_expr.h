@@ -22,12 +22,14 @@
 #ifndef dt_EXPR_BASE_EXPR_h
 #define dt_EXPR_BASE_EXPR_h
 #include "column.h"
+#include "expr/fused.h"
 #include "expr/workframe.h"
 #include "python/ext_type.h"
 
 namespace dt {
 
 class base_expr;
+class BlockIndex;
 using pexpr = std::unique_ptr<base_expr>;
 using colptr = std::unique_ptr<Column>;
 
@@ -44,6 +46,20 @@ class base_expr {  // move into expr?
     virtual GroupbyMode get_groupby_mode(const workframe&) const = 0;
     virtual colptr evaluate_eager(workframe&) = 0;
 
+    // Fused evaluation, see "expr/fused.h". By default expressions do not
+    // support it, and `prepare_fused()` returns `SType::VOID`.
+    virtual SType prepare_fused(fused_plan&, workframe&);
+    virtual const void* evaluate_block(fused_context&, size_t row0, size_t n,
+                                       void* out);
+
+    // Block pruning, see "blockindex.h". For a boolean expression over the
+    // root frame whose columns are stored in blocks with the same `layout`,
+    // clear the entries of `mask` for the blocks where the expression is
+    // certainly false. Returns false if the expression could not be
+    // analyzed, in which case the `mask` is left unchanged.
+    virtual bool prune_blocks(const workframe&, const BlockIndex& layout,
+                              std::vector<int8_t>& mask);
+
     virtual bool is_column_expr() const;
     virtual bool is_negated_expr() const;
     virtual pexpr get_negated_expr();
@@ -77,6 +93,8 @@ constexpr size_t REDUCEOP_COUNT = 8 + 1;
 
 
 
+struct reduce_task;
+
 class expr_reduce : public dt::base_expr {
   private:
     dt::pexpr arg;
@@ -87,6 +105,17 @@ class expr_reduce : public dt::base_expr {
     SType resolve(const dt::workframe& wf) override;
     dt::GroupbyMode get_groupby_mode(const dt::workframe&) const override;
     std::unique_ptr<Column> evaluate_eager(dt::workframe& wf) override;
+
+    // Several reductions over the same groupby can be evaluated together,
+    // in a single pass over the groups: each group is then visited once,
+    // applying all the reducers to it in turn. This is more cache-friendly
+    // than running a separate parallel loop for each reducer. Returns the
+    // result columns, in the same order as `exprs`.
+    static std::vector<dt::colptr> evaluate_batch(
+        const std::vector<expr_reduce*>& exprs, dt::workframe& wf);
+
+  private:
+    bool prepare(dt::workframe& wf, Groupby& gb, reduce_task& task);
 };
 
 
@@ -108,6 +137,7 @@ enum exprCode : size_t {
   UNREDUCE = 6,
   NUREDUCE = 7,
   STRINGFN = 8,
+  WINDOW   = 9,
 };
 
 enum class biop : size_t {
@@ -140,12 +170,29 @@ enum class unop : size_t {
   LOGE   = 7,
   LOG10  = 8,
   LEN    = 9,
+  YEAR   = 10,
+  MONTH  = 11,
+  DAY    = 12,
+  HOUR   = 13,
+  MINUTE = 14,
+  SECOND = 15,
 };
 
 enum class strop : size_t {
   RE_MATCH = 1,
 };
 
+// Synchronize with datatable/expr/window_expr.py
+enum class winop : size_t {
+  CUMSUM       = 1,
+  CUMCOUNT     = 2,
+  SHIFT        = 3,
+  ROLLING_SUM  = 4,
+  ROLLING_MEAN = 5,
+  ROLLING_MIN  = 6,
+  ROLLING_MAX  = 7,
+};
+
 
 
 class expr_column : public base_expr {
@@ -153,6 +200,14 @@ class expr_column : public base_expr {
     size_t frame_id;
     size_t col_id;
     py::oobj col_selector;
+    // Used during fused evaluation
+    RowIndex fused_ri;
+    const void* fused_data;
+    std::shared_ptr<const Codec> fused_codec;
+    size_t fused_offset;
+    size_t fused_elemsize;
+    SType fused_stype;
+    size_t : 56;
 
   public:
     expr_column(size_t dfid, const py::robj& col);
@@ -163,10 +218,13 @@ class expr_column : public base_expr {
     SType resolve(const workframe&) override;
     GroupbyMode get_groupby_mode(const workframe&) const override;
     colptr evaluate_eager(workframe&) override;
+    SType prepare_fused(fused_plan&, workframe&) override;
+    const void* evaluate_block(fused_context&, size_t, size_t, void*) override;
 };
 
 
 pexpr expr_string_fn(size_t op, pexpr&& arg, py::oobj params);
+pexpr expr_window_fn(size_t op, pexpr&& arg, py::robj param);
 
 
 
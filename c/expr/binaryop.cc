@@ -37,11 +37,20 @@
 // In order to help tame this explosion of possibilities, templates are used
 // heavily in this source file.
 //------------------------------------------------------------------------------
+#include <algorithm>           // std::min, std::max
 #include <cmath>               // std::fmod
+#include <cstring>             // std::memcmp
+#include <limits>              // std::numeric_limits
+#include <memory>              // std::unique_ptr
 #include <type_traits>         // std::is_integral
+#include "expr/fused.h"
 #include "expr/py_expr.h"
+#include "parallel/api.h"      // dt::parallel_for_static
+#include "utils/cpu.h"
+#include "utils/decimal.h"
 #include "utils/exceptions.h"
 #include "utils/macros.h"
+#include "column.h"
 #include "types.h"
 
 
@@ -82,57 +91,114 @@ enum OpMode {
 // Final mapper functions
 //------------------------------------------------------------------------------
 
+// The loops are written once, and then instantiated several times: as plain
+// mapper functions, and (for the most common combinations of types) as their
+// AVX2 / AVX-512 versions. The latter are selected at runtime depending on
+// the CPU capabilities, see `resolve2()`. The operators are written in a
+// branch-free manner, so that the compiler can vectorize these loops,
+// handling NAs with vector blends.
+
 template<typename LT, typename RT, typename VT, VT (*OP)(LT, RT)>
-static void map_n_to_n(int64_t row0, int64_t row1, void** params) {
-  Column* col0 = static_cast<Column*>(params[0]);
-  Column* col1 = static_cast<Column*>(params[1]);
-  Column* col2 = static_cast<Column*>(params[2]);
-  const LT* lhs_data = static_cast<const LT*>(col0->data());
-  const RT* rhs_data = static_cast<const RT*>(col1->data());
-  VT* res_data = static_cast<VT*>(col2->data_w());
+static ALWAYS_INLINE void loop_n_to_n(int64_t row0, int64_t row1,
+                                      void** params)
+{
+  const LT* lhs_data = static_cast<const LT*>(params[0]);
+  const RT* rhs_data = static_cast<const RT*>(params[1]);
+  VT* res_data = static_cast<VT*>(params[2]);
   for (int64_t i = row0; i < row1; ++i) {
     res_data[i] = OP(lhs_data[i], rhs_data[i]);
   }
 }
 
 template<typename LT, typename RT, typename VT, VT (*OP)(LT, RT)>
-static void map_n_to_1(int64_t row0, int64_t row1, void** params) {
-  Column* col0 = static_cast<Column*>(params[0]);
-  Column* col1 = static_cast<Column*>(params[1]);
-  Column* col2 = static_cast<Column*>(params[2]);
-  const LT* lhs_data = static_cast<const LT*>(col0->data());
-  RT rhs_value = static_cast<const RT*>(col1->data())[0];
-  VT* res_data = static_cast<VT*>(col2->data_w());
+static ALWAYS_INLINE void loop_n_to_1(int64_t row0, int64_t row1,
+                                      void** params)
+{
+  const LT* lhs_data = static_cast<const LT*>(params[0]);
+  RT rhs_value = static_cast<const RT*>(params[1])[0];
+  VT* res_data = static_cast<VT*>(params[2]);
   for (int64_t i = row0; i < row1; ++i) {
     res_data[i] = OP(lhs_data[i], rhs_value);
   }
 }
 
 template<typename LT, typename RT, typename VT, VT (*OP)(LT, RT)>
-static void map_1_to_n(int64_t row0, int64_t row1, void** params) {
-  Column* col0 = static_cast<Column*>(params[0]);
-  Column* col1 = static_cast<Column*>(params[1]);
-  Column* col2 = static_cast<Column*>(params[2]);
-  LT lhs_value = static_cast<const LT*>(col0->data())[0];
-  const RT* rhs_data = static_cast<const RT*>(col1->data());
-  VT* res_data = static_cast<VT*>(col2->data_w());
+static ALWAYS_INLINE void loop_1_to_n(int64_t row0, int64_t row1,
+                                      void** params)
+{
+  LT lhs_value = static_cast<const LT*>(params[0])[0];
+  const RT* rhs_data = static_cast<const RT*>(params[1]);
+  VT* res_data = static_cast<VT*>(params[2]);
   for (int64_t i = row0; i < row1; ++i) {
     res_data[i] = OP(lhs_value, rhs_data[i]);
   }
 }
 
 
+template<typename LT, typename RT, typename VT, VT (*OP)(LT, RT)>
+static void map_n_to_n(int64_t row0, int64_t row1, void** params) {
+  loop_n_to_n<LT, RT, VT, OP>(row0, row1, params);
+}
+
+template<typename LT, typename RT, typename VT, VT (*OP)(LT, RT)>
+static void map_n_to_1(int64_t row0, int64_t row1, void** params) {
+  loop_n_to_1<LT, RT, VT, OP>(row0, row1, params);
+}
+
+template<typename LT, typename RT, typename VT, VT (*OP)(LT, RT)>
+static void map_1_to_n(int64_t row0, int64_t row1, void** params) {
+  loop_1_to_n<LT, RT, VT, OP>(row0, row1, params);
+}
+
+#if DT_SIMD_DISPATCH
+template<typename LT, typename RT, typename VT, VT (*OP)(LT, RT)>
+TARGET_AVX2
+static void map_n_to_n_avx2(int64_t row0, int64_t row1, void** params) {
+  loop_n_to_n<LT, RT, VT, OP>(row0, row1, params);
+}
+
+template<typename LT, typename RT, typename VT, VT (*OP)(LT, RT)>
+TARGET_AVX2
+static void map_n_to_1_avx2(int64_t row0, int64_t row1, void** params) {
+  loop_n_to_1<LT, RT, VT, OP>(row0, row1, params);
+}
+
+template<typename LT, typename RT, typename VT, VT (*OP)(LT, RT)>
+TARGET_AVX2
+static void map_1_to_n_avx2(int64_t row0, int64_t row1, void** params) {
+  loop_1_to_n<LT, RT, VT, OP>(row0, row1, params);
+}
+
+template<typename LT, typename RT, typename VT, VT (*OP)(LT, RT)>
+TARGET_AVX512
+static void map_n_to_n_avx512(int64_t row0, int64_t row1, void** params) {
+  loop_n_to_n<LT, RT, VT, OP>(row0, row1, params);
+}
+
+template<typename LT, typename RT, typename VT, VT (*OP)(LT, RT)>
+TARGET_AVX512
+static void map_n_to_1_avx512(int64_t row0, int64_t row1, void** params) {
+  loop_n_to_1<LT, RT, VT, OP>(row0, row1, params);
+}
+
+template<typename LT, typename RT, typename VT, VT (*OP)(LT, RT)>
+TARGET_AVX512
+static void map_1_to_n_avx512(int64_t row0, int64_t row1, void** params) {
+  loop_1_to_n<LT, RT, VT, OP>(row0, row1, params);
+}
+#endif
+
+
 template<typename T0, typename T1, typename T2,
          T2 (*OP)(T0, T0, const char*, T1, T1, const char*)>
 static void strmap_n_to_n(int64_t row0, int64_t row1, void** params) {
   auto col0 = static_cast<StringColumn<T0>*>(params[0]);
   auto col1 = static_cast<StringColumn<T1>*>(params[1]);
-  auto col2 = static_cast<Column*>(params[2]);
   const T0* offsets0 = col0->offsets();
   const T1* offsets1 = col1->offsets();
   const char* strdata0 = col0->strdata();
   const char* strdata1 = col1->strdata();
-  T2* res_data = static_cast<T2*>(col2->data_w());
+  T2* res_data = static_cast<T2*>(params[2]);
   T0 str0start = offsets0[row0 - 1] & ~GETNA<T0>();
   T1 str1start = offsets1[row0 - 1] & ~GETNA<T1>();
   for (int64_t i = row0; i < row1; ++i) {
@@ -151,7 +217,6 @@ template<typename T0, typename T1, typename T2,
 static void strmap_n_to_1(int64_t row0, int64_t row1, void** params) {
   auto col0 = static_cast<StringColumn<T0>*>(params[0]);
   auto col1 = static_cast<StringColumn<T1>*>(params[1]);
-  auto col2 = static_cast<Column*>(params[2]);
   const T0* offsets0 = col0->offsets();
   const T1* offsets1 = col1->offsets();
   const char* strdata0 = col0->strdata();
@@ -159,7 +224,7 @@ static void strmap_n_to_1(int64_t row0, int64_t row1, void** params) {
   T0 str0start = offsets0[row0 - 1] & ~GETNA<T0>();
   T1 str1start = 0;
   T1 str1end = offsets1[0];
-  T2* res_data = static_cast<T2*>(col2->data_w());
+  T2* res_data = static_cast<T2*>(params[2]);
   for (int64_t i = row0; i < row1; ++i) {
     T0 str0end = offsets0[i];
     res_data[i] = OP(str0start, str0end, strdata0,
@@ -177,17 +242,17 @@ static void strmap_n_to_1(int64_t row0, int64_t row1, void** params) {
 
 template<typename LT, typename RT, typename VT>
 inline static VT op_add(LT x, RT y) {
-  return IsIntNA<LT>(x) || IsIntNA<RT>(y)? GETNA<VT>() : static_cast<VT>(x) + static_cast<VT>(y);
+  return (IsIntNA<LT>(x) | IsIntNA<RT>(y))? GETNA<VT>() : static_cast<VT>(x) + static_cast<VT>(y);
 }
 
 template<typename LT, typename RT, typename VT>
 inline static VT op_sub(LT x, RT y) {
-  return IsIntNA<LT>(x) || IsIntNA<RT>(y)? GETNA<VT>() : static_cast<VT>(x) - static_cast<VT>(y);
+  return (IsIntNA<LT>(x) | IsIntNA<RT>(y))? GETNA<VT>() : static_cast<VT>(x) - static_cast<VT>(y);
 }
 
 template<typename LT, typename RT, typename VT>
 inline static VT op_mul(LT x, RT y) {
-  return IsIntNA<LT>(x) || IsIntNA<RT>(y)? GETNA<VT>() : static_cast<VT>(x) * static_cast<VT>(y);
+  return (IsIntNA<LT>(x) | IsIntNA<RT>(y))? GETNA<VT>() : static_cast<VT>(x) * static_cast<VT>(y);
 }
 
 template<typename LT, typename RT, typename VT>
@@ -233,50 +298,60 @@ struct Mod<LT, RT, double> {
 // Relational operators
 //------------------------------------------------------------------------------
 
+// Note: bitwise operators `&` and `|` are used instead of the logical ones, so
+// that the expressions do not introduce branches. Also, when both operands
+// are floating-point, the comparisons involving NaNs are already false, and
+// the NA checks are only needed for the `==`, `>=`, `<=` operators, where
+// two NAs compare as equal.
+
+template<typename LT, typename RT>
+using both_floating = std::integral_constant<bool,
+    std::is_floating_point<LT>::value && std::is_floating_point<RT>::value>;
+
 template<typename LT, typename RT, typename VT>
 inline static int8_t op_eq(LT x, RT y) {  // x == y
   bool x_isna = ISNA<LT>(x);
   bool y_isna = ISNA<RT>(y);
-  return (!x_isna && !y_isna && static_cast<VT>(x) == static_cast<VT>(y)) ||
-         (x_isna && y_isna);
+  bool eq = static_cast<VT>(x) == static_cast<VT>(y);
+  if (!both_floating<LT, RT>::value) eq = eq & !x_isna & !y_isna;
+  return eq | (x_isna & y_isna);
 }
 
 template<typename LT, typename RT, typename VT>
 inline static int8_t op_ne(LT x, RT y) {  // x != y
-  bool x_isna = ISNA<LT>(x);
-  bool y_isna = ISNA<RT>(y);
-  return (x_isna || y_isna || static_cast<VT>(x) != static_cast<VT>(y)) &&
-         !(x_isna && y_isna);
+  return !op_eq<LT, RT, VT>(x, y);
 }
 
 template<typename LT, typename RT, typename VT>
 inline static int8_t op_gt(LT x, RT y) {  // x > y
-  bool x_isna = ISNA<LT>(x);
-  bool y_isna = ISNA<RT>(y);
-  return (!x_isna && !y_isna && static_cast<VT>(x) > static_cast<VT>(y));
+  bool gt = static_cast<VT>(x) > static_cast<VT>(y);
+  if (both_floating<LT, RT>::value) return gt;
+  return gt & !ISNA<LT>(x) & !ISNA<RT>(y);
 }
 
 template<typename LT, typename RT, typename VT>
 inline static int8_t op_lt(LT x, RT y) {  // x < y
-  bool x_isna = ISNA<LT>(x);
-  bool y_isna = ISNA<RT>(y);
-  return (!x_isna && !y_isna && static_cast<VT>(x) < static_cast<VT>(y));
+  bool lt = static_cast<VT>(x) < static_cast<VT>(y);
+  if (both_floating<LT, RT>::value) return lt;
+  return lt & !ISNA<LT>(x) & !ISNA<RT>(y);
 }
 
 template<typename LT, typename RT, typename VT>
 inline static int8_t op_ge(LT x, RT y) {  // x >= y
   bool x_isna = ISNA<LT>(x);
   bool y_isna = ISNA<RT>(y);
-  return (!x_isna && !y_isna && static_cast<VT>(x) >= static_cast<VT>(y)) ||
-         (x_isna && y_isna);
+  bool ge = static_cast<VT>(x) >= static_cast<VT>(y);
+  if (!both_floating<LT, RT>::value) ge = ge & !x_isna & !y_isna;
+  return ge | (x_isna & y_isna);
 }
 
 template<typename LT, typename RT, typename VT>
 inline static int8_t op_le(LT x, RT y) {  // x <= y
   bool x_isna = ISNA<LT>(x);
   bool y_isna = ISNA<RT>(y);
-  return (!x_isna && !y_isna && static_cast<VT>(x) <= static_cast<VT>(y)) ||
-         (x_isna && y_isna);
+  bool le = static_cast<VT>(x) <= static_cast<VT>(y);
+  if (!both_floating<LT, RT>::value) le = le & !x_isna & !y_isna;
+  return le | (x_isna & y_isna);
 }
 
 template<typename T1, typename T2>
@@ -319,6 +394,52 @@ inline static int8_t strop_ne(T1 start1, T1 end1, const char* strdata1,
   }
 }
 
+// Strings are ordered byte-wise (as unsigned chars), so that a string is
+// greater than any of its prefixes. As with the numeric comparisons, an NA
+// is neither less nor greater than any value, but it is "<=" and ">=" than
+// another NA.
+template<typename T1, typename T2>
+inline static int str_compare(T1 start1, T1 end1, const char* strdata1,
+                              T2 start2, T2 end2, const char* strdata2) {
+  size_t len1 = static_cast<size_t>(end1 - start1);
+  size_t len2 = static_cast<size_t>(end2 - start2);
+  int r = std::memcmp(strdata1 + start1, strdata2 + start2,
+                      std::min(len1, len2));
+  return r? r : (len1 > len2) - (len1 < len2);
+}
+
+template<typename T1, typename T2>
+inline static int8_t strop_lt(T1 start1, T1 end1, const char* strdata1,
+                              T2 start2, T2 end2, const char* strdata2) {
+  if (ISNA<T1>(end1) || ISNA<T2>(end2)) return 0;
+  return str_compare(start1, end1, strdata1, start2, end2, strdata2) < 0;
+}
+
+template<typename T1, typename T2>
+inline static int8_t strop_gt(T1 start1, T1 end1, const char* strdata1,
+                              T2 start2, T2 end2, const char* strdata2) {
+  if (ISNA<T1>(end1) || ISNA<T2>(end2)) return 0;
+  return str_compare(start1, end1, strdata1, start2, end2, strdata2) > 0;
+}
+
+template<typename T1, typename T2>
+inline static int8_t strop_le(T1 start1, T1 end1, const char* strdata1,
+                              T2 start2, T2 end2, const char* strdata2) {
+  if (ISNA<T1>(end1) || ISNA<T2>(end2)) {
+    return ISNA<T1>(end1) && ISNA<T2>(end2);
+  }
+  return str_compare(start1, end1, strdata1, start2, end2, strdata2) <= 0;
+}
+
+template<typename T1, typename T2>
+inline static int8_t strop_ge(T1 start1, T1 end1, const char* strdata1,
+                              T2 start2, T2 end2, const char* strdata2) {
+  if (ISNA<T1>(end1) || ISNA<T2>(end2)) {
+    return ISNA<T1>(end1) && ISNA<T2>(end2);
+  }
+  return str_compare(start1, end1, strdata1, start2, end2, strdata2) >= 0;
+}
+
 
 
 //------------------------------------------------------------------------------
@@ -343,8 +464,49 @@ inline static int8_t op_or(int8_t x, int8_t y) {
 // Resolve the right mapping function
 //------------------------------------------------------------------------------
 
+// Vectorized versions of the mappers are instantiated only when the operands
+// are promoted to int32, int64, float32 or float64 (i.e. not for the
+// operations over small integers).
+template<typename LT, typename RT>
+using has_simd_mappers = std::integral_constant<bool,
+    (sizeof(LT) >= 4 || sizeof(RT) >= 4 ||
+     std::is_floating_point<LT>::value || std::is_floating_point<RT>::value)>;
+
+template<typename LT, typename RT, typename VT, VT (*OP)(LT, RT)>
+static mapperfn resolve2simd(OpMode, std::false_type) {
+  return nullptr;
+}
+
+template<typename LT, typename RT, typename VT, VT (*OP)(LT, RT)>
+static mapperfn resolve2simd(OpMode mode, std::true_type) {
+  #if DT_SIMD_DISPATCH
+    switch (dt::get_simd_level()) {
+      case dt::SimdLevel::AVX512:
+        switch (mode) {
+          case N_to_N:   return map_n_to_n_avx512<LT, RT, VT, OP>;
+          case N_to_One: return map_n_to_1_avx512<LT, RT, VT, OP>;
+          case One_to_N: return map_1_to_n_avx512<LT, RT, VT, OP>;
+          default:       return nullptr;
+        }
+      case dt::SimdLevel::AVX2:
+        switch (mode) {
+          case N_to_N:   return map_n_to_n_avx2<LT, RT, VT, OP>;
+          case N_to_One: return map_n_to_1_avx2<LT, RT, VT, OP>;
+          case One_to_N: return map_1_to_n_avx2<LT, RT, VT, OP>;
+          default:       return nullptr;
+        }
+      case dt::SimdLevel::NONE: break;
+    }
+  #else
+    (void) mode;
+  #endif
+  return nullptr;
+}
+
 template<typename LT, typename RT, typename VT, VT (*OP)(LT, RT)>
 static mapperfn resolve2(OpMode mode) {
+  mapperfn fn = resolve2simd<LT, RT, VT, OP>(mode, has_simd_mappers<LT, RT>());
+  if (fn) return fn;
   switch (mode) {
     case N_to_N:   return map_n_to_n<LT, RT, VT, OP>;
     case N_to_One: return map_n_to_1<LT, RT, VT, OP>;
@@ -366,14 +528,14 @@ static mapperfn resolve2str(OpMode mode) {
 
 
 template<typename LT, typename RT, typename VT>
-static mapperfn resolve1(size_t opcode, SType stype, void** params, size_t nrows, OpMode mode) {
+static mapperfn resolve1(size_t opcode, SType stype, SType* res_type, OpMode mode) {
   if (opcode >= OpCode::Equal) {
     // override stype for relational operators
     stype = SType::BOOL;
   } else if (opcode == OpCode::Divide && std::is_integral<VT>::value) {
     stype = SType::FLOAT64;
   }
-  params[2] = Column::new_data_column(stype, nrows);
+  *res_type = stype;
   switch (opcode) {
     case OpCode::Plus:      return resolve2<LT, RT, VT, op_add<LT, RT, VT>>(mode);
     case OpCode::Minus:     return resolve2<LT, RT, VT, op_sub<LT, RT, VT>>(mode);
@@ -394,34 +556,73 @@ static mapperfn resolve1(size_t opcode, SType stype, void** params, size_t nrows
     case OpCode::GreaterOrEqual: return resolve2<LT, RT, int8_t, op_ge<LT, RT, VT>>(mode);
     case OpCode::LessOrEqual:    return resolve2<LT, RT, int8_t, op_le<LT, RT, VT>>(mode);
   }
-  delete static_cast<Column*>(params[2]);
   return nullptr;
 }
 
 
 template<typename T0, typename T1>
-static mapperfn resolve1str(size_t opcode, void** params, size_t nrows, OpMode mode) {
+static mapperfn resolve1str(size_t opcode, void** params, SType* res_type, OpMode mode) {
   if (mode == OpMode::One_to_N) {
-    mode = OpMode::N_to_One;
+    // `x < col` is evaluated as `col > x`
     std::swap(params[0], params[1]);
+    opcode = opcode == OpCode::Greater? OpCode::Less :
+             opcode == OpCode::Less? OpCode::Greater :
+             opcode == OpCode::GreaterOrEqual? OpCode::LessOrEqual :
+             opcode == OpCode::LessOrEqual? OpCode::GreaterOrEqual : opcode;
+    return resolve1str<T1, T0>(opcode, params, res_type, OpMode::N_to_One);
   }
-  params[2] = Column::new_data_column(SType::BOOL, nrows);
+  *res_type = SType::BOOL;
   switch (opcode) {
-    case OpCode::Equal:    return resolve2str<T0, T1, int8_t, strop_eq<T0, T1>>(mode);
-    case OpCode::NotEqual: return resolve2str<T0, T1, int8_t, strop_ne<T0, T1>>(mode);
+    case OpCode::Equal:          return resolve2str<T0, T1, int8_t, strop_eq<T0, T1>>(mode);
+    case OpCode::NotEqual:       return resolve2str<T0, T1, int8_t, strop_ne<T0, T1>>(mode);
+    case OpCode::Greater:        return resolve2str<T0, T1, int8_t, strop_gt<T0, T1>>(mode);
+    case OpCode::Less:           return resolve2str<T0, T1, int8_t, strop_lt<T0, T1>>(mode);
+    case OpCode::GreaterOrEqual: return resolve2str<T0, T1, int8_t, strop_ge<T0, T1>>(mode);
+    case OpCode::LessOrEqual:    return resolve2str<T0, T1, int8_t, strop_le<T0, T1>>(mode);
   }
-  delete static_cast<Column*>(params[2]);
   return nullptr;
 }
 
 
-static mapperfn resolve0(SType lhs_type, SType rhs_type, size_t opcode, void** params, size_t nrows, OpMode mode) {
+// Temporal columns are operated upon as their underlying integers: values of
+// the same stype can be compared or subtracted (producing an integer number
+// of days / microseconds / milliseconds), and an integer can be added to or
+// subtracted from a date (DATE32) or a datetime (DATE64).
+template<typename T>
+static mapperfn resolve1temporal(size_t opcode, SType lhs_type, SType rhs_type,
+                                 SType* res_type, OpMode mode)
+{
+  if (rhs_type == lhs_type) {
+    SType diff_type = sizeof(T) == 8? SType::INT64 : SType::INT32;
+    return resolve1<T, T, T>(opcode, diff_type, res_type, mode);
+  }
+  if (lhs_type == SType::TIME32) return nullptr;
+  switch (rhs_type) {
+    case SType::BOOL:
+    case SType::INT8:  return resolve1<T, int8_t, T>(opcode, lhs_type, res_type, mode);
+    case SType::INT16: return resolve1<T, int16_t, T>(opcode, lhs_type, res_type, mode);
+    case SType::INT32: return resolve1<T, int32_t, T>(opcode, lhs_type, res_type, mode);
+    case SType::INT64: return resolve1<T, int64_t, T>(opcode, lhs_type, res_type, mode);
+    default:           return nullptr;
+  }
+}
+
+
+static mapperfn resolve0(SType lhs_type, SType rhs_type, size_t opcode, void** params, SType* res_type, OpMode mode) {
   if (mode == OpMode::Error) return nullptr;
+  if (is_temporal(rhs_type) && !is_temporal(lhs_type) &&
+      opcode == OpCode::Plus && params) {
+    // `int + date` is evaluated as `date + int`
+    std::swap(lhs_type, rhs_type);
+    std::swap(params[0], params[1]);
+    mode = mode == OpMode::N_to_One? OpMode::One_to_N :
+           mode == OpMode::One_to_N? OpMode::N_to_One : mode;
+  }
   switch (lhs_type) {
     case SType::BOOL:
       if (rhs_type == SType::BOOL && (opcode == OpCode::LogicalAnd ||
                                       opcode == OpCode::LogicalOr)) {
-        params[2] = Column::new_data_column(SType::BOOL, nrows);
+        *res_type = SType::BOOL;
         if (opcode == OpCode::LogicalAnd) return resolve2<int8_t, int8_t, int8_t, op_and>(mode);
         if (opcode == OpCode::LogicalOr)  return resolve2<int8_t, int8_t, int8_t, op_or>(mode);
       }
@@ -430,12 +631,12 @@ static mapperfn resolve0(SType lhs_type, SType rhs_type, size_t opcode, void** p
     case SType::INT8:
       switch (rhs_type) {
         case SType::BOOL:
-        case SType::INT8:    return resolve1<int8_t, int8_t, int8_t>(opcode, SType::INT8, params, nrows, mode);
-        case SType::INT16:   return resolve1<int8_t, int16_t, int16_t>(opcode, SType::INT16, params, nrows, mode);
-        case SType::INT32:   return resolve1<int8_t, int32_t, int32_t>(opcode, SType::INT32, params, nrows, mode);
-        case SType::INT64:   return resolve1<int8_t, int64_t, int64_t>(opcode, SType::INT64, params, nrows, mode);
-        case SType::FLOAT32: return resolve1<int8_t, float, float>(opcode, SType::FLOAT32, params, nrows, mode);
-        case SType::FLOAT64: return resolve1<int8_t, double, double>(opcode, SType::FLOAT64, params, nrows, mode);
+        case SType::INT8:    return resolve1<int8_t, int8_t, int8_t>(opcode, SType::INT8, res_type, mode);
+        case SType::INT16:   return resolve1<int8_t, int16_t, int16_t>(opcode, SType::INT16, res_type, mode);
+        case SType::INT32:   return resolve1<int8_t, int32_t, int32_t>(opcode, SType::INT32, res_type, mode);
+        case SType::INT64:   return resolve1<int8_t, int64_t, int64_t>(opcode, SType::INT64, res_type, mode);
+        case SType::FLOAT32: return resolve1<int8_t, float, float>(opcode, SType::FLOAT32, res_type, mode);
+        case SType::FLOAT64: return resolve1<int8_t, double, double>(opcode, SType::FLOAT64, res_type, mode);
         default: break;
       }
       break;
@@ -443,12 +644,12 @@ static mapperfn resolve0(SType lhs_type, SType rhs_type, size_t opcode, void** p
     case SType::INT16:
       switch (rhs_type) {
         case SType::BOOL:
-        case SType::INT8:    return resolve1<int16_t, int8_t, int16_t>(opcode, SType::INT16, params, nrows, mode);
-        case SType::INT16:   return resolve1<int16_t, int16_t, int16_t>(opcode, SType::INT16, params, nrows, mode);
-        case SType::INT32:   return resolve1<int16_t, int32_t, int32_t>(opcode, SType::INT32, params, nrows, mode);
-        case SType::INT64:   return resolve1<int16_t, int64_t, int64_t>(opcode, SType::INT64, params, nrows, mode);
-        case SType::FLOAT32: return resolve1<int16_t, float, float>(opcode, SType::FLOAT32, params, nrows, mode);
-        case SType::FLOAT64: return resolve1<int16_t, double, double>(opcode, SType::FLOAT64, params, nrows, mode);
+        case SType::INT8:    return resolve1<int16_t, int8_t, int16_t>(opcode, SType::INT16, res_type, mode);
+        case SType::INT16:   return resolve1<int16_t, int16_t, int16_t>(opcode, SType::INT16, res_type, mode);
+        case SType::INT32:   return resolve1<int16_t, int32_t, int32_t>(opcode, SType::INT32, res_type, mode);
+        case SType::INT64:   return resolve1<int16_t, int64_t, int64_t>(opcode, SType::INT64, res_type, mode);
+        case SType::FLOAT32: return resolve1<int16_t, float, float>(opcode, SType::FLOAT32, res_type, mode);
+        case SType::FLOAT64: return resolve1<int16_t, double, double>(opcode, SType::FLOAT64, res_type, mode);
         default: break;
       }
       break;
@@ -456,12 +657,12 @@ static mapperfn resolve0(SType lhs_type, SType rhs_type, size_t opcode, void** p
     case SType::INT32:
       switch (rhs_type) {
         case SType::BOOL:
-        case SType::INT8:    return resolve1<int32_t, int8_t, int32_t>(opcode, SType::INT32, params, nrows, mode);
-        case SType::INT16:   return resolve1<int32_t, int16_t, int32_t>(opcode, SType::INT32, params, nrows, mode);
-        case SType::INT32:   return resolve1<int32_t, int32_t, int32_t>(opcode, SType::INT32, params, nrows, mode);
-        case SType::INT64:   return resolve1<int32_t, int64_t, int64_t>(opcode, SType::INT64, params, nrows, mode);
-        case SType::FLOAT32: return resolve1<int32_t, float, float>(opcode, SType::FLOAT32, params, nrows, mode);
-        case SType::FLOAT64: return resolve1<int32_t, double, double>(opcode, SType::FLOAT64, params, nrows, mode);
+        case SType::INT8:    return resolve1<int32_t, int8_t, int32_t>(opcode, SType::INT32, res_type, mode);
+        case SType::INT16:   return resolve1<int32_t, int16_t, int32_t>(opcode, SType::INT32, res_type, mode);
+        case SType::INT32:   return resolve1<int32_t, int32_t, int32_t>(opcode, SType::INT32, res_type, mode);
+        case SType::INT64:   return resolve1<int32_t, int64_t, int64_t>(opcode, SType::INT64, res_type, mode);
+        case SType::FLOAT32: return resolve1<int32_t, float, float>(opcode, SType::FLOAT32, res_type, mode);
+        case SType::FLOAT64: return resolve1<int32_t, double, double>(opcode, SType::FLOAT64, res_type, mode);
         default: break;
       }
       break;
@@ -469,12 +670,12 @@ static mapperfn resolve0(SType lhs_type, SType rhs_type, size_t opcode, void** p
     case SType::INT64:
       switch (rhs_type) {
         case SType::BOOL:
-        case SType::INT8:    return resolve1<int64_t, int8_t, int64_t>(opcode, SType::INT64, params, nrows, mode);
-        case SType::INT16:   return resolve1<int64_t, int16_t, int64_t>(opcode, SType::INT64, params, nrows, mode);
-        case SType::INT32:   return resolve1<int64_t, int32_t, int64_t>(opcode, SType::INT64, params, nrows, mode);
-        case SType::INT64:   return resolve1<int64_t, int64_t, int64_t>(opcode, SType::INT64, params, nrows, mode);
-        case SType::FLOAT32: return resolve1<int64_t, float, float>(opcode, SType::FLOAT32, params, nrows, mode);
-        case SType::FLOAT64: return resolve1<int64_t, double, double>(opcode, SType::FLOAT64, params, nrows, mode);
+        case SType::INT8:    return resolve1<int64_t, int8_t, int64_t>(opcode, SType::INT64, res_type, mode);
+        case SType::INT16:   return resolve1<int64_t, int16_t, int64_t>(opcode, SType::INT64, res_type, mode);
+        case SType::INT32:   return resolve1<int64_t, int32_t, int64_t>(opcode, SType::INT64, res_type, mode);
+        case SType::INT64:   return resolve1<int64_t, int64_t, int64_t>(opcode, SType::INT64, res_type, mode);
+        case SType::FLOAT32: return resolve1<int64_t, float, float>(opcode, SType::FLOAT32, res_type, mode);
+        case SType::FLOAT64: return resolve1<int64_t, double, double>(opcode, SType::FLOAT64, res_type, mode);
         default: break;
       }
       break;
@@ -482,12 +683,12 @@ static mapperfn resolve0(SType lhs_type, SType rhs_type, size_t opcode, void** p
     case SType::FLOAT32:
       switch (rhs_type) {
         case SType::BOOL:
-        case SType::INT8:    return resolve1<float, int8_t, float>(opcode, SType::FLOAT32, params, nrows, mode);
-        case SType::INT16:   return resolve1<float, int16_t, float>(opcode, SType::FLOAT32, params, nrows, mode);
-        case SType::INT32:   return resolve1<float, int32_t, float>(opcode, SType::FLOAT32, params, nrows, mode);
-        case SType::INT64:   return resolve1<float, int64_t, float>(opcode, SType::FLOAT32, params, nrows, mode);
-        case SType::FLOAT32: return resolve1<float, float, float>(opcode, SType::FLOAT32, params, nrows, mode);
-        case SType::FLOAT64: return resolve1<float, double, double>(opcode, SType::FLOAT64, params, nrows, mode);
+        case SType::INT8:    return resolve1<float, int8_t, float>(opcode, SType::FLOAT32, res_type, mode);
+        case SType::INT16:   return resolve1<float, int16_t, float>(opcode, SType::FLOAT32, res_type, mode);
+        case SType::INT32:   return resolve1<float, int32_t, float>(opcode, SType::FLOAT32, res_type, mode);
+        case SType::INT64:   return resolve1<float, int64_t, float>(opcode, SType::FLOAT32, res_type, mode);
+        case SType::FLOAT32: return resolve1<float, float, float>(opcode, SType::FLOAT32, res_type, mode);
+        case SType::FLOAT64: return resolve1<float, double, double>(opcode, SType::FLOAT64, res_type, mode);
         default: break;
       }
       break;
@@ -495,32 +696,39 @@ static mapperfn resolve0(SType lhs_type, SType rhs_type, size_t opcode, void** p
     case SType::FLOAT64:
       switch (rhs_type) {
         case SType::BOOL:
-        case SType::INT8:    return resolve1<double, int8_t, double>(opcode, SType::FLOAT64, params, nrows, mode);
-        case SType::INT16:   return resolve1<double, int16_t, double>(opcode, SType::FLOAT64, params, nrows, mode);
-        case SType::INT32:   return resolve1<double, int32_t, double>(opcode, SType::FLOAT64, params, nrows, mode);
-        case SType::INT64:   return resolve1<double, int64_t, double>(opcode, SType::FLOAT64, params, nrows, mode);
-        case SType::FLOAT32: return resolve1<double, float, double>(opcode, SType::FLOAT64, params, nrows, mode);
-        case SType::FLOAT64: return resolve1<double, double, double>(opcode, SType::FLOAT64, params, nrows, mode);
+        case SType::INT8:    return resolve1<double, int8_t, double>(opcode, SType::FLOAT64, res_type, mode);
+        case SType::INT16:   return resolve1<double, int16_t, double>(opcode, SType::FLOAT64, res_type, mode);
+        case SType::INT32:   return resolve1<double, int32_t, double>(opcode, SType::FLOAT64, res_type, mode);
+        case SType::INT64:   return resolve1<double, int64_t, double>(opcode, SType::FLOAT64, res_type, mode);
+        case SType::FLOAT32: return resolve1<double, float, double>(opcode, SType::FLOAT64, res_type, mode);
+        case SType::FLOAT64: return resolve1<double, double, double>(opcode, SType::FLOAT64, res_type, mode);
         default: break;
       }
       break;
 
     case SType::STR32:
       switch (rhs_type) {
-        case SType::STR32: return resolve1str<uint32_t, uint32_t>(opcode, params, nrows, mode);
-        case SType::STR64: return resolve1str<uint32_t, uint64_t>(opcode, params, nrows, mode);
+        case SType::STR32: return resolve1str<uint32_t, uint32_t>(opcode, params, res_type, mode);
+        case SType::STR64: return resolve1str<uint32_t, uint64_t>(opcode, params, res_type, mode);
         default: break;
       }
       break;
 
     case SType::STR64:
       switch (rhs_type) {
-        case SType::STR32: return resolve1str<uint64_t, uint32_t>(opcode, params, nrows, mode);
-        case SType::STR64: return resolve1str<uint64_t, uint64_t>(opcode, params, nrows, mode);
+        case SType::STR32: return resolve1str<uint64_t, uint32_t>(opcode, params, res_type, mode);
+        case SType::STR64: return resolve1str<uint64_t, uint64_t>(opcode, params, res_type, mode);
         default: break;
       }
       break;
 
+    case SType::DATE64:
+      return resolve1temporal<int64_t>(opcode, lhs_type, rhs_type, res_type, mode);
+
+    case SType::TIME32:
+    case SType::DATE32:
+      return resolve1temporal<int32_t>(opcode, lhs_type, rhs_type, res_type, mode);
+
     default:
       break;
   }
@@ -528,6 +736,382 @@ static mapperfn resolve0(SType lhs_type, SType rhs_type, size_t opcode, void** p
 }
 
 
+//------------------------------------------------------------------------------
+// Categorical comparisons
+//------------------------------------------------------------------------------
+
+/**
+ * Equality comparisons involving a categorical column are done on the codes,
+ * without looking at the strings. The side with more levels (`lhs`) is used
+ * as-is, while the codes of the other side are translated into the levels
+ * of `lhs` (the values which are not among those levels receive a code that
+ * doesn't match anything).
+ */
+template <typename T>
+static Column* cat_binaryop(size_t opcode, Column* lhs, Column* rhs,
+                            size_t nrows, OpMode mode)
+{
+  std::vector<uint32_t> map = match_levels(rhs, lhs);
+  std::vector<uint32_t> rhs_codes(rhs->nrows);
+  recode_categorical(rhs, map, rhs_codes.data());
+
+  mapperfn mapfn = nullptr;
+  switch (opcode) {
+    case OpCode::Equal:
+      mapfn = resolve2<T, uint32_t, int8_t, op_eq<T, uint32_t, uint32_t>>(mode);
+      break;
+    case OpCode::NotEqual:
+      mapfn = resolve2<T, uint32_t, int8_t, op_ne<T, uint32_t, uint32_t>>(mode);
+      break;
+  }
+  xassert(mapfn);
+  Column* res = Column::new_data_column(SType::BOOL, nrows);
+  void* params[3];
+  params[0] = const_cast<void*>(lhs->data());
+  params[1] = static_cast<void*>(rhs_codes.data());
+  params[2] = res->data_w();
+  (*mapfn)(0, static_cast<int64_t>(nrows), params);
+  return res;
+}
+
+
+static Column* categorical_binaryop(size_t opcode, Column* lhs, Column* rhs,
+                                    size_t nrows, OpMode mode)
+{
+  std::unique_ptr<Column> tmp;
+  if (!is_categorical(lhs->stype())) {
+    tmp.reset(lhs->cast(SType::CAT8));
+    lhs = tmp.get();
+  }
+  if (!is_categorical(rhs->stype())) {
+    tmp.reset(rhs->cast(SType::CAT8));
+    rhs = tmp.get();
+  }
+  if (categorical_levels(rhs)->nrows > categorical_levels(lhs)->nrows) {
+    std::swap(lhs, rhs);
+    mode = mode == OpMode::N_to_One? OpMode::One_to_N :
+           mode == OpMode::One_to_N? OpMode::N_to_One : mode;
+  }
+  switch (lhs->stype()) {
+    case SType::CAT8:
+      return cat_binaryop<uint8_t>(opcode, lhs, rhs, nrows, mode);
+    case SType::CAT16:
+      return cat_binaryop<uint16_t>(opcode, lhs, rhs, nrows, mode);
+    default:
+      return cat_binaryop<uint32_t>(opcode, lhs, rhs, nrows, mode);
+  }
+}
+
+
+
+//------------------------------------------------------------------------------
+// Comparisons with None
+//------------------------------------------------------------------------------
+
+/**
+ * Equality comparisons between a BOOL column and a string or a temporal
+ * column. These are only allowed when the BOOL column is the literal `None`,
+ * so that `col == None` is evaluated as `isna(col)` (see
+ * expr_binaryop::resolve()). In general, values of different kinds are never
+ * equal, whereas the NAs are equal to each other.
+ */
+static Column* na_binaryop(size_t opcode, Column* lhs, Column* rhs,
+                           size_t nrows, OpMode mode)
+{
+  std::unique_ptr<Column> lna(unaryop(dt::unop::ISNA, lhs));
+  std::unique_ptr<Column> rna(unaryop(dt::unop::ISNA, rhs));
+  const int8_t* ldata = static_cast<const int8_t*>(lna->data());
+  const int8_t* rdata = static_cast<const int8_t*>(rna->data());
+  size_t lstep = mode == OpMode::One_to_N? 0 : 1;
+  size_t rstep = mode == OpMode::N_to_One? 0 : 1;
+  bool eq = (opcode == OpCode::Equal);
+  Column* res = Column::new_data_column(SType::BOOL, nrows);
+  int8_t* out = static_cast<int8_t*>(res->data_w());
+  dt::parallel_for_static(nrows,
+    [=](size_t i) {
+      out[i] = ((ldata[i * lstep] && rdata[i * rstep]) == eq);
+    });
+  return res;
+}
+
+
+
+//------------------------------------------------------------------------------
+// Fixed-width string comparisons
+//------------------------------------------------------------------------------
+
+// With the width known at compile time, the comparison of two padded values
+// compiles into a few integer (or vector) compares, without a call into
+// memcmp. The NAs compare equal to each other, and to nothing else.
+template <size_t W>
+static inline bool fstr_eq(const char* a, const char* b, size_t) {
+  return std::memcmp(a, b, W) == 0;
+}
+
+template <>
+inline bool fstr_eq<0>(const char* a, const char* b, size_t width) {
+  return std::memcmp(a, b, width) == 0;
+}
+
+template <size_t W>
+static void fstr_compare(const char* lhs, size_t lstep, const char* rhs,
+                         size_t rstep, size_t width, bool eq, int8_t* out,
+                         size_t nrows)
+{
+  dt::parallel_for_static(nrows,
+    [=](size_t i) {
+      out[i] = (fstr_eq<W>(lhs + i * lstep, rhs + i * rstep, width) == eq);
+    });
+}
+
+
+// Since the padding bytes (\0) are less than any other byte, and the strings
+// cannot end with a \0, the padded values are ordered by memcmp the same way
+// as the strings themselves. An NA is neither less nor greater than any
+// value, but it is "<=" and ">=" than another NA.
+static void fstr_order(const char* lhs, size_t lstep, const char* rhs,
+                       size_t rstep, size_t width, size_t opcode, int8_t* out,
+                       size_t nrows)
+{
+  bool na_eq = (opcode == OpCode::GreaterOrEqual ||
+                opcode == OpCode::LessOrEqual);
+  dt::parallel_for_static(nrows,
+    [=](size_t i) {
+      const char* x = lhs + i * lstep;
+      const char* y = rhs + i * rstep;
+      bool xna = FixedStringColumn::isna(x);
+      bool yna = FixedStringColumn::isna(y);
+      if (xna || yna) {
+        out[i] = xna && yna && na_eq;
+        return;
+      }
+      int r = std::memcmp(x, y, width);
+      switch (opcode) {
+        case OpCode::Greater:        out[i] = (r > 0); break;
+        case OpCode::Less:           out[i] = (r < 0); break;
+        case OpCode::GreaterOrEqual: out[i] = (r >= 0); break;
+        case OpCode::LessOrEqual:    out[i] = (r <= 0); break;
+      }
+    });
+}
+
+
+/**
+ * Comparisons where at least one side is an FSTR column. The other side is
+ * converted into FSTR too, and then both are brought to the same width, so
+ * that the values can be compared as blocks of memory.
+ */
+static Column* fstr_binaryop(size_t opcode, Column* lhs, Column* rhs,
+                             size_t nrows, OpMode mode)
+{
+  std::unique_ptr<Column> ltmp, rtmp;
+  if (lhs->stype() != SType::FSTR) {
+    ltmp.reset(fixed_width_strings(lhs));
+    lhs = ltmp.get();
+  }
+  if (rhs->stype() != SType::FSTR) {
+    rtmp.reset(fixed_width_strings(rhs));
+    rhs = rtmp.get();
+  }
+  size_t width = std::max(fstr_width(lhs), fstr_width(rhs));
+  if (fstr_width(lhs) < width) {
+    ltmp.reset(fixed_width_strings(lhs, width));
+    lhs = ltmp.get();
+  }
+  if (fstr_width(rhs) < width) {
+    rtmp.reset(fixed_width_strings(rhs, width));
+    rhs = rtmp.get();
+  }
+
+  const char* ldata = static_cast<const char*>(lhs->data());
+  const char* rdata = static_cast<const char*>(rhs->data());
+  size_t lstep = mode == OpMode::One_to_N? 0 : width;
+  size_t rstep = mode == OpMode::N_to_One? 0 : width;
+  bool eq = (opcode == OpCode::Equal);
+  Column* res = Column::new_data_column(SType::BOOL, nrows);
+  int8_t* out = static_cast<int8_t*>(res->data_w());
+  if (!eq && opcode != OpCode::NotEqual) {
+    fstr_order(ldata, lstep, rdata, rstep, width, opcode, out, nrows);
+    return res;
+  }
+  switch (width) {
+    case 1:  fstr_compare<1>(ldata, lstep, rdata, rstep, width, eq, out, nrows); break;
+    case 2:  fstr_compare<2>(ldata, lstep, rdata, rstep, width, eq, out, nrows); break;
+    case 4:  fstr_compare<4>(ldata, lstep, rdata, rstep, width, eq, out, nrows); break;
+    case 8:  fstr_compare<8>(ldata, lstep, rdata, rstep, width, eq, out, nrows); break;
+    case 16: fstr_compare<16>(ldata, lstep, rdata, rstep, width, eq, out, nrows); break;
+    default: fstr_compare<0>(ldata, lstep, rdata, rstep, width, eq, out, nrows);
+  }
+  return res;
+}
+
+
+
+//------------------------------------------------------------------------------
+// Decimal arithmetic
+//------------------------------------------------------------------------------
+
+using int128_t = __int128;
+
+// 10^n as a 128-bit integer, for n in the range 0..36
+static int128_t pow10_128(int n) {
+  int128_t res = 1;
+  for (int i = 0; i < n; ++i) res *= 10;
+  return res;
+}
+
+// x / p, rounded half away from zero
+static int128_t round_div(int128_t x, int128_t p) {
+  int128_t q = x / p;
+  int128_t r = x % p;
+  if (r >= 0? 2*r >= p : -2*r >= p) q += (x < 0)? -1 : 1;
+  return q;
+}
+
+
+/**
+ * Operations where at least one side is a decimal column, and the other is a
+ * boolean, integer or decimal. Both sides are read as DEC64 in their own
+ * scales, and then widened into 128-bit integers, where neither the
+ * rescaling nor the arithmetic can overflow:
+ *   - comparisons bring both sides to the same (larger) scale and compare
+ *     the widened values;
+ *   - for addition and subtraction both sides are brought to the larger
+ *     scale; for multiplication the scale of the result is the sum of the
+ *     scales of the operands, rounded down to the maximum scale of 18 if
+ *     necessary.
+ * The results of arithmetic are then narrowed back into DEC64. If some of
+ * them do not fit into int64, the scale of the result is reduced (rounding
+ * all values) until they do; values that do not fit even with scale 0
+ * become NAs.
+ *
+ * Division, and any operation involving a float, is carried out in FLOAT64.
+ */
+static Column* decimal_binaryop(size_t opcode, Column* lhs, Column* rhs,
+                                size_t nrows, OpMode mode)
+{
+  SType lhs_type = lhs->stype();
+  SType rhs_type = rhs->stype();
+  bool has_float = (info(lhs_type).ltype() == LType::REAL &&
+                    !is_decimal(lhs_type)) ||
+                   (info(rhs_type).ltype() == LType::REAL &&
+                    !is_decimal(rhs_type));
+  bool is_relational = (opcode >= OpCode::Equal &&
+                        opcode <= OpCode::LessOrEqual);
+  bool is_exact = (opcode == OpCode::Plus || opcode == OpCode::Minus ||
+                   opcode == OpCode::Multiply || is_relational);
+  std::unique_ptr<Column> ltmp, rtmp;
+  if (has_float || !is_exact) {
+    if (is_decimal(lhs_type)) {
+      ltmp.reset(lhs->cast(SType::FLOAT64));
+      lhs = ltmp.get();
+    }
+    if (is_decimal(rhs_type)) {
+      rtmp.reset(rhs->cast(SType::FLOAT64));
+      rhs = rtmp.get();
+    }
+    return binaryop(opcode, lhs, rhs);
+  }
+
+  int lscale = is_decimal(lhs_type)? decimal_scale(lhs) : 0;
+  int rscale = is_decimal(rhs_type)? decimal_scale(rhs) : 0;
+  ltmp.reset(decimal_column(lhs, SType::DEC64, lscale));
+  rtmp.reset(decimal_column(rhs, SType::DEC64, rscale));
+  const int64_t* ldata = static_cast<const int64_t*>(ltmp->data());
+  const int64_t* rdata = static_cast<const int64_t*>(rtmp->data());
+  size_t lstep = mode == OpMode::One_to_N? 0 : 1;
+  size_t rstep = mode == OpMode::N_to_One? 0 : 1;
+
+  int scale = std::max(lscale, rscale);
+  int128_t lmul = pow10_128(scale - lscale);
+  int128_t rmul = pow10_128(scale - rscale);
+
+  if (is_relational) {
+    // Result when one or both of the operands are NA: two NAs are equal
+    bool na_eq = (opcode == OpCode::Equal ||
+                  opcode == OpCode::GreaterOrEqual ||
+                  opcode == OpCode::LessOrEqual);
+    bool ne = (opcode == OpCode::NotEqual);
+    Column* res = Column::new_data_column(SType::BOOL, nrows);
+    int8_t* out = static_cast<int8_t*>(res->data_w());
+    dt::parallel_for_static(nrows,
+      [&](size_t i) {
+        int64_t x = ldata[i * lstep];
+        int64_t y = rdata[i * rstep];
+        bool xna = ISNA<int64_t>(x);
+        bool yna = ISNA<int64_t>(y);
+        if (xna || yna) {
+          out[i] = (xna && yna)? !ne && na_eq : ne;
+          return;
+        }
+        int128_t vx = static_cast<int128_t>(x) * lmul;
+        int128_t vy = static_cast<int128_t>(y) * rmul;
+        switch (opcode) {
+          case OpCode::Equal:          out[i] = (vx == vy); break;
+          case OpCode::NotEqual:       out[i] = (vx != vy); break;
+          case OpCode::Greater:        out[i] = (vx > vy); break;
+          case OpCode::Less:           out[i] = (vx < vy); break;
+          case OpCode::GreaterOrEqual: out[i] = (vx >= vy); break;
+          case OpCode::LessOrEqual:    out[i] = (vx <= vy); break;
+        }
+      });
+    return res;
+  }
+
+  int128_t rounding = 1;
+  if (opcode == OpCode::Multiply) {
+    lmul = rmul = 1;
+    scale = lscale + rscale;
+    if (scale > dt::MAX_DECIMAL_SCALE) {
+      rounding = pow10_128(scale - dt::MAX_DECIMAL_SCALE);
+      scale = dt::MAX_DECIMAL_SCALE;
+    }
+  }
+  // The largest of the magnitudes of the results is computed alongside the
+  // results themselves (NAs are stored as 0, and marked in `isna`).
+  std::unique_ptr<int128_t[]> values(new int128_t[nrows]);
+  std::unique_ptr<bool[]> isna(new bool[nrows]);
+  int128_t maxabs = 0;
+  for (size_t i = 0; i < nrows; ++i) {
+    int64_t x = ldata[i * lstep];
+    int64_t y = rdata[i * rstep];
+    isna[i] = ISNA<int64_t>(x) || ISNA<int64_t>(y);
+    if (isna[i]) {
+      values[i] = 0;
+      continue;
+    }
+    int128_t vx = static_cast<int128_t>(x) * lmul;
+    int128_t vy = static_cast<int128_t>(y) * rmul;
+    int128_t v = opcode == OpCode::Plus?  vx + vy :
+                 opcode == OpCode::Minus? vx - vy :
+                                          round_div(vx * vy, rounding);
+    values[i] = v;
+    int128_t a = v < 0? -v : v;
+    if (a > maxabs) maxabs = a;
+  }
+
+  // Reduce the scale until the largest value fits into int64 (INT64_MIN is
+  // the NA, so the range is symmetric).
+  const int128_t limit = std::numeric_limits<int64_t>::max();
+  int res_scale = scale;
+  while (res_scale > 0 &&
+         round_div(maxabs, pow10_128(scale - res_scale)) > limit) {
+    res_scale--;
+  }
+  int128_t div = pow10_128(scale - res_scale);
+  Column* res = new_decimal_column(SType::DEC64, nrows, res_scale);
+  int64_t* out = static_cast<int64_t*>(res->data_w());
+  dt::parallel_for_static(nrows,
+    [&](size_t i) {
+      int128_t v = isna[i]? 0 : round_div(values[i], div);
+      out[i] = (isna[i] || v > limit || v < -limit)
+                  ? GETNA<int64_t>() : static_cast<int64_t>(v);
+    });
+  return res;
+}
+
+
+
 //------------------------------------------------------------------------------
 // Exported binaryop function
 //------------------------------------------------------------------------------
@@ -544,25 +1128,76 @@ Column* binaryop(size_t opcode, Column* lhs, Column* rhs)
   size_t nrows = std::max(lhs_nrows, rhs_nrows);
   SType lhs_type = lhs->stype();
   SType rhs_type = rhs->stype();
+  SType res_type = SType::VOID;
+  OpMode mode = lhs_nrows == rhs_nrows? OpMode::N_to_N :
+                rhs_nrows == 1? OpMode::N_to_One :
+                lhs_nrows == 1? OpMode::One_to_N : OpMode::Error;
+  LType other_ltype =
+      info(lhs_type == SType::BOOL? rhs_type : lhs_type).ltype();
+  if ((lhs_type == SType::BOOL || rhs_type == SType::BOOL) &&
+      (other_ltype == LType::STRING || other_ltype == LType::DATETIME) &&
+      (opcode == OpCode::Equal || opcode == OpCode::NotEqual) &&
+      mode != OpMode::Error) {
+    return na_binaryop(opcode, lhs, rhs, nrows, mode);
+  }
+  if ((is_categorical(lhs_type) || is_categorical(rhs_type)) &&
+      mode != OpMode::Error) {
+    if (opcode == OpCode::Equal || opcode == OpCode::NotEqual) {
+      return categorical_binaryop(opcode, lhs, rhs, nrows, mode);
+    }
+    // Ordered comparisons are done on the strings of the categorical values
+    std::unique_ptr<Column> ltmp, rtmp;
+    if (is_categorical(lhs_type)) {
+      ltmp.reset(lhs->cast(SType::STR32));
+      lhs = ltmp.get();
+    }
+    if (is_categorical(rhs_type)) {
+      rtmp.reset(rhs->cast(SType::STR32));
+      rhs = rtmp.get();
+    }
+    return binaryop(opcode, lhs, rhs);
+  }
+  if ((lhs_type == SType::FSTR || rhs_type == SType::FSTR) &&
+      opcode >= OpCode::Equal && opcode <= OpCode::LessOrEqual &&
+      mode != OpMode::Error) {
+    return fstr_binaryop(opcode, lhs, rhs, nrows, mode);
+  }
+  if ((is_decimal(lhs_type) || is_decimal(rhs_type)) &&
+      mode != OpMode::Error) {
+    return decimal_binaryop(opcode, lhs, rhs, nrows, mode);
+  }
+  // Numeric mappers operate on the raw data arrays, while the string mappers
+  // need access to the string columns themselves.
+  bool strings = !lhs->is_fixedwidth();
   void* params[3];
-  params[0] = lhs;
-  params[1] = rhs;
+  params[0] = strings? static_cast<void*>(lhs) : const_cast<void*>(lhs->data());
+  params[1] = strings? static_cast<void*>(rhs) : const_cast<void*>(rhs->data());
   params[2] = nullptr;
 
   mapperfn mapfn = nullptr;
-  mapfn = resolve0(lhs_type, rhs_type, opcode, params, nrows,
-                   lhs_nrows == rhs_nrows? OpMode::N_to_N :
-                   rhs_nrows == 1? OpMode::N_to_One :
-                   lhs_nrows == 1? OpMode::One_to_N : OpMode::Error);
+  mapfn = resolve0(lhs_type, rhs_type, opcode, params, &res_type, mode);
   if (!mapfn) {
     throw RuntimeError()
       << "Unable to apply op " << opcode << " to column1(stype=" << lhs_type
       << ", nrows=" << lhs->nrows << ") and column2(stype=" << rhs_type
       << ", nrows=" << rhs->nrows << ")";
   }
+  Column* res = Column::new_data_column(res_type, nrows);
+  params[2] = res->data_w();
   (*mapfn)(0, static_cast<int64_t>(nrows), params);
 
-  return static_cast<Column*>(params[2]);
+  return res;
+}
+
+
+mapperfn binaryop_mapper(size_t opcode, SType lhs_type, SType rhs_type,
+                         SType* res_type)
+{
+  if (!dt::is_fusable_stype(lhs_type) || !dt::is_fusable_stype(rhs_type)) {
+    return nullptr;
+  }
+  return resolve0(lhs_type, rhs_type, opcode, nullptr, res_type,
+                  OpMode::N_to_N);
 }
 
 };  // namespace expr
@@ -173,7 +173,8 @@ void by_node::execute(workframe& wf) const {
     }
   }
   // if (n_group_columns) {
-    auto res = dt0->group(spec);
+    auto res = dt0->prefers_hash_grouping(spec)? dt0->group_hashed(spec)
+                                               : dt0->group(spec);
     wf.gb = std::move(res.second);
     wf.apply_rowindex(res.first);
   // } else {
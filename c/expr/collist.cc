@@ -36,7 +36,8 @@ static const strvec typenames =
 static stypevec stBOOL = {SType::BOOL};
 static stypevec stINT = {SType::INT8, SType::INT16, SType::INT32, SType::INT64};
 static stypevec stFLOAT = {SType::FLOAT32, SType::FLOAT64};
-static stypevec stSTR = {SType::STR32, SType::STR64};
+static stypevec stSTR = {SType::STR32, SType::STR64, SType::FSTR,
+                          SType::CAT8, SType::CAT16, SType::CAT32};
 static stypevec stOBJ = {SType::OBJ};
 
 
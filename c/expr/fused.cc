@@ -0,0 +1,154 @@
+//------------------------------------------------------------------------------
+// Copyright 2018 H2O.ai
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//------------------------------------------------------------------------------
+#include <algorithm>          // std::min
+#include <cstring>            // std::memcpy
+#include "expr/base_expr.h"
+#include "expr/fused.h"
+#include "expr/workframe.h"
+#include "parallel/api.h"
+#include "column.h"
+namespace dt {
+
+
+//------------------------------------------------------------------------------
+// fused_plan / fused_context
+//------------------------------------------------------------------------------
+
+constexpr size_t fused_plan::BLOCK_SIZE;
+constexpr size_t fused_plan::NO_ROWS;
+
+size_t fused_plan::add_slot() {
+  size_t slot = nslots++;
+  if (nslots > max_slots) max_slots = nslots;
+  return slot;
+}
+
+bool fused_plan::set_nrows(size_t n) {
+  if (nrows == NO_ROWS) nrows = n;
+  return nrows == n;
+}
+
+
+// Each slot holds BLOCK_SIZE elements of at most 8 bytes each, so the scratch
+// is allocated as an array of doubles to guarantee the proper alignment.
+fused_context::fused_context(const fused_plan& plan)
+  : scratch(new double[std::max(plan.max_slots, size_t(1)) *
+                       fused_plan::BLOCK_SIZE]) {}
+
+void* fused_context::buffer(size_t slot) const {
+  return scratch.get() + slot * fused_plan::BLOCK_SIZE;
+}
+
+
+bool is_fusable_stype(SType stype) {
+  switch (stype) {
+    case SType::BOOL:
+    case SType::INT8:
+    case SType::INT16:
+    case SType::INT32:
+    case SType::INT64:
+    case SType::FLOAT32:
+    case SType::FLOAT64: return true;
+    default:             return false;
+  }
+}
+
+
+
+//------------------------------------------------------------------------------
+// Gathering column data through a RowIndex
+//------------------------------------------------------------------------------
+
+template <typename T>
+static void gather(const void* data, const RowIndex& ri,
+                   size_t row0, size_t n, void* out)
+{
+  const T* src = static_cast<const T*>(data);
+  T* dest = static_cast<T*>(out) - row0;
+  ri.iterate(row0, row0 + n, 1,
+    [&](size_t i, size_t j) {
+      dest[i] = (j == RowIndex::NA)? GETNA<T>() : src[j];
+    });
+}
+
+void* gather_block(const void* data, SType stype, const RowIndex& ri,
+                   size_t row0, size_t n, void* out)
+{
+  switch (stype) {
+    case SType::BOOL:
+    case SType::INT8:    gather<int8_t>(data, ri, row0, n, out); break;
+    case SType::INT16:   gather<int16_t>(data, ri, row0, n, out); break;
+    case SType::INT32:   gather<int32_t>(data, ri, row0, n, out); break;
+    case SType::INT64:   gather<int64_t>(data, ri, row0, n, out); break;
+    case SType::FLOAT32: gather<float>(data, ri, row0, n, out); break;
+    case SType::FLOAT64: gather<double>(data, ri, row0, n, out); break;
+    default: xassert(false);
+  }
+  return out;
+}
+
+
+
+//------------------------------------------------------------------------------
+// Main evaluation loop
+//------------------------------------------------------------------------------
+
+colptr evaluate_fused(base_expr* root, workframe& wf) {
+  fused_plan plan;
+  SType stype = root->prepare_fused(plan, wf);
+  if (stype == SType::VOID || plan.nrows == fused_plan::NO_ROWS) {
+    return colptr();
+  }
+  constexpr size_t BLOCK_SIZE = fused_plan::BLOCK_SIZE;
+  size_t nrows = plan.nrows;
+  size_t elemsize = info(stype).elemsize();
+  colptr res(Column::new_data_column(stype, nrows));
+  char* res_data = static_cast<char*>(res->data_w());
+
+  size_t nblocks = (nrows + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  size_t nthreads = std::min(nblocks, dt::num_threads_in_pool());
+
+  // Blocks are distributed among threads in a round-robin fashion. Each
+  // thread owns a separate scratch space for the intermediate results.
+  auto process = [&](size_t ith, size_t nth) {
+    fused_context ctx(plan);
+    for (size_t b = ith; b < nblocks; b += nth) {
+      size_t row0 = b * BLOCK_SIZE;
+      size_t n = std::min(BLOCK_SIZE, nrows - row0);
+      void* out = res_data + row0 * elemsize;
+      const void* block = root->evaluate_block(ctx, row0, n, out);
+      if (block != out) std::memcpy(out, block, n * elemsize);
+    }
+  };
+  if (nthreads <= 1) {
+    process(0, 1);
+  } else {
+    dt::parallel_region(nthreads,
+      [&] {
+        process(dt::this_thread_index(), dt::num_threads_in_team());
+      });
+  }
+  return res;
+}
+
+
+}  // namespace dt
@@ -0,0 +1,113 @@
+//------------------------------------------------------------------------------
+// Copyright 2018 H2O.ai
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//------------------------------------------------------------------------------
+#ifndef dt_EXPR_FUSED_h
+#define dt_EXPR_FUSED_h
+#include <memory>       // std::unique_ptr
+#include "rowindex.h"   // RowIndex
+#include "types.h"      // SType
+class Column;
+namespace dt {
+
+class base_expr;
+class workframe;
+
+
+/**
+ * Fused evaluation of elementwise expression trees.
+ *
+ * An expression such as `(f.A + f.B) * f.C - 1`, when evaluated eagerly,
+ * creates a full-size temporary column at every node of the tree. Instead,
+ * if all nodes in the tree are elementwise operations over fixed-width
+ * columns, the tree can be evaluated in blocks of `BLOCK_SIZE` rows: each
+ * thread pushes one block through the entire tree, keeping all intermediate
+ * results in small per-thread buffers that stay in cache. Only the final
+ * result column is allocated.
+ *
+ * Fusion is arranged in two stages. First, `base_expr::prepare_fused()` is
+ * called on the root of the tree. Each node checks whether it can take part
+ * in the fused evaluation, resolves its kernel, requests scratch buffers
+ * ("slots") for its children from the `fused_plan`, and returns the stype of
+ * its result. If any node returns `SType::VOID`, the tree is evaluated
+ * eagerly as before.
+ *
+ * Then, `base_expr::evaluate_block()` is invoked for each block of rows. The
+ * function returns a pointer to the values of the node for rows
+ * `[row0, row0 + n)`. The result is either written into the `out` buffer
+ * supplied by the caller, or (for nodes that can expose their data directly,
+ * such as plain columns) it may point to some other memory.
+ */
+struct fused_plan {
+  static constexpr size_t BLOCK_SIZE = 4096;
+  static constexpr size_t NO_ROWS = size_t(-1);
+
+  size_t nrows;
+  size_t nslots;
+  size_t max_slots;
+
+  fused_plan() : nrows(NO_ROWS), nslots(0), max_slots(0) {}
+
+  // Slots are allocated in a stack-like manner: a node's scratch buffers are
+  // only needed while that node is being evaluated, so once the node has
+  // been prepared, it releases its slots so that they can be reused by its
+  // siblings.
+  size_t add_slot();
+  void release_slots(size_t mark) { nslots = mark; }
+  bool set_nrows(size_t n);
+};
+
+
+class fused_context {
+  private:
+    std::unique_ptr<double[]> scratch;
+
+  public:
+    explicit fused_context(const fused_plan& plan);
+    void* buffer(size_t slot) const;
+};
+
+
+/**
+ * Evaluate the expression `root` in fused mode, returning the result column.
+ * If the expression cannot be fused, an empty pointer is returned and the
+ * caller should fall back to the eager evaluation.
+ */
+std::unique_ptr<Column> evaluate_fused(base_expr* root, workframe& wf);
+
+
+/**
+ * Return true if columns of type `stype` can participate in fused evaluation
+ * (i.e. they are fixed-width and their elements fit into a scratch slot).
+ */
+bool is_fusable_stype(SType stype);
+
+
+/**
+ * Fill `out` with `n` values of the column `data` (of type `stype`) at rows
+ * `ri[row0], ..., ri[row0 + n - 1]`. The NA entries in the rowindex produce
+ * NA values. Returns `out`.
+ */
+void* gather_block(const void* data, SType stype, const RowIndex& ri,
+                   size_t row0, size_t n, void* out);
+
+
+}  // namespace dt
+#endif
@@ -19,9 +19,13 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 //------------------------------------------------------------------------------
+#include <algorithm>          // std::min, std::max
+#include <memory>             // std::unique_ptr
+#include <vector>             // std::vector
 #include "expr/base_expr.h"
 #include "expr/i_node.h"
 #include "expr/workframe.h"   // dt::workframe
+#include "blockindex.h"
 #include "frame/py_frame.h"
 #include "python/_all.h"
 #include "python/string.h"
@@ -30,6 +34,88 @@ namespace dt {
 
 
 
+//------------------------------------------------------------------------------
+// Frames stored in blocks
+//------------------------------------------------------------------------------
+
+/**
+ * Return the BlockIndex describing how the columns of the root frame are
+ * split into blocks (i.e. the frame was opened from a Jay file), or nullptr
+ * if the frame has no such columns, or if the workframe is not a plain
+ * single-frame selection.
+ */
+static const BlockIndex* root_block_layout(workframe& wf) {
+  if (wf.nframes() != 1 || wf.get_rowindex(0)) return nullptr;
+  const BlockIndex* layout = nullptr;
+  for (const Column* col : wf.get_datatable(0)->columns) {
+    layout = col->get_block_index();
+    if (layout) break;
+  }
+  return (layout && layout->nblocks() > 1)? layout : nullptr;
+}
+
+
+/**
+ * Create a frame out of the blocks `ids` of the root frame's columns. The
+ * columns that are stored in blocks with the same `layout` select only
+ * these blocks, which are loaded lazily; other columns are sliced with a
+ * rowindex.
+ */
+static std::unique_ptr<DataTable> select_blocks(
+    workframe& wf, const BlockIndex& layout, const std::vector<size_t>& ids)
+{
+  DataTable* dt0 = wf.get_datatable(0);
+  RowIndex blocks_ri = layout.rows(ids);
+  colvec columns;
+  columns.reserve(dt0->ncols);
+  for (const Column* col : dt0->columns) {
+    const BlockIndex* bi = col->get_block_index();
+    columns.push_back(bi && bi->same_layout(layout)
+                      ? bi->select(ids)
+                      : col->shallowcopy(blocks_ri * col->rowindex()));
+  }
+  std::unique_ptr<DataTable> dt1(new DataTable(std::move(columns), dt0));
+  dt1->set_nkeys_unsafe(dt0->get_nkeys());
+  return dt1;
+}
+
+
+/**
+ * Apply the slice `start, count, step` to the workframe. If the columns of
+ * the root frame are stored in blocks and the slice touches only some of
+ * them, then the root frame is replaced with a frame assembled from these
+ * blocks only, so that the remaining blocks are never loaded (for example,
+ * `DT[:10, :]` on a large Jay file decodes only the first block). This is
+ * done in the SELECT mode only.
+ */
+static void apply_slice(workframe& wf, size_t start, size_t count,
+                        size_t step)
+{
+  const BlockIndex* layout = root_block_layout(wf);
+  if (layout && count && wf.get_mode() == EvalMode::SELECT) {
+    size_t last = start + (count - 1) * step;
+    size_t row0 = std::min(start, last);
+    size_t row1 = std::max(start, last);
+    std::vector<size_t> ids;
+    size_t offset0 = 0;
+    for (size_t i = 0, offset = 0; i < layout->nblocks(); ++i) {
+      size_t n = layout->block(i).nrows;
+      if (offset <= row1 && row0 < offset + n) {
+        if (ids.empty()) offset0 = offset;
+        ids.push_back(i);
+      }
+      offset += n;
+    }
+    if (ids.size() < layout->nblocks()) {
+      wf.replace_root(select_blocks(wf, *layout, ids));
+      start -= offset0;
+    }
+  }
+  wf.apply_rowindex(RowIndex(start, count, step));
+}
+
+
+
 //------------------------------------------------------------------------------
 // allrows_in
 //------------------------------------------------------------------------------
@@ -87,8 +173,7 @@ void onerow_in::post_init_check(workframe& wf) {
 
 
 void onerow_in::execute(workframe& wf) {
-  size_t start = static_cast<size_t>(irow);
-  wf.apply_rowindex(RowIndex(start, 1, 1));
+  apply_slice(wf, static_cast<size_t>(irow), 1, 1);
 }
 
 
@@ -151,7 +236,7 @@ void slice_in::execute(workframe& wf) {
           << " row" << (nrows == 1? "" : "s");
     }
   }
-  wf.apply_rowindex(RowIndex(start, count, step));
+  apply_slice(wf, start, count, step);
 }
 
 
@@ -265,6 +350,9 @@ class expr_in : public i_node {
     explicit expr_in(py::robj src);
     void execute(workframe&) override;
     void execute_grouped(workframe&) override;
+
+  private:
+    bool execute_pruned(workframe&);
 };
 
 
@@ -283,12 +371,57 @@ void expr_in::execute(workframe& wf) {
     throw TypeError() << "Filter expression must be boolean, instead it "
         "was of type " << st;
   }
+  if (execute_pruned(wf)) return;
   auto col = expr->evaluate_eager(wf);
   RowIndex res(col.get());
   wf.apply_rowindex(res);
 }
 
 
+/**
+ * If the columns of the root frame are stored in blocks with per-block stats
+ * (i.e. the frame was opened from a Jay file), then the blocks that cannot
+ * contain any rows satisfying the filter are skipped. A new frame is
+ * assembled out of the remaining blocks of all columns, and the filter is
+ * evaluated on that frame only. Neither the skipped blocks, nor the columns
+ * not referenced by the filter are loaded.
+ *
+ * When selecting, the new frame replaces the root of the workframe, so that
+ * the `j` columns are taken from the remaining blocks too. When updating or
+ * deleting, the resulting rowindex is mapped back to the rows of the
+ * original frame.
+ *
+ * Returns false if the blocks could not be pruned.
+ */
+bool expr_in::execute_pruned(workframe& wf) {
+  const BlockIndex* layout = root_block_layout(wf);
+  if (!layout) return false;
+
+  std::vector<int8_t> mask(layout->nblocks(), 1);
+  if (!expr->prune_blocks(wf, *layout, mask)) return false;
+  std::vector<size_t> ids;
+  for (size_t i = 0; i < mask.size(); ++i) {
+    if (mask[i]) ids.push_back(i);
+  }
+  if (ids.size() == mask.size()) return false;
+
+  RowIndex blocks_ri = layout->rows(ids);
+  std::unique_ptr<DataTable> dt1 = select_blocks(wf, *layout, ids);
+
+  workframe wf1(dt1.get());
+  expr->resolve(wf1);
+  auto col = expr->evaluate_eager(wf1);
+  RowIndex res(col.get());
+  if (wf.get_mode() == EvalMode::SELECT) {
+    wf.replace_root(std::move(dt1));
+    wf.apply_rowindex(res);
+  } else {
+    wf.apply_rowindex(res * blocks_ri);
+  }
+  return true;
+}
+
+
 void expr_in::execute_grouped(workframe&) {
   throw NotImplError() << "expr_in::execute_grouped() not implemented yet";
 }
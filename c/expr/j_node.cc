@@ -20,6 +20,7 @@
 // IN THE SOFTWARE.
 //------------------------------------------------------------------------------
 #include <numeric>            // std::iota
+#include <vector>             // std::vector
 #include "expr/base_expr.h"
 #include "expr/collist.h"
 #include "expr/j_node.h"
@@ -80,10 +81,10 @@ void allcols_jn::select(workframe& wf) {
     const RowIndex& rii = wf.get_rowindex(i);
     const strvec& dti_names = dti->get_names();
 
-    size_t j0 = wf.is_naturally_joined(i)? dti->get_nkeys() : 0;
-    wf.reserve(dti->ncols - j0);
+    wf.reserve(dti->ncols);
     const by_node& by = wf.get_by_node();
-    for (size_t j = j0; j < dti->ncols; ++j) {
+    for (size_t j = 0; j < dti->ncols; ++j) {
+      if (wf.is_join_column(i, j)) continue;
       if (by.has_group_column(j)) continue;
       wf.add_column(dti->columns[j], rii, std::string(dti_names[j]));
     }
@@ -264,6 +265,7 @@ class exprlist_jn : public j_node {
 
   private:
     void _init_names(workframe&);
+    void _evaluate_reducers(workframe&, std::vector<colptr>&);
 };
 
 
@@ -291,11 +293,38 @@ void exprlist_jn::select(workframe& wf) {
   size_t n = exprs.size();
   xassert(names.size() == n);
 
+  std::vector<colptr> cols(n);
+  _evaluate_reducers(wf, cols);
+
   wf.reserve(n);
   RowIndex ri0;  // empty rowindex
   for (size_t i = 0; i < n; ++i) {
-    auto col = exprs[i]->evaluate_eager(wf);
-    wf.add_column(col.get(), ri0, std::move(names[i]));
+    if (!cols[i]) cols[i] = exprs[i]->evaluate_eager(wf);
+    wf.add_column(cols[i].get(), ri0, std::move(names[i]));
+  }
+}
+
+
+// When there are several reducers in a grouped query, evaluate all of them
+// in one pass over the groups (see `expr_reduce::evaluate_batch()`). The
+// results are stored into `cols`, leaving other entries empty.
+void exprlist_jn::_evaluate_reducers(workframe& wf,
+                                     std::vector<colptr>& cols)
+{
+  if (!wf.has_groupby()) return;
+  std::vector<expr::expr_reduce*> reducers;
+  std::vector<size_t> indices;
+  for (size_t i = 0; i < exprs.size(); ++i) {
+    auto redexpr = dynamic_cast<expr::expr_reduce*>(exprs[i].get());
+    if (redexpr) {
+      reducers.push_back(redexpr);
+      indices.push_back(i);
+    }
+  }
+  if (reducers.size() < 2) return;
+  auto res = expr::expr_reduce::evaluate_batch(reducers, wf);
+  for (size_t k = 0; k < indices.size(); ++k) {
+    cols[indices[k]] = std::move(res[k]);
   }
 }
 
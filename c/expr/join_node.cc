@@ -22,6 +22,8 @@
 #include "expr/join_node.h"
 #include "datatable.h"
 #include "python/arg.h"
+#include "python/list.h"
+#include "python/string.h"
 namespace py {
 
 
@@ -30,7 +32,7 @@ namespace py {
 //------------------------------------------------------------------------------
 
 PKArgs ojoin::pyobj::Type::args___init__(
-    1, 0, 0, false, false, {"frame"}, "__init__", nullptr);
+    1, 0, 2, false, false, {"frame", "on", "how"}, "__init__", nullptr);
 
 const char* ojoin::pyobj::Type::classname() {
   return "datatable.join";
@@ -64,14 +66,44 @@ void ojoin::pyobj::m__init__(PKArgs& args) {
     throw TypeError() << "The argument to join() must be a Frame";
   }
   DataTable* jdt = join_frame.to_datatable();
-  if (jdt->get_nkeys() == 0) {
-    throw ValueError() << "The join frame is not keyed";
+
+  const Arg& arg_on = args[1];
+  if (arg_on.is_none_or_undefined()) {
+    if (jdt->get_nkeys() == 0) {
+      throw ValueError() << "The join frame is not keyed, and parameter `on` "
+          "was not specified";
+    }
+    join_on = py::None();
+  } else {
+    strvec names = arg_on.is_string()? strvec {arg_on.to_string()}
+                                     : arg_on.to_stringlist();
+    if (names.empty()) {
+      throw ValueError() << "Parameter `on` in join() cannot be empty";
+    }
+    olist on_list(names.size());
+    for (size_t i = 0; i < names.size(); ++i) {
+      jdt->xcolindex(ostring(names[i]));  // check that the column exists
+      on_list.set(i, ostring(names[i]));
+    }
+    join_on = std::move(on_list);
+  }
+
+  std::string how_str = args[2].to<std::string>("left");
+  if      (how_str == "left")  how = JoinType::LEFT;
+  else if (how_str == "inner") how = JoinType::INNER;
+  else if (how_str == "right") how = JoinType::RIGHT;
+  else if (how_str == "outer") how = JoinType::OUTER;
+  else {
+    throw ValueError() << "Invalid value `how=\"" << how_str << "\"` in "
+        "join(): expected one of \"left\", \"inner\", \"right\" or "
+        "\"outer\"";
   }
 }
 
 
 void ojoin::pyobj::m__dealloc__() {
   join_frame = nullptr;  // Releases the stored oobj
+  join_on = nullptr;
 }
 
 
@@ -94,6 +126,48 @@ DataTable* ojoin::get_datatable() const {
 }
 
 
+JoinType ojoin::get_how() const {
+  auto w = static_cast<pyobj*>(v);
+  return w->how;
+}
+
+
+void ojoin::get_join_columns(const DataTable* xdt,
+                             intvec& xcols, intvec& jcols) const
+{
+  auto w = static_cast<pyobj*>(v);
+  const DataTable* jdt = w->join_frame.to_datatable();
+  xcols.clear();
+  jcols.clear();
+  if (w->join_on.is_none()) {
+    size_t k = jdt->get_nkeys();  // Number of join columns
+    xassert(k > 0);
+    py::otuple jnames = jdt->get_pynames();
+    for (size_t i = 0; i < k; ++i) {
+      int64_t index = xdt->colindex(jnames[i]);
+      if (index == -1) {
+        throw ValueError() << "Key column `" << jnames[i].to_string() << "` "
+            "does not exist in the left Frame";
+      }
+      xcols.push_back(static_cast<size_t>(index));
+      jcols.push_back(i);
+    }
+  } else {
+    olist on_list = w->join_on.to_pylist();
+    for (size_t i = 0; i < on_list.size(); ++i) {
+      robj name = on_list[i];
+      int64_t index = xdt->colindex(name);
+      if (index == -1) {
+        throw ValueError() << "Column `" << name.to_string() << "` does not "
+            "exist in the left Frame";
+      }
+      xcols.push_back(static_cast<size_t>(index));
+      jcols.push_back(jdt->xcolindex(name));
+    }
+  }
+}
+
+
 bool ojoin::check(PyObject* v) {
   if (!v) return false;
   auto typeptr = reinterpret_cast<PyObject*>(&pyobj::Type::type);
@@ -23,6 +23,7 @@
 #define dt_EXPR_JOIN_NODE_h
 #include "python/ext_type.h"
 #include "python/obj.h"
+#include "datatable.h"       // JoinType, intvec
 
 namespace py {
 
@@ -33,6 +34,9 @@ class ojoin : public oobj
   class pyobj : public PyObject {
     public:
       oobj join_frame;
+      oobj join_on;   // list of column names, or None
+      JoinType how;
+      size_t : 56;
 
       class Type : public ExtType<pyobj> {
         public:
@@ -62,6 +66,14 @@ class ojoin : public oobj
     ojoin& operator=(ojoin&&) = default;
 
     DataTable* get_datatable() const;
+    JoinType get_how() const;
+
+    // Find the indices of columns in the left frame `xdt` (`xcols`) and in
+    // the join frame (`jcols`) on which the frames should be joined. These
+    // are either the columns given in the `on` parameter, or the key columns
+    // of the join frame.
+    void get_join_columns(const DataTable* xdt,
+                          intvec& xcols, intvec& jcols) const;
 
     static bool check(PyObject* v);
     static void init(PyObject* m);
@@ -20,6 +20,13 @@ typedef void (*gmapperfn)(const int32_t* groups, int32_t grp, void** params);
 Column* unaryop(dt::unop opcode, Column* arg);
 Column* binaryop(size_t opcode, Column* lhs, Column* rhs);
 
+// Return the elementwise mapper function for an operation over fixed-width
+// arrays of the given stypes, or nullptr if no such function exists. The
+// mapper's `params` are raw pointers to the input and output data.
+mapperfn unaryop_mapper(dt::unop opcode, SType arg_type, SType* res_type);
+mapperfn binaryop_mapper(size_t opcode, SType lhs_type, SType rhs_type,
+                         SType* res_type);
+
 };
 
 #endif
@@ -5,13 +5,18 @@
 //
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
+#include <algorithm>         // std::min
 #include <cmath>             // std::sqrt
 #include <limits>            // std::numeric_limits<?>::max, ::infinity
 #include <memory>            // std::unique_ptr
+#include <type_traits>       // std::is_integral
 #include <unordered_map>     // std::unordered_map
+#include <vector>            // std::vector
+#include "codec.h"           // dt::Codec
 #include "expr/base_expr.h"  // ReduceOp
 #include "parallel/api.h"
 #include "types.h"
+#include "utils/decimal.h"
 namespace expr {
 
 
@@ -24,6 +29,20 @@ constexpr T infinity() {
 
 using colptr = std::unique_ptr<Column>;
 
+
+// Pairwise summation of the values `get(i0), ..., get(i1 - 1)`: the rounding
+// error grows as O(log n), rather than O(n) as in the naive summation.
+template <typename U, typename F>
+static U pairwise_sum(size_t i0, size_t i1, F get) {
+  if (i1 - i0 <= 8) {
+    U sum = 0;
+    for (size_t i = i0; i < i1; ++i) sum += get(i);
+    return sum;
+  }
+  size_t mid = (i0 + i1) / 2;
+  return pairwise_sum<U>(i0, mid, get) + pairwise_sum<U>(mid, i1, get);
+}
+
 static const char* reducer_names[REDUCEOP_COUNT] = {
   "", "mean", "min", "max", "stdev", "first", "sum", "count", "median"
 };
@@ -36,8 +55,25 @@ static const char* reducer_names[REDUCEOP_COUNT] = {
 using reducer_fn = void (*)(const RowIndex& ri, size_t row0, size_t row1,
                             const void* input, void* output, size_t grp);
 
+using combine_fn = void (*)(const void* states, size_t nstates, void* output);
+
+// Each reducer may come in two versions: the regular one `f`, and the one
+// that assumes the input column contains no NAs (`f_nona`). The latter can
+// skip all NA checks, and is used when the column's stats indicate that it
+// is NA-free.
+//
+// In addition, a reducer may support partial evaluation: the rows are split
+// into chunks, `f_partial` (or `f_partial_nona`) computes the state of the
+// reduction for each chunk (writing it into the array of states, each of
+// size `state_size`), and then `f_combine` merges these states into the
+// final value. This allows reductions without a groupby to run in parallel.
 struct Reducer {
   reducer_fn f;
+  reducer_fn f_nona;
+  reducer_fn f_partial;
+  reducer_fn f_partial_nona;
+  combine_fn f_combine;
+  size_t state_size;
   SType output_stype;
   size_t : 56;
 };
@@ -51,7 +87,31 @@ class ReducerLibrary {
     void add(ReduceOp op, reducer_fn f, SType inp_stype, SType out_stype) {
       size_t id = key(op, inp_stype);
       xassert(reducers.count(id) == 0);
-      reducers[id] = Reducer {f, out_stype};
+      reducers[id] = Reducer {f, nullptr, nullptr, nullptr, nullptr, 0,
+                              out_stype};
+    }
+
+    void add_nona(ReduceOp op, reducer_fn f, SType inp_stype) {
+      size_t id = key(op, inp_stype);
+      xassert(reducers.count(id) == 1 && !reducers[id].f_nona);
+      reducers[id].f_nona = f;
+    }
+
+    // Register the partial evaluation for a reducer, with states of type
+    // `S`. If `fp` is not given, then the regular reducer functions are used
+    // to compute the states, i.e. the state of a chunk is simply the result
+    // of the reduction over that chunk.
+    template <typename S>
+    void add_partial(ReduceOp op, SType inp_stype, combine_fn g,
+                     reducer_fn fp = nullptr, reducer_fn fp_nona = nullptr)
+    {
+      size_t id = key(op, inp_stype);
+      xassert(reducers.count(id) == 1 && !reducers[id].f_combine);
+      Reducer& r = reducers[id];
+      r.f_partial = fp? fp : r.f;
+      r.f_partial_nona = fp? fp_nona : r.f_nona;
+      r.f_combine = g;
+      r.state_size = sizeof(S);
     }
 
     const Reducer* lookup(ReduceOp op, SType stype) const {
@@ -80,7 +140,10 @@ static ReducerLibrary library;
 static colptr reduce_first(const colptr& col, const Groupby& groupby)
 {
   if (col->nrows == 0) {
-    return colptr(Column::new_data_column(col->stype(), 0));
+    SType stype = col->stype();
+    return colptr(is_decimal(stype)
+        ? new_decimal_column(stype, 0, decimal_scale(col.get()))
+        : Column::new_data_column(stype, 0));
   }
   size_t ngrps = groupby.ngroups();
   // groupby.offsets array has length `ngrps + 1` and contains offsets of the
@@ -101,7 +164,10 @@ static colptr reduce_first(const colptr& col, const Groupby& groupby)
 // Sum calculation
 //------------------------------------------------------------------------------
 
-template<typename T, typename U>
+// Template parameter `NAS` indicates whether the input may contain NAs. When
+// it is false, all NA checks are skipped (this includes the checks for NA
+// entries in the rowindex, which would have produced NAs in the column).
+template<typename T, typename U, bool NAS = true>
 static void sum_reducer(const RowIndex& ri, size_t row0, size_t row1,
                         const void* inp, void* out, size_t grp_index)
 {
@@ -110,14 +176,22 @@ static void sum_reducer(const RowIndex& ri, size_t row0, size_t row1,
   U sum = 0;
   ri.iterate(row0, row1, 1,
     [&](size_t, size_t j) {
-      if (j == RowIndex::NA) return;
+      if (NAS && j == RowIndex::NA) return;
       T x = inputs[j];
-      if (!ISNA<T>(x))
+      if (!NAS || !ISNA<T>(x))
         sum += static_cast<U>(x);
     });
   outputs[grp_index] = sum;
 }
 
+// Partial states of the sum reducer are the sums over each chunk
+template<typename U>
+static void sum_combine(const void* states, size_t n, void* out) {
+  const U* sums = static_cast<const U*>(states);
+  static_cast<U*>(out)[0] =
+      pairwise_sum<U>(0, n, [&](size_t i) { return sums[i]; });
+}
+
 
 
 //------------------------------------------------------------------------------
@@ -139,30 +213,134 @@ static void count_reducer(const RowIndex& ri, size_t row0, size_t row1,
   outputs[grp_index] = count;
 }
 
+static void count_reducer_nona(const RowIndex&, size_t row0, size_t row1,
+                               const void*, void* out, size_t grp_index)
+{
+  int64_t* outputs = static_cast<int64_t*>(out);
+  outputs[grp_index] = static_cast<int64_t>(row1 - row0);
+}
+
 
 
 //------------------------------------------------------------------------------
 // Mean calculation
 //------------------------------------------------------------------------------
 
-template<typename T, typename U>
-static void mean_reducer(const RowIndex& ri, size_t row0, size_t row1,
-                        const void* inp, void* out, size_t grp_index)
+template<typename U>
+struct mean_state {
+  U sum;
+  int64_t count;
+};
+
+template<typename T, typename U, bool NAS>
+static mean_state<U> mean_compute(const RowIndex& ri, size_t row0,
+                                  size_t row1, const void* inp)
 {
   const T* inputs = static_cast<const T*>(inp);
-  U* outputs = static_cast<U*>(out);
   U sum = 0;
   int64_t count = 0;
   ri.iterate(row0, row1, 1,
     [&](size_t, size_t j) {
-      if (j == RowIndex::NA) return;
+      if (NAS && j == RowIndex::NA) return;
       T x = inputs[j];
-      if (!ISNA<T>(x)) {
+      if (!NAS || !ISNA<T>(x)) {
         sum += static_cast<U>(x);
         count++;
       }
     });
-  outputs[grp_index] = (count == 0)? GETNA<U>() : sum / count;
+  return mean_state<U> {sum, count};
+}
+
+template<typename U>
+static U mean_finalize(const mean_state<U>& st) {
+  return (st.count == 0)? GETNA<U>() : st.sum / st.count;
+}
+
+template<typename T, typename U, bool NAS = true>
+static void mean_reducer(const RowIndex& ri, size_t row0, size_t row1,
+                        const void* inp, void* out, size_t grp_index)
+{
+  U* outputs = static_cast<U*>(out);
+  outputs[grp_index] =
+      mean_finalize<U>(mean_compute<T, U, NAS>(ri, row0, row1, inp));
+}
+
+template<typename T, typename U, bool NAS = true>
+static void mean_partial(const RowIndex& ri, size_t row0, size_t row1,
+                         const void* inp, void* out, size_t grp_index)
+{
+  mean_state<U>* states = static_cast<mean_state<U>*>(out);
+  states[grp_index] = mean_compute<T, U, NAS>(ri, row0, row1, inp);
+}
+
+template<typename U>
+static void mean_combine(const void* states, size_t n, void* out) {
+  const mean_state<U>* st = static_cast<const mean_state<U>*>(states);
+  mean_state<U> total;
+  total.sum = pairwise_sum<U>(0, n, [&](size_t i) { return st[i].sum; });
+  total.count = 0;
+  for (size_t i = 0; i < n; ++i) total.count += st[i].count;
+  static_cast<U*>(out)[0] = mean_finalize<U>(total);
+}
+
+
+// Sums of decimal columns are accumulated in 128-bit integers, so that they
+// cannot overflow for any realistic number of rows. The sum is then narrowed
+// into DEC64, and becomes NA if it does not fit. The mean is computed from
+// the exact sum as a double, which still has to be divided by 10^scale (see
+// `unscale_result()`).
+using int128_t = __int128;
+
+static int64_t dec_narrow(int128_t x) {
+  const int128_t limit = std::numeric_limits<int64_t>::max();
+  return (x > limit || x < -limit)? GETNA<int64_t>()
+                                  : static_cast<int64_t>(x);
+}
+
+template<typename T, bool NAS = true>
+static void dec_sum_reducer(const RowIndex& ri, size_t row0, size_t row1,
+                            const void* inp, void* out, size_t grp_index)
+{
+  mean_state<int128_t> st = mean_compute<T, int128_t, NAS>(ri, row0, row1, inp);
+  static_cast<int64_t*>(out)[grp_index] = dec_narrow(st.sum);
+}
+
+template<typename T, bool NAS = true>
+static void dec_sum_partial(const RowIndex& ri, size_t row0, size_t row1,
+                            const void* inp, void* out, size_t grp_index)
+{
+  mean_state<int128_t> st = mean_compute<T, int128_t, NAS>(ri, row0, row1, inp);
+  static_cast<int128_t*>(out)[grp_index] = st.sum;
+}
+
+static void dec_sum_combine(const void* states, size_t n, void* out) {
+  const int128_t* sums = static_cast<const int128_t*>(states);
+  int128_t sum = 0;
+  for (size_t i = 0; i < n; ++i) sum += sums[i];
+  static_cast<int64_t*>(out)[0] = dec_narrow(sum);
+}
+
+template<typename T, bool NAS = true>
+static void dec_mean_reducer(const RowIndex& ri, size_t row0, size_t row1,
+                             const void* inp, void* out, size_t grp_index)
+{
+  mean_state<int128_t> st = mean_compute<T, int128_t, NAS>(ri, row0, row1, inp);
+  static_cast<double*>(out)[grp_index] =
+      (st.count == 0)? GETNA<double>()
+                     : static_cast<double>(st.sum) / st.count;
+}
+
+static void dec_mean_combine(const void* states, size_t n, void* out) {
+  const mean_state<int128_t>* st =
+      static_cast<const mean_state<int128_t>*>(states);
+  int128_t sum = 0;
+  int64_t count = 0;
+  for (size_t i = 0; i < n; ++i) {
+    sum += st[i].sum;
+    count += st[i].count;
+  }
+  static_cast<double*>(out)[0] =
+      (count == 0)? GETNA<double>() : static_cast<double>(sum) / count;
 }
 
 
@@ -171,21 +349,27 @@ static void mean_reducer(const RowIndex& ri, size_t row0, size_t row1,
 // Standard deviation
 //------------------------------------------------------------------------------
 
+template<typename U>
+struct stdev_state {
+  int64_t count;
+  U mean;
+  U m2;  // sum of squared deviations from the mean
+};
+
 // Welford algorithm
-template<typename T, typename U>
-static void stdev_reducer(const RowIndex& ri, size_t row0, size_t row1,
-                          const void* inp, void* out, size_t grp_index)
+template<typename T, typename U, bool NAS>
+static stdev_state<U> stdev_compute(const RowIndex& ri, size_t row0,
+                                    size_t row1, const void* inp)
 {
   const T* inputs = static_cast<const T*>(inp);
-  U* outputs = static_cast<U*>(out);
   U mean = 0;
   U m2 = 0;
   int64_t count = 0;
   ri.iterate(row0, row1, 1,
     [&](size_t, size_t j) {
-      if (j == RowIndex::NA) return;
+      if (NAS && j == RowIndex::NA) return;
       T x = inputs[j];
-      if (!ISNA<T>(x)) {
+      if (!NAS || !ISNA<T>(x)) {
         count++;
         U tmp1 = static_cast<U>(x) - mean;
         mean += tmp1 / count;
@@ -193,7 +377,47 @@ static void stdev_reducer(const RowIndex& ri, size_t row0, size_t row1,
         m2 += tmp1 * tmp2;
       }
     });
-  outputs[grp_index] = (count <= 1)? GETNA<U>() : std::sqrt(m2/(count - 1));
+  return stdev_state<U> {count, mean, m2};
+}
+
+template<typename U>
+static U stdev_finalize(const stdev_state<U>& st) {
+  return (st.count <= 1)? GETNA<U>() : std::sqrt(st.m2/(st.count - 1));
+}
+
+template<typename T, typename U, bool NAS = true>
+static void stdev_reducer(const RowIndex& ri, size_t row0, size_t row1,
+                          const void* inp, void* out, size_t grp_index)
+{
+  U* outputs = static_cast<U*>(out);
+  outputs[grp_index] =
+      stdev_finalize<U>(stdev_compute<T, U, NAS>(ri, row0, row1, inp));
+}
+
+template<typename T, typename U, bool NAS = true>
+static void stdev_partial(const RowIndex& ri, size_t row0, size_t row1,
+                          const void* inp, void* out, size_t grp_index)
+{
+  stdev_state<U>* states = static_cast<stdev_state<U>*>(out);
+  states[grp_index] = stdev_compute<T, U, NAS>(ri, row0, row1, inp);
+}
+
+// Merge the Welford states of all chunks, using the formula of Chan et al.
+template<typename U>
+static void stdev_combine(const void* states, size_t n, void* out) {
+  const stdev_state<U>* st = static_cast<const stdev_state<U>*>(states);
+  stdev_state<U> total {0, 0, 0};
+  for (size_t i = 0; i < n; ++i) {
+    if (st[i].count == 0) continue;
+    int64_t count = total.count + st[i].count;
+    U delta = st[i].mean - total.mean;
+    U ratio = static_cast<U>(st[i].count) / static_cast<U>(count);
+    total.mean += delta * ratio;
+    total.m2 += st[i].m2 + delta * delta * ratio *
+                           static_cast<U>(total.count);
+    total.count = count;
+  }
+  static_cast<U*>(out)[0] = stdev_finalize<U>(total);
 }
 
 
@@ -221,6 +445,37 @@ static void min_reducer(const RowIndex& ri, size_t row0, size_t row1,
   outputs[grp_index] = valid? res : GETNA<T>();
 }
 
+template<typename T>
+static void min_reducer_nona(const RowIndex& ri, size_t row0, size_t row1,
+                             const void* inp, void* out, size_t grp_index)
+{
+  const T* inputs = static_cast<const T*>(inp);
+  T* outputs = static_cast<T*>(out);
+  T res = infinity<T>();
+  ri.iterate(row0, row1, 1,
+    [&](size_t, size_t j) {
+      T x = inputs[j];
+      res = (x < res)? x : res;
+    });
+  outputs[grp_index] = (row1 > row0)? res : GETNA<T>();
+}
+
+// Partial states are the minimums over each chunk (NA for chunks that have
+// no valid values)
+template<typename T>
+static void min_combine(const void* states, size_t n, void* out) {
+  const T* mins = static_cast<const T*>(states);
+  T res = infinity<T>();
+  bool valid = false;
+  for (size_t i = 0; i < n; ++i) {
+    T x = mins[i];
+    if (ISNA<T>(x)) continue;
+    if (x < res) res = x;
+    valid = true;
+  }
+  static_cast<T*>(out)[0] = valid? res : GETNA<T>();
+}
+
 
 
 //------------------------------------------------------------------------------
@@ -246,6 +501,35 @@ static void max_reducer(const RowIndex& ri, size_t row0, size_t row1,
   outputs[grp_index] = valid? res : GETNA<T>();
 }
 
+template<typename T>
+static void max_reducer_nona(const RowIndex& ri, size_t row0, size_t row1,
+                             const void* inp, void* out, size_t grp_index)
+{
+  const T* inputs = static_cast<const T*>(inp);
+  T* outputs = static_cast<T*>(out);
+  T res = -infinity<T>();
+  ri.iterate(row0, row1, 1,
+    [&](size_t, size_t j) {
+      T x = inputs[j];
+      res = (x > res)? x : res;
+    });
+  outputs[grp_index] = (row1 > row0)? res : GETNA<T>();
+}
+
+template<typename T>
+static void max_combine(const void* states, size_t n, void* out) {
+  const T* maxs = static_cast<const T*>(states);
+  T res = -infinity<T>();
+  bool valid = false;
+  for (size_t i = 0; i < n; ++i) {
+    T x = maxs[i];
+    if (ISNA<T>(x)) continue;
+    if (x > res) res = x;
+    valid = true;
+  }
+  static_cast<T*>(out)[0] = valid? res : GETNA<T>();
+}
+
 
 
 //------------------------------------------------------------------------------
@@ -310,49 +594,280 @@ dt::GroupbyMode expr_reduce::get_groupby_mode(const dt::workframe&) const {
 }
 
 
-dt::colptr expr_reduce::evaluate_eager(dt::workframe& wf)
+// A reduction that is ready to be applied to the groups: the input column
+// has been evaluated and the output column allocated.
+struct reduce_task {
+  colptr input_col;
+  colptr result;
+  RowIndex rowindex;
+  const void* input;
+  void* output;
+  reducer_fn fn;
+  reducer_fn fn_partial;  // may be nullptr
+  combine_fn fn_combine;
+  size_t state_size;
+  int scale;  // scale of a decimal input column, or 0
+  int : 32;
+};
+
+
+// Reducers over decimal columns that produce floats (mean, sd, median)
+// operate on the underlying integers, so their results have to be divided
+// by 10^scale. Decimal results (min, max, sum) carry the scale instead.
+static void unscale_result(reduce_task& task) {
+  if (!task.scale || task.result->stype() != SType::FLOAT64) return;
+  double p = static_cast<double>(dt::pow10i(task.scale));
+  double* data = static_cast<double*>(task.result->data_w());
+  size_t n = task.result->nrows;
+  for (size_t i = 0; i < n; ++i) data[i] /= p;
+}
+
+
+template <typename T>
+static void set_result(reduce_task& task, bool valid, int64_t ival,
+                       double fval)
 {
-  auto input_col = arg->evaluate_eager(wf);
-  Groupby gb = wf.get_groupby();
+  T* out = static_cast<T*>(task.result->data_w());
+  out[0] = !valid? GETNA<T>()
+         : std::is_integral<T>::value? static_cast<T>(ival)
+                                     : static_cast<T>(fval);
+}
+
+// Reductions over an entire compressed column are computed from the
+// summary of its encoded data (see "codec.h"), without decompressing it.
+// Returns false if this is not possible, i.e. the reduction has to be
+// evaluated as usual.
+static bool reduce_compressed(ReduceOp op, const Column* col,
+                              reduce_task& task)
+{
+  auto codec = col->get_codec();
+  if (!codec) return false;
+  SType in_stype = col->stype();
+  LType in_ltype = info(in_stype).ltype();
+  if (!(in_ltype == LType::BOOL || in_ltype == LType::INT ||
+        in_ltype == LType::REAL)) return false;
+  if (op == ReduceOp::MEDIAN) return false;
+  // The summary's `isum` is an int64, which may wrap around for decimals
+  // (see `dec_sum_reducer()`)
+  if (is_decimal(in_stype) && (op == ReduceOp::SUM || op == ReduceOp::MEAN)) {
+    return false;
+  }
+
+  dt::Codec::Summary s;
+  codec->summarize(&s);
+  double count = static_cast<double>(s.count);
+  bool valid = true;
+  int64_t ival = 0;
+  double fval = 0;
+  switch (op) {
+    case ReduceOp::COUNT:
+      ival = static_cast<int64_t>(s.count);
+      break;
+    case ReduceOp::SUM:
+      ival = s.isum;
+      fval = s.fsum;
+      break;
+    case ReduceOp::MEAN:
+      valid = s.count > 0;
+      fval = s.fsum / count;
+      break;
+    case ReduceOp::STDEV:
+      valid = s.count > 1;
+      fval = std::sqrt(s.m2 / (count - 1));
+      break;
+    case ReduceOp::MIN:
+      valid = s.count > 0;
+      ival = s.imin;
+      fval = s.fmin;
+      break;
+    case ReduceOp::MAX:
+      valid = s.count > 0;
+      ival = s.imax;
+      fval = s.fmax;
+      break;
+    default:
+      return false;
+  }
+  switch (task.result->stype()) {
+    case SType::BOOL:
+    case SType::INT8:    set_result<int8_t>(task, valid, ival, fval); break;
+    case SType::INT16:
+    case SType::DEC16:   set_result<int16_t>(task, valid, ival, fval); break;
+    case SType::INT32:
+    case SType::DEC32:   set_result<int32_t>(task, valid, ival, fval); break;
+    case SType::INT64:
+    case SType::DEC64:   set_result<int64_t>(task, valid, ival, fval); break;
+    case SType::FLOAT32: set_result<float>(task, valid, ival, fval); break;
+    case SType::FLOAT64: set_result<double>(task, valid, ival, fval); break;
+    default:             return false;
+  }
+  unscale_result(task);
+  return true;
+}
+
+
+// Evaluate the argument and set up the `task`. If `gb` is empty, it will be
+// set to a single group spanning the entire input column. Returns false if
+// the result has already been computed (this is the case for the FIRST
+// reducer, which does not need to visit the groups, and for the reductions
+// over a compressed column), in which case it is stored in `task.result`.
+bool expr_reduce::prepare(dt::workframe& wf, Groupby& gb, reduce_task& task)
+{
+  task.input_col = arg->evaluate_eager(wf);
+  const colptr& input_col = task.input_col;
   if (!gb) gb = Groupby::single_group(input_col->nrows);
 
   size_t out_nrows = gb.ngroups();
   if (!out_nrows) out_nrows = 1;  // only when input_col has 0 rows
 
   if (opcode == ReduceOp::FIRST) {
-    return reduce_first(input_col, gb);
+    task.result = reduce_first(input_col, gb);
+    return false;
   }
 
   SType in_stype = input_col->stype();
   auto reducer = library.lookup(opcode, in_stype);
   xassert(reducer);  // checked in .resolve()
 
+  // Skip the NA checks if the input column is known to have no NAs
+  bool nona = input_col->is_na_free();
+  task.fn = (nona && reducer->f_nona)? reducer->f_nona : reducer->f;
+  task.fn_partial = (nona && reducer->f_partial_nona)
+                    ? reducer->f_partial_nona : reducer->f_partial;
+  task.fn_combine = reducer->f_combine;
+  task.state_size = reducer->state_size;
+
   SType out_stype = reducer->output_stype;
-  auto res = colptr(Column::new_data_column(out_stype, out_nrows));
+  task.scale = is_decimal(in_stype)? decimal_scale(input_col.get()) : 0;
+  task.result = colptr(is_decimal(out_stype)
+      ? new_decimal_column(out_stype, out_nrows, task.scale)
+      : Column::new_data_column(out_stype, out_nrows));
+  if (out_nrows == 1 && reduce_compressed(opcode, input_col.get(), task)) {
+    return false;
+  }
 
-  RowIndex rowindex = input_col->rowindex();
+  task.rowindex = input_col->rowindex();
   if (opcode == ReduceOp::MEDIAN && gb) {
-    rowindex = input_col->sort_grouped(rowindex, gb);
+    task.rowindex = input_col->sort_grouped(task.rowindex, gb);
   }
 
   const void* input = input_col->data();
   if (in_stype == SType::STR32) input = static_cast<const char*>(input) + 4;
   if (in_stype == SType::STR64) input = static_cast<const char*>(input) + 8;
-  void* output = res->data_w();
+  task.input = input;
+  task.output = task.result->data_w();
+  return true;
+}
+
+
+// When there is only one group, the rows are split into chunks of
+// `REDUCE_CHUNK_SIZE`, and the partial states of the reducers are computed
+// for all chunks in parallel. The states are then combined in the order of
+// the chunks, so that the result does not depend on the number of threads.
+static constexpr size_t REDUCE_CHUNK_SIZE = 65536;
 
-  if (out_nrows == 1) {
-    reducer->f(rowindex, 0, input_col->nrows, input, output, 0);
+static void run_reduce_tasks_single_group(
+    const std::vector<reduce_task*>& tasks, size_t nrows)
+{
+  size_t nchunks = (nrows + REDUCE_CHUNK_SIZE - 1) / REDUCE_CHUNK_SIZE;
+  size_t nthreads = std::min(nchunks, dt::num_threads_in_pool());
+
+  std::vector<reduce_task*> partial_tasks;
+  std::vector<MemoryRange> states;
+  for (reduce_task* task : tasks) {
+    if (task->fn_partial && nchunks > 1) {
+      partial_tasks.push_back(task);
+      states.push_back(MemoryRange::mem(nchunks * task->state_size));
+    } else {
+      task->fn(task->rowindex, 0, nrows, task->input, task->output, 0);
+    }
   }
-  else {
-    const int32_t* groups = wf.get_groupby().offsets_r();
+  if (partial_tasks.empty()) return;
+
+  size_t ntasks = partial_tasks.size();
+  std::vector<void*> state_ptrs;
+  for (MemoryRange& mr : states) state_ptrs.push_back(mr.wptr());
+
+  dt::parallel_region(nthreads,
+    [&] {
+      size_t ith = dt::this_thread_index();
+      size_t nth = dt::num_threads_in_team();
+      for (size_t c = ith; c < nchunks; c += nth) {
+        size_t row0 = c * REDUCE_CHUNK_SIZE;
+        size_t row1 = std::min(row0 + REDUCE_CHUNK_SIZE, nrows);
+        for (size_t k = 0; k < ntasks; ++k) {
+          const reduce_task* task = partial_tasks[k];
+          task->fn_partial(task->rowindex, row0, row1, task->input,
+                           state_ptrs[k], c);
+        }
+      }
+    });
+  for (size_t k = 0; k < ntasks; ++k) {
+    const reduce_task* task = partial_tasks[k];
+    task->fn_combine(state_ptrs[k], nchunks, task->output);
+  }
+}
+
 
-    dt::parallel_for_dynamic(out_nrows,
+// Apply all `tasks` to each group, in a single parallel loop over the groups
+static void run_reduce_tasks(const std::vector<reduce_task*>& tasks,
+                             const Groupby& gb, size_t nrows)
+{
+  size_t ngroups = gb.ngroups();
+  if (ngroups <= 1) {
+    run_reduce_tasks_single_group(tasks, nrows);
+  }
+  else {
+    const int32_t* groups = gb.offsets_r();
+    size_t ntasks = tasks.size();
+    dt::parallel_for_dynamic(ngroups,
       [&](size_t i) {
         size_t row0 = static_cast<size_t>(groups[i]);
         size_t row1 = static_cast<size_t>(groups[i + 1]);
-        reducer->f(rowindex, row0, row1, input, output, i);
+        for (size_t k = 0; k < ntasks; ++k) {
+          const reduce_task* task = tasks[k];
+          task->fn(task->rowindex, row0, row1, task->input, task->output, i);
+        }
       });
   }
+}
+
+
+dt::colptr expr_reduce::evaluate_eager(dt::workframe& wf)
+{
+  Groupby gb = wf.get_groupby();
+  reduce_task task;
+  if (prepare(wf, gb, task)) {
+    run_reduce_tasks({&task}, gb, task.input_col->nrows);
+    unscale_result(task);
+  }
+  return std::move(task.result);
+}
+
+
+std::vector<dt::colptr> expr_reduce::evaluate_batch(
+    const std::vector<expr_reduce*>& exprs, dt::workframe& wf)
+{
+  xassert(wf.has_groupby());
+  Groupby gb = wf.get_groupby();
+  size_t n = exprs.size();
+  std::vector<reduce_task> tasks(n);
+  std::vector<reduce_task*> active;
+  size_t nrows = 0;
+  for (size_t i = 0; i < n; ++i) {
+    if (exprs[i]->prepare(wf, gb, tasks[i])) {
+      active.push_back(&tasks[i]);
+      nrows = tasks[i].input_col->nrows;
+    }
+  }
+  if (!active.empty()) {
+    run_reduce_tasks(active, gb, nrows);
+    for (reduce_task* task : active) unscale_result(*task);
+  }
+  std::vector<dt::colptr> res;
+  for (reduce_task& task : tasks) {
+    res.push_back(std::move(task.result));
+  }
   return res;
 }
 
@@ -363,6 +878,39 @@ dt::colptr expr_reduce::evaluate_eager(dt::workframe& wf)
 // Initialization
 //------------------------------------------------------------------------------
 
+template <typename T>
+static void init_decimal_reducers(SType st) {
+  library.add(ReduceOp::COUNT, count_reducer<T>, st, SType::INT64);
+  library.add_nona(ReduceOp::COUNT, count_reducer_nona, st);
+  library.add_partial<int64_t>(ReduceOp::COUNT, st, sum_combine<int64_t>);
+
+  library.add(ReduceOp::MIN, min_reducer<T>, st, st);
+  library.add_nona(ReduceOp::MIN, min_reducer_nona<T>, st);
+  library.add_partial<T>(ReduceOp::MIN, st, min_combine<T>);
+
+  library.add(ReduceOp::MAX, max_reducer<T>, st, st);
+  library.add_nona(ReduceOp::MAX, max_reducer_nona<T>, st);
+  library.add_partial<T>(ReduceOp::MAX, st, max_combine<T>);
+
+  library.add(ReduceOp::SUM, dec_sum_reducer<T>, st, SType::DEC64);
+  library.add_nona(ReduceOp::SUM, dec_sum_reducer<T, false>, st);
+  library.add_partial<int128_t>(ReduceOp::SUM, st, dec_sum_combine,
+      dec_sum_partial<T>, dec_sum_partial<T, false>);
+
+  library.add(ReduceOp::MEAN, dec_mean_reducer<T>, st, SType::FLOAT64);
+  library.add_nona(ReduceOp::MEAN, dec_mean_reducer<T, false>, st);
+  library.add_partial<mean_state<int128_t>>(ReduceOp::MEAN, st, dec_mean_combine,
+      mean_partial<T, int128_t>, mean_partial<T, int128_t, false>);
+
+  library.add(ReduceOp::STDEV, stdev_reducer<T, double>, st, SType::FLOAT64);
+  library.add_nona(ReduceOp::STDEV, stdev_reducer<T, double, false>, st);
+  library.add_partial<stdev_state<double>>(ReduceOp::STDEV, st, stdev_combine<double>,
+      stdev_partial<T, double>, stdev_partial<T, double, false>);
+
+  library.add(ReduceOp::MEDIAN, median_reducer<T, double>, st, SType::FLOAT64);
+}
+
+
 void init_reducers()
 {
   // Count
@@ -375,6 +923,9 @@ void init_reducers()
   library.add(ReduceOp::COUNT, count_reducer<double>,   SType::FLOAT64, SType::INT64);
   library.add(ReduceOp::COUNT, count_reducer<uint32_t>, SType::STR32, SType::INT64);
   library.add(ReduceOp::COUNT, count_reducer<uint64_t>, SType::STR64, SType::INT64);
+  library.add(ReduceOp::COUNT, count_reducer<uint8_t>,  SType::CAT8, SType::INT64);
+  library.add(ReduceOp::COUNT, count_reducer<uint16_t>, SType::CAT16, SType::INT64);
+  library.add(ReduceOp::COUNT, count_reducer<uint32_t>, SType::CAT32, SType::INT64);
 
   // Min
   library.add(ReduceOp::MIN, min_reducer<int8_t>,  SType::BOOL, SType::BOOL);
@@ -421,6 +972,128 @@ void init_reducers()
   library.add(ReduceOp::STDEV, stdev_reducer<float,   float>,   SType::FLOAT32, SType::FLOAT32);
   library.add(ReduceOp::STDEV, stdev_reducer<double,  double>,  SType::FLOAT64, SType::FLOAT64);
 
+  // Versions of the reducers for NA-free columns
+  library.add_nona(ReduceOp::COUNT, count_reducer_nona, SType::BOOL);
+  library.add_nona(ReduceOp::COUNT, count_reducer_nona, SType::INT8);
+  library.add_nona(ReduceOp::COUNT, count_reducer_nona, SType::INT16);
+  library.add_nona(ReduceOp::COUNT, count_reducer_nona, SType::INT32);
+  library.add_nona(ReduceOp::COUNT, count_reducer_nona, SType::INT64);
+  library.add_nona(ReduceOp::COUNT, count_reducer_nona, SType::FLOAT32);
+  library.add_nona(ReduceOp::COUNT, count_reducer_nona, SType::FLOAT64);
+  library.add_nona(ReduceOp::COUNT, count_reducer_nona, SType::STR32);
+  library.add_nona(ReduceOp::COUNT, count_reducer_nona, SType::STR64);
+  library.add_nona(ReduceOp::COUNT, count_reducer_nona, SType::CAT8);
+  library.add_nona(ReduceOp::COUNT, count_reducer_nona, SType::CAT16);
+  library.add_nona(ReduceOp::COUNT, count_reducer_nona, SType::CAT32);
+
+  library.add_nona(ReduceOp::MIN, min_reducer_nona<int8_t>,  SType::BOOL);
+  library.add_nona(ReduceOp::MIN, min_reducer_nona<int8_t>,  SType::INT8);
+  library.add_nona(ReduceOp::MIN, min_reducer_nona<int16_t>, SType::INT16);
+  library.add_nona(ReduceOp::MIN, min_reducer_nona<int32_t>, SType::INT32);
+  library.add_nona(ReduceOp::MIN, min_reducer_nona<int64_t>, SType::INT64);
+  library.add_nona(ReduceOp::MIN, min_reducer_nona<float>,   SType::FLOAT32);
+  library.add_nona(ReduceOp::MIN, min_reducer_nona<double>,  SType::FLOAT64);
+
+  library.add_nona(ReduceOp::MAX, max_reducer_nona<int8_t>,  SType::BOOL);
+  library.add_nona(ReduceOp::MAX, max_reducer_nona<int8_t>,  SType::INT8);
+  library.add_nona(ReduceOp::MAX, max_reducer_nona<int16_t>, SType::INT16);
+  library.add_nona(ReduceOp::MAX, max_reducer_nona<int32_t>, SType::INT32);
+  library.add_nona(ReduceOp::MAX, max_reducer_nona<int64_t>, SType::INT64);
+  library.add_nona(ReduceOp::MAX, max_reducer_nona<float>,   SType::FLOAT32);
+  library.add_nona(ReduceOp::MAX, max_reducer_nona<double>,  SType::FLOAT64);
+
+  library.add_nona(ReduceOp::SUM, sum_reducer<int8_t,  int64_t, false>, SType::BOOL);
+  library.add_nona(ReduceOp::SUM, sum_reducer<int8_t,  int64_t, false>, SType::INT8);
+  library.add_nona(ReduceOp::SUM, sum_reducer<int16_t, int64_t, false>, SType::INT16);
+  library.add_nona(ReduceOp::SUM, sum_reducer<int32_t, int64_t, false>, SType::INT32);
+  library.add_nona(ReduceOp::SUM, sum_reducer<int64_t, int64_t, false>, SType::INT64);
+  library.add_nona(ReduceOp::SUM, sum_reducer<float,   float,   false>, SType::FLOAT32);
+  library.add_nona(ReduceOp::SUM, sum_reducer<double,  double,  false>, SType::FLOAT64);
+
+  library.add_nona(ReduceOp::MEAN, mean_reducer<int8_t,  double, false>, SType::BOOL);
+  library.add_nona(ReduceOp::MEAN, mean_reducer<int8_t,  double, false>, SType::INT8);
+  library.add_nona(ReduceOp::MEAN, mean_reducer<int16_t, double, false>, SType::INT16);
+  library.add_nona(ReduceOp::MEAN, mean_reducer<int32_t, double, false>, SType::INT32);
+  library.add_nona(ReduceOp::MEAN, mean_reducer<int64_t, double, false>, SType::INT64);
+  library.add_nona(ReduceOp::MEAN, mean_reducer<float,   float,  false>, SType::FLOAT32);
+  library.add_nona(ReduceOp::MEAN, mean_reducer<double,  double, false>, SType::FLOAT64);
+
+  library.add_nona(ReduceOp::STDEV, stdev_reducer<int8_t,  double, false>, SType::BOOL);
+  library.add_nona(ReduceOp::STDEV, stdev_reducer<int8_t,  double, false>, SType::INT8);
+  library.add_nona(ReduceOp::STDEV, stdev_reducer<int16_t, double, false>, SType::INT16);
+  library.add_nona(ReduceOp::STDEV, stdev_reducer<int32_t, double, false>, SType::INT32);
+  library.add_nona(ReduceOp::STDEV, stdev_reducer<int64_t, double, false>, SType::INT64);
+  library.add_nona(ReduceOp::STDEV, stdev_reducer<float,   float,  false>, SType::FLOAT32);
+  library.add_nona(ReduceOp::STDEV, stdev_reducer<double,  double, false>, SType::FLOAT64);
+
+  // Partial evaluation, used for parallel reductions over a single group
+  library.add_partial<int64_t>(ReduceOp::COUNT, SType::BOOL, sum_combine<int64_t>);
+  library.add_partial<int64_t>(ReduceOp::COUNT, SType::INT8, sum_combine<int64_t>);
+  library.add_partial<int64_t>(ReduceOp::COUNT, SType::INT16, sum_combine<int64_t>);
+  library.add_partial<int64_t>(ReduceOp::COUNT, SType::INT32, sum_combine<int64_t>);
+  library.add_partial<int64_t>(ReduceOp::COUNT, SType::INT64, sum_combine<int64_t>);
+  library.add_partial<int64_t>(ReduceOp::COUNT, SType::FLOAT32, sum_combine<int64_t>);
+  library.add_partial<int64_t>(ReduceOp::COUNT, SType::FLOAT64, sum_combine<int64_t>);
+  library.add_partial<int64_t>(ReduceOp::COUNT, SType::STR32, sum_combine<int64_t>);
+  library.add_partial<int64_t>(ReduceOp::COUNT, SType::STR64, sum_combine<int64_t>);
+  library.add_partial<int64_t>(ReduceOp::COUNT, SType::CAT8, sum_combine<int64_t>);
+  library.add_partial<int64_t>(ReduceOp::COUNT, SType::CAT16, sum_combine<int64_t>);
+  library.add_partial<int64_t>(ReduceOp::COUNT, SType::CAT32, sum_combine<int64_t>);
+
+  library.add_partial<int8_t>(ReduceOp::MIN, SType::BOOL, min_combine<int8_t>);
+  library.add_partial<int8_t>(ReduceOp::MIN, SType::INT8, min_combine<int8_t>);
+  library.add_partial<int16_t>(ReduceOp::MIN, SType::INT16, min_combine<int16_t>);
+  library.add_partial<int32_t>(ReduceOp::MIN, SType::INT32, min_combine<int32_t>);
+  library.add_partial<int64_t>(ReduceOp::MIN, SType::INT64, min_combine<int64_t>);
+  library.add_partial<float>(ReduceOp::MIN, SType::FLOAT32, min_combine<float>);
+  library.add_partial<double>(ReduceOp::MIN, SType::FLOAT64, min_combine<double>);
+
+  library.add_partial<int8_t>(ReduceOp::MAX, SType::BOOL, max_combine<int8_t>);
+  library.add_partial<int8_t>(ReduceOp::MAX, SType::INT8, max_combine<int8_t>);
+  library.add_partial<int16_t>(ReduceOp::MAX, SType::INT16, max_combine<int16_t>);
+  library.add_partial<int32_t>(ReduceOp::MAX, SType::INT32, max_combine<int32_t>);
+  library.add_partial<int64_t>(ReduceOp::MAX, SType::INT64, max_combine<int64_t>);
+  library.add_partial<float>(ReduceOp::MAX, SType::FLOAT32, max_combine<float>);
+  library.add_partial<double>(ReduceOp::MAX, SType::FLOAT64, max_combine<double>);
+
+  library.add_partial<int64_t>(ReduceOp::SUM, SType::BOOL, sum_combine<int64_t>);
+  library.add_partial<int64_t>(ReduceOp::SUM, SType::INT8, sum_combine<int64_t>);
+  library.add_partial<int64_t>(ReduceOp::SUM, SType::INT16, sum_combine<int64_t>);
+  library.add_partial<int64_t>(ReduceOp::SUM, SType::INT32, sum_combine<int64_t>);
+  library.add_partial<int64_t>(ReduceOp::SUM, SType::INT64, sum_combine<int64_t>);
+  library.add_partial<float>(ReduceOp::SUM, SType::FLOAT32, sum_combine<float>);
+  library.add_partial<double>(ReduceOp::SUM, SType::FLOAT64, sum_combine<double>);
+
+  library.add_partial<mean_state<double>>(ReduceOp::MEAN, SType::BOOL, mean_combine<double>,
+      mean_partial<int8_t, double>, mean_partial<int8_t, double, false>);
+  library.add_partial<mean_state<double>>(ReduceOp::MEAN, SType::INT8, mean_combine<double>,
+      mean_partial<int8_t, double>, mean_partial<int8_t, double, false>);
+  library.add_partial<mean_state<double>>(ReduceOp::MEAN, SType::INT16, mean_combine<double>,
+      mean_partial<int16_t, double>, mean_partial<int16_t, double, false>);
+  library.add_partial<mean_state<double>>(ReduceOp::MEAN, SType::INT32, mean_combine<double>,
+      mean_partial<int32_t, double>, mean_partial<int32_t, double, false>);
+  library.add_partial<mean_state<double>>(ReduceOp::MEAN, SType::INT64, mean_combine<double>,
+      mean_partial<int64_t, double>, mean_partial<int64_t, double, false>);
+  library.add_partial<mean_state<float>>(ReduceOp::MEAN, SType::FLOAT32, mean_combine<float>,
+      mean_partial<float, float>, mean_partial<float, float, false>);
+  library.add_partial<mean_state<double>>(ReduceOp::MEAN, SType::FLOAT64, mean_combine<double>,
+      mean_partial<double, double>, mean_partial<double, double, false>);
+
+  library.add_partial<stdev_state<double>>(ReduceOp::STDEV, SType::BOOL, stdev_combine<double>,
+      stdev_partial<int8_t, double>, stdev_partial<int8_t, double, false>);
+  library.add_partial<stdev_state<double>>(ReduceOp::STDEV, SType::INT8, stdev_combine<double>,
+      stdev_partial<int8_t, double>, stdev_partial<int8_t, double, false>);
+  library.add_partial<stdev_state<double>>(ReduceOp::STDEV, SType::INT16, stdev_combine<double>,
+      stdev_partial<int16_t, double>, stdev_partial<int16_t, double, false>);
+  library.add_partial<stdev_state<double>>(ReduceOp::STDEV, SType::INT32, stdev_combine<double>,
+      stdev_partial<int32_t, double>, stdev_partial<int32_t, double, false>);
+  library.add_partial<stdev_state<double>>(ReduceOp::STDEV, SType::INT64, stdev_combine<double>,
+      stdev_partial<int64_t, double>, stdev_partial<int64_t, double, false>);
+  library.add_partial<stdev_state<float>>(ReduceOp::STDEV, SType::FLOAT32, stdev_combine<float>,
+      stdev_partial<float, float>, stdev_partial<float, float, false>);
+  library.add_partial<stdev_state<double>>(ReduceOp::STDEV, SType::FLOAT64, stdev_combine<double>,
+      stdev_partial<double, double>, stdev_partial<double, double, false>);
+
   // Median
   library.add(ReduceOp::MEDIAN, median_reducer<int8_t, double>,  SType::BOOL, SType::FLOAT64);
   library.add(ReduceOp::MEDIAN, median_reducer<int8_t, double>,  SType::INT8, SType::FLOAT64);
@@ -429,6 +1102,13 @@ void init_reducers()
   library.add(ReduceOp::MEDIAN, median_reducer<int64_t, double>, SType::INT64, SType::FLOAT64);
   library.add(ReduceOp::MEDIAN, median_reducer<float, float>,    SType::FLOAT32, SType::FLOAT32);
   library.add(ReduceOp::MEDIAN, median_reducer<double, double>,  SType::FLOAT64, SType::FLOAT64);
+
+  // Decimals: the reducers operate on the underlying integers. The sum is
+  // returned as DEC64 (see `dec_narrow()` above for how it is accumulated),
+  // and the mean is computed from the same exact sum.
+  init_decimal_reducers<int16_t>(SType::DEC16);
+  init_decimal_reducers<int32_t>(SType::DEC32);
+  init_decimal_reducers<int64_t>(SType::DEC64);
 }
 
 
@@ -24,6 +24,7 @@
 #include "expr/collist.h"
 #include "expr/repl_node.h"
 #include "expr/workframe.h"
+#include "python/decimal.h"
 #include "utils/exceptions.h"
 #include "datatable.h"
 #include "datatablemodule.h"
@@ -333,6 +334,53 @@ colptr scalar_float_rn::make_column(SType st, size_t nrows) const {
 
 
 
+//------------------------------------------------------------------------------
+// scalar_decimal_rn
+//------------------------------------------------------------------------------
+
+class scalar_decimal_rn : public scalar_rn {
+  int64_t value;
+  int scale;
+  int : 32;
+
+  public:
+    scalar_decimal_rn(int64_t x, int s) : value(x), scale(s) {}
+
+  protected:
+    const char* value_type() const noexcept override;
+    bool valid_ltype(LType) const noexcept override;
+    colptr make_column(SType st, size_t nrows) const override;
+};
+
+
+const char* scalar_decimal_rn::value_type() const noexcept {
+  return "decimal";
+}
+
+
+bool scalar_decimal_rn::valid_ltype(LType lt) const noexcept {
+  return lt == LType::REAL;
+}
+
+
+colptr scalar_decimal_rn::make_column(SType st, size_t nrows) const {
+  // st can be VOID, FLOAT32/64, or one of the decimal stypes. A decimal
+  // column keeps its stype (the value will be rounded to the column's scale
+  // when replacing), whereas float columns receive the value as a float.
+  Column* col = new_decimal_column(SType::DEC64, 1, scale);
+  static_cast<FwColumn<int64_t>*>(col)->set_elem(0, value);
+  if (st != SType::VOID && st != SType::DEC64) {
+    colptr deccol(col);
+    col = is_decimal(st)? decimal_column(deccol.get(), st, -1)
+                        : deccol->cast(st);
+  }
+  colptr col1(col);
+  return colptr(col1->repeat(nrows));
+}
+
+
+
+
 //------------------------------------------------------------------------------
 // scalar_string_rn
 //------------------------------------------------------------------------------
@@ -359,7 +407,7 @@ bool scalar_string_rn::valid_ltype(LType lt) const noexcept {
 
 colptr scalar_string_rn::make_column(SType st, size_t nrows) const {
   size_t len = value.size();
-  SType rst = (st == SType::VOID)? SType::STR32 : st;
+  SType rst = (st == SType::STR64)? SType::STR64 : SType::STR32;
   size_t elemsize = (rst == SType::STR32)? 4 : 8;
   MemoryRange offbuf = MemoryRange::mem(2 * elemsize);
   if (elemsize == 4) {
@@ -372,6 +420,14 @@ colptr scalar_string_rn::make_column(SType st, size_t nrows) const {
   MemoryRange strbuf = MemoryRange::mem(len);
   std::memcpy(strbuf.xptr(), value.data(), len);
   Column* col = new_string_column(1, std::move(offbuf), std::move(strbuf));
+  if (is_categorical(st)) {
+    colptr strcol(col);
+    col = categorize(strcol.get(), st);
+  }
+  else if (st == SType::FSTR) {
+    colptr strcol(col);
+    col = fixed_width_strings(strcol.get());
+  }
   col->replace_rowindex(RowIndex(size_t(0), nrows, 0));
   return colptr(col);
 }
@@ -487,6 +543,15 @@ repl_node_ptr repl_node::make(workframe& wf, py::oobj src) {
   else if (src.is_int())    res = new scalar_int_rn(src.to_int64());
   else if (src.is_float())  res = new scalar_float_rn(src.to_double());
   else if (src.is_string()) res = new scalar_string_rn(src.to_string());
+  else if (py::is_pydecimal(src)) {
+    int64_t value;
+    int scale;
+    if (!py::decimal_value(src, &value, &scale)) {
+      throw ValueError() << "Decimal value " << src
+          << " cannot be represented with at most 18 digits";
+    }
+    res = new scalar_decimal_rn(value, scale);
+  }
   else if (is_PyBaseExpr(src) || src.is_list_or_tuple()) {
     auto cl = collist::make(wf, src, "replacement");
     auto intcl = dynamic_cast<cols_intlist*>(cl.get());
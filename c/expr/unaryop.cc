@@ -5,9 +5,12 @@
 //
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
+#include <memory>              // std::unique_ptr
 #include "expr/base_expr.h"
+#include "expr/fused.h"
 #include "expr/py_expr.h"
 #include "types.h"
+#include "utils/datetime.h"
 
 namespace expr
 {
@@ -19,10 +22,8 @@ namespace expr
 
 template<typename IT, typename OT, OT (*OP)(IT)>
 static void map_n(int64_t row0, int64_t row1, void** params) {
-  Column* col0 = static_cast<Column*>(params[0]);
-  Column* col1 = static_cast<Column*>(params[1]);
-  const IT* arg_data = static_cast<const IT*>(col0->data());
-  OT* res_data = static_cast<OT*>(col1->data_w());
+  const IT* arg_data = static_cast<const IT*>(params[0]);
+  OT* res_data = static_cast<OT*>(params[1]);
   for (int64_t i = row0; i < row1; ++i) {
     res_data[i] = OP(arg_data[i]);
   }
@@ -31,14 +32,24 @@ static void map_n(int64_t row0, int64_t row1, void** params) {
 template<typename IT, typename OT, OT (*OP)(IT, IT)>
 static void strmap_n(int64_t row0, int64_t row1, void** params) {
   StringColumn<IT>* col0 = static_cast<StringColumn<IT>*>(params[0]);
-  Column* col1 = static_cast<Column*>(params[1]);
   const IT* arg_data = col0->offsets();
-  OT* res_data = static_cast<OT*>(col1->data_w());
+  OT* res_data = static_cast<OT*>(params[1]);
   for (int64_t i = row0; i < row1; ++i) {
     res_data[i] = OP(arg_data[i - 1] & ~GETNA<IT>(), arg_data[i]);
   }
 }
 
+template<typename OT, OT (*OP)(const char*, size_t)>
+static void fstrmap_n(int64_t row0, int64_t row1, void** params) {
+  auto col0 = static_cast<FixedStringColumn*>(params[0]);
+  const char* arg_data = col0->chars();
+  size_t width = col0->get_width();
+  OT* res_data = static_cast<OT*>(params[1]);
+  for (int64_t i = row0; i < row1; ++i) {
+    res_data[i] = OP(arg_data + static_cast<size_t>(i) * width, width);
+  }
+}
+
 
 //------------------------------------------------------------------------------
 // Operator implementations
@@ -120,6 +131,62 @@ inline static OT op_len_str(IT start, IT end) {
   return ISNA<IT>(end)? GETNA<OT>() : static_cast<OT>(end - start);
 }
 
+inline static int8_t op_isna_fstr(const char* x, size_t) {
+  return FixedStringColumn::isna(x);
+}
+
+// The length of a fixed-width string excludes its padding
+inline static int32_t op_len_fstr(const char* x, size_t width) {
+  if (FixedStringColumn::isna(x)) return GETNA<int32_t>();
+  while (width && x[width - 1] == '\0') width--;
+  return static_cast<int32_t>(width);
+}
+
+
+
+//------------------------------------------------------------------------------
+// Datetime operators
+//------------------------------------------------------------------------------
+
+// PART: 0 = year, 1 = month, 2 = day
+template <int PART>
+inline static int32_t civil_part(int64_t days) {
+  int64_t year;
+  int month, day;
+  dt::civil_from_days(days, &year, &month, &day);
+  return PART == 0? static_cast<int32_t>(year) : PART == 1? month : day;
+}
+
+// PART: 0 = hour, 1 = minute, 2 = second
+template <int PART>
+inline static int32_t clock_part(int64_t millis) {
+  int64_t secs = millis / 1000;
+  return static_cast<int32_t>(PART == 0? secs / 3600 :
+                              PART == 1? (secs / 60) % 60 : secs % 60);
+}
+
+template <int PART>
+inline static int32_t op_date32_civil(int32_t x) {
+  return ISNA<int32_t>(x)? GETNA<int32_t>() : civil_part<PART>(x);
+}
+
+template <int PART>
+inline static int32_t op_date64_civil(int64_t x) {
+  return ISNA<int64_t>(x)? GETNA<int32_t>()
+                         : civil_part<PART>(dt::date64_days(x));
+}
+
+template <int PART>
+inline static int32_t op_date64_clock(int64_t x) {
+  return ISNA<int64_t>(x)? GETNA<int32_t>()
+      : clock_part<PART>(dt::date64_time(x) / dt::MICROS_PER_MILLI);
+}
+
+template <int PART>
+inline static int32_t op_time32_clock(int32_t x) {
+  return ISNA<int32_t>(x)? GETNA<int32_t>() : clock_part<PART>(x);
+}
+
 
 
 //------------------------------------------------------------------------------
@@ -143,6 +210,20 @@ static mapperfn resolve1(dt::unop opcode) {
 }
 
 
+// Negation and absolute value of decimals operate on the underlying integers,
+// the scale stays the same. Other functions convert decimals into floats
+// first (see `unaryop()`).
+template<typename T>
+static mapperfn resolve_dec(dt::unop opcode) {
+  switch (opcode) {
+    case dt::unop::ISNA:
+    case dt::unop::MINUS:
+    case dt::unop::ABS:  return resolve1<T>(opcode);
+    default:             return nullptr;
+  }
+}
+
+
 template<typename T>
 static mapperfn resolve_str(dt::unop opcode) {
   using OT = typename std::make_signed<T>::type;
@@ -154,6 +235,60 @@ static mapperfn resolve_str(dt::unop opcode) {
 }
 
 
+static mapperfn resolve_fstr(dt::unop opcode) {
+  switch (opcode) {
+    case dt::unop::ISNA: return fstrmap_n<int8_t, op_isna_fstr>;
+    case dt::unop::LEN:  return fstrmap_n<int32_t, op_len_fstr>;
+    default:             return nullptr;
+  }
+}
+
+
+// Only `isna()` works on the codes of a categorical column; `len()` is
+// computed on the strings (see unaryop() below).
+template<typename T>
+static mapperfn resolve_cat(dt::unop opcode) {
+  if (opcode == dt::unop::ISNA) return map_n<T, int8_t, op_isna<T>>;
+  return nullptr;
+}
+
+
+static mapperfn resolve_date32(dt::unop opcode) {
+  switch (opcode) {
+    case dt::unop::ISNA:  return map_n<int32_t, int8_t, op_isna<int32_t>>;
+    case dt::unop::YEAR:  return map_n<int32_t, int32_t, op_date32_civil<0>>;
+    case dt::unop::MONTH: return map_n<int32_t, int32_t, op_date32_civil<1>>;
+    case dt::unop::DAY:   return map_n<int32_t, int32_t, op_date32_civil<2>>;
+    default:              return nullptr;
+  }
+}
+
+
+static mapperfn resolve_date64(dt::unop opcode) {
+  switch (opcode) {
+    case dt::unop::ISNA:   return map_n<int64_t, int8_t, op_isna<int64_t>>;
+    case dt::unop::YEAR:   return map_n<int64_t, int32_t, op_date64_civil<0>>;
+    case dt::unop::MONTH:  return map_n<int64_t, int32_t, op_date64_civil<1>>;
+    case dt::unop::DAY:    return map_n<int64_t, int32_t, op_date64_civil<2>>;
+    case dt::unop::HOUR:   return map_n<int64_t, int32_t, op_date64_clock<0>>;
+    case dt::unop::MINUTE: return map_n<int64_t, int32_t, op_date64_clock<1>>;
+    case dt::unop::SECOND: return map_n<int64_t, int32_t, op_date64_clock<2>>;
+    default:               return nullptr;
+  }
+}
+
+
+static mapperfn resolve_time32(dt::unop opcode) {
+  switch (opcode) {
+    case dt::unop::ISNA:   return map_n<int32_t, int8_t, op_isna<int32_t>>;
+    case dt::unop::HOUR:   return map_n<int32_t, int32_t, op_time32_clock<0>>;
+    case dt::unop::MINUTE: return map_n<int32_t, int32_t, op_time32_clock<1>>;
+    case dt::unop::SECOND: return map_n<int32_t, int32_t, op_time32_clock<2>>;
+    default:               return nullptr;
+  }
+}
+
+
 static mapperfn resolve0(SType stype, dt::unop opcode) {
   switch (stype) {
     case SType::BOOL:
@@ -165,45 +300,82 @@ static mapperfn resolve0(SType stype, dt::unop opcode) {
     case SType::INT64:   return resolve1<int64_t>(opcode);
     case SType::FLOAT32: return resolve1<float>(opcode);
     case SType::FLOAT64: return resolve1<double>(opcode);
+    case SType::DEC16:   return resolve_dec<int16_t>(opcode);
+    case SType::DEC32:   return resolve_dec<int32_t>(opcode);
+    case SType::DEC64:   return resolve_dec<int64_t>(opcode);
     case SType::STR32:   return resolve_str<uint32_t>(opcode);
     case SType::STR64:   return resolve_str<uint64_t>(opcode);
+    case SType::FSTR:    return resolve_fstr(opcode);
+    case SType::CAT8:    return resolve_cat<uint8_t>(opcode);
+    case SType::CAT16:   return resolve_cat<uint16_t>(opcode);
+    case SType::CAT32:   return resolve_cat<uint32_t>(opcode);
+    case SType::DATE64:  return resolve_date64(opcode);
+    case SType::TIME32:  return resolve_time32(opcode);
+    case SType::DATE32:  return resolve_date32(opcode);
     default: break;
   }
   return nullptr;
 }
 
 
-Column* unaryop(dt::unop opcode, Column* arg)
-{
-  if (opcode == dt::unop::PLUS) return arg->shallowcopy();
-  arg->materialize();
-
-  SType arg_type = arg->stype();
-  SType res_type = arg_type;
+static SType result_stype(dt::unop opcode, SType arg_type) {
   if (opcode == dt::unop::ISNA) {
-    res_type = SType::BOOL;
+    return SType::BOOL;
   } else if (arg_type == SType::BOOL && opcode == dt::unop::MINUS) {
-    res_type = SType::INT8;
+    return SType::INT8;
   } else if (opcode == dt::unop::EXP || opcode == dt::unop::LOGE ||
              opcode == dt::unop::LOG10) {
-    res_type = SType::FLOAT64;
+    return SType::FLOAT64;
   } else if (opcode == dt::unop::LEN) {
-    res_type = arg_type == SType::STR32? SType::INT32 : SType::INT64;
+    return arg_type == SType::STR64? SType::INT64 : SType::INT32;
+  } else if (opcode >= dt::unop::YEAR && opcode <= dt::unop::SECOND) {
+    return SType::INT32;
   }
-  void* params[2];
-  params[0] = arg;
-  params[1] = Column::new_data_column(res_type, arg->nrows);
+  return arg_type;
+}
+
+
+Column* unaryop(dt::unop opcode, Column* arg)
+{
+  if (opcode == dt::unop::PLUS) return arg->shallowcopy();
+  arg->materialize();
 
+  SType arg_type = arg->stype();
+  SType res_type = result_stype(opcode, arg_type);
+  if (is_decimal(arg_type) && res_type == SType::FLOAT64) {
+    std::unique_ptr<Column> tmp(arg->cast(SType::FLOAT64));
+    return unaryop(opcode, tmp.get());
+  }
+  if (is_categorical(arg_type) && opcode == dt::unop::LEN) {
+    std::unique_ptr<Column> tmp(arg->cast(SType::STR32));
+    return unaryop(opcode, tmp.get());
+  }
   mapperfn fn = resolve0(arg_type, opcode);
   if (!fn) {
     throw RuntimeError()
       << "Unable to apply unary op " << int(opcode) << " to column(stype="
       << arg_type << ")";
   }
+  Column* res = is_decimal(res_type)
+      ? new_decimal_column(res_type, arg->nrows, decimal_scale(arg))
+      : Column::new_data_column(res_type, arg->nrows);
 
+  void* params[2];
+  bool raw = arg->is_fixedwidth() || is_categorical(arg_type);
+  params[0] = raw? const_cast<void*>(arg->data()) : static_cast<void*>(arg);
+  params[1] = res->data_w();
   (*fn)(0, static_cast<int64_t>(arg->nrows), params);
 
-  return static_cast<Column*>(params[1]);
+  return res;
+}
+
+
+mapperfn unaryop_mapper(dt::unop opcode, SType arg_type, SType* res_type) {
+  if (opcode == dt::unop::PLUS || !dt::is_fusable_stype(arg_type)) {
+    return nullptr;
+  }
+  *res_type = result_stype(opcode, arg_type);
+  return resolve0(arg_type, opcode);
 }
 
 
@@ -0,0 +1,494 @@
+//------------------------------------------------------------------------------
+// Copyright 2018 H2O.ai
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//------------------------------------------------------------------------------
+//
+// Window functions: cumulative, shifted and rolling computations that produce
+// one value per row, computed within each group. The rows of each group are
+// contiguous in the workframe (the groupby has already reordered them), so
+// every group is processed independently in a single forward pass, and the
+// groups are distributed among the threads.
+//
+//------------------------------------------------------------------------------
+#include <algorithm>          // std::min, std::max
+#include <atomic>             // std::atomic
+#include <cmath>              // std::isinf, std::abs
+#include <limits>             // std::numeric_limits
+#include <type_traits>        // std::conditional, std::is_integral
+#include <vector>             // std::vector
+#include "expr/base_expr.h"
+#include "parallel/api.h"
+#include "utils/exceptions.h"
+#include "column.h"
+#include "ztest.h"
+namespace dt {
+
+
+static const char* window_names[] = {
+  "", "cumsum", "cumcount", "shift", "rolling_sum", "rolling_mean",
+  "rolling_min", "rolling_max"
+};
+
+
+class expr_window : public base_expr {
+  private:
+    pexpr arg;  // empty for cumcount()
+    winop opcode;
+    int64_t param;  // shift amount or window size
+
+  public:
+    expr_window(size_t op, pexpr&& expr, py::robj param);
+    SType resolve(const workframe& wf) override;
+    GroupbyMode get_groupby_mode(const workframe&) const override;
+    colptr evaluate_eager(workframe& wf) override;
+
+  private:
+    colptr evaluate_shift(colptr&& col, const Groupby& gb);
+    template <typename T> colptr evaluate_numeric(Column* col,
+                                                  const Groupby& gb);
+    const char* name() const;
+};
+
+
+
+//------------------------------------------------------------------------------
+// Iterating over groups
+//------------------------------------------------------------------------------
+
+// Call `fn(row0, row1, scratch)` for each group `[row0, row1)`. The groups are
+// distributed dynamically among the threads, and `scratch` is a buffer owned
+// by the current thread, which the kernel may reuse from one group to
+// another.
+template <typename F>
+static void for_each_group(const Groupby& gb, F fn) {
+  size_t ngroups = gb.ngroups();
+  if (ngroups == 0) return;
+  const int32_t* offsets = gb.offsets_r();
+  size_t nthreads = std::min(ngroups, dt::num_threads_in_pool());
+  std::atomic<size_t> next_group { 0 };
+  dt::parallel_region(nthreads,
+    [&] {
+      std::vector<size_t> scratch;
+      while (true) {
+        size_t g = next_group++;
+        if (g >= ngroups) break;
+        fn(static_cast<size_t>(offsets[g]),
+           static_cast<size_t>(offsets[g + 1]), scratch);
+      }
+    });
+}
+
+
+
+//------------------------------------------------------------------------------
+// Kernels
+//------------------------------------------------------------------------------
+
+// Running sum of non-NA values; NA rows produce NA in the output
+template <typename T, typename U>
+static void cumsum(const T* inp, U* out, size_t row0, size_t row1) {
+  U sum = 0;
+  for (size_t i = row0; i < row1; ++i) {
+    T x = inp[i];
+    if (ISNA<T>(x)) {
+      out[i] = GETNA<U>();
+    } else {
+      sum += static_cast<U>(x);
+      out[i] = sum;
+    }
+  }
+}
+
+
+// Running total of the values within a sliding window, where values are
+// both added and removed. Integer totals are exact.
+template <typename U, bool = std::is_floating_point<U>::value>
+struct window_total {
+  U sum = 0;
+  void add(U x) { sum += x; }
+  void remove(U x) { sum -= x; }
+  void reset() { sum = 0; }
+  U value() const { return sum; }
+};
+
+// Floating-point totals use Neumaier's compensated summation, so that the
+// values leaving the window do not leave their rounding errors behind (for
+// example, a small value following a huge one would otherwise be lost).
+// Infinities are counted separately instead of being added, since
+// `inf - inf` would turn all subsequent totals into NaN.
+template <typename U>
+struct window_total<U, true> {
+  U sum = 0;
+  U comp = 0;
+  size_t npos = 0;
+  size_t nneg = 0;
+
+  void add(U x) {
+    if (std::isinf(x)) {
+      if (x > 0) npos++; else nneg++;
+      return;
+    }
+    U t = sum + x;
+    comp += (std::abs(sum) >= std::abs(x))? (sum - t) + x : (x - t) + sum;
+    sum = t;
+  }
+  void remove(U x) {
+    if (std::isinf(x)) {
+      if (x > 0) npos--; else nneg--;
+      return;
+    }
+    add(-x);
+  }
+  void reset() { sum = comp = 0; }
+  U value() const {
+    if (npos && nneg) return GETNA<U>();
+    if (npos) return std::numeric_limits<U>::infinity();
+    if (nneg) return -std::numeric_limits<U>::infinity();
+    return sum + comp;
+  }
+};
+
+
+// Sum (or mean) of the non-NA values among the last `w` rows of the group,
+// updated in O(1) per row by adding the incoming and subtracting the
+// outgoing value. Windows without any valid values produce NA; they also
+// reset the running total, so that no error accumulates across them.
+template <typename T, typename U, bool MEAN>
+static void rolling_sum(const T* inp, U* out, size_t row0, size_t row1,
+                        size_t w)
+{
+  window_total<U> total;
+  int64_t count = 0;
+  for (size_t i = row0; i < row1; ++i) {
+    T x = inp[i];
+    if (!ISNA<T>(x)) {
+      total.add(static_cast<U>(x));
+      count++;
+    }
+    if (i >= row0 + w) {
+      T y = inp[i - w];
+      if (!ISNA<T>(y)) {
+        total.remove(static_cast<U>(y));
+        count--;
+      }
+    }
+    if (count == 0) total.reset();
+    out[i] = count == 0? GETNA<U>() :
+             MEAN? total.value() / static_cast<U>(count) : total.value();
+  }
+}
+
+
+// Minimum (or maximum) over the last `w` rows of the group, via a monotonic
+// deque of row indices: the values at the indices in the deque are strictly
+// increasing (for MIN) or decreasing (for MAX), so that the front of the
+// deque is always the extremum of the current window. Each index is pushed
+// and popped at most once, giving O(1) amortized cost per row.
+//
+// The deque is stored in a vector, whose elements before `head` have already
+// left the window. They are erased once they make up half of the vector, so
+// that its size stays below `2w + 2` regardless of the size of the group (the
+// cost of erasing is covered by the increments of `head`).
+template <typename T, bool MIN>
+static void rolling_minmax(const T* inp, T* out, size_t row0, size_t row1,
+                           size_t w, std::vector<size_t>& deque)
+{
+  deque.clear();
+  size_t head = 0;
+  for (size_t i = row0; i < row1; ++i) {
+    T x = inp[i];
+    if (!ISNA<T>(x)) {
+      while (deque.size() > head) {
+        T y = inp[deque.back()];
+        if (MIN? (y < x) : (y > x)) break;
+        deque.pop_back();
+      }
+      deque.push_back(i);
+    }
+    if (deque.size() > head && deque[head] + w <= i) head++;
+    if (head && 2 * head >= deque.size()) {
+      deque.erase(deque.begin(), deque.begin() + static_cast<long>(head));
+      head = 0;
+    }
+    out[i] = deque.size() > head? inp[deque[head]] : GETNA<T>();
+  }
+}
+
+
+
+//------------------------------------------------------------------------------
+// expr_window
+//------------------------------------------------------------------------------
+
+expr_window::expr_window(size_t op, pexpr&& expr, py::robj param_)
+  : arg(std::move(expr)), param(0)
+{
+  if (op == 0 || op > static_cast<size_t>(winop::ROLLING_MAX)) {
+    throw ValueError() << "Invalid op code in expr_window: " << op;
+  }
+  opcode = static_cast<winop>(op);
+  xassert((opcode == winop::CUMCOUNT) == !arg);
+  if (opcode == winop::SHIFT || opcode >= winop::ROLLING_SUM) {
+    if (!param_.is_int()) {
+      throw TypeError() << "The "
+          << (opcode == winop::SHIFT? "shift amount" : "window size")
+          << " in function `" << name() << "()` should be an integer, "
+             "instead got " << param_.typeobj();
+    }
+    param = param_.to_int64_strict();
+    if (opcode != winop::SHIFT && param <= 0) {
+      throw ValueError() << "The window size in function `" << name()
+          << "()` should be positive, instead got " << param;
+    }
+  }
+}
+
+
+const char* expr_window::name() const {
+  return window_names[static_cast<size_t>(opcode)];
+}
+
+
+// Stype of the result of a numeric window function `op` applied to a column
+// of type `stype`, or VOID if the function cannot be applied.
+static SType numeric_output_stype(winop op, SType stype) {
+  switch (stype) {
+    case SType::BOOL:
+    case SType::INT8:
+    case SType::INT16:
+    case SType::INT32:
+    case SType::INT64:
+      return (op == winop::CUMSUM || op == winop::ROLLING_SUM)
+                ? SType::INT64 :
+             (op == winop::ROLLING_MEAN)? SType::FLOAT64 : stype;
+    case SType::FLOAT32:
+    case SType::FLOAT64:
+      return stype;
+    default:
+      return SType::VOID;
+  }
+}
+
+
+SType expr_window::resolve(const workframe& wf) {
+  if (opcode == winop::CUMCOUNT) return SType::INT64;
+  SType stype = arg->resolve(wf);
+  if (opcode == winop::SHIFT) return stype;
+  SType res = numeric_output_stype(opcode, stype);
+  if (res == SType::VOID) {
+    throw TypeError() << "Function `" << name() << "()` cannot be applied "
+        "to a column of type `" << stype << "`";
+  }
+  return res;
+}
+
+
+GroupbyMode expr_window::get_groupby_mode(const workframe&) const {
+  return GroupbyMode::GtoALL;
+}
+
+
+colptr expr_window::evaluate_eager(workframe& wf) {
+  colptr col;
+  size_t nrows = wf.nrows();
+  if (arg) {
+    col = arg->evaluate_eager(wf);
+    nrows = col->nrows;
+  }
+  Groupby gb = wf.get_groupby();
+  if (!gb) gb = Groupby::single_group(nrows);
+
+  if (opcode == winop::CUMCOUNT) {
+    colptr res(Column::new_data_column(SType::INT64, nrows));
+    int64_t* out = static_cast<int64_t*>(res->data_w());
+    for_each_group(gb,
+      [&](size_t row0, size_t row1, std::vector<size_t>&) {
+        for (size_t i = row0; i < row1; ++i) {
+          out[i] = static_cast<int64_t>(i - row0);
+        }
+      });
+    res->set_na_free();
+    return res;
+  }
+  if (opcode == winop::SHIFT) {
+    return evaluate_shift(std::move(col), gb);
+  }
+  // The kernels read the values of each group sequentially, and look back
+  // at the values up to `window` rows ago; so it is cheaper to gather the
+  // column once than to go through its rowindex at each access.
+  col->materialize();
+  switch (col->stype()) {
+    case SType::BOOL:
+    case SType::INT8:    return evaluate_numeric<int8_t>(col.get(), gb);
+    case SType::INT16:   return evaluate_numeric<int16_t>(col.get(), gb);
+    case SType::INT32:   return evaluate_numeric<int32_t>(col.get(), gb);
+    case SType::INT64:   return evaluate_numeric<int64_t>(col.get(), gb);
+    case SType::FLOAT32: return evaluate_numeric<float>(col.get(), gb);
+    case SType::FLOAT64: return evaluate_numeric<double>(col.get(), gb);
+    default: throw RuntimeError() << "Unexpected column type in `"
+                                  << name() << "()`";  // LCOV_EXCL_LINE
+  }
+}
+
+
+// The shifted column is a view into the argument column: row `i` refers to
+// row `i - n` of the same group, or NA if that row falls outside the group.
+template <typename A>
+static RowIndex make_shift_rowindex(const Groupby& gb, size_t nrows,
+                                    int64_t n)
+{
+  A indices(nrows);
+  using T = typename std::remove_pointer<decltype(indices.data())>::type;
+  T* ind = indices.data();
+  for_each_group(gb,
+    [&](size_t row0, size_t row1, std::vector<size_t>&) {
+      int64_t r0 = static_cast<int64_t>(row0);
+      int64_t r1 = static_cast<int64_t>(row1);
+      for (int64_t i = r0; i < r1; ++i) {
+        int64_t j = i - n;
+        ind[i] = (j >= r0 && j < r1)? static_cast<T>(j) : T(-1);
+      }
+    });
+  return RowIndex(std::move(indices));
+}
+
+colptr expr_window::evaluate_shift(colptr&& col, const Groupby& gb) {
+  size_t nrows = col->nrows;
+  if (param == 0) return std::move(col);
+  RowIndex ri = nrows <= static_cast<size_t>(std::numeric_limits<int32_t>::max())
+      ? make_shift_rowindex<arr32_t>(gb, nrows, param)
+      : make_shift_rowindex<arr64_t>(gb, nrows, param);
+  return colptr(col->shallowcopy(ri * col->rowindex()));
+}
+
+
+template <typename T>
+colptr expr_window::evaluate_numeric(Column* col, const Groupby& gb) {
+  using U = typename std::conditional<std::is_integral<T>::value,
+                                      int64_t, T>::type;
+  using M = typename std::conditional<std::is_same<T, float>::value,
+                                      float, double>::type;
+  size_t nrows = col->nrows;
+  size_t w = static_cast<size_t>(param);
+  const T* inp = static_cast<const T*>(col->data());
+  colptr res(Column::new_data_column(numeric_output_stype(opcode, col->stype()), nrows));
+  void* out = res->data_w();
+
+  switch (opcode) {
+    case winop::CUMSUM:
+      for_each_group(gb,
+        [&](size_t row0, size_t row1, std::vector<size_t>&) {
+          cumsum<T, U>(inp, static_cast<U*>(out), row0, row1);
+        });
+      break;
+    case winop::ROLLING_SUM:
+      for_each_group(gb,
+        [&](size_t row0, size_t row1, std::vector<size_t>&) {
+          rolling_sum<T, U, false>(inp, static_cast<U*>(out), row0, row1, w);
+        });
+      break;
+    case winop::ROLLING_MEAN:
+      for_each_group(gb,
+        [&](size_t row0, size_t row1, std::vector<size_t>&) {
+          rolling_sum<T, M, true>(inp, static_cast<M*>(out), row0, row1, w);
+        });
+      break;
+    case winop::ROLLING_MIN:
+      for_each_group(gb,
+        [&](size_t row0, size_t row1, std::vector<size_t>& deque) {
+          rolling_minmax<T, true>(inp, static_cast<T*>(out), row0, row1, w,
+                                  deque);
+        });
+      break;
+    case winop::ROLLING_MAX:
+      for_each_group(gb,
+        [&](size_t row0, size_t row1, std::vector<size_t>& deque) {
+          rolling_minmax<T, false>(inp, static_cast<T*>(out), row0, row1, w,
+                                   deque);
+        });
+      break;
+    default: break;
+  }
+  return res;
+}
+
+
+
+//------------------------------------------------------------------------------
+// Factory function
+//------------------------------------------------------------------------------
+
+pexpr expr_window_fn(size_t op, pexpr&& arg, py::robj param) {
+  return pexpr(new expr_window(op, std::move(arg), param));
+}
+
+
+
+}  // namespace dt
+
+
+
+//------------------------------------------------------------------------------
+// Tests
+//------------------------------------------------------------------------------
+#ifdef DTTEST
+namespace dttest {
+
+// On monotonic input none of the values is ever popped from the back of the
+// deque in `rolling_minmax()` (increasing input for MIN, decreasing for MAX),
+// so the deque only shrinks by dropping the indices that left the window.
+// Check that its memory stays proportional to the window, not to the group.
+template <bool MIN>
+static void test_rolling_minmax_impl(size_t n, size_t w) {
+  std::vector<int64_t> inp(n), out(n);
+  for (size_t i = 0; i < n; ++i) {
+    int64_t x = static_cast<int64_t>(i);
+    inp[i] = MIN? x : -x;
+  }
+  std::vector<size_t> deque;
+  dt::rolling_minmax<int64_t, MIN>(inp.data(), out.data(), 0, n, w, deque);
+
+  for (size_t i = 0; i < n; ++i) {
+    int64_t exp = inp[i + 1 >= w? i + 1 - w : 0];
+    if (out[i] != exp) {
+      throw AssertionError() << "Invalid rolling_" << (MIN? "min" : "max")
+          << "(w=" << w << ") in row " << i << ": " << out[i]
+          << ", expected " << exp;
+    }
+  }
+  if (deque.size() >= 2 * w + 2 || deque.capacity() > 4 * w + 4) {
+    throw AssertionError() << "The deque in rolling_" << (MIN? "min" : "max")
+        << "(w=" << w << ") over " << n << " monotonic values has size "
+        << deque.size() << " and capacity " << deque.capacity()
+        << ", while it should be O(w)";
+  }
+}
+
+
+void test_rolling_minmax(size_t n) {
+  for (size_t w : {1, 2, 3, 10, 100}) {
+    test_rolling_minmax_impl<true>(n, w);
+    test_rolling_minmax_impl<false>(n, w);
+  }
+}
+
+
+}  // namespace dttest
+#endif
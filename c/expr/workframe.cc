@@ -33,7 +33,7 @@ namespace dt {
 workframe::workframe(DataTable* dt) {
   // The source frame must have flag `natural=false` so that `allcols_jn`
   // knows to select all columns from it.
-  frames.push_back(subframe {dt, RowIndex(), false});
+  frames.push_back(subframe {dt, RowIndex(), {}, {}, JoinType::LEFT, false});
   mode = EvalMode::SELECT;
   groupby_mode = GroupbyMode::NONE;
 }
@@ -56,7 +56,14 @@ GroupbyMode workframe::get_groupby_mode() const {
 
 void workframe::add_join(py::ojoin oj) {
   DataTable* dt = oj.get_datatable();
-  frames.push_back(subframe {dt, RowIndex(), true});
+  JoinType how = oj.get_how();
+  // In the right and outer joins some rows of the root frame are missing,
+  // and the values of the join columns can only be found in the join frame.
+  // Thus, the join columns are not "natural" in this case.
+  bool natural = (how == JoinType::LEFT || how == JoinType::INNER);
+  frames.push_back(subframe {dt, RowIndex(), {}, {}, how, natural});
+  oj.get_join_columns(frames[0].dt, frames.back().xcols,
+                      frames.back().jcols);
 }
 
 
@@ -92,8 +99,29 @@ void workframe::evaluate() {
   // Compute joins
   DataTable* xdt = frames[0].dt;
   for (size_t i = 1; i < frames.size(); ++i) {
-    DataTable* jdt = frames[i].dt;
-    frames[i].ri = natural_join(xdt, jdt);
+    subframe& sf = frames[i];
+    auto res = hash_join(xdt, sf.dt, sf.xcols, sf.jcols, sf.how);
+    sf.ri = std::move(res.second);
+    // If each row of the root frame matched exactly one row in the joined
+    // frame, then the root frame's rows remain unchanged. Otherwise, the
+    // row configuration of all previously joined frames must be updated.
+    const RowIndex& xri = res.first;
+    bool unchanged = (xri.size() == xdt->nrows);
+    for (size_t r = 0; unchanged && r < xri.size(); ++r) {
+      unchanged = (xri[r] == r);
+    }
+    if (unchanged) continue;
+    if (mode != EvalMode::SELECT) {
+      throw ValueError() << "Cannot update or delete rows of a frame using a "
+          "join that changes the number of rows in that frame";
+    }
+    if (frames[0].ri) {
+      throw NotImplError() << "Only one join that changes the number of rows "
+          "in the frame is supported";
+    }
+    for (size_t k = 0; k < i; ++k) {
+      frames[k].ri = xri * frames[k].ri;
+    }
   }
 
   // Compute groupby
@@ -190,6 +218,14 @@ bool workframe::is_naturally_joined(size_t i) const {
   return frames[i].natural;
 }
 
+bool workframe::is_join_column(size_t i, size_t j) const {
+  if (!frames[i].natural) return false;
+  for (size_t k : frames[i].jcols) {
+    if (k == j) return true;
+  }
+  return false;
+}
+
 bool workframe::has_groupby() const {
   return bool(byexpr);
 }
@@ -219,6 +255,18 @@ void workframe::apply_groupby(const Groupby& gb_) {
 }
 
 
+// Replace the root frame with a frame `dt` that has the same columns, but
+// only a subset of the rows (see `expr_in::execute()`). The new frame is
+// owned by the workframe. This is only valid in the SELECT mode, since the
+// original frame is not modified.
+void workframe::replace_root(std::unique_ptr<DataTable>&& dt) {
+  xassert(mode == EvalMode::SELECT && frames.size() == 1 && !frames[0].ri);
+  xassert(dt->ncols == frames[0].dt->ncols);
+  pruned = std::move(dt);
+  frames[0].dt = pruned.get();
+}
+
+
 
 //---- Construct the resulting frame -------------
 
@@ -21,6 +21,7 @@
 //------------------------------------------------------------------------------
 #ifndef dt_EXPR_WORKFRAME_h
 #define dt_EXPR_WORKFRAME_h
+#include <memory>            // std::unique_ptr
 #include <vector>            // std::vector
 #include "expr/by_node.h"    // py::oby, by_node_ptr
 #include "expr/i_node.h"     // i_node_ptr
@@ -36,8 +37,11 @@ namespace dt {
 struct subframe {
   DataTable* dt;
   RowIndex ri;
+  intvec xcols;  // join columns in the root frame
+  intvec jcols;  // join columns in this frame
+  JoinType how;
   bool natural;  // was this frame joined naturally?
-  size_t : 56;
+  size_t : 48;
 };
 using frvec = std::vector<subframe>;
 
@@ -80,6 +84,7 @@ class workframe {
 
     // Runtime
     frvec         frames;
+    std::unique_ptr<DataTable> pruned;
     Groupby       gb;
     EvalMode      mode;
     GroupbyMode   groupby_mode;
@@ -116,12 +121,14 @@ class workframe {
     const Groupby& get_groupby();
     const by_node& get_by_node() const;
     bool is_naturally_joined(size_t i) const;
+    bool is_join_column(size_t i, size_t j) const;
     bool has_groupby() const;
     size_t nframes() const;
     size_t nrows() const;
 
     void apply_rowindex(const RowIndex& ri);
     void apply_groupby(const Groupby& gb_);
+    void replace_root(std::unique_ptr<DataTable>&& dt);
 
     size_t size() const noexcept;
     void reserve(size_t n);
@@ -24,6 +24,8 @@
 #include "frame/py_frame.h"
 #include "python/string.h"
 #include "types.h"
+#include "utils/datetime.h"
+#include "utils/decimal.h"
 
 static const char* imgx =
     "url('data:image/png;base64,iVBORw0KGgoAAAANSUhEUgAAABwAAAA4CAYAAADuMJi0AAA"
@@ -201,8 +203,18 @@ class HtmlWidget {
           case SType::INT64:   render_fw_value<int64_t>(col, i); break;
           case SType::FLOAT32: render_fw_value<float>(col, i); break;
           case SType::FLOAT64: render_fw_value<double>(col, i); break;
+          case SType::DEC16:   render_dec_value<int16_t>(col, i); break;
+          case SType::DEC32:   render_dec_value<int32_t>(col, i); break;
+          case SType::DEC64:   render_dec_value<int64_t>(col, i); break;
           case SType::STR32:   render_str_value<uint32_t>(col, i); break;
           case SType::STR64:   render_str_value<uint64_t>(col, i); break;
+          case SType::FSTR:    render_fstr_value(col, i); break;
+          case SType::CAT8:    render_cat_value<uint8_t>(col, i); break;
+          case SType::CAT16:   render_cat_value<uint16_t>(col, i); break;
+          case SType::CAT32:   render_cat_value<uint32_t>(col, i); break;
+          case SType::DATE64:  render_date_value<SType::DATE64>(col, i); break;
+          case SType::TIME32:  render_date_value<SType::TIME32>(col, i); break;
+          case SType::DATE32:  render_date_value<SType::DATE32>(col, i); break;
           case SType::OBJ:     render_obj_value(col, i); break;
           default:
             html << "(unknown stype)";
@@ -257,6 +269,24 @@ class HtmlWidget {
       }
     }
 
+    template <typename T>
+    void render_dec_value(const Column* col, size_t row) {
+      auto dcol = static_cast<const DecimalColumn<T>*>(col);
+      auto irow = dcol->rowindex()[row];
+      T val = dcol->get_elem(irow);
+      if (ISNA<T>(val)) render_na();
+      else {
+        int64_t x = static_cast<int64_t>(val);
+        if (x < 0) {
+          html << "&minus;";
+          x = -x;
+        }
+        char buf[dt::DECIMAL_MAXLEN];
+        char* end = dt::format_decimal(buf, x, dcol->get_scale());
+        html.write(buf, end - buf);
+      }
+    }
+
     template <typename T>
     void render_str_value(const Column* col, size_t row) {
       auto scol = static_cast<const StringColumn<T>*>(col);
@@ -272,6 +302,49 @@ class HtmlWidget {
       }
     }
 
+    void render_fstr_value(const Column* col, size_t row) {
+      auto xcol = static_cast<const FixedStringColumn*>(col);
+      auto irow = xcol->rowindex()[row];
+      CString s = (irow == RowIndex::NA)? CString() : xcol->get_string(irow);
+      if (s.isna()) {
+        render_na();
+      } else {
+        render_escaped_string(s.ch, static_cast<size_t>(s.size));
+      }
+    }
+
+    template <typename T>
+    void render_cat_value(const Column* col, size_t row) {
+      auto ccol = static_cast<const CategoricalColumn<T>*>(col);
+      auto irow = ccol->rowindex()[row];
+      T code = (irow == RowIndex::NA)? GETNA<T>() : ccol->get_elem(irow);
+      if (ISNA<T>(code)) {
+        render_na();
+      } else {
+        CString level = ccol->level(code);
+        render_escaped_string(level.ch, static_cast<size_t>(level.size));
+      }
+    }
+
+    template <SType s>
+    void render_date_value(const Column* col, size_t row) {
+      using T = element_t<s>;
+      auto dcol = static_cast<const DatetimeColumn<s>*>(col);
+      auto irow = dcol->rowindex()[row];
+      T val = dcol->get_elem(irow);
+      if (ISNA<T>(val)) {
+        render_na();
+      } else {
+        char buf[dt::DATE64_MAXLEN];
+        char* end = s == SType::DATE64?
+                      dt::format_date64(buf, static_cast<int64_t>(val)) :
+                    s == SType::TIME32?
+                      dt::format_time32(buf, static_cast<int32_t>(val)) :
+                      dt::format_date32(buf, static_cast<int32_t>(val));
+        html.write(buf, end - buf);
+      }
+    }
+
     void render_obj_value(const Column* col, size_t row) {
       auto scol = static_cast<const PyObjectColumn*>(col);
       auto irow = scol->rowindex()[row];
@@ -310,6 +383,7 @@ class HtmlWidget {
               ".datatable .int  { background: #5D9E5D; }\n"
               ".datatable .real { background: #4040CC; }\n"
               ".datatable .str  { background: #CC4040; }\n"
+              ".datatable .time { background: #CC8040; }\n"
               ".datatable .row_index {"
               "  background: var(--jp-border-color3);"
               "  border-right: 1px solid var(--jp-border-color0);"
@@ -2,6 +2,7 @@
 // Copyright 2018 H2O.ai
 //------------------------------------------------------------------------------
 #include "frame/py_frame.h"
+#include "codec.h"
 #include "python/_all.h"
 namespace py {
 
@@ -91,6 +92,8 @@ size_t Column::memory_footprint() const {
   size_t sz = sizeof(*this);
   if (!ri) sz += mbuf.memory_footprint();
   sz += ri.memory_footprint();
+  auto codec = get_codec();
+  if (codec) sz += codec->nbytes();
   if (stats) sz += stats->memory_footprint();
   return sz;
 }
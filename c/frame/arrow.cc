@@ -0,0 +1,792 @@
+//------------------------------------------------------------------------------
+// Copyright 2018 H2O.ai
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//------------------------------------------------------------------------------
+//
+// Conversion between Frames and the Apache Arrow columnar format, via the
+// Arrow C Data Interface [1] and the Arrow PyCapsule Interface [2]. Both are
+// stable ABIs, so no dependency on the Arrow library is needed.
+//
+// A Frame is exchanged as a "struct" array whose children are the columns.
+// Wherever the memory layouts of datatable and Arrow agree, the buffers are
+// shared instead of copied:
+//   - fixed-width columns without NAs;
+//   - offsets and character data of string columns without NAs (on import
+//     the character data is shared even when there are NAs).
+// Boolean columns are always copied, since Arrow stores them as bitmaps.
+//
+// [1] https://arrow.apache.org/docs/format/CDataInterface.html
+// [2] https://arrow.apache.org/docs/format/CDataInterface/PyCapsuleInterface.html
+//
+//------------------------------------------------------------------------------
+#include <cstring>          // std::memcpy
+#include <memory>           // std::unique_ptr, std::shared_ptr
+#include <string>           // std::string
+#include <type_traits>      // std::is_same, std::make_unsigned
+#include <vector>           // std::vector
+#include "frame/py_frame.h"
+#include "parallel/api.h"
+#include "python/_all.h"
+#include "python/args.h"
+#include "python/string.h"
+#include "column.h"
+#include "datatablemodule.h"
+
+
+//------------------------------------------------------------------------------
+// Arrow C Data Interface ABI
+//------------------------------------------------------------------------------
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+  const char* format;
+  const char* name;
+  const char* metadata;
+  int64_t flags;
+  int64_t n_children;
+  struct ArrowSchema** children;
+  struct ArrowSchema* dictionary;
+  void (*release)(struct ArrowSchema*);
+  void* private_data;
+};
+
+struct ArrowArray {
+  int64_t length;
+  int64_t null_count;
+  int64_t offset;
+  int64_t n_buffers;
+  int64_t n_children;
+  const void** buffers;
+  struct ArrowArray** children;
+  struct ArrowArray* dictionary;
+  void (*release)(struct ArrowArray*);
+  void* private_data;
+};
+
+#endif  // ARROW_C_DATA_INTERFACE
+
+#ifndef ARROW_C_STREAM_INTERFACE
+#define ARROW_C_STREAM_INTERFACE
+
+struct ArrowArrayStream {
+  int (*get_schema)(struct ArrowArrayStream*, struct ArrowSchema* out);
+  int (*get_next)(struct ArrowArrayStream*, struct ArrowArray* out);
+  const char* (*get_last_error)(struct ArrowArrayStream*);
+  void (*release)(struct ArrowArrayStream*);
+  void* private_data;
+};
+
+#endif  // ARROW_C_STREAM_INTERFACE
+
+
+
+
+//------------------------------------------------------------------------------
+// Export
+//------------------------------------------------------------------------------
+
+// Data owned by an exported ArrowSchema: the strings that the schema points
+// to, and the child schemas.
+struct export_schema_data {
+  std::string format;
+  std::string name;
+  std::vector<ArrowSchema> children;
+  std::vector<ArrowSchema*> children_ptrs;
+};
+
+// Data owned by an exported ArrowArray. The MemoryRanges keep the buffers
+// alive for as long as the consumer holds the array.
+struct export_array_data {
+  std::vector<MemoryRange> mbufs;
+  std::vector<const void*> buffers;
+  std::vector<ArrowArray> children;
+  std::vector<ArrowArray*> children_ptrs;
+};
+
+
+static void release_exported_schema(ArrowSchema* schema) {
+  auto data = static_cast<export_schema_data*>(schema->private_data);
+  for (ArrowSchema& child : data->children) {
+    if (child.release) child.release(&child);
+  }
+  delete data;
+  schema->release = nullptr;
+}
+
+static void release_exported_array(ArrowArray* array) {
+  // The consumer may release the array from any thread, however destroying
+  // a MemoryRange may require the GIL (for example if the buffer came from
+  // a numpy array).
+  PyGILState_STATE gilstate = PyGILState_Ensure();
+  auto data = static_cast<export_array_data*>(array->private_data);
+  for (ArrowArray& child : data->children) {
+    if (child.release) child.release(&child);
+  }
+  delete data;
+  array->release = nullptr;
+  PyGILState_Release(gilstate);
+}
+
+
+static void init_schema(ArrowSchema* schema, const char* format,
+                        const std::string& name, size_t nchildren,
+                        int64_t flags)
+{
+  auto data = new export_schema_data();
+  data->format = format;
+  data->name = name;
+  data->children.resize(nchildren);  // zero-initialized: release == nullptr
+  for (ArrowSchema& child : data->children) {
+    data->children_ptrs.push_back(&child);
+  }
+  schema->format = data->format.c_str();
+  schema->name = data->name.c_str();
+  schema->metadata = nullptr;
+  schema->flags = flags;
+  schema->n_children = static_cast<int64_t>(nchildren);
+  schema->children = nchildren? data->children_ptrs.data() : nullptr;
+  schema->dictionary = nullptr;
+  schema->release = release_exported_schema;
+  schema->private_data = data;
+}
+
+
+// Buffers in `mbufs` may be empty MemoryRanges, which are exported as
+// null pointers (this is how an absent validity bitmap is represented).
+static void init_array(ArrowArray* array, size_t length, size_t null_count,
+                       std::vector<MemoryRange>&& mbufs, size_t nchildren)
+{
+  auto data = new export_array_data();
+  data->mbufs = std::move(mbufs);
+  for (const MemoryRange& mr : data->mbufs) {
+    data->buffers.push_back(mr.size()? mr.rptr() : nullptr);
+  }
+  data->children.resize(nchildren);
+  for (ArrowArray& child : data->children) {
+    data->children_ptrs.push_back(&child);
+  }
+  array->length = static_cast<int64_t>(length);
+  array->null_count = static_cast<int64_t>(null_count);
+  array->offset = 0;
+  array->n_buffers = static_cast<int64_t>(data->buffers.size());
+  array->n_children = static_cast<int64_t>(nchildren);
+  array->buffers = data->buffers.data();
+  array->children = nchildren? data->children_ptrs.data() : nullptr;
+  array->dictionary = nullptr;
+  array->release = release_exported_array;
+  array->private_data = data;
+}
+
+
+static const char* arrow_format(SType stype) {
+  switch (stype) {
+    case SType::BOOL:    return "b";
+    case SType::INT8:    return "c";
+    case SType::INT16:   return "s";
+    case SType::INT32:   return "i";
+    case SType::INT64:   return "l";
+    case SType::FLOAT32: return "f";
+    case SType::FLOAT64: return "g";
+    case SType::STR32:   return "u";
+    case SType::STR64:   return "U";
+    default:             return nullptr;
+  }
+}
+
+
+// Arrow stores booleans as bitmaps, so they have to be re-packed
+static MemoryRange pack_booleans(const Column* col) {
+  size_t nrows = col->nrows;
+  size_t nwords = (nrows + 63) / 64;
+  MemoryRange res = MemoryRange::mem(nwords * sizeof(uint64_t));
+  const int8_t* src = static_cast<const int8_t*>(col->data());
+  uint64_t* words = static_cast<uint64_t*>(res.wptr());
+  dt::parallel_for_static(nwords,
+    [&](size_t w) {
+      size_t row0 = w * 64;
+      size_t row1 = std::min(row0 + 64, nrows);
+      uint64_t word = 0;
+      for (size_t i = row0; i < row1; ++i) {
+        word |= static_cast<uint64_t>(src[i] == 1) << (i - row0);
+      }
+      words[w] = word;
+    });
+  return res;
+}
+
+
+// Arrow string offsets cannot carry the NA flag
+template <typename T>
+static MemoryRange clean_string_offsets(const Column* col) {
+  size_t n = col->nrows + 1;
+  MemoryRange res = MemoryRange::mem(n * sizeof(T));
+  const T* src = static_cast<const T*>(col->data());
+  T* out = static_cast<T*>(res.wptr());
+  dt::parallel_for_static(n,
+    [&](size_t i) {
+      out[i] = src[i] & ~GETNA<T>();
+    });
+  return res;
+}
+
+
+static void export_column(const Column* col0, const std::string& name,
+                          ArrowSchema* schema, ArrowArray* array)
+{
+  SType stype = col0->stype();
+  const char* format = arrow_format(stype);
+  if (!format) {
+    throw TypeError() << "Column `" << name << "` of type `" << stype
+        << "` cannot be converted into Arrow format";
+  }
+  // A view column is materialized into a temporary copy, so that the
+  // original frame is not modified.
+  std::unique_ptr<Column> tmp;
+  const Column* col = col0;
+  if (col0->rowindex()) {
+    tmp.reset(col0->shallowcopy());
+    tmp->materialize();
+    col = tmp.get();
+  }
+  size_t nrows = col->nrows;
+  size_t countna = col0->countna();
+
+  std::vector<MemoryRange> mbufs;
+  mbufs.push_back(countna? col->validity_bitmap() : MemoryRange());
+  switch (stype) {
+    case SType::BOOL:
+      mbufs.push_back(pack_booleans(col));
+      break;
+    case SType::STR32:
+    case SType::STR64: {
+      bool str32 = (stype == SType::STR32);
+      mbufs.push_back(countna == 0? col->data_buf() :
+                      str32? clean_string_offsets<uint32_t>(col) :
+                             clean_string_offsets<uint64_t>(col));
+      mbufs.push_back(str32
+          ? static_cast<const StringColumn<uint32_t>*>(col)->str_buf()
+          : static_cast<const StringColumn<uint64_t>*>(col)->str_buf());
+      break;
+    }
+    default:
+      mbufs.push_back(col->data_buf());
+  }
+  init_schema(schema, format, name, 0, ARROW_FLAG_NULLABLE);
+  init_array(array, nrows, countna, std::move(mbufs), 0);
+}
+
+
+static void export_frame(const DataTable* dt, ArrowSchema* schema,
+                         ArrowArray* array)
+{
+  const strvec& names = dt->get_names();
+  init_schema(schema, "+s", "", dt->ncols, 0);
+  std::vector<MemoryRange> mbufs(1);  // no validity bitmap
+  init_array(array, dt->nrows, 0, std::move(mbufs), dt->ncols);
+  try {
+    for (size_t i = 0; i < dt->ncols; ++i) {
+      export_column(dt->columns[i], names[i],
+                    schema->children[i], array->children[i]);
+    }
+  } catch (...) {
+    schema->release(schema);
+    array->release(array);
+    throw;
+  }
+}
+
+
+static void release_schema_capsule(PyObject* capsule) {
+  auto schema = static_cast<ArrowSchema*>(
+                    PyCapsule_GetPointer(capsule, "arrow_schema"));
+  if (schema->release) schema->release(schema);
+  delete schema;
+}
+
+static void release_array_capsule(PyObject* capsule) {
+  auto array = static_cast<ArrowArray*>(
+                   PyCapsule_GetPointer(capsule, "arrow_array"));
+  if (array->release) array->release(array);
+  delete array;
+}
+
+
+static py::otuple export_capsules(const DataTable* dt) {
+  std::unique_ptr<ArrowSchema> schema(new ArrowSchema());
+  std::unique_ptr<ArrowArray> array(new ArrowArray());
+  export_frame(dt, schema.get(), array.get());
+
+  PyObject* schema_capsule =
+      PyCapsule_New(schema.get(), "arrow_schema", release_schema_capsule);
+  if (!schema_capsule) {
+    schema->release(schema.get());
+    array->release(array.get());
+    throw PyError();
+  }
+  schema.release();
+  py::oobj oschema = py::oobj::from_new_reference(schema_capsule);
+
+  PyObject* array_capsule =
+      PyCapsule_New(array.get(), "arrow_array", release_array_capsule);
+  if (!array_capsule) {
+    array->release(array.get());
+    throw PyError();
+  }
+  array.release();
+  py::oobj oarray = py::oobj::from_new_reference(array_capsule);
+
+  return py::otuple(std::move(oschema), std::move(oarray));
+}
+
+
+
+
+//------------------------------------------------------------------------------
+// Import
+//------------------------------------------------------------------------------
+
+// Owner of an imported ArrowArray: the array is released when the last
+// MemoryRange referencing its buffers goes away.
+struct arrow_import_owner {
+  ArrowArray array;
+
+  explicit arrow_import_owner(ArrowArray* src) {
+    // Move the array: the source struct is marked as released
+    array = *src;
+    src->release = nullptr;
+  }
+  ~arrow_import_owner() {
+    if (array.release) array.release(&array);
+  }
+};
+
+using ownerptr = std::shared_ptr<arrow_import_owner>;
+
+
+static inline bool arrow_bit(const void* bitmap, size_t i) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(bitmap);
+  return (bytes[i >> 3] >> (i & 7)) & 1;
+}
+
+
+// Import a fixed-width array with elements of type `T`, into a column with
+// elements of type `U`. The buffer is shared if the types are the same and
+// there are no nulls; otherwise the values are copied, and the nulls
+// replaced with NA sentinels.
+template <typename T, typename U>
+static Column* import_fw(SType stype, const ArrowArray* arr, size_t offset,
+                         size_t n, const ownerptr& owner)
+{
+  const T* data = static_cast<const T*>(arr->buffers[1]) + offset;
+  const void* valid = arr->buffers[0];
+  if (!valid || arr->null_count == 0) {
+    valid = nullptr;
+    if (std::is_same<T, U>::value) {
+      return Column::new_mbuf_column(stype,
+                MemoryRange::external(data, n * sizeof(T), owner));
+    }
+  }
+  MemoryRange mbuf = MemoryRange::mem(n * sizeof(U));
+  U* out = static_cast<U*>(mbuf.wptr());
+  dt::parallel_for_static(n,
+    [&](size_t i) {
+      out[i] = (valid && !arrow_bit(valid, offset + i))
+                  ? GETNA<U>() : static_cast<U>(data[i]);
+    });
+  return Column::new_mbuf_column(stype, std::move(mbuf));
+}
+
+
+static Column* import_bool(const ArrowArray* arr, size_t offset, size_t n) {
+  const void* data = arr->buffers[1];
+  const void* valid = arr->null_count == 0? nullptr : arr->buffers[0];
+  MemoryRange mbuf = MemoryRange::mem(n);
+  int8_t* out = static_cast<int8_t*>(mbuf.wptr());
+  dt::parallel_for_static(n,
+    [&](size_t i) {
+      size_t j = offset + i;
+      out[i] = (valid && !arrow_bit(valid, j))? GETNA<int8_t>()
+                                              : arrow_bit(data, j);
+    });
+  return Column::new_mbuf_column(SType::BOOL, std::move(mbuf));
+}
+
+
+// Arrow strings with offsets of type `A` (int32 or int64). The character
+// data is always shared. The offsets are shared too if they start at 0 and
+// there are no nulls; otherwise they are rebased and the NA flags added.
+template <typename A>
+static Column* import_string(const ArrowArray* arr, size_t offset, size_t n,
+                             const ownerptr& owner)
+{
+  using T = typename std::make_unsigned<A>::type;
+  if (n == 0) {
+    return Column::new_data_column(sizeof(A) == 4? SType::STR32
+                                                 : SType::STR64, 0);
+  }
+  const A* offs = static_cast<const A*>(arr->buffers[1]) + offset;
+  const char* strdata = static_cast<const char*>(arr->buffers[2]);
+  const void* valid = arr->null_count == 0? nullptr : arr->buffers[0];
+  A start = offs[0];
+  A end = offs[n];
+  MemoryRange offbuf;
+  MemoryRange strbuf;
+
+  bool compact = true;  // all null entries have zero length
+  if (valid) {
+    for (size_t i = 0; i < n && compact; ++i) {
+      compact = arrow_bit(valid, offset + i) || offs[i + 1] == offs[i];
+    }
+  }
+
+  if (!valid && start == 0) {
+    offbuf = MemoryRange::external(offs, (n + 1) * sizeof(A), owner);
+    strbuf = MemoryRange::external(strdata, static_cast<size_t>(end), owner);
+  }
+  else if (compact) {
+    offbuf = MemoryRange::mem((n + 1) * sizeof(T));
+    T* out = static_cast<T*>(offbuf.wptr());
+    out[0] = 0;
+    dt::parallel_for_static(n,
+      [&](size_t i) {
+        T off = static_cast<T>(offs[i + 1] - start);
+        bool isna = valid && !arrow_bit(valid, offset + i);
+        out[i + 1] = isna? (off | GETNA<T>()) : off;
+      });
+    strbuf = MemoryRange::external(strdata + start,
+                                   static_cast<size_t>(end - start), owner);
+  }
+  else {
+    // Some null entries have non-empty data (which is allowed by Arrow, but
+    // rare). In datatable NA strings must be empty, so the character data
+    // has to be copied while skipping those entries.
+    offbuf = MemoryRange::mem((n + 1) * sizeof(T));
+    T* out = static_cast<T*>(offbuf.wptr());
+    size_t total = 0;
+    for (size_t i = 0; i < n; ++i) {
+      if (arrow_bit(valid, offset + i)) {
+        total += static_cast<size_t>(offs[i + 1] - offs[i]);
+      }
+    }
+    strbuf = MemoryRange::mem(total);
+    char* outstr = static_cast<char*>(strbuf.wptr());
+    T pos = 0;
+    out[0] = 0;
+    for (size_t i = 0; i < n; ++i) {
+      if (arrow_bit(valid, offset + i)) {
+        size_t len = static_cast<size_t>(offs[i + 1] - offs[i]);
+        std::memcpy(outstr + pos, strdata + offs[i], len);
+        pos += static_cast<T>(len);
+        out[i + 1] = pos;
+      } else {
+        out[i + 1] = pos | GETNA<T>();
+      }
+    }
+  }
+  return new_string_column(n, std::move(offbuf), std::move(strbuf));
+}
+
+
+static SType stype_from_arrow_format(const char* format) {
+  if (format[0] && !format[1]) {
+    switch (format[0]) {
+      case 'n': return SType::BOOL;
+      case 'b': return SType::BOOL;
+      case 'c': return SType::INT8;
+      case 'C': return SType::INT16;
+      case 's': return SType::INT16;
+      case 'S': return SType::INT32;
+      case 'i': return SType::INT32;
+      case 'I': return SType::INT64;
+      case 'l': return SType::INT64;
+      case 'f': return SType::FLOAT32;
+      case 'g': return SType::FLOAT64;
+      case 'u': return SType::STR32;
+      case 'U': return SType::STR64;
+      default: break;
+    }
+  }
+  return SType::VOID;
+}
+
+
+// `parent_offset` is the offset of the parent struct array, if any: it is
+// applied on top of the child array's own offset.
+static Column* import_column(const ArrowSchema* schema, const ArrowArray* arr,
+                             size_t parent_offset, size_t n,
+                             const ownerptr& owner)
+{
+  const char* format = schema->format;
+  SType stype = stype_from_arrow_format(format);
+  if (stype == SType::VOID || schema->dictionary) {
+    throw NotImplError() << "Cannot import Arrow column `"
+        << (schema->name? schema->name : "") << "` of type `" << format
+        << "`: this type is not supported";
+  }
+  size_t offset = static_cast<size_t>(arr->offset) + parent_offset;
+  switch (format[0]) {
+    case 'n': return Column::new_na_column(SType::BOOL, n);
+    case 'b': return import_bool(arr, offset, n);
+    case 'c': return import_fw<int8_t, int8_t>(stype, arr, offset, n, owner);
+    case 'C': return import_fw<uint8_t, int16_t>(stype, arr, offset, n, owner);
+    case 's': return import_fw<int16_t, int16_t>(stype, arr, offset, n, owner);
+    case 'S': return import_fw<uint16_t, int32_t>(stype, arr, offset, n, owner);
+    case 'i': return import_fw<int32_t, int32_t>(stype, arr, offset, n, owner);
+    case 'I': return import_fw<uint32_t, int64_t>(stype, arr, offset, n, owner);
+    case 'l': return import_fw<int64_t, int64_t>(stype, arr, offset, n, owner);
+    case 'f': return import_fw<float, float>(stype, arr, offset, n, owner);
+    case 'g': return import_fw<double, double>(stype, arr, offset, n, owner);
+    case 'u': return import_string<int32_t>(arr, offset, n, owner);
+    case 'U': return import_string<int64_t>(arr, offset, n, owner);
+  }
+  throw RuntimeError() << "Unexpected Arrow format `" << format << "`";
+}
+
+
+// Import a "record batch", i.e. a struct array whose children are the
+// columns. A non-struct array is imported as a single-column frame. The
+// `owner` holds the (moved) array.
+static DataTable* import_batch(const ArrowSchema* schema,
+                               const ownerptr& owner)
+{
+  const ArrowArray* arr = &owner->array;
+  size_t nrows = static_cast<size_t>(arr->length);
+  colvec columns;
+  strvec names;
+  try {
+    if (std::strcmp(schema->format, "+s") == 0) {
+      size_t offset = static_cast<size_t>(arr->offset);
+      for (int64_t i = 0; i < schema->n_children; ++i) {
+        const ArrowSchema* child = schema->children[i];
+        columns.push_back(
+            import_column(child, arr->children[i], offset, nrows, owner));
+        names.push_back(child->name? child->name : "");
+      }
+    } else {
+      columns.push_back(import_column(schema, arr, 0, nrows, owner));
+      names.push_back(schema->name? schema->name : "");
+    }
+  } catch (...) {
+    for (Column* col : columns) delete col;
+    throw;
+  }
+  return new DataTable(std::move(columns), names);
+}
+
+
+// Create a frame with 0 rows, having the columns described by the schema.
+static DataTable* import_empty(const ArrowSchema* schema) {
+  ArrowArray empty {};
+  const void* buffers[3] = {nullptr, nullptr, nullptr};
+  empty.buffers = buffers;
+  std::vector<ArrowArray> children(static_cast<size_t>(schema->n_children),
+                                   empty);
+  std::vector<ArrowArray*> children_ptrs;
+  for (ArrowArray& child : children) children_ptrs.push_back(&child);
+  empty.n_children = schema->n_children;
+  empty.children = children_ptrs.data();
+  ArrowArray* src = &empty;
+  auto owner = std::make_shared<arrow_import_owner>(src);
+  return import_batch(schema, owner);
+}
+
+
+template <typename T>
+static T* get_capsule_pointer(py::robj capsule, const char* name) {
+  PyObject* obj = capsule.to_borrowed_ref();
+  void* ptr = PyCapsule_GetPointer(obj, name);
+  if (!ptr) throw PyError();
+  return static_cast<T*>(ptr);
+}
+
+
+static DataTable* import_from_array(py::robj src) {
+  py::otuple capsules = src.invoke("__arrow_c_array__").to_otuple();
+  if (capsules.size() != 2) {
+    throw TypeError() << "`__arrow_c_array__()` should return a tuple of "
+        "2 capsules";
+  }
+  auto schema = get_capsule_pointer<ArrowSchema>(capsules[0], "arrow_schema");
+  auto array = get_capsule_pointer<ArrowArray>(capsules[1], "arrow_array");
+  auto owner = std::make_shared<arrow_import_owner>(array);
+  return import_batch(schema, owner);
+}
+
+
+// A guard that releases an ArrowSchema upon exit from the scope
+struct schema_guard {
+  ArrowSchema schema;
+  schema_guard() : schema() {}
+  ~schema_guard() { if (schema.release) schema.release(&schema); }
+};
+
+
+static DataTable* import_from_stream(py::robj src) {
+  py::oobj capsule = src.invoke("__arrow_c_stream__");
+  auto stream = get_capsule_pointer<ArrowArrayStream>(capsule,
+                                                      "arrow_array_stream");
+  auto stream_error = [&](int code) {
+    const char* msg = stream->get_last_error(stream);
+    return RuntimeError() << "Error reading Arrow stream: "
+        << (msg? msg : std::strerror(code));
+  };
+
+  schema_guard sg;
+  int ret = stream->get_schema(stream, &sg.schema);
+  if (ret) throw stream_error(ret);
+
+  std::vector<std::unique_ptr<DataTable>> batches;
+  while (true) {
+    ArrowArray array {};
+    ret = stream->get_next(stream, &array);
+    if (ret) throw stream_error(ret);
+    if (!array.release) break;  // end of stream
+    auto owner = std::make_shared<arrow_import_owner>(&array);
+    batches.emplace_back(import_batch(&sg.schema, owner));
+  }
+  if (batches.empty()) {
+    return import_empty(&sg.schema);
+  }
+  DataTable* res = batches[0].release();
+  if (batches.size() > 1) {
+    std::vector<DataTable*> others;
+    for (size_t i = 1; i < batches.size(); ++i) {
+      others.push_back(batches[i].get());
+    }
+    std::vector<intvec> cols(res->ncols);
+    for (size_t j = 0; j < res->ncols; ++j) {
+      cols[j].assign(others.size(), j);
+    }
+    try {
+      res->rbind(others, cols);
+    } catch (...) {
+      delete res;
+      throw;
+    }
+  }
+  return res;
+}
+
+
+
+
+//------------------------------------------------------------------------------
+// Python interface
+//------------------------------------------------------------------------------
+namespace py {
+
+static PKArgs args_arrow_c_array(
+    0, 1, 0, false, false, {"requested_schema"}, "__arrow_c_array__",
+R"(__arrow_c_array__(self, requested_schema=None)
+--
+
+Export the frame via the Arrow PyCapsule interface. Returns a pair of
+PyCapsules containing the `ArrowSchema` and the `ArrowArray` structs of
+the Arrow C Data Interface. The frame is represented as a struct array,
+whose fields are the frame's columns.
+
+The buffers of fixed-width and string columns without NAs are shared
+with the consumer, rather than copied.
+
+The `requested_schema` parameter is currently ignored.
+)");
+
+oobj Frame::arrow_c_array(const PKArgs&) {
+  return export_capsules(dt);
+}
+
+
+static PKArgs args_to_arrow(
+    0, 0, 0, false, false, {}, "to_arrow",
+R"(to_arrow(self)
+--
+
+Convert this frame into a `pyarrow.Table`.
+
+The conversion is performed via the Arrow C Data Interface: the data
+buffers of fixed-width and string columns are shared with the Arrow table
+whenever their memory layouts agree (i.e. when the columns have no NAs).
+
+The `pyarrow` module (version 14 or newer) is required to run this
+function. Other Arrow-based libraries can consume a frame directly via
+its `__arrow_c_array__()` method.
+)");
+
+oobj Frame::to_arrow(const PKArgs&) {
+  oobj pyarrow = oobj::import("pyarrow");
+  otuple capsules = export_capsules(dt);
+  oobj batch = pyarrow.get_attr("RecordBatch")
+               .invoke("_import_from_c_capsule", capsules);
+  olist batches(1);
+  batches.set(0, batch);
+  return pyarrow.get_attr("Table").invoke("from_batches", otuple(batches));
+}
+
+
+static PKArgs args_from_arrow(
+    1, 0, 0, false, false, {"data"}, "from_arrow",
+R"(from_arrow(data)
+--
+
+Create a Frame from an Arrow object `data`. This can be any object that
+implements the Arrow PyCapsule interface, i.e. has either the method
+`__arrow_c_array__()` (for example `pyarrow.RecordBatch`, `pyarrow.Array`,
+or a datatable Frame), or the method `__arrow_c_stream__()` (for example
+`pyarrow.Table`). Struct arrays are converted into frames with one column
+per field; other arrays produce single-column frames.
+
+The data buffers are shared with the Arrow object rather than copied,
+whenever the memory layouts of datatable and Arrow agree.
+)");
+
+static oobj from_arrow(const PKArgs& args) {
+  robj src = args[0].to_pyobj();
+  DataTable* dt = nullptr;
+  if (src.has_attr("__arrow_c_array__")) {
+    dt = import_from_array(src);
+  }
+  else if (src.has_attr("__arrow_c_stream__")) {
+    dt = import_from_stream(src);
+  }
+  else {
+    throw TypeError() << "Cannot create a Frame from " << src.typeobj()
+        << ": the object does not support the Arrow PyCapsule interface";
+  }
+  return oobj::from_new_reference(Frame::from_datatable(dt));
+}
+
+
+void Frame::Type::_init_arrow(Methods& mm) {
+  ADD_METHOD(mm, &Frame::arrow_c_array, args_arrow_c_array);
+  ADD_METHOD(mm, &Frame::to_arrow, args_to_arrow);
+}
+
+void DatatableModule::init_methods_arrow() {
+  ADD_FN(&from_arrow, args_from_arrow);
+}
+
+
+}  // namespace py
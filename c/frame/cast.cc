@@ -27,7 +27,11 @@
 #include "parallel/api.h"           // dt::parallel_for_static
 #include "parallel/string_utils.h"  // dt::generate_string_column
 #include "python/_all.h"
+#include "python/datetime.h"
+#include "python/decimal.h"
 #include "python/string.h"
+#include "utils/datetime.h"
+#include "utils/decimal.h"
 #include "column.h"
 #include "datatablemodule.h"
 
@@ -92,6 +96,59 @@ static inline void obj_str(PyObject* x, dt::string_buf* buf) {
   buf->write(xstr);
 }
 
+static inline int64_t date32_date64(int32_t x) {
+  return ISNA<int32_t>(x)? GETNA<int64_t>() : x * dt::MICROS_PER_DAY;
+}
+
+static inline int32_t date64_date32(int64_t x) {
+  return ISNA<int64_t>(x)? GETNA<int32_t>()
+                         : static_cast<int32_t>(dt::date64_days(x));
+}
+
+static inline int32_t date64_time32(int64_t x) {
+  return ISNA<int64_t>(x)? GETNA<int32_t>()
+      : static_cast<int32_t>(dt::date64_time(x) / dt::MICROS_PER_MILLI);
+}
+
+static inline PyObject* date32_obj(int32_t x) {
+  return ISNA<int32_t>(x)? py::None().release() : py::odate(x).release();
+}
+
+static inline PyObject* date64_obj(int64_t x) {
+  return ISNA<int64_t>(x)? py::None().release() : py::odatetime(x).release();
+}
+
+static inline PyObject* time32_obj(int32_t x) {
+  return ISNA<int32_t>(x)? py::None().release() : py::otime(x).release();
+}
+
+static inline void date32_str(int32_t x, dt::string_buf* buf) {
+  char* ch = buf->prepare_raw_write(dt::DATE32_MAXLEN);
+  buf->commit_raw_write(dt::format_date32(ch, x));
+}
+
+static inline void date64_str(int64_t x, dt::string_buf* buf) {
+  char* ch = buf->prepare_raw_write(dt::DATE64_MAXLEN);
+  buf->commit_raw_write(dt::format_date64(ch, x));
+}
+
+static inline void time32_str(int32_t x, dt::string_buf* buf) {
+  char* ch = buf->prepare_raw_write(dt::TIME32_MAXLEN);
+  buf->commit_raw_write(dt::format_time32(ch, x));
+}
+
+static inline bool str_date32(const char* ch, const char* end, int32_t* out) {
+  return dt::parse_date32(ch, end, out) && ch == end;
+}
+
+static inline bool str_date64(const char* ch, const char* end, int64_t* out) {
+  return dt::parse_date64(ch, end, out, true) && ch == end;
+}
+
+static inline bool str_time32(const char* ch, const char* end, int32_t* out) {
+  return dt::parse_time32(ch, end, out) && ch == end;
+}
+
 
 
 
@@ -189,6 +246,31 @@ static void cast_str_to_pyobj(const Column* col, void* out_data)
 
 
 
+// Strings are parsed as ISO-8601 values; the strings that cannot be parsed
+// become NAs.
+template <typename T, typename U, bool(*PARSE_OP)(const char*, const char*, U*)>
+static void cast_str_to_temporal(const Column* col, void* out_data)
+{
+  auto scol = static_cast<const StringColumn<T>*>(col);
+  auto offsets = scol->offsets();
+  auto strdata = scol->strdata();
+  auto out = static_cast<U*>(out_data);
+  const RowIndex& rowindex = col->rowindex();
+  dt::parallel_for_static(col->nrows,
+    [=](size_t i) {
+      size_t j = rowindex[i];
+      T off_end = offsets[j];
+      out[i] = GETNA<U>();
+      if (j == RowIndex::NA || ISNA<T>(off_end)) return;
+      T off_start = offsets[j - 1] & ~GETNA<T>();
+      U value;
+      if (PARSE_OP(strdata + off_start, strdata + off_end, &value)) {
+        out[i] = value;
+      }
+    });
+}
+
+
 template <typename T, void (*CAST_OP)(T, dt::string_buf*)>
 static Column* cast_to_str(const Column* col, MemoryRange&& out_offsets,
                            SType target_stype)
@@ -248,6 +330,242 @@ static Column* cast_str_to_str(const Column* col, MemoryRange&& out_offsets,
 
 
 
+template <typename T>
+static Column* cast_cat_to_str(const Column* col, MemoryRange&& out_offsets,
+                               SType target_stype)
+{
+  auto ccol = static_cast<const CategoricalColumn<T>*>(col);
+  auto codes = ccol->elements_r();
+  const RowIndex& rowindex = col->rowindex();
+  return dt::generate_string_column(
+      [&](size_t i, dt::string_buf* buf) {
+        size_t j = rowindex[i];
+        if (j == RowIndex::NA || ISNA<T>(codes[j])) {
+          buf->write_na();
+        } else {
+          buf->write(ccol->level(codes[j]));
+        }
+      },
+      col->nrows,
+      std::move(out_offsets),
+      (target_stype == SType::STR64)
+  );
+}
+
+
+// Python string objects are created once for each level, and then shared
+// among all the rows with the same value.
+template <typename T>
+static void cast_cat_to_pyobj(const Column* col, void* out_data)
+{
+  auto ccol = static_cast<const CategoricalColumn<T>*>(col);
+  auto codes = ccol->elements_r();
+  auto out = static_cast<PyObject**>(out_data);
+  std::vector<py::oobj> levels(ccol->nlevels());
+  const RowIndex& rowindex = col->rowindex();
+  for (size_t i = 0; i < col->nrows; ++i) {
+    size_t j = rowindex[i];
+    T x = (j == RowIndex::NA)? GETNA<T>() : codes[j];
+    if (ISNA<T>(x)) {
+      out[i] = py::None().release();
+    } else {
+      py::oobj& level = levels[x];
+      if (!level) {
+        CString s = ccol->level(x);
+        level = py::ostring(s.ch, static_cast<size_t>(s.size));
+      }
+      out[i] = py::oobj(level).release();
+    }
+  }
+}
+
+
+template <typename T>
+static Column* cast_fstr_to_str(const Column* col, MemoryRange&& out_offsets,
+                                SType target_stype)
+{
+  auto xcol = static_cast<const FixedStringColumn*>(col);
+  const RowIndex& rowindex = col->rowindex();
+  return dt::generate_string_column(
+      [&](size_t i, dt::string_buf* buf) {
+        size_t j = rowindex[i];
+        CString s = (j == RowIndex::NA)? CString() : xcol->get_string(j);
+        if (s.isna()) {
+          buf->write_na();
+        } else {
+          buf->write(s);
+        }
+      },
+      col->nrows,
+      std::move(out_offsets),
+      (target_stype == SType::STR64)
+  );
+}
+
+
+static void cast_fstr_to_pyobj(const Column* col, void* out_data)
+{
+  auto xcol = static_cast<const FixedStringColumn*>(col);
+  auto out = static_cast<PyObject**>(out_data);
+  const RowIndex& rowindex = col->rowindex();
+  for (size_t i = 0; i < col->nrows; ++i) {
+    size_t j = rowindex[i];
+    CString s = (j == RowIndex::NA)? CString() : xcol->get_string(j);
+    out[i] = s.isna()? py::None().release()
+                     : py::ostring(s.ch, static_cast<size_t>(s.size)).release();
+  }
+}
+
+
+// All values are converted into fixed-width strings as wide as the longest
+// of them.
+static Column* cast_to_fstr(const Column* col, MemoryRange&&, SType)
+{
+  return fixed_width_strings(col);
+}
+
+
+// Decimals are converted into integers by truncating the fractional part,
+// and into floats by dividing by 10^scale. The scale is a property of the
+// column rather than of its values, so these casts cannot be expressed via
+// the per-element CAST_OPs above.
+template <typename T, typename U>
+static void dec_to_num(const Column* col, U* out, SType target_stype) {
+  auto inp = static_cast<const T*>(col->data());
+  const RowIndex& rowindex = col->rowindex();
+  int64_t p = dt::pow10i(decimal_scale(col));
+  double dp = static_cast<double>(p);
+  bool to_int = info(target_stype).ltype() == LType::INT;
+  bool to_bool = (target_stype == SType::BOOL);
+  dt::parallel_for_static(col->nrows,
+    [=](size_t i) {
+      size_t j = rowindex[i];
+      T x = (j == RowIndex::NA)? GETNA<T>() : inp[j];
+      out[i] = ISNA<T>(x)? GETNA<U>() :
+               to_bool? static_cast<U>(x != 0) :
+               to_int? static_cast<U>(static_cast<int64_t>(x) / p) :
+                       static_cast<U>(static_cast<double>(x) / dp);
+    });
+}
+
+template <typename T>
+static Column* cast_dec_to_fw(const Column* col, MemoryRange&& out_data,
+                              SType target_stype)
+{
+  out_data.resize(col->nrows * info(target_stype).elemsize());
+  void* out = out_data.wptr();
+  switch (target_stype) {
+    case SType::BOOL:
+    case SType::INT8:    dec_to_num<T>(col, static_cast<int8_t*>(out), target_stype); break;
+    case SType::INT16:   dec_to_num<T>(col, static_cast<int16_t*>(out), target_stype); break;
+    case SType::INT32:   dec_to_num<T>(col, static_cast<int32_t*>(out), target_stype); break;
+    case SType::INT64:   dec_to_num<T>(col, static_cast<int64_t*>(out), target_stype); break;
+    case SType::FLOAT32: dec_to_num<T>(col, static_cast<float*>(out), target_stype); break;
+    case SType::FLOAT64: dec_to_num<T>(col, static_cast<double*>(out), target_stype); break;
+    default: throw NotImplError() << "Unable to cast `" << col->stype()
+                                  << "` into `" << target_stype << "`";
+  }
+  return Column::new_mbuf_column(target_stype, std::move(out_data));
+}
+
+
+template <typename T>
+static Column* cast_dec_to_str(const Column* col, MemoryRange&& out_offsets,
+                               SType target_stype)
+{
+  auto inp = static_cast<const T*>(col->data());
+  const RowIndex& rowindex = col->rowindex();
+  int scale = decimal_scale(col);
+  return dt::generate_string_column(
+      [&](size_t i, dt::string_buf* buf) {
+        size_t j = rowindex[i];
+        if (j == RowIndex::NA || ISNA<T>(inp[j])) {
+          buf->write_na();
+        } else {
+          char* ch = buf->prepare_raw_write(dt::DECIMAL_MAXLEN);
+          buf->commit_raw_write(
+              dt::format_decimal(ch, static_cast<int64_t>(inp[j]), scale));
+        }
+      },
+      col->nrows,
+      std::move(out_offsets),
+      (target_stype == SType::STR64)
+  );
+}
+
+
+template <typename T>
+static Column* cast_dec_to_pyobj(const Column* col, MemoryRange&& out_data,
+                                 SType)
+{
+  auto inp = static_cast<const T*>(col->data());
+  const RowIndex& rowindex = col->rowindex();
+  int scale = decimal_scale(col);
+  out_data.resize(col->nrows * sizeof(PyObject*));
+  auto out = static_cast<PyObject**>(out_data.wptr());
+  for (size_t i = 0; i < col->nrows; ++i) {
+    size_t j = rowindex[i];
+    T x = (j == RowIndex::NA)? GETNA<T>() : inp[j];
+    out[i] = ISNA<T>(x)? py::None().release()
+                       : py::odecimal(static_cast<int64_t>(x), scale).release();
+  }
+  out_data.set_pyobjects(/* clear = */ false);
+  return Column::new_mbuf_column(SType::OBJ, std::move(out_data));
+}
+
+
+// The scale of the result is chosen automatically, see `decimal_column()`.
+static Column* cast_to_decimal(const Column* col, MemoryRange&&,
+                               SType target_stype)
+{
+  return decimal_column(col, target_stype);
+}
+
+
+// Re-encode the codes into a categorical type of different width, keeping
+// the same levels. The result may be wider than `target_stype` if there are
+// too many levels.
+static Column* cast_cat_to_cat(const Column* col, MemoryRange&& out_codes,
+                               SType target_stype)
+{
+  const auto& levels = categorical_levels(col);
+  SType stype = categorical_stype(levels->nrows, target_stype);
+  std::vector<uint32_t> map(levels->nrows);
+  for (size_t k = 0; k < map.size(); ++k) map[k] = static_cast<uint32_t>(k);
+  out_codes.resize(col->nrows * info(stype).elemsize());
+  void* out = out_codes.wptr();
+  switch (stype) {
+    case SType::CAT8:
+      recode_categorical(col, map, static_cast<uint8_t*>(out)); break;
+    case SType::CAT16:
+      recode_categorical(col, map, static_cast<uint16_t*>(out)); break;
+    default:
+      recode_categorical(col, map, static_cast<uint32_t*>(out)); break;
+  }
+  Column* res = new_categorical_column(stype, std::move(out_codes), levels);
+  if (col->is_na_free()) res->set_na_free();
+  return res;
+}
+
+
+static Column* cast_str_to_cat(const Column* col, MemoryRange&&,
+                               SType target_stype)
+{
+  return categorize(col, target_stype);
+}
+
+
+// Other types are converted into categoricals via their string
+// representations.
+static Column* cast_any_to_cat(const Column* col, MemoryRange&&,
+                               SType target_stype)
+{
+  std::unique_ptr<Column> strcol(col->cast(SType::STR32));
+  return categorize(strcol.get(), target_stype);
+}
+
+
+
 
 //------------------------------------------------------------------------------
 // cast_manager
@@ -261,10 +579,12 @@ class cast_manager {
     using castfnx = Column* (*)(const Column*, MemoryRange&&, SType);
     struct cast_info {
       castfn0  f0;
+      castfn0  f0n;  // same as f0, but for columns without NAs
       castfn1  f1;
       castfn2  f2;
       castfnx  fx;
-      cast_info() : f0(nullptr), f1(nullptr), f2(nullptr), fx(nullptr) {}
+      cast_info() : f0(nullptr), f0n(nullptr), f1(nullptr), f2(nullptr),
+                    fx(nullptr) {}
     };
     std::unordered_map<size_t, cast_info> all_casts;
 
@@ -274,6 +594,7 @@ class cast_manager {
     inline void add(SType st_from, SType st_to, castfn1 f);
     inline void add(SType st_from, SType st_to, castfn2 f);
     inline void add(SType st_from, SType st_to, castfnx f);
+    inline void add_nona(SType st_from, SType st_to, castfn0 f);
 
     Column* execute(const Column*, MemoryRange&&, SType);
 
@@ -309,6 +630,32 @@ void cast_manager::add(SType st_from, SType st_to, castfnx f) {
   all_casts[id].fx = f;
 }
 
+void cast_manager::add_nona(SType st_from, SType st_to, castfn0 f) {
+  size_t id = key(st_from, st_to);
+  xassert(!all_casts[id].f0n);
+  all_casts[id].f0n = f;
+}
+
+
+// Return true if casting an NA-free column from stype `st_from` into
+// `st_to` is guaranteed to produce an NA-free column. This is the case
+// for casts into floats, into booleans, and for non-narrowing integer casts.
+// Other casts may overflow and accidentally produce a value that is equal
+// to the NA sentinel.
+static bool cast_preserves_nona(SType st_from, SType st_to) {
+  LType lt_from = info(st_from).ltype();
+  LType lt_to = info(st_to).ltype();
+  if (lt_to == LType::REAL || lt_to == LType::BOOL) {
+    return lt_from == LType::BOOL || lt_from == LType::INT ||
+           lt_from == LType::REAL;
+  }
+  if (lt_to == LType::INT) {
+    return (lt_from == LType::BOOL || lt_from == LType::INT) &&
+           info(st_to).elemsize() >= info(st_from).elemsize();
+  }
+  return false;
+}
+
 
 Column* cast_manager::execute(const Column* src, MemoryRange&& target_mbuf,
                               SType target_stype)
@@ -330,10 +677,12 @@ Column* cast_manager::execute(const Column* src, MemoryRange&& target_mbuf,
   target_mbuf.resize(src->nrows * info(target_stype).elemsize());
   void* out_data = target_mbuf.wptr();
   const RowIndex& rowindex = src->rowindex();
+  bool nona = src->is_na_free();
+  castfn0 f0 = (nona && castfns.f0n)? castfns.f0n : castfns.f0;
 
   if (rowindex) {
-    if (castfns.f0 && rowindex.is_simple_slice()) {
-      castfns.f0(src, rowindex.slice_start(), out_data);
+    if (f0 && rowindex.is_simple_slice()) {
+      f0(src, rowindex.slice_start(), out_data);
     }
     else if (castfns.f1 && rowindex.isarr32()) {
       castfns.f1(src, rowindex.indices32(), out_data);
@@ -343,8 +692,8 @@ Column* cast_manager::execute(const Column* src, MemoryRange&& target_mbuf,
     }
   }
   else {
-    if (castfns.f0) {
-      castfns.f0(src, 0, out_data);
+    if (f0) {
+      f0(src, 0, out_data);
     }
     else {
       castfns.f2(src, out_data);
@@ -355,7 +704,11 @@ Column* cast_manager::execute(const Column* src, MemoryRange&& target_mbuf,
     target_mbuf.set_pyobjects(/* clear = */ false);
   }
 
-  return Column::new_mbuf_column(target_stype, std::move(target_mbuf));
+  Column* res = Column::new_mbuf_column(target_stype, std::move(target_mbuf));
+  if (nona && cast_preserves_nona(src->stype(), target_stype)) {
+    res->set_na_free();
+  }
+  return res;
 }
 
 
@@ -380,12 +733,25 @@ void py::DatatableModule::init_casts()
   constexpr SType int64  = SType::INT64;
   constexpr SType real32 = SType::FLOAT32;
   constexpr SType real64 = SType::FLOAT64;
+  constexpr SType dec16  = SType::DEC16;
+  constexpr SType dec32  = SType::DEC32;
+  constexpr SType dec64  = SType::DEC64;
   constexpr SType str32  = SType::STR32;
   constexpr SType str64  = SType::STR64;
+  constexpr SType fstr   = SType::FSTR;
+  constexpr SType cat8   = SType::CAT8;
+  constexpr SType cat16  = SType::CAT16;
+  constexpr SType cat32  = SType::CAT32;
+  constexpr SType date64 = SType::DATE64;
+  constexpr SType time32 = SType::TIME32;
+  constexpr SType date32 = SType::DATE32;
   constexpr SType obj64  = SType::OBJ;
 
   // Trivial casts
   casts.add(bool8, bool8,   cast_fw0<int8_t,  int8_t,  _copy<int8_t>>);
+  casts.add(date64, date64, cast_fw0<int64_t, int64_t, _copy<int64_t>>);
+  casts.add(time32, time32, cast_fw0<int32_t, int32_t, _copy<int32_t>>);
+  casts.add(date32, date32, cast_fw0<int32_t, int32_t, _copy<int32_t>>);
   casts.add(int8, int8,     cast_fw0<int8_t,  int8_t,  _copy<int8_t>>);
   casts.add(int16, int16,   cast_fw0<int16_t, int16_t, _copy<int16_t>>);
   casts.add(int32, int32,   cast_fw0<int32_t, int32_t, _copy<int32_t>>);
@@ -394,6 +760,9 @@ void py::DatatableModule::init_casts()
   casts.add(real64, real64, cast_fw0<double,  double,  _copy<double>>);
 
   casts.add(bool8, bool8,   cast_fw1<int8_t,  int8_t,  _copy<int8_t>>);
+  casts.add(date64, date64, cast_fw1<int64_t, int64_t, _copy<int64_t>>);
+  casts.add(time32, time32, cast_fw1<int32_t, int32_t, _copy<int32_t>>);
+  casts.add(date32, date32, cast_fw1<int32_t, int32_t, _copy<int32_t>>);
   casts.add(int8, int8,     cast_fw1<int8_t,  int8_t,  _copy<int8_t>>);
   casts.add(int16, int16,   cast_fw1<int16_t, int16_t, _copy<int16_t>>);
   casts.add(int32, int32,   cast_fw1<int32_t, int32_t, _copy<int32_t>>);
@@ -402,6 +771,9 @@ void py::DatatableModule::init_casts()
   casts.add(real64, real64, cast_fw1<double,  double,  _copy<double>>);
 
   casts.add(bool8, bool8,   cast_fw2<int8_t,  int8_t,  _copy<int8_t>>);
+  casts.add(date64, date64, cast_fw2<int64_t, int64_t, _copy<int64_t>>);
+  casts.add(time32, time32, cast_fw2<int32_t, int32_t, _copy<int32_t>>);
+  casts.add(date32, date32, cast_fw2<int32_t, int32_t, _copy<int32_t>>);
   casts.add(int8, int8,     cast_fw2<int8_t,  int8_t,  _copy<int8_t>>);
   casts.add(int16, int16,   cast_fw2<int16_t, int16_t, _copy<int16_t>>);
   casts.add(int32, int32,   cast_fw2<int32_t, int32_t, _copy<int32_t>>);
@@ -514,6 +886,34 @@ void py::DatatableModule::init_casts()
   casts.add(int64, real64,  cast_fw2<int64_t, double, fw_fw<int64_t, double>>);
   casts.add(real32, real64, cast_fw2<float,   double, _static<float, double>>);
 
+  // Casts of NA-free columns: no need to check for NAs in the source
+  // data, so a plain static_cast suffices.
+  casts.add_nona(bool8,  int32,  cast_fw0<int8_t,  int32_t, _static<int8_t, int32_t>>);
+  casts.add_nona(int8,   int32,  cast_fw0<int8_t,  int32_t, _static<int8_t, int32_t>>);
+  casts.add_nona(int16,  int32,  cast_fw0<int16_t, int32_t, _static<int16_t, int32_t>>);
+  casts.add_nona(int64,  int32,  cast_fw0<int64_t, int32_t, _static<int64_t, int32_t>>);
+  casts.add_nona(real32, int32,  cast_fw0<float,   int32_t, _static<float, int32_t>>);
+  casts.add_nona(real64, int32,  cast_fw0<double,  int32_t, _static<double, int32_t>>);
+
+  casts.add_nona(bool8,  int64,  cast_fw0<int8_t,  int64_t, _static<int8_t, int64_t>>);
+  casts.add_nona(int8,   int64,  cast_fw0<int8_t,  int64_t, _static<int8_t, int64_t>>);
+  casts.add_nona(int16,  int64,  cast_fw0<int16_t, int64_t, _static<int16_t, int64_t>>);
+  casts.add_nona(int32,  int64,  cast_fw0<int32_t, int64_t, _static<int32_t, int64_t>>);
+  casts.add_nona(real32, int64,  cast_fw0<float,   int64_t, _static<float, int64_t>>);
+  casts.add_nona(real64, int64,  cast_fw0<double,  int64_t, _static<double, int64_t>>);
+
+  casts.add_nona(bool8,  real32, cast_fw0<int8_t,  float, _static<int8_t, float>>);
+  casts.add_nona(int8,   real32, cast_fw0<int8_t,  float, _static<int8_t, float>>);
+  casts.add_nona(int16,  real32, cast_fw0<int16_t, float, _static<int16_t, float>>);
+  casts.add_nona(int32,  real32, cast_fw0<int32_t, float, _static<int32_t, float>>);
+  casts.add_nona(int64,  real32, cast_fw0<int64_t, float, _static<int64_t, float>>);
+
+  casts.add_nona(bool8,  real64, cast_fw0<int8_t,  double, _static<int8_t, double>>);
+  casts.add_nona(int8,   real64, cast_fw0<int8_t,  double, _static<int8_t, double>>);
+  casts.add_nona(int16,  real64, cast_fw0<int16_t, double, _static<int16_t, double>>);
+  casts.add_nona(int32,  real64, cast_fw0<int32_t, double, _static<int32_t, double>>);
+  casts.add_nona(int64,  real64, cast_fw0<int64_t, double, _static<int64_t, double>>);
+
   // Casts into str32
   casts.add(bool8, str32,  cast_to_str<int8_t, bool_str>);
   casts.add(int8, str32,   cast_to_str<int8_t, num_str<int8_t>>);
@@ -522,8 +922,18 @@ void py::DatatableModule::init_casts()
   casts.add(int64, str32,  cast_to_str<int64_t, num_str<int64_t>>);
   casts.add(real32, str32, cast_to_str<float, num_str<float>>);
   casts.add(real64, str32, cast_to_str<double, num_str<double>>);
+  casts.add(dec16, str32,  cast_dec_to_str<int16_t>);
+  casts.add(dec32, str32,  cast_dec_to_str<int32_t>);
+  casts.add(dec64, str32,  cast_dec_to_str<int64_t>);
   casts.add(str32, str32,  cast_str_to_str<uint32_t>);
   casts.add(str64, str32,  cast_str_to_str<uint64_t>);
+  casts.add(fstr, str32,   cast_fstr_to_str<uint32_t>);
+  casts.add(cat8, str32,   cast_cat_to_str<uint8_t>);
+  casts.add(cat16, str32,  cast_cat_to_str<uint16_t>);
+  casts.add(cat32, str32,  cast_cat_to_str<uint32_t>);
+  casts.add(date64, str32, cast_to_str<int64_t, date64_str>);
+  casts.add(time32, str32, cast_to_str<int32_t, time32_str>);
+  casts.add(date32, str32, cast_to_str<int32_t, date32_str>);
   casts.add(obj64, str32,  cast_to_str<PyObject*, obj_str>);
 
   // Casts into str64
@@ -534,10 +944,41 @@ void py::DatatableModule::init_casts()
   casts.add(int64, str64,  cast_to_str<int64_t, num_str<int64_t>>);
   casts.add(real32, str64, cast_to_str<float, num_str<float>>);
   casts.add(real64, str64, cast_to_str<double, num_str<double>>);
+  casts.add(dec16, str64,  cast_dec_to_str<int16_t>);
+  casts.add(dec32, str64,  cast_dec_to_str<int32_t>);
+  casts.add(dec64, str64,  cast_dec_to_str<int64_t>);
   casts.add(str32, str64,  cast_str_to_str<uint32_t>);
   casts.add(str64, str64,  cast_str_to_str<uint64_t>);
+  casts.add(fstr, str64,   cast_fstr_to_str<uint64_t>);
+  casts.add(cat8, str64,   cast_cat_to_str<uint8_t>);
+  casts.add(cat16, str64,  cast_cat_to_str<uint16_t>);
+  casts.add(cat32, str64,  cast_cat_to_str<uint32_t>);
+  casts.add(date64, str64, cast_to_str<int64_t, date64_str>);
+  casts.add(time32, str64, cast_to_str<int32_t, time32_str>);
+  casts.add(date32, str64, cast_to_str<int32_t, date32_str>);
   casts.add(obj64, str64,  cast_to_str<PyObject*, obj_str>);
 
+  // Casts into fstr
+  for (SType from : {bool8, int8, int16, int32, int64, real32, real64,
+                     dec16, dec32, dec64, str32, str64, fstr, cat8, cat16,
+                     cat32, date64, time32, date32, obj64}) {
+    casts.add(from, fstr, cast_to_fstr);
+  }
+
+  // Casts into categoricals
+  for (SType st : {cat8, cat16, cat32}) {
+    for (SType from : {bool8, int8, int16, int32, int64, real32, real64,
+                       dec16, dec32, dec64, fstr, date64, time32, date32,
+                       obj64}) {
+      casts.add(from, st, cast_any_to_cat);
+    }
+    casts.add(str32, st, cast_str_to_cat);
+    casts.add(str64, st, cast_str_to_cat);
+    casts.add(cat8, st,  cast_cat_to_cat);
+    casts.add(cat16, st, cast_cat_to_cat);
+    casts.add(cat32, st, cast_cat_to_cat);
+  }
+
   // Casts into obj64
   casts.add(bool8, obj64,  cast_to_pyobj<int8_t,    bool_obj>);
   casts.add(int8, obj64,   cast_to_pyobj<int8_t,    int_obj<int8_t>>);
@@ -546,9 +987,60 @@ void py::DatatableModule::init_casts()
   casts.add(int64, obj64,  cast_to_pyobj<int64_t,   int_obj<int64_t>>);
   casts.add(real32, obj64, cast_to_pyobj<float,     real_obj<float>>);
   casts.add(real64, obj64, cast_to_pyobj<double,    real_obj<double>>);
+  casts.add(dec16, obj64,  cast_dec_to_pyobj<int16_t>);
+  casts.add(dec32, obj64,  cast_dec_to_pyobj<int32_t>);
+  casts.add(dec64, obj64,  cast_dec_to_pyobj<int64_t>);
   casts.add(str32, obj64,  cast_str_to_pyobj<uint32_t>);
   casts.add(str64, obj64,  cast_str_to_pyobj<uint64_t>);
+  casts.add(fstr, obj64,   cast_fstr_to_pyobj);
+  casts.add(cat8, obj64,   cast_cat_to_pyobj<uint8_t>);
+  casts.add(cat16, obj64,  cast_cat_to_pyobj<uint16_t>);
+  casts.add(cat32, obj64,  cast_cat_to_pyobj<uint32_t>);
+  casts.add(date64, obj64, cast_to_pyobj<int64_t,   date64_obj>);
+  casts.add(time32, obj64, cast_to_pyobj<int32_t,   time32_obj>);
+  casts.add(date32, obj64, cast_to_pyobj<int32_t,   date32_obj>);
   casts.add(obj64, obj64,  cast_to_pyobj<PyObject*, obj_obj>);
+
+  // Temporal <-> integer casts reinterpret the underlying values
+  casts.add(date64, int64, cast_fw2<int64_t, int64_t, _copy<int64_t>>);
+  casts.add(time32, int32, cast_fw2<int32_t, int32_t, _copy<int32_t>>);
+  casts.add(date32, int32, cast_fw2<int32_t, int32_t, _copy<int32_t>>);
+  casts.add(int64, date64, cast_fw2<int64_t, int64_t, _copy<int64_t>>);
+  casts.add(int32, time32, cast_fw2<int32_t, int32_t, _copy<int32_t>>);
+  casts.add(int32, date32, cast_fw2<int32_t, int32_t, _copy<int32_t>>);
+  casts.add(date64, int32, cast_fw2<int64_t, int32_t, fw_fw<int64_t, int32_t>>);
+  casts.add(time32, int64, cast_fw2<int32_t, int64_t, fw_fw<int32_t, int64_t>>);
+  casts.add(date32, int64, cast_fw2<int32_t, int64_t, fw_fw<int32_t, int64_t>>);
+  casts.add(int32, date64, cast_fw2<int32_t, int64_t, fw_fw<int32_t, int64_t>>);
+  casts.add(int64, time32, cast_fw2<int64_t, int32_t, fw_fw<int64_t, int32_t>>);
+  casts.add(int64, date32, cast_fw2<int64_t, int32_t, fw_fw<int64_t, int32_t>>);
+
+  // Conversions between temporal types
+  casts.add(date32, date64, cast_fw2<int32_t, int64_t, date32_date64>);
+  casts.add(date64, date32, cast_fw2<int64_t, int32_t, date64_date32>);
+  casts.add(date64, time32, cast_fw2<int64_t, int32_t, date64_time32>);
+
+  // Casts into / from decimals
+  for (SType st : {dec16, dec32, dec64}) {
+    for (SType from : {bool8, int8, int16, int32, int64, real32, real64,
+                       dec16, dec32, dec64, str32, str64, fstr, cat8, cat16,
+                       cat32, obj64}) {
+      casts.add(from, st, cast_to_decimal);
+    }
+  }
+  for (SType st : {bool8, int8, int16, int32, int64, real32, real64}) {
+    casts.add(dec16, st, cast_dec_to_fw<int16_t>);
+    casts.add(dec32, st, cast_dec_to_fw<int32_t>);
+    casts.add(dec64, st, cast_dec_to_fw<int64_t>);
+  }
+
+  // Parse strings into temporal types
+  casts.add(str32, date64, cast_str_to_temporal<uint32_t, int64_t, str_date64>);
+  casts.add(str32, time32, cast_str_to_temporal<uint32_t, int32_t, str_time32>);
+  casts.add(str32, date32, cast_str_to_temporal<uint32_t, int32_t, str_date32>);
+  casts.add(str64, date64, cast_str_to_temporal<uint64_t, int64_t, str_date64>);
+  casts.add(str64, time32, cast_str_to_temporal<uint64_t, int32_t, str_time32>);
+  casts.add(str64, date32, cast_str_to_temporal<uint64_t, int32_t, str_date32>);
 }
 
 
@@ -13,9 +13,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //------------------------------------------------------------------------------
+#include <vector>
 #include "frame/py_frame.h"
 #include "utils/exceptions.h"
 #include "utils/misc.h"      // repr_utf8
+#include "codec.h"
 #include "datatable.h"
 #include "encodings.h"
 
@@ -197,9 +199,20 @@ void Column::verify_integrity(const std::string& name) const {
 void BoolColumn::verify_integrity(const std::string& name) const {
   FwColumn<int8_t>::verify_integrity(name);
 
-  // Check that all elements in column are either 0, 1, or NA_I1
+  // Check that all elements in column are either 0, 1, or NA_I1. The values
+  // of a compressed column are checked via its codec, so that the column's
+  // data is not decompressed (which would drop the encoding).
   size_t mbuf_nrows = data_nrows();
-  const int8_t* vals = elements_r();
+  std::vector<int8_t> decoded;
+  const int8_t* vals;
+  auto codec = get_codec();
+  if (codec) {
+    decoded.resize(mbuf_nrows);
+    codec->decode(0, mbuf_nrows, decoded.data());
+    vals = decoded.data();
+  } else {
+    vals = elements_r();
+  }
   for (size_t i = 0; i < mbuf_nrows; ++i) {
     int8_t val = vals[i];
     if (!(val == 0 || val == 1 || val == NA_I1)) {
@@ -271,6 +284,106 @@ void StringColumn<T>::verify_integrity(const std::string& name) const {
 
 
 
+//------------------------------------------------------------------------------
+// FixedStringColumn
+//------------------------------------------------------------------------------
+
+void FixedStringColumn::verify_integrity(const std::string& name) const {
+  if (width == 0) {
+    throw AssertionError() << "(Fixed-width string) " << name
+        << " has width 0";
+  }
+  if (mbuf.size() % width != 0) {
+    throw AssertionError() << "Size of the data buffer of (fixed-width "
+        "string) " << name << " is " << mbuf.size() << ", which is not a "
+        "multiple of its width " << width;
+  }
+  Column::verify_integrity(name);
+
+  // Check that each value is either NA (all bytes 0xFF), or a valid UTF-8
+  // string padded with \0s
+  size_t mbuf_nrows = data_nrows();
+  const uint8_t* cdata = reinterpret_cast<const uint8_t*>(chars());
+  for (size_t i = 0; i < mbuf_nrows; ++i) {
+    const uint8_t* x = cdata + i * width;
+    if (x[0] == NA_BYTE) {
+      for (size_t k = 1; k < width; ++k) {
+        if (x[k] != NA_BYTE) {
+          throw AssertionError() << "NA value in row " << i << " of "
+              "(fixed-width string) " << name << " has byte " << int(x[k])
+              << " at position " << k;
+        }
+      }
+      continue;
+    }
+    CString s = get_string(i);
+    if (!is_valid_utf8(x, static_cast<size_t>(s.size))) {
+      throw AssertionError()
+          << "Invalid UTF-8 string in row " << i << " of " << name << ": "
+          << repr_utf8(x, x + s.size);
+    }
+  }
+}
+
+
+
+//------------------------------------------------------------------------------
+// CategoricalColumn
+//------------------------------------------------------------------------------
+
+template <typename T>
+void CategoricalColumn<T>::verify_integrity(const std::string& name) const {
+  FwColumn<T>::verify_integrity(name);
+  levels->verify_integrity(name + ".levels");
+
+  if (levels->rowindex()) {
+    throw AssertionError() << "Levels of (categorical) " << name
+        << " have a rowindex";
+  }
+  size_t n = nlevels();
+  if (n > MAX_LEVELS) {
+    throw AssertionError() << "(Categorical) " << name << " has " << n
+        << " levels, whereas at most " << MAX_LEVELS << " are allowed";
+  }
+
+  // Check that all codes are valid
+  size_t mbuf_nrows = this->data_nrows();
+  const T* codes = this->elements_r();
+  for (size_t i = 0; i < mbuf_nrows; ++i) {
+    T x = codes[i];
+    if (!ISNA<T>(x) && static_cast<size_t>(x) >= n) {
+      throw AssertionError()
+          << "(Categorical) " << name << " has code " << static_cast<size_t>(x)
+          << " in row " << i
+          << ", whereas the number of levels is " << n;
+    }
+  }
+
+  // Check that the levels are sorted, unique, and not NA
+  for (size_t k = 0; k < n; ++k) {
+    CString lvl = level(k);
+    if (lvl.isna()) {
+      throw AssertionError() << "Level " << k << " of (categorical) " << name
+          << " is NA";
+    }
+    if (k == 0) continue;
+    CString prev = level(k - 1);
+    size_t len = static_cast<size_t>(std::min(prev.size, lvl.size));
+    int c = len? std::memcmp(prev.ch, lvl.ch, len) : 0;
+    if (c > 0 || (c == 0 && prev.size >= lvl.size)) {
+      throw AssertionError() << "Levels of (categorical) " << name
+          << " are not sorted or not unique: level " << k - 1 << " is "
+          << repr_utf8(reinterpret_cast<const uint8_t*>(prev.ch),
+                       reinterpret_cast<const uint8_t*>(prev.ch + prev.size))
+          << ", and level " << k << " is "
+          << repr_utf8(reinterpret_cast<const uint8_t*>(lvl.ch),
+                       reinterpret_cast<const uint8_t*>(lvl.ch + lvl.size));
+    }
+  }
+}
+
+
+
 //------------------------------------------------------------------------------
 // PyObjColumn
 //------------------------------------------------------------------------------
@@ -301,6 +414,22 @@ void PyObjectColumn::verify_integrity(const std::string& name) const {
 }
 
 
+template <typename T>
+void DecimalColumn<T>::verify_integrity(const std::string& name) const {
+  FwColumn<T>::verify_integrity(name);
+  if (scale < 0 || scale > decimal_max_scale(stype())) {
+    throw AssertionError() << "(Decimal) " << name << " of stype "
+        << stype() << " has invalid scale " << scale;
+  }
+}
+
+
 // Explicit instantiation of templates
+template class DecimalColumn<int16_t>;
+template class DecimalColumn<int32_t>;
+template class DecimalColumn<int64_t>;
 template class StringColumn<uint32_t>;
 template class StringColumn<uint64_t>;
+template class CategoricalColumn<uint8_t>;
+template class CategoricalColumn<uint16_t>;
+template class CategoricalColumn<uint32_t>;
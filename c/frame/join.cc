@@ -19,15 +19,21 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 //------------------------------------------------------------------------------
+#include <algorithm>    // std::min, std::max
+#include <cmath>        // std::isnan
+#include <cstring>      // std::memcpy
 #include <limits>       // std::numeric_limits
 #include <memory>       // std::unique_ptr
 #include <type_traits>  // std::is_integral
+#include <utility>      // std::pair
 #include <vector>       // std::vector
+#include "models/murmurhash.h"
 #include "parallel/api.h"
 #include "python/args.h"
 #include "python/obj.h"
 #include "python/tuple.h"
 #include "utils/assert.h"
+#include "utils/decimal.h"
 #include "column.h"
 #include "datatable.h"
 #include "datatablemodule.h"
@@ -66,19 +72,59 @@ static comparator_maker cmps[DT_STYPES_COUNT][DT_STYPES_COUNT];
  *     or 0 depending if the row-value is greater than, less than, or equal
  *     to the value stored.
  *
- * This comparison function is then used as the basis for the binary search
- * algorithm to perform a join between two tables.
+ *   hash_jrow(size_t row) -> uint64_t
+ *     return the hash of the `row`th value in the J frame.
+ *
+ *   hash_xrow() -> uint64_t
+ *     return the hash of the value from the X frame stored during the previous
+ *     `set_xrow()` call. The hashes are computed after the X value was
+ *     converted into the type of the J column, and they are consistent with
+ *     the comparison functions: if `cmp_jrow(j) == 0` then
+ *     `hash_jrow(j) == hash_xrow()`.
+ *
+ * These functions are then used as the basis for the hash join algorithm
+ * between two tables.
  */
 class Cmp {
   public:
     virtual ~Cmp();
     virtual int cmp_jrow(size_t row) const = 0;
     virtual int set_xrow(size_t row) = 0;
+    virtual uint64_t hash_jrow(size_t row) const = 0;
+    virtual uint64_t hash_xrow() const = 0;
 };
 
 Cmp::~Cmp() {}
 
 
+static constexpr uint64_t HASH_NA = 0x5BD1E9955BD1E995ULL;
+
+static inline uint64_t hash_mix(uint64_t h) {
+  h ^= h >> 33;
+  h *= 0xFF51AFD7ED558CCDULL;
+  h ^= h >> 33;
+  h *= 0xC4CEB9FE1A85EC53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+// Integer values are hashed as int64, and floating-point values as double.
+// This ensures that a value hashes the same regardless of the type it was
+// converted into. The NA values all hash to the same constant, and the
+// negative zero is hashed as positive zero (since they compare equal).
+template <typename T>
+static inline uint64_t hash_value(T value) {
+  if (ISNA<T>(value)) return HASH_NA;
+  if (std::is_integral<T>::value) {
+    return hash_mix(static_cast<uint64_t>(static_cast<int64_t>(value)));
+  }
+  double d = static_cast<double>(value) + 0.0;
+  uint64_t bits;
+  std::memcpy(&bits, &d, sizeof(double));
+  return hash_mix(bits);
+}
+
+
 
 //------------------------------------------------------------------------------
 // MultiCmp
@@ -93,6 +139,8 @@ class MultiCmp : public Cmp {
              const DataTable* Xdt, const DataTable* Jdt);
     int set_xrow(size_t row) override;
     int cmp_jrow(size_t row) const override;
+    uint64_t hash_jrow(size_t row) const override;
+    uint64_t hash_xrow() const override;
 };
 
 
@@ -134,6 +182,22 @@ int MultiCmp::cmp_jrow(size_t row) const {
   return 0;
 }
 
+uint64_t MultiCmp::hash_jrow(size_t row) const {
+  uint64_t h = 0;
+  for (const cmpptr& ch : col_cmps) {
+    h = (h ^ ch->hash_jrow(row)) * 0x9E3779B97F4A7C15ULL;
+  }
+  return h;
+}
+
+uint64_t MultiCmp::hash_xrow() const {
+  uint64_t h = 0;
+  for (const cmpptr& ch : col_cmps) {
+    h = (h ^ ch->hash_xrow()) * 0x9E3779B97F4A7C15ULL;
+  }
+  return h;
+}
+
 
 
 //------------------------------------------------------------------------------
@@ -154,6 +218,8 @@ class FwCmp : public Cmp {
 
     int cmp_jrow(size_t row) const override;
     int set_xrow(size_t row) override;
+    uint64_t hash_jrow(size_t row) const override;
+    uint64_t hash_xrow() const override;
 };
 
 
@@ -206,6 +272,112 @@ int FwCmp<TX, TJ>::set_xrow(size_t row) {
 }
 
 
+template <typename TX, typename TJ>
+uint64_t FwCmp<TX, TJ>::hash_jrow(size_t row) const {
+  return hash_value<TJ>(dataJ[row]);
+}
+
+
+template <typename TX, typename TJ>
+uint64_t FwCmp<TX, TJ>::hash_xrow() const {
+  return hash_value<TJ>(x_value);
+}
+
+
+
+//------------------------------------------------------------------------------
+// Decimal Cmp
+//------------------------------------------------------------------------------
+
+/**
+ * Comparison where at least one of the columns is decimal, and the other is
+ * an integer or a decimal. The X values are converted into the scale of the
+ * J column; values that cannot be represented exactly at that scale cannot
+ * match anything. Integer columns are treated as decimals with scale 0.
+ */
+template <typename TX, typename TJ>
+class DecCmp : public Cmp {
+  private:
+    const TX* dataX;
+    const TJ* dataJ;
+    int scaleX;
+    int scaleJ;
+    TJ x_value;
+    size_t : (64 - 8 * sizeof(TJ)) & 63;
+
+  public:
+    DecCmp(const Column*, const Column*);
+    static cmpptr make(const Column*, const Column*);
+
+    int cmp_jrow(size_t row) const override;
+    int set_xrow(size_t row) override;
+    uint64_t hash_jrow(size_t row) const override;
+    uint64_t hash_xrow() const override;
+};
+
+
+template <typename TX, typename TJ>
+DecCmp<TX, TJ>::DecCmp(const Column* xcol, const Column* jcol) {
+  dataX = static_cast<const TX*>(xcol->data());
+  dataJ = static_cast<const TJ*>(jcol->data());
+  scaleX = is_decimal(xcol->stype())? decimal_scale(xcol) : 0;
+  scaleJ = is_decimal(jcol->stype())? decimal_scale(jcol) : 0;
+}
+
+template <typename TX, typename TJ>
+cmpptr DecCmp<TX, TJ>::make(const Column* col1, const Column* col2) {
+  return cmpptr(new DecCmp<TX, TJ>(col1, col2));
+}
+
+
+template <typename TX, typename TJ>
+int DecCmp<TX, TJ>::cmp_jrow(size_t row) const {
+  TJ jval = dataJ[row];
+  return (jval > x_value) - (jval < x_value);
+}
+
+
+template <typename TX, typename TJ>
+int DecCmp<TX, TJ>::set_xrow(size_t row) {
+  TX newval = dataX[row];
+  if (ISNA<TX>(newval)) {
+    x_value = GETNA<TJ>();
+    return 0;
+  }
+  int64_t x = static_cast<int64_t>(newval);
+  int64_t y;
+  if (scaleX > scaleJ && x % dt::pow10i(scaleX - scaleJ) != 0) return -1;
+  if (!dt::rescale_decimal(x, scaleX, scaleJ, &y)) return -1;
+  if (y > static_cast<int64_t>(std::numeric_limits<TJ>::max()) ||
+      y <= static_cast<int64_t>(std::numeric_limits<TJ>::min())) return -1;
+  x_value = static_cast<TJ>(y);
+  return 0;
+}
+
+
+template <typename TX, typename TJ>
+uint64_t DecCmp<TX, TJ>::hash_jrow(size_t row) const {
+  return hash_value<TJ>(dataJ[row]);
+}
+
+
+template <typename TX, typename TJ>
+uint64_t DecCmp<TX, TJ>::hash_xrow() const {
+  return hash_value<TJ>(x_value);
+}
+
+
+template <typename TX>
+static void _init_dec_comparators(size_t stx) {
+  size_t dec16 = static_cast<size_t>(SType::DEC16);
+  size_t dec32 = static_cast<size_t>(SType::DEC32);
+  size_t dec64 = static_cast<size_t>(SType::DEC64);
+  cmps[stx][dec16] = DecCmp<TX, int16_t>::make;
+  cmps[stx][dec32] = DecCmp<TX, int32_t>::make;
+  cmps[stx][dec64] = DecCmp<TX, int64_t>::make;
+}
+
+
 
 //------------------------------------------------------------------------------
 // String Cmp
@@ -228,6 +400,8 @@ class StringCmp : public Cmp {
 
     int cmp_jrow(size_t row) const override;
     int set_xrow(size_t row) override;
+    uint64_t hash_jrow(size_t row) const override;
+    uint64_t hash_xrow() const override;
 };
 
 
@@ -279,6 +453,351 @@ int StringCmp<TX, TJ>::set_xrow(size_t row) {
 }
 
 
+template <typename TX, typename TJ>
+uint64_t StringCmp<TX, TJ>::hash_jrow(size_t row) const {
+  TJ jend = offsetsJ[row];
+  if (ISNA<TJ>(jend)) return HASH_NA;
+  TJ jstart = offsetsJ[row - 1] & ~GETNA<TJ>();
+  return hash_murmur2(strdataJ + jstart, jend - jstart, 0);
+}
+
+
+template <typename TX, typename TJ>
+uint64_t StringCmp<TX, TJ>::hash_xrow() const {
+  if (ISNA<TX>(xend)) return HASH_NA;
+  return hash_murmur2(strdataX + xstart, xend - xstart, 0);
+}
+
+
+
+//------------------------------------------------------------------------------
+// Fixed-width string Cmp
+//------------------------------------------------------------------------------
+
+/**
+ * Comparator for two FSTR columns. When both columns have the same width,
+ * the values are compared and hashed as whole `width`-byte blocks, padding
+ * included. Otherwise the bytes beyond the narrower width must all be
+ * padding in the wider value, and the hashes are computed over the strings
+ * with the padding removed.
+ */
+class FStrCmp : public Cmp {
+  private:
+    const uint8_t* dataX;
+    const uint8_t* dataJ;
+    const uint8_t* xstr;
+    size_t widthX;
+    size_t widthJ;
+
+  public:
+    FStrCmp(const Column*, const Column*);
+    static cmpptr make(const Column*, const Column*);
+
+    int cmp_jrow(size_t row) const override;
+    int set_xrow(size_t row) override;
+    uint64_t hash_jrow(size_t row) const override;
+    uint64_t hash_xrow() const override;
+
+  private:
+    uint64_t hash(const uint8_t* str, size_t width) const {
+      if (*str == FixedStringColumn::NA_BYTE) return HASH_NA;
+      if (widthX != widthJ) {
+        while (width && str[width - 1] == 0) width--;
+      }
+      return hash_murmur2(str, width, 0);
+    }
+};
+
+
+FStrCmp::FStrCmp(const Column* xcol, const Column* jcol) {
+  auto xcol_f = dynamic_cast<const FixedStringColumn*>(xcol);
+  auto jcol_f = dynamic_cast<const FixedStringColumn*>(jcol);
+  xassert(xcol_f && jcol_f);
+  dataX = reinterpret_cast<const uint8_t*>(xcol_f->chars());
+  dataJ = reinterpret_cast<const uint8_t*>(jcol_f->chars());
+  widthX = xcol_f->get_width();
+  widthJ = jcol_f->get_width();
+  xstr = nullptr;
+}
+
+cmpptr FStrCmp::make(const Column* col1, const Column* col2) {
+  return cmpptr(new FStrCmp(col1, col2));
+}
+
+
+int FStrCmp::cmp_jrow(size_t row) const {
+  const uint8_t* jstr = dataJ + row * widthJ;
+  bool jna = (*jstr == FixedStringColumn::NA_BYTE);
+  bool xna = (*xstr == FixedStringColumn::NA_BYTE);
+  if (jna || xna) return jna? xna - 1 : 1;
+  size_t w = std::min(widthX, widthJ);
+  int r = std::memcmp(jstr, xstr, w);
+  if (r) return r > 0? 1 : -1;
+  for (size_t i = w; i < widthJ; ++i) {
+    if (jstr[i]) return 1;
+  }
+  for (size_t i = w; i < widthX; ++i) {
+    if (xstr[i]) return -1;
+  }
+  return 0;
+}
+
+
+int FStrCmp::set_xrow(size_t row) {
+  xstr = dataX + row * widthX;
+  return 0;
+}
+
+
+uint64_t FStrCmp::hash_jrow(size_t row) const {
+  return hash(dataJ + row * widthJ, widthJ);
+}
+
+
+uint64_t FStrCmp::hash_xrow() const {
+  return hash(xstr, widthX);
+}
+
+
+
+//------------------------------------------------------------------------------
+// Categorical Cmp
+//------------------------------------------------------------------------------
+
+/**
+ * Comparator for two categorical columns. The (sorted) levels of both
+ * columns are merged, and the codes from each frame are translated into the
+ * merged code space, so that the rows can be compared without looking at
+ * the strings. The ordering of the translated codes is the same as the
+ * ordering of the corresponding strings. Within this class, NA is
+ * represented as 0, and all other codes are shifted by 1.
+ *
+ * The merge is done sequentially here, since the comparators are created
+ * within a parallel region.
+ */
+static int compare_strings(const CString& a, const CString& b) {
+  size_t na = static_cast<size_t>(a.size);
+  size_t nb = static_cast<size_t>(b.size);
+  int r = std::memcmp(a.ch, b.ch, std::min(na, nb));
+  return r? r : (na > nb) - (na < nb);
+}
+
+
+template <typename TX, typename TJ>
+class CatCmp : public Cmp {
+  private:
+    const TX* dataX;
+    const TJ* dataJ;
+    std::vector<uint32_t> mapX;
+    std::vector<uint32_t> mapJ;
+    uint32_t x_value;
+    size_t : 32;
+
+  public:
+    CatCmp(const Column*, const Column*);
+    static cmpptr make(const Column*, const Column*);
+
+    int cmp_jrow(size_t row) const override;
+    int set_xrow(size_t row) override;
+    uint64_t hash_jrow(size_t row) const override;
+    uint64_t hash_xrow() const override;
+
+  private:
+    uint32_t jcode(size_t row) const {
+      TJ code = dataJ[row];
+      return ISNA<TJ>(code)? 0 : mapJ[code];
+    }
+};
+
+
+template <typename TX, typename TJ>
+CatCmp<TX, TJ>::CatCmp(const Column* xcol, const Column* jcol) {
+  auto xcol_c = dynamic_cast<const CategoricalColumn<TX>*>(xcol);
+  auto jcol_c = dynamic_cast<const CategoricalColumn<TJ>*>(jcol);
+  xassert(xcol_c && jcol_c);
+  dataX = xcol_c->elements_r();
+  dataJ = jcol_c->elements_r();
+  size_t nx = xcol_c->nlevels();
+  size_t nj = jcol_c->nlevels();
+  mapX.resize(nx);
+  mapJ.resize(nj);
+  uint32_t code = 0;
+  size_t ix = 0, ij = 0;
+  while (ix < nx || ij < nj) {
+    int r = ix == nx? 1 : ij == nj? -1 :
+            compare_strings(xcol_c->level(ix), jcol_c->level(ij));
+    ++code;
+    if (r <= 0) mapX[ix++] = code;
+    if (r >= 0) mapJ[ij++] = code;
+  }
+  x_value = 0;
+}
+
+template <typename TX, typename TJ>
+cmpptr CatCmp<TX, TJ>::make(const Column* col1, const Column* col2) {
+  return cmpptr(new CatCmp<TX, TJ>(col1, col2));
+}
+
+
+template <typename TX, typename TJ>
+int CatCmp<TX, TJ>::cmp_jrow(size_t row) const {
+  uint32_t jval = jcode(row);
+  return (jval > x_value) - (jval < x_value);
+}
+
+
+template <typename TX, typename TJ>
+int CatCmp<TX, TJ>::set_xrow(size_t row) {
+  TX code = dataX[row];
+  x_value = ISNA<TX>(code)? 0 : mapX[code];
+  return 0;
+}
+
+
+template <typename TX, typename TJ>
+uint64_t CatCmp<TX, TJ>::hash_jrow(size_t row) const {
+  uint32_t jval = jcode(row);
+  return jval? hash_mix(jval) : HASH_NA;
+}
+
+
+template <typename TX, typename TJ>
+uint64_t CatCmp<TX, TJ>::hash_xrow() const {
+  return x_value? hash_mix(x_value) : HASH_NA;
+}
+
+
+/**
+ * Comparator between a categorical and a string column: the categorical
+ * column is in the X frame if `CAT_X` is true, or in the J frame otherwise.
+ * The categorical values are compared and hashed as the strings of their
+ * levels, the same way as StringCmp does it for two string columns. The
+ * levels (and their hashes) are looked up once, when the comparator is
+ * created.
+ */
+template <typename TC, typename TS, bool CAT_X>
+class CatStrCmp : public Cmp {
+  private:
+    const TC* codes;
+    const uint8_t* strdata;
+    const TS* offsets;
+    std::vector<CString> levels;
+    std::vector<uint64_t> hashes;
+    CString x_value;
+    uint64_t x_hash;
+    bool x_isna;
+    size_t : 56;
+
+  public:
+    CatStrCmp(const Column*, const Column*);
+    static cmpptr make(const Column*, const Column*);
+
+    int cmp_jrow(size_t row) const override;
+    int set_xrow(size_t row) override;
+    uint64_t hash_jrow(size_t row) const override;
+    uint64_t hash_xrow() const override;
+
+  private:
+    bool cat_value(size_t row, CString* value, uint64_t* hash) const;
+    bool str_value(size_t row, CString* value, uint64_t* hash) const;
+};
+
+
+template <typename TC, typename TS, bool CAT_X>
+CatStrCmp<TC, TS, CAT_X>::CatStrCmp(const Column* xcol, const Column* jcol) {
+  auto ccol = dynamic_cast<const CategoricalColumn<TC>*>(CAT_X? xcol : jcol);
+  auto scol = dynamic_cast<const StringColumn<TS>*>(CAT_X? jcol : xcol);
+  xassert(ccol && scol);
+  codes = ccol->elements_r();
+  strdata = scol->ustrdata();
+  offsets = scol->offsets();
+  size_t n = ccol->nlevels();
+  levels.resize(n);
+  hashes.resize(n);
+  for (size_t k = 0; k < n; ++k) {
+    levels[k] = ccol->level(k);
+    hashes[k] = hash_murmur2(levels[k].ch,
+                             static_cast<uint64_t>(levels[k].size), 0);
+  }
+  x_hash = HASH_NA;
+  x_isna = true;
+}
+
+template <typename TC, typename TS, bool CAT_X>
+cmpptr CatStrCmp<TC, TS, CAT_X>::make(const Column* col1, const Column* col2) {
+  return cmpptr(new CatStrCmp<TC, TS, CAT_X>(col1, col2));
+}
+
+
+// The functions below retrieve the value in the given `row` of the
+// categorical / string column, and its hash. They return false if the value
+// is NA.
+template <typename TC, typename TS, bool CAT_X>
+bool CatStrCmp<TC, TS, CAT_X>::cat_value(size_t row, CString* value,
+                                         uint64_t* hash) const {
+  TC code = codes[row];
+  if (ISNA<TC>(code)) {
+    *hash = HASH_NA;
+    return false;
+  }
+  *value = levels[code];
+  *hash = hashes[code];
+  return true;
+}
+
+
+template <typename TC, typename TS, bool CAT_X>
+bool CatStrCmp<TC, TS, CAT_X>::str_value(size_t row, CString* value,
+                                         uint64_t* hash) const {
+  TS end = offsets[row];
+  if (ISNA<TS>(end)) {
+    *hash = HASH_NA;
+    return false;
+  }
+  TS start = offsets[row - 1] & ~GETNA<TS>();
+  value->ch = reinterpret_cast<const char*>(strdata + start);
+  value->size = static_cast<int64_t>(end - start);
+  *hash = hash_murmur2(strdata + start, end - start, 0);
+  return true;
+}
+
+
+template <typename TC, typename TS, bool CAT_X>
+int CatStrCmp<TC, TS, CAT_X>::cmp_jrow(size_t row) const {
+  CString jval;
+  uint64_t h;
+  bool jvalid = CAT_X? str_value(row, &jval, &h) : cat_value(row, &jval, &h);
+  if (!jvalid) return x_isna - 1;
+  if (x_isna) return 1;
+  int r = compare_strings(jval, x_value);
+  return (r > 0) - (r < 0);
+}
+
+
+template <typename TC, typename TS, bool CAT_X>
+int CatStrCmp<TC, TS, CAT_X>::set_xrow(size_t row) {
+  x_isna = !(CAT_X? cat_value(row, &x_value, &x_hash)
+                  : str_value(row, &x_value, &x_hash));
+  return 0;
+}
+
+
+template <typename TC, typename TS, bool CAT_X>
+uint64_t CatStrCmp<TC, TS, CAT_X>::hash_jrow(size_t row) const {
+  CString jval;
+  uint64_t h;
+  if (CAT_X) str_value(row, &jval, &h);
+  else       cat_value(row, &jval, &h);
+  return h;
+}
+
+
+template <typename TC, typename TS, bool CAT_X>
+uint64_t CatStrCmp<TC, TS, CAT_X>::hash_xrow() const {
+  return x_hash;
+}
+
+
 
 //------------------------------------------------------------------------------
 // Comparators for different stypes
@@ -299,6 +818,13 @@ static void _init_comparators() {
   size_t flt64 = static_cast<size_t>(SType::FLOAT64);
   size_t str32 = static_cast<size_t>(SType::STR32);
   size_t str64 = static_cast<size_t>(SType::STR64);
+  size_t fstrx = static_cast<size_t>(SType::FSTR);
+  size_t cat08 = static_cast<size_t>(SType::CAT8);
+  size_t cat16 = static_cast<size_t>(SType::CAT16);
+  size_t cat32 = static_cast<size_t>(SType::CAT32);
+  size_t dat64 = static_cast<size_t>(SType::DATE64);
+  size_t tim32 = static_cast<size_t>(SType::TIME32);
+  size_t dat32 = static_cast<size_t>(SType::DATE32);
   cmps[bool8][bool8] = FwCmp<int8_t, int8_t>::make;
   cmps[bool8][int08] = FwCmp<int8_t, int8_t>::make;
   cmps[bool8][int16] = FwCmp<int8_t, int16_t>::make;
@@ -352,6 +878,54 @@ static void _init_comparators() {
   cmps[str32][str64] = StringCmp<uint32_t, uint64_t>::make;
   cmps[str64][str32] = StringCmp<uint64_t, uint32_t>::make;
   cmps[str64][str64] = StringCmp<uint64_t, uint64_t>::make;
+  cmps[fstrx][fstrx] = FStrCmp::make;
+  cmps[cat08][cat08] = CatCmp<uint8_t, uint8_t>::make;
+  cmps[cat08][cat16] = CatCmp<uint8_t, uint16_t>::make;
+  cmps[cat08][cat32] = CatCmp<uint8_t, uint32_t>::make;
+  cmps[cat16][cat08] = CatCmp<uint16_t, uint8_t>::make;
+  cmps[cat16][cat16] = CatCmp<uint16_t, uint16_t>::make;
+  cmps[cat16][cat32] = CatCmp<uint16_t, uint32_t>::make;
+  cmps[cat32][cat08] = CatCmp<uint32_t, uint8_t>::make;
+  cmps[cat32][cat16] = CatCmp<uint32_t, uint16_t>::make;
+  cmps[cat32][cat32] = CatCmp<uint32_t, uint32_t>::make;
+  cmps[cat08][str32] = CatStrCmp<uint8_t, uint32_t, true>::make;
+  cmps[cat08][str64] = CatStrCmp<uint8_t, uint64_t, true>::make;
+  cmps[cat16][str32] = CatStrCmp<uint16_t, uint32_t, true>::make;
+  cmps[cat16][str64] = CatStrCmp<uint16_t, uint64_t, true>::make;
+  cmps[cat32][str32] = CatStrCmp<uint32_t, uint32_t, true>::make;
+  cmps[cat32][str64] = CatStrCmp<uint32_t, uint64_t, true>::make;
+  cmps[str32][cat08] = CatStrCmp<uint8_t, uint32_t, false>::make;
+  cmps[str32][cat16] = CatStrCmp<uint16_t, uint32_t, false>::make;
+  cmps[str32][cat32] = CatStrCmp<uint32_t, uint32_t, false>::make;
+  cmps[str64][cat08] = CatStrCmp<uint8_t, uint64_t, false>::make;
+  cmps[str64][cat16] = CatStrCmp<uint16_t, uint64_t, false>::make;
+  cmps[str64][cat32] = CatStrCmp<uint32_t, uint64_t, false>::make;
+  cmps[dat64][dat64] = FwCmp<int64_t, int64_t>::make;
+  cmps[tim32][tim32] = FwCmp<int32_t, int32_t>::make;
+  cmps[dat32][dat32] = FwCmp<int32_t, int32_t>::make;
+  size_t dec16 = static_cast<size_t>(SType::DEC16);
+  size_t dec32 = static_cast<size_t>(SType::DEC32);
+  size_t dec64 = static_cast<size_t>(SType::DEC64);
+  _init_dec_comparators<int8_t>(bool8);
+  _init_dec_comparators<int8_t>(int08);
+  _init_dec_comparators<int16_t>(int16);
+  _init_dec_comparators<int32_t>(int32);
+  _init_dec_comparators<int64_t>(int64);
+  _init_dec_comparators<int16_t>(dec16);
+  _init_dec_comparators<int32_t>(dec32);
+  _init_dec_comparators<int64_t>(dec64);
+  cmps[dec16][int08] = DecCmp<int16_t, int8_t>::make;
+  cmps[dec16][int16] = DecCmp<int16_t, int16_t>::make;
+  cmps[dec16][int32] = DecCmp<int16_t, int32_t>::make;
+  cmps[dec16][int64] = DecCmp<int16_t, int64_t>::make;
+  cmps[dec32][int08] = DecCmp<int32_t, int8_t>::make;
+  cmps[dec32][int16] = DecCmp<int32_t, int16_t>::make;
+  cmps[dec32][int32] = DecCmp<int32_t, int32_t>::make;
+  cmps[dec32][int64] = DecCmp<int32_t, int64_t>::make;
+  cmps[dec64][int08] = DecCmp<int64_t, int8_t>::make;
+  cmps[dec64][int16] = DecCmp<int64_t, int16_t>::make;
+  cmps[dec64][int32] = DecCmp<int64_t, int32_t>::make;
+  cmps[dec64][int64] = DecCmp<int64_t, int64_t>::make;
 }
 
 
@@ -360,78 +934,134 @@ static void _init_comparators() {
 // Join functionality
 //------------------------------------------------------------------------------
 
-static size_t binsearch(Cmp* cmp, size_t nrows) {
-  // Use unsigned indices in order to avoid overflows
-  size_t start = 0;
-  size_t end   = nrows - 1;
-  while (start < end) {
-    // We won't ever have as many rows for this to overflow
-    size_t mid = (start + end) >> 1;
-    int r = cmp->cmp_jrow(mid);
-    // Note: `mid` can be 0 (if start == 0 and end == 1), so don't use
-    // `mid - 1` here.
-    if (r > 0) end = mid;
-    else if (r < 0) start = mid + 1;
-    else return mid;
+/**
+ * Hash join of frames `xdt` (left) and `jdt` (right) on columns `xcols` and
+ * `jcols` respectively. The function returns a pair of RowIndices: the first
+ * applies to `xdt` and the second to `jdt`, such that the i-th row of the
+ * joined frame consists of the row `first[i]` of the left frame, and the row
+ * `second[i]` of the right frame. Either of these RowIndices may contain NA
+ * entries, which indicate rows that have no match in the other frame.
+ *
+ * The algorithm builds a chained hash table over the rows of `jdt`, and then
+ * probes it with the rows of `xdt` in parallel. The matched pairs are ordered
+ * by the row of the left frame, and then by the row of the right frame. For
+ * the right and outer joins, the rows of `jdt` that didn't match anything are
+ * appended at the end.
+ */
+std::pair<RowIndex, RowIndex> hash_join(
+    const DataTable* xdt, const DataTable* jdt,
+    const intvec& xcols, const intvec& jcols, JoinType how)
+{
+  xassert(xcols.size() == jcols.size() && !xcols.empty());
+  for (size_t j : xcols) xdt->columns[j]->materialize();
+  for (size_t j : jcols) jdt->columns[j]->materialize();
+  size_t xnrows = xdt->nrows;
+  size_t jnrows = jdt->nrows;
+  size_t maxrows = static_cast<size_t>(std::numeric_limits<int32_t>::max());
+  if (xnrows >= maxrows || jnrows >= maxrows) {
+    throw NotImplError() << "Join of frames with more than " << maxrows
+        << " rows is not supported";
   }
-  return cmp->cmp_jrow(start) == 0? start : RowIndex::NA;
-}
-
 
+  // Build phase. Creating the comparator may fail if `xcols` and `jcols`
+  // are incompatible.
+  MultiCmp jcmp(xcols, jcols, xdt, jdt);
+  size_t nbuckets = 16;
+  while (nbuckets < 2 * jnrows) nbuckets <<= 1;
+  size_t mask = nbuckets - 1;
+  dt::array<uint64_t> jhasharr(jnrows);
+  uint64_t* jhashes = jhasharr.data();
+  dt::parallel_for_static(jnrows,
+    [&](size_t j) {
+      jhashes[j] = jcmp.hash_jrow(j);
+    });
+  arr32_t headsarr(nbuckets);
+  arr32_t nextarr(jnrows);
+  int32_t* heads = headsarr.data();
+  int32_t* next = nextarr.data();
+  for (size_t b = 0; b < nbuckets; ++b) heads[b] = -1;
+  // Insert rows in reverse order, so that each chain lists them in
+  // increasing order.
+  for (size_t j = jnrows; j--; ) {
+    size_t b = static_cast<size_t>(jhashes[j]) & mask;
+    next[j] = heads[b];
+    heads[b] = static_cast<int32_t>(j);
+  }
 
-// declared in datatable.h
-RowIndex natural_join(const DataTable* xdt, const DataTable* jdt) {
-  size_t k = jdt->get_nkeys();  // Number of join columns
-  xassert(k > 0);
+  // Probe phase
+  bool keep_xrows = (how == JoinType::LEFT || how == JoinType::OUTER);
+  size_t chunksize = 10000;
+  size_t nchunks = std::max((xnrows + chunksize - 1) / chunksize, size_t(1));
+  size_t nthreads = std::min(nchunks, dt::num_threads_in_pool());
+  std::vector<std::vector<int32_t>> xmatches(nchunks);
+  std::vector<std::vector<int32_t>> jmatches(nchunks);
+  dt::parallel_region(nthreads,
+    [&] {
+      MultiCmp cmp(xcols, jcols, xdt, jdt);
+      size_t ith = dt::this_thread_index();
+      size_t nth = dt::num_threads_in_team();
+      for (size_t c = ith; c < nchunks; c += nth) {
+        std::vector<int32_t>& xm = xmatches[c];
+        std::vector<int32_t>& jm = jmatches[c];
+        size_t i1 = std::min((c + 1) * chunksize, xnrows);
+        for (size_t i = c * chunksize; i < i1; ++i) {
+          bool found = false;
+          if (cmp.set_xrow(i) == 0) {
+            uint64_t h = cmp.hash_xrow();
+            int32_t j = heads[static_cast<size_t>(h) & mask];
+            for (; j != -1; j = next[j]) {
+              size_t jj = static_cast<size_t>(j);
+              if (jhashes[jj] == h && cmp.cmp_jrow(jj) == 0) {
+                xm.push_back(static_cast<int32_t>(i));
+                jm.push_back(j);
+                found = true;
+              }
+            }
+          }
+          if (!found && keep_xrows) {
+            xm.push_back(static_cast<int32_t>(i));
+            jm.push_back(-1);
+          }
+        }
+      }
+    });
 
-  // Determine how key columns in `jdt` match the columns in `xdt`
-  indvec xcols, jcols;
-  py::otuple jnames = jdt->get_pynames();
-  for (size_t i = 0; i < k; ++i) {
-    int64_t index = xdt->colindex(jnames[i]);
-    if (index == -1) {
-      throw ValueError() << "Key column `" << jnames[i].to_string() << "` does "
-          "not exist in the left Frame";
+  // Collect the results
+  size_t nmatched = 0;
+  for (const auto& xm : xmatches) nmatched += xm.size();
+  std::vector<int8_t> jused;
+  size_t nextra = 0;
+  if (how == JoinType::RIGHT || how == JoinType::OUTER) {
+    jused.resize(jnrows, 0);
+    for (const auto& jm : jmatches) {
+      for (int32_t j : jm) {
+        if (j >= 0) jused[static_cast<size_t>(j)] = 1;
+      }
     }
-    xcols.push_back(static_cast<size_t>(index));
-    jcols.push_back(i);
+    for (int8_t u : jused) nextra += !u;
   }
-
-  // For now, we materialize the join columns. Later, we can add an ability
-  // to operate on the view columns as well, via the `as_view` flag (similar
-  // to the `group()` function). A frame can only be joined as a view if all
-  // its columns have the same rowindex (or at least all columns needed to
-  // compute the result).
-  for (size_t j : xcols) {
-    xdt->columns[j]->materialize();
+  size_t nout = nmatched + nextra;
+  if (nout >= maxrows) {
+    throw NotImplError() << "Join result would have " << nout << " rows, "
+        "which is more than the maximum supported " << maxrows;
   }
-
-  arr32_t arr_result_indices(xdt->nrows);
-  if (xdt->nrows) {
-    int32_t* result_indices = arr_result_indices.data();
-    size_t nchunks = std::min(std::max(xdt->nrows / 200, size_t(1)),
-                              dt::num_threads_in_pool());
-    xassert(nchunks);
-
-    dt::parallel_region(nchunks,
-      [&] {
-        // Creating the comparator may fail if xcols and jcols are incompatible
-        MultiCmp comparator(xcols, jcols, xdt, jdt);
-
-        dt::parallel_for_static(xdt->nrows,
-          [&](size_t i) {
-            int r = comparator.set_xrow(i);
-            if (r == 0) {
-              size_t j = binsearch(&comparator, jdt->nrows);
-              result_indices[i] = static_cast<int32_t>(j);
-            } else {
-              result_indices[i] = -1;
-            }
-          });
-      });
+  arr32_t xindices(nout);
+  arr32_t jindices(nout);
+  size_t k = 0;
+  for (size_t c = 0; c < nchunks; ++c) {
+    std::copy(xmatches[c].begin(), xmatches[c].end(), xindices.data() + k);
+    std::copy(jmatches[c].begin(), jmatches[c].end(), jindices.data() + k);
+    k += xmatches[c].size();
   }
-
-  return RowIndex(std::move(arr_result_indices));
+  for (size_t j = 0; j < jused.size(); ++j) {
+    if (jused[j]) continue;
+    xindices[k] = -1;
+    jindices[k] = static_cast<int32_t>(j);
+    k++;
+  }
+  xassert(k == nout);
+  return std::make_pair(RowIndex(std::move(xindices)),
+                        RowIndex(std::move(jindices)));
 }
 
 
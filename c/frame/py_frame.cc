@@ -22,6 +22,7 @@
 #include <iostream>
 #include "frame/py_frame.h"
 #include "python/_all.h"
+#include "codec.h"
 namespace py {
 
 PyObject* Frame_Type = nullptr;
@@ -160,6 +161,41 @@ void Frame::materialize(const PKArgs&) {
 }
 
 
+static PKArgs args_compress(
+  0, 1, 0, false, false, {"method"}, "compress",
+
+R"(compress(self, method="auto")
+--
+
+Compress the data of the frame's columns in memory.
+
+The supported methods are: "for" (frame-of-reference bit-packing of
+integer values, block by block), "rle" (run-length encoding, best for
+sorted or keyed columns), and "dict" (dictionary encoding, for columns
+with few distinct values). Method "auto" chooses for each column the
+encoding with the smallest size, and leaves the column uncompressed if
+none of them saves memory. Columns where the method is not applicable
+(such as string columns) are left unchanged; view columns are
+materialized first.
+
+Reducers (`count`, `sum`, `mean`, `sd`, `min`, `max`) over the whole
+column, and comparisons of a column with a scalar, are computed directly
+on the compressed data. Other operations (for example sorting) need the
+raw values: such an operation decompresses the entire column, after which
+the column is no longer compressed, and the encoded data is released. The
+same happens once a column is modified. Call `compress()` again in order
+to re-compress the frame.
+)");
+
+void Frame::compress(const PKArgs& args) {
+  std::string name = args[0].to<std::string>("auto");
+  dt::Encoding method = dt::encoding_from_name(name);
+  for (size_t i = 0; i < dt->ncols; ++i) {
+    dt->columns[i]->compress(method);
+  }
+}
+
+
 
 
 //------------------------------------------------------------------------------
@@ -275,6 +311,7 @@ const char* Frame::Type::classdoc() {
 
 
 void Frame::Type::init_methods_and_getsets(Methods& mm, GetSetters& gs) {
+  _init_arrow(mm);
   _init_cbind(mm);
   _init_key(gs);
   _init_init(mm);
@@ -300,6 +337,7 @@ void Frame::Type::init_methods_and_getsets(Methods& mm, GetSetters& gs) {
   ADD_METHOD(mm, &Frame::tail, args_tail);
   ADD_METHOD(mm, &Frame::copy, args_copy);
   ADD_METHOD(mm, &Frame::materialize, args_materialize);
+  ADD_METHOD(mm, &Frame::compress, args_compress);
 }
 
 
@@ -49,6 +49,7 @@ class Frame : public PyObject {
         static bool is_subclassable() { return true; }
         static void init_methods_and_getsets(Methods&, GetSetters&);
       private:
+        static void _init_arrow(Methods&);
         static void _init_cbind(Methods&);
         static void _init_init(Methods&);
         static void _init_jay(Methods&);
@@ -102,6 +103,7 @@ class Frame : public PyObject {
     oobj copy(const PKArgs&);
     oobj head(const PKArgs&);
     void materialize(const PKArgs&);
+    void compress(const PKArgs&);
     void rbind(const PKArgs&);
     void repeat(const PKArgs&);
     void replace(const PKArgs&);
@@ -109,6 +111,8 @@ class Frame : public PyObject {
     oobj tail(const PKArgs&);
 
     // Conversion methods
+    oobj arrow_c_array(const PKArgs&);  // See frame/arrow.cc
+    oobj to_arrow(const PKArgs&);       // See frame/arrow.cc
     oobj to_csv(const PKArgs&);
     oobj to_dict(const PKArgs&);
     oobj to_jay(const PKArgs&);  // See jay/save_jay.cc
@@ -120,6 +124,8 @@ class Frame : public PyObject {
     // Stats functions
     oobj stat(const PKArgs&);
     oobj stat1(const PKArgs&);
+    oobj quantile(const PKArgs&);
+    oobj quantile1(const PKArgs&);
 
     // Exposed to users as `dt.frame_integrity_check(frame)` function
     void integrity_check();
@@ -308,6 +308,42 @@ void DataTable::rbind(
 //  Column::rbind()
 //------------------------------------------------------------------------------
 
+// Stype of the column obtained by rbinding columns of stypes `a` and `b`.
+// Generally this is the larger of the two; however temporal stypes are
+// ordered after the strings and categoricals, so they need special handling:
+// dates mixed with datetimes produce datetimes, and any other mix involving
+// a temporal column falls back to strings (or to categoricals). Fixed-width
+// strings mixed with variable-width strings produce the latter. Decimals
+// mixed with integers or other decimals produce DEC64 (which has room for
+// both the integer digits and the fraction), and mixed with floats produce
+// FLOAT64.
+static SType rbind_stype(SType a, SType b) {
+  if (a == SType::FSTR && (b == SType::STR32 || b == SType::STR64)) return b;
+  if (b == SType::FSTR && (a == SType::STR32 || a == SType::STR64)) return a;
+  if (a != b && (is_decimal(a) || is_decimal(b))) {
+    SType dec = is_decimal(a)? a : b;
+    SType other = is_decimal(a)? b : a;
+    if (other == SType::VOID || other == SType::BOOL) return dec;
+    if (other == SType::FLOAT32 || other == SType::FLOAT64) {
+      return SType::FLOAT64;
+    }
+    if (other < SType::FLOAT32 || is_decimal(other)) return SType::DEC64;
+    if (is_temporal(other)) return SType::STR32;
+    return std::max(a, b);
+  }
+  if (a == b || !(is_temporal(a) || is_temporal(b))) {
+    return std::max(a, b);
+  }
+  if ((a == SType::DATE32 && b == SType::DATE64) ||
+      (a == SType::DATE64 && b == SType::DATE32)) {
+    return SType::DATE64;
+  }
+  if (info(a).ltype() == LType::STRING) return a;
+  if (info(b).ltype() == LType::STRING) return b;
+  if (is_temporal(a) && is_temporal(b)) return SType::STR32;
+  return std::max(a, b);
+}
+
 Column* Column::rbind(std::vector<const Column*>& columns)
 {
   // Is the current column "empty" ?
@@ -317,14 +353,46 @@ Column* Column::rbind(std::vector<const Column*>& columns)
   SType new_stype = col_empty? SType::BOOL : stype();
   for (const Column* col : columns) {
     new_nrows += col->nrows;
-    new_stype = std::max(new_stype, col->stype());
+    new_stype = rbind_stype(new_stype, col->stype());
   }
 
   // Create the resulting Column object. It can be either: an empty column
   // filled with NAs; the current column (`this`); a clone of the current
   // column (if it has refcount > 1); or a type-cast of the current column.
   Column* res = nullptr;
-  if (col_empty) {
+  if (is_categorical(new_stype)) {
+    // All parts are converted into categoricals, and the resulting type
+    // must be wide enough to accommodate the union of all their levels.
+    std::vector<std::shared_ptr<Column>> levels;
+    if (!col_empty) {
+      res = is_categorical(stype())? this : this->cast(new_stype);
+      levels.push_back(categorical_levels(res));
+    }
+    size_t nlevels = levels.empty()? 0 : levels[0]->nrows;
+    for (size_t i = 0; i < columns.size(); ++i) {
+      const Column* col = columns[i];
+      if (col->stype() == SType::VOID) continue;
+      if (!is_categorical(col->stype())) {
+        columns[i] = col->cast(SType::CAT8);
+        delete col;
+      }
+      levels.push_back(categorical_levels(columns[i]));
+      nlevels += levels.back()->nrows;
+    }
+    if (nlevels > CategoricalColumn<uint8_t>::MAX_LEVELS) {
+      std::vector<std::vector<uint32_t>> maps;
+      nlevels = merge_levels(levels, maps)->nrows;
+    }
+    new_stype = categorical_stype(nlevels, new_stype);
+    if (res && res->stype() != new_stype) {
+      Column* wider = res->cast(new_stype);
+      if (res != this) delete res;
+      res = wider;
+    }
+  }
+  if (res) {
+    // categorical column, already created above
+  } else if (col_empty) {
     res = Column::new_na_column(new_stype, this->nrows);
   } else if (stype() == new_stype) {
     res = this;
@@ -348,6 +416,53 @@ Column* Column::rbind(std::vector<const Column*>& columns)
 
 
 
+//------------------------------------------------------------------------------
+// rbind categorical columns
+//------------------------------------------------------------------------------
+
+// All the parts were already converted into categoricals by Column::rbind().
+// Their levels are merged, and then the codes of each part are translated
+// into the merged levels.
+template <typename T>
+void CategoricalColumn<T>::rbind_impl(std::vector<const Column*>& columns,
+                                      size_t new_nrows, bool)
+{
+  std::vector<std::shared_ptr<Column>> all_levels { levels };
+  for (const Column* col : columns) {
+    if (col->stype() == SType::VOID) continue;
+    all_levels.push_back(categorical_levels(col));
+  }
+  std::vector<std::vector<uint32_t>> maps;
+  auto new_levels = merge_levels(all_levels, maps);
+  xassert(new_levels->nrows <= MAX_LEVELS);
+
+  size_t old_nrows = this->nrows;
+  mbuf.resize(sizeof(T) * new_nrows);
+  T* out = static_cast<T*>(mbuf.wptr());
+  if (new_levels != levels) {
+    // Codes are translated in-place
+    recode_categorical<T>(this, maps[0], out);
+  }
+  this->nrows = new_nrows;
+  levels = std::move(new_levels);
+
+  size_t pos = old_nrows;
+  size_t k = 1;
+  for (const Column* col : columns) {
+    if (col->stype() == SType::VOID) {
+      std::fill(out + pos, out + pos + col->nrows, GETNA<T>());
+    } else {
+      recode_categorical<T>(col, maps[k++], out + pos);
+    }
+    pos += col->nrows;
+    delete col;
+  }
+  xassert(pos == new_nrows);
+}
+
+
+
+
 //------------------------------------------------------------------------------
 // rbind string columns
 //------------------------------------------------------------------------------
@@ -425,6 +540,95 @@ void StringColumn<T>::rbind_impl(std::vector<const Column*>& columns,
 
 
 
+//------------------------------------------------------------------------------
+// rbind fixed-width string columns
+//------------------------------------------------------------------------------
+
+// The parts are converted into FSTR columns; if any of them is wider than
+// the current column, then the existing rows are re-laid out with the new
+// width first.
+void FixedStringColumn::rbind_impl(std::vector<const Column*>& columns,
+                                   size_t new_nrows, bool col_empty)
+{
+  materialize();
+  size_t new_width = width;
+  for (size_t i = 0; i < columns.size(); ++i) {
+    const Column* col = columns[i];
+    if (col->stype() == SType::VOID) continue;
+    columns[i] = fixed_width_strings(col);
+    delete col;
+    new_width = std::max(new_width, fstr_width(columns[i]));
+  }
+
+  size_t old_nrows = nrows;
+  MemoryRange newmr = MemoryRange::mem(new_nrows * new_width);
+  char* out = static_cast<char*>(newmr.xptr());
+  if (col_empty) {
+    std::memset(out, NA_BYTE, old_nrows * new_width);
+  } else if (new_width == width) {
+    std::memcpy(out, mbuf.rptr(), old_nrows * width);
+  } else {
+    std::unique_ptr<Column> tmp(fixed_width_strings(this, new_width));
+    std::memcpy(out, tmp->data(), old_nrows * new_width);
+  }
+  char* resptr = out + old_nrows * new_width;
+  for (const Column* col : columns) {
+    size_t n = col->nrows;
+    if (col->stype() == SType::VOID) {
+      std::memset(resptr, NA_BYTE, n * new_width);
+    } else {
+      std::unique_ptr<Column> tmp(fixed_width_strings(col, new_width));
+      std::memcpy(resptr, tmp->data(), n * new_width);
+    }
+    resptr += n * new_width;
+    delete col;
+  }
+  xassert(resptr == out + new_nrows * new_width);
+  mbuf = std::move(newmr);
+  width = new_width;
+  nrows = new_nrows;
+}
+
+
+
+//------------------------------------------------------------------------------
+// rbind decimal columns
+//------------------------------------------------------------------------------
+
+// All parts are converted into decimals of this column's stype, and the
+// resulting scale is the largest among the parts (as far as the stype
+// allows). The values are then copied as plain integers.
+template <typename T>
+void DecimalColumn<T>::rbind_impl(std::vector<const Column*>& columns,
+                                  size_t new_nrows, bool col_empty)
+{
+  int new_scale = col_empty? 0 : scale;
+  for (size_t i = 0; i < columns.size(); ++i) {
+    const Column* col = columns[i];
+    if (col->stype() == SType::VOID) continue;
+    columns[i] = decimal_column(col, stype());
+    delete col;
+    new_scale = std::max(new_scale, decimal_scale(columns[i]));
+  }
+  if (new_scale != scale) {
+    if (!col_empty) {
+      std::unique_ptr<Column> tmp(decimal_column(this, stype(), new_scale));
+      mbuf = static_cast<DecimalColumn<T>*>(tmp.get())->mbuf;
+      this->ri.clear();
+    }
+    scale = new_scale;
+  }
+  for (size_t i = 0; i < columns.size(); ++i) {
+    const Column* col = columns[i];
+    if (col->stype() == SType::VOID || decimal_scale(col) == scale) continue;
+    columns[i] = decimal_column(col, stype(), scale);
+    delete col;
+  }
+  FwColumn<T>::rbind_impl(columns, new_nrows, col_empty);
+}
+
+
+
 //------------------------------------------------------------------------------
 // rbind fixed-width columns
 //------------------------------------------------------------------------------
@@ -533,6 +737,15 @@ template class FwColumn<int32_t>;
 template class FwColumn<int64_t>;
 template class FwColumn<float>;
 template class FwColumn<double>;
+template class FwColumn<uint8_t>;
+template class FwColumn<uint16_t>;
+template class FwColumn<uint32_t>;
 template class FwColumn<PyObject*>;
+template class CategoricalColumn<uint8_t>;
+template class CategoricalColumn<uint16_t>;
+template class CategoricalColumn<uint32_t>;
+template class DecimalColumn<int16_t>;
+template class DecimalColumn<int32_t>;
+template class DecimalColumn<int64_t>;
 template class StringColumn<uint32_t>;
 template class StringColumn<uint64_t>;
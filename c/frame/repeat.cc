@@ -63,7 +63,10 @@ Column* Column::repeat(size_t nreps) {
   size_t esize = elemsize();
   size_t new_nrows = nrows * nreps;
 
-  Column* newcol = Column::new_data_column(stype(), new_nrows);
+  // Decimal columns carry their scale along with the data
+  Column* newcol = is_decimal(stype())
+      ? new_decimal_column(stype(), new_nrows, decimal_scale(this))
+      : Column::new_data_column(stype(), new_nrows);
   if (!new_nrows) {
     return newcol;
   }
@@ -19,14 +19,18 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 //------------------------------------------------------------------------------
+#include <cmath>                    // std::fabs, std::llround
 #include <type_traits>
 #include <unordered_set>
 #include "frame/py_frame.h"
 #include "parallel/api.h"           // dt::parallel_for_static
 #include "parallel/string_utils.h"  // dt::map_str2str
+#include "python/datetime.h"
+#include "python/decimal.h"
 #include "python/dict.h"
 #include "python/list.h"
 #include "utils/assert.h"
+#include "utils/decimal.h"
 
 namespace py {
 
@@ -45,6 +49,8 @@ class ReplaceAgent {
     std::vector<int64_t> x_int, y_int;
     std::vector<double> x_real, y_real;
     std::vector<CString> x_str, y_str;
+    // date32, date64 and time32 values (see `temporal_index()`)
+    std::vector<int64_t> x_temporal[3], y_temporal[3];
     int64_t xmin_int, xmax_int;
     double xmin_real, xmax_real;
 
@@ -60,7 +66,11 @@ class ReplaceAgent {
     void process_bool_column(size_t i);
     template <typename T> void process_int_column(size_t i);
     template <typename T> void process_real_column(size_t i);
+    template <typename T> void process_dec_column(size_t i);
     template <typename T> void process_str_column(size_t i);
+    template <typename T> void process_cat_column(size_t i);
+    void process_fstr_column(size_t i);
+    template <typename T> void process_temporal_column(size_t i);
     template <typename T> void replace_fw(T* x, T* y, size_t nrows, T* data, size_t n);
     template <typename T> void replace_fw1(T* x, T* y, size_t nrows, T* data);
     template <typename T> void replace_fw2(T* x, T* y, size_t nrows, T* data);
@@ -76,6 +86,7 @@ class ReplaceAgent {
     void split_x_y_int();
     void split_x_y_real();
     void split_x_y_str();
+    void split_x_y_temporal();
     template <typename T> void check_uniqueness(std::vector<T>&);
 };
 
@@ -111,6 +122,10 @@ particular, the following is valid: `DT.replace(None, [-1, -1.0, ""])`. This
 will replace NA values in int columns with `-1`, in real columns with `-1.0`,
 and in string columns with an empty string.
 
+Categorical and fixed-width string columns are treated as string columns.
+Python `date`, `datetime` and `time` objects are replaced in the columns of
+stypes `date32`, `date64` and `time32` respectively.
+
 The replace operation never causes a column to change its logical type. Thus,
 an integer column will remain integer, string column remain string, etc.
 However, replacing may cause a column to change its stype, provided that
@@ -172,8 +187,18 @@ void Frame::replace(const PKArgs& args) {
       case SType::INT64:   ra.process_int_column<int64_t>(i); break;
       case SType::FLOAT32: ra.process_real_column<float>(i); break;
       case SType::FLOAT64: ra.process_real_column<double>(i); break;
+      case SType::DEC16:   ra.process_dec_column<int16_t>(i); break;
+      case SType::DEC32:   ra.process_dec_column<int32_t>(i); break;
+      case SType::DEC64:   ra.process_dec_column<int64_t>(i); break;
       case SType::STR32:   ra.process_str_column<uint32_t>(i); break;
       case SType::STR64:   ra.process_str_column<uint64_t>(i); break;
+      case SType::FSTR:    ra.process_fstr_column(i); break;
+      case SType::CAT8:    ra.process_cat_column<uint8_t>(i); break;
+      case SType::CAT16:   ra.process_cat_column<uint16_t>(i); break;
+      case SType::CAT32:   ra.process_cat_column<uint32_t>(i); break;
+      case SType::DATE32:  ra.process_temporal_column<int32_t>(i); break;
+      case SType::DATE64:  ra.process_temporal_column<int64_t>(i); break;
+      case SType::TIME32:  ra.process_temporal_column<int32_t>(i); break;
       default: break;
     }
   }
@@ -259,7 +284,8 @@ void ReplaceAgent::split_x_y_by_type() {
   bool done_int = false,
        done_real = false,
        done_bool = false,
-       done_str = false;
+       done_str = false,
+       done_temporal = false;
   for (size_t i = 0; i < dt->ncols; ++i) {
     SType s = dt->columns[i]->stype();
     switch (s) {
@@ -279,19 +305,34 @@ void ReplaceAgent::split_x_y_by_type() {
         break;
       }
       case SType::FLOAT32:
-      case SType::FLOAT64: {
+      case SType::FLOAT64:
+      case SType::DEC16:
+      case SType::DEC32:
+      case SType::DEC64: {
         if (done_real) continue;
         split_x_y_real();
         done_real = true;
         break;
       }
       case SType::STR32:
-      case SType::STR64: {
+      case SType::STR64:
+      case SType::FSTR:
+      case SType::CAT8:
+      case SType::CAT16:
+      case SType::CAT32: {
         if (done_str) continue;
         split_x_y_str();
         done_str = true;
         break;
       }
+      case SType::DATE32:
+      case SType::DATE64:
+      case SType::TIME32: {
+        if (done_temporal) continue;
+        split_x_y_temporal();
+        done_temporal = true;
+        break;
+      }
       default: break;
     }
   }
@@ -355,6 +396,24 @@ void ReplaceAgent::split_x_y_int() {
 }
 
 
+// Python floats and `decimal.Decimal`s are both "real" values
+static bool is_real(const py::robj& x) {
+  return x.is_float() || py::is_pydecimal(x);
+}
+
+static double real_value(const py::robj& x) {
+  if (x.is_none()) return GETNA<double>();
+  if (x.is_float()) return x.to_double();
+  int64_t value;
+  int scale;
+  if (!py::decimal_value(x, &value, &scale)) {
+    throw ValueError() << "Decimal value `" << x << "` cannot be used in "
+        "Frame.replace()";
+  }
+  return static_cast<double>(value) / static_cast<double>(dt::pow10i(scale));
+}
+
+
 void ReplaceAgent::split_x_y_real() {
   double na_repl = GETNA<double>();
   size_t n = vx.size();
@@ -364,16 +423,16 @@ void ReplaceAgent::split_x_y_real() {
     py::robj xelem = vx[i];
     py::robj yelem = vy[i];
     if (xelem.is_none()) {
-      if (yelem.is_none() || !yelem.is_float()) continue;
-      na_repl = yelem.to_double();
+      if (yelem.is_none() || !is_real(yelem)) continue;
+      na_repl = real_value(yelem);
     }
-    else if (xelem.is_float()) {
-      if (!(yelem.is_none() || yelem.is_float())) {
+    else if (is_real(xelem)) {
+      if (!(yelem.is_none() || is_real(yelem))) {
         throw TypeError() << "Cannot replace float value `" << xelem
           << "` with a value of type " << yelem.typeobj();
       }
-      double xval = xelem.to_double();
-      double yval = yelem.to_double();
+      double xval = real_value(xelem);
+      double yval = real_value(yelem);
       if (ISNA(xval)) {
         na_repl = yval;
       } else {
@@ -418,6 +477,51 @@ void ReplaceAgent::split_x_y_str() {
 }
 
 
+static size_t temporal_index(SType st) {
+  return st == SType::DATE32? 0 : st == SType::DATE64? 1 : 2;
+}
+
+static int64_t temporal_value(SType st, const py::robj& x) {
+  return st == SType::DATE32? py::date_value(x) :
+         st == SType::DATE64? py::datetime_value(x) : py::time_value(x);
+}
+
+// Values of a temporal type are only replaced with values of the same type
+// (or NA): for example a `date` cannot be replaced with a `datetime`.
+void ReplaceAgent::split_x_y_temporal() {
+  int64_t na_repl[3] = {GETNA<int64_t>(), GETNA<int64_t>(),
+                        GETNA<int64_t>()};
+  size_t n = vx.size();
+  for (size_t i = 0; i < n; ++i) {
+    py::robj xelem = vx[i];
+    py::robj yelem = vy[i];
+    if (xelem.is_none()) {
+      SType yst = py::temporal_stype(yelem);
+      if (yst == SType::VOID) continue;
+      na_repl[temporal_index(yst)] = temporal_value(yst, yelem);
+      continue;
+    }
+    SType xst = py::temporal_stype(xelem);
+    if (xst == SType::VOID) continue;
+    if (!(yelem.is_none() || py::temporal_stype(yelem) == xst)) {
+      throw TypeError() << "Cannot replace " << xst << " value `" << xelem
+        << "` with a value of type " << yelem.typeobj();
+    }
+    size_t k = temporal_index(xst);
+    x_temporal[k].push_back(temporal_value(xst, xelem));
+    y_temporal[k].push_back(yelem.is_none()? GETNA<int64_t>()
+                                           : temporal_value(xst, yelem));
+  }
+  for (size_t k = 0; k < 3; ++k) {
+    if (!ISNA(na_repl[k])) {
+      x_temporal[k].push_back(GETNA<int64_t>());
+      y_temporal[k].push_back(na_repl[k]);
+    }
+    check_uniqueness<int64_t>(x_temporal[k]);
+  }
+}
+
+
 template <typename T>
 void ReplaceAgent::check_uniqueness(std::vector<T>& data) {
   std::unordered_set<T> check;
@@ -560,6 +664,64 @@ void ReplaceAgent::process_real_column(size_t colidx) {
 }
 
 
+/**
+ * The real targets are converted into the scale of the decimal column; those
+ * that cannot be represented exactly at that scale can never match, and are
+ * skipped. The replacement values are rounded to the column's scale, and may
+ * cause the column to be upcast into DEC64.
+ */
+template <typename T>
+void ReplaceAgent::process_dec_column(size_t colidx) {
+  constexpr double MAX = double(std::numeric_limits<T>::max());
+  if (x_real.empty()) return;
+  auto col = static_cast<DecimalColumn<T>*>(dt->columns[colidx]);
+  int scale = col->get_scale();
+  double factor = static_cast<double>(dt::pow10i(scale));
+  bool col_has_nas = (col->countna() > 0);
+  // Prepare filtered x and y vectors
+  std::vector<T> xfilt, yfilt;
+  bool upcast = false;
+  for (size_t i = 0; i < x_real.size(); ++i) {
+    double x = x_real[i];
+    if (ISNA(x)) {
+      if (!col_has_nas) continue;
+      xfilt.push_back(GETNA<T>());
+    } else {
+      double xs = x * factor;
+      if (!(std::fabs(xs) <= MAX)) continue;
+      if (dt::decimal_scale_of(x, dt::MAX_DECIMAL_SCALE) > scale) continue;
+      xfilt.push_back(static_cast<T>(std::llround(xs)));
+    }
+    double y = y_real[i];
+    double ys = y * factor;
+    if (ISNA(y)) {
+      yfilt.push_back(GETNA<T>());
+    } else if (std::fabs(ys) <= MAX) {
+      yfilt.push_back(static_cast<T>(std::llround(ys)));
+    } else if (std::fabs(ys) < 9.2e18) {
+      upcast = true;
+    } else {
+      throw ValueError() << "Replacement value `" << y << "` cannot be "
+          "stored in a decimal column with scale " << scale;
+    }
+  }
+  if (!std::is_same<T, int64_t>::value && upcast) {
+    Column* newcol = decimal_column(col, SType::DEC64, scale);
+    dt->columns[colidx] = newcol;
+    delete col;
+    columns_cast = true;
+    process_dec_column<int64_t>(colidx);
+  } else {
+    size_t n = xfilt.size();
+    xassert(n == yfilt.size());
+    if (n == 0) return;
+    T* coldata = col->elements_w();
+    replace_fw<T>(xfilt.data(), yfilt.data(), col->nrows, coldata, n);
+    col->get_stats()->reset();
+  }
+}
+
+
 
 template <typename T>
 void ReplaceAgent::process_str_column(size_t colidx) {
@@ -577,6 +739,133 @@ void ReplaceAgent::process_str_column(size_t colidx) {
 
 
 
+/**
+ * The replacement is applied to the levels of the categorical column, plus
+ * an extra NA level that stands for the column's NAs. The column's codes are
+ * then remapped into the new levels: several levels may merge into one, or
+ * become NA, and the column is upcast into a wider categorical stype if the
+ * number of levels grows too large.
+ */
+template <typename T, typename U>
+static MemoryRange remap_codes(const T* codes, size_t nrows,
+                               const std::vector<uint32_t>& map)
+{
+  MemoryRange mr = MemoryRange::mem(nrows * sizeof(U));
+  U* out = static_cast<U*>(mr.xptr());
+  size_t na_index = map.size() - 1;
+  dt::parallel_for_static(nrows,
+    [&](size_t i) {
+      T c = codes[i];
+      uint32_t v = map[ISNA<T>(c)? na_index : static_cast<size_t>(c)];
+      out[i] = ISNA<uint32_t>(v)? GETNA<U>() : static_cast<U>(v);
+    });
+  return mr;
+}
+
+template <typename T>
+void ReplaceAgent::process_cat_column(size_t colidx) {
+  if (x_str.empty()) return;
+  auto col = static_cast<CategoricalColumn<T>*>(dt->columns[colidx]);
+  if (x_str.size() == 1 && x_str[0].isna()) {
+    if (col->countna() == 0) return;
+  }
+  col->materialize();
+  const Column* levels = col->get_levels().get();
+  size_t nlevels = levels->nrows;
+  arr32_t indices(nlevels + 1);
+  int32_t* ind = indices.data();
+  for (size_t k = 0; k < nlevels; ++k) ind[k] = static_cast<int32_t>(k);
+  ind[nlevels] = -1;
+  std::unique_ptr<Column> ext(
+      levels->shallowcopy(RowIndex(std::move(indices))));
+  size_t n = x_str.size();
+  std::unique_ptr<Column> newlevels(
+      levels->stype() == SType::STR32
+        ? replace_str<uint32_t>(n, x_str.data(), y_str.data(),
+              static_cast<StringColumn<uint32_t>*>(ext.get()))
+        : replace_str<uint64_t>(n, x_str.data(), y_str.data(),
+              static_cast<StringColumn<uint64_t>*>(ext.get())));
+  // Codes of the replaced levels (and of the NA replacement) among the new
+  // levels
+  std::unique_ptr<Column> cat(categorize(newlevels.get(), col->stype()));
+  const auto& catlevels = categorical_levels(cat.get());
+  std::vector<uint32_t> identity(catlevels->nrows);
+  for (size_t k = 0; k < identity.size(); ++k) {
+    identity[k] = static_cast<uint32_t>(k);
+  }
+  std::vector<uint32_t> map(nlevels + 1);
+  recode_categorical<uint32_t>(cat.get(), identity, map.data());
+
+  SType new_stype = cat->stype();
+  const T* codes = col->elements_r();
+  size_t nrows = col->nrows;
+  MemoryRange mr;
+  switch (new_stype) {
+    case SType::CAT8:  mr = remap_codes<T, uint8_t>(codes, nrows, map); break;
+    case SType::CAT16: mr = remap_codes<T, uint16_t>(codes, nrows, map); break;
+    default:           mr = remap_codes<T, uint32_t>(codes, nrows, map); break;
+  }
+  columns_cast = columns_cast || (new_stype != col->stype());
+  dt->columns[colidx] = new_categorical_column(new_stype, std::move(mr),
+                                               catlevels);
+  delete col;
+}
+
+
+/**
+ * The fixed-width strings are replaced as regular strings, and then
+ * converted back into FSTR, widening the column if any of the replacement
+ * values is longer than its current width.
+ */
+void ReplaceAgent::process_fstr_column(size_t colidx) {
+  if (x_str.empty()) return;
+  Column* col = dt->columns[colidx];
+  if (x_str.size() == 1 && x_str[0].isna()) {
+    if (col->countna() == 0) return;
+  }
+  std::unique_ptr<Column> strcol(col->cast(SType::STR32));
+  std::unique_ptr<Column> repl(
+      replace_str<uint32_t>(x_str.size(), x_str.data(), y_str.data(),
+          static_cast<StringColumn<uint32_t>*>(strcol.get())));
+  Column* newcol = fixed_width_strings(repl.get());
+  size_t width = fstr_width(col);
+  if (fstr_width(newcol) < width) {
+    Column* tmp = fixed_width_strings(newcol, width);
+    delete newcol;
+    newcol = tmp;
+  }
+  dt->columns[colidx] = newcol;
+  delete col;
+}
+
+
+template <typename T>
+void ReplaceAgent::process_temporal_column(size_t colidx) {
+  auto col = static_cast<IntColumn<T>*>(dt->columns[colidx]);
+  size_t k = temporal_index(col->stype());
+  const std::vector<int64_t>& xs = x_temporal[k];
+  const std::vector<int64_t>& ys = y_temporal[k];
+  if (xs.empty()) return;
+  bool col_has_nas = (col->countna() > 0);
+  std::vector<T> xfilt, yfilt;
+  for (size_t i = 0; i < xs.size(); ++i) {
+    if (ISNA(xs[i])) {
+      if (!col_has_nas) continue;
+      xfilt.push_back(GETNA<T>());
+    } else {
+      xfilt.push_back(static_cast<T>(xs[i]));
+    }
+    yfilt.push_back(ISNA(ys[i])? GETNA<T>() : static_cast<T>(ys[i]));
+  }
+  size_t n = xfilt.size();
+  if (n == 0) return;
+  T* coldata = col->elements_w();
+  replace_fw<T>(xfilt.data(), yfilt.data(), col->nrows, coldata, n);
+  col->get_stats()->reset();
+}
+
+
+
 
 //------------------------------------------------------------------------------
 // Step 4: perform actual data replacement
@@ -24,7 +24,10 @@
 #include <unordered_map>
 #include "frame/py_frame.h"
 #include "python/_all.h"
+#include "python/datetime.h"
+#include "python/decimal.h"
 #include "python/string.h"
+#include "utils/decimal.h"
 #include "column.h"
 #include "memrange.h"
 #include "stats.h"
@@ -114,6 +117,80 @@ static Column* _modecol_str(Stats* stats, const Column* col) {
   return _make_column_str<T>(static_cast<StringStats<T>*>(stats)->mode(col));
 }
 
+template <typename T>
+static Column* _modecol_cat(Stats* stats, const Column* col) {
+  T mode = static_cast<CategoricalStats<T>*>(stats)->mode(col);
+  MemoryRange mbuf = MemoryRange::mem(sizeof(T));
+  static_cast<T*>(mbuf.xptr())[0] = mode;
+  return new_categorical_column(col->stype(), std::move(mbuf),
+                                categorical_levels(col));
+}
+
+static Column* _modecol_fstr(Stats* stats, const Column* col) {
+  CString mode = static_cast<FixedStringStats*>(stats)->mode(col);
+  size_t width = fstr_width(col);
+  MemoryRange mbuf = MemoryRange::mem(width);
+  char* out = static_cast<char*>(mbuf.xptr());
+  if (mode.isna()) {
+    std::memset(out, FixedStringColumn::NA_BYTE, width);
+  } else {
+    std::memset(out, 0, width);
+    std::memcpy(out, mode.ch, static_cast<size_t>(mode.size));
+  }
+  return new FixedStringColumn(1, width, std::move(mbuf));
+}
+
+// The stats of a decimal column are computed on its underlying integers, and
+// then brought back to the column's scale. The sum is exact, and has stype
+// DEC64; the mean and the standard deviation are float64.
+static double _decimal_factor(const Column* col) {
+  if (!is_decimal(col->stype())) return 1.0;
+  return static_cast<double>(dt::pow10i(decimal_scale(col)));
+}
+
+template <typename T>
+static Column* _make_column_dec(const Column* col, SType stype, T value) {
+  Column* res = new_decimal_column(stype, 1, decimal_scale(col));
+  static_cast<FwColumn<T>*>(res)->set_elem(0, value);
+  return res;
+}
+
+template <typename T>
+static Column* _mincol_dec(Stats* stats, const Column* col) {
+  return _make_column_dec<T>(col, col->stype(),
+                             static_cast<NumericalStats<T>*>(stats)->min(col));
+}
+
+template <typename T>
+static Column* _maxcol_dec(Stats* stats, const Column* col) {
+  return _make_column_dec<T>(col, col->stype(),
+                             static_cast<NumericalStats<T>*>(stats)->max(col));
+}
+
+template <typename T>
+static Column* _modecol_dec(Stats* stats, const Column* col) {
+  return _make_column_dec<T>(col, col->stype(),
+                             static_cast<NumericalStats<T>*>(stats)->mode(col));
+}
+
+template <typename T>
+static Column* _sumcol_dec(Stats* stats, const Column* col) {
+  return _make_column_dec<int64_t>(col, SType::DEC64,
+                             static_cast<NumericalStats<T>*>(stats)->sum(col));
+}
+
+template <typename T>
+static Column* _meancol_dec(Stats* stats, const Column* col) {
+  return _make_column(SType::FLOAT64,
+      static_cast<NumericalStats<T>*>(stats)->mean(col) / _decimal_factor(col));
+}
+
+template <typename T>
+static Column* _sdcol_dec(Stats* stats, const Column* col) {
+  return _make_column(SType::FLOAT64,
+      static_cast<NumericalStats<T>*>(stats)->stdev(col) / _decimal_factor(col));
+}
+
 static Column* _countnacol(Stats* stats, const Column* col) {
   return _make_column(SType::INT64,
                       static_cast<int64_t>(stats->countna(col)));
@@ -129,6 +206,11 @@ static Column* _nmodalcol(Stats* stats, const Column* col) {
                       static_cast<int64_t>(stats->nmodal(col)));
 }
 
+static Column* _nuniqueapproxcol(Stats* stats, const Column* col) {
+  return _make_column(SType::INT64,
+                      static_cast<int64_t>(stats->nunique_approx(col)));
+}
+
 
 
 //------------------------------------------------------------------------------
@@ -152,6 +234,12 @@ static inline oobj pyvalue_real(void* ptr) {
   return ISNA<T>(x)? None() : ofloat(x);
 }
 
+template <typename T, oobj (*MAKE)(T)>
+static inline oobj pyvalue_time(void* ptr) {
+  T x = *reinterpret_cast<T*>(ptr);
+  return ISNA<T>(x)? None() : MAKE(x);
+}
+
 static inline oobj pyvalue_str(void* ptr) {
   CString& x = *reinterpret_cast<CString*>(ptr);
   return x.size >= 0? ostring(x.ch, static_cast<size_t>(x.size))
@@ -168,6 +256,13 @@ template <> oobj pyvalue<SType::FLOAT32>(void* ptr) { return pyvalue_real<float>
 template <> oobj pyvalue<SType::FLOAT64>(void* ptr) { return pyvalue_real<double>(ptr); }
 template <> oobj pyvalue<SType::STR32>(void* ptr)   { return pyvalue_str(ptr); }
 template <> oobj pyvalue<SType::STR64>(void* ptr)   { return pyvalue_str(ptr); }
+template <> oobj pyvalue<SType::FSTR>(void* ptr)    { return pyvalue_str(ptr); }
+template <> oobj pyvalue<SType::CAT8>(void* ptr)    { return pyvalue_str(ptr); }
+template <> oobj pyvalue<SType::CAT16>(void* ptr)   { return pyvalue_str(ptr); }
+template <> oobj pyvalue<SType::CAT32>(void* ptr)   { return pyvalue_str(ptr); }
+template <> oobj pyvalue<SType::DATE64>(void* ptr)  { return pyvalue_time<int64_t, odatetime>(ptr); }
+template <> oobj pyvalue<SType::TIME32>(void* ptr)  { return pyvalue_time<int32_t, otime>(ptr); }
+template <> oobj pyvalue<SType::DATE32>(void* ptr)  { return pyvalue_time<int32_t, odate>(ptr); }
 
 
 
@@ -216,6 +311,49 @@ static oobj _modeval(const Column* col) {
   return pyvalue<stype>(&v);
 }
 
+template <typename T>
+static oobj _pyvalue_dec(const Column* col, T x) {
+  return ISNA<T>(x)? None() : odecimal(static_cast<int64_t>(x),
+                                       decimal_scale(col));
+}
+
+template <typename T>
+static NumericalStats<T>* _decstats(const Column* col) {
+  return static_cast<NumericalStats<T>*>(col->get_stats());
+}
+
+template <typename T>
+static oobj _minval_dec(const Column* col) {
+  return _pyvalue_dec<T>(col, _decstats<T>(col)->min(col));
+}
+
+template <typename T>
+static oobj _maxval_dec(const Column* col) {
+  return _pyvalue_dec<T>(col, _decstats<T>(col)->max(col));
+}
+
+template <typename T>
+static oobj _modeval_dec(const Column* col) {
+  return _pyvalue_dec<T>(col, _decstats<T>(col)->mode(col));
+}
+
+template <typename T>
+static oobj _sumval_dec(const Column* col) {
+  return _pyvalue_dec<int64_t>(col, _decstats<T>(col)->sum(col));
+}
+
+template <typename T>
+static oobj _meanval_dec(const Column* col) {
+  double v = _decstats<T>(col)->mean(col) / _decimal_factor(col);
+  return pyvalue<SType::FLOAT64>(&v);
+}
+
+template <typename T>
+static oobj _sdval_dec(const Column* col) {
+  double v = _decstats<T>(col)->stdev(col) / _decimal_factor(col);
+  return pyvalue<SType::FLOAT64>(&v);
+}
+
 static oobj _nmodalval(const Column* col) {
   size_t v = col->nmodal();
   return pyvalue<SType::INT64>(&v);
@@ -226,6 +364,11 @@ static oobj _nuniqueval(const Column* col) {
   return pyvalue<SType::INT64>(&v);
 }
 
+static oobj _nuniqueapproxval(const Column* col) {
+  size_t v = col->nunique_approx();
+  return pyvalue<SType::INT64>(&v);
+}
+
 
 
 
@@ -268,11 +411,21 @@ static PKArgs args_sum(0, 0, 0, false, false, {}, "sum", nullptr);
 static PKArgs args_mean(0, 0, 0, false, false, {}, "mean", nullptr);
 static PKArgs args_sd(0, 0, 0, false, false, {}, "sd", nullptr);
 static PKArgs args_countna(0, 0, 0, false, false, {}, "countna", nullptr);
-static PKArgs args_nunique(0, 0, 0, false, false, {}, "nunique", nullptr);
+static PKArgs args_nunique(0, 1, 0, false, false, {"approx"}, "nunique", nullptr);
 static PKArgs args_nmodal(0, 0, 0, false, false, {}, "nmodal", nullptr);
 
-oobj Frame::stat(const PKArgs& args) {
+// The `approx` argument of `nunique()` selects between the exact stat, which
+// requires sorting the column, and its HyperLogLog estimate.
+static Stat _stat_from_args(const PKArgs& args) {
   Stat stat = stat_from_args[&args];
+  if (stat == Stat::NUnique && args[0].to<bool>(false)) {
+    stat = Stat::NUniqueApprox;
+  }
+  return stat;
+}
+
+oobj Frame::stat(const PKArgs& args) {
+  Stat stat = _stat_from_args(args);
   DataTable* res = _make_frame(dt, stat);
   return oobj::from_new_reference(Frame::from_datatable(res));
 }
@@ -286,14 +439,14 @@ static PKArgs args_min1(0, 0, 0, false, false, {}, "min1", nullptr);
 static PKArgs args_max1(0, 0, 0, false, false, {}, "max1", nullptr);
 static PKArgs args_mode1(0, 0, 0, false, false, {}, "mode1", nullptr);
 static PKArgs args_nmodal1(0, 0, 0, false, false, {}, "nmodal1", nullptr);
-static PKArgs args_nunique1(0, 0, 0, false, false, {}, "nunique1", nullptr);
+static PKArgs args_nunique1(0, 1, 0, false, false, {"approx"}, "nunique1", nullptr);
 
 oobj Frame::stat1(const PKArgs& args) {
   if (dt->ncols != 1) {
     throw ValueError() << "This method can only be applied to a 1-column Frame";
   }
   Column* col0 = dt->columns[0];
-  Stat stat = stat_from_args[&args];
+  Stat stat = _stat_from_args(args);
   SType stype = col0->stype();
   colmakerfn1 f = statfns1[id(stat, stype)];
   return f(col0);
@@ -301,6 +454,92 @@ oobj Frame::stat1(const PKArgs& args) {
 
 
 
+//------------------------------------------------------------------------------
+// Quantiles
+//------------------------------------------------------------------------------
+
+static PKArgs args_quantile(
+  0, 2, 0, false, false, {"q", "approx"}, "quantile",
+R"(quantile(self, q=0.5, approx=False)
+--
+
+Compute quantile `q` (a number between 0 and 1) of each column in the Frame.
+The result is a single-row Frame of type float64; the quantiles of
+non-numeric columns are NA.
+
+If `approx` is True, the quantiles are estimated from a t-digest sketch of
+the column, which is computed in a single pass without sorting the data, and
+then cached. Otherwise the quantiles are exact.
+)");
+
+static PKArgs args_quantile1(
+  0, 2, 0, false, false, {"q", "approx"}, "quantile1", nullptr);
+
+
+static double _get_q(const Arg& arg) {
+  if (arg.is_none_or_undefined()) return 0.5;
+  double q = arg.to_double();
+  if (!(q >= 0.0 && q <= 1.0)) {
+    throw ValueError() << "Parameter `q` in quantile() should be in the "
+        "range [0; 1], instead got " << q;
+  }
+  return q;
+}
+
+static double _quantile(const Column* col, double q, bool approx) {
+  Stats* stats = col->get_stats();
+  if (approx) return stats->quantile_approx(col, q) / _decimal_factor(col);
+  switch (col->stype()) {
+    case SType::BOOL:
+    case SType::INT8:    return static_cast<NumericalStats<int8_t>*>(stats)->quantile(col, q);
+    case SType::INT16:   return static_cast<NumericalStats<int16_t>*>(stats)->quantile(col, q);
+    case SType::INT32:   return static_cast<NumericalStats<int32_t>*>(stats)->quantile(col, q);
+    case SType::INT64:   return static_cast<NumericalStats<int64_t>*>(stats)->quantile(col, q);
+    case SType::FLOAT32: return static_cast<NumericalStats<float>*>(stats)->quantile(col, q);
+    case SType::FLOAT64: return static_cast<NumericalStats<double>*>(stats)->quantile(col, q);
+    case SType::DEC16:   return static_cast<NumericalStats<int16_t>*>(stats)->quantile(col, q) / _decimal_factor(col);
+    case SType::DEC32:   return static_cast<NumericalStats<int32_t>*>(stats)->quantile(col, q) / _decimal_factor(col);
+    case SType::DEC64:   return static_cast<NumericalStats<int64_t>*>(stats)->quantile(col, q) / _decimal_factor(col);
+    default: return GETNA<double>();
+  }
+}
+
+static bool _is_numeric(const Column* col) {
+  SType stype = col->stype();
+  return stype == SType::BOOL || info(stype).ltype() == LType::INT ||
+         info(stype).ltype() == LType::REAL;
+}
+
+
+oobj Frame::quantile(const PKArgs& args) {
+  double q = _get_q(args[0]);
+  bool approx = args[1].to<bool>(false);
+  colvec out_cols;
+  out_cols.reserve(dt->ncols);
+  for (Column* col : dt->columns) {
+    out_cols.push_back(
+      _is_numeric(col)? _make_column(SType::FLOAT64, _quantile(col, q, approx))
+                      : Column::new_na_column(SType::FLOAT64, 1));
+  }
+  DataTable* res = new DataTable(std::move(out_cols), dt);
+  return oobj::from_new_reference(Frame::from_datatable(res));
+}
+
+
+oobj Frame::quantile1(const PKArgs& args) {
+  if (dt->ncols != 1) {
+    throw ValueError() << "This method can only be applied to a 1-column Frame";
+  }
+  double q = _get_q(args[0]);
+  bool approx = args[1].to<bool>(false);
+  Column* col0 = dt->columns[0];
+  if (!_is_numeric(col0)) return None();
+  double v = _quantile(col0, q, approx);
+  return pyvalue<SType::FLOAT64>(&v);
+}
+
+
+
 void Frame::Type::_init_stats(Methods& mm) {
   ADD_METHOD(mm, &Frame::stat, args_countna);
   ADD_METHOD(mm, &Frame::stat, args_sum);
@@ -321,6 +560,8 @@ void Frame::Type::_init_stats(Methods& mm) {
   ADD_METHOD(mm, &Frame::stat1, args_mode1);
   ADD_METHOD(mm, &Frame::stat1, args_nmodal1);
   ADD_METHOD(mm, &Frame::stat1, args_nunique1);
+  ADD_METHOD(mm, &Frame::quantile, args_quantile);
+  ADD_METHOD(mm, &Frame::quantile1, args_quantile1);
 
   for (size_t i = 0; i < NSTATS * DT_STYPES_COUNT; ++i) {
     statfns[i] = _nacol;
@@ -339,6 +580,16 @@ void Frame::Type::_init_stats(Methods& mm) {
   statfns[id(Stat::NaCount, SType::FLOAT64)] = _countnacol;
   statfns[id(Stat::NaCount, SType::STR32)]   = _countnacol;
   statfns[id(Stat::NaCount, SType::STR64)]   = _countnacol;
+  statfns[id(Stat::NaCount, SType::FSTR)]    = _countnacol;
+  statfns[id(Stat::NaCount, SType::CAT8)]    = _countnacol;
+  statfns[id(Stat::NaCount, SType::CAT16)]   = _countnacol;
+  statfns[id(Stat::NaCount, SType::CAT32)]   = _countnacol;
+  statfns[id(Stat::NaCount, SType::DATE64)]  = _countnacol;
+  statfns[id(Stat::NaCount, SType::TIME32)]  = _countnacol;
+  statfns[id(Stat::NaCount, SType::DATE32)]  = _countnacol;
+  statfns[id(Stat::NaCount, SType::DEC16)]   = _countnacol;
+  statfns[id(Stat::NaCount, SType::DEC32)]   = _countnacol;
+  statfns[id(Stat::NaCount, SType::DEC64)]   = _countnacol;
   statfns[id(Stat::NaCount, SType::OBJ)]     = _countnacol;
 
   // Stat::Sum (= 1)
@@ -349,6 +600,9 @@ void Frame::Type::_init_stats(Methods& mm) {
   statfns[id(Stat::Sum, SType::INT64)]   = _sumcol_num<int64_t>;
   statfns[id(Stat::Sum, SType::FLOAT32)] = _sumcol_num<float>;
   statfns[id(Stat::Sum, SType::FLOAT64)] = _sumcol_num<double>;
+  statfns[id(Stat::Sum, SType::DEC16)]   = _sumcol_dec<int16_t>;
+  statfns[id(Stat::Sum, SType::DEC32)]   = _sumcol_dec<int32_t>;
+  statfns[id(Stat::Sum, SType::DEC64)]   = _sumcol_dec<int64_t>;
 
   // Stat::Mean (= 2)
   statfns[id(Stat::Mean, SType::BOOL)]    = _meancol_num<int8_t>;
@@ -358,6 +612,9 @@ void Frame::Type::_init_stats(Methods& mm) {
   statfns[id(Stat::Mean, SType::INT64)]   = _meancol_num<int64_t>;
   statfns[id(Stat::Mean, SType::FLOAT32)] = _meancol_num<float>;
   statfns[id(Stat::Mean, SType::FLOAT64)] = _meancol_num<double>;
+  statfns[id(Stat::Mean, SType::DEC16)]   = _meancol_dec<int16_t>;
+  statfns[id(Stat::Mean, SType::DEC32)]   = _meancol_dec<int32_t>;
+  statfns[id(Stat::Mean, SType::DEC64)]   = _meancol_dec<int64_t>;
 
   // Stat::StDev (= 3)
   statfns[id(Stat::StDev, SType::BOOL)]    = _sdcol_num<int8_t>;
@@ -367,6 +624,9 @@ void Frame::Type::_init_stats(Methods& mm) {
   statfns[id(Stat::StDev, SType::INT64)]   = _sdcol_num<int64_t>;
   statfns[id(Stat::StDev, SType::FLOAT32)] = _sdcol_num<float>;
   statfns[id(Stat::StDev, SType::FLOAT64)] = _sdcol_num<double>;
+  statfns[id(Stat::StDev, SType::DEC16)]   = _sdcol_dec<int16_t>;
+  statfns[id(Stat::StDev, SType::DEC32)]   = _sdcol_dec<int32_t>;
+  statfns[id(Stat::StDev, SType::DEC64)]   = _sdcol_dec<int64_t>;
 
   // Stat::Min (= 6)
   statfns[id(Stat::Min, SType::BOOL)]    = _mincol_num<int8_t>;
@@ -376,6 +636,12 @@ void Frame::Type::_init_stats(Methods& mm) {
   statfns[id(Stat::Min, SType::INT64)]   = _mincol_num<int64_t>;
   statfns[id(Stat::Min, SType::FLOAT32)] = _mincol_num<float>;
   statfns[id(Stat::Min, SType::FLOAT64)] = _mincol_num<double>;
+  statfns[id(Stat::Min, SType::DATE64)]  = _mincol_num<int64_t>;
+  statfns[id(Stat::Min, SType::TIME32)]  = _mincol_num<int32_t>;
+  statfns[id(Stat::Min, SType::DATE32)]  = _mincol_num<int32_t>;
+  statfns[id(Stat::Min, SType::DEC16)]   = _mincol_dec<int16_t>;
+  statfns[id(Stat::Min, SType::DEC32)]   = _mincol_dec<int32_t>;
+  statfns[id(Stat::Min, SType::DEC64)]   = _mincol_dec<int64_t>;
 
   // Stat::Max (= 10)
   statfns[id(Stat::Max, SType::BOOL)]    = _maxcol_num<int8_t>;
@@ -385,6 +651,12 @@ void Frame::Type::_init_stats(Methods& mm) {
   statfns[id(Stat::Max, SType::INT64)]   = _maxcol_num<int64_t>;
   statfns[id(Stat::Max, SType::FLOAT32)] = _maxcol_num<float>;
   statfns[id(Stat::Max, SType::FLOAT64)] = _maxcol_num<double>;
+  statfns[id(Stat::Max, SType::DATE64)]  = _maxcol_num<int64_t>;
+  statfns[id(Stat::Max, SType::TIME32)]  = _maxcol_num<int32_t>;
+  statfns[id(Stat::Max, SType::DATE32)]  = _maxcol_num<int32_t>;
+  statfns[id(Stat::Max, SType::DEC16)]   = _maxcol_dec<int16_t>;
+  statfns[id(Stat::Max, SType::DEC32)]   = _maxcol_dec<int32_t>;
+  statfns[id(Stat::Max, SType::DEC64)]   = _maxcol_dec<int64_t>;
 
   // Stat::Mode (= 11)
   statfns[id(Stat::Mode, SType::BOOL)]    = _modecol_num<int8_t>;
@@ -396,6 +668,16 @@ void Frame::Type::_init_stats(Methods& mm) {
   statfns[id(Stat::Mode, SType::FLOAT64)] = _modecol_num<double>;
   statfns[id(Stat::Mode, SType::STR32)]   = _modecol_str<uint32_t>;
   statfns[id(Stat::Mode, SType::STR64)]   = _modecol_str<uint64_t>;
+  statfns[id(Stat::Mode, SType::FSTR)]    = _modecol_fstr;
+  statfns[id(Stat::Mode, SType::CAT8)]    = _modecol_cat<uint8_t>;
+  statfns[id(Stat::Mode, SType::CAT16)]   = _modecol_cat<uint16_t>;
+  statfns[id(Stat::Mode, SType::CAT32)]   = _modecol_cat<uint32_t>;
+  statfns[id(Stat::Mode, SType::DATE64)]  = _modecol_num<int64_t>;
+  statfns[id(Stat::Mode, SType::TIME32)]  = _modecol_num<int32_t>;
+  statfns[id(Stat::Mode, SType::DATE32)]  = _modecol_num<int32_t>;
+  statfns[id(Stat::Mode, SType::DEC16)]   = _modecol_dec<int16_t>;
+  statfns[id(Stat::Mode, SType::DEC32)]   = _modecol_dec<int32_t>;
+  statfns[id(Stat::Mode, SType::DEC64)]   = _modecol_dec<int64_t>;
 
   // Stat::NModal (= 12)
   statfns[id(Stat::NModal, SType::BOOL)]    = _nmodalcol;
@@ -407,6 +689,16 @@ void Frame::Type::_init_stats(Methods& mm) {
   statfns[id(Stat::NModal, SType::FLOAT64)] = _nmodalcol;
   statfns[id(Stat::NModal, SType::STR32)]   = _nmodalcol;
   statfns[id(Stat::NModal, SType::STR64)]   = _nmodalcol;
+  statfns[id(Stat::NModal, SType::FSTR)]    = _nmodalcol;
+  statfns[id(Stat::NModal, SType::CAT8)]    = _nmodalcol;
+  statfns[id(Stat::NModal, SType::CAT16)]   = _nmodalcol;
+  statfns[id(Stat::NModal, SType::CAT32)]   = _nmodalcol;
+  statfns[id(Stat::NModal, SType::DATE64)]  = _nmodalcol;
+  statfns[id(Stat::NModal, SType::TIME32)]  = _nmodalcol;
+  statfns[id(Stat::NModal, SType::DATE32)]  = _nmodalcol;
+  statfns[id(Stat::NModal, SType::DEC16)]   = _nmodalcol;
+  statfns[id(Stat::NModal, SType::DEC32)]   = _nmodalcol;
+  statfns[id(Stat::NModal, SType::DEC64)]   = _nmodalcol;
 
   // Stat::NUnique (= 13)
   statfns[id(Stat::NUnique, SType::BOOL)]    = _nuniquecol;
@@ -418,6 +710,37 @@ void Frame::Type::_init_stats(Methods& mm) {
   statfns[id(Stat::NUnique, SType::FLOAT64)] = _nuniquecol;
   statfns[id(Stat::NUnique, SType::STR32)]   = _nuniquecol;
   statfns[id(Stat::NUnique, SType::STR64)]   = _nuniquecol;
+  statfns[id(Stat::NUnique, SType::FSTR)]    = _nuniquecol;
+  statfns[id(Stat::NUnique, SType::CAT8)]    = _nuniquecol;
+  statfns[id(Stat::NUnique, SType::CAT16)]   = _nuniquecol;
+  statfns[id(Stat::NUnique, SType::CAT32)]   = _nuniquecol;
+  statfns[id(Stat::NUnique, SType::DATE64)]  = _nuniquecol;
+  statfns[id(Stat::NUnique, SType::TIME32)]  = _nuniquecol;
+  statfns[id(Stat::NUnique, SType::DATE32)]  = _nuniquecol;
+  statfns[id(Stat::NUnique, SType::DEC16)]   = _nuniquecol;
+  statfns[id(Stat::NUnique, SType::DEC32)]   = _nuniquecol;
+  statfns[id(Stat::NUnique, SType::DEC64)]   = _nuniquecol;
+
+  // Stat::NUniqueApprox (= 14)
+  statfns[id(Stat::NUniqueApprox, SType::BOOL)]    = _nuniqueapproxcol;
+  statfns[id(Stat::NUniqueApprox, SType::INT8)]    = _nuniqueapproxcol;
+  statfns[id(Stat::NUniqueApprox, SType::INT16)]   = _nuniqueapproxcol;
+  statfns[id(Stat::NUniqueApprox, SType::INT32)]   = _nuniqueapproxcol;
+  statfns[id(Stat::NUniqueApprox, SType::INT64)]   = _nuniqueapproxcol;
+  statfns[id(Stat::NUniqueApprox, SType::FLOAT32)] = _nuniqueapproxcol;
+  statfns[id(Stat::NUniqueApprox, SType::FLOAT64)] = _nuniqueapproxcol;
+  statfns[id(Stat::NUniqueApprox, SType::STR32)]   = _nuniqueapproxcol;
+  statfns[id(Stat::NUniqueApprox, SType::STR64)]   = _nuniqueapproxcol;
+  statfns[id(Stat::NUniqueApprox, SType::FSTR)]    = _nuniqueapproxcol;
+  statfns[id(Stat::NUniqueApprox, SType::CAT8)]    = _nuniqueapproxcol;
+  statfns[id(Stat::NUniqueApprox, SType::CAT16)]   = _nuniqueapproxcol;
+  statfns[id(Stat::NUniqueApprox, SType::CAT32)]   = _nuniqueapproxcol;
+  statfns[id(Stat::NUniqueApprox, SType::DATE64)]  = _nuniqueapproxcol;
+  statfns[id(Stat::NUniqueApprox, SType::TIME32)]  = _nuniqueapproxcol;
+  statfns[id(Stat::NUniqueApprox, SType::DATE32)]  = _nuniqueapproxcol;
+  statfns[id(Stat::NUniqueApprox, SType::DEC16)]   = _nuniqueapproxcol;
+  statfns[id(Stat::NUniqueApprox, SType::DEC32)]   = _nuniqueapproxcol;
+  statfns[id(Stat::NUniqueApprox, SType::DEC64)]   = _nuniqueapproxcol;
 
 
   //---- Scalar statfns --------------------------------------------------------
@@ -432,6 +755,16 @@ void Frame::Type::_init_stats(Methods& mm) {
   statfns1[id(Stat::NaCount, SType::FLOAT64)] = _countnaval;
   statfns1[id(Stat::NaCount, SType::STR32)]   = _countnaval;
   statfns1[id(Stat::NaCount, SType::STR64)]   = _countnaval;
+  statfns1[id(Stat::NaCount, SType::FSTR)]    = _countnaval;
+  statfns1[id(Stat::NaCount, SType::CAT8)]    = _countnaval;
+  statfns1[id(Stat::NaCount, SType::CAT16)]   = _countnaval;
+  statfns1[id(Stat::NaCount, SType::CAT32)]   = _countnaval;
+  statfns1[id(Stat::NaCount, SType::DATE64)]  = _countnaval;
+  statfns1[id(Stat::NaCount, SType::TIME32)]  = _countnaval;
+  statfns1[id(Stat::NaCount, SType::DATE32)]  = _countnaval;
+  statfns1[id(Stat::NaCount, SType::DEC16)]   = _countnaval;
+  statfns1[id(Stat::NaCount, SType::DEC32)]   = _countnaval;
+  statfns1[id(Stat::NaCount, SType::DEC64)]   = _countnaval;
   statfns1[id(Stat::NaCount, SType::OBJ)]     = _countnaval;
 
   // Stat::Sum (= 1)
@@ -442,6 +775,9 @@ void Frame::Type::_init_stats(Methods& mm) {
   statfns1[id(Stat::Sum, SType::INT64)]   = _sumval<SType::INT64, SType::INT64>;
   statfns1[id(Stat::Sum, SType::FLOAT32)] = _sumval<SType::FLOAT32, SType::FLOAT64>;
   statfns1[id(Stat::Sum, SType::FLOAT64)] = _sumval<SType::FLOAT64, SType::FLOAT64>;
+  statfns1[id(Stat::Sum, SType::DEC16)]   = _sumval_dec<int16_t>;
+  statfns1[id(Stat::Sum, SType::DEC32)]   = _sumval_dec<int32_t>;
+  statfns1[id(Stat::Sum, SType::DEC64)]   = _sumval_dec<int64_t>;
 
   // Stat::Mean (= 2)
   statfns1[id(Stat::Mean, SType::BOOL)]    = _meanval<SType::BOOL>;
@@ -451,6 +787,9 @@ void Frame::Type::_init_stats(Methods& mm) {
   statfns1[id(Stat::Mean, SType::INT64)]   = _meanval<SType::INT64>;
   statfns1[id(Stat::Mean, SType::FLOAT32)] = _meanval<SType::FLOAT32>;
   statfns1[id(Stat::Mean, SType::FLOAT64)] = _meanval<SType::FLOAT64>;
+  statfns1[id(Stat::Mean, SType::DEC16)]   = _meanval_dec<int16_t>;
+  statfns1[id(Stat::Mean, SType::DEC32)]   = _meanval_dec<int32_t>;
+  statfns1[id(Stat::Mean, SType::DEC64)]   = _meanval_dec<int64_t>;
 
   // Stat::StDev (= 3)
   statfns1[id(Stat::StDev, SType::BOOL)]    = _sdval<SType::BOOL>;
@@ -460,6 +799,9 @@ void Frame::Type::_init_stats(Methods& mm) {
   statfns1[id(Stat::StDev, SType::INT64)]   = _sdval<SType::INT64>;
   statfns1[id(Stat::StDev, SType::FLOAT32)] = _sdval<SType::FLOAT32>;
   statfns1[id(Stat::StDev, SType::FLOAT64)] = _sdval<SType::FLOAT64>;
+  statfns1[id(Stat::StDev, SType::DEC16)]   = _sdval_dec<int16_t>;
+  statfns1[id(Stat::StDev, SType::DEC32)]   = _sdval_dec<int32_t>;
+  statfns1[id(Stat::StDev, SType::DEC64)]   = _sdval_dec<int64_t>;
 
   // Stat::Min (= 6)
   statfns1[id(Stat::Min, SType::BOOL)]    = _minval<SType::BOOL>;
@@ -469,6 +811,12 @@ void Frame::Type::_init_stats(Methods& mm) {
   statfns1[id(Stat::Min, SType::INT64)]   = _minval<SType::INT64>;
   statfns1[id(Stat::Min, SType::FLOAT32)] = _minval<SType::FLOAT32>;
   statfns1[id(Stat::Min, SType::FLOAT64)] = _minval<SType::FLOAT64>;
+  statfns1[id(Stat::Min, SType::DATE64)]  = _minval<SType::DATE64>;
+  statfns1[id(Stat::Min, SType::TIME32)]  = _minval<SType::TIME32>;
+  statfns1[id(Stat::Min, SType::DATE32)]  = _minval<SType::DATE32>;
+  statfns1[id(Stat::Min, SType::DEC16)]   = _minval_dec<int16_t>;
+  statfns1[id(Stat::Min, SType::DEC32)]   = _minval_dec<int32_t>;
+  statfns1[id(Stat::Min, SType::DEC64)]   = _minval_dec<int64_t>;
 
   // Stat::Max (= 10)
   statfns1[id(Stat::Max, SType::BOOL)]    = _maxval<SType::BOOL>;
@@ -478,6 +826,12 @@ void Frame::Type::_init_stats(Methods& mm) {
   statfns1[id(Stat::Max, SType::INT64)]   = _maxval<SType::INT64>;
   statfns1[id(Stat::Max, SType::FLOAT32)] = _maxval<SType::FLOAT32>;
   statfns1[id(Stat::Max, SType::FLOAT64)] = _maxval<SType::FLOAT64>;
+  statfns1[id(Stat::Max, SType::DATE64)]  = _maxval<SType::DATE64>;
+  statfns1[id(Stat::Max, SType::TIME32)]  = _maxval<SType::TIME32>;
+  statfns1[id(Stat::Max, SType::DATE32)]  = _maxval<SType::DATE32>;
+  statfns1[id(Stat::Max, SType::DEC16)]   = _maxval_dec<int16_t>;
+  statfns1[id(Stat::Max, SType::DEC32)]   = _maxval_dec<int32_t>;
+  statfns1[id(Stat::Max, SType::DEC64)]   = _maxval_dec<int64_t>;
 
   // Stat::Mode (= 11)
   statfns1[id(Stat::Mode, SType::BOOL)]    = _modeval<SType::BOOL>;
@@ -489,6 +843,16 @@ void Frame::Type::_init_stats(Methods& mm) {
   statfns1[id(Stat::Mode, SType::FLOAT64)] = _modeval<SType::FLOAT64>;
   statfns1[id(Stat::Mode, SType::STR32)]   = _modeval<SType::STR32>;
   statfns1[id(Stat::Mode, SType::STR64)]   = _modeval<SType::STR64>;
+  statfns1[id(Stat::Mode, SType::FSTR)]    = _modeval<SType::FSTR>;
+  statfns1[id(Stat::Mode, SType::CAT8)]    = _modeval<SType::CAT8>;
+  statfns1[id(Stat::Mode, SType::CAT16)]   = _modeval<SType::CAT16>;
+  statfns1[id(Stat::Mode, SType::CAT32)]   = _modeval<SType::CAT32>;
+  statfns1[id(Stat::Mode, SType::DATE64)]  = _modeval<SType::DATE64>;
+  statfns1[id(Stat::Mode, SType::TIME32)]  = _modeval<SType::TIME32>;
+  statfns1[id(Stat::Mode, SType::DATE32)]  = _modeval<SType::DATE32>;
+  statfns1[id(Stat::Mode, SType::DEC16)]   = _modeval_dec<int16_t>;
+  statfns1[id(Stat::Mode, SType::DEC32)]   = _modeval_dec<int32_t>;
+  statfns1[id(Stat::Mode, SType::DEC64)]   = _modeval_dec<int64_t>;
 
   // Stat::NModal (= 12)
   statfns1[id(Stat::NModal, SType::BOOL)]    = _nmodalval;
@@ -500,6 +864,16 @@ void Frame::Type::_init_stats(Methods& mm) {
   statfns1[id(Stat::NModal, SType::FLOAT64)] = _nmodalval;
   statfns1[id(Stat::NModal, SType::STR32)]   = _nmodalval;
   statfns1[id(Stat::NModal, SType::STR64)]   = _nmodalval;
+  statfns1[id(Stat::NModal, SType::FSTR)]    = _nmodalval;
+  statfns1[id(Stat::NModal, SType::CAT8)]    = _nmodalval;
+  statfns1[id(Stat::NModal, SType::CAT16)]   = _nmodalval;
+  statfns1[id(Stat::NModal, SType::CAT32)]   = _nmodalval;
+  statfns1[id(Stat::NModal, SType::DATE64)]  = _nmodalval;
+  statfns1[id(Stat::NModal, SType::TIME32)]  = _nmodalval;
+  statfns1[id(Stat::NModal, SType::DATE32)]  = _nmodalval;
+  statfns1[id(Stat::NModal, SType::DEC16)]   = _nmodalval;
+  statfns1[id(Stat::NModal, SType::DEC32)]   = _nmodalval;
+  statfns1[id(Stat::NModal, SType::DEC64)]   = _nmodalval;
 
   // Stat::NUnique (= 13)
   statfns1[id(Stat::NUnique, SType::BOOL)]    = _nuniqueval;
@@ -511,6 +885,37 @@ void Frame::Type::_init_stats(Methods& mm) {
   statfns1[id(Stat::NUnique, SType::FLOAT64)] = _nuniqueval;
   statfns1[id(Stat::NUnique, SType::STR32)]   = _nuniqueval;
   statfns1[id(Stat::NUnique, SType::STR64)]   = _nuniqueval;
+  statfns1[id(Stat::NUnique, SType::FSTR)]    = _nuniqueval;
+  statfns1[id(Stat::NUnique, SType::CAT8)]    = _nuniqueval;
+  statfns1[id(Stat::NUnique, SType::CAT16)]   = _nuniqueval;
+  statfns1[id(Stat::NUnique, SType::CAT32)]   = _nuniqueval;
+  statfns1[id(Stat::NUnique, SType::DATE64)]  = _nuniqueval;
+  statfns1[id(Stat::NUnique, SType::TIME32)]  = _nuniqueval;
+  statfns1[id(Stat::NUnique, SType::DATE32)]  = _nuniqueval;
+  statfns1[id(Stat::NUnique, SType::DEC16)]   = _nuniqueval;
+  statfns1[id(Stat::NUnique, SType::DEC32)]   = _nuniqueval;
+  statfns1[id(Stat::NUnique, SType::DEC64)]   = _nuniqueval;
+
+  // Stat::NUniqueApprox (= 14)
+  statfns1[id(Stat::NUniqueApprox, SType::BOOL)]    = _nuniqueapproxval;
+  statfns1[id(Stat::NUniqueApprox, SType::INT8)]    = _nuniqueapproxval;
+  statfns1[id(Stat::NUniqueApprox, SType::INT16)]   = _nuniqueapproxval;
+  statfns1[id(Stat::NUniqueApprox, SType::INT32)]   = _nuniqueapproxval;
+  statfns1[id(Stat::NUniqueApprox, SType::INT64)]   = _nuniqueapproxval;
+  statfns1[id(Stat::NUniqueApprox, SType::FLOAT32)] = _nuniqueapproxval;
+  statfns1[id(Stat::NUniqueApprox, SType::FLOAT64)] = _nuniqueapproxval;
+  statfns1[id(Stat::NUniqueApprox, SType::STR32)]   = _nuniqueapproxval;
+  statfns1[id(Stat::NUniqueApprox, SType::STR64)]   = _nuniqueapproxval;
+  statfns1[id(Stat::NUniqueApprox, SType::FSTR)]    = _nuniqueapproxval;
+  statfns1[id(Stat::NUniqueApprox, SType::CAT8)]    = _nuniqueapproxval;
+  statfns1[id(Stat::NUniqueApprox, SType::CAT16)]   = _nuniqueapproxval;
+  statfns1[id(Stat::NUniqueApprox, SType::CAT32)]   = _nuniqueapproxval;
+  statfns1[id(Stat::NUniqueApprox, SType::DATE64)]  = _nuniqueapproxval;
+  statfns1[id(Stat::NUniqueApprox, SType::TIME32)]  = _nuniqueapproxval;
+  statfns1[id(Stat::NUniqueApprox, SType::DATE32)]  = _nuniqueapproxval;
+  statfns1[id(Stat::NUniqueApprox, SType::DEC16)]   = _nuniqueapproxval;
+  statfns1[id(Stat::NUniqueApprox, SType::DEC32)]   = _nuniqueapproxval;
+  statfns1[id(Stat::NUniqueApprox, SType::DEC64)]   = _nuniqueapproxval;
 
   //---- Args -> Stat map ------------------------------------------------------
 
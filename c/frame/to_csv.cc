@@ -35,12 +35,12 @@ namespace py {
 //------------------------------------------------------------------------------
 
 static PKArgs args_to_csv(
-    0, 1, 4, false, false,
-    {"path", "nthreads", "hex", "verbose", "_strategy"},
+    0, 1, 5, false, false,
+    {"path", "nthreads", "hex", "verbose", "compression", "_strategy"},
     "to_csv",
 
 R"(to_csv(self, path=None, nthreads=None, hex=False, verbose=False,
-       _strategy="auto")
+       compression=None, _strategy="auto")
 --
 
 Write the Frame into the provided file in CSV format.
@@ -70,6 +70,17 @@ verbose: bool
     If True, some extra information will be printed to the console,
     which may help to debug the inner workings of the algorithm.
 
+compression: None | "gzip" | "zstd" | "lz4"
+    Compress the output with the given method. The data is split into
+    chunks, each of which is compressed independently (in parallel),
+    and the output is the concatenation of the resulting gzip members,
+    zstd frames or lz4 frames. Such files can be decompressed with the
+    standard tools. If no `path` is given, then the compressed output
+    is returned as a `bytes` object.
+
+    The compression libraries are loaded at runtime: "gzip" requires
+    zlib, "zstd" requires libzstd, and "lz4" requires liblz4.
+
 _strategy: "mmap" | "write" | "auto"
     Which method to use for writing to disk. On certain systems 'mmap'
     gives a better performance; on other OSes 'mmap' may not work at
@@ -105,7 +116,14 @@ oobj Frame::to_csv(const PKArgs& args)
     logger = oobj::import("datatable", "_DefaultLogger").call();
   }
 
-  auto strategy = args[4].to<std::string>("");
+  // compression
+  oobj compression = args[4].to<oobj>(None());
+  if (!compression.is_none() && !compression.is_string()) {
+    throw TypeError() << "Parameter `compression` in Frame.to_csv() should "
+        "be a string, instead got " << compression.typeobj();
+  }
+
+  auto strategy = args[5].to<std::string>("");
   auto sstrategy = (strategy == "mmap")  ? WritableBuffer::Strategy::Mmap :
                    (strategy == "write") ? WritableBuffer::Strategy::Write :
                                            WritableBuffer::Strategy::Auto;
@@ -116,6 +134,9 @@ oobj Frame::to_csv(const PKArgs& args)
   cwriter.set_strategy(sstrategy);
   cwriter.set_usehex(hex);
   cwriter.set_logger(logger);
+  if (!compression.is_none()) {
+    cwriter.set_compression(compression.to_string());
+  }
 
   cwriter.write();
 
@@ -125,6 +146,14 @@ oobj Frame::to_csv(const PKArgs& args)
     MemoryWritableBuffer* mb = dynamic_cast<MemoryWritableBuffer*>(wb);
     xassert(mb);
 
+    if (!compression.is_none()) {
+      std::unique_ptr<WritableBuffer> wbowner(wb);
+      MemoryRange mbuf = mb->get_mbuf();
+      return oobj::from_new_reference(
+          PyBytes_FromStringAndSize(static_cast<const char*>(mbuf.rptr()),
+                                    static_cast<Py_ssize_t>(mb->size())));
+    }
+
     // -1 because the buffer also stores trailing \0
     size_t len = mb->size() - 1;
     char* str = static_cast<char*>(mb->get_cptr());
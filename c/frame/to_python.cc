@@ -22,6 +22,8 @@
 #include "frame/py_frame.h"
 #include "python/_all.h"
 #include "python/args.h"
+#include "python/datetime.h"
+#include "python/decimal.h"
 #include "python/string.h"
 #include "python/tuple.h"
 
@@ -133,6 +135,112 @@ oobj string_converter<T>::to_oobj(size_t row) const {
 
 
 
+class fstr_converter : public converter {
+  private:
+    const FixedStringColumn* xcol;
+  public:
+    explicit fstr_converter(const Column*);
+    oobj to_oobj(size_t row) const override;
+};
+
+fstr_converter::fstr_converter(const Column* col) {
+  xcol = dynamic_cast<const FixedStringColumn*>(col);
+}
+
+oobj fstr_converter::to_oobj(size_t row) const {
+  CString s = xcol->get_string(row);
+  if (s.isna()) return py::None();
+  return ostring(s.ch, static_cast<size_t>(s.size));
+}
+
+
+
+// Python strings are created once per level, and then reused
+template <typename T>
+class cat_converter : public converter {
+  private:
+    const CategoricalColumn<T>* ccol;
+    const T* values;
+    mutable std::vector<oobj> levels;
+  public:
+    explicit cat_converter(const Column*);
+    oobj to_oobj(size_t row) const override;
+};
+
+template <typename T>
+cat_converter<T>::cat_converter(const Column* col) {
+  ccol = dynamic_cast<const CategoricalColumn<T>*>(col);
+  values = ccol->elements_r();
+  levels.resize(ccol->nlevels());
+}
+
+template <typename T>
+oobj cat_converter<T>::to_oobj(size_t row) const {
+  T x = values[row];
+  if (ISNA<T>(x)) return py::None();
+  oobj& level = levels[x];
+  if (!level) {
+    CString s = ccol->level(x);
+    level = ostring(s.ch, static_cast<size_t>(s.size));
+  }
+  return level;
+}
+
+
+
+template <SType s>
+class datetime_converter : public converter {
+  private:
+    using T = element_t<s>;
+    const T* values;
+  public:
+    explicit datetime_converter(const Column*);
+    oobj to_oobj(size_t row) const override;
+};
+
+template <SType s>
+datetime_converter<s>::datetime_converter(const Column* col) {
+  values = dynamic_cast<const DatetimeColumn<s>*>(col)->elements_r();
+}
+
+template <SType s>
+oobj datetime_converter<s>::to_oobj(size_t row) const {
+  T x = values[row];
+  if (ISNA<T>(x)) return py::None();
+  return s == SType::DATE64? odatetime(static_cast<int64_t>(x)) :
+         s == SType::TIME32? otime(static_cast<int32_t>(x)) :
+                             odate(static_cast<int32_t>(x));
+}
+
+
+
+template <typename T>
+class decimal_converter : public converter {
+  private:
+    const T* values;
+    int scale;
+    int : 32;
+  public:
+    explicit decimal_converter(const Column*);
+    oobj to_oobj(size_t row) const override;
+};
+
+template <typename T>
+decimal_converter<T>::decimal_converter(const Column* col) {
+  auto dcol = dynamic_cast<const DecimalColumn<T>*>(col);
+  values = dcol->elements_r();
+  scale = dcol->get_scale();
+}
+
+template <typename T>
+oobj decimal_converter<T>::to_oobj(size_t row) const {
+  T x = values[row];
+  if (ISNA<T>(x)) return py::None();
+  return odecimal(static_cast<int64_t>(x), scale);
+}
+
+
+
 class pyobj_converter : public converter {
   private:
     const PyObject* const* values;
@@ -161,8 +269,18 @@ static convptr make_converter(const Column* col) {
     case SType::INT64:   return convptr(new int_converter<int64_t>(col));
     case SType::FLOAT32: return convptr(new float_converter<float>(col));
     case SType::FLOAT64: return convptr(new float_converter<double>(col));
+    case SType::DEC16:   return convptr(new decimal_converter<int16_t>(col));
+    case SType::DEC32:   return convptr(new decimal_converter<int32_t>(col));
+    case SType::DEC64:   return convptr(new decimal_converter<int64_t>(col));
     case SType::STR32:   return convptr(new string_converter<uint32_t>(col));
     case SType::STR64:   return convptr(new string_converter<uint64_t>(col));
+    case SType::FSTR:    return convptr(new fstr_converter(col));
+    case SType::CAT8:    return convptr(new cat_converter<uint8_t>(col));
+    case SType::CAT16:   return convptr(new cat_converter<uint16_t>(col));
+    case SType::CAT32:   return convptr(new cat_converter<uint32_t>(col));
+    case SType::DATE64:  return convptr(new datetime_converter<SType::DATE64>(col));
+    case SType::TIME32:  return convptr(new datetime_converter<SType::TIME32>(col));
+    case SType::DATE32:  return convptr(new datetime_converter<SType::DATE32>(col));
     case SType::OBJ:     return convptr(new pyobj_converter(col));
     default:
       throw ValueError()  // LCOV_EXCL_LINE
@@ -0,0 +1,612 @@
+//------------------------------------------------------------------------------
+// Copyright 2018 H2O.ai
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//------------------------------------------------------------------------------
+//
+// Hash-based grouping.
+//
+// This is an alternative to the radix-sort grouping in "sort.cc". The rows of
+// the frame are assigned to groups using open-addressing hash tables, after
+// which only the distinct keys (one representative row per group) are sorted.
+// The final RowIndex is then produced with a single counting-scatter pass,
+// which keeps the rows within each group in their original order. The result
+// is therefore identical to what `DataTable::group()` would have returned.
+//
+// The algorithm proceeds as follows:
+//   1. Compute the 64-bit hash of every row (in parallel).
+//   2. Split the rows into `npartitions` partitions according to the top bits
+//      of their hashes. This is done via per-chunk histograms, so that each
+//      partition lists its rows in increasing order.
+//   3. Each partition builds its own hash table independently of the others
+//      (in parallel), assigning partition-local group ids. Since equal keys
+//      always land into the same partition, no synchronization is needed.
+//   4. Sort the representative rows of all groups using the regular
+//      `DataTable::group()`. This establishes the order of the groups.
+//   5. Compute group offsets from group sizes, and scatter the row indices
+//      into their final positions (in parallel over the partitions).
+//
+// The approach pays off when the number of groups is small compared to the
+// number of rows (so that the hash tables stay in cache, and the sort in
+// step 4 is negligible), and when the keys are expensive to radix-sort, such
+// as strings, floats, or integers with a wide range of values. The planner
+// `DataTable::prefers_hash_grouping()` thus relies on the cardinality
+// estimates available from the columns' stats.
+//
+//------------------------------------------------------------------------------
+#include <algorithm>    // std::min, std::max, std::copy
+#include <cmath>        // std::isnan
+#include <cstring>      // std::memcmp
+#include <limits>       // std::numeric_limits
+#include <memory>       // std::unique_ptr
+#include <utility>      // std::pair
+#include <vector>       // std::vector
+#include "models/murmurhash.h"
+#include "parallel/api.h"
+#include "python/int.h"
+#include "utils/array.h"
+#include "utils/assert.h"
+#include "column.h"
+#include "datatable.h"
+#include "options.h"
+#include "sort.h"
+#include "stats.h"
+
+using RiGb = std::pair<RowIndex, Groupby>;
+
+
+//------------------------------------------------------------------------------
+// Options
+//------------------------------------------------------------------------------
+
+static size_t groupby_hash_ratio = 8;
+
+void groupby_hash_init_options() {
+  dt::register_option(
+    "sort.groupby_hash_ratio",
+    []{ return py::oint(groupby_hash_ratio); },
+    [](py::oobj value) {
+      int64_t n = value.to_int64_strict();
+      if (n < 0) n = 0;
+      groupby_hash_ratio = static_cast<size_t>(n);
+    },
+    "Hash-based grouping is used instead of the radix sort when the\n"
+    "estimated number of groups multiplied by this ratio does not\n"
+    "exceed the number of rows in a frame. Set to 0 in order to\n"
+    "always group via sorting.");
+}
+
+
+
+//------------------------------------------------------------------------------
+// KeyHasher
+//------------------------------------------------------------------------------
+
+/**
+ * Abstract class for computing hashes and checking equality of the values in
+ * a single key column. The column must not have a rowindex.
+ *
+ * hash_into(hashes, i0, i1)
+ *     Combine the hashes of rows in the range `[i0, i1)` into the array of
+ *     row `hashes`.
+ *
+ * equal(row1, row2)
+ *     Return true if the values in rows `row1` and `row2` are the same. This
+ *     comparison must be consistent with how the values are ordered by the
+ *     radix sort: all NAs are considered equal, and the floating-point
+ *     values are compared bit-wise (so that -0.0 and 0.0 are distinct).
+ */
+class KeyHasher {
+  public:
+    virtual ~KeyHasher();
+    virtual void hash_into(uint64_t* hashes, size_t i0, size_t i1) const = 0;
+    virtual bool equal(size_t row1, size_t row2) const = 0;
+};
+
+KeyHasher::~KeyHasher() {}
+
+using khptr = std::unique_ptr<KeyHasher>;
+
+static constexpr uint64_t HASH_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+static constexpr uint64_t HASH_NA = 0x5BD1E9955BD1E995ULL;
+
+static inline uint64_t combine(uint64_t h, uint64_t v) {
+  return (h ^ v) * HASH_MULTIPLIER;
+}
+
+static inline uint64_t finalize(uint64_t h) {
+  h ^= h >> 33;
+  h *= 0xFF51AFD7ED558CCDULL;
+  h ^= h >> 33;
+  h *= 0xC4CEB9FE1A85EC53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+
+template <typename T>
+class IntKeyHasher : public KeyHasher {
+  private:
+    const T* data;
+
+  public:
+    explicit IntKeyHasher(const Column* col) {
+      data = static_cast<const T*>(col->data());
+    }
+
+    void hash_into(uint64_t* hashes, size_t i0, size_t i1) const override {
+      for (size_t i = i0; i < i1; ++i) {
+        hashes[i] = combine(hashes[i], static_cast<uint64_t>(data[i]));
+      }
+    }
+
+    bool equal(size_t row1, size_t row2) const override {
+      return data[row1] == data[row2];
+    }
+};
+
+
+template <typename T, typename U>
+class FloatKeyHasher : public KeyHasher {
+  private:
+    const T* data;
+    const U* bits;
+
+  public:
+    explicit FloatKeyHasher(const Column* col) {
+      data = static_cast<const T*>(col->data());
+      bits = static_cast<const U*>(col->data());
+    }
+
+    void hash_into(uint64_t* hashes, size_t i0, size_t i1) const override {
+      for (size_t i = i0; i < i1; ++i) {
+        uint64_t v = std::isnan(data[i])? HASH_NA
+                                        : static_cast<uint64_t>(bits[i]);
+        hashes[i] = combine(hashes[i], v);
+      }
+    }
+
+    bool equal(size_t row1, size_t row2) const override {
+      bool na1 = std::isnan(data[row1]);
+      bool na2 = std::isnan(data[row2]);
+      return (na1 || na2)? (na1 && na2) : (bits[row1] == bits[row2]);
+    }
+};
+
+
+template <typename T>
+class StringKeyHasher : public KeyHasher {
+  private:
+    const uint8_t* strdata;
+    const T* offsets;
+
+  public:
+    explicit StringKeyHasher(const Column* col) {
+      auto scol = static_cast<const StringColumn<T>*>(col);
+      strdata = scol->ustrdata();
+      offsets = scol->offsets();
+    }
+
+    void hash_into(uint64_t* hashes, size_t i0, size_t i1) const override {
+      for (size_t i = i0; i < i1; ++i) {
+        T end = offsets[i];
+        uint64_t v = HASH_NA;
+        if (!ISNA<T>(end)) {
+          T start = offsets[i - 1] & ~GETNA<T>();
+          v = hash_murmur2(strdata + start, end - start, 0);
+        }
+        hashes[i] = combine(hashes[i], v);
+      }
+    }
+
+    bool equal(size_t row1, size_t row2) const override {
+      T end1 = offsets[row1];
+      T end2 = offsets[row2];
+      bool na1 = ISNA<T>(end1);
+      bool na2 = ISNA<T>(end2);
+      if (na1 || na2) return na1 && na2;
+      T start1 = offsets[row1 - 1] & ~GETNA<T>();
+      T start2 = offsets[row2 - 1] & ~GETNA<T>();
+      T len = end1 - start1;
+      return (len == end2 - start2) &&
+             (len == 0 || std::memcmp(strdata + start1, strdata + start2,
+                                      static_cast<size_t>(len)) == 0);
+    }
+};
+
+
+// The fixed-width strings are hashed and compared as whole blocks of `width`
+// bytes: this is equivalent to comparing the strings themselves, because
+// all values are padded the same way.
+class FixedStringKeyHasher : public KeyHasher {
+  private:
+    const uint8_t* data;
+    size_t width;
+
+  public:
+    explicit FixedStringKeyHasher(const Column* col) {
+      auto xcol = static_cast<const FixedStringColumn*>(col);
+      data = reinterpret_cast<const uint8_t*>(xcol->chars());
+      width = xcol->get_width();
+    }
+
+    void hash_into(uint64_t* hashes, size_t i0, size_t i1) const override {
+      for (size_t i = i0; i < i1; ++i) {
+        const uint8_t* x = data + i * width;
+        uint64_t v = (*x == FixedStringColumn::NA_BYTE)
+                       ? HASH_NA : hash_murmur2(x, width, 0);
+        hashes[i] = combine(hashes[i], v);
+      }
+    }
+
+    bool equal(size_t row1, size_t row2) const override {
+      return std::memcmp(data + row1 * width, data + row2 * width, width) == 0;
+    }
+};
+
+
+static khptr make_key_hasher(const Column* col) {
+  switch (col->stype()) {
+    case SType::BOOL:
+    case SType::INT8:    return khptr(new IntKeyHasher<int8_t>(col));
+    case SType::INT16:
+    case SType::DEC16:   return khptr(new IntKeyHasher<int16_t>(col));
+    case SType::INT32:
+    case SType::DEC32:
+    case SType::TIME32:
+    case SType::DATE32:  return khptr(new IntKeyHasher<int32_t>(col));
+    case SType::INT64:
+    case SType::DEC64:
+    case SType::DATE64:  return khptr(new IntKeyHasher<int64_t>(col));
+    case SType::FLOAT32: return khptr(new FloatKeyHasher<float, uint32_t>(col));
+    case SType::FLOAT64: return khptr(new FloatKeyHasher<double, uint64_t>(col));
+    case SType::STR32:   return khptr(new StringKeyHasher<uint32_t>(col));
+    case SType::STR64:   return khptr(new StringKeyHasher<uint64_t>(col));
+    case SType::FSTR:    return khptr(new FixedStringKeyHasher(col));
+    default:
+      throw NotImplError() << "Hash grouping is not supported for columns of "
+                              "type " << col->stype();
+  }
+}
+
+
+
+//------------------------------------------------------------------------------
+// Planner
+//------------------------------------------------------------------------------
+
+/**
+ * Return an upper-bound estimate for the number of distinct values in the
+ * column (including the NA), or 0 if no estimate is available. This function
+ * never computes any stats, it only relies on those already present.
+ */
+static size_t estimate_cardinality(const Column* col) {
+  Stats* stats = col->get_stats_if_exist();
+  if (stats && stats->is_computed(Stat::NUnique)) {
+    return stats->nunique(col) + 1;
+  }
+  switch (col->stype()) {
+    case SType::BOOL:  return 3;
+    case SType::INT8:  return 257;
+    case SType::INT16:
+    case SType::DEC16: return 65537;
+    case SType::INT32:
+    case SType::INT64:
+    case SType::DEC32:
+    case SType::DEC64:
+    case SType::DATE64:
+    case SType::TIME32:
+    case SType::DATE32: {
+      if (stats && stats->is_computed(Stat::Min) &&
+                   stats->is_computed(Stat::Max)) {
+        int64_t min = col->min_int64();
+        int64_t max = col->max_int64();
+        if (ISNA<int64_t>(min) || ISNA<int64_t>(max)) return 1;
+        double range = static_cast<double>(max) - static_cast<double>(min);
+        if (range < static_cast<double>(col->nrows)) {
+          return static_cast<size_t>(range) + 2;
+        }
+      }
+      return 0;
+    }
+    default: return 0;
+  }
+}
+
+
+/**
+ * Return true if the column can be radix-sorted in at most 2 passes. In this
+ * case the sort is already very efficient, and hashing cannot beat it.
+ */
+static bool is_cheap_to_sort(const Column* col) {
+  switch (col->stype()) {
+    case SType::BOOL:
+    case SType::INT8:
+    case SType::INT16:
+    case SType::DEC16: return true;
+    case SType::FSTR:  return fstr_width(col) <= 2;
+    case SType::INT32:
+    case SType::INT64:
+    case SType::DEC32:
+    case SType::DEC64:
+    case SType::DATE64:
+    case SType::TIME32:
+    case SType::DATE32: {
+      Stats* stats = col->get_stats_if_exist();
+      if (stats && stats->is_computed(Stat::Min) &&
+                   stats->is_computed(Stat::Max)) {
+        int64_t min = col->min_int64();
+        int64_t max = col->max_int64();
+        return ISNA<int64_t>(min) || ISNA<int64_t>(max) ||
+               (static_cast<double>(max) - static_cast<double>(min) < 65536.0);
+      }
+      return false;
+    }
+    default: return false;
+  }
+}
+
+
+bool DataTable::prefers_hash_grouping(const std::vector<sort_spec>& spec) const
+{
+  if (groupby_hash_ratio == 0 || nrows <= 1) return false;
+  if (nrows > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+    return false;
+  }
+  double estimate = 1.0;
+  bool all_cheap = true;
+  for (const sort_spec& s : spec) {
+    if (s.sort_only) return false;
+    const Column* col = columns[s.col_index];
+    switch (col->stype()) {
+      case SType::BOOL:
+      case SType::INT8:
+      case SType::INT16:
+      case SType::INT32:
+      case SType::INT64:
+      case SType::DEC16:
+      case SType::DEC32:
+      case SType::DEC64:
+      case SType::DATE64:
+      case SType::TIME32:
+      case SType::DATE32:
+      case SType::FLOAT32:
+      case SType::FLOAT64:
+      case SType::STR32:
+      case SType::STR64:
+      case SType::FSTR: break;
+      default: return false;
+    }
+    size_t card = estimate_cardinality(col);
+    if (card == 0) return false;
+    estimate *= static_cast<double>(card);
+    all_cheap = all_cheap && is_cheap_to_sort(col);
+  }
+  if (all_cheap) return false;
+  return estimate * static_cast<double>(groupby_hash_ratio)
+         <= static_cast<double>(nrows);
+}
+
+
+//------------------------------------------------------------------------------
+// Hash grouping
+//------------------------------------------------------------------------------
+
+RiGb DataTable::group_hashed(const std::vector<sort_spec>& spec) const {
+  xassert(!spec.empty());
+  if (nrows <= 1) return group(spec);
+  xassert(nrows <= static_cast<size_t>(std::numeric_limits<int32_t>::max()));
+
+  // Key columns that are views are materialized into local copies, leaving
+  // the columns of the frame itself intact.
+  std::vector<const Column*> keycols;
+  std::vector<std::unique_ptr<Column>> materialized;
+  std::vector<khptr> keys;
+  for (const sort_spec& s : spec) {
+    xassert(!s.sort_only);
+    Column* col = columns[s.col_index];
+    if (col->rowindex()) {
+      col = col->shallowcopy();
+      col->materialize();
+      materialized.emplace_back(col);
+    }
+    keycols.push_back(col);
+    keys.push_back(make_key_hasher(col));
+  }
+
+  size_t n = nrows;
+  size_t nth = dt::num_threads_available();
+  size_t nchunks = std::min(nth, std::max<size_t>(n / 4096, 1));
+  size_t chunksize = (n + nchunks - 1) / nchunks;
+
+  // Step 1: compute row hashes
+  dt::array<uint64_t> hasharr(n);
+  uint64_t* hashes = hasharr.data();
+  dt::parallel_for_static(nchunks, 1,
+    [&](size_t c) {
+      size_t i0 = c * chunksize;
+      size_t i1 = std::min(i0 + chunksize, n);
+      for (size_t i = i0; i < i1; ++i) hashes[i] = 0;
+      for (const khptr& key : keys) key->hash_into(hashes, i0, i1);
+      for (size_t i = i0; i < i1; ++i) hashes[i] = finalize(hashes[i]);
+    });
+
+  // Step 2: split rows into partitions by the top bits of the hash
+  int pbits = 0;
+  while ((size_t(1) << pbits) < 4 * nth && pbits < 10 &&
+         (n >> pbits) > 65536) pbits++;
+  size_t nparts = size_t(1) << pbits;
+  int pshift = 64 - pbits;
+  auto partition_of = [=](uint64_t h) -> size_t {
+    return pbits? static_cast<size_t>(h >> pshift) : 0;
+  };
+
+  std::vector<size_t> hist(nchunks * nparts, 0);
+  dt::parallel_for_static(nchunks, 1,
+    [&](size_t c) {
+      size_t* counts = hist.data() + c * nparts;
+      size_t i1 = std::min((c + 1) * chunksize, n);
+      for (size_t i = c * chunksize; i < i1; ++i) {
+        counts[partition_of(hashes[i])]++;
+      }
+    });
+  std::vector<size_t> part_offsets(nparts + 1, 0);
+  {
+    size_t total = 0;
+    for (size_t p = 0; p < nparts; ++p) {
+      part_offsets[p] = total;
+      for (size_t c = 0; c < nchunks; ++c) {
+        size_t cnt = hist[c * nparts + p];
+        hist[c * nparts + p] = total;
+        total += cnt;
+      }
+    }
+    part_offsets[nparts] = total;
+    xassert(total == n);
+  }
+  arr32_t partrows(n);
+  int32_t* prows = partrows.data();
+  dt::parallel_for_static(nchunks, 1,
+    [&](size_t c) {
+      size_t* pos = hist.data() + c * nparts;
+      size_t i1 = std::min((c + 1) * chunksize, n);
+      for (size_t i = c * chunksize; i < i1; ++i) {
+        prows[pos[partition_of(hashes[i])]++] = static_cast<int32_t>(i);
+      }
+    });
+
+  // Step 3: build a hash table within each partition
+  arr32_t localgids(n);
+  int32_t* lgids = localgids.data();
+  std::vector<std::vector<int32_t>> part_reps(nparts);
+  std::vector<std::vector<int32_t>> part_sizes(nparts);
+  auto rows_equal = [&](size_t row1, size_t row2) -> bool {
+    if (hashes[row1] != hashes[row2]) return false;
+    for (const khptr& key : keys) {
+      if (!key->equal(row1, row2)) return false;
+    }
+    return true;
+  };
+  dt::parallel_for_dynamic(nparts,
+    [&](size_t p) {
+      size_t j0 = part_offsets[p];
+      size_t j1 = part_offsets[p + 1];
+      size_t tsize = 64;
+      size_t mask = tsize - 1;
+      std::vector<int32_t> table(tsize, -1);
+      std::vector<int32_t>& reps = part_reps[p];
+      std::vector<int32_t>& sizes = part_sizes[p];
+      for (size_t j = j0; j < j1; ++j) {
+        size_t row = static_cast<size_t>(prows[j]);
+        size_t slot = static_cast<size_t>(hashes[row]) & mask;
+        while (true) {
+          int32_t g = table[slot];
+          if (g == -1) {
+            g = static_cast<int32_t>(reps.size());
+            table[slot] = g;
+            reps.push_back(prows[j]);
+            sizes.push_back(1);
+            lgids[j] = g;
+            // Keep the load factor of the table below 50%
+            if (2 * reps.size() > tsize) {
+              tsize *= 2;
+              mask = tsize - 1;
+              table.assign(tsize, -1);
+              for (size_t k = 0; k < reps.size(); ++k) {
+                size_t krow = static_cast<size_t>(reps[k]);
+                size_t kslot = static_cast<size_t>(hashes[krow]) & mask;
+                while (table[kslot] != -1) kslot = (kslot + 1) & mask;
+                table[kslot] = static_cast<int32_t>(k);
+              }
+            }
+            break;
+          }
+          if (rows_equal(static_cast<size_t>(reps[static_cast<size_t>(g)]),
+                         row)) {
+            sizes[static_cast<size_t>(g)]++;
+            lgids[j] = g;
+            break;
+          }
+          slot = (slot + 1) & mask;
+        }
+      }
+    });
+
+  std::vector<size_t> gbase(nparts + 1, 0);
+  for (size_t p = 0; p < nparts; ++p) {
+    gbase[p + 1] = gbase[p] + part_reps[p].size();
+  }
+  size_t ngroups = gbase[nparts];
+
+  // Step 4: sort the distinct keys in order to find the order of the groups
+  arr32_t repsarr(ngroups);
+  for (size_t p = 0; p < nparts; ++p) {
+    std::copy(part_reps[p].begin(), part_reps[p].end(),
+              repsarr.data() + gbase[p]);
+  }
+  arr32_t ranks(ngroups);
+  {
+    RowIndex ri_reps(std::move(repsarr));
+    colvec repcols;
+    std::vector<sort_spec> keyspec;
+    for (size_t i = 0; i < spec.size(); ++i) {
+      repcols.push_back(keycols[i]->shallowcopy(ri_reps));
+      keyspec.emplace_back(i, spec[i].descending, spec[i].na_last, false);
+    }
+    DataTable keysdt(std::move(repcols));
+    RowIndex order = keysdt.group(keyspec).first;
+    for (size_t r = 0; r < ngroups; ++r) {
+      ranks[order[r]] = static_cast<int32_t>(r);
+    }
+  }
+
+  // Step 5: compute group offsets, and scatter the rows into their groups
+  MemoryRange offsets_mr = MemoryRange::mem((ngroups + 1) * sizeof(int32_t));
+  int32_t* offsets = static_cast<int32_t*>(offsets_mr.wptr());
+  offsets[0] = 0;
+  for (size_t p = 0; p < nparts; ++p) {
+    for (size_t k = 0; k < part_sizes[p].size(); ++k) {
+      size_t r = static_cast<size_t>(ranks[gbase[p] + k]);
+      offsets[r + 1] = part_sizes[p][k];
+    }
+  }
+  for (size_t r = 0; r < ngroups; ++r) {
+    offsets[r + 1] += offsets[r];
+  }
+  xassert(static_cast<size_t>(offsets[ngroups]) == n);
+
+  arr32_t positions(ngroups);
+  std::copy(offsets, offsets + ngroups, positions.data());
+  arr32_t indices(n);
+  int32_t* out = indices.data();
+  int32_t* pos = positions.data();
+  dt::parallel_for_dynamic(nparts,
+    [&](size_t p) {
+      const int32_t* rnk = ranks.data() + gbase[p];
+      for (size_t j = part_offsets[p]; j < part_offsets[p + 1]; ++j) {
+        size_t r = static_cast<size_t>(rnk[lgids[j]]);
+        out[pos[r]++] = prows[j];
+      }
+    });
+
+  RiGb result;
+  result.first = RowIndex(std::move(indices));
+  result.second = Groupby(ngroups, std::move(offsets_mr));
+  return result;
+}
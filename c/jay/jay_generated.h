@@ -24,8 +24,12 @@ struct StatsFloat64;
 
 struct Frame;
 
+struct QSketch;
+
 struct Column;
 
+struct Block;
+
 struct Buffer;
 
 enum Type {
@@ -38,11 +42,20 @@ enum Type {
   Type_Float64 = 6,
   Type_Str32 = 7,
   Type_Str64 = 8,
+  Type_Cat8 = 9,
+  Type_Cat16 = 10,
+  Type_Cat32 = 11,
+  Type_Date32 = 12,
+  Type_Date64 = 13,
+  Type_Time32 = 14,
+  Type_Dec16 = 15,
+  Type_Dec32 = 16,
+  Type_Dec64 = 17,
   Type_MIN = Type_Bool8,
-  Type_MAX = Type_Str64
+  Type_MAX = Type_Dec64
 };
 
-inline const Type (&EnumValuesType())[9] {
+inline const Type (&EnumValuesType())[18] {
   static const Type values[] = {
     Type_Bool8,
     Type_Int8,
@@ -52,7 +65,16 @@ inline const Type (&EnumValuesType())[9] {
     Type_Float32,
     Type_Float64,
     Type_Str32,
-    Type_Str64
+    Type_Str64,
+    Type_Cat8,
+    Type_Cat16,
+    Type_Cat32,
+    Type_Date32,
+    Type_Date64,
+    Type_Time32,
+    Type_Dec16,
+    Type_Dec32,
+    Type_Dec64
   };
   return values;
 }
@@ -68,6 +90,15 @@ inline const char * const *EnumNamesType() {
     "Float64",
     "Str32",
     "Str64",
+    "Cat8",
+    "Cat16",
+    "Cat32",
+    "Date32",
+    "Date64",
+    "Time32",
+    "Dec16",
+    "Dec32",
+    "Dec64",
     nullptr
   };
   return names;
@@ -125,6 +156,38 @@ inline const char *EnumNameStats(Stats e) {
   return EnumNamesStats()[index];
 }
 
+enum Codec {
+  Codec_None = 0,
+  Codec_LZ4 = 1,
+  Codec_Zstd = 2,
+  Codec_MIN = Codec_None,
+  Codec_MAX = Codec_Zstd
+};
+
+inline const Codec (&EnumValuesCodec())[3] {
+  static const Codec values[] = {
+    Codec_None,
+    Codec_LZ4,
+    Codec_Zstd
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesCodec() {
+  static const char * const names[] = {
+    "None",
+    "LZ4",
+    "Zstd",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameCodec(Codec e) {
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesCodec()[index];
+}
+
 bool VerifyStats(flatbuffers::Verifier &verifier, const void *obj, Stats type);
 bool VerifyStatsVector(flatbuffers::Verifier &verifier, const flatbuffers::Vector<flatbuffers::Offset<void>> *values, const flatbuffers::Vector<uint8_t> *types);
 
@@ -391,6 +454,93 @@ inline flatbuffers::Offset<Frame> CreateFrameDirect(
       columns ? _fbb.CreateVector<flatbuffers::Offset<Column>>(*columns) : 0);
 }
 
+struct QSketch FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_MEANS = 4,
+    VT_WEIGHTS = 6,
+    VT_MIN = 8,
+    VT_MAX = 10
+  };
+  const flatbuffers::Vector<double> *means() const {
+    return GetPointer<const flatbuffers::Vector<double> *>(VT_MEANS);
+  }
+  const flatbuffers::Vector<double> *weights() const {
+    return GetPointer<const flatbuffers::Vector<double> *>(VT_WEIGHTS);
+  }
+  double min() const {
+    return GetField<double>(VT_MIN, 0.0);
+  }
+  double max() const {
+    return GetField<double>(VT_MAX, 0.0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_MEANS) &&
+           verifier.Verify(means()) &&
+           VerifyOffset(verifier, VT_WEIGHTS) &&
+           verifier.Verify(weights()) &&
+           VerifyField<double>(verifier, VT_MIN) &&
+           VerifyField<double>(verifier, VT_MAX) &&
+           verifier.EndTable();
+  }
+};
+
+struct QSketchBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  int : 32;
+  void add_means(flatbuffers::Offset<flatbuffers::Vector<double>> means) {
+    fbb_.AddOffset(QSketch::VT_MEANS, means);
+  }
+  void add_weights(flatbuffers::Offset<flatbuffers::Vector<double>> weights) {
+    fbb_.AddOffset(QSketch::VT_WEIGHTS, weights);
+  }
+  void add_min(double min) {
+    fbb_.AddElement<double>(QSketch::VT_MIN, min, 0.0);
+  }
+  void add_max(double max) {
+    fbb_.AddElement<double>(QSketch::VT_MAX, max, 0.0);
+  }
+  explicit QSketchBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  QSketchBuilder &operator=(const QSketchBuilder &);
+  flatbuffers::Offset<QSketch> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<QSketch>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<QSketch> CreateQSketch(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<double>> means = 0,
+    flatbuffers::Offset<flatbuffers::Vector<double>> weights = 0,
+    double min = 0.0,
+    double max = 0.0) {
+  QSketchBuilder builder_(_fbb);
+  builder_.add_max(max);
+  builder_.add_min(min);
+  builder_.add_weights(weights);
+  builder_.add_means(means);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<QSketch> CreateQSketchDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<double> *means = nullptr,
+    const std::vector<double> *weights = nullptr,
+    double min = 0.0,
+    double max = 0.0) {
+  return jay::CreateQSketch(
+      _fbb,
+      means ? _fbb.CreateVector<double>(*means) : 0,
+      weights ? _fbb.CreateVector<double>(*weights) : 0,
+      min,
+      max);
+}
+
 struct Column FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   enum {
     VT_TYPE = 4,
@@ -399,7 +549,14 @@ struct Column FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     VT_NAME = 10,
     VT_NULLCOUNT = 12,
     VT_STATS_TYPE = 14,
-    VT_STATS = 16
+    VT_STATS = 16,
+    VT_NUNIQUE_APPROX = 18,
+    VT_QSKETCH = 20,
+    VT_BLOCKS = 22,
+    VT_LEVELS = 24,
+    VT_LEVELS_STRDATA = 26,
+    VT_LEVELS_TYPE = 28,
+    VT_SCALE = 30
   };
   Type type() const {
     return static_cast<Type>(GetField<uint8_t>(VT_TYPE, 0));
@@ -444,6 +601,27 @@ struct Column FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const StatsFloat64 *stats_as_Float64() const {
     return stats_type() == Stats_Float64 ? static_cast<const StatsFloat64 *>(stats()) : nullptr;
   }
+  int64_t nunique_approx() const {
+    return GetField<int64_t>(VT_NUNIQUE_APPROX, -1);
+  }
+  const QSketch *qsketch() const {
+    return GetPointer<const QSketch *>(VT_QSKETCH);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Block>> *blocks() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Block>> *>(VT_BLOCKS);
+  }
+  const Buffer *levels() const {
+    return GetStruct<const Buffer *>(VT_LEVELS);
+  }
+  const Buffer *levels_strdata() const {
+    return GetStruct<const Buffer *>(VT_LEVELS_STRDATA);
+  }
+  Type levels_type() const {
+    return static_cast<Type>(GetField<uint8_t>(VT_LEVELS_TYPE, 0));
+  }
+  int8_t scale() const {
+    return GetField<int8_t>(VT_SCALE, 0);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<uint8_t>(verifier, VT_TYPE) &&
@@ -455,6 +633,16 @@ struct Column FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyField<uint8_t>(verifier, VT_STATS_TYPE) &&
            VerifyOffset(verifier, VT_STATS) &&
            VerifyStats(verifier, stats(), stats_type()) &&
+           VerifyField<int64_t>(verifier, VT_NUNIQUE_APPROX) &&
+           VerifyOffset(verifier, VT_QSKETCH) &&
+           verifier.VerifyTable(qsketch()) &&
+           VerifyOffset(verifier, VT_BLOCKS) &&
+           verifier.Verify(blocks()) &&
+           verifier.VerifyVectorOfTables(blocks()) &&
+           VerifyField<Buffer>(verifier, VT_LEVELS) &&
+           VerifyField<Buffer>(verifier, VT_LEVELS_STRDATA) &&
+           VerifyField<uint8_t>(verifier, VT_LEVELS_TYPE) &&
+           VerifyField<int8_t>(verifier, VT_SCALE) &&
            verifier.EndTable();
   }
 };
@@ -484,6 +672,27 @@ struct ColumnBuilder {
   void add_stats(flatbuffers::Offset<void> stats) {
     fbb_.AddOffset(Column::VT_STATS, stats);
   }
+  void add_nunique_approx(int64_t nunique_approx) {
+    fbb_.AddElement<int64_t>(Column::VT_NUNIQUE_APPROX, nunique_approx, -1);
+  }
+  void add_qsketch(flatbuffers::Offset<QSketch> qsketch) {
+    fbb_.AddOffset(Column::VT_QSKETCH, qsketch);
+  }
+  void add_blocks(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Block>>> blocks) {
+    fbb_.AddOffset(Column::VT_BLOCKS, blocks);
+  }
+  void add_levels(const Buffer *levels) {
+    fbb_.AddStruct(Column::VT_LEVELS, levels);
+  }
+  void add_levels_strdata(const Buffer *levels_strdata) {
+    fbb_.AddStruct(Column::VT_LEVELS_STRDATA, levels_strdata);
+  }
+  void add_levels_type(Type levels_type) {
+    fbb_.AddElement<uint8_t>(Column::VT_LEVELS_TYPE, static_cast<uint8_t>(levels_type), 0);
+  }
+  void add_scale(int8_t scale) {
+    fbb_.AddElement<int8_t>(Column::VT_SCALE, scale, 0);
+  }
   explicit ColumnBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -504,13 +713,27 @@ inline flatbuffers::Offset<Column> CreateColumn(
     flatbuffers::Offset<flatbuffers::String> name = 0,
     uint64_t nullcount = 0,
     Stats stats_type = Stats_NONE,
-    flatbuffers::Offset<void> stats = 0) {
+    flatbuffers::Offset<void> stats = 0,
+    int64_t nunique_approx = -1,
+    flatbuffers::Offset<QSketch> qsketch = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Block>>> blocks = 0,
+    const Buffer *levels = nullptr,
+    const Buffer *levels_strdata = nullptr,
+    Type levels_type = Type_Bool8,
+    int8_t scale = 0) {
   ColumnBuilder builder_(_fbb);
+  builder_.add_nunique_approx(nunique_approx);
   builder_.add_nullcount(nullcount);
+  builder_.add_levels_strdata(levels_strdata);
+  builder_.add_levels(levels);
+  builder_.add_blocks(blocks);
+  builder_.add_qsketch(qsketch);
   builder_.add_stats(stats);
   builder_.add_name(name);
   builder_.add_strdata(strdata);
   builder_.add_data(data);
+  builder_.add_scale(scale);
+  builder_.add_levels_type(levels_type);
   builder_.add_stats_type(stats_type);
   builder_.add_type(type);
   return builder_.Finish();
@@ -524,7 +747,14 @@ inline flatbuffers::Offset<Column> CreateColumnDirect(
     const char *name = nullptr,
     uint64_t nullcount = 0,
     Stats stats_type = Stats_NONE,
-    flatbuffers::Offset<void> stats = 0) {
+    flatbuffers::Offset<void> stats = 0,
+    int64_t nunique_approx = -1,
+    flatbuffers::Offset<QSketch> qsketch = 0,
+    const std::vector<flatbuffers::Offset<Block>> *blocks = nullptr,
+    const Buffer *levels = nullptr,
+    const Buffer *levels_strdata = nullptr,
+    Type levels_type = Type_Bool8,
+    int8_t scale = 0) {
   return jay::CreateColumn(
       _fbb,
       type,
@@ -533,7 +763,136 @@ inline flatbuffers::Offset<Column> CreateColumnDirect(
       name ? _fbb.CreateString(name) : 0,
       nullcount,
       stats_type,
-      stats);
+      stats,
+      nunique_approx,
+      qsketch,
+      blocks ? _fbb.CreateVector<flatbuffers::Offset<Block>>(*blocks) : 0,
+      levels,
+      levels_strdata,
+      levels_type,
+      scale);
+}
+
+struct Block FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_NROWS = 4,
+    VT_CODEC = 6,
+    VT_DATA = 8,
+    VT_STRDATA = 10,
+    VT_DATA_SIZE = 12,
+    VT_STRDATA_SIZE = 14,
+    VT_NULLCOUNT = 16,
+    VT_STATS_TYPE = 18,
+    VT_STATS = 20
+  };
+  uint64_t nrows() const {
+    return GetField<uint64_t>(VT_NROWS, 0);
+  }
+  Codec codec() const {
+    return static_cast<Codec>(GetField<uint8_t>(VT_CODEC, 0));
+  }
+  const Buffer *data() const {
+    return GetStruct<const Buffer *>(VT_DATA);
+  }
+  const Buffer *strdata() const {
+    return GetStruct<const Buffer *>(VT_STRDATA);
+  }
+  uint64_t data_size() const {
+    return GetField<uint64_t>(VT_DATA_SIZE, 0);
+  }
+  uint64_t strdata_size() const {
+    return GetField<uint64_t>(VT_STRDATA_SIZE, 0);
+  }
+  uint64_t nullcount() const {
+    return GetField<uint64_t>(VT_NULLCOUNT, 0);
+  }
+  Stats stats_type() const {
+    return static_cast<Stats>(GetField<uint8_t>(VT_STATS_TYPE, 0));
+  }
+  const void *stats() const {
+    return GetPointer<const void *>(VT_STATS);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint64_t>(verifier, VT_NROWS) &&
+           VerifyField<uint8_t>(verifier, VT_CODEC) &&
+           VerifyField<Buffer>(verifier, VT_DATA) &&
+           VerifyField<Buffer>(verifier, VT_STRDATA) &&
+           VerifyField<uint64_t>(verifier, VT_DATA_SIZE) &&
+           VerifyField<uint64_t>(verifier, VT_STRDATA_SIZE) &&
+           VerifyField<uint64_t>(verifier, VT_NULLCOUNT) &&
+           VerifyField<uint8_t>(verifier, VT_STATS_TYPE) &&
+           VerifyOffset(verifier, VT_STATS) &&
+           VerifyStats(verifier, stats(), stats_type()) &&
+           verifier.EndTable();
+  }
+};
+
+struct BlockBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  int : 32;
+  void add_nrows(uint64_t nrows) {
+    fbb_.AddElement<uint64_t>(Block::VT_NROWS, nrows, 0);
+  }
+  void add_codec(Codec codec) {
+    fbb_.AddElement<uint8_t>(Block::VT_CODEC, static_cast<uint8_t>(codec), 0);
+  }
+  void add_data(const Buffer *data) {
+    fbb_.AddStruct(Block::VT_DATA, data);
+  }
+  void add_strdata(const Buffer *strdata) {
+    fbb_.AddStruct(Block::VT_STRDATA, strdata);
+  }
+  void add_data_size(uint64_t data_size) {
+    fbb_.AddElement<uint64_t>(Block::VT_DATA_SIZE, data_size, 0);
+  }
+  void add_strdata_size(uint64_t strdata_size) {
+    fbb_.AddElement<uint64_t>(Block::VT_STRDATA_SIZE, strdata_size, 0);
+  }
+  void add_nullcount(uint64_t nullcount) {
+    fbb_.AddElement<uint64_t>(Block::VT_NULLCOUNT, nullcount, 0);
+  }
+  void add_stats_type(Stats stats_type) {
+    fbb_.AddElement<uint8_t>(Block::VT_STATS_TYPE, static_cast<uint8_t>(stats_type), 0);
+  }
+  void add_stats(flatbuffers::Offset<void> stats) {
+    fbb_.AddOffset(Block::VT_STATS, stats);
+  }
+  explicit BlockBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  BlockBuilder &operator=(const BlockBuilder &);
+  flatbuffers::Offset<Block> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Block>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Block> CreateBlock(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t nrows = 0,
+    Codec codec = Codec_None,
+    const Buffer *data = nullptr,
+    const Buffer *strdata = nullptr,
+    uint64_t data_size = 0,
+    uint64_t strdata_size = 0,
+    uint64_t nullcount = 0,
+    Stats stats_type = Stats_NONE,
+    flatbuffers::Offset<void> stats = 0) {
+  BlockBuilder builder_(_fbb);
+  builder_.add_nullcount(nullcount);
+  builder_.add_strdata_size(strdata_size);
+  builder_.add_data_size(data_size);
+  builder_.add_nrows(nrows);
+  builder_.add_stats(stats);
+  builder_.add_strdata(strdata);
+  builder_.add_data(data);
+  builder_.add_stats_type(stats_type);
+  builder_.add_codec(codec);
+  return builder_.Finish();
 }
 
 inline bool VerifyStats(flatbuffers::Verifier &, const void *, Stats type) {
@@ -6,9 +6,13 @@
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
 #include <string>
-#include <cstring>              // std::memcmp
+#include <cstring>              // std::memcmp, std::memcpy
+#include <type_traits>          // std::is_integral
 #include "frame/py_frame.h"
 #include "jay/jay_generated.h"
+#include "parallel/api.h"
+#include "utils/compress.h"
+#include "blockindex.h"
 #include "datatable.h"
 #include "datatablemodule.h"
 
@@ -39,19 +43,24 @@ DataTable* open_jay_from_bytes(const char* ptr, size_t len) {
 }
 
 
-DataTable* open_jay_from_mbuf(const MemoryRange& mbuf)
+/**
+ * Check the signature of the Jay file in `mbuf`, and return its (verified)
+ * meta record. The offset of the meta record within the file, which is also
+ * the end of the data section, is stored in `meta_offset`.
+ */
+const jay::Frame* read_jay_meta(const MemoryRange& mbuf, size_t* meta_offset)
 {
-  std::vector<std::string> colnames;
-
   const uint8_t* ptr = static_cast<const uint8_t*>(mbuf.rptr());
   const size_t len = mbuf.size();
   if (len < 24) {
     throw IOError() << "Invalid Jay file of size " << len;
   }
-  if (std::memcmp(ptr, "JAY1\0\0\0\0", 8) != 0 ||
-      (std::memcmp(ptr + len - 8, "\0\0\0\0" "1JAY", 8) != 0 &&
-       std::memcmp(ptr + len - 8, "\0\0\0\0" "JAY1", 8) != 0))
-  {
+  bool v1 = (std::memcmp(ptr, "JAY1\0\0\0\0", 8) == 0 &&
+             (std::memcmp(ptr + len - 8, "\0\0\0\0" "1JAY", 8) == 0 ||
+              std::memcmp(ptr + len - 8, "\0\0\0\0" "JAY1", 8) == 0));
+  bool v2 = (std::memcmp(ptr, "JAY2\0\0\0\0", 8) == 0 &&
+             std::memcmp(ptr + len - 8, "\0\0\0\0" "2JAY", 8) == 0);
+  if (!v1 && !v2) {
     throw IOError() << "Invalid signature for a Jay file";
   }
 
@@ -67,6 +76,15 @@ DataTable* open_jay_from_mbuf(const MemoryRange& mbuf)
   if (!frame->Verify(verifier)) {
     throw IOError() << "Invalid meta record in a Jay file";
   }
+  if (meta_offset) *meta_offset = len - 16 - meta_size;
+  return frame;
+}
+
+
+DataTable* open_jay_from_mbuf(const MemoryRange& mbuf)
+{
+  std::vector<std::string> colnames;
+  auto frame = read_jay_meta(mbuf, nullptr);
 
   size_t ncols = frame->ncols();
   size_t nrows = frame->nrows();
@@ -118,6 +136,339 @@ static void initStats(Stats* stats, const jay::Column* jcol) {
 }
 
 
+// The approximate stats are stored independently of the min/max stats, and
+// are present only if they were computed before the frame was saved.
+static void initSketches(Stats* stats, const jay::Column* jcol) {
+  int64_t nunique_approx = jcol->nunique_approx();
+  if (nunique_approx >= 0) {
+    stats->set_nunique_approx(static_cast<size_t>(nunique_approx));
+  }
+  const jay::QSketch* jsketch = jcol->qsketch();
+  if (jsketch && jsketch->means() && jsketch->weights()) {
+    auto means = jsketch->means();
+    auto weights = jsketch->weights();
+    std::vector<dt::TDigest::centroid> centroids;
+    for (flatbuffers::uoffset_t i = 0; i < means->size(); ++i) {
+      centroids.push_back({means->Get(i), weights->Get(i)});
+    }
+    stats->set_qsketch(dt::TDigest(std::move(centroids),
+                                   jsketch->min(), jsketch->max()));
+  }
+}
+
+
+//------------------------------------------------------------------------------
+// Open a column stored in blocks
+//------------------------------------------------------------------------------
+
+// Location of one of the block's buffers within the Jay file. The `decoder`
+// is null if the buffer is stored uncompressed.
+struct BlockPart {
+  size_t offset;
+  size_t length;
+  size_t size;
+  std::shared_ptr<Compressor> decoder;
+};
+
+
+static BlockPart extract_block_part(
+    const MemoryRange& src, const jay::Buffer* jbuf, size_t size,
+    const std::shared_ptr<Compressor>& decoder)
+{
+  if (!jbuf) {
+    throw IOError() << "Invalid Jay file: a block is missing its data buffer";
+  }
+  size_t offset = jbuf->offset() + 8;
+  size_t length = jbuf->length();
+  if (offset > src.size() || length > src.size() - offset) {
+    throw IOError() << "Invalid Jay file: a block's data buffer of length "
+        << length << " at offset " << offset << " is outside of the file";
+  }
+  if (!decoder && length != size) {
+    throw IOError() << "Invalid Jay file: uncompressed block of size "
+        << size << " is stored in a buffer of length " << length;
+  }
+  return BlockPart { offset, length, size, decoder };
+}
+
+
+// Decode the block part `p` into `dst`.
+static void load_block_part(const BlockPart& p, const MemoryRange& src,
+                            void* dst)
+{
+  const char* ptr = static_cast<const char*>(src.rptr()) + p.offset;
+  if (p.decoder) {
+    p.decoder->decompress(ptr, p.length, static_cast<char*>(dst), p.size);
+  } else {
+    std::memcpy(dst, ptr, p.size);
+  }
+}
+
+
+// Blocks are decoded in parallel, unless the data was requested from within
+// a parallel region.
+static void for_each_block(size_t n, dt::function<void(size_t)> fn) {
+  if (n > 1 && dt::num_threads_in_team() == 0) {
+    dt::parallel_for_dynamic(n, fn);
+  } else {
+    for (size_t i = 0; i < n; ++i) fn(i);
+  }
+}
+
+
+/**
+ * Create a (lazy) buffer which is the concatenation of all `parts`. This is
+ * used for the data of fixed-width columns, and for the character data of
+ * string columns.
+ */
+static MemoryRange concat_blocks(const MemoryRange& jaybuf,
+                                 const std::vector<BlockPart>& parts)
+{
+  size_t total = 0;
+  std::vector<size_t> starts;
+  for (const BlockPart& p : parts) {
+    starts.push_back(total);
+    total += p.size;
+  }
+  return MemoryRange::lazy(total,
+    [jaybuf, parts, starts](void* out) {
+      for_each_block(parts.size(),
+        [&](size_t i) {
+          load_block_part(parts[i], jaybuf, static_cast<char*>(out) + starts[i]);
+        });
+    });
+}
+
+
+/**
+ * Create a (lazy) offsets buffer of a string column. Each block contains
+ * `nrows + 1` offsets relative to the first of them; these are rebased to
+ * the start of the block's character data within the whole column.
+ */
+template <typename T>
+static MemoryRange concat_string_offsets(const MemoryRange& jaybuf,
+                                         const std::vector<BlockPart>& parts,
+                                         const std::vector<size_t>& strsizes)
+{
+  constexpr T NA = GETNA<T>();
+  size_t nrows = 0;
+  std::vector<size_t> rowstarts, strstarts;
+  size_t strtotal = 0;
+  for (size_t i = 0; i < parts.size(); ++i) {
+    rowstarts.push_back(nrows);
+    strstarts.push_back(strtotal);
+    nrows += parts[i].size / sizeof(T) - 1;
+    strtotal += strsizes[i];
+  }
+  return MemoryRange::lazy((nrows + 1) * sizeof(T),
+    [jaybuf, parts, rowstarts, strstarts, strsizes](void* out) {
+      T* offsets = static_cast<T*>(out);
+      offsets[0] = 0;
+      for_each_block(parts.size(),
+        [&](size_t i) {
+          const BlockPart& p = parts[i];
+          size_t n = p.size / sizeof(T) - 1;
+          std::unique_ptr<T[]> tmp(new T[n + 1]);
+          load_block_part(p, jaybuf, tmp.get());
+          T base = tmp[0] & ~NA;
+          T shift = static_cast<T>(strstarts[i]);
+          T* dst = offsets + rowstarts[i];
+          for (size_t j = 1; j <= n; ++j) {
+            T x = tmp[j];
+            dst[j] = static_cast<T>(((x & ~NA) - base + shift) | (x & NA));
+          }
+          if ((tmp[n] & ~NA) - base != strsizes[i]) {
+            throw IOError() << "Invalid Jay file: string offsets in a block "
+                "do not match the size of its character data";
+          }
+        });
+    });
+}
+
+
+// Locations of all the blocks of a column within the Jay file.
+struct ColumnBlocks {
+  SType stype;
+  int8_t scale;  // for decimal columns only
+  size_t : 48;
+  std::vector<BlockPart> dparts, sparts;
+  std::vector<size_t> strsizes;
+  std::shared_ptr<Column> levels;  // for categorical columns only
+};
+
+
+static ColumnBlocks extract_blocks(
+    SType stype, const jay::Column* jcol, const MemoryRange& jaybuf)
+{
+  std::shared_ptr<Compressor> decoders[jay::Codec_MAX + 1];
+  auto get_decoder = [&](jay::Codec codec) {
+    if (codec > jay::Codec_MAX) {
+      throw IOError() << "Unknown compression codec " << int(codec)
+          << " in a Jay file";
+    }
+    if (codec != jay::Codec_None && !decoders[codec]) {
+      const char* method = (codec == jay::Codec_LZ4)? "lz4" : "zstd";
+      decoders[codec] = std::shared_ptr<Compressor>(Compressor::make(method));
+    }
+    return decoders[codec];
+  };
+
+  ColumnBlocks cb;
+  cb.stype = stype;
+  cb.scale = jcol->scale();
+  bool isstr = (stype == SType::STR32 || stype == SType::STR64);
+  size_t elemsize = info(stype).elemsize();
+  for (const jay::Block* jblock : *jcol->blocks()) {
+    size_t n = jblock->nrows();
+    size_t size = jblock->data_size();
+    if (size != (isstr? n + 1 : n) * elemsize) {
+      throw IOError() << "Invalid Jay file: the data block of column `"
+          << jcol->name()->str() << "` has size " << size << ", which is "
+          "inconsistent with its number of rows " << n;
+    }
+    auto decoder = get_decoder(jblock->codec());
+    cb.dparts.push_back(
+        extract_block_part(jaybuf, jblock->data(), size, decoder));
+    if (isstr) {
+      size_t strsize = jblock->strdata_size();
+      cb.sparts.push_back(
+          extract_block_part(jaybuf, jblock->strdata(), strsize, decoder));
+      cb.strsizes.push_back(strsize);
+    }
+  }
+  return cb;
+}
+
+
+// Create a (lazy) column out of the blocks `ids` of `cb`, or out of all
+// blocks if `ids` is null.
+static Column* column_from_blocks(const ColumnBlocks& cb,
+                                  const MemoryRange& jaybuf,
+                                  const std::vector<size_t>* ids = nullptr)
+{
+  std::vector<BlockPart> dparts, sparts;
+  std::vector<size_t> strsizes;
+  if (ids) {
+    for (size_t i : *ids) {
+      dparts.push_back(cb.dparts[i]);
+      if (!cb.sparts.empty()) {
+        sparts.push_back(cb.sparts[i]);
+        strsizes.push_back(cb.strsizes[i]);
+      }
+    }
+  }
+  const auto& dp = ids? dparts : cb.dparts;
+  const auto& sp = ids? sparts : cb.sparts;
+  const auto& ss = ids? strsizes : cb.strsizes;
+
+  SType stype = cb.stype;
+  if (stype == SType::STR32 || stype == SType::STR64) {
+    size_t elemsize = info(stype).elemsize();
+    size_t nrows = 0;
+    for (const BlockPart& p : dp) nrows += p.size / elemsize - 1;
+    MemoryRange databuf =
+        (stype == SType::STR32)
+          ? concat_string_offsets<uint32_t>(jaybuf, dp, ss)
+          : concat_string_offsets<uint64_t>(jaybuf, dp, ss);
+    MemoryRange strbuf = concat_blocks(jaybuf, sp);
+    return new_string_column(nrows, std::move(databuf), std::move(strbuf));
+  }
+  if (is_categorical(stype)) {
+    return new_categorical_column(stype, concat_blocks(jaybuf, dp), cb.levels);
+  }
+  if (is_decimal(stype)) {
+    MemoryRange databuf = concat_blocks(jaybuf, dp);
+    size_t nrows = databuf.size() / info(stype).elemsize();
+    return new_decimal_column(stype, nrows, cb.scale, std::move(databuf));
+  }
+  return Column::new_mbuf_column(stype, concat_blocks(jaybuf, dp));
+}
+
+
+template <typename JStats>
+static void readBlockRange(const jay::Block* jblock, jay::Stats jsttype,
+                           dt::BlockIndex::Block& b)
+{
+  if (jblock->stats_type() != jsttype || !jblock->stats()) return;
+  auto jstats = static_cast<const JStats*>(jblock->stats());
+  using T = decltype(jstats->min());
+  b.has_range = true;
+  b.fmin = static_cast<double>(jstats->min());
+  b.fmax = static_cast<double>(jstats->max());
+  if (std::is_integral<T>::value) {
+    b.imin = static_cast<int64_t>(jstats->min());
+    b.imax = static_cast<int64_t>(jstats->max());
+  }
+}
+
+
+/**
+ * Attach to `col` the BlockIndex with the per-block stats of the Jay column
+ * `jcol`. The BlockIndex allows to create a column with only a subset of
+ * blocks, which are loaded from `jaybuf` on demand.
+ */
+static void attach_block_index(Column* col, const jay::Column* jcol,
+                               std::shared_ptr<ColumnBlocks> cb,
+                               const MemoryRange& jaybuf)
+{
+  std::vector<dt::BlockIndex::Block> blocks;
+  for (const jay::Block* jblock : *jcol->blocks()) {
+    dt::BlockIndex::Block b { jblock->nrows(), jblock->nullcount(),
+                              0, 0, 0.0, 0.0, false };
+    switch (cb->stype) {
+      case SType::BOOL:    readBlockRange<jay::StatsBool>(jblock, jay::Stats_Bool, b); break;
+      case SType::INT8:    readBlockRange<jay::StatsInt8>(jblock, jay::Stats_Int8, b); break;
+      case SType::INT16:   readBlockRange<jay::StatsInt16>(jblock, jay::Stats_Int16, b); break;
+      case SType::INT32:   readBlockRange<jay::StatsInt32>(jblock, jay::Stats_Int32, b); break;
+      case SType::INT64:   readBlockRange<jay::StatsInt64>(jblock, jay::Stats_Int64, b); break;
+      case SType::FLOAT32: readBlockRange<jay::StatsFloat32>(jblock, jay::Stats_Float32, b); break;
+      case SType::FLOAT64: readBlockRange<jay::StatsFloat64>(jblock, jay::Stats_Float64, b); break;
+      case SType::DATE64:  readBlockRange<jay::StatsInt64>(jblock, jay::Stats_Int64, b); break;
+      case SType::TIME32:  readBlockRange<jay::StatsInt32>(jblock, jay::Stats_Int32, b); break;
+      case SType::DATE32:  readBlockRange<jay::StatsInt32>(jblock, jay::Stats_Int32, b); break;
+      default: break;
+    }
+    blocks.push_back(b);
+  }
+  col->set_block_index(std::make_shared<dt::BlockIndex>(
+    std::move(blocks), col->data_buf(),
+    [cb, jaybuf](const std::vector<size_t>& ids) {
+      return column_from_blocks(*cb, jaybuf, &ids);
+    }));
+}
+
+
+
+//------------------------------------------------------------------------------
+// Open an individual column
+//------------------------------------------------------------------------------
+
+// The levels of a categorical column are stored as a separate string column.
+static std::shared_ptr<Column> levels_from_jay(const jay::Column* jcol,
+                                               const MemoryRange& jaybuf)
+{
+  const jay::Buffer* jlevels = jcol->levels();
+  const jay::Buffer* jstrdata = jcol->levels_strdata();
+  jay::Type ltype = jcol->levels_type();
+  if (!jlevels || !jstrdata ||
+      (ltype != jay::Type_Str32 && ltype != jay::Type_Str64)) {
+    throw IOError() << "Invalid Jay file: categorical column `"
+        << jcol->name()->str() << "` has no levels";
+  }
+  size_t elemsize = (ltype == jay::Type_Str32)? 4 : 8;
+  if (jlevels->length() < elemsize || jlevels->length() % elemsize) {
+    throw IOError() << "Invalid Jay file: the levels of column `"
+        << jcol->name()->str() << "` have invalid size "
+        << jlevels->length();
+  }
+  size_t nlevels = jlevels->length() / elemsize - 1;
+  MemoryRange databuf = extract_buffer(jaybuf, jlevels);
+  MemoryRange strbuf = extract_buffer(jaybuf, jstrdata);
+  return std::shared_ptr<Column>(
+      new_string_column(nlevels, std::move(databuf), std::move(strbuf)));
+}
+
+
 static Column* column_from_jay(
     size_t nrows, const jay::Column* jcol, const MemoryRange& jaybuf)
 {
@@ -134,15 +485,49 @@ static Column* column_from_jay(
     case jay::Type_Float64: stype = SType::FLOAT64; break;
     case jay::Type_Str32:   stype = SType::STR32; break;
     case jay::Type_Str64:   stype = SType::STR64; break;
+    case jay::Type_Cat8:    stype = SType::CAT8; break;
+    case jay::Type_Cat16:   stype = SType::CAT16; break;
+    case jay::Type_Cat32:   stype = SType::CAT32; break;
+    case jay::Type_Date32:  stype = SType::DATE32; break;
+    case jay::Type_Date64:  stype = SType::DATE64; break;
+    case jay::Type_Time32:  stype = SType::TIME32; break;
+    case jay::Type_Dec16:   stype = SType::DEC16; break;
+    case jay::Type_Dec32:   stype = SType::DEC32; break;
+    case jay::Type_Dec64:   stype = SType::DEC64; break;
+  }
+  if (is_decimal(stype) &&
+      (jcol->scale() < 0 || jcol->scale() > decimal_max_scale(stype))) {
+    throw IOError() << "Invalid Jay file: decimal column `"
+        << jcol->name()->str() << "` has invalid scale " << int(jcol->scale());
+  }
+
+  std::shared_ptr<Column> levels;
+  if (is_categorical(stype)) {
+    levels = levels_from_jay(jcol, jaybuf);
   }
 
+  // Compressed columns have no `data` buffer, and must be assembled from
+  // their blocks. The uncompressed columns are mapped directly.
+  std::shared_ptr<ColumnBlocks> cb;
+  if (jcol->blocks()) {
+    cb = std::make_shared<ColumnBlocks>(extract_blocks(stype, jcol, jaybuf));
+    cb->levels = levels;
+  }
   Column* col = nullptr;
-  MemoryRange databuf = extract_buffer(jaybuf, jcol->data());
-  if (stype == SType::STR32 || stype == SType::STR64) {
-    MemoryRange strbuf = extract_buffer(jaybuf, jcol->strdata());
-    col = new_string_column(nrows, std::move(databuf), std::move(strbuf));
+  if (!jcol->data() && cb) {
+    col = column_from_blocks(*cb, jaybuf);
   } else {
-    col = Column::new_mbuf_column(stype, std::move(databuf));
+    MemoryRange databuf = extract_buffer(jaybuf, jcol->data());
+    if (stype == SType::STR32 || stype == SType::STR64) {
+      MemoryRange strbuf = extract_buffer(jaybuf, jcol->strdata());
+      col = new_string_column(nrows, std::move(databuf), std::move(strbuf));
+    } else if (levels) {
+      col = new_categorical_column(stype, std::move(databuf), levels);
+    } else if (is_decimal(stype)) {
+      col = new_decimal_column(stype, nrows, jcol->scale(), std::move(databuf));
+    } else {
+      col = Column::new_mbuf_column(stype, std::move(databuf));
+    }
   }
 
   Stats* stats = col->get_stats();
@@ -154,8 +539,16 @@ static Column* column_from_jay(
     case jay::Type_Int64:   initStats<int64_t, jay::StatsInt64>(stats, jcol); break;
     case jay::Type_Float32: initStats<float,   jay::StatsFloat32>(stats, jcol); break;
     case jay::Type_Float64: initStats<double,  jay::StatsFloat64>(stats, jcol); break;
+    case jay::Type_Date32:  initStats<int32_t, jay::StatsInt32>(stats, jcol); break;
+    case jay::Type_Date64:  initStats<int64_t, jay::StatsInt64>(stats, jcol); break;
+    case jay::Type_Time32:  initStats<int32_t, jay::StatsInt32>(stats, jcol); break;
+    case jay::Type_Dec16:   initStats<int16_t, jay::StatsInt16>(stats, jcol); break;
+    case jay::Type_Dec32:   initStats<int32_t, jay::StatsInt32>(stats, jcol); break;
+    case jay::Type_Dec64:   initStats<int64_t, jay::StatsInt64>(stats, jcol); break;
     default: break;
   }
+  initSketches(stats, jcol);
+  if (cb) attach_block_index(col, jcol, cb, jaybuf);
 
   return col;
 }
@@ -5,24 +5,68 @@
 //
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
+#include <algorithm>          // std::min
+#include <cstring>            // std::memcpy
+#include <unistd.h>           // pwrite
 #include "frame/py_frame.h"
 #include "jay/jay_generated.h"
+#include "parallel/api.h"
 #include "python/_all.h"
 #include "python/args.h"
 #include "python/string.h"
+#include "utils/array.h"
 #include "utils/assert.h"
+#include "utils/compress.h"
 #include "datatable.h"
 #include "writebuf.h"
 
 using WritableBufferPtr = std::unique_ptr<WritableBuffer>;
 static jay::Type stype_to_jaytype[DT_STYPES_COUNT];
+
+// String blocks do not have min/max stats
+struct NoStats {};
+
+// Parameters of saving a single column, shared by all columns in a frame.
+// When appending, `prev_nrows` is the number of rows already in the file.
+struct JayContext {
+  const JayOptions& options;
+  const Compressor* compressor;
+  jay::Codec codec;
+  size_t : 56;
+  flatbuffers::FlatBufferBuilder& fbb;
+  WritableBuffer* wb;
+  size_t prev_nrows;
+};
+
+using BlockVec = std::vector<flatbuffers::Offset<jay::Block>>;
+using ColumnVec = std::vector<flatbuffers::Offset<jay::Column>>;
+
+static std::unique_ptr<Compressor> make_compressor(
+    const JayOptions& options, jay::Codec* codec);
+static void write_meta(
+    flatbuffers::FlatBufferBuilder& fbb, WritableBuffer* wb, size_t nrows,
+    ColumnVec& msg_columns, size_t nkeys, const char* signature);
 static flatbuffers::Offset<jay::Column> column_to_jay(
-    Column* col, const std::string& name, flatbuffers::FlatBufferBuilder& fbb,
-    WritableBuffer* wb);
+    Column* col, const std::string& name, const JayContext& ctx,
+    const jay::Column* prev);
 static jay::Buffer saveMemoryRange(const MemoryRange*, WritableBuffer*);
+template <typename T, typename StatBuilder, bool STR>
+static void saveBlocks(
+    Column* col, jay::Stats jsttype, const jay::Buffer& saved_data,
+    const jay::Buffer& saved_strdata, const JayContext& ctx, BlockVec& out);
+static void copyBlocks(
+    const jay::Column* prev, size_t prev_nrows,
+    flatbuffers::FlatBufferBuilder& fbb, BlockVec& out);
 template <typename T, typename StatBuilder>
 static flatbuffers::Offset<void> saveStats(
     Stats* stats, flatbuffers::FlatBufferBuilder& fbb);
+template <typename T, typename StatBuilder>
+static flatbuffers::Offset<void> mergeStats(
+    Column* col, const jay::Column* prev, size_t prev_nrows,
+    jay::Stats jsttype, flatbuffers::FlatBufferBuilder& fbb);
+
+static flatbuffers::Offset<jay::QSketch> saveQSketch(
+    Stats* stats, flatbuffers::FlatBufferBuilder& fbb);
 
 
 //------------------------------------------------------------------------------
@@ -33,47 +77,193 @@ static flatbuffers::Offset<void> saveStats(
  * Save Frame in Jay format to the provided file.
  */
 void DataTable::save_jay(const std::string& path,
-                         WritableBuffer::Strategy wstrategy)
+                         WritableBuffer::Strategy wstrategy,
+                         const JayOptions& options)
 {
-  size_t sizehint = (wstrategy == WritableBuffer::Strategy::Auto)
+  if (options.append) {
+    append_jay_impl(path, options);
+    return;
+  }
+  size_t sizehint = (wstrategy == WritableBuffer::Strategy::Auto &&
+                     options.compression.empty())
                     ? memory_footprint() : 0;
   auto wb = WritableBuffer::create_target(path, sizehint, wstrategy);
-  save_jay_impl(wb.get());
+  save_jay_impl(wb.get(), options);
 }
 
 
 /**
  * Save Frame in Jay format to memory,
  */
-MemoryRange DataTable::save_jay() {
+MemoryRange DataTable::save_jay(const JayOptions& options) {
   auto wb = std::unique_ptr<MemoryWritableBuffer>(
                 new MemoryWritableBuffer(memory_footprint()));
-  save_jay_impl(wb.get());
+  save_jay_impl(wb.get(), options);
   return wb->get_mbuf();
 }
 
 
-void DataTable::save_jay_impl(WritableBuffer* wb) {
+/**
+ * Files with compressed columns use the "JAY2" signature: they cannot be
+ * read by the older versions of datatable, since their columns do not have
+ * the `data` buffers. Uncompressed files remain at "JAY1", and their
+ * per-block information is simply ignored by the older readers.
+ */
+void DataTable::save_jay_impl(WritableBuffer* wb, const JayOptions& options) {
   // Cannot store a view frame, so materialize first.
   materialize();
 
-  wb->write(8, "JAY1\0\0\0\0");
+  jay::Codec codec = jay::Codec_None;
+  std::unique_ptr<Compressor> compressor = make_compressor(options, &codec);
+  wb->write(4, compressor? "JAY2" : "JAY1");
+  wb->write(4, "\0\0\0\0");
 
   flatbuffers::FlatBufferBuilder fbb(1024);
+  JayContext ctx { options, compressor.get(), codec, fbb, wb, 0 };
 
-  std::vector<flatbuffers::Offset<jay::Column>> msg_columns;
+  ColumnVec msg_columns;
   for (size_t i = 0; i < ncols; ++i) {
     Column* col = columns[i];
     if (col->stype() == SType::OBJ) {
       DatatableWarning() << "Column `" << names[i]
           << "` of type obj64 was not saved";
     } else {
-      auto saved_col = column_to_jay(col, names[i], fbb, wb);
+      auto saved_col = column_to_jay(col, names[i], ctx, nullptr);
       msg_columns.push_back(saved_col);
     }
   }
-  xassert((wb->size() & 7) == 0);
+  write_meta(fbb, wb, nrows, msg_columns, nkeys, compressor? "2JAY" : "1JAY");
+  wb->finalize();
+}
+
+
+/**
+ * Append the rows of this frame to the existing Jay file `path`. The new
+ * rows are stored as additional blocks, which are written at the end of the
+ * file's data section (over the old meta record), followed by the new meta
+ * record and footer. The data already in the file is not rewritten. The new
+ * meta record lists the old blocks of each column followed by the new ones,
+ * so that the reader concatenates them when the file is opened.
+ *
+ * The frame must have the same column names and types as the frame stored
+ * in the file. Since the `data` buffers of the old columns no longer cover
+ * all rows, they are omitted from the new meta record, and the file gets the
+ * "JAY2" signature.
+ */
+void DataTable::append_jay_impl(const std::string& path,
+                                const JayOptions& options)
+{
+  materialize();
+
+  jay::Codec codec = jay::Codec_None;
+  std::unique_ptr<Compressor> compressor = make_compressor(options, &codec);
+
+  // The meta record has to be copied out, since the part of the file where
+  // it is stored will be overwritten.
+  size_t meta_offset = 0;
+  std::vector<uint8_t> prev_meta;
+  {
+    MemoryRange mbuf = MemoryRange::mmap(path);
+    read_jay_meta(mbuf, &meta_offset);
+    auto ptr = static_cast<const uint8_t*>(mbuf.rptr());
+    prev_meta.assign(ptr + meta_offset, ptr + mbuf.size() - 16);
+  }
+  const jay::Frame* prev = jay::GetFrame(prev_meta.data());
+  auto prev_columns = prev->columns();
+
+  std::vector<size_t> indices;
+  for (size_t i = 0; i < ncols; ++i) {
+    if (columns[i]->stype() == SType::OBJ) {
+      DatatableWarning() << "Column `" << names[i]
+          << "` of type obj64 was not saved";
+    } else {
+      indices.push_back(i);
+    }
+  }
+  if (prev->nkeys()) {
+    throw ValueError() << "Cannot append to a Jay file containing a keyed "
+        "frame";
+  }
+  if (indices.size() != prev_columns->size()) {
+    throw ValueError() << "Cannot append a frame with " << indices.size()
+        << " column" << (indices.size() == 1? "" : "s") << " to a Jay file "
+        "with " << prev_columns->size() << " column"
+        << (prev_columns->size() == 1? "" : "s");
+  }
+  for (size_t k = 0; k < indices.size(); ++k) {
+    size_t i = indices[k];
+    auto pcol = prev_columns->Get(static_cast<flatbuffers::uoffset_t>(k));
+    SType stype = columns[i]->stype();
+    if (pcol->name()->str() != names[i]) {
+      throw ValueError() << "Column " << k << " in the Jay file is named `"
+          << pcol->name()->str() << "`, whereas in the frame being appended "
+          "it is named `" << names[i] << "`";
+    }
+    if (is_categorical(stype)) {
+      throw ValueError() << "Column `" << names[i] << "` of stype " << stype
+          << " cannot be appended to a Jay file: categorical columns in "
+          "a Jay file have a single dictionary of levels";
+    }
+    if (pcol->type() != stype_to_jaytype[static_cast<int>(stype)]) {
+      throw ValueError() << "Column `" << names[i] << "` of stype " << stype
+          << " cannot be appended to a Jay file where this column has a "
+          "different type";
+    }
+    if (is_decimal(stype) && pcol->scale() != decimal_scale(columns[i])) {
+      throw ValueError() << "Column `" << names[i] << "` with scale "
+          << decimal_scale(columns[i]) << " cannot be appended to a Jay file "
+          "where this column has scale " << int(pcol->scale());
+    }
+  }
+
+  auto wb = std::unique_ptr<WritableBuffer>(
+                new FileWritableBuffer(path, meta_offset));
+  flatbuffers::FlatBufferBuilder fbb(1024);
+  JayContext ctx { options, compressor.get(), codec, fbb, wb.get(),
+                   prev->nrows() };
+
+  ColumnVec msg_columns;
+  for (size_t k = 0; k < indices.size(); ++k) {
+    size_t i = indices[k];
+    auto pcol = prev_columns->Get(static_cast<flatbuffers::uoffset_t>(k));
+    msg_columns.push_back(column_to_jay(columns[i], names[i], ctx, pcol));
+  }
+  write_meta(fbb, wb.get(), prev->nrows() + nrows, msg_columns, 0, "2JAY");
+  wb->finalize();
+  wb = nullptr;
+
+  File file(path, File::READWRITE);
+  if (::pwrite(file.descriptor(), "JAY2", 4, 0) != 4) {
+    throw IOError() << "Cannot write to file " << path << ": " << Errno;
+  }
+}
+
+
+static std::unique_ptr<Compressor> make_compressor(
+    const JayOptions& options, jay::Codec* codec)
+{
+  if (options.rowgroup_size == 0) {
+    throw ValueError() << "The size of a row group cannot be 0";
+  }
+  *codec = jay::Codec_None;
+  if (options.compression.empty()) return nullptr;
+  *codec = (options.compression == "lz4")?  jay::Codec_LZ4 :
+           (options.compression == "zstd")? jay::Codec_Zstd : jay::Codec_None;
+  if (*codec == jay::Codec_None) {
+    throw ValueError() << "Unsupported compression method `"
+        << options.compression << "` for a Jay file";
+  }
+  return Compressor::make(options.compression);
+}
 
+
+// Write the meta record (padded to a multiple of 8 bytes), followed by the
+// footer: the size of the meta record, and the signature.
+static void write_meta(
+    flatbuffers::FlatBufferBuilder& fbb, WritableBuffer* wb, size_t nrows,
+    ColumnVec& msg_columns, size_t nkeys, const char* signature)
+{
+  xassert((wb->size() & 7) == 0);
   auto frame = jay::CreateFrameDirect(fbb,
                   nrows,
                   msg_columns.size(),
@@ -90,8 +280,8 @@ void DataTable::save_jay_impl(WritableBuffer* wb) {
   }
 
   wb->write(8, &metaSize);
-  wb->write(8, "\0\0\0\0" "1JAY");
-  wb->finalize();
+  wb->write(4, "\0\0\0\0");
+  wb->write(4, signature);
 }
 
 
@@ -100,74 +290,440 @@ void DataTable::save_jay_impl(WritableBuffer* wb) {
 // Save a column
 //------------------------------------------------------------------------------
 
+/**
+ * Save column `col`. When appending, `prev` is the same column in the
+ * existing file: its blocks are retained, and the stats are combined.
+ */
 static flatbuffers::Offset<jay::Column> column_to_jay(
-    Column* col, const std::string& name, flatbuffers::FlatBufferBuilder& fbb,
-    WritableBuffer* wb)
+    Column* col, const std::string& name, const JayContext& ctx,
+    const jay::Column* prev)
 {
+  flatbuffers::FlatBufferBuilder& fbb = ctx.fbb;
+  SType stype = col->stype();
+  // Jay has no fixed-width string type: such columns are saved as str32,
+  // and are read back as regular string columns.
+  if (stype == SType::FSTR) {
+    std::unique_ptr<Column> strcol(col->cast(SType::STR32));
+    return column_to_jay(strcol.get(), name, ctx, prev);
+  }
+  bool isstr = (stype == SType::STR32 || stype == SType::STR64);
+
+  // Uncompressed columns are written as a whole (as in the original Jay
+  // format), and their blocks refer to the parts of these buffers.
+  jay::Buffer saved_data, saved_strdata;
+  if (!ctx.compressor) {
+    MemoryRange mbuf = col->data_buf();  // shallow copt of col's `mbuf`
+    saved_data = saveMemoryRange(&mbuf, ctx.wb);
+    if (stype == SType::STR32) {
+      MemoryRange sbuf = static_cast<StringColumn<uint32_t>*>(col)->str_buf();
+      saved_strdata = saveMemoryRange(&sbuf, ctx.wb);
+    }
+    if (stype == SType::STR64) {
+      MemoryRange sbuf = static_cast<StringColumn<uint64_t>*>(col)->str_buf();
+      saved_strdata = saveMemoryRange(&sbuf, ctx.wb);
+    }
+  }
+
   jay::Stats jsttype = jay::Stats_NONE;
   flatbuffers::Offset<void> jsto;
+  BlockVec blocks;
+  if (prev) copyBlocks(prev, ctx.prev_nrows, fbb, blocks);
   Stats* colstats = col->get_stats_if_exist();
-  switch (col->stype()) {
-    case SType::BOOL:
-      jsto = saveStats<int8_t,  jay::StatsBool>(colstats, fbb);
-      jsttype = jay::Stats_Bool;
+  #define SAVE(T, JSTATS, STR) \
+      jsttype = jay::Stats_##JSTATS; \
+      jsto = prev? mergeStats<T, jay::Stats##JSTATS>( \
+                       col, prev, ctx.prev_nrows, jsttype, fbb) \
+                 : saveStats<T, jay::Stats##JSTATS>(colstats, fbb); \
+      saveBlocks<T, jay::Stats##JSTATS, STR>( \
+          col, jsttype, saved_data, saved_strdata, ctx, blocks); \
       break;
-    case SType::INT8:
-      jsto = saveStats<int8_t,  jay::StatsInt8>(colstats, fbb);
-      jsttype = jay::Stats_Int8;
+  switch (stype) {
+    case SType::BOOL:    SAVE(int8_t,  Bool,    false)
+    case SType::INT8:    SAVE(int8_t,  Int8,    false)
+    case SType::INT16:   SAVE(int16_t, Int16,   false)
+    case SType::INT32:   SAVE(int32_t, Int32,   false)
+    case SType::INT64:   SAVE(int64_t, Int64,   false)
+    case SType::FLOAT32: SAVE(float,   Float32, false)
+    case SType::FLOAT64: SAVE(double,  Float64, false)
+    case SType::DATE64:  SAVE(int64_t, Int64,   false)
+    case SType::TIME32:  SAVE(int32_t, Int32,   false)
+    case SType::DATE32:  SAVE(int32_t, Int32,   false)
+    case SType::DEC16:   SAVE(int16_t, Int16,   false)
+    case SType::DEC32:   SAVE(int32_t, Int32,   false)
+    case SType::DEC64:   SAVE(int64_t, Int64,   false)
+    case SType::STR32:
+      saveBlocks<uint32_t, NoStats, true>(
+          col, jay::Stats_NONE, saved_data, saved_strdata, ctx, blocks);
       break;
-    case SType::INT16:
-      jsto = saveStats<int16_t, jay::StatsInt16>(colstats, fbb);
-      jsttype = jay::Stats_Int16;
+    case SType::STR64:
+      saveBlocks<uint64_t, NoStats, true>(
+          col, jay::Stats_NONE, saved_data, saved_strdata, ctx, blocks);
       break;
-    case SType::INT32:
-      jsto = saveStats<int32_t, jay::StatsInt32>(colstats, fbb);
-      jsttype = jay::Stats_Int32;
+    case SType::CAT8:
+      saveBlocks<uint8_t, NoStats, false>(
+          col, jay::Stats_NONE, saved_data, saved_strdata, ctx, blocks);
       break;
-    case SType::INT64:
-      jsto = saveStats<int64_t, jay::StatsInt64>(colstats, fbb);
-      jsttype = jay::Stats_Int64;
+    case SType::CAT16:
+      saveBlocks<uint16_t, NoStats, false>(
+          col, jay::Stats_NONE, saved_data, saved_strdata, ctx, blocks);
       break;
-    case SType::FLOAT32:
-      jsto = saveStats<float,   jay::StatsFloat32>(colstats, fbb);
-      jsttype = jay::Stats_Float32;
-      break;
-    case SType::FLOAT64:
-      jsto = saveStats<double,  jay::StatsFloat64>(colstats, fbb);
-      jsttype = jay::Stats_Float64;
+    case SType::CAT32:
+      saveBlocks<uint32_t, NoStats, false>(
+          col, jay::Stats_NONE, saved_data, saved_strdata, ctx, blocks);
       break;
     default: break;
   }
+  #undef SAVE
+
+  // The levels of a categorical column are small, and are always saved
+  // uncompressed, as a whole.
+  jay::Buffer saved_levels, saved_levels_strdata;
+  SType levels_stype = SType::VOID;
+  if (is_categorical(stype)) {
+    Column* levels = categorical_levels(col).get();
+    levels_stype = levels->stype();
+    MemoryRange lbuf = levels->data_buf();
+    MemoryRange sbuf = (levels_stype == SType::STR32)
+        ? static_cast<StringColumn<uint32_t>*>(levels)->str_buf()
+        : static_cast<StringColumn<uint64_t>*>(levels)->str_buf();
+    saved_levels = saveMemoryRange(&lbuf, ctx.wb);
+    saved_levels_strdata = saveMemoryRange(&sbuf, ctx.wb);
+  }
 
   auto sname = fbb.CreateString(name.c_str());
+  // The approximate stats cannot be combined with those of the previous rows
+  auto jqsketch = prev? 0 : saveQSketch(colstats, fbb);
+  auto jblocks = fbb.CreateVector(blocks);
+  uint64_t nullcount = static_cast<uint64_t>(col->countna());
+  if (prev) nullcount += prev->nullcount();
 
   jay::ColumnBuilder cbb(fbb);
-  cbb.add_type(stype_to_jaytype[static_cast<int>(col->stype())]);
+  cbb.add_type(stype_to_jaytype[static_cast<int>(stype)]);
   cbb.add_name(sname);
-  cbb.add_nullcount(static_cast<uint64_t>(col->countna()));
-
-  MemoryRange mbuf = col->data_buf();  // shallow copt of col's `mbuf`
-  jay::Buffer saved_mbuf = saveMemoryRange(&mbuf, wb);
-  cbb.add_data(&saved_mbuf);
+  cbb.add_nullcount(nullcount);
+  if (!prev && colstats && colstats->is_computed(Stat::NUniqueApprox)) {
+    cbb.add_nunique_approx(static_cast<int64_t>(colstats->nunique_approx(col)));
+  }
+  cbb.add_qsketch(jqsketch);
+  cbb.add_blocks(jblocks);
+
+  // When appending, the column's data is split between several places in
+  // the file, and can only be described by the blocks.
+  if (!ctx.compressor && !prev) {
+    cbb.add_data(&saved_data);
+    if (isstr) cbb.add_strdata(&saved_strdata);
+  }
+  if (levels_stype != SType::VOID) {
+    cbb.add_levels(&saved_levels);
+    cbb.add_levels_strdata(&saved_levels_strdata);
+    cbb.add_levels_type(stype_to_jaytype[static_cast<int>(levels_stype)]);
+  }
+  if (is_decimal(stype)) {
+    cbb.add_scale(static_cast<int8_t>(decimal_scale(col)));
+  }
   if (jsttype != jay::Stats_NONE) {
     cbb.add_stats_type(jsttype);
     cbb.add_stats(jsto);
   }
 
-  if (col->stype() == SType::STR32) {
-    auto scol = static_cast<StringColumn<uint32_t>*>(col);
-    MemoryRange sbuf = scol->str_buf();
-    jay::Buffer saved_strbuf = saveMemoryRange(&sbuf, wb);
-    cbb.add_strdata(&saved_strbuf);
+  return cbb.Finish();
+}
+
+
+
+//------------------------------------------------------------------------------
+// Save column blocks
+//------------------------------------------------------------------------------
+
+/**
+ * Information about a single block of a column, collected while the block
+ * is being saved. For string columns `T` is the type of the offsets, and
+ * the min/max stats are not computed.
+ */
+template <typename T>
+struct BlockInfo {
+  size_t nrows;
+  size_t nullcount;
+  T min;
+  T max;
+  jay::Buffer data;
+  jay::Buffer strdata;
+  size_t data_size;
+  size_t strdata_size;
+  jay::Codec codec;
+  size_t : 56;
+};
+
+
+template <typename T>
+static void computeBlockStats(const T* data, size_t n, BlockInfo<T>& info) {
+  size_t countna = 0;
+  T min = GETNA<T>(), max = GETNA<T>();
+  bool empty = true;
+  for (size_t i = 0; i < n; ++i) {
+    T x = data[i];
+    if (ISNA<T>(x)) {
+      countna++;
+    } else if (empty) {
+      min = max = x;
+      empty = false;
+    } else {
+      if (x < min) min = x;
+      if (x > max) max = x;
+    }
+  }
+  info.nullcount = countna;
+  info.min = min;
+  info.max = max;
+}
+
+
+template <typename T>
+static flatbuffers::Offset<void> saveBlockStats(
+    flatbuffers::FlatBufferBuilder&, const BlockInfo<T>&, NoStats*)
+{
+  return 0;
+}
+
+template <typename T, typename StatBuilder>
+static flatbuffers::Offset<void> saveBlockStats(
+    flatbuffers::FlatBufferBuilder& fbb, const BlockInfo<T>& info,
+    StatBuilder*)
+{
+  return fbb.CreateStruct(StatBuilder(info.min, info.max)).Union();
+}
+
+
+/**
+ * Location of the data for rows `[row0, row1)` within the column's buffers
+ * (and the offsets of those regions from the start of the buffers).
+ */
+struct BlockSlice {
+  const char* data;
+  const char* strdata;
+  size_t data_size;
+  size_t strdata_size;
+  size_t data_offset;
+  size_t strdata_offset;
+};
+
+
+template <typename T>
+static BlockSlice sliceBlock(Column* col, size_t row0, size_t row1,
+                             BlockInfo<T>& info, std::false_type)
+{
+  const T* data = static_cast<const T*>(col->data());
+  computeBlockStats<T>(data + row0, row1 - row0, info);
+  return BlockSlice {
+    reinterpret_cast<const char*>(data + row0), nullptr,
+    (row1 - row0) * sizeof(T), 0,
+    row0 * sizeof(T), 0
+  };
+}
+
+
+// The offsets array of a string column has `nrows + 1` elements, the first
+// of which is 0. The block includes the entries `row0` to `row1` inclusive.
+template <typename T>
+static BlockSlice sliceBlock(Column* col, size_t row0, size_t row1,
+                             BlockInfo<T>& info, std::true_type)
+{
+  constexpr T NA = GETNA<T>();
+  const T* offs = static_cast<const T*>(col->data());
+  const char* strdata = static_cast<const char*>(
+      static_cast<StringColumn<T>*>(col)->str_buf().rptr());
+  size_t start = static_cast<size_t>(offs[row0] & ~NA);
+  size_t end = static_cast<size_t>(offs[row1] & ~NA);
+  size_t countna = 0;
+  for (size_t j = row0 + 1; j <= row1; ++j) {
+    countna += ISNA<T>(offs[j]);
+  }
+  info.nullcount = countna;
+  info.min = info.max = 0;
+  return BlockSlice {
+    reinterpret_cast<const char*>(offs + row0), strdata + start,
+    (row1 - row0 + 1) * sizeof(T), end - start,
+    row0 * sizeof(T), start
+  };
+}
+
+
+static size_t aligned8(size_t n) {
+  return (n + 7) & ~size_t(7);
+}
+
+
+/**
+ * Split the column into blocks of `ctx.options.rowgroup_size` rows, and
+ * save each block. In a string column each block stores `nrows + 1` entries
+ * of the offsets array (i.e. the offsets of the block's strings relative to
+ * the offset in the first entry), plus the portion of the character data
+ * spanned by those offsets.
+ *
+ * Uncompressed blocks are just references into the buffers `saved_data` and
+ * `saved_strdata` that were already written. Otherwise each block is
+ * compressed independently (in parallel), and the compressed buffers are
+ * written in order. If compression does not reduce the size of a block, that
+ * block is stored uncompressed.
+ *
+ * The block's stats and the nullcount are computed here too.
+ */
+template <typename T, typename StatBuilder, bool STR>
+static void saveBlocks(
+    Column* col, jay::Stats jsttype, const jay::Buffer& saved_data,
+    const jay::Buffer& saved_strdata, const JayContext& ctx, BlockVec& out)
+{
+  const size_t nrows = col->nrows;
+  const size_t rgsize = ctx.options.rowgroup_size;
+  const size_t nblocks = (nrows + rgsize - 1) / rgsize;
+  std::vector<BlockInfo<T>> infos(nblocks);
+  const Compressor* compressor = ctx.compressor;
+  WritableBuffer* wb = ctx.wb;
+
+  dt::parallel_for_ordered(
+    /* n_iterations = */ nblocks,
+    /* n_threads = */ std::min(nblocks, dt::num_threads_in_pool()),
+    [&](dt::ordered* o) {
+      dt::array<char> zbuf;
+      size_t zsize = 0;
+      size_t write_at = 0;
+      o->parallel(
+        [&](size_t i) {  // pre-ordered
+          BlockInfo<T>& info = infos[i];
+          size_t row0 = i * rgsize;
+          size_t row1 = std::min(row0 + rgsize, nrows);
+          info.nrows = row1 - row0;
+          info.codec = jay::Codec_None;
+
+          BlockSlice sl = sliceBlock(col, row0, row1, info,
+                                     std::integral_constant<bool, STR>());
+          const char* dptr = sl.data;
+          const char* sptr = sl.strdata;
+          size_t dsize = sl.data_size;
+          size_t ssize = sl.strdata_size;
+          info.data_size = dsize;
+          info.strdata_size = ssize;
+
+          zsize = 0;
+          if (!compressor) {
+            info.data = jay::Buffer(saved_data.offset() + sl.data_offset,
+                                    dsize);
+            if (STR) {
+              info.strdata = jay::Buffer(
+                  saved_strdata.offset() + sl.strdata_offset, ssize);
+            }
+            return;
+          }
+          // Compressed data of the block: the data buffer followed by the
+          // strdata buffer, each padded to a multiple of 8 bytes.
+          size_t dcap = compressor->max_compressed_size(dsize);
+          size_t scap = STR? compressor->max_compressed_size(ssize) : 0;
+          zbuf.ensuresize(aligned8(dcap) + aligned8(scap) +
+                          aligned8(dsize) + aligned8(ssize));
+          char* zptr = zbuf.data();
+          size_t dz = compressor->compress(dptr, dsize, zptr, dcap);
+          size_t sz = STR? compressor->compress(sptr, ssize, zptr + aligned8(dz),
+                                                scap) : 0;
+          if (dz + sz < dsize + ssize) {
+            info.codec = ctx.codec;
+          } else {
+            dz = dsize;
+            sz = ssize;
+            std::memcpy(zptr, dptr, dsize);
+            if (STR) std::memcpy(zptr + aligned8(dz), sptr, ssize);
+          }
+          std::memset(zptr + dz, 0, aligned8(dz) - dz);
+          std::memset(zptr + aligned8(dz) + sz, 0, aligned8(sz) - sz);
+          info.data = jay::Buffer(0, dz);
+          info.strdata = jay::Buffer(aligned8(dz), sz);
+          zsize = aligned8(dz) + aligned8(sz);
+        },
+
+        [&](size_t i) {  // ordered
+          if (!zsize) return;
+          write_at = wb->prep_write(zsize, zbuf.data());
+          xassert(write_at >= 8 && (write_at & 7) == 0);
+          BlockInfo<T>& info = infos[i];
+          info.data = jay::Buffer(write_at - 8 + info.data.offset(),
+                                  info.data.length());
+          info.strdata = jay::Buffer(write_at - 8 + info.strdata.offset(),
+                                     info.strdata.length());
+        },
+
+        [&](size_t) {  // post-ordered
+          if (!zsize) return;
+          wb->write_at(write_at, zsize, zbuf.data());
+        }
+      );
+    });
+
+  for (const BlockInfo<T>& info : infos) {
+    // A block where all values are NA has no stats
+    bool hasstats = (jsttype != jay::Stats_NONE && info.nullcount < info.nrows);
+    flatbuffers::Offset<void> jsto;
+    if (hasstats) {
+      jsto = saveBlockStats(ctx.fbb, info, static_cast<StatBuilder*>(nullptr));
+    }
+    out.push_back(jay::CreateBlock(ctx.fbb,
+        info.nrows, info.codec, &info.data, STR? &info.strdata : nullptr,
+        info.data_size, info.strdata_size, info.nullcount,
+        hasstats? jsttype : jay::Stats_NONE, jsto));
   }
-  if (col->stype() == SType::STR64) {
-    auto scol = static_cast<StringColumn<uint64_t>*>(col);
-    MemoryRange sbuf = scol->str_buf();
-    jay::Buffer saved_strbuf = saveMemoryRange(&sbuf, wb);
-    cbb.add_strdata(&saved_strbuf);
+}
+
+
+static flatbuffers::Offset<void> copyStats(
+    flatbuffers::FlatBufferBuilder& fbb, jay::Stats jsttype, const void* jsto)
+{
+  if (!jsto) return 0;
+  #define COPY(JSTATS) \
+      return fbb.CreateStruct(*static_cast<const jay::JSTATS*>(jsto)).Union();
+  switch (jsttype) {
+    case jay::Stats_Bool:    COPY(StatsBool)
+    case jay::Stats_Int8:    COPY(StatsInt8)
+    case jay::Stats_Int16:   COPY(StatsInt16)
+    case jay::Stats_Int32:   COPY(StatsInt32)
+    case jay::Stats_Int64:   COPY(StatsInt64)
+    case jay::Stats_Float32: COPY(StatsFloat32)
+    case jay::Stats_Float64: COPY(StatsFloat64)
+    default: return 0;
   }
+  #undef COPY
+}
 
-  return cbb.Finish();
+
+/**
+ * Re-create the blocks of column `prev` from an existing file in the new
+ * meta record. Their buffers remain in place. Files written by the older
+ * versions of datatable have no blocks: such a column is described by a
+ * single uncompressed block spanning its `data` / `strdata` buffers.
+ */
+static void copyBlocks(
+    const jay::Column* prev, size_t prev_nrows,
+    flatbuffers::FlatBufferBuilder& fbb, BlockVec& out)
+{
+  if (prev->blocks()) {
+    for (const jay::Block* b : *prev->blocks()) {
+      auto jsto = copyStats(fbb, b->stats_type(), b->stats());
+      out.push_back(jay::CreateBlock(fbb,
+          b->nrows(), b->codec(), b->data(), b->strdata(), b->data_size(),
+          b->strdata_size(), b->nullcount(),
+          jsto.IsNull()? jay::Stats_NONE : b->stats_type(), jsto));
+    }
+  }
+  else if (prev_nrows) {
+    const jay::Buffer* data = prev->data();
+    const jay::Buffer* strdata = prev->strdata();
+    if (!data) {
+      throw IOError() << "Invalid Jay file: column `" << prev->name()->str()
+          << "` has no data";
+    }
+    auto jsto = copyStats(fbb, prev->stats_type(), prev->stats());
+    out.push_back(jay::CreateBlock(fbb,
+        prev_nrows, jay::Codec_None, data, strdata, data->length(),
+        strdata? strdata->length() : 0, prev->nullcount(),
+        jsto.IsNull()? jay::Stats_NONE : prev->stats_type(), jsto));
+  }
 }
 
 
@@ -210,6 +766,50 @@ static flatbuffers::Offset<void> saveStats(
 }
 
 
+/**
+ * Min/max stats of the column after appending the rows of `col` to the
+ * column `prev` with `prev_nrows` rows. The result has no stats if they are
+ * not known for `prev`.
+ */
+template <typename T, typename StatBuilder>
+static flatbuffers::Offset<void> mergeStats(
+    Column* col, const jay::Column* prev, size_t prev_nrows,
+    jay::Stats jsttype, flatbuffers::FlatBufferBuilder& fbb)
+{
+  T min = GETNA<T>(), max = GETNA<T>();
+  if (prev->nullcount() < prev_nrows) {
+    if (prev->stats_type() != jsttype || !prev->stats()) return 0;
+    auto jstats = static_cast<const StatBuilder*>(prev->stats());
+    min = jstats->min();
+    max = jstats->max();
+  }
+  if (col->countna() < col->nrows) {
+    auto nstat = static_cast<NumericalStats<T>*>(col->get_stats());
+    T cmin = nstat->min(col);
+    T cmax = nstat->max(col);
+    if (ISNA<T>(min) || cmin < min) min = cmin;
+    if (ISNA<T>(max) || cmax > max) max = cmax;
+  }
+  if (ISNA<T>(min)) return 0;
+  return fbb.CreateStruct(StatBuilder(min, max)).Union();
+}
+
+
+static flatbuffers::Offset<jay::QSketch> saveQSketch(
+    Stats* stats, flatbuffers::FlatBufferBuilder& fbb)
+{
+  dt::TDigest* sketch = stats? stats->get_qsketch() : nullptr;
+  if (!sketch) return 0;
+  std::vector<double> means, weights;
+  for (const auto& c : sketch->get_centroids()) {
+    means.push_back(c.mean);
+    weights.push_back(c.weight);
+  }
+  return jay::CreateQSketchDirect(fbb, &means, &weights,
+                                  sketch->get_min(), sketch->get_max());
+}
+
+
 
 //------------------------------------------------------------------------------
 // py::Frame interface
@@ -218,9 +818,11 @@ namespace py {
 
 
 static PKArgs args_to_jay(
-  1, 0, 1, false, false, {"path", "_strategy"}, "to_jay",
+  1, 0, 4, false, false,
+  {"path", "compression", "rowgroup_size", "append", "_strategy"}, "to_jay",
 
-R"(to_jay(self, path, _strategy='auto')
+R"(to_jay(self, path, compression=None, rowgroup_size=65536,
+       append=False, _strategy='auto')
 --
 
 Save this frame to a binary file on disk, in .jay format.
@@ -234,6 +836,28 @@ path: str
     If this argument is omitted, the file will be created in memory
     instead, and returned as a `bytes` object.
 
+compression: None | "lz4" | "zstd"
+    Compress the data with the given method. Each column is split into
+    blocks (one per row group), which are compressed independently.
+    When the file is opened, each column is decompressed on first
+    access. Compressed files cannot be read by the versions of datatable
+    older than 0.9.0.
+
+    The compression libraries are loaded at runtime: "lz4" requires
+    liblz4, and "zstd" requires libzstd.
+
+rowgroup_size: int
+    The number of rows in each row group. Each column stores the min,
+    max and the number of NAs within every row group.
+
+append: bool
+    If True and the file `path` already exists, then the rows of this
+    frame are added to the end of the frame stored in that file. The
+    new rows are written as additional row groups, and the existing
+    data is not rewritten. This frame must have the same column names
+    and stypes as the frame in the file. After appending, the file can
+    no longer be read by the versions of datatable older than 0.9.0.
+
 _strategy: 'mmap' | 'write' | 'auto'
     Which method to use for writing the file to disk. The "write"
     method is more portable across different operating systems, but
@@ -252,8 +876,40 @@ oobj Frame::to_jay(const PKArgs& args) {
   path = oobj::import("os", "path", "expanduser").call({path});
   std::string filename = path.to_string();
 
+  JayOptions options;
+
+  // compression
+  oobj compression = args[1].to<oobj>(None());
+  if (!compression.is_none()) {
+    if (!compression.is_string()) {
+      throw TypeError() << "Parameter `compression` in Frame.to_jay() should "
+          "be a string, instead got " << compression.typeobj();
+    }
+    options.compression = compression.to_string();
+  }
+
+  // rowgroup_size
+  if (!args[2].is_none_or_undefined()) {
+    options.rowgroup_size = args[2].to_size_t();
+    if (options.rowgroup_size == 0) {
+      throw ValueError() << "Parameter `rowgroup_size` in Frame.to_jay() "
+          "should be positive";
+    }
+  }
+
+  // append
+  bool append = args[3].to<bool>(false);
+  if (append) {
+    if (filename.empty()) {
+      throw ValueError() << "Parameter `append` in Frame.to_jay() cannot be "
+          "used when the `path` is not given";
+    }
+    options.append = oobj::import("os", "path", "exists").call({path})
+                     .to_bool_strict();
+  }
+
   // _strategy
-  auto strategy = args[1].to<std::string>("auto");
+  auto strategy = args[4].to<std::string>("auto");
   auto sstrategy = (strategy == "mmap")  ? WritableBuffer::Strategy::Mmap :
                    (strategy == "write") ? WritableBuffer::Strategy::Write :
                    (strategy == "auto")  ? WritableBuffer::Strategy::Auto :
@@ -264,13 +920,13 @@ oobj Frame::to_jay(const PKArgs& args) {
   }
 
   if (filename.empty()) {
-    MemoryRange mr = dt->save_jay();
+    MemoryRange mr = dt->save_jay(options);
     auto data = static_cast<const char*>(mr.xptr());
     auto size = static_cast<Py_ssize_t>(mr.size());
     return oobj::from_new_reference(PyBytes_FromStringAndSize(data, size));
   }
   else {
-    dt->save_jay(filename, sstrategy);
+    dt->save_jay(filename, sstrategy, options);
     return None();
   }
 }
@@ -289,6 +945,16 @@ void Frame::Type::_init_jay(Methods& mm) {
   stype_to_jaytype[int(SType::FLOAT64)] = jay::Type_Float64;
   stype_to_jaytype[int(SType::STR32)]   = jay::Type_Str32;
   stype_to_jaytype[int(SType::STR64)]   = jay::Type_Str64;
+  stype_to_jaytype[int(SType::FSTR)]    = jay::Type_Str32;
+  stype_to_jaytype[int(SType::CAT8)]    = jay::Type_Cat8;
+  stype_to_jaytype[int(SType::CAT16)]   = jay::Type_Cat16;
+  stype_to_jaytype[int(SType::CAT32)]   = jay::Type_Cat32;
+  stype_to_jaytype[int(SType::DATE64)]  = jay::Type_Date64;
+  stype_to_jaytype[int(SType::TIME32)]  = jay::Type_Time32;
+  stype_to_jaytype[int(SType::DATE32)]  = jay::Type_Date32;
+  stype_to_jaytype[int(SType::DEC16)]   = jay::Type_Dec16;
+  stype_to_jaytype[int(SType::DEC32)]   = jay::Type_Dec32;
+  stype_to_jaytype[int(SType::DEC64)]   = jay::Type_Dec64;
 }
 
 
@@ -6,6 +6,7 @@
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
 #include <algorithm>           // std::min
+#include <atomic>              // std::atomic
 #include <cerrno>              // errno
 #include <mutex>               // std::mutex, std::lock_guard
 #ifndef _WIN32
@@ -70,10 +71,12 @@
   class ExternalMRI : public BaseMRI {
     private:
       Py_buffer* pybufinfo;
+      std::shared_ptr<void> owner;
 
     public:
       ExternalMRI(size_t n, const void* ptr);
       ExternalMRI(size_t n, const void* ptr, Py_buffer* pybuf);
+      ExternalMRI(size_t n, const void* ptr, std::shared_ptr<void> owner);
       explicit ExternalMRI(const char* str);
       ~ExternalMRI() override;
 
@@ -108,15 +111,22 @@
   //    views onto the original MemoryRange object, and the original `impl` can
   //    be restored.
   //
-  class ViewMRI : public BaseMRI {
+  // A view onto a read-only memory-mapped file is a `BudgetedRange`: its
+  // pages may be released when the `memory.mmap_budget` is exceeded.
+  //
+  class ViewMRI : public BaseMRI, BudgetedRange {
     private:
       size_t offset;
       ViewedMRI* base;
+      bool budgeted;
+      size_t : 56;
 
     public:
       ViewMRI(size_t n, const MemoryRange& src, size_t offset);
       virtual ~ViewMRI() override;
 
+      void* ptr() const override;
+      void release_pages() override;
       void resize(size_t n) override;
       size_t memory_footprint() const override;
       const char* name() const override { return "view"; }
@@ -136,6 +146,7 @@
       void release();
 
       bool is_writable() const;
+      bool is_readonly_mmap() const;
       size_t memory_footprint() const override;
       const char* name() const override { return "viewed"; }
 
@@ -174,6 +185,31 @@
   };
 
 
+  // LazyMRI is a memory buffer whose content is produced by the `loader`
+  // function when the data is requested for the first time (similar to how
+  // MmapMRI maps the file only when its data is accessed). Until then, the
+  // buffer is not allocated.
+  class LazyMRI : public BaseMRI {
+    private:
+      std::function<void(void*)> loader;
+      std::mutex mutex;
+      std::atomic<bool> loaded;
+      size_t : 56;
+
+    public:
+      LazyMRI(size_t n, std::function<void(void*)> loader);
+      ~LazyMRI() override;
+
+      void* ptr() const override;
+      size_t memory_footprint() const override;
+      const char* name() const override { return "lazy"; }
+      void verify_integrity() const override;
+
+    private:
+      void load();
+  };
+
+
   class OvermapMRI : public MmapMRI {
     private:
       void* xbuf;
@@ -224,6 +260,11 @@
     return MemoryRange(new ExternalMRI(n, ptr, pb));
   }
 
+  MemoryRange MemoryRange::external(const void* ptr, size_t n,
+                                    std::shared_ptr<void> owner) {
+    return MemoryRange(new ExternalMRI(n, ptr, std::move(owner)));
+  }
+
   MemoryRange MemoryRange::view(const MemoryRange& src, size_t n, size_t offset) {
     return MemoryRange(new ViewMRI(n, src, offset));
   }
@@ -236,6 +277,10 @@
     return MemoryRange(new MmapMRI(n, path, fd));
   }
 
+  MemoryRange MemoryRange::lazy(size_t n, std::function<void(void*)> loader) {
+    return MemoryRange(new LazyMRI(n, std::move(loader)));
+  }
+
   MemoryRange MemoryRange::overmap(const std::string& path, size_t extra_n,
                                    int fd)
   {
@@ -582,6 +627,13 @@
   ExternalMRI::ExternalMRI(const char* str)
       : ExternalMRI(strlen(str) + 1, str, nullptr) {}
 
+  ExternalMRI::ExternalMRI(size_t n, const void* ptr,
+                           std::shared_ptr<void> o)
+    : ExternalMRI(n, ptr, nullptr)
+  {
+    owner = std::move(o);
+  }
+
   ExternalMRI::~ExternalMRI() {
     // If the buffer contained pyobjects, leave them as-is and do not attempt
     // to DECREF (this is up to the external owner).
@@ -616,10 +668,12 @@
     resizable = false;
     writable = base->is_writable();
     pyobjects = src.is_pyobjects();
+    budgeted = base->is_readonly_mmap() && n > 0;
     TRACK(this, sizeof(*this), "ViewMRI");
   }
 
   ViewMRI::~ViewMRI() {
+    if (budgeted) MemoryMapManager::get()->forget(this);
     base->release();
     pyobjects = false;
     UNTRACK(this);
@@ -629,6 +683,27 @@
     return sizeof(ViewMRI) + bufsize;
   }
 
+  void* ViewMRI::ptr() const {
+    if (budgeted) {
+      MemoryMapManager::get()->touch(const_cast<ViewMRI*>(this), bufsize);
+    }
+    return bufdata;
+  }
+
+  // The view's data is a part of a private read-only file mapping, thus
+  // dropping its pages is safe: they will be re-read from the file on the
+  // next access. The range is extended to the page boundaries (the pages
+  // shared with the neighbouring views are also backed by the file).
+  void ViewMRI::release_pages() {
+    #ifndef _WIN32
+      size_t pagesize = static_cast<size_t>(sysconf(_SC_PAGE_SIZE));
+      size_t start = reinterpret_cast<size_t>(bufdata);
+      size_t end = start + bufsize;
+      start -= start % pagesize;
+      madvise(reinterpret_cast<void*>(start), end - start, MADV_DONTNEED);
+    #endif
+  }
+
   void ViewMRI::resize(size_t) {
     throw RuntimeError() << "ViewMRI cannot be resized";
   }
@@ -694,6 +769,11 @@
     return original_impl->writable;
   }
 
+  bool ViewedMRI::is_readonly_mmap() const {
+    return !original_impl->writable &&
+           dynamic_cast<MmapMRI*>(original_impl) != nullptr;
+  }
+
   size_t ViewedMRI::memory_footprint() const {
     return 0;
   }
@@ -1017,6 +1097,68 @@
 
 
 
+//==============================================================================
+// LazyMRI
+//==============================================================================
+
+  LazyMRI::LazyMRI(size_t n, std::function<void(void*)> f)
+    : loader(std::move(f)), loaded(false)
+  {
+    bufsize = n;
+    resizable = false;
+    TRACK(this, sizeof(*this), "LazyMRI");
+  }
+
+  LazyMRI::~LazyMRI() {
+    clear_pyobjects();
+    dt::free(bufdata);
+    UNTRACK(this);
+  }
+
+  void* LazyMRI::ptr() const {
+    const_cast<LazyMRI*>(this)->load();
+    return bufdata;
+  }
+
+  // Multiple threads may request the data at the same time: only the first
+  // of them runs the loader, while the others wait for it to finish. If the
+  // loader throws an exception, the buffer remains unloaded. Once the buffer
+  // is loaded, the flag `loaded` is checked without taking the lock: the
+  // release store below makes `bufdata` (and the content of the buffer)
+  // visible to any thread that reads `loaded == true` with acquire ordering.
+  void LazyMRI::load() {
+    if (loaded.load(std::memory_order_acquire)) return;
+    std::lock_guard<std::mutex> _(mutex);
+    if (loaded.load(std::memory_order_relaxed)) return;
+    void* buf = dt::malloc<void>(bufsize);
+    try {
+      loader(buf);
+    } catch (...) {
+      dt::free(buf);
+      throw;
+    }
+    bufdata = buf;
+    loader = nullptr;  // release any resources held by the loader
+    loaded.store(true, std::memory_order_release);
+  }
+
+  size_t LazyMRI::memory_footprint() const {
+    return sizeof(LazyMRI) +
+           (loaded.load(std::memory_order_acquire)? bufsize : 0);
+  }
+
+  void LazyMRI::verify_integrity() const {
+    if (loaded.load(std::memory_order_acquire)) {
+      BaseMRI::verify_integrity();
+    } else if (bufdata) {
+      throw AssertionError()
+          << "Lazy MemoryRange is not loaded but its data pointer is "
+          << bufdata;
+    }
+  }
+
+
+
 //==============================================================================
 // Template instantiations
 //==============================================================================
@@ -8,7 +8,8 @@
 #ifndef dt_MEMRANGE_h
 #define dt_MEMRANGE_h
 #include <cstdint>
-#include <memory>             // std::unique_ptr
+#include <functional>         // std::function
+#include <memory>             // std::unique_ptr, std::shared_ptr
 #include <string>             // std::string
 #include <type_traits>        // std::is_same
 #include <Python.h>
@@ -38,7 +39,8 @@ class ViewedMRI;
  *   - memory owned by an external source (ExternalMRI);
  *   - view onto another MemoryRange (ViewMRI);
  *   - MemoryRange that is currently being "viewed" (ViewedMRI);
- *   - memory-mapped file (MmapMRI).
+ *   - memory-mapped file (MmapMRI);
+ *   - data that is loaded upon first access (LazyMRI).
  * This 2-tiered structure allows us to replace the internal `BaseMRI` object
  * with another implementation, if needed -- without having to modify any of
  * the user-facing `MemoryRange` objects.
@@ -111,6 +113,15 @@ class MemoryRange
     //   interface. The MemoryRange object created in this way is neither
     //   writeable nor resizeable.
     //
+    // MemoryRange::external(ptr, n, owner)
+    //   Similar to the previous, but the lifetime of the memory buffer is
+    //   guarded by an arbitrary `owner` object: the MemoryRange keeps a
+    //   shared reference to it, and the owner is destroyed when the last
+    //   MemoryRange referencing it goes away. This is used, for example, to
+    //   hold the buffers imported via the Arrow C Data Interface, where a
+    //   single "release" callback frees all buffers of an array at once.
+    //   The MemoryRange object is neither writeable nor resizeable.
+    //
     // MemoryRange::view(src, n, offset)
     //   Create MemoryRange as a "view" onto another MemoryRange `src`. The
     //   view is positioned at `offset` from the beginning of `src`s buffer,
@@ -122,6 +133,13 @@ class MemoryRange
     // MemoryRange::mmap(path, n, [fd])
     //   Create a file of size `n` at `path`, and then memory-map it.
     //
+    // MemoryRange::lazy(n, loader)
+    //   Create MemoryRange of size `n` whose content is not available until
+    //   the data is accessed for the first time. At that moment a buffer of
+    //   size `n` is allocated, and `loader` is called to fill it. This is
+    //   used, for example, for the compressed columns in Jay files, which are
+    //   decompressed only when needed.
+    //
     // MemoryRange::overmap(path, nextra)
     //   Similar to `mmap(path)`, but the memmap will return a buffer
     //   over-allocated for `nextra` bytes above the size of the file. This is
@@ -132,9 +150,12 @@ class MemoryRange
     static MemoryRange acquire(void* ptr, size_t n);
     static MemoryRange external(const void* ptr, size_t n);
     static MemoryRange external(const void* ptr, size_t n, Py_buffer* pybuf);
+    static MemoryRange external(const void* ptr, size_t n,
+                                std::shared_ptr<void> owner);
     static MemoryRange view(const MemoryRange& src, size_t n, size_t offset);
     static MemoryRange mmap(const std::string& path);
     static MemoryRange mmap(const std::string& path, size_t n, int fd = -1);
+    static MemoryRange lazy(size_t n, std::function<void(void*)> loader);
     static MemoryRange overmap(const std::string& path, size_t nextra,
                                int fd = -1);
 
@@ -169,12 +190,17 @@ class MemoryRange
     //   includes the size of the memory buffer itself, plus the sizes of all
     //   auxiliary variables.
     //
+    // operator==(other)
+    //   Return true if `other` refers to the same memory buffer as this
+    //   object, i.e. if one of them is a shallow copy of the other.
+    //
     size_t size() const;
     operator bool() const;
     bool is_writable() const;
     bool is_resizable() const;
     bool is_pyobjects() const;
     size_t memory_footprint() const;
+    bool operator==(const MemoryRange& other) const { return o == other.o; }
 
     // Main data accessors
     //
@@ -7,12 +7,17 @@
 //------------------------------------------------------------------------------
 #include "mmm.h"
 #include <algorithm>
+#include <utility>             // std::pair, std::make_pair
+#include "python/int.h"
 #include "utils/assert.h"
 #include "utils/exceptions.h"
+#include "options.h"
 
 
 
-MemoryMapManager::MemoryMapManager(size_t nelems) {
+MemoryMapManager::MemoryMapManager(size_t nelems)
+  : clock(0), budget(0), resident_size(0)
+{
   entries.reserve(nelems);
   entries.push_back(MmmEntry());
 }
@@ -70,3 +75,112 @@ void MemoryMapManager::sort_entries() {
 
 
 MemoryMapWorker::~MemoryMapWorker() {}
+
+
+
+//------------------------------------------------------------------------------
+// Memory budget
+//------------------------------------------------------------------------------
+
+/**
+ * Record an access to the data of range `obj` of size `size`. This is
+ * called on every access to the data, so the common case (no budget, or the
+ * range is already resident) only updates the range's access time.
+ */
+void MemoryMapManager::touch(BudgetedRange* obj, size_t size) {
+  if (!budget) return;
+  obj->last_access.store(++clock, std::memory_order_relaxed);
+  if (obj->resident) return;
+
+  std::lock_guard<std::mutex> lock(resident_mutex);
+  if (obj->resident || !budget) return;
+  obj->resident = true;
+  resident[obj] = size;
+  resident_size += size;
+  enforce_budget(obj);
+}
+
+
+// Careful not to throw any exceptions here: this method is called from
+// destructors.
+void MemoryMapManager::forget(BudgetedRange* obj) {
+  if (!obj->resident) return;
+  std::lock_guard<std::mutex> lock(resident_mutex);
+  auto it = resident.find(obj);
+  if (it == resident.end()) return;
+  resident_size -= it->second;
+  resident.erase(it);
+  obj->resident = false;
+}
+
+
+/**
+ * Release the least-recently-used resident ranges until their total size
+ * fits into the budget. The range `keep` (the one being accessed right now)
+ * is never released, even if it alone exceeds the budget.
+ */
+void MemoryMapManager::enforce_budget(const BudgetedRange* keep) {
+  size_t b = budget;
+  if (!b || resident_size <= b) return;
+  std::vector<std::pair<size_t, BudgetedRange*>> lru;
+  lru.reserve(resident.size());
+  for (const auto& kv : resident) {
+    if (kv.first == keep) continue;
+    lru.push_back(std::make_pair(kv.first->last_access.load(), kv.first));
+  }
+  std::sort(lru.begin(), lru.end());
+  for (const auto& item : lru) {
+    if (resident_size <= b) break;
+    BudgetedRange* obj = item.second;
+    obj->release_pages();
+    obj->resident = false;
+    resident_size -= resident[obj];
+    resident.erase(obj);
+  }
+}
+
+
+size_t MemoryMapManager::get_budget() const {
+  return budget;
+}
+
+void MemoryMapManager::set_budget(size_t b) {
+  std::lock_guard<std::mutex> lock(resident_mutex);
+  budget = b;
+  if (b) {
+    enforce_budget(nullptr);
+  } else {
+    // Without a budget the residency is not tracked
+    for (const auto& kv : resident) kv.first->resident = false;
+    resident.clear();
+    resident_size = 0;
+  }
+}
+
+size_t MemoryMapManager::get_resident_size() {
+  std::lock_guard<std::mutex> lock(resident_mutex);
+  return resident_size;
+}
+
+
+void mmm_init_options() {
+  dt::register_option(
+    "memory.mmap_budget",
+    []{ return py::oint(MemoryMapManager::get()->get_budget()); },
+    [](py::oobj value) {
+      MemoryMapManager::get()->set_budget(value.to_size_t());
+    },
+    "The maximum amount of memory (in bytes) that the data of memory-mapped\n"
+    "files (such as the columns of Jay files opened with `dt.open()`) may\n"
+    "keep resident. When this budget is exceeded, the pages of the least\n"
+    "recently used columns are released from memory; they will be read\n"
+    "back from the file transparently when accessed again. The value of 0\n"
+    "(default) means that the budget is unlimited.");
+}
+
+
+BudgetedRange::BudgetedRange() : last_access(0), resident(false) {}
+
+BudgetedRange::~BudgetedRange() {
+  MemoryMapManager::get()->forget(this);
+}
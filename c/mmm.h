@@ -7,6 +7,9 @@
 //------------------------------------------------------------------------------
 #ifndef dt_MMM_h
 #define dt_MMM_h
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 using std::size_t;
 
@@ -19,6 +22,24 @@ public:
 };
 
 
+/**
+ * A range of data within a read-only memory-mapped file, whose residency
+ * in memory is subject to the `memory.mmap_budget`. Such ranges report
+ * every access to their data via `MemoryMapManager::touch()`, and may be
+ * asked to `release_pages()` when the budget is exceeded. The released pages
+ * are re-read from the file transparently on the next access.
+ */
+class BudgetedRange {
+public:
+  std::atomic<size_t> last_access;
+  std::atomic<bool> resident;
+
+  BudgetedRange();
+  virtual ~BudgetedRange();
+  virtual void release_pages() = 0;
+};
+
+
 class MmmEntry {
 public:
   size_t size;
@@ -36,6 +57,15 @@ public:
 class MemoryMapManager {
   std::vector<MmmEntry> entries;  // 0th entry always remains empty.
 
+  // Ranges that are currently considered resident in memory (with their
+  // sizes), and the total size of those ranges. The ranges are released in
+  // the least-recently-used order when the total exceeds the `budget`.
+  std::unordered_map<BudgetedRange*, size_t> resident;
+  std::mutex resident_mutex;
+  std::atomic<size_t> clock;
+  std::atomic<size_t> budget;  // 0 means unlimited
+  size_t resident_size;
+
 public:
   static MemoryMapManager* get();
   void add_entry(MemoryMapWorker* obj, size_t size);
@@ -43,11 +73,21 @@ public:
   void freeup_memory();
   bool check_entry(size_t i, const MemoryMapWorker* obj);
 
+  void touch(BudgetedRange* obj, size_t size);
+  void forget(BudgetedRange* obj);
+  size_t get_budget() const;
+  void set_budget(size_t b);
+  size_t get_resident_size();
+
 private:
   static const size_t n_entries_to_purge = 128;
   MemoryMapManager(size_t nelems);
   void sort_entries();
+  void enforce_budget(const BudgetedRange* keep);
 };
 
 
+void mmm_init_options();
+
+
 #endif
@@ -34,8 +34,9 @@ Column* generate_string_column(function<void(size_t, string_buf*)> fn,
 {
   constexpr size_t min_nrows_per_thread = 100;
   size_t nthreads = force_single_threaded? 0 : nrows / min_nrows_per_thread;
-  size_t nchunks = 1 + (nrows - 1)/1000;
-  size_t chunksize = 1 + (nrows - 1)/nchunks;
+  // (careful: `nrows` may be 0)
+  size_t nchunks = nrows? 1 + (nrows - 1)/1000 : 1;
+  size_t chunksize = nrows? 1 + (nrows - 1)/nchunks : 1;
 
   writable_string_col outcol(std::move(offsets_buffer), nrows, force_str64);
 
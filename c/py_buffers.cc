@@ -373,6 +373,7 @@ static int getbuffer_Frame(PyObject* self, Py_buffer* view, int flags) {
     // by-reference instead of copying the data into an intermediate buffer.
     if (ncols == 1 && !dt->columns[i0]->rowindex() && !REQ_WRITABLE(flags) &&
         dt->columns[i0]->is_fixedwidth() &&
+        !is_temporal(dt->columns[i0]->stype()) &&
         pybuffers::force_stype == SType::VOID) {
       return getbuffer_1_col(frame, view, flags);
     }
@@ -0,0 +1,147 @@
+//------------------------------------------------------------------------------
+// Copyright 2018 H2O.ai
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//------------------------------------------------------------------------------
+#include <Python.h>
+#include <datetime.h>            // PyDateTime_IMPORT, PyDate_FromDate, ...
+#include "python/datetime.h"
+#include "utils/datetime.h"
+#include "utils/exceptions.h"
+
+namespace py {
+
+
+// The C API of the `datetime` module must be imported in each translation
+// unit that uses it; this is the only such unit.
+static void init_datetime_api() {
+  if (!PyDateTimeAPI) {
+    PyDateTime_IMPORT;
+    if (!PyDateTimeAPI) throw PyError();
+  }
+}
+
+// Python's date and datetime objects support years 1..9999 only. Values
+// outside of this range (which are valid in datatable) are converted into
+// None, same as NAs.
+static bool year_in_range(int64_t year) {
+  return year >= 1 && year <= 9999;
+}
+
+static oobj checked(PyObject* res) {
+  if (!res) throw PyError();
+  return oobj::from_new_reference(res);
+}
+
+
+
+//------------------------------------------------------------------------------
+// Create python objects
+//------------------------------------------------------------------------------
+
+oobj odate(int32_t days) {
+  init_datetime_api();
+  int64_t year;
+  int month, day;
+  dt::civil_from_days(days, &year, &month, &day);
+  if (!year_in_range(year)) return None();
+  return checked(PyDate_FromDate(static_cast<int>(year), month, day));
+}
+
+
+oobj odatetime(int64_t micros) {
+  init_datetime_api();
+  int64_t year;
+  int month, day;
+  dt::civil_from_days(dt::date64_days(micros), &year, &month, &day);
+  if (!year_in_range(year)) return None();
+  int64_t t = dt::date64_time(micros);
+  int usec = static_cast<int>(t % 1000000);
+  int secs = static_cast<int>(t / 1000000);
+  return checked(PyDateTime_FromDateAndTime(static_cast<int>(year), month,
+                                            day, secs / 3600,
+                                            (secs / 60) % 60, secs % 60,
+                                            usec));
+}
+
+
+oobj otime(int32_t millis) {
+  init_datetime_api();
+  if (millis < 0 || millis >= dt::MILLIS_PER_DAY) return None();
+  int secs = millis / 1000;
+  return checked(PyTime_FromTime(secs / 3600, (secs / 60) % 60, secs % 60,
+                                 (millis % 1000) * 1000));
+}
+
+
+
+//------------------------------------------------------------------------------
+// Convert python objects
+//------------------------------------------------------------------------------
+
+SType temporal_stype(const _obj& x) {
+  PyObject* v = x.to_borrowed_ref();
+  if (!v) return SType::VOID;
+  init_datetime_api();
+  // Note: datetime is a subclass of date, so it must be checked first
+  if (PyDateTime_Check(v)) return SType::DATE64;
+  if (PyDate_Check(v)) return SType::DATE32;
+  if (PyTime_Check(v)) return SType::TIME32;
+  return SType::VOID;
+}
+
+
+int32_t date_value(const _obj& x) {
+  PyObject* v = x.to_borrowed_ref();
+  return static_cast<int32_t>(
+      dt::days_from_civil(PyDateTime_GET_YEAR(v), PyDateTime_GET_MONTH(v),
+                          PyDateTime_GET_DAY(v)));
+}
+
+
+int64_t datetime_value(const _obj& x) {
+  PyObject* v = x.to_borrowed_ref();
+  int64_t secs = (PyDateTime_DATE_GET_HOUR(v) * 60 +
+                  PyDateTime_DATE_GET_MINUTE(v)) * 60 +
+                 PyDateTime_DATE_GET_SECOND(v);
+  int64_t res = date_value(x) * dt::MICROS_PER_DAY + secs * 1000000 +
+                PyDateTime_DATE_GET_MICROSECOND(v);
+  if (reinterpret_cast<PyDateTime_DateTime*>(v)->hastzinfo) {
+    oobj offset = x.invoke("utcoffset");
+    if (!offset.is_none()) {
+      PyObject* d = offset.to_borrowed_ref();
+      res -= (PyDateTime_DELTA_GET_DAYS(d) * 86400LL +
+              PyDateTime_DELTA_GET_SECONDS(d)) * 1000000LL +
+             PyDateTime_DELTA_GET_MICROSECONDS(d);
+    }
+  }
+  return res;
+}
+
+
+int32_t time_value(const _obj& x) {
+  PyObject* v = x.to_borrowed_ref();
+  return ((PyDateTime_TIME_GET_HOUR(v) * 60 +
+           PyDateTime_TIME_GET_MINUTE(v)) * 60 +
+          PyDateTime_TIME_GET_SECOND(v)) * 1000 +
+         PyDateTime_TIME_GET_MICROSECOND(v) / 1000;
+}
+
+
+}  // namespace py
@@ -0,0 +1,56 @@
+//------------------------------------------------------------------------------
+// Copyright 2018 H2O.ai
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//------------------------------------------------------------------------------
+#ifndef dt_PYTHON_DATETIME_h
+#define dt_PYTHON_DATETIME_h
+#include <Python.h>
+#include "python/obj.h"
+#include "types.h"
+
+namespace py {
+
+/**
+ * Conversion between python `datetime.date`, `datetime.datetime` and
+ * `datetime.time` objects and the values of the temporal stypes DATE32
+ * (days since 1970-01-01), DATE64 (microseconds since 1970-01-01) and TIME32
+ * (milliseconds since midnight).
+ *
+ * The `o*` functions create new python objects. The values that cannot be
+ * represented in python (a year outside of the range 1..9999, or a time
+ * outside of 0..24h) are returned as None.
+ *
+ * `temporal_stype(x)` returns the stype corresponding to the python object
+ * `x`, or SType::VOID if `x` is not a date, datetime or time. The functions
+ * `*_value(x)` may only be called on objects of the matching type. Datetimes
+ * that carry a timezone are converted into UTC.
+ */
+oobj odate(int32_t days);
+oobj odatetime(int64_t micros);
+oobj otime(int32_t millis);
+
+SType   temporal_stype(const _obj& x);
+int32_t date_value(const _obj& x);
+int64_t datetime_value(const _obj& x);
+int32_t time_value(const _obj& x);
+
+
+}  // namespace py
+#endif
@@ -0,0 +1,68 @@
+//------------------------------------------------------------------------------
+// Copyright 2018 H2O.ai
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//------------------------------------------------------------------------------
+#include "python/decimal.h"
+#include "python/string.h"
+#include "python/tuple.h"
+#include "utils/decimal.h"
+
+namespace py {
+
+
+// The class `decimal.Decimal` is looked up once, and kept for the lifetime
+// of the module.
+static PyObject* decimal_class() {
+  static PyObject* cls = nullptr;
+  if (!cls) cls = oobj::import("decimal", "Decimal").release();
+  return cls;
+}
+
+
+oobj odecimal(int64_t value, int scale) {
+  char buf[dt::DECIMAL_MAXLEN];
+  char* end = dt::format_decimal(buf, value, scale);
+  ostring str(buf, static_cast<size_t>(end - buf));
+  return robj(decimal_class()).call(otuple(str));
+}
+
+
+bool is_pydecimal(const _obj& x) {
+  PyObject* v = x.to_borrowed_ref();
+  if (!v) return false;
+  int ret = PyObject_IsInstance(v, decimal_class());
+  if (ret == -1) PyErr_Clear();
+  return ret == 1;
+}
+
+
+bool decimal_value(const _obj& x, int64_t* value, int* scale) {
+  ostring pystr = x.to_pystring_force();
+  if (!pystr) return false;
+  CString str = pystr.to_cstring();
+  if (!str.ch) return false;
+  const char* ch = str.ch;
+  const char* end = ch + str.size;
+  return dt::parse_decimal(ch, end, '.', dt::MAX_DECIMAL_SCALE, value, scale)
+         && ch == end;
+}
+
+
+}  // namespace py
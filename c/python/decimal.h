@@ -0,0 +1,49 @@
+//------------------------------------------------------------------------------
+// Copyright 2018 H2O.ai
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//------------------------------------------------------------------------------
+#ifndef dt_PYTHON_DECIMAL_h
+#define dt_PYTHON_DECIMAL_h
+#include <Python.h>
+#include "python/obj.h"
+
+namespace py {
+
+/**
+ * Conversion between python `decimal.Decimal` objects and the values of the
+ * decimal stypes DEC16, DEC32 and DEC64, which are integers `value` with a
+ * common `scale` (see "utils/decimal.h").
+ *
+ * `odecimal(value, scale)` creates a new Decimal object with exactly `scale`
+ * digits after the decimal point.
+ *
+ * `is_pydecimal(x)` checks whether `x` is an instance of `decimal.Decimal`.
+ * `decimal_value(x, ...)` converts such an object into an integer with
+ * a scale; it returns false if the value is not finite, or has more than 18
+ * significant digits.
+ */
+oobj odecimal(int64_t value, int scale);
+
+bool is_pydecimal(const _obj& x);
+bool decimal_value(const _obj& x, int64_t* value, int* scale);
+
+
+}  // namespace py
+#endif
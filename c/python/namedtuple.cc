@@ -127,7 +127,11 @@ onamedtuple::onamedtuple(const onamedtupletype& type) {
   // with `type.v`, that is a named tuple type. Note, that
   // there is no need to call `Py_DECREF` on `Py_TYPE(v)`,
   // because tuple is a built-in type.
-  Py_TYPE(v) = type.v;
+  #if PY_VERSION_HEX >= 0x030900A4
+    Py_SET_TYPE(v, type.v);
+  #else
+    Py_TYPE(v) = type.v;
+  #endif
   Py_INCREF(type.v);
 }
 
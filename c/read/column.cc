@@ -66,14 +66,21 @@ WritableBuffer* Column::strdata_w() {
   return strbuf;
 }
 
+// The extract_*() methods release the column's data buffers, leaving the
+// column ready to be allocated again (when reading the input in chunks).
 MemoryRange Column::extract_databuf() {
-  return std::move(databuf);
+  MemoryRange res = std::move(databuf);
+  databuf = MemoryRange();
+  return res;
 }
 
 MemoryRange Column::extract_strbuf() {
   if (!(strbuf && is_string())) return MemoryRange();
   strbuf->finalize();
-  return strbuf->get_mbuf();
+  MemoryRange res = strbuf->get_mbuf();
+  delete strbuf;
+  strbuf = nullptr;
+  return res;
 }
 
 
@@ -147,6 +154,10 @@ void Column::set_rtype(int64_t it) {
     case RStr:     ptype = PT::Str32; break;
     case RStr32:   ptype = PT::Str32; break;
     case RStr64:   ptype = PT::Str64; break;
+    case RDate32:  ptype = PT::Date32; break;
+    case RDate64:  ptype = PT::Date64; break;
+    case RTime32:  ptype = PT::Time32; break;
+    case RDec64:   ptype = PT::Dec64; break;
   }
 }
 
@@ -266,6 +277,10 @@ RT Column::ptype_iterator::get_rtype() const {
 Column::ptype_iterator& Column::ptype_iterator::operator++() {
   if (curr_ptype < PT::Str32) {
     curr_ptype = static_cast<PT>(curr_ptype + 1);
+    // Decimals are only detected when requested by the user
+    if (curr_ptype == PT::Dec64 && !GenericReader::decimals_enabled()) {
+      curr_ptype = static_cast<PT>(curr_ptype + 1);
+    }
   } else {
     *pqr = *pqr + 1;
   }
@@ -14,6 +14,7 @@ namespace read {
 extern const uint8_t hexdigits[256];
 extern const uint8_t allowedseps[128];
 extern const long double pow10lookup[701];
+extern const uint64_t pow5_128[1302];
 
 
 // Don't know why, but without this `make coverage` fails.
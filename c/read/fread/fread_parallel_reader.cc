@@ -51,11 +51,13 @@ void FreadParallelReader::adjust_chunk_coordinates(
   // Move the end of the chunk, similarly skipping all newline characters;
   // plus 1 more character, thus guaranteeing that the entire next line will
   // also "belong" to the current chunk (this because chunk reader stops at
-  // the first end of the line after `end`).
+  // the first end of the line after `end`). The end must not go past the end
+  // of the input though, which could happen when the chunks are very small.
   if (cc.is_end_approximate()) {
     const char* end = cc.get_end();
     while (*end=='\n' || *end=='\r') end++;
-    cc.set_end_approximate(end + 1);
+    if (end < input_end) end++;
+    cc.set_end_approximate(end);
   }
 }
 
@@ -0,0 +1,66 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#ifndef dt_READ_FREAD_SCAN_h
+#define dt_READ_FREAD_SCAN_h
+#include <cstdint>
+#if defined(__SSE2__)
+  #include <emmintrin.h>
+#endif
+namespace dt {
+namespace read {
+
+
+/**
+ * Find the first "structural" character in the range `[ch, end)`: that is,
+ * a character equal to either `c1` or `c2`, or (if `CTRL` is true) any
+ * control character with code <= 13. The latter class includes '\0', '\n'
+ * and '\r', and the callers are expected to check which of the candidates
+ * are actual line endings. If no such character is found, returns `end`.
+ *
+ * On x86 the input is compared against the targets 16 bytes at a time (SSE2
+ * is part of the x86-64 baseline, so no runtime dispatch is needed), which
+ * gives a bitmask of the structural characters within the block; the
+ * position of the lowest set bit is the answer. The tail of the range, which
+ * is shorter than a full block, is scanned byte-by-byte: the vector loads
+ * never read past `end`.
+ *
+ * These functions are used for skipping over the content of string fields
+ * and over the lines of input, which are otherwise scanned one byte at a
+ * time.
+ */
+template <bool CTRL>
+inline const char* find_structural(const char* ch, const char* end,
+                                   char c1, char c2)
+{
+  #if defined(__SSE2__)
+    const __m128i v1 = _mm_set1_epi8(c1);
+    const __m128i v2 = _mm_set1_epi8(c2);
+    const __m128i v13 = _mm_set1_epi8(13);
+    while (end - ch >= 16) {
+      __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ch));
+      __m128i m = _mm_or_si128(_mm_cmpeq_epi8(x, v1), _mm_cmpeq_epi8(x, v2));
+      if (CTRL) {
+        // unsigned x <= 13  <=>  min(x, 13) == x
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(_mm_min_epu8(x, v13), x));
+      }
+      int mask = _mm_movemask_epi8(m);
+      if (mask) return ch + __builtin_ctz(static_cast<unsigned>(mask));
+      ch += 16;
+    }
+  #endif
+  for (; ch < end; ++ch) {
+    char c = *ch;
+    if (c == c1 || c == c2) return ch;
+    if (CTRL && static_cast<uint8_t>(c) <= 13) return ch;
+  }
+  return end;
+}
+
+
+}}  // namespace dt::read
+#endif
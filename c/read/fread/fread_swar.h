@@ -0,0 +1,87 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#ifndef dt_READ_FREAD_SWAR_h
+#define dt_READ_FREAD_SWAR_h
+#include <cstdint>
+#include <cstring>   // std::memcpy
+namespace dt {
+namespace read {
+
+// "SWAR" (SIMD within a register) helpers for parsing runs of decimal digits
+// 8 at a time. The 8 bytes of input are loaded into a 64-bit word so that the
+// first character ends up in the lowest byte; all computations below are done
+// on the word as a whole, without branching on individual characters.
+
+inline uint64_t load8(const char* ch) {
+  uint64_t w;
+  std::memcpy(&w, ch, 8);
+  #if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    w = __builtin_bswap64(w);
+  #endif
+  return w;
+}
+
+
+/**
+ * Return true if all 8 bytes of the word `w` are decimal digits. Adding 0x06
+ * to a byte in the range '0'..'9' leaves its high nibble equal to 3, whereas
+ * for any other byte either the byte itself or the byte + 0x06 has a different
+ * high nibble.
+ */
+inline bool is_eight_digits(uint64_t w) {
+  return ((w & 0xF0F0F0F0F0F0F0F0u) |
+          (((w + 0x0606060606060606u) & 0xF0F0F0F0F0F0F0F0u) >> 4))
+         == 0x3333333333333333u;
+}
+
+
+/**
+ * Return the value of the 8 digits in the word `w`. The pairs, quads and
+ * octets of digits are combined with 3 multiplications.
+ */
+inline uint32_t parse_eight_digits(uint64_t w) {
+  w -= 0x3030303030303030u;
+  w = (w * 10) + (w >> 8);
+  w = (((w & 0x000000FF000000FFu) * (100 + (1000000ull << 32))) +
+       (((w >> 16) & 0x000000FF000000FFu) * (1 + (10000ull << 32)))) >> 32;
+  return static_cast<uint32_t>(w);
+}
+
+
+/**
+ * Read at most `limit` decimal digits starting from `ch`, and append them to
+ * the accumulator `acc`. Returns the number of digits consumed.
+ *
+ * The digits are consumed 8 at a time for as long as possible, and then the
+ * remaining ones are read one at a time. Note that the length of the run of
+ * digits is found by branching rather than computed arithmetically: this
+ * way the processor can predict where the number ends and proceed to the
+ * next field without waiting for the current one to be parsed. The 8-byte
+ * loads are only done while they stay below `eof`.
+ */
+inline int read_digits(const char* ch, const char* eof, uint64_t& acc,
+                       int limit)
+{
+  int k = 0;
+  while (limit - k >= 8 && eof - (ch + k) >= 8) {
+    uint64_t w = load8(ch + k);
+    if (!is_eight_digits(w)) break;
+    acc = acc * 100000000u + parse_eight_digits(w);
+    k += 8;
+  }
+  uint8_t digit;
+  while (k < limit && (digit = static_cast<uint8_t>(ch[k] - '0')) < 10) {
+    acc = 10*acc + digit;
+    k++;
+  }
+  return k;
+}
+
+
+}}  // namespace dt::read
+#endif
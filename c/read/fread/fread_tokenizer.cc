@@ -5,6 +5,7 @@
 //
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
+#include "read/fread/fread_scan.h"
 #include "read/fread/fread_tokenizer.h"
 
 // defined in reader_parsers.cc
@@ -194,7 +195,7 @@ bool FreadTokenizer::next_good_line_start(
   const char* end = cc.get_end();
   int attempts = 0;
   while (ch < end && attempts++ < 10) {
-    while (ch < end && *ch != '\n' && *ch != '\r') ch++;
+    ch = find_structural<false>(ch, end, '\n', '\r');
     if (ch == end) break;
     skip_eol();  // updates `ch`
     // countfields() below moves the parse location, so store it in `ch1` in
@@ -6,6 +6,7 @@
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
 #include <algorithm>           // std::max
+#include <limits>              // std::numeric_limits
 #include "csv/reader.h"
 #include "parallel/api.h"
 #include "parallel/progress.h"
@@ -183,6 +184,16 @@ void ParallelReader::read_all()
 
           txcc = compute_chunk_boundaries(i, tctx);
 
+          // Only the chunks with an exact start may bump the column types.
+          // Such chunks are limited to the rows that are still needed, so
+          // that the rows past `nrows_max` can never cause a type bump. (A
+          // chunk with an exact start is either the first one, or we are
+          // reading in a single thread; either way `nrows_written` is not
+          // being modified concurrently.)
+          tctx->nrows_limit = txcc.is_start_exact()
+                              ? nrows_max - nrows_written
+                              : std::numeric_limits<size_t>::max();
+
           // Read the chunk with the expected coordinates `txcc`. The actual
           // coordinates of the data read will be stored in variable `tacc`.
           // If the method fails with a recoverable error (such as a type
@@ -194,21 +205,29 @@ void ParallelReader::read_all()
 
         [&](size_t i) {
           tctx->row0 = nrows_written;
+          // If the chunk has to be re-read, it is limited to the rows that
+          // are still needed (see above).
+          tctx->nrows_limit = nrows_max - nrows_written;
           order_chunk(tacc, txcc, tctx);
 
           size_t nrows_new = nrows_written + tctx->used_nrows;
+          if (nrows_new > nrows_max) {
+            // more rows read than nrows_max, no need to reallocate
+            // the output, just truncate the rows in the current chunk.
+            // The chunk is re-read up to the last row needed, so that
+            // `end_of_last_chunk` points exactly at the end of that row.
+            xassert(nrows_max >= nrows_written);
+            txcc.set_start_exact(tacc.get_start());
+            tctx->read_chunk(txcc, tacc);
+            xassert(tctx->used_nrows == nrows_max - nrows_written);
+            end_of_last_chunk = tacc.get_end();
+            nrows_new = nrows_max;
+          }
           if (nrows_new > nrows_allocated) {
-            if (nrows_new > nrows_max) {
-              // more rows read than nrows_max, no need to reallocate
-              // the output, just truncate the rows in the current chunk.
-              xassert(nrows_max >= nrows_written);
-              tctx->used_nrows = nrows_max - nrows_written;
-              nrows_new = nrows_max;
-              realloc_output_columns(i, nrows_new);
-              o->set_n_iterations(i + 1);
-            } else {
-              realloc_output_columns(i, nrows_new);
-            }
+            realloc_output_columns(i, nrows_new);
+          }
+          if (nrows_new == nrows_max) {
+            o->set_n_iterations(i + 1);
           }
           nrows_written = nrows_new;
 
@@ -50,6 +50,13 @@ class ParallelReader {
 
     virtual void read_all();
 
+    /**
+     * Position in the input right after the last row that was read. When
+     * the reading stops early because of the `max_nrows` limit, this will
+     * be the start of the first row that was not read.
+     */
+    const char* get_end_of_data() const { return end_of_last_chunk; }
+
   protected:
     /**
      * This method can be overridden in derived classes in order to implement
@@ -0,0 +1,199 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include "read/parquet/metadata.h"
+#include "read/parquet/thrift.h"
+namespace dt {
+namespace read {
+namespace parquet {
+
+using TR = ThriftReader;
+
+
+// LogicalType (field 10 of SchemaElement). Only the unit of the TIMESTAMP
+// type is needed; the other parameters are skipped.
+static void read_logical_type(TR& tr, uint8_t type, SchemaElement& res) {
+  tr.read_struct(type, [&](int16_t id, uint8_t t) {
+    res.logical_type = id;
+    if (id != LT_TIMESTAMP) {
+      tr.skip(t);
+      return;
+    }
+    // TimestampType: {1: isAdjustedToUTC, 2: unit}
+    tr.read_struct(t, [&](int16_t tid, uint8_t tt) {
+      if (tid != 2) {
+        tr.skip(tt);
+        return;
+      }
+      tr.read_struct(tt, [&](int16_t uid, uint8_t ut) {
+        res.time_unit = uid;
+        tr.skip(ut);
+      });
+    });
+  });
+}
+
+
+static SchemaElement read_schema_element(TR& tr, uint8_t type) {
+  SchemaElement res;
+  tr.read_struct(type, [&](int16_t id, uint8_t t) {
+    switch (id) {
+      case 1: res.type = tr.read_i32(t); break;
+      case 3: res.repetition = tr.read_i32(t); break;
+      case 4: res.name = tr.read_string(t); break;
+      case 5: res.num_children = tr.read_i32(t); break;
+      case 6: res.converted_type = tr.read_i32(t); break;
+      case 7: res.scale = tr.read_i32(t); break;
+      case 10: read_logical_type(tr, t, res); break;
+      default: tr.skip(t);
+    }
+  });
+  return res;
+}
+
+
+static void read_column_metadata(TR& tr, uint8_t type, ColumnChunk& res) {
+  tr.read_struct(type, [&](int16_t id, uint8_t t) {
+    switch (id) {
+      case 1: res.type = tr.read_i32(t); break;
+      case 3:
+        tr.read_list(t, [&](uint8_t et) {
+          res.path.push_back(tr.read_string(et));
+        });
+        break;
+      case 4: res.codec = tr.read_i32(t); break;
+      case 5: res.num_values = tr.read_i64(t); break;
+      case 7: res.total_compressed_size = tr.read_i64(t); break;
+      case 9: res.data_page_offset = tr.read_i64(t); break;
+      case 11: res.dictionary_page_offset = tr.read_i64(t); break;
+      default: tr.skip(t);
+    }
+  });
+}
+
+
+static ColumnChunk read_column_chunk(TR& tr, uint8_t type) {
+  ColumnChunk res;
+  tr.read_struct(type, [&](int16_t id, uint8_t t) {
+    switch (id) {
+      case 1: res.external = !tr.read_string(t).empty(); break;
+      case 3: read_column_metadata(tr, t, res); break;
+      default: tr.skip(t);
+    }
+  });
+  return res;
+}
+
+
+static RowGroup read_row_group(TR& tr, uint8_t type) {
+  RowGroup res;
+  tr.read_struct(type, [&](int16_t id, uint8_t t) {
+    switch (id) {
+      case 1:
+        tr.read_list(t, [&](uint8_t et) {
+          res.columns.push_back(read_column_chunk(tr, et));
+        });
+        break;
+      case 3: res.num_rows = tr.read_i64(t); break;
+      default: tr.skip(t);
+    }
+  });
+  return res;
+}
+
+
+FileMetaData read_file_metadata(const void* data, size_t size) {
+  FileMetaData res;
+  TR tr(data, size);
+  tr.read_struct([&](int16_t id, uint8_t t) {
+    switch (id) {
+      case 2:
+        tr.read_list(t, [&](uint8_t et) {
+          res.schema.push_back(read_schema_element(tr, et));
+        });
+        break;
+      case 3: res.num_rows = tr.read_i64(t); break;
+      case 4:
+        tr.read_list(t, [&](uint8_t et) {
+          res.row_groups.push_back(read_row_group(tr, et));
+        });
+        break;
+      case 6: res.created_by = tr.read_string(t); break;
+      default: tr.skip(t);
+    }
+  });
+  return res;
+}
+
+
+
+//------------------------------------------------------------------------------
+// Page header
+//------------------------------------------------------------------------------
+
+// DataPageHeader (field 5 of PageHeader)
+static void read_data_page_header(TR& tr, uint8_t type, PageHeader& res) {
+  tr.read_struct(type, [&](int16_t id, uint8_t t) {
+    switch (id) {
+      case 1: res.num_values = tr.read_i32(t); break;
+      case 2: res.encoding = tr.read_i32(t); break;
+      default: tr.skip(t);
+    }
+  });
+}
+
+// DictionaryPageHeader (field 7 of PageHeader)
+static void read_dictionary_page_header(TR& tr, uint8_t type,
+                                        PageHeader& res)
+{
+  tr.read_struct(type, [&](int16_t id, uint8_t t) {
+    switch (id) {
+      case 1: res.num_values = tr.read_i32(t); break;
+      case 2: res.encoding = tr.read_i32(t); break;
+      default: tr.skip(t);
+    }
+  });
+}
+
+// DataPageHeaderV2 (field 8 of PageHeader)
+static void read_data_page_header_v2(TR& tr, uint8_t type,
+                                     PageHeader& res)
+{
+  tr.read_struct(type, [&](int16_t id, uint8_t t) {
+    switch (id) {
+      case 1: res.num_values = tr.read_i32(t); break;
+      case 4: res.encoding = tr.read_i32(t); break;
+      case 5: res.def_levels_length = tr.read_i32(t); break;
+      case 6: res.rep_levels_length = tr.read_i32(t); break;
+      case 7: res.is_compressed = tr.read_bool(t); break;
+      default: tr.skip(t);
+    }
+  });
+}
+
+
+PageHeader read_page_header(const void* data, size_t size) {
+  PageHeader res;
+  TR tr(data, size);
+  tr.read_struct([&](int16_t id, uint8_t t) {
+    switch (id) {
+      case 1: res.type = tr.read_i32(t); break;
+      case 2: res.uncompressed_size = tr.read_i32(t); break;
+      case 3: res.compressed_size = tr.read_i32(t); break;
+      case 5: read_data_page_header(tr, t, res); break;
+      case 7: read_dictionary_page_header(tr, t, res); break;
+      case 8: read_data_page_header_v2(tr, t, res); break;
+      default: tr.skip(t);
+    }
+  });
+  res.header_size = tr.position(data);
+  return res;
+}
+
+
+
+}}}  // namespace dt::read::parquet
@@ -0,0 +1,135 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#ifndef dt_READ_PARQUET_METADATA_h
+#define dt_READ_PARQUET_METADATA_h
+#include <cstdint>
+#include <string>
+#include <vector>
+namespace dt {
+namespace read {
+namespace parquet {
+
+
+// The structures below mirror those in the Parquet format specification
+// (file "parquet.thrift" in https://github.com/apache/parquet-format), but
+// contain only the fields that are used by the reader. The enum values are
+// the same as in the specification.
+
+enum PhysicalType : int32_t {
+  BOOLEAN = 0, INT32 = 1, INT64 = 2, INT96 = 3, FLOAT = 4, DOUBLE = 5,
+  BYTE_ARRAY = 6, FIXED_LEN_BYTE_ARRAY = 7
+};
+
+enum ConvertedType : int32_t {
+  CT_NONE = -1, CT_UTF8 = 0, CT_DECIMAL = 5, CT_DATE = 6,
+  CT_TIMESTAMP_MILLIS = 9, CT_TIMESTAMP_MICROS = 10, CT_UINT_8 = 11,
+  CT_UINT_16 = 12, CT_UINT_32 = 13, CT_UINT_64 = 14, CT_INT_8 = 15,
+  CT_INT_16 = 16
+};
+
+// LogicalType is a union in the specification: the value here is the id
+// of the field which is set in that union.
+enum LogicalType : int32_t {
+  LT_NONE = 0, LT_DATE = 6, LT_TIMESTAMP = 8
+};
+
+// Same for the union TimeUnit (the unit of a TIMESTAMP logical type)
+enum TimeUnit : int32_t {
+  TU_NONE = 0, TU_MILLIS = 1, TU_MICROS = 2, TU_NANOS = 3
+};
+
+enum Repetition : int32_t {
+  REQUIRED = 0, OPTIONAL = 1, REPEATED = 2
+};
+
+enum Codec : int32_t {
+  UNCOMPRESSED = 0, SNAPPY = 1, GZIP = 2, LZO = 3, BROTLI = 4, LZ4 = 5,
+  ZSTD = 6, LZ4_RAW = 7
+};
+
+enum Encoding : int32_t {
+  PLAIN = 0, PLAIN_DICTIONARY = 2, RLE = 3, BIT_PACKED = 4,
+  RLE_DICTIONARY = 8
+};
+
+enum PageType : int32_t {
+  DATA_PAGE = 0, INDEX_PAGE = 1, DICTIONARY_PAGE = 2, DATA_PAGE_V2 = 3
+};
+
+
+struct SchemaElement {
+  std::string name;
+  int32_t type = -1;                // PhysicalType, or -1 for groups
+  int32_t repetition = REQUIRED;
+  int32_t num_children = 0;
+  int32_t converted_type = CT_NONE;
+  int32_t scale = 0;
+  int32_t logical_type = LT_NONE;
+  int32_t time_unit = TU_NONE;
+  int : 32;
+};
+
+
+struct ColumnChunk {
+  std::vector<std::string> path;
+  int32_t type = -1;
+  int32_t codec = UNCOMPRESSED;
+  int64_t num_values = 0;
+  int64_t total_compressed_size = 0;
+  int64_t data_page_offset = -1;
+  int64_t dictionary_page_offset = -1;
+  bool external = false;            // the data is stored in another file
+  size_t : 56;
+};
+
+
+struct RowGroup {
+  std::vector<ColumnChunk> columns;
+  int64_t num_rows = 0;
+};
+
+
+struct FileMetaData {
+  std::vector<SchemaElement> schema;
+  std::vector<RowGroup> row_groups;
+  int64_t num_rows = 0;
+  std::string created_by;
+};
+
+
+struct PageHeader {
+  int32_t type = -1;
+  int32_t uncompressed_size = 0;
+  int32_t compressed_size = 0;
+  int32_t num_values = 0;
+  int32_t encoding = PLAIN;
+  // DATA_PAGE_V2 only: the levels are stored uncompressed in front of the
+  // values, and the values may be uncompressed as well.
+  int32_t def_levels_length = 0;
+  int32_t rep_levels_length = 0;
+  bool is_compressed = true;
+  size_t : 56;
+  size_t header_size = 0;           // size of the header itself, in bytes
+};
+
+
+/**
+ * Decode the file's metadata (the footer) from `size` bytes at `data`.
+ */
+FileMetaData read_file_metadata(const void* data, size_t size);
+
+/**
+ * Decode a page header, which is located at `data` and has a size of at
+ * most `size` bytes. The actual size of the header is stored in the field
+ * `header_size` of the result.
+ */
+PageHeader read_page_header(const void* data, size_t size);
+
+
+}}}  // namespace dt::read::parquet
+#endif
@@ -0,0 +1,105 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include <cstdint>
+#include <cstring>   // std::memcpy
+#include "read/parquet/snappy.h"
+#include "utils/exceptions.h"
+namespace dt {
+namespace read {
+namespace parquet {
+
+
+[[noreturn]] static void corrupt() {
+  throw IOError() << "Invalid Parquet file: snappy-compressed data is "
+      "corrupted";
+}
+
+
+void snappy_decompress(const char* src, size_t n, char* dst, size_t dstsize)
+{
+  const uint8_t* inp = reinterpret_cast<const uint8_t*>(src);
+  const uint8_t* end = inp + n;
+
+  // The preamble: length of the uncompressed data as a varint
+  uint64_t len = 0;
+  for (int shift = 0; ; shift += 7) {
+    if (inp == end || shift > 35) corrupt();
+    uint8_t b = *inp++;
+    len |= static_cast<uint64_t>(b & 0x7F) << shift;
+    if (!(b & 0x80)) break;
+  }
+  if (len != dstsize) {
+    throw IOError() << "snappy-compressed data was expected to contain "
+        << dstsize << " bytes, instead found " << len;
+  }
+
+  size_t pos = 0;
+  while (inp < end) {
+    uint8_t tag = *inp++;
+    size_t length, offset;
+    switch (tag & 3) {
+      case 0: {  // literal
+        length = tag >> 2;
+        if (length >= 60) {
+          size_t nbytes = length - 59;
+          if (static_cast<size_t>(end - inp) < nbytes) corrupt();
+          length = 0;
+          for (size_t i = 0; i < nbytes; ++i) {
+            length |= static_cast<size_t>(inp[i]) << (8 * i);
+          }
+          inp += nbytes;
+        }
+        length += 1;
+        if (static_cast<size_t>(end - inp) < length ||
+            dstsize - pos < length) corrupt();
+        std::memcpy(dst + pos, inp, length);
+        inp += length;
+        pos += length;
+        continue;
+      }
+      case 1: {  // copy with a 1-byte offset
+        if (inp == end) corrupt();
+        length = 4 + ((tag >> 2) & 7);
+        offset = (static_cast<size_t>(tag >> 5) << 8) | *inp++;
+        break;
+      }
+      case 2: {  // copy with a 2-byte offset
+        if (end - inp < 2) corrupt();
+        length = 1 + (tag >> 2);
+        offset = static_cast<size_t>(inp[0]) |
+                 (static_cast<size_t>(inp[1]) << 8);
+        inp += 2;
+        break;
+      }
+      default: {  // copy with a 4-byte offset
+        if (end - inp < 4) corrupt();
+        length = 1 + (tag >> 2);
+        offset = 0;
+        for (size_t i = 0; i < 4; ++i) {
+          offset |= static_cast<size_t>(inp[i]) << (8 * i);
+        }
+        inp += 4;
+        break;
+      }
+    }
+    if (offset == 0 || offset > pos || dstsize - pos < length) corrupt();
+    // The source and the destination may overlap, in which case the copy
+    // repeats the last `offset` bytes.
+    const char* from = dst + pos - offset;
+    if (offset >= length) {
+      std::memcpy(dst + pos, from, length);
+    } else {
+      for (size_t i = 0; i < length; ++i) dst[pos + i] = from[i];
+    }
+    pos += length;
+  }
+  if (pos != dstsize) corrupt();
+}
+
+
+}}}  // namespace dt::read::parquet
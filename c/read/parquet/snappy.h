@@ -0,0 +1,31 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#ifndef dt_READ_PARQUET_SNAPPY_h
+#define dt_READ_PARQUET_SNAPPY_h
+#include <cstddef>
+namespace dt {
+namespace read {
+namespace parquet {
+
+
+/**
+ * Decompress a raw snappy block of `n` bytes at `src` into `dst`. The
+ * decompressed size must be exactly `dstsize`, otherwise an IOError is
+ * thrown.
+ *
+ * Snappy is the most common compression codec of Parquet files. Its format
+ * is simple enough that the decoder is implemented here directly, rather
+ * than loading the snappy library (which, unlike zlib or libzstd, is rarely
+ * installed system-wide). See
+ * https://github.com/google/snappy/blob/master/format_description.txt
+ */
+void snappy_decompress(const char* src, size_t n, char* dst, size_t dstsize);
+
+
+}}}  // namespace dt::read::parquet
+#endif
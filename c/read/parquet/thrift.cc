@@ -0,0 +1,148 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include <cstring>   // std::memcpy
+#include "read/parquet/thrift.h"
+namespace dt {
+namespace read {
+namespace parquet {
+
+// Protection against maliciously deep nesting of structs / lists.
+static constexpr int MAX_DEPTH = 64;
+
+
+ThriftReader::ThriftReader(const void* data, size_t size)
+  : ptr(static_cast<const uint8_t*>(data)),
+    end(static_cast<const uint8_t*>(data) + size),
+    depth(0) {}
+
+
+size_t ThriftReader::position(const void* start) const {
+  return static_cast<size_t>(ptr - static_cast<const uint8_t*>(start));
+}
+
+
+uint8_t ThriftReader::read_byte() {
+  if (ptr >= end) error("unexpected end of data");
+  return *ptr++;
+}
+
+
+uint64_t ThriftReader::read_varint() {
+  uint64_t res = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    uint8_t byte = read_byte();
+    res |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) return res;
+  }
+  error("varint is too long");
+}
+
+
+int64_t ThriftReader::read_int() {
+  uint64_t zz = read_varint();
+  return static_cast<int64_t>(zz >> 1) ^ -static_cast<int64_t>(zz & 1);
+}
+
+
+int32_t ThriftReader::read_i32(uint8_t type) {
+  // 8-bit ints are not zigzag-encoded
+  if (type == T_BYTE) return static_cast<int8_t>(read_byte());
+  check_type(type, T_I32, T_I16);
+  return static_cast<int32_t>(read_int());
+}
+
+
+int64_t ThriftReader::read_i64(uint8_t type) {
+  if (type == T_BYTE || type == T_I16 || type == T_I32) return read_i32(type);
+  check_type(type, T_I64);
+  return read_int();
+}
+
+
+bool ThriftReader::read_bool(uint8_t type) {
+  check_type(type, T_TRUE, T_FALSE);
+  return type == T_TRUE;
+}
+
+
+double ThriftReader::read_double(uint8_t type) {
+  check_type(type, T_DOUBLE);
+  if (end - ptr < 8) error("unexpected end of data");
+  double res;
+  std::memcpy(&res, ptr, 8);
+  ptr += 8;
+  return res;
+}
+
+
+std::string ThriftReader::read_string(uint8_t type) {
+  check_type(type, T_BINARY);
+  uint64_t len = read_varint();
+  if (len > static_cast<uint64_t>(end - ptr)) error("string is truncated");
+  std::string res(reinterpret_cast<const char*>(ptr), len);
+  ptr += len;
+  return res;
+}
+
+
+void ThriftReader::skip(uint8_t type) {
+  switch (type) {
+    case T_TRUE:
+    case T_FALSE:  return;
+    case T_BYTE:   read_byte(); return;
+    case T_I16:
+    case T_I32:
+    case T_I64:    read_varint(); return;
+    case T_DOUBLE: read_double(type); return;
+    case T_BINARY: read_string(type); return;
+    case T_STRUCT: read_struct([&](int16_t, uint8_t t) { skip(t); }); return;
+    case T_LIST:
+    case T_SET:
+      read_list(type, [&](uint8_t t) {
+        // Boolean elements of a list occupy one byte each
+        if (t == T_TRUE || t == T_FALSE) read_byte();
+        else skip(t);
+      });
+      return;
+    case T_MAP: {
+      enter();
+      uint64_t n = read_varint();
+      if (n) {
+        uint8_t kv = read_byte();
+        for (uint64_t i = 0; i < n; ++i) {
+          skip(kv >> 4);
+          skip(kv & 0x0F);
+        }
+      }
+      depth--;
+      return;
+    }
+    default:
+      error("unknown field type");
+  }
+}
+
+
+void ThriftReader::enter() {
+  if (++depth > MAX_DEPTH) error("structures are nested too deeply");
+}
+
+
+void ThriftReader::check_type(uint8_t type, uint8_t t1, uint8_t t2) {
+  if (type != t1 && type != t2) error("unexpected field type");
+}
+
+
+void ThriftReader::error(const char* what) const {
+  throw IOError() << "Invalid Parquet file: cannot decode metadata, "
+      << what;
+}
+
+
+
+}}}  // namespace dt::read::parquet
@@ -0,0 +1,113 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#ifndef dt_READ_PARQUET_THRIFT_h
+#define dt_READ_PARQUET_THRIFT_h
+#include <cstdint>
+#include <string>
+#include "utils/exceptions.h"
+namespace dt {
+namespace read {
+namespace parquet {
+
+
+/**
+ * Minimal decoder of the Thrift "compact protocol", which is used for all
+ * metadata structures in a Parquet file (the file footer and the page
+ * headers). See
+ * https://github.com/apache/thrift/blob/master/doc/specs/thrift-compact-protocol.md
+ *
+ * The decoder does not know anything about the Thrift schema: the caller
+ * iterates over the fields of a struct with `read_struct()`, and for each
+ * field either reads its value with the appropriate method, or skips it
+ * with `skip()`. All the read methods throw an IOError if the input is
+ * malformed or truncated.
+ */
+class ThriftReader {
+  public:
+    // Types of the fields, as encoded in the compact protocol
+    enum : uint8_t {
+      T_STOP = 0, T_TRUE = 1, T_FALSE = 2, T_BYTE = 3, T_I16 = 4, T_I32 = 5,
+      T_I64 = 6, T_DOUBLE = 7, T_BINARY = 8, T_LIST = 9, T_SET = 10,
+      T_MAP = 11, T_STRUCT = 12
+    };
+
+  private:
+    const uint8_t* ptr;
+    const uint8_t* end;
+    int depth;
+    int : 32;
+
+  public:
+    ThriftReader(const void* data, size_t size);
+
+    // Number of bytes consumed so far.
+    size_t position(const void* start) const;
+
+    /**
+     * Iterate over the fields of a struct, calling `fn(field_id, type)` for
+     * each. The callback must consume the field's value (or call `skip()`).
+     */
+    template <typename F>
+    void read_struct(F fn) {
+      enter();
+      int16_t field_id = 0;
+      while (true) {
+        uint8_t byte = read_byte();
+        uint8_t type = byte & 0x0F;
+        if (type == T_STOP) break;
+        int16_t delta = byte >> 4;
+        field_id = delta? static_cast<int16_t>(field_id + delta)
+                        : static_cast<int16_t>(read_int());
+        fn(field_id, type);
+      }
+      depth--;
+    }
+
+    // Same as above, but for a field of type `type` which must be a struct.
+    template <typename F>
+    void read_struct(uint8_t type, F fn) {
+      check_type(type, T_STRUCT);
+      read_struct(fn);
+    }
+
+    /**
+     * Iterate over the elements of a list (or a set), calling `fn(type)` for
+     * each. The callback must consume the element's value.
+     */
+    template <typename F>
+    void read_list(uint8_t type, F fn) {
+      check_type(type, T_LIST, T_SET);
+      enter();
+      uint8_t byte = read_byte();
+      size_t n = byte >> 4;
+      if (n == 15) n = read_varint();
+      uint8_t elemtype = byte & 0x0F;
+      for (size_t i = 0; i < n; ++i) fn(elemtype);
+      depth--;
+    }
+
+    int64_t read_int();       // any of T_BYTE, T_I16, T_I32, T_I64
+    int32_t read_i32(uint8_t type);
+    int64_t read_i64(uint8_t type);
+    bool read_bool(uint8_t type);
+    double read_double(uint8_t type);
+    std::string read_string(uint8_t type);
+    void skip(uint8_t type);
+
+  private:
+    uint8_t read_byte();
+    uint64_t read_varint();
+    void enter();
+    void check_type(uint8_t type, uint8_t expected1, uint8_t expected2 = 255);
+    [[noreturn]] void error(const char* what) const;
+};
+
+
+
+}}}  // namespace dt::read::parquet
+#endif
@@ -5,6 +5,7 @@
 //
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
+#include <limits>          // std::numeric_limits
 #include "read/thread_context.h"
 #include "utils/assert.h"
 
@@ -19,6 +20,7 @@ ThreadContext::ThreadContext(size_t ncols, size_t nrows)
   tbuf_nrows = nrows;
   used_nrows = 0;
   row0 = 0;
+  nrows_limit = std::numeric_limits<size_t>::max();
 }
 
 
@@ -35,6 +35,12 @@ namespace read {
  *
  * row0
  *   Starting row index within the output DataTable for the current data chunk.
+ *
+ * nrows_limit
+ *   Maximum number of rows that `read_chunk()` may read. This is set to the
+ *   number of rows still needed (because of the `max_nrows` limit) whenever
+ *   the chunk's start is exact, so that the reading stops right after the
+ *   last row needed, and the rows past it cannot bump the column types.
  */
 class ThreadContext {
   public:
@@ -47,6 +53,7 @@ class ThreadContext {
     size_t tbuf_nrows;
     size_t used_nrows;
     size_t row0;
+    size_t nrows_limit;
 
   public:
     ThreadContext(size_t ncols, size_t nrows);
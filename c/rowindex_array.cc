@@ -348,13 +348,13 @@ RowIndexImpl* ArrayRowIndexImpl::uplift_from(const RowIndexImpl* rii) const {
       auto ind32 = static_cast<const int32_t*>(data);
       for (size_t i = 0; i < length; ++i) {
         size_t j = start + static_cast<size_t>(ind32[i]) * step;
-        rowsres[i] = static_cast<int64_t>(j);
+        rowsres[i] = ind32[i] < 0? -1 : static_cast<int64_t>(j);
       }
     } else {
       auto ind64 = static_cast<const int64_t*>(data);
       for (size_t i = 0; i < length; ++i) {
         size_t j = start + static_cast<size_t>(ind64[i]) * step;
-        rowsres[i] = static_cast<int64_t>(j);
+        rowsres[i] = ind64[i] < 0? -1 : static_cast<int64_t>(j);
       }
     }
     bool res_sorted = ascending && slice_rowindex_increasing(rii);
@@ -369,7 +369,7 @@ RowIndexImpl* ArrayRowIndexImpl::uplift_from(const RowIndexImpl* rii) const {
     auto rows_ab = static_cast<const int32_t*>(arii->data);
     auto rows_bc = static_cast<const int32_t*>(data);
     for (size_t i = 0; i < length; ++i) {
-      rowsres[i] = rows_ab[rows_bc[i]];
+      rowsres[i] = rows_bc[i] < 0? -1 : rows_ab[rows_bc[i]];
     }
     bool res_sorted = ascending && arii->ascending;
     return new ArrayRowIndexImpl(std::move(rowsres), res_sorted);
@@ -381,21 +381,21 @@ RowIndexImpl* ArrayRowIndexImpl::uplift_from(const RowIndexImpl* rii) const {
       auto rows_ab = static_cast<const int32_t*>(arii->data);
       auto rows_bc = static_cast<const int64_t*>(data);
       for (size_t i = 0; i < length; ++i) {
-        rowsres[i] = rows_ab[rows_bc[i]];
+        rowsres[i] = rows_bc[i] < 0? -1 : rows_ab[rows_bc[i]];
       }
     }
     if (uptype == RowIndexType::ARR64 && type == RowIndexType::ARR32) {
       auto rows_ab = static_cast<const int64_t*>(arii->data);
       auto rows_bc = static_cast<const int32_t*>(data);
       for (size_t i = 0; i < length; ++i) {
-        rowsres[i] = rows_ab[rows_bc[i]];
+        rowsres[i] = rows_bc[i] < 0? -1 : rows_ab[rows_bc[i]];
       }
     }
     if (uptype == RowIndexType::ARR64 && type == RowIndexType::ARR64) {
       auto rows_ab = static_cast<const int64_t*>(arii->data);
       auto rows_bc = static_cast<const int64_t*>(data);
       for (size_t i = 0; i < length; ++i) {
-        rowsres[i] = rows_ab[rows_bc[i]];
+        rowsres[i] = rows_bc[i] < 0? -1 : rows_ab[rows_bc[i]];
       }
     }
     bool res_sorted = ascending && arii->ascending;
@@ -0,0 +1,242 @@
+//------------------------------------------------------------------------------
+// Copyright 2018 H2O.ai
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//------------------------------------------------------------------------------
+#include <algorithm>    // std::sort, std::merge, std::min, std::max
+#include <cmath>        // std::asin, std::sin, std::log, std::ldexp
+#include <limits>       // std::numeric_limits
+#include "utils/misc.h"
+#include "sketch.h"
+#include "types.h"
+namespace dt {
+
+
+// Finalizer from the MurmurHash3 function (public domain).
+uint64_t hash_u64(uint64_t x) {
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+
+
+//------------------------------------------------------------------------------
+// HyperLogLog
+//------------------------------------------------------------------------------
+
+HyperLogLog::HyperLogLog() : registers(NREGISTERS, 0) {}
+
+
+// The top PRECISION bits of the hash select the register, and the remaining
+// bits are used to compute the "rank": position of the leftmost 1-bit.
+void HyperLogLog::add(uint64_t hash) {
+  size_t idx = static_cast<size_t>(hash >> (64 - PRECISION));
+  uint64_t w = hash << PRECISION;
+  uint8_t rank = static_cast<uint8_t>(
+      w? nlz(w) + 1 : 64 - PRECISION + 1);
+  if (rank > registers[idx]) registers[idx] = rank;
+}
+
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+  for (size_t i = 0; i < NREGISTERS; ++i) {
+    registers[i] = std::max(registers[i], other.registers[i]);
+  }
+}
+
+
+// Raw HLL estimate, with the "linear counting" correction for small
+// cardinalities. Since the hash is 64 bits wide, the large-range correction
+// is not needed.
+size_t HyperLogLog::estimate() const {
+  double m = static_cast<double>(NREGISTERS);
+  double sum = 0.0;
+  size_t nzeros = 0;
+  for (uint8_t r : registers) {
+    sum += std::ldexp(1.0, -r);
+    nzeros += (r == 0);
+  }
+  double alpha = 0.7213 / (1.0 + 1.079 / m);
+  double est = alpha * m * m / sum;
+  if (est <= 2.5 * m && nzeros) {
+    est = m * std::log(m / static_cast<double>(nzeros));
+  }
+  return static_cast<size_t>(est + 0.5);
+}
+
+
+
+//------------------------------------------------------------------------------
+// TDigest
+//------------------------------------------------------------------------------
+
+TDigest::TDigest(double compression_)
+  : compression(compression_),
+    total_weight(0.0),
+    min(std::numeric_limits<double>::infinity()),
+    max(-std::numeric_limits<double>::infinity()) {}
+
+
+TDigest::TDigest(std::vector<centroid>&& centroids_, double min_, double max_)
+  : centroids(std::move(centroids_)),
+    compression(200.0),
+    total_weight(0.0),
+    min(min_),
+    max(max_)
+{
+  for (const centroid& c : centroids) total_weight += c.weight;
+}
+
+
+void TDigest::add(double x) {
+  buffer.push_back(x);
+  if (x < min) min = x;
+  if (x > max) max = x;
+  if (buffer.size() >= 5 * static_cast<size_t>(compression)) flush();
+}
+
+
+void TDigest::merge(const TDigest& other) {
+  std::vector<centroid> points;
+  points.reserve(centroids.size() + buffer.size() +
+                 other.centroids.size() + other.buffer.size());
+  points.insert(points.end(), centroids.begin(), centroids.end());
+  points.insert(points.end(), other.centroids.begin(), other.centroids.end());
+  for (double x : buffer) points.push_back({x, 1.0});
+  for (double x : other.buffer) points.push_back({x, 1.0});
+  std::sort(points.begin(), points.end(),
+            [](const centroid& a, const centroid& b) { return a.mean < b.mean; });
+  buffer.clear();
+  if (other.min < min) min = other.min;
+  if (other.max > max) max = other.max;
+  compress(points);
+}
+
+
+void TDigest::flush() {
+  if (buffer.empty()) return;
+  std::sort(buffer.begin(), buffer.end());
+  std::vector<centroid> points;
+  points.reserve(centroids.size() + buffer.size());
+  auto byMean = [](const centroid& a, const centroid& b) {
+    return a.mean < b.mean;
+  };
+  std::vector<centroid> incoming;
+  incoming.reserve(buffer.size());
+  for (double x : buffer) incoming.push_back({x, 1.0});
+  std::merge(centroids.begin(), centroids.end(),
+             incoming.begin(), incoming.end(),
+             std::back_inserter(points), byMean);
+  buffer.clear();
+  compress(points);
+}
+
+
+// Sweep over the sorted `points` and merge adjacent ones for as long as the
+// size of the resulting centroid stays within the limit given by the scale
+// function k(q) = compression/(2pi) * asin(2q - 1). This scale function
+// allows centroids of size ~ q(1-q)/compression, i.e. keeps the tails of the
+// distribution accurate.
+void TDigest::compress(std::vector<centroid>& points) {
+  centroids.clear();
+  total_weight = 0.0;
+  if (points.empty()) return;
+  for (const centroid& p : points) total_weight += p.weight;
+
+  const double norm = compression / (2 * M_PI);
+  const double kmax = norm * M_PI / 2;
+  auto weight_limit = [&](double wsofar) {
+    double k = norm * std::asin(2 * wsofar / total_weight - 1) + 1.0;
+    if (k >= kmax) return total_weight;
+    return total_weight * (std::sin(k / norm) + 1) / 2;
+  };
+
+  double wsofar = 0.0;
+  double wlimit = weight_limit(0.0);
+  centroid curr = points[0];
+  for (size_t i = 1; i < points.size(); ++i) {
+    const centroid& p = points[i];
+    if (wsofar + curr.weight + p.weight <= wlimit) {
+      curr.weight += p.weight;
+      curr.mean += (p.mean - curr.mean) * p.weight / curr.weight;
+    } else {
+      wsofar += curr.weight;
+      centroids.push_back(curr);
+      wlimit = weight_limit(wsofar);
+      curr = p;
+    }
+  }
+  centroids.push_back(curr);
+}
+
+
+// Each centroid is assumed to be located at the "center" of its weight on
+// the rank axis, and the quantiles between the centers of two adjacent
+// centroids are linearly interpolated.
+//
+// After merging, the centroids are ordered by their means, which does not
+// guarantee that the extreme values belong to the first/last centroid. For
+// this reason the tracked `min`/`max` are returned for the ranks outside of
+// the first/last centroid's center, and every interpolated value is clamped
+// to the range [min, max].
+double TDigest::quantile(double q) {
+  flush();
+  if (centroids.empty()) return GETNA<double>();
+  if (q <= 0) return min;
+  if (q >= 1) return max;
+  auto clamp = [&](double x) { return std::min(std::max(x, min), max); };
+  double index = q * (total_weight - 1) + 0.5;
+  if (index < centroids.front().weight / 2) return min;
+  if (index > total_weight - centroids.back().weight / 2) return max;
+  double prev_pos = 0.5;
+  double prev_val = min;
+  double cumw = 0.0;
+  for (const centroid& c : centroids) {
+    double pos = cumw + c.weight / 2;
+    cumw += c.weight;
+    if (index <= pos) {
+      if (pos <= prev_pos) return clamp(c.mean);
+      return clamp(prev_val + (c.mean - prev_val) * (index - prev_pos) /
+                              (pos - prev_pos));
+    }
+    prev_pos = pos;
+    prev_val = c.mean;
+  }
+  return max;
+}
+
+
+size_t TDigest::count() {
+  flush();
+  return static_cast<size_t>(total_weight);
+}
+
+
+const std::vector<TDigest::centroid>& TDigest::get_centroids() {
+  flush();
+  return centroids;
+}
+
+
+
+}  // namespace dt
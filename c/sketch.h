@@ -0,0 +1,124 @@
+//------------------------------------------------------------------------------
+// Copyright 2018 H2O.ai
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//------------------------------------------------------------------------------
+#ifndef dt_SKETCH_h
+#define dt_SKETCH_h
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+namespace dt {
+
+
+/**
+ * Mix the bits of a 64-bit value, so that the result can be used as a hash
+ * for the HyperLogLog sketch. For floating-point values the caller should
+ * pass the bit representation of the number (with -0.0 normalized to 0.0).
+ */
+uint64_t hash_u64(uint64_t x);
+
+
+
+//------------------------------------------------------------------------------
+// HyperLogLog
+//------------------------------------------------------------------------------
+
+/**
+ * Sketch for estimating the number of distinct values in a stream. Each value
+ * is represented by its 64-bit hash; the sketch keeps 2^PRECISION one-byte
+ * registers, giving the relative standard error of about 0.8%.
+ *
+ * Two sketches can be merged, which allows each thread to build its own
+ * sketch over a part of the data, and then combine them at the end.
+ */
+class HyperLogLog {
+  private:
+    static constexpr int PRECISION = 14;
+    static constexpr size_t NREGISTERS = size_t(1) << PRECISION;
+    std::vector<uint8_t> registers;
+
+  public:
+    HyperLogLog();
+    void add(uint64_t hash);
+    void merge(const HyperLogLog& other);
+    size_t estimate() const;
+};
+
+
+
+//------------------------------------------------------------------------------
+// TDigest
+//------------------------------------------------------------------------------
+
+/**
+ * Mergeable sketch for estimating quantiles of a stream of real numbers
+ * ("merging t-digest" of T.Dunning). The data is summarized as a list of
+ * centroids (mean, weight) sorted by mean, where the centroids near the tails
+ * of the distribution are kept small, and the ones near the median are allowed
+ * to grow. The number of centroids is bounded by the `compression` parameter,
+ * so that the sketch takes O(compression) memory regardless of the size of the
+ * data.
+ *
+ * New values are collected into a buffer, which is merged into the list of
+ * centroids once it fills up (or when the sketch is queried).
+ *
+ * The quantiles are computed by linear interpolation between the centroids,
+ * with the same convention as the exact quantile: for `n` values, `q=0`
+ * corresponds to the minimum, `q=1` to the maximum, and the sample of rank
+ * `k` is located at `q = k/(n-1)`. As long as all centroids have weight 1
+ * (i.e. the data is small), the result is exact.
+ */
+class TDigest {
+  public:
+    struct centroid {
+      double mean;
+      double weight;
+    };
+
+  private:
+    std::vector<centroid> centroids;
+    std::vector<double> buffer;
+    double compression;
+    double total_weight;
+    double min;
+    double max;
+
+  public:
+    explicit TDigest(double compression = 200.0);
+    TDigest(std::vector<centroid>&& centroids, double min, double max);
+
+    void add(double x);
+    void merge(const TDigest& other);
+    double quantile(double q);
+
+    size_t count();
+    const std::vector<centroid>& get_centroids();
+    double get_min() const { return min; }
+    double get_max() const { return max; }
+
+  private:
+    void flush();
+    void compress(std::vector<centroid>& points);
+};
+
+
+
+}  // namespace dt
+#endif
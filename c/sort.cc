@@ -126,6 +126,7 @@
 #include <atomic>     // std::atomic_flag
 #include <cstdlib>    // std::abs
 #include <cstring>    // std::memset, std::memcpy
+#include <memory>     // std::unique_ptr
 #include <vector>     // std::vector
 #include "expr/sort_node.h"
 #include "expr/workframe.h"
@@ -512,12 +513,12 @@ class SortContext {
   SortContext(SortContext&&) = delete;
 
 
-  void start_sort(const Column* col, bool desc) {
+  void start_sort(const Column* col, bool desc, size_t part = 0) {
     descending = desc;
     if (desc) {
-      _prepare_data_for_column<false>(col);
+      _prepare_data_for_column<false>(col, part);
     } else {
-      _prepare_data_for_column<true>(col);
+      _prepare_data_for_column<true>(col, part);
     }
     if (n <= sort_insert_method_threshold) {
       if (use_order) {
@@ -533,15 +534,16 @@ class SortContext {
   }
 
 
-  void continue_sort(const Column* col, bool desc, bool make_groups) {
+  void continue_sort(const Column* col, bool desc, bool make_groups,
+                     size_t part = 0) {
     nradixes = gg.size();
     descending = desc;
     xassert(nradixes > 0);
     xassert(o == container_o.ptr);
     if (desc) {
-      _prepare_data_for_column<false>(col);
+      _prepare_data_for_column<false>(col, part);
     } else {
-      _prepare_data_for_column<true>(col);
+      _prepare_data_for_column<true>(col, part);
     }
     if (strtype) strstart--;
     // Make sure that `xx` has enough storage capacity. Previous column may
@@ -613,8 +615,10 @@ class SortContext {
     next_o = static_cast<int*>(container_oo.ptr);
   }
 
+  // For FSTR columns wider than 8 bytes, `part` selects which 8-byte part of
+  // the strings is sorted by; other columns have only part 0.
   template <bool ASC>
-  void _prepare_data_for_column(const Column* col) {
+  void _prepare_data_for_column(const Column* col, size_t part) {
     strtype = 0;
     strdata = nullptr;
     // These will initialize `x`, `elemsize` and `nsigbits`, and also
@@ -623,13 +627,23 @@ class SortContext {
     switch (stype) {
       case SType::BOOL:    _initB<ASC>(col); break;
       case SType::INT8:    _initI<ASC, int8_t,  uint8_t>(col); break;
-      case SType::INT16:   _initI<ASC, int16_t, uint16_t>(col); break;
-      case SType::INT32:   _initI<ASC, int32_t, uint32_t>(col); break;
-      case SType::INT64:   _initI<ASC, int64_t, uint64_t>(col); break;
+      case SType::INT16:
+      case SType::DEC16:   _initI<ASC, int16_t, uint16_t>(col); break;
+      case SType::INT32:
+      case SType::DEC32:
+      case SType::TIME32:
+      case SType::DATE32:  _initI<ASC, int32_t, uint32_t>(col); break;
+      case SType::INT64:
+      case SType::DEC64:
+      case SType::DATE64:  _initI<ASC, int64_t, uint64_t>(col); break;
       case SType::FLOAT32: _initF<ASC, uint32_t>(col); break;
       case SType::FLOAT64: _initF<ASC, uint64_t>(col); break;
       case SType::STR32:   _initS<ASC, uint32_t>(col); break;
       case SType::STR64:   _initS<ASC, uint64_t>(col); break;
+      case SType::FSTR:    _initX<ASC>(col, part); break;
+      case SType::CAT8:    _initC<ASC, uint8_t>(col); break;
+      case SType::CAT16:   _initC<ASC, uint16_t>(col); break;
+      case SType::CAT32:   _initC<ASC, uint32_t>(col); break;
       default:
         throw NotImplError() << "Unable to sort Column of stype " << stype;
     }
@@ -722,6 +736,101 @@ class SortContext {
   }
 
 
+  /**
+   * Categorical columns are sorted by their codes: since the levels are
+   * sorted, the order of the codes is the same as the order of the strings.
+   * The NAs are mapped to 0, and the codes to the range [1; nlevels]
+   * (reversed for the descending order). The width of the keys depends only
+   * on the number of levels.
+   */
+  template <bool ASC, typename T>
+  void _initC(const Column* col) {
+    auto ccol = static_cast<const CategoricalColumn<T>*>(col);
+    uint32_t nlevels = static_cast<uint32_t>(ccol->nlevels());
+    nsigbits = static_cast<uint8_t>(std::max(1, 32 - dt::nlz(nlevels)));
+    if (nsigbits > 16)     _initC_impl<ASC, T, uint32_t>(ccol, nlevels);
+    else if (nsigbits > 8) _initC_impl<ASC, T, uint16_t>(ccol, nlevels);
+    else                   _initC_impl<ASC, T, uint8_t >(ccol, nlevels);
+  }
+
+  template <bool ASC, typename T, typename TO>
+  void _initC_impl(const Column* col, uint32_t nlevels) {
+    const T* xi = static_cast<const T*>(col->data());
+    elemsize = sizeof(TO);
+    allocate_x();
+    TO* xo = x.data<TO>();
+
+    if (use_order) {
+      dt::parallel_for_static(n,
+        [&](size_t j) {
+          T t = xi[o[j]];
+          xo[j] = ISNA<T>(t)? 0 :
+                  ASC? static_cast<TO>(t + 1)
+                     : static_cast<TO>(nlevels - t);
+        });
+    } else {
+      dt::parallel_for_static(n,
+        [&](size_t j) {
+          T t = xi[j];
+          xo[j] = ISNA<T>(t)? 0 :
+                  ASC? static_cast<TO>(t + 1)
+                     : static_cast<TO>(nlevels - t);
+        });
+    }
+  }
+
+
+  /**
+   * Fixed-width strings are sorted as unsigned big-endian integers made of
+   * (up to) 8 bytes of each string, starting from byte `8 * part`. Since the
+   * strings are padded with \0s, shorter strings order before the longer
+   * strings with the same prefix, exactly as for the variable-width strings.
+   * The NAs are mapped to 0, and the values to the range [1; 2^nsigbits - 1]
+   * (reversed for the descending order): this is possible because bytes 0xFF
+   * never occur in valid UTF-8.
+   */
+  template <bool ASC>
+  void _initX(const Column* col, size_t part) {
+    auto xcol = static_cast<const FixedStringColumn*>(col);
+    size_t width = xcol->get_width();
+    size_t offset = 8 * part;
+    xassert(offset < width);
+    size_t k = std::min(size_t(8), width - offset);
+    nsigbits = static_cast<uint8_t>(8 * k);
+    if (k > 4)      _initX_impl<ASC, uint64_t>(xcol, offset, k);
+    else if (k > 2) _initX_impl<ASC, uint32_t>(xcol, offset, k);
+    else if (k > 1) _initX_impl<ASC, uint16_t>(xcol, offset, k);
+    else            _initX_impl<ASC, uint8_t >(xcol, offset, k);
+  }
+
+  template <bool ASC, typename TO>
+  void _initX_impl(const FixedStringColumn* col, size_t offset, size_t k) {
+    const uint8_t* xi = reinterpret_cast<const uint8_t*>(col->chars());
+    size_t width = col->get_width();
+    elemsize = sizeof(TO);
+    allocate_x();
+    TO* xo = x.data<TO>();
+    const TO maxval = static_cast<TO>(k == 8? ~uint64_t(0)
+                                            : (uint64_t(1) << (8 * k)) - 1);
+
+    dt::parallel_for_static(n,
+      [&](size_t j) {
+        size_t jj = use_order? static_cast<size_t>(o[j]) : j;
+        const uint8_t* ch = xi + jj * width;
+        if (*ch == FixedStringColumn::NA_BYTE) {
+          xo[j] = 0;
+          return;
+        }
+        ch += offset;
+        TO v = 0;
+        for (size_t i = 0; i < k; ++i) {
+          v = static_cast<TO>((v << 8) | ch[i]);
+        }
+        xo[j] = ASC? static_cast<TO>(v + 1) : static_cast<TO>(maxval - v);
+      });
+  }
+
+
   /**
    * For float32/64 we need to carefully manipulate the bits in order to present
    * them in the correct order as uint32/64. At bit level, the structure of
@@ -1396,18 +1505,31 @@ RiGb DataTable::group(const std::vector<sort_spec>& spec, bool as_view) const
     }
   }
 
+  // Fixed-width string columns wider than 8 bytes are sorted in several
+  // passes, one for each 8-byte part of the strings.
+  struct sort_key { const Column* col; size_t part; bool desc, sort_only; };
+  std::vector<sort_key> keys;
+  for (auto& s : spec) {
+    const Column* col = columns[s.col_index];
+    size_t nparts = col->stype() == SType::FSTR
+                      ? (fstr_width(col) + 7) / 8 : 1;
+    for (size_t p = 0; p < nparts; ++p) {
+      keys.push_back(sort_key { col, p, s.descending, s.sort_only });
+    }
+  }
+  n = keys.size();
+
   bool do_groups = n > 1 || !spec[0].sort_only;
   SortContext sc(nrows, col0->rowindex(), do_groups);
-  sc.start_sort(col0, spec[0].descending);
+  sc.start_sort(col0, keys[0].desc);
   for (size_t j = 1; j < n; ++j) {
-    if (spec[j].sort_only && !spec[j - 1].sort_only) {
+    if (keys[j].sort_only && !keys[j - 1].sort_only) {
       result.second = sc.copy_groups();
     }
-    if (j == n - 1 && spec[j].sort_only) {
+    if (j == n - 1 && keys[j].sort_only) {
       do_groups = false;
     }
-    sc.continue_sort(columns[spec[j].col_index],
-                     spec[j].descending, do_groups);
+    sc.continue_sort(keys[j].col, keys[j].desc, do_groups, keys[j].part);
   }
   result.first = sc.get_result_rowindex();
   if (!spec[0].sort_only && !result.second) {
@@ -1437,8 +1559,13 @@ RowIndex Column::sort(Groupby* out_grps) const {
   if (nrows <= 1) {
     return sort_tiny(this, out_grps);
   }
-  SortContext sc(nrows, rowindex(), (out_grps != nullptr));
+  size_t nparts = stype() == SType::FSTR? (fstr_width(this) + 7) / 8 : 1;
+  SortContext sc(nrows, rowindex(), (out_grps != nullptr || nparts > 1));
   sc.start_sort(this, false);
+  for (size_t p = 1; p < nparts; ++p) {
+    bool make_groups = out_grps != nullptr || p < nparts - 1;
+    sc.continue_sort(this, false, make_groups, p);
+  }
   if (out_grps) {
     auto res = sc.get_result_groups();
     *out_grps = std::move(res.second);
@@ -1452,6 +1579,10 @@ RowIndex Column::sort(Groupby* out_grps) const {
 RowIndex Column::sort_grouped(const RowIndex& rowindex,
                               const Groupby& grps) const
 {
+  if (stype() == SType::FSTR && fstr_width(this) > 8) {
+    std::unique_ptr<Column> strcol(cast(SType::STR32));
+    return strcol->sort_grouped(rowindex, grps);
+  }
   SortContext sc(nrows, rowindex, grps, /* make_groups = */ false);
   sc.continue_sort(this, /* desc = */ false, /* make_groups = */ false);
   return sc.get_result_rowindex();
@@ -17,6 +17,7 @@ struct radix_range {
 
 // Called during module initialization
 void sort_init_options();
+void groupby_hash_init_options();
 
 
 /**
@@ -5,10 +5,13 @@
 //
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
+#include <algorithm>    // std::min, std::max
 #include <atomic>       // std::atomic
-#include <cmath>        // std::isinf, std::sqrt
+#include <cmath>        // std::isinf, std::sqrt, std::floor
+#include <cstring>      // std::memcpy
 #include <limits>       // std::numeric_limits
-#include <type_traits>  // std::is_floating_point
+#include <type_traits>  // std::is_floating_point, std::conditional
+#include "models/murmurhash.h"
 #include "parallel/api.h"
 #include "utils/misc.h"
 #include "column.h"
@@ -40,11 +43,39 @@ static const char* stat_name(Stat s) {
     case Stat::Mode:    return "Mode";
     case Stat::NModal:  return "NModal";
     case Stat::NUnique: return "NUnique";
+    case Stat::NUniqueApprox: return "NUniqueApprox";
+    case Stat::QtApprox: return "QtApprox";
   }
   throw RuntimeError() << "Unknown stat " << int(s);
 }
 
 
+// Rows are split into chunks of this size when building the sketches. Each
+// chunk gets its own quantile sketch, and the sketches are then merged in the
+// order of chunks, so that the result does not depend on the number of
+// threads.
+static constexpr size_t SKETCH_CHUNK_SIZE = 65536;
+
+template <typename T>
+static inline uint64_t hash_value(T x) {
+  return dt::hash_u64(static_cast<uint64_t>(static_cast<int64_t>(x)));
+}
+
+// Floats are hashed by their bit patterns, so that -0.0 and 0.0 are counted
+// as distinct values, same as in the exact `nunique` (which relies on sorting)
+template <>
+inline uint64_t hash_value(double x) {
+  uint64_t u;
+  std::memcpy(&u, &x, sizeof(double));
+  return dt::hash_u64(u);
+}
+
+template <>
+inline uint64_t hash_value(float x) {
+  return hash_value<double>(static_cast<double>(x));
+}
+
+
 
 //==============================================================================
 // Base Stats
@@ -67,6 +98,13 @@ bool Stats::is_computed(Stat s) const {
   return _computed.test(static_cast<size_t>(s));
 }
 
+// Returns true if the column is known to contain no NA values. This check
+// does not trigger any computations: if the NA count was not computed yet,
+// the answer is `false`.
+bool Stats::is_na_free() const {
+  return is_computed(Stat::NaCount) && _countna == 0;
+}
+
 void Stats::set_computed(Stat s) {
   _computed.set(static_cast<size_t>(s));
 }
@@ -91,11 +129,41 @@ size_t Stats::nmodal(const Column* col) {
   return _nmodal;
 }
 
+size_t Stats::nunique_approx(const Column* col) {
+  if (!is_computed(Stat::NUniqueApprox)) compute_sketches(col);
+  return _nunique_approx;
+}
+
+double Stats::quantile_approx(const Column* col, double q) {
+  if (!is_computed(Stat::QtApprox)) compute_sketches(col);
+  return _qsketch? _qsketch->quantile(q) : GETNA<double>();
+}
+
+// Returns the quantile sketch if it was already computed, or nullptr
+// otherwise.
+dt::TDigest* Stats::get_qsketch() const {
+  return is_computed(Stat::QtApprox)? _qsketch.get() : nullptr;
+}
+
+void Stats::compute_sketches(const Column*) {
+  throw NotImplError();
+}
+
 void Stats::set_countna(size_t n) {
   set_computed(Stat::NaCount, true);
   _countna = n;
 }
 
+void Stats::set_nunique_approx(size_t n) {
+  set_computed(Stat::NUniqueApprox, true);
+  _nunique_approx = n;
+}
+
+void Stats::set_qsketch(dt::TDigest&& sketch) {
+  set_computed(Stat::QtApprox, true);
+  _qsketch = std::unique_ptr<dt::TDigest>(new dt::TDigest(std::move(sketch)));
+}
+
 size_t Stats::memory_footprint() const {
   return sizeof(*this);
 }
@@ -138,6 +206,23 @@ void Stats::verify_stat(Stat s, T value, F getter) const {
 // NumericalStats
 //==============================================================================
 
+// Integer sums are accumulated in 128 bits, so that neither the sum nor the
+// mean derived from it can wrap around. A sum that does not fit into `A` is
+// stored as NA.
+template <typename A>
+using sum_accumulator_t = typename std::conditional<
+    std::is_integral<A>::value, __int128, A>::type;
+
+template <typename A>
+static A narrow_sum(__int128 x) {
+  const __int128 limit = std::numeric_limits<A>::max();
+  return (x > limit || x < -limit)? GETNA<A>() : static_cast<A>(x);
+}
+
+template <typename A>
+static A narrow_sum(double x) { return static_cast<A>(x); }
+
+
 /**
  * Standard deviation and mean computations are done using Welford's method.
  * Ditto for skewness and kurtosis computations.
@@ -153,7 +238,7 @@ void NumericalStats_<T, A>::compute_numerical_stats(const Column* col) {
   double m2 = 0;
   double m3 = 0;
   double m4 = 0;
-  A sum = 0;
+  sum_accumulator_t<A> sum = 0;
   T min = infinity<T>();
   T max = -infinity<T>();
   std::mutex mutex;
@@ -169,7 +254,7 @@ void NumericalStats_<T, A>::compute_numerical_stats(const Column* col) {
       double t_m4 = 0;
       double t_m2_helper = 0;
 
-      A t_sum = 0;
+      sum_accumulator_t<A> t_sum = 0;
       T t_min = infinity<T>();
       T t_max = -infinity<T>();
 
@@ -182,7 +267,7 @@ void NumericalStats_<T, A>::compute_numerical_stats(const Column* col) {
           n1 = t_count_notna;
           ++t_count_notna;
           n2 = t_count_notna; // readability
-          t_sum += static_cast<A>(x);
+          t_sum += static_cast<sum_accumulator_t<A>>(x);
           if (x < t_min) t_min = x;  // Note: these ifs are not exclusive!
           if (x > t_max) t_max = x;
           double delta = static_cast<double>(x) - t_mean;
@@ -243,7 +328,7 @@ void NumericalStats_<T, A>::compute_numerical_stats(const Column* col) {
   } else {
     _min = min;
     _max = max;
-    _sum = sum;
+    _sum = narrow_sum<A>(sum);
     _mean = mean;
     _sd = count_notna > 1 ? std::sqrt(m2 / (count_notna - 1)) : 0;
     _skew = count_notna > 1 ? std::sqrt(count_notna) * m3/std::pow(m2,1.5) : 0;
@@ -299,6 +384,77 @@ void NumericalStats_<T, A>::compute_sorted_stats(const Column* col) {
 }
 
 
+/**
+ * Build the HyperLogLog and t-digest sketches of the column in a single
+ * parallel pass. Each thread keeps its own HyperLogLog sketch, whereas the
+ * quantile sketches are built per chunk of rows (see SKETCH_CHUNK_SIZE).
+ */
+template <typename T, typename A>
+void NumericalStats_<T, A>::compute_sketches(const Column* col) {
+  size_t nrows = col->nrows;
+  const RowIndex& rowindex = col->rowindex();
+  const T* data = static_cast<const T*>(col->data());
+  size_t nchunks = (nrows + SKETCH_CHUNK_SIZE - 1) / SKETCH_CHUNK_SIZE;
+  size_t nthreads = std::max(size_t(1),
+                             std::min(nchunks, dt::num_threads_in_pool()));
+  std::vector<dt::HyperLogLog> hlls(nthreads);
+  std::vector<dt::TDigest> digests(nchunks);
+  std::atomic<size_t> acountna { 0 };
+
+  dt::parallel_region(nthreads,
+    [&] {
+      size_t ith = dt::this_thread_index();
+      size_t nth = dt::num_threads_in_team();
+      dt::HyperLogLog& hll = hlls[ith];
+      size_t tcountna = 0;
+      for (size_t c = ith; c < nchunks; c += nth) {
+        dt::TDigest& digest = digests[c];
+        size_t row0 = c * SKETCH_CHUNK_SIZE;
+        size_t row1 = std::min(row0 + SKETCH_CHUNK_SIZE, nrows);
+        for (size_t i = row0; i < row1; ++i) {
+          size_t j = rowindex[i];
+          T x = (j == RowIndex::NA)? GETNA<T>() : data[j];
+          if (ISNA<T>(x)) {
+            tcountna++;
+            continue;
+          }
+          hll.add(hash_value<T>(x));
+          digest.add(static_cast<double>(x));
+        }
+      }
+      acountna += tcountna;
+    });
+
+  for (size_t i = 1; i < nthreads; ++i) hlls[0].merge(hlls[i]);
+  dt::TDigest digest;
+  for (const dt::TDigest& d : digests) digest.merge(d);
+  if (!is_computed(Stat::NaCount)) set_countna(acountna.load());
+  set_nunique_approx(hlls[0].estimate());
+  set_qsketch(std::move(digest));
+}
+
+
+/**
+ * Exact quantile `q` of the column: the non-NA values are sorted, and the
+ * result is linearly interpolated between the two values whose ranks are
+ * closest to `q * (n - 1)`.
+ */
+template <typename T, typename A>
+double NumericalStats_<T, A>::quantile(const Column* col, double q) {
+  size_t na = countna(col);
+  size_t n = col->nrows - na;
+  if (n == 0) return GETNA<double>();
+  const T* data = static_cast<const T*>(col->data());
+  RowIndex ri = col->sort(nullptr);
+  double h = q * static_cast<double>(n - 1);
+  size_t lo = static_cast<size_t>(std::floor(h));
+  size_t hi = std::min(lo + 1, n - 1);
+  double xlo = static_cast<double>(data[ri[na + lo]]);
+  double xhi = static_cast<double>(data[ri[na + hi]]);
+  return xlo + (h - static_cast<double>(lo)) * (xhi - xlo);
+}
+
+
 template <typename T, typename A>
 A NumericalStats_<T, A>::sum(const Column* col) {
   if (!is_computed(Stat::Sum)) compute_numerical_stats(col);
@@ -589,6 +745,46 @@ void StringStats<T>::compute_sorted_stats(const Column* col) {
 }
 
 
+// Strings only support the approximate NUnique stat: the quantile sketch is
+// marked as computed, but left empty.
+template <typename T>
+void StringStats<T>::compute_sketches(const Column* col) {
+  const StringColumn<T>* scol = static_cast<const StringColumn<T>*>(col);
+  const RowIndex& rowindex = col->rowindex();
+  const T* offsets = scol->offsets();
+  const char* strdata = scol->strdata();
+  size_t nrows = col->nrows;
+  size_t nchunks = (nrows + SKETCH_CHUNK_SIZE - 1) / SKETCH_CHUNK_SIZE;
+  size_t nthreads = std::max(size_t(1),
+                             std::min(nchunks, dt::num_threads_in_pool()));
+  std::vector<dt::HyperLogLog> hlls(nthreads);
+
+  dt::parallel_region(nthreads,
+    [&] {
+      size_t ith = dt::this_thread_index();
+      size_t nth = dt::num_threads_in_team();
+      dt::HyperLogLog& hll = hlls[ith];
+      for (size_t c = ith; c < nchunks; c += nth) {
+        size_t row0 = c * SKETCH_CHUNK_SIZE;
+        size_t row1 = std::min(row0 + SKETCH_CHUNK_SIZE, nrows);
+        for (size_t i = row0; i < row1; ++i) {
+          size_t j = rowindex[i];
+          if (j == RowIndex::NA) continue;
+          T end = offsets[j];
+          if (ISNA<T>(end)) continue;
+          T start = offsets[j - 1] & ~GETNA<T>();
+          hll.add(hash_murmur2(strdata + start, end - start, 0));
+        }
+      }
+    });
+
+  for (size_t i = 1; i < nthreads; ++i) hlls[0].merge(hlls[i]);
+  set_nunique_approx(hlls[0].estimate());
+  _qsketch = nullptr;
+  set_computed(Stat::QtApprox);
+}
+
+
 template <typename T>
 CString StringStats<T>::mode(const Column* col) {
   if (!is_computed(Stat::Mode)) compute_sorted_stats(col);
@@ -608,6 +804,243 @@ template class StringStats<uint64_t>;
 
 
 
+//==============================================================================
+// CategoricalStats
+//==============================================================================
+
+template <typename T>
+void CategoricalStats<T>::compute_countna(const Column* col) {
+  const RowIndex& rowindex = col->rowindex();
+  size_t nrows = col->nrows;
+  std::atomic<size_t> acountna { 0 };
+  const T* codes = static_cast<const T*>(col->data());
+
+  dt::parallel_region(
+    [&] {
+      size_t tcountna = 0;
+
+      dt::parallel_for_static(nrows,
+        [&](size_t i) {
+          size_t j = rowindex[i];
+          tcountna += (j == RowIndex::NA) || ISNA<T>(codes[j]);
+        });
+
+      acountna += tcountna;
+    });
+
+  _countna = acountna.load();
+  set_computed(Stat::NaCount);
+}
+
+
+// Count the occurrences of each code. Each thread keeps its own array of
+// counts, so for the columns with many levels the counting is done in a
+// single thread, in order to limit the memory usage.
+template <typename T>
+void CategoricalStats<T>::compute_sorted_stats(const Column* col) {
+  auto ccol = static_cast<const CategoricalColumn<T>*>(col);
+  const RowIndex& rowindex = col->rowindex();
+  const T* codes = static_cast<const T*>(col->data());
+  size_t nrows = col->nrows;
+  size_t nlevels = ccol->nlevels();
+  size_t nchunks = (nrows + SKETCH_CHUNK_SIZE - 1) / SKETCH_CHUNK_SIZE;
+  size_t nthreads = std::max(size_t(1),
+                             std::min(nchunks, dt::num_threads_in_pool()));
+  if (nlevels > SKETCH_CHUNK_SIZE) nthreads = 1;
+  // The last element in each vector is the count of NAs
+  std::vector<std::vector<size_t>> counts(nthreads);
+
+  dt::parallel_region(nthreads,
+    [&] {
+      size_t ith = dt::this_thread_index();
+      size_t nth = dt::num_threads_in_team();
+      counts[ith].resize(nlevels + 1);
+      size_t* cnt = counts[ith].data();
+      for (size_t c = ith; c < nchunks; c += nth) {
+        size_t row0 = c * SKETCH_CHUNK_SIZE;
+        size_t row1 = std::min(row0 + SKETCH_CHUNK_SIZE, nrows);
+        for (size_t i = row0; i < row1; ++i) {
+          size_t j = rowindex[i];
+          T x = (j == RowIndex::NA)? GETNA<T>() : codes[j];
+          cnt[ISNA<T>(x)? nlevels : static_cast<size_t>(x)]++;
+        }
+      }
+    });
+
+  std::vector<size_t>& total = counts[0];
+  total.resize(nlevels + 1);
+  for (size_t t = 1; t < nthreads; ++t) {
+    for (size_t k = 0; k <= nlevels; ++k) total[k] += counts[t][k];
+  }
+
+  _countna = total[nlevels];
+  set_computed(Stat::NaCount);
+
+  size_t nunique = 0;
+  size_t max_count = 0;
+  _mode = GETNA<T>();
+  for (size_t k = 0; k < nlevels; ++k) {
+    nunique += (total[k] > 0);
+    if (total[k] > max_count) {
+      max_count = total[k];
+      _mode = static_cast<T>(k);
+    }
+  }
+  _nunique = nunique;
+  _nmodal = max_count;
+  set_computed(Stat::NUnique);
+  set_computed(Stat::NModal);
+  set_computed(Stat::Mode);
+}
+
+
+template <typename T>
+void CategoricalStats<T>::compute_sketches(const Column* col) {
+  if (!is_computed(Stat::NUnique)) compute_sorted_stats(col);
+  set_nunique_approx(_nunique);
+  _qsketch = nullptr;
+  set_computed(Stat::QtApprox);
+}
+
+
+template <typename T>
+T CategoricalStats<T>::mode(const Column* col) {
+  if (!is_computed(Stat::Mode)) compute_sorted_stats(col);
+  return _mode;
+}
+
+
+template <typename T>
+CategoricalStats<T>* CategoricalStats<T>::make() const {
+  return new CategoricalStats<T>();
+}
+
+
+template class CategoricalStats<uint8_t>;
+template class CategoricalStats<uint16_t>;
+template class CategoricalStats<uint32_t>;
+
+
+
+
+//==============================================================================
+// FixedStringStats
+//==============================================================================
+
+void FixedStringStats::compute_countna(const Column* col) {
+  auto xcol = static_cast<const FixedStringColumn*>(col);
+  const RowIndex& rowindex = col->rowindex();
+  size_t nrows = col->nrows;
+  size_t width = xcol->get_width();
+  std::atomic<size_t> acountna { 0 };
+  const char* data = xcol->chars();
+
+  dt::parallel_region(
+    [&] {
+      size_t tcountna = 0;
+
+      dt::parallel_for_static(nrows,
+        [&](size_t i) {
+          size_t j = rowindex[i];
+          tcountna += (j == RowIndex::NA) ||
+                      FixedStringColumn::isna(data + j * width);
+        });
+
+      acountna += tcountna;
+    });
+
+  _countna = acountna.load();
+  set_computed(Stat::NaCount);
+}
+
+
+void FixedStringStats::compute_sorted_stats(const Column* col) {
+  auto xcol = static_cast<const FixedStringColumn*>(col);
+  Groupby grpby;
+  RowIndex ri = col->sort(&grpby);
+  const int32_t* groups = grpby.offsets_r();
+  size_t n_groups = grpby.ngroups();
+
+  if (!is_computed(Stat::NaCount)) {
+    size_t j0 = ri[0];
+    bool na0 = j0 == RowIndex::NA || xcol->get_string(j0).isna();
+    _countna = na0? static_cast<size_t>(groups[1]) : 0;
+    set_computed(Stat::NaCount);
+  }
+
+  bool has_nas = (_countna > 0);
+  _nunique = n_groups - has_nas;
+  set_computed(Stat::NUnique);
+
+  size_t max_grpsize = 0;
+  size_t best_igrp = 0;
+  for (size_t i = has_nas; i < n_groups; ++i) {
+    size_t grpsize = static_cast<size_t>(groups[i + 1] - groups[i]);
+    if (grpsize > max_grpsize) {
+      max_grpsize = grpsize;
+      best_igrp = i;
+    }
+  }
+
+  _nmodal = max_grpsize;
+  _mode = max_grpsize? xcol->get_string(ri[size_t(groups[best_igrp])])
+                     : CString(nullptr, -1);
+  set_computed(Stat::NModal);
+  set_computed(Stat::Mode);
+}
+
+
+// Same as for the variable-width strings, only the approximate NUnique stat
+// is computed.
+void FixedStringStats::compute_sketches(const Column* col) {
+  auto xcol = static_cast<const FixedStringColumn*>(col);
+  const RowIndex& rowindex = col->rowindex();
+  const char* data = xcol->chars();
+  size_t width = xcol->get_width();
+  size_t nrows = col->nrows;
+  size_t nchunks = (nrows + SKETCH_CHUNK_SIZE - 1) / SKETCH_CHUNK_SIZE;
+  size_t nthreads = std::max(size_t(1),
+                             std::min(nchunks, dt::num_threads_in_pool()));
+  std::vector<dt::HyperLogLog> hlls(nthreads);
+
+  dt::parallel_region(nthreads,
+    [&] {
+      size_t ith = dt::this_thread_index();
+      size_t nth = dt::num_threads_in_team();
+      dt::HyperLogLog& hll = hlls[ith];
+      for (size_t c = ith; c < nchunks; c += nth) {
+        size_t row0 = c * SKETCH_CHUNK_SIZE;
+        size_t row1 = std::min(row0 + SKETCH_CHUNK_SIZE, nrows);
+        for (size_t i = row0; i < row1; ++i) {
+          size_t j = rowindex[i];
+          if (j == RowIndex::NA) continue;
+          const char* x = data + j * width;
+          if (FixedStringColumn::isna(x)) continue;
+          hll.add(hash_murmur2(x, width, 0));
+        }
+      }
+    });
+
+  for (size_t i = 1; i < nthreads; ++i) hlls[0].merge(hlls[i]);
+  set_nunique_approx(hlls[0].estimate());
+  _qsketch = nullptr;
+  set_computed(Stat::QtApprox);
+}
+
+
+CString FixedStringStats::mode(const Column* col) {
+  if (!is_computed(Stat::Mode)) compute_sorted_stats(col);
+  return _mode;
+}
+
+
+FixedStringStats* FixedStringStats::make() const {
+  return new FixedStringStats();
+}
+
+
+
+
 //==============================================================================
 // PyObjectStats
 //==============================================================================
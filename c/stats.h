@@ -8,7 +8,9 @@
 #ifndef dt_STATS_h
 #define dt_STATS_h
 #include <bitset>
+#include <memory>
 #include <vector>
+#include "sketch.h"
 #include "types.h"
 
 class Column;
@@ -28,9 +30,11 @@ enum class Stat : uint8_t {
   Max     = 10,
   Mode    = 11,
   NModal  = 12,
-  NUnique = 13
+  NUnique = 13,
+  NUniqueApprox = 14,
+  QtApprox = 15
 };
-constexpr uint8_t NSTATS = 14;
+constexpr uint8_t NSTATS = 16;
 
 
 
@@ -68,6 +72,13 @@ constexpr uint8_t NSTATS = 14;
  *       from the provided column.
  *   <S>_get() - retrieve the value of computed statistic (but the user should
  *       check its availability first).
+ *
+ * Stats `NUniqueApprox` and `QtApprox` are approximate counterparts of
+ * `NUnique` and the quantiles. They are computed in a single parallel pass over
+ * the data (without sorting), using the HyperLogLog sketch for the number of
+ * unique values, and the t-digest sketch for the quantiles. The quantile
+ * sketch is kept in the Stats object, so that any quantile can be retrieved
+ * once the sketch was built.
  */
 class Stats {
   protected:
@@ -75,6 +86,8 @@ class Stats {
     size_t _countna;
     size_t _nunique;
     size_t _nmodal;
+    size_t _nunique_approx;
+    std::unique_ptr<dt::TDigest> _qsketch;
 
   public:
     Stats();
@@ -85,10 +98,16 @@ class Stats {
     size_t countna(const Column*);
     size_t nunique(const Column*);
     size_t nmodal(const Column*);
+    size_t nunique_approx(const Column*);
+    double quantile_approx(const Column*, double q);
+    dt::TDigest* get_qsketch() const;
 
     bool is_computed(Stat s) const;
+    bool is_na_free() const;
     void reset();
     void set_countna(size_t n);
+    void set_nunique_approx(size_t n);
+    void set_qsketch(dt::TDigest&& sketch);
     virtual void merge_stats(const Stats*);
 
     virtual size_t memory_footprint() const = 0;
@@ -101,6 +120,7 @@ class Stats {
 
     virtual void compute_countna(const Column*) = 0;
     virtual void compute_sorted_stats(const Column*) = 0;
+    virtual void compute_sketches(const Column*);
     void set_computed(Stat s);
     void set_computed(Stat s, bool flag);
 };
@@ -145,6 +165,7 @@ class NumericalStats_ : public Stats {
     T max(const Column*);
     T mode(const Column*);
     A sum(const Column*);
+    double quantile(const Column*, double q);
 
     void set_min(T value);
     void set_max(T value);
@@ -157,6 +178,7 @@ class NumericalStats_ : public Stats {
     // Helper method that computes min, max, sum, mean, sd, and countna
     virtual void compute_numerical_stats(const Column*);
     virtual void compute_sorted_stats(const Column*) override;
+    virtual void compute_sketches(const Column*) override;
     virtual void compute_countna(const Column*) override;
 };
 
@@ -260,6 +282,7 @@ class StringStats : public Stats {
     StringStats<T>* make() const override;
     void compute_countna(const Column*) override;
     void compute_sorted_stats(const Column*) override;
+    void compute_sketches(const Column*) override;
 };
 
 extern template class StringStats<uint32_t>;
@@ -267,6 +290,64 @@ extern template class StringStats<uint64_t>;
 
 
 
+//------------------------------------------------------------------------------
+// CategoricalStats class
+//------------------------------------------------------------------------------
+
+/**
+ * Stats for categorical columns, parametrized by the type `T` of the codes.
+ * All stats are computed from the counts of each code, without sorting. The
+ * approximate NUnique is the same as the exact one.
+ */
+template <typename T>
+class CategoricalStats : public Stats {
+  private:
+    T _mode;
+    size_t : (64 - 8 * sizeof(T)) % 64;
+
+  public:
+    virtual size_t memory_footprint() const override { return sizeof(*this); }
+
+    T mode(const Column*);
+
+  protected:
+    CategoricalStats<T>* make() const override;
+    void compute_countna(const Column*) override;
+    void compute_sorted_stats(const Column*) override;
+    void compute_sketches(const Column*) override;
+};
+
+extern template class CategoricalStats<uint8_t>;
+extern template class CategoricalStats<uint16_t>;
+extern template class CategoricalStats<uint32_t>;
+
+
+
+//------------------------------------------------------------------------------
+// FixedStringStats class
+//------------------------------------------------------------------------------
+
+/**
+ * Stats for fixed-width string columns. The mode is a CString that points
+ * into the data of the column, with the \0-padding stripped.
+ */
+class FixedStringStats : public Stats {
+  private:
+    CString _mode;
+
+  public:
+    virtual size_t memory_footprint() const override { return sizeof(*this); }
+
+    CString mode(const Column*);
+
+  protected:
+    FixedStringStats* make() const override;
+    void compute_countna(const Column*) override;
+    void compute_sorted_stats(const Column*) override;
+    void compute_sketches(const Column*) override;
+};
+
+
 //------------------------------------------------------------------------------
 // PyObjectStats class
 //------------------------------------------------------------------------------
@@ -109,7 +109,7 @@ void init_types(void)
   STI(SType::DEC64,   "d8", "dec64",   8, 0, LType::REAL);
   STI(SType::STR32,   "s4", "str32",   4, 1, LType::STRING);
   STI(SType::STR64,   "s8", "str64",   8, 1, LType::STRING);
-  STI(SType::FSTR,    "sx", "strfix",  0, 0, LType::STRING);
+  STI(SType::FSTR,    "sx", "fstr",    0, 1, LType::STRING);
   STI(SType::CAT8,    "e1", "cat8",    1, 1, LType::STRING);
   STI(SType::CAT16,   "e2", "cat16",   2, 1, LType::STRING);
   STI(SType::CAT32,   "e4", "cat32",   4, 1, LType::STRING);
@@ -124,13 +124,15 @@ void init_types(void)
       stype_upcast_map[int(stype1)][int(stype2)] = stypeR; \
       stype_upcast_map[int(stype2)][int(stype1)] = stypeR;
 
+  // Temporal columns are exported into buffers as python objects, since
+  // there is no buffer format for them.
   for (size_t i = 1; i < DT_STYPES_COUNT; i++) {
     SType i_stype = static_cast<SType>(i);
-    stype_upcast_map[i][0] = stype_info[i].varwidth? SType::OBJ : i_stype;
-    stype_upcast_map[0][i] = stype_info[i].varwidth? SType::OBJ : i_stype;
+    bool as_obj = stype_info[i].varwidth || is_temporal(i_stype);
+    stype_upcast_map[i][0] = as_obj? SType::OBJ : i_stype;
+    stype_upcast_map[0][i] = as_obj? SType::OBJ : i_stype;
     for (size_t j = 1; j < DT_STYPES_COUNT; j++) {
-      stype_upcast_map[i][j] =
-        stype_info[i].varwidth || i != j ? SType::OBJ : i_stype;
+      stype_upcast_map[i][j] = as_obj || i != j ? SType::OBJ : i_stype;
     }
   }
   UPCAST(SType::BOOL,  SType::INT8,    SType::INT8)
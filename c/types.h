@@ -226,29 +226,27 @@ constexpr size_t DT_LTYPES_COUNT = static_cast<size_t>(LType::OBJECT) + 1;
  *     String column stored as a categorical variable (aka "factor" or "enum").
  *     This type is suitable for columns with low cardinality, i.e. having no
  *     more than 255 distinct string values.
- *     The data is stored in a buffer with 3 regions: first comes the string
- *     data, padded to a multiple of 8 bytes; then comes the array of int32
- *     offsets within the data buffer, these offsets describe the boundaries of
- *     individual strings within the data section (this array is also padded
- *     to a multiple of 8 bytes); finally comes the array of categorical
- *     indices. Meta information contains offsets of the second and the third
- *     sections. The layout of the first 2 sections is exactly the same as
- *     that of the SType::STR32 type.
+ *     The main data buffer contains the array of categorical codes, one per
+ *     row. The distinct values ("levels") are kept in a separate string
+ *     column (of type STR32 or STR64), which is sorted and has no NAs or
+ *     duplicates. Code `k` refers to the `k`-th level; since the levels are
+ *     sorted, the order of the codes is the same as the order of the strings.
+ *     The levels column is shared among all shallow copies of the column.
  *
  * SType::CAT16
  *     elem: uint16_t (2 bytes)
  *     NA:   65535
  *     Strings stored as a categorical variable with no more than 65535 distinct
- *     levels. The layout is exactly the same as that of CAT8, only
- *     the last section uses 2 bytes per element instead of just 1 byte.
+ *     levels. The layout is exactly the same as that of CAT8, only the codes
+ *     use 2 bytes per element instead of just 1 byte.
  *
  * SType::CAT32
  *     elem: uint32_t (4 bytes)
- *     NA:   2**32-1
- *     Strings stored as a categorical variable with no more than 2**32-1
- *     distinct levels. (The combined size of all categorical strings may not
- *     exceed 2**32 too). The layout is same as that of CAT8, only
- *     the last section uses 4 bytes per element instead of just 1 byte.
+ *     NA:   2**31
+ *     Strings stored as a categorical variable with no more than 2**31
+ *     distinct levels. The layout is same as that of CAT8, only the codes use
+ *     4 bytes per element instead of just 1 byte. The NA value is the same as
+ *     the NA flag in the offsets of STR32 columns.
  *
  *
  * -----------------------------------------------------------------------------
@@ -256,15 +254,16 @@ constexpr size_t DT_LTYPES_COUNT = static_cast<size_t>(LType::OBJECT) + 1;
  * SType::DATE64
  *     elem: int64_t (8 bytes)
  *     NA:   -2**63
- *     Timestamp, stored as the number of microseconds since 0000-03-01. The
- *     allowed time range is ≈290,000 years around the epoch. The time is
- *     assumed to be in UTC, and does not allow specifying a time zone.
+ *     Timestamp, stored as the number of microseconds since
+ *     1970-01-01T00:00:00. The allowed time range is ≈290,000 years around
+ *     the epoch. The time is assumed to be in UTC, and does not allow
+ *     specifying a time zone.
  *
  * SType::DATE32
  *     elem: int32_t (4 bytes)
  *     NA:   -2**31
- *     Date only: the number of days since 0000-03-01. The allowed time range
- *     is ≈245,000 years.
+ *     Date only: the number of days since 1970-01-01. The allowed time range
+ *     is ≈5,800,000 years.
  *
  * SType::DATE16
  *     elem: int16_t (2 bytes)
@@ -316,6 +315,21 @@ enum class SType : uint8_t {
 
 constexpr size_t DT_STYPES_COUNT = static_cast<size_t>(SType::OBJ) + 1;
 
+// True for the stypes CAT8, CAT16 and CAT32
+inline constexpr bool is_categorical(SType s) {
+  return s == SType::CAT8 || s == SType::CAT16 || s == SType::CAT32;
+}
+
+// True for the stypes DATE32, DATE64 and TIME32
+inline constexpr bool is_temporal(SType s) {
+  return s == SType::DATE32 || s == SType::DATE64 || s == SType::TIME32;
+}
+
+// True for the stypes DEC16, DEC32 and DEC64
+inline constexpr bool is_decimal(SType s) {
+  return s == SType::DEC16 || s == SType::DEC32 || s == SType::DEC64;
+}
+
 
 
 //==============================================================================
@@ -368,6 +382,8 @@ template<> constexpr int8_t   GETNA() { return NA_I1; }
 template<> constexpr int16_t  GETNA() { return NA_I2; }
 template<> constexpr int32_t  GETNA() { return NA_I4; }
 template<> constexpr int64_t  GETNA() { return NA_I8; }
+template<> constexpr uint8_t  GETNA() { return NA_U1; }
+template<> constexpr uint16_t GETNA() { return NA_U2; }
 template<> constexpr uint32_t GETNA() { return NA_S4; }
 template<> constexpr uint64_t GETNA() { return NA_S8; }
 template<> constexpr float    GETNA() { return NA_F4; }
@@ -385,6 +401,8 @@ template<> inline bool ISNA(int8_t x)   { return x == NA_I1; }
 template<> inline bool ISNA(int16_t x)  { return x == NA_I2; }
 template<> inline bool ISNA(int32_t x)  { return x == NA_I4; }
 template<> inline bool ISNA(int64_t x)  { return x == NA_I8; }
+template<> inline bool ISNA(uint8_t x)  { return x == NA_U1; }
+template<> inline bool ISNA(uint16_t x) { return x == NA_U2; }
 template<> inline bool ISNA(uint32_t x) { return (x & NA_S4); }
 template<> inline bool ISNA(uint64_t x) { return (x & NA_S8); }
 template<> inline bool ISNA(float x)    { return std::isnan(x); }
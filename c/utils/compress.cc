@@ -0,0 +1,436 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include <algorithm>    // std::min
+#include <cstring>      // std::memcpy, std::memset
+#include <initializer_list>
+#ifndef _WIN32
+  #include <dlfcn.h>    // dlopen, dlsym
+#endif
+#include "utils/compress.h"
+#include "utils/exceptions.h"
+
+
+/**
+ * Load the first available shared library from the list `names`, and return
+ * its handle. The library is never unloaded.
+ */
+static void* load_library(std::initializer_list<const char*> names,
+                          const char* method)
+{
+  #ifndef _WIN32
+    for (const char* name : names) {
+      void* lib = dlopen(name, RTLD_NOW | RTLD_LOCAL);
+      if (lib) return lib;
+    }
+    throw ImportError() << "Unable to load library " << *names.begin()
+        << ", which is required for `" << method << "` compression";
+  #else
+    (void) names;
+    throw NotImplError() << "`" << method << "` compression is not "
+        "supported on this platform";
+  #endif
+}
+
+
+template <typename F>
+static F load_symbol(void* lib, const char* name) {
+  #ifndef _WIN32
+    void* ptr = dlsym(lib, name);
+    if (ptr) return reinterpret_cast<F>(ptr);
+  #endif
+  (void) lib;
+  throw ImportError() << "Function " << name << " is not found in the "
+      "compression library";
+}
+
+
+Compressor::~Compressor() {}
+
+
+
+//------------------------------------------------------------------------------
+// gzip
+//------------------------------------------------------------------------------
+
+// The compression uses only the "utility" functions of zlib, since their
+// signatures do not depend on the zlib's structs declared in "zlib.h". The
+// decompression requires the streaming API (the utility `uncompress()` does
+// not understand the gzip wrapper); its `z_stream` struct is declared below
+// as `ZStream`. The layout of this struct has not changed since zlib 1.0,
+// and `inflateInit2_()` verifies that the size of the struct is as expected.
+struct ZStream {
+  const unsigned char* next_in;
+  unsigned int avail_in;
+  unsigned long total_in;
+  unsigned char* next_out;
+  unsigned int avail_out;
+  unsigned long total_out;
+  const char* msg;
+  void* state;
+  void* zalloc;
+  void* zfree;
+  void* opaque;
+  int data_type;
+  unsigned long adler;
+  unsigned long reserved;
+};
+
+struct ZlibApi {
+  using compress2_fn = int(*)(unsigned char*, unsigned long*,
+                              const unsigned char*, unsigned long, int);
+  using compressBound_fn = unsigned long(*)(unsigned long);
+  using crc32_fn = unsigned long(*)(unsigned long, const unsigned char*,
+                                    unsigned int);
+  using inflateInit2_fn = int(*)(ZStream*, int, const char*, int);
+  using inflate_fn = int(*)(ZStream*, int);
+  using inflateReset_fn = int(*)(ZStream*);
+  using inflateEnd_fn = int(*)(ZStream*);
+  compress2_fn compress2;
+  compressBound_fn compressBound;
+  crc32_fn crc32;
+  inflateInit2_fn inflateInit2;
+  inflate_fn inflate;
+  inflateReset_fn inflateReset;
+  inflateEnd_fn inflateEnd;
+
+  ZlibApi() {
+    void* lib = load_library({"libz.so.1", "libz.so", "libz.1.dylib",
+                              "libz.dylib"}, "gzip");
+    compress2 = load_symbol<compress2_fn>(lib, "compress2");
+    compressBound = load_symbol<compressBound_fn>(lib, "compressBound");
+    crc32 = load_symbol<crc32_fn>(lib, "crc32");
+    inflateInit2 = load_symbol<inflateInit2_fn>(lib, "inflateInit2_");
+    inflate = load_symbol<inflate_fn>(lib, "inflate");
+    inflateReset = load_symbol<inflateReset_fn>(lib, "inflateReset");
+    inflateEnd = load_symbol<inflateEnd_fn>(lib, "inflateEnd");
+  }
+};
+
+
+/**
+ * Each block is written as a gzip member (RFC 1952): a 10-byte header, raw
+ * deflate stream, and an 8-byte trailer with the CRC32 and the size of the
+ * uncompressed data.
+ *
+ * The deflate stream is produced by zlib's `compress2()`, which wraps it into
+ * the zlib format (RFC 1950): a 2-byte header in front, and 4-byte Adler32
+ * checksum at the end. The compressed data is placed into the output buffer
+ * so that the zlib header falls into the last 2 bytes of the gzip header,
+ * which are then overwritten; and the Adler32 checksum is overwritten by the
+ * gzip trailer.
+ */
+class GzipCompressor : public Compressor {
+  private:
+    static constexpr size_t HEADER_SIZE = 10;
+    static constexpr size_t TRAILER_SIZE = 8;
+    static constexpr int Z_OK = 0;
+    static constexpr int Z_STREAM_END = 1;
+    static constexpr int Z_NO_FLUSH = 0;
+    static constexpr int Z_DEFAULT_COMPRESSION = -1;
+    const ZlibApi& z;
+
+  public:
+    explicit GzipCompressor(const ZlibApi& api) : z(api) {}
+
+    const char* name() const override { return "gzip"; }
+
+    size_t max_compressed_size(size_t n) const override {
+      return z.compressBound(n) + HEADER_SIZE + TRAILER_SIZE;
+    }
+
+    size_t compress(const char* src, size_t n, char* dst, size_t cap)
+      const override
+    {
+      auto usrc = reinterpret_cast<const unsigned char*>(src);
+      auto udst = reinterpret_cast<unsigned char*>(dst);
+      // The zlib output starts 2 bytes before the end of the gzip header, and
+      // its 4-byte checksum is replaced with the 8-byte gzip trailer.
+      unsigned long zsize = cap - HEADER_SIZE - TRAILER_SIZE + 6;
+      int ret = z.compress2(udst + HEADER_SIZE - 2, &zsize, usrc, n,
+                            Z_DEFAULT_COMPRESSION);
+      if (ret != Z_OK || zsize < 6) {
+        throw RuntimeError() << "gzip compression failed with error " << ret;
+      }
+      static const unsigned char header[HEADER_SIZE] = {
+        0x1F, 0x8B,  // magic number
+        8,           // compression method: deflate
+        0,           // flags
+        0, 0, 0, 0,  // modification time: not available
+        0,           // extra flags
+        0xFF         // operating system: unknown
+      };
+      std::memcpy(udst, header, HEADER_SIZE);
+
+      unsigned long crc = 0;
+      for (size_t i = 0; i < n; ) {
+        size_t len = std::min(n - i, size_t(1) << 30);
+        crc = z.crc32(crc, usrc + i, static_cast<unsigned int>(len));
+        i += len;
+      }
+      size_t end = HEADER_SIZE + zsize - 6;  // without the zlib wrapper
+      put_u32(udst + end, crc);
+      put_u32(udst + end + 4, n);
+      return end + TRAILER_SIZE;
+    }
+
+    // The input may consist of several gzip members (or zlib streams), in
+    // which case they are decompressed one after another.
+    void decompress(const char* src, size_t n, char* dst, size_t dstsize)
+      const override
+    {
+      // windowBits = 15 + 32 enables automatic detection of gzip and zlib
+      // headers. The version string is only checked for the major version.
+      ZStream strm;
+      std::memset(&strm, 0, sizeof(ZStream));
+      int ret = z.inflateInit2(&strm, 15 + 32, "1.2.11",
+                               static_cast<int>(sizeof(ZStream)));
+      if (ret != Z_OK) {
+        throw RuntimeError() << "Cannot initialize gzip decompression: error "
+            << ret;
+      }
+      strm.next_in = reinterpret_cast<const unsigned char*>(src);
+      strm.next_out = reinterpret_cast<unsigned char*>(dst);
+      size_t ipos = 0, opos = 0;
+      while (true) {
+        // The sizes in z_stream are 32-bit, so the data is fed in parts
+        size_t isize = std::min(n - ipos, size_t(1) << 30);
+        size_t osize = std::min(dstsize - opos, size_t(1) << 30);
+        strm.avail_in = static_cast<unsigned int>(isize);
+        strm.avail_out = static_cast<unsigned int>(osize);
+        ret = z.inflate(&strm, Z_NO_FLUSH);
+        ipos += isize - strm.avail_in;
+        opos += osize - strm.avail_out;
+        if (ret == Z_STREAM_END) {
+          if (ipos == n) break;
+          ret = z.inflateReset(&strm);
+          if (ret != Z_OK) break;
+        }
+        else if (ret != Z_OK || (isize == strm.avail_in &&
+                                 osize == strm.avail_out)) break;
+      }
+      z.inflateEnd(&strm);
+      if (ret != Z_STREAM_END) {
+        throw IOError() << "gzip decompression failed with error " << ret;
+      }
+      if (opos != dstsize) {
+        throw IOError() << "gzip-compressed data was expected to contain "
+            << dstsize << " bytes, instead found " << opos;
+      }
+    }
+
+  private:
+    static void put_u32(unsigned char* p, size_t value) {
+      for (int i = 0; i < 4; ++i) {
+        p[i] = static_cast<unsigned char>(value >> (8 * i));
+      }
+    }
+};
+
+
+
+//------------------------------------------------------------------------------
+// zstd
+//------------------------------------------------------------------------------
+
+struct ZstdApi {
+  using compress_fn = size_t(*)(void*, size_t, const void*, size_t, int);
+  using decompress_fn = size_t(*)(void*, size_t, const void*, size_t);
+  using compressBound_fn = size_t(*)(size_t);
+  using isError_fn = unsigned(*)(size_t);
+  using getErrorName_fn = const char*(*)(size_t);
+  compress_fn compress;
+  decompress_fn decompress;
+  compressBound_fn compressBound;
+  isError_fn isError;
+  getErrorName_fn getErrorName;
+
+  ZstdApi() {
+    void* lib = load_library({"libzstd.so.1", "libzstd.so", "libzstd.1.dylib",
+                              "libzstd.dylib"}, "zstd");
+    compress = load_symbol<compress_fn>(lib, "ZSTD_compress");
+    decompress = load_symbol<decompress_fn>(lib, "ZSTD_decompress");
+    compressBound = load_symbol<compressBound_fn>(lib, "ZSTD_compressBound");
+    isError = load_symbol<isError_fn>(lib, "ZSTD_isError");
+    getErrorName = load_symbol<getErrorName_fn>(lib, "ZSTD_getErrorName");
+  }
+};
+
+
+/**
+ * Each block is written as a separate zstd frame, using the one-shot
+ * `ZSTD_compress()` function (which also records the size of the
+ * uncompressed data in the frame header).
+ */
+class ZstdCompressor : public Compressor {
+  private:
+    static constexpr int DEFAULT_LEVEL = 3;
+    const ZstdApi& z;
+
+  public:
+    explicit ZstdCompressor(const ZstdApi& api) : z(api) {}
+
+    const char* name() const override { return "zstd"; }
+
+    size_t max_compressed_size(size_t n) const override {
+      return z.compressBound(n);
+    }
+
+    size_t compress(const char* src, size_t n, char* dst, size_t cap)
+      const override
+    {
+      size_t ret = z.compress(dst, cap, src, n, DEFAULT_LEVEL);
+      if (z.isError(ret)) {
+        throw RuntimeError() << "zstd compression failed: "
+            << z.getErrorName(ret);
+      }
+      return ret;
+    }
+
+    void decompress(const char* src, size_t n, char* dst, size_t dstsize)
+      const override
+    {
+      size_t ret = z.decompress(dst, dstsize, src, n);
+      if (z.isError(ret)) {
+        throw IOError() << "zstd decompression failed: "
+            << z.getErrorName(ret);
+      }
+      if (ret != dstsize) {
+        throw IOError() << "zstd-compressed data was expected to contain "
+            << dstsize << " bytes, instead found " << ret;
+      }
+    }
+};
+
+
+
+//------------------------------------------------------------------------------
+// lz4
+//------------------------------------------------------------------------------
+
+// The "frame" API of liblz4 is used (rather than the raw block functions),
+// so that the output is a valid .lz4 file. The preferences and decompression
+// options are always passed as NULL, which selects the defaults.
+struct Lz4Api {
+  using compressFrame_fn = size_t(*)(void*, size_t, const void*, size_t,
+                                     const void*);
+  using compressFrameBound_fn = size_t(*)(size_t, const void*);
+  using createDCtx_fn = size_t(*)(void**, unsigned);
+  using freeDCtx_fn = size_t(*)(void*);
+  using decompress_fn = size_t(*)(void*, void*, size_t*, const void*, size_t*,
+                                  const void*);
+  using isError_fn = unsigned(*)(size_t);
+  using getErrorName_fn = const char*(*)(size_t);
+  compressFrame_fn compressFrame;
+  compressFrameBound_fn compressFrameBound;
+  createDCtx_fn createDCtx;
+  freeDCtx_fn freeDCtx;
+  decompress_fn decompress;
+  isError_fn isError;
+  getErrorName_fn getErrorName;
+
+  Lz4Api() {
+    void* lib = load_library({"liblz4.so.1", "liblz4.so", "liblz4.1.dylib",
+                              "liblz4.dylib"}, "lz4");
+    compressFrame = load_symbol<compressFrame_fn>(lib, "LZ4F_compressFrame");
+    compressFrameBound =
+        load_symbol<compressFrameBound_fn>(lib, "LZ4F_compressFrameBound");
+    createDCtx = load_symbol<createDCtx_fn>(
+                    lib, "LZ4F_createDecompressionContext");
+    freeDCtx = load_symbol<freeDCtx_fn>(lib, "LZ4F_freeDecompressionContext");
+    decompress = load_symbol<decompress_fn>(lib, "LZ4F_decompress");
+    isError = load_symbol<isError_fn>(lib, "LZ4F_isError");
+    getErrorName = load_symbol<getErrorName_fn>(lib, "LZ4F_getErrorName");
+  }
+};
+
+
+/**
+ * Each block is written as a separate lz4 frame. The lz4 format is much
+ * faster than gzip or zstd (especially for decompression), at the cost of a
+ * lower compression ratio.
+ */
+class Lz4Compressor : public Compressor {
+  private:
+    static constexpr unsigned LZ4F_VERSION = 100;
+    const Lz4Api& z;
+
+  public:
+    explicit Lz4Compressor(const Lz4Api& api) : z(api) {}
+
+    const char* name() const override { return "lz4"; }
+
+    size_t max_compressed_size(size_t n) const override {
+      return z.compressFrameBound(n, nullptr);
+    }
+
+    size_t compress(const char* src, size_t n, char* dst, size_t cap)
+      const override
+    {
+      size_t ret = z.compressFrame(dst, cap, src, n, nullptr);
+      if (z.isError(ret)) {
+        throw RuntimeError() << "lz4 compression failed: "
+            << z.getErrorName(ret);
+      }
+      return ret;
+    }
+
+    void decompress(const char* src, size_t n, char* dst, size_t dstsize)
+      const override
+    {
+      void* dctx = nullptr;
+      size_t ret = z.createDCtx(&dctx, LZ4F_VERSION);
+      if (z.isError(ret)) {
+        throw RuntimeError() << "Cannot create lz4 decompression context: "
+            << z.getErrorName(ret);
+      }
+      // `LZ4F_decompress()` returns 0 once the end of the frame is reached,
+      // otherwise it may have to be called again to make further progress.
+      size_t ipos = 0, opos = 0;
+      while (true) {
+        size_t isize = n - ipos;
+        size_t osize = dstsize - opos;
+        ret = z.decompress(dctx, dst + opos, &osize, src + ipos, &isize,
+                           nullptr);
+        if (z.isError(ret)) break;
+        ipos += isize;
+        opos += osize;
+        if (ret == 0 || (isize == 0 && osize == 0)) break;
+      }
+      z.freeDCtx(dctx);
+      if (z.isError(ret)) {
+        throw IOError() << "lz4 decompression failed: " << z.getErrorName(ret);
+      }
+      if (ret != 0 || opos != dstsize || ipos != n) {
+        throw IOError() << "lz4-compressed data was expected to contain "
+            << dstsize << " bytes, instead found " << opos
+            << (ret? " or more" : "");
+      }
+    }
+};
+
+
+
+//------------------------------------------------------------------------------
+// Factory
+//------------------------------------------------------------------------------
+
+std::unique_ptr<Compressor> Compressor::make(const std::string& method) {
+  if (method == "gzip") {
+    static ZlibApi api;
+    return std::unique_ptr<Compressor>(new GzipCompressor(api));
+  }
+  if (method == "zstd") {
+    static ZstdApi api;
+    return std::unique_ptr<Compressor>(new ZstdCompressor(api));
+  }
+  if (method == "lz4") {
+    static Lz4Api api;
+    return std::unique_ptr<Compressor>(new Lz4Compressor(api));
+  }
+  throw ValueError() << "Unsupported compression method `" << method << "`";
+}
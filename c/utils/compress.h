@@ -0,0 +1,54 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#ifndef dt_UTILS_COMPRESS_h
+#define dt_UTILS_COMPRESS_h
+#include <memory>
+#include <string>
+
+
+/**
+ * Block compressor / decompressor. Each block of data is compressed
+ * independently into a self-contained unit: a gzip member, a zstd frame, or
+ * an lz4 frame. Concatenation of such units is a valid compressed file, which
+ * allows the blocks to be compressed in parallel and then written out in
+ * order. This is used by CsvWriter, and for the compressed column blocks in
+ * Jay files.
+ *
+ * The codec libraries (zlib, libzstd and liblz4) are not linked into
+ * datatable, but loaded at runtime when the compressor is first created. If
+ * the library cannot be found, an ImportError is thrown.
+ *
+ * Methods `compress()` and `decompress()` may be called from multiple threads
+ * simultaneously.
+ */
+class Compressor {
+  public:
+    static std::unique_ptr<Compressor> make(const std::string& method);
+    virtual ~Compressor();
+
+    virtual const char* name() const = 0;
+
+    // Upper bound on the size of the compressed output for an input of
+    // `n` bytes.
+    virtual size_t max_compressed_size(size_t n) const = 0;
+
+    // Compress `n` bytes at `src` into the buffer `dst` of size `cap` (which
+    // should be at least `max_compressed_size(n)`), and return the size of
+    // the compressed data.
+    virtual size_t compress(const char* src, size_t n,
+                            char* dst, size_t cap) const = 0;
+
+    // Decompress a single unit of `n` bytes at `src` into the buffer `dst`.
+    // The size of the decompressed data must be exactly `dstsize` bytes,
+    // otherwise an IOError is thrown.
+    virtual void decompress(const char* src, size_t n,
+                            char* dst, size_t dstsize) const = 0;
+};
+
+
+#endif
@@ -0,0 +1,84 @@
+//------------------------------------------------------------------------------
+// Copyright 2018 H2O.ai
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//------------------------------------------------------------------------------
+#include <string>
+#include "python/string.h"
+#include "utils/cpu.h"
+#include "utils/exceptions.h"
+#include "utils/macros.h"
+#include "options.h"
+namespace dt {
+
+static const char* level_names[] = {"none", "avx2", "avx512"};
+
+
+static SimdLevel detect_simd_level() {
+  #if DT_SIMD_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") &&
+        __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512dq") &&
+        __builtin_cpu_supports("avx512vl")) return SimdLevel::AVX512;
+    if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+  #endif
+  return SimdLevel::NONE;
+}
+
+static SimdLevel max_simd_level = detect_simd_level();
+static SimdLevel simd_level = max_simd_level;
+
+
+SimdLevel get_simd_level() {
+  return simd_level;
+}
+
+
+void cpu_init_options() {
+  dt::register_option(
+    "simd",
+    []{
+      return py::ostring(level_names[static_cast<int>(simd_level)]);
+    },
+    [](py::oobj value) {
+      std::string name = value.to_string();
+      std::string supported;
+      for (int i = 0; i <= static_cast<int>(max_simd_level); ++i) {
+        if (name == level_names[i]) {
+          simd_level = static_cast<SimdLevel>(i);
+          return;
+        }
+        if (i) supported += ", ";
+        supported += level_names[i];
+      }
+      throw ValueError() << "Invalid value for option `simd`: `" << name
+          << "`. Supported levels on this CPU are: " << supported;
+    },
+    "The instruction set extensions used by datatable's vectorized\n"
+    "kernels: 'avx512', 'avx2' or 'none'.\n"
+    "\n"
+    "By default, this option is set to the best level supported by the\n"
+    "current CPU. It can be lowered (for example, for benchmarking or\n"
+    "testing purposes), but not raised above what the CPU supports.\n"
+  );
+}
+
+
+}  // namespace dt
@@ -0,0 +1,49 @@
+//------------------------------------------------------------------------------
+// Copyright 2018 H2O.ai
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//------------------------------------------------------------------------------
+#ifndef dt_UTILS_CPU_h
+#define dt_UTILS_CPU_h
+#include <cstdint>
+namespace dt {
+
+
+/**
+ * Instruction set extensions for which some of the hot loops have
+ * specialized versions, selected at runtime (see TARGET_AVX2 / TARGET_AVX512
+ * in "utils/macros.h").
+ *
+ * `get_simd_level()` returns the level currently in effect: this is the best
+ * level supported by the CPU, unless the user lowered it via option
+ * `dt.options.simd`.
+ */
+enum class SimdLevel : uint8_t {
+  NONE   = 0,
+  AVX2   = 1,
+  AVX512 = 2,
+};
+
+SimdLevel get_simd_level();
+
+void cpu_init_options();
+
+
+}  // namespace dt
+#endif
@@ -0,0 +1,261 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include "utils/datetime.h"
+#include "read/fread/fread_swar.h"   // load8, read_digits
+namespace dt {
+
+
+
+//------------------------------------------------------------------------------
+// Calendar arithmetic
+//------------------------------------------------------------------------------
+
+int64_t days_from_civil(int64_t year, int month, int day) {
+  year -= (month <= 2);
+  int64_t era = (year >= 0 ? year : year - 399) / 400;
+  int64_t yoe = year - era * 400;
+  int64_t doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + doe - 719468;
+}
+
+
+void civil_from_days(int64_t days, int64_t* year, int* month, int* day) {
+  days += 719468;
+  int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+  int64_t doe = days - era * 146097;
+  int64_t yoe = (doe - doe/1460 + doe/36524 - doe/146096) / 365;
+  int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  int64_t mp = (5 * doy + 2) / 153;
+  int m = static_cast<int>(mp < 10 ? mp + 3 : mp - 9);
+  *day = static_cast<int>(doy - (153 * mp + 2) / 5 + 1);
+  *month = m;
+  *year = yoe + era * 400 + (m <= 2);
+}
+
+
+static int days_in_month(int64_t year, int month) {
+  static const int8_t mdays[12] = {31, 28, 31, 30, 31, 30,
+                                   31, 31, 30, 31, 30, 31};
+  bool leap = (year % 4 == 0) && (year % 100 != 0 || year % 400 == 0);
+  return mdays[month - 1] + (month == 2 && leap);
+}
+
+
+int64_t date64_days(int64_t micros) {
+  int64_t days = micros / MICROS_PER_DAY;
+  return days - (micros % MICROS_PER_DAY < 0);
+}
+
+int64_t date64_time(int64_t micros) {
+  int64_t t = micros % MICROS_PER_DAY;
+  return t < 0? t + MICROS_PER_DAY : t;
+}
+
+
+
+//------------------------------------------------------------------------------
+// Formatting
+//------------------------------------------------------------------------------
+
+// Write `value` in decimal, padded with zeros to at least `width` digits.
+static char* write_padded(char* ch, uint64_t value, int width) {
+  char tmp[20];
+  int n = 0;
+  do {
+    tmp[n++] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value);
+  while (n < width) tmp[n++] = '0';
+  while (n) *ch++ = tmp[--n];
+  return ch;
+}
+
+
+static char* write_ymd(char* ch, int64_t days) {
+  int64_t year;
+  int month, day;
+  civil_from_days(days, &year, &month, &day);
+  if (year < 0) {
+    *ch++ = '-';
+    year = -year;
+  }
+  ch = write_padded(ch, static_cast<uint64_t>(year), 4);
+  *ch++ = '-';
+  ch = write_padded(ch, static_cast<uint64_t>(month), 2);
+  *ch++ = '-';
+  return write_padded(ch, static_cast<uint64_t>(day), 2);
+}
+
+
+// Write time-of-day given in units of 10^-`ndigits` seconds. The fraction is
+// omitted if it is zero, and written without trailing zeros otherwise.
+static char* write_hms(char* ch, uint64_t t, int ndigits) {
+  uint64_t scale = 1;
+  for (int i = 0; i < ndigits; ++i) scale *= 10;
+  uint64_t secs = t / scale;
+  uint64_t frac = t % scale;
+  ch = write_padded(ch, secs / 3600, 2);
+  *ch++ = ':';
+  ch = write_padded(ch, (secs / 60) % 60, 2);
+  *ch++ = ':';
+  ch = write_padded(ch, secs % 60, 2);
+  if (frac) {
+    while (frac % 10 == 0) {
+      frac /= 10;
+      ndigits--;
+    }
+    *ch++ = '.';
+    ch = write_padded(ch, frac, ndigits);
+  }
+  return ch;
+}
+
+
+char* format_date32(char* ch, int32_t days) {
+  return write_ymd(ch, days);
+}
+
+char* format_date64(char* ch, int64_t micros) {
+  ch = write_ymd(ch, date64_days(micros));
+  *ch++ = 'T';
+  return write_hms(ch, static_cast<uint64_t>(date64_time(micros)), 6);
+}
+
+char* format_time32(char* ch, int32_t millis) {
+  int64_t t = millis;
+  if (t < 0) {
+    *ch++ = '-';
+    t = -t;
+  }
+  return write_hms(ch, static_cast<uint64_t>(t), 3);
+}
+
+
+
+//------------------------------------------------------------------------------
+// Parsing
+//------------------------------------------------------------------------------
+
+// The fixed-layout parts of ISO timestamps ("YYYY-MM-" and "hh:mm:ss") are
+// validated 8 characters at a time: the expected characters are subtracted
+// from the loaded word, after which every digit position must hold a value
+// 0..9 and every separator position must hold 0. Any character below its
+// expected value wraps around to a byte >= 0xD0, and any character above
+// '9' produces a byte >= 0x0A; both are detected by the high-nibble tests.
+static constexpr uint64_t HIGH_NIBBLES = 0xF0F0F0F0F0F0F0F0u;
+static constexpr uint64_t PLUS_SIX     = 0x0606060606060606u;
+
+static inline bool swar_match(uint64_t d, uint64_t sepmask) {
+  return ((d & HIGH_NIBBLES) | ((d + PLUS_SIX) & HIGH_NIBBLES) |
+          (d & sepmask)) == 0;
+}
+
+static inline int byte_at(uint64_t d, int i) {
+  return static_cast<int>((d >> (8 * i)) & 0xFF);
+}
+
+static inline int digit_at(const char* ch) {
+  return static_cast<uint8_t>(*ch - '0');
+}
+
+
+// Parse "YYYY-MM-DD" (exactly 10 characters) into the number of days since
+// the epoch.
+static bool parse_ymd(const char* ch, const char* end, int64_t* out) {
+  if (end - ch < 10) return false;
+  uint64_t d = read::load8(ch) - 0x2D30302D30303030u;
+  if (!swar_match(d, 0xFF0000FF00000000u)) return false;
+  int d8 = digit_at(ch + 8);
+  int d9 = digit_at(ch + 9);
+  if (d8 > 9 || d9 > 9) return false;
+  int year = byte_at(d, 0) * 1000 + byte_at(d, 1) * 100 +
+             byte_at(d, 2) * 10 + byte_at(d, 3);
+  int month = byte_at(d, 5) * 10 + byte_at(d, 6);
+  int day = d8 * 10 + d9;
+  if (month < 1 || month > 12) return false;
+  if (day < 1 || day > days_in_month(year, month)) return false;
+  *out = days_from_civil(year, month, day);
+  return true;
+}
+
+
+// Parse "hh:mm[:ss[.f...]]" into the number of microseconds since midnight.
+// On success `ch` is advanced past the parsed text.
+static bool parse_hms(const char*& ch, const char* end, int64_t* out) {
+  const char* p = ch;
+  int hours, minutes, seconds = 0;
+  uint64_t d = end - p >= 8? read::load8(p) - 0x30303A30303A3030u
+                            : HIGH_NIBBLES;
+  if (swar_match(d, 0x0000FF0000FF0000u)) {
+    hours = byte_at(d, 0) * 10 + byte_at(d, 1);
+    minutes = byte_at(d, 3) * 10 + byte_at(d, 4);
+    seconds = byte_at(d, 6) * 10 + byte_at(d, 7);
+    p += 8;
+  }
+  else if (end - p >= 5 && p[2] == ':' &&
+           digit_at(p) <= 9 && digit_at(p + 1) <= 9 &&
+           digit_at(p + 3) <= 9 && digit_at(p + 4) <= 9) {
+    hours = digit_at(p) * 10 + digit_at(p + 1);
+    minutes = digit_at(p + 3) * 10 + digit_at(p + 4);
+    p += 5;
+  }
+  else return false;
+  if (hours > 23 || minutes > 59 || seconds > 59) return false;
+
+  int64_t micros = 0;
+  if (p + 1 < end && *p == '.' && digit_at(p + 1) <= 9) {
+    uint64_t frac = 0;
+    int n = read::read_digits(p + 1, end, frac, 6);
+    p += 1 + n;
+    for (; n < 6; ++n) frac *= 10;
+    while (p < end && digit_at(p) <= 9) p++;
+    micros = static_cast<int64_t>(frac);
+  }
+  *out = ((hours * 60 + minutes) * 60 + seconds) * 1000000LL + micros;
+  ch = p;
+  return true;
+}
+
+
+bool parse_date32(const char*& ch, const char* end, int32_t* out) {
+  int64_t days;
+  if (!parse_ymd(ch, end, &days)) return false;
+  *out = static_cast<int32_t>(days);
+  ch += 10;
+  return true;
+}
+
+
+bool parse_date64(const char*& ch, const char* end, int64_t* out,
+                  bool allow_space)
+{
+  int64_t days;
+  if (!parse_ymd(ch, end, &days)) return false;
+  const char* p = ch + 10;
+  int64_t micros = 0;
+  if (p < end && (*p == 'T' || (allow_space && *p == ' '))) {
+    const char* q = p + 1;
+    if (parse_hms(q, end, &micros)) p = q;
+  }
+  if (p < end && *p == 'Z') p++;
+  *out = days * MICROS_PER_DAY + micros;
+  ch = p;
+  return true;
+}
+
+
+bool parse_time32(const char*& ch, const char* end, int32_t* out) {
+  int64_t micros;
+  if (!parse_hms(ch, end, &micros)) return false;
+  *out = static_cast<int32_t>(micros / MICROS_PER_MILLI);
+  return true;
+}
+
+
+}  // namespace dt
@@ -0,0 +1,75 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#ifndef dt_UTILS_DATETIME_h
+#define dt_UTILS_DATETIME_h
+#include <cstdint>
+namespace dt {
+
+// Helpers for the temporal stypes DATE32 (days since 1970-01-01), DATE64
+// (microseconds since 1970-01-01T00:00:00) and TIME32 (milliseconds since
+// midnight). All dates use the proleptic Gregorian calendar.
+
+constexpr int64_t MILLIS_PER_DAY = 86400000;
+constexpr int64_t MICROS_PER_DAY = 86400000000;
+constexpr int64_t MICROS_PER_MILLI = 1000;
+
+// Maximum number of characters produced by the `format_*()` functions.
+constexpr int DATE32_MAXLEN = 16;
+constexpr int DATE64_MAXLEN = 32;
+constexpr int TIME32_MAXLEN = 16;
+
+
+/**
+ * Convert a calendar date into the number of days since 1970-01-01, and back.
+ * The algorithms are from http://howardhinnant.github.io/date_algorithms.html;
+ * they are valid for all dates representable in DATE32 / DATE64.
+ */
+int64_t days_from_civil(int64_t year, int month, int day);
+void civil_from_days(int64_t days, int64_t* year, int* month, int* day);
+
+// Split a DATE64 / TIME32 value into days (floor division) and the time of
+// the day, so that negative timestamps still produce valid times.
+int64_t date64_days(int64_t micros);
+int64_t date64_time(int64_t micros);
+
+
+/**
+ * Write the value in ISO-8601 format into the buffer `ch`, and return the
+ * pointer past the last character written. The buffer must have room for at
+ * least DATE**_MAXLEN characters. The formats are "YYYY-MM-DD" for DATE32,
+ * "YYYY-MM-DDThh:mm:ss[.ffffff]" for DATE64, and "hh:mm:ss[.fff]" for TIME32.
+ * The fractional part of the seconds is only written if it is non-zero, and
+ * without trailing zeros.
+ */
+char* format_date32(char* ch, int32_t days);
+char* format_date64(char* ch, int64_t micros);
+char* format_time32(char* ch, int32_t millis);
+
+
+/**
+ * Parse an ISO-8601 value starting at `ch` and not extending past `end`. On
+ * success the value is stored into `*out`, `ch` is advanced past the parsed
+ * text, and true is returned. On failure `ch` is left unchanged.
+ *
+ * Accepted formats are:
+ *   DATE32: "YYYY-MM-DD";
+ *   DATE64: "YYYY-MM-DD", optionally followed by 'T' (or a space, if
+ *           `allow_space` is true) and "hh:mm[:ss[.f...]]", and optionally
+ *           by 'Z';
+ *   TIME32: "hh:mm[:ss[.f...]]".
+ * The fractional part may have any number of digits, but only microseconds
+ * (DATE64) or milliseconds (TIME32) are retained.
+ */
+bool parse_date32(const char*& ch, const char* end, int32_t* out);
+bool parse_date64(const char*& ch, const char* end, int64_t* out,
+                  bool allow_space);
+bool parse_time32(const char*& ch, const char* end, int32_t* out);
+
+
+}  // namespace dt
+#endif
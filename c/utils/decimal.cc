@@ -0,0 +1,148 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include <cmath>                     // std::fabs, std::round
+#include <limits>                    // std::numeric_limits
+#include "utils/decimal.h"
+namespace dt {
+
+
+bool rescale_decimal(int64_t x, int from, int to, int64_t* out) {
+  if (to >= from) {
+    int64_t p = pow10i(to - from);
+    int64_t lim = std::numeric_limits<int64_t>::max() / p;
+    if (x > lim || x < -lim) return false;
+    *out = x * p;
+    return true;
+  }
+  int64_t p = pow10i(from - to);
+  int64_t q = x / p;
+  int64_t r = x % p;
+  if (r >= 0? 2*r >= p : -2*r >= p) q += (x < 0)? -1 : 1;
+  *out = q;
+  return true;
+}
+
+
+// A double has about 15.9 significant digits, so once the scaled value
+// reaches 9e15 any further digits would be noise. Below that, the value is
+// considered round if it is within a few ulps of an integer.
+int decimal_scale_of(double x, int maxscale) {
+  double ax = std::fabs(x);
+  for (int s = 0; s < maxscale; ++s) {
+    double y = ax * static_cast<double>(pow10i(s));
+    if (y >= 9.0e15) return s;
+    if (std::fabs(y - std::round(y)) <= y * 1e-15) return s;
+  }
+  return maxscale;
+}
+
+
+
+//------------------------------------------------------------------------------
+// Formatting
+//------------------------------------------------------------------------------
+
+char* format_decimal(char* ch, int64_t x, int scale) {
+  uint64_t u = static_cast<uint64_t>(x);
+  if (x < 0) {
+    *ch++ = '-';
+    u = ~u + 1;
+  }
+  char tmp[24];
+  int n = 0;
+  do {
+    tmp[n++] = static_cast<char>('0' + u % 10);
+    u /= 10;
+  } while (u);
+  // At least one digit must precede the decimal point
+  while (n <= scale) tmp[n++] = '0';
+  while (n > scale) *ch++ = tmp[--n];
+  if (scale) {
+    *ch++ = '.';
+    while (n) *ch++ = tmp[--n];
+  }
+  return ch;
+}
+
+
+
+//------------------------------------------------------------------------------
+// Parsing
+//------------------------------------------------------------------------------
+
+static inline unsigned digit_at(const char* ch) {
+  return static_cast<unsigned>(static_cast<uint8_t>(*ch - '0'));
+}
+
+
+bool parse_decimal(const char*& ch, const char* end, char dec, int maxdigits,
+                   int64_t* value, int* scale)
+{
+  const char* p = ch;
+  bool neg = false;
+  if (p < end && (*p == '-' || *p == '+')) {
+    neg = (*p == '-');
+    p++;
+  }
+  // Leading zeros are not significant, and are not counted towards the
+  // `maxdigits` limit.
+  uint64_t acc = 0;
+  int ndigits = 0;
+  int nfrac = 0;
+  bool any = false;
+  auto add_digit = [&](unsigned d) {
+    any = true;
+    if (acc == 0 && d == 0) return true;
+    acc = acc * 10 + d;
+    return ++ndigits <= maxdigits;
+  };
+  for (; p < end && digit_at(p) <= 9; ++p) {
+    if (!add_digit(digit_at(p))) return false;
+  }
+  if (p < end && *p == dec) {
+    for (++p; p < end && digit_at(p) <= 9; ++p) {
+      if (!add_digit(digit_at(p))) return false;
+      nfrac++;
+    }
+  }
+  if (!any) return false;
+
+  int exp = 0;
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    const char* q = p + 1;
+    bool eneg = false;
+    if (q < end && (*q == '-' || *q == '+')) {
+      eneg = (*q == '-');
+      q++;
+    }
+    if (!(q < end && digit_at(q) <= 9)) return false;
+    for (; q < end && digit_at(q) <= 9; ++q) {
+      exp = exp * 10 + static_cast<int>(digit_at(q));
+      if (exp > 100) return false;
+    }
+    if (eneg) exp = -exp;
+    p = q;
+  }
+
+  int sc = nfrac - exp;
+  if (sc < 0) {
+    if (acc) {
+      if (ndigits - sc > maxdigits) return false;
+      acc *= static_cast<uint64_t>(pow10i(-sc));
+    }
+    sc = 0;
+  }
+  if (sc > MAX_DECIMAL_SCALE) return false;
+  *value = neg? -static_cast<int64_t>(acc) : static_cast<int64_t>(acc);
+  *scale = sc;
+  ch = p;
+  return true;
+}
+
+
+}  // namespace dt
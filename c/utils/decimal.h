@@ -0,0 +1,75 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#ifndef dt_UTILS_DECIMAL_h
+#define dt_UTILS_DECIMAL_h
+#include <cstdint>
+namespace dt {
+
+// Helpers for the decimal stypes DEC16, DEC32 and DEC64. A decimal value is
+// an integer `x` together with a `scale`, and it represents the number
+// x * 10^-scale. The scale is in the range 0..MAX_DECIMAL_SCALE.
+
+constexpr int MAX_DECIMAL_SCALE = 18;
+
+// Maximum number of characters produced by `format_decimal()`.
+constexpr int DECIMAL_MAXLEN = 24;
+
+
+// 10^n as an integer, for n in the range 0..18
+inline int64_t pow10i(int n) {
+  static constexpr int64_t p[19] = {
+    1LL, 10LL, 100LL, 1000LL, 10000LL, 100000LL, 1000000LL, 10000000LL,
+    100000000LL, 1000000000LL, 10000000000LL, 100000000000LL,
+    1000000000000LL, 10000000000000LL, 100000000000000LL,
+    1000000000000000LL, 10000000000000000LL, 100000000000000000LL,
+    1000000000000000000LL };
+  return p[n];
+}
+
+
+/**
+ * Convert the value `x` with scale `from` into the scale `to`. When the scale
+ * decreases, the value is rounded half away from zero. Returns false if the
+ * result does not fit into int64 (in which case `*out` is not modified).
+ */
+bool rescale_decimal(int64_t x, int from, int to, int64_t* out);
+
+
+/**
+ * Smallest scale (not exceeding `maxscale`) at which the double `x` can be
+ * represented exactly, up to the precision of the double itself. For
+ * example, this returns 2 for 0.25 and 1 for 0.1.
+ */
+int decimal_scale_of(double x, int maxscale);
+
+
+/**
+ * Write the value `x` with the given `scale` into the buffer `ch` (which must
+ * have room for at least DECIMAL_MAXLEN characters), and return the pointer
+ * past the last character written. Exactly `scale` digits are written after
+ * the decimal point, for example 150 with scale 2 is written as "1.50".
+ */
+char* format_decimal(char* ch, int64_t x, int scale);
+
+
+/**
+ * Parse a fixed-point number starting at `ch` and not extending past `end`:
+ * an optional sign, digits with an optional fractional part separated by
+ * `dec`, and an optional exponent. At least one digit is required, and the
+ * number may have at most `maxdigits` significant digits (not more than 18).
+ *
+ * On success the number is stored as the integer `*value` with scale
+ * `*scale`, `ch` is advanced past the parsed text, and true is returned. On
+ * failure `ch` is left unchanged.
+ */
+bool parse_decimal(const char*& ch, const char* end, char dec, int maxdigits,
+                   int64_t* value, int* scale);
+
+
+}  // namespace dt
+#endif
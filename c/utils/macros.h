@@ -44,6 +44,24 @@
 #endif
 
 
+// Functions marked with TARGET_AVX2 / TARGET_AVX512 are compiled for the
+// corresponding instruction set regardless of the global compiler flags.
+// They may only be called after checking `dt::get_simd_level()`.
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+  #define DT_SIMD_DISPATCH 1
+  #define TARGET_AVX2   __attribute__((target("avx2")))
+  #define TARGET_AVX512 \
+      __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl")))
+  #define ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+  #define DT_SIMD_DISPATCH 0
+  #define TARGET_AVX2
+  #define TARGET_AVX512
+  #define ALWAYS_INLINE inline
+#endif
+
+
 // Helper template to replace type `T` with a cache-aligned + padded wrapper
 // type. Using this structure may help reduce false sharing
 template <typename T>
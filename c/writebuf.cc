@@ -8,7 +8,7 @@
 #include <cstring>     // std::memcpy
 #include <errno.h>     // errno
 #include <sys/mman.h>  // mmap
-#include <unistd.h>    // write
+#include <unistd.h>    // write, lseek
 #include "utils/alloc.h"   // dt::realloc
 #include "utils/assert.h"
 #include "utils/misc.h"
@@ -72,6 +72,20 @@ FileWritableBuffer::FileWritableBuffer(const std::string& path) {
   TRACK(this, sizeof(*this), "FileWritableBuffer");
 }
 
+FileWritableBuffer::FileWritableBuffer(const std::string& path, size_t offset)
+{
+  file = new File(path, File::READWRITE);
+  file->resize(offset);
+  auto pos = static_cast<off_t>(offset);
+  if (::lseek(file->descriptor(), pos, SEEK_SET) != pos) {
+    delete file;
+    throw RuntimeError() << "Cannot seek to position " << offset
+        << " in file " << path << ": " << Errno;
+  }
+  bytes_written = offset;
+  TRACK(this, sizeof(*this), "FileWritableBuffer");
+}
+
 FileWritableBuffer::~FileWritableBuffer() {
   delete file;
   UNTRACK(this);
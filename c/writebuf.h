@@ -113,6 +113,13 @@ class FileWritableBuffer : public WritableBuffer
 
 public:
   FileWritableBuffer(const std::string& path);
+
+  /**
+   * Open an existing file for writing, discarding its content after the
+   * position `offset`. The new data will be written starting from that
+   * position, and `size()` will include the retained `offset` bytes.
+   */
+  FileWritableBuffer(const std::string& path, size_t offset);
   virtual ~FileWritableBuffer() override;
 
   virtual size_t prep_write(size_t n, const void* src) override;
@@ -69,6 +69,15 @@ static void test_parallel_for_ordered(const PKArgs& args) {
 }
 
 
+static PKArgs arg_test_rolling_minmax(
+  1, 0, 0, false, false, {"n"}, "test_rolling_minmax");
+
+static void test_rolling_minmax(const PKArgs& args) {
+  size_t n = args[0].to_size_t();
+  dttest::test_rolling_minmax(n);
+}
+
+
 
 void DatatableModule::init_tests() {
   ADD_FN(&test_coverage, arg_test_coverage);
@@ -77,6 +86,7 @@ void DatatableModule::init_tests() {
   ADD_FN(&test_barrier, arg_test_barrier);
   ADD_FN(&test_parallel_for_dynamic, arg_test_parallel_for_dynamic);
   ADD_FN(&test_parallel_for_ordered, arg_test_parallel_for_ordered);
+  ADD_FN(&test_rolling_minmax, arg_test_rolling_minmax);
 }
 
 
@@ -20,6 +20,9 @@ void cover_init_FrameInitializationManager_em();
 void cover_names_FrameNameProviders();
 void cover_names_integrity_checks();
 
+// Defined in expr/window.cc
+void test_rolling_minmax(size_t n);
+
 // Defined in parallel/ztest_atomic.cc
 void test_atomic();
 
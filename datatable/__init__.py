@@ -23,8 +23,9 @@
 from .__version__ import version as __version__
 from .frame import Frame
 from .expr import (mean, min, max, sd, isna, sum, count, first, abs, exp,
-                   log, log10, f, g, median)
-from .fread import fread, GenericReader, FreadWarning, _DefaultLogger
+                   log, log10, f, g, median, cumsum, cumcount, shift,
+                   rolling_sum, rolling_mean, rolling_min, rolling_max)
+from .fread import fread, iread, GenericReader, FreadWarning, _DefaultLogger
 from .lib._datatable import (
     unique, union, intersect, setdiff, symdiff,
     repeat, by, join, sort, cbind, rbind
@@ -52,12 +53,15 @@ __all__ = (
     "median",
     "min",
     "open", "sd", "sum", "count", "first",
-    "isna", "fread", "GenericReader", "stype", "ltype", "f", "g",
+    "isna", "fread", "iread", "GenericReader", "stype", "ltype", "f", "g",
     "join", "by", "abs", "exp", "log", "log10",
+    "cumsum", "cumcount", "shift",
+    "rolling_sum", "rolling_mean", "rolling_min", "rolling_max",
     "TypeError", "ValueError", "DatatableWarning", "FreadWarning",
     "DataTable", "options",
     "bool8", "int8", "int16", "int32", "int64",
-    "float32", "float64", "str32", "str64", "obj64",
+    "float32", "float64", "dec16", "dec32", "dec64", "str32", "str64", "fstr",
+    "cat8", "cat16", "cat32", "date32", "date64", "time32", "obj64",
     "cbind", "rbind", "repeat", "sort",
     "unique", "union", "intersect", "setdiff", "symdiff",
     "split_into_nhot"
@@ -70,8 +74,18 @@ int32 = stype.int32
 int64 = stype.int64
 float32 = stype.float32
 float64 = stype.float64
+dec16 = stype.dec16
+dec32 = stype.dec32
+dec64 = stype.dec64
 str32 = stype.str32
 str64 = stype.str64
+fstr = stype.fstr
+cat8 = stype.cat8
+cat16 = stype.cat16
+cat32 = stype.cat32
+date32 = stype.date32
+date64 = stype.date64
+time32 = stype.time32
 obj64 = stype.obj64
 DataTable = Frame
 
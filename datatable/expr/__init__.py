@@ -34,10 +34,14 @@ from .reduce_expr import (ReduceExpr, sum, count, first, mean, median, min,
 from .relop_expr import RelationalOpExpr
 from .string_expr import StringExpr
 from .unary_expr import UnaryOpExpr, isna
+from .window_expr import (WindowExpr, cumsum, cumcount, shift, rolling_sum,
+    rolling_mean, rolling_min, rolling_max)
 
 __all__ = (
     "abs",
     "count",
+    "cumcount",
+    "cumsum",
     "exp",
     "f",
     "first",
@@ -48,7 +52,12 @@ __all__ = (
     "mean",
     "median",
     "min",
+    "rolling_max",
+    "rolling_mean",
+    "rolling_min",
+    "rolling_sum",
     "sd",
+    "shift",
     "sum",
     "BinaryOpExpr",
     "CastExpr",
@@ -59,4 +68,5 @@ __all__ = (
     "ReduceExpr",
     "RelationalOpExpr",
     "UnaryOpExpr",
+    "WindowExpr",
 )
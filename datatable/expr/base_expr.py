@@ -194,6 +194,27 @@ class BaseExpr:
         return datatable.expr.StringExpr("re_match", self, pattern, flags)
 
 
+    #----- Datetime functions --------------------------------------------------
+
+    def year(self):
+        return datatable.expr.UnaryOpExpr("year", self)
+
+    def month(self):
+        return datatable.expr.UnaryOpExpr("month", self)
+
+    def day(self):
+        return datatable.expr.UnaryOpExpr("day", self)
+
+    def hour(self):
+        return datatable.expr.UnaryOpExpr("hour", self)
+
+    def minute(self):
+        return datatable.expr.UnaryOpExpr("minute", self)
+
+    def second(self):
+        return datatable.expr.UnaryOpExpr("second", self)
+
+
 
     #----- Code generation -----------------------------------------------------
 
@@ -45,6 +45,12 @@ unary_op_codes = {
     "log": 7,
     "log10": 8,
     "len": 9,
+    "year": 10,
+    "month": 11,
+    "day": 12,
+    "hour": 13,
+    "minute": 14,
+    "second": 15,
 }
 
 
@@ -0,0 +1,126 @@
+#!/usr/bin/env python
+#-------------------------------------------------------------------------------
+# Copyright 2018 H2O.ai
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+#-------------------------------------------------------------------------------
+from .base_expr import BaseExpr
+from datatable.lib import core
+
+# See "c/expr/base_expr.h"
+BASEEXPR_OPCODE_WINDOW = 9
+
+
+
+#-------------------------------------------------------------------------------
+# Exported functions
+#-------------------------------------------------------------------------------
+
+def cumsum(expr):
+    """
+    Running sum of `expr` within each group. NA values do not contribute to
+    the sum, and produce NAs in the result.
+    """
+    return WindowExpr("cumsum", expr)
+
+
+def cumcount():
+    """
+    Index of each row within its group, starting from 0.
+    """
+    return WindowExpr("cumcount", None)
+
+
+def shift(expr, n=1):
+    """
+    Value of `expr` from `n` rows earlier within the same group (or `-n`
+    rows later, if `n` is negative). Rows for which such value does not
+    exist are filled with NAs.
+    """
+    return WindowExpr("shift", expr, n)
+
+
+def rolling_sum(expr, window):
+    """
+    Sum of the non-NA values of `expr` over the last `window` rows of the
+    group, including the current row.
+    """
+    return WindowExpr("rolling_sum", expr, window)
+
+
+def rolling_mean(expr, window):
+    """
+    Mean of the non-NA values of `expr` over the last `window` rows of the
+    group, including the current row.
+    """
+    return WindowExpr("rolling_mean", expr, window)
+
+
+def rolling_min(expr, window):
+    """
+    Minimum of `expr` over the last `window` rows of the group, including
+    the current row.
+    """
+    return WindowExpr("rolling_min", expr, window)
+
+
+def rolling_max(expr, window):
+    """
+    Maximum of `expr` over the last `window` rows of the group, including
+    the current row.
+    """
+    return WindowExpr("rolling_max", expr, window)
+
+
+
+
+class WindowExpr(BaseExpr):
+    __slots__ = ["_op", "_expr", "_param"]
+
+    def __init__(self, op, expr, param=None):
+        super().__init__()
+        self._op = op
+        self._expr = expr
+        self._param = param
+
+    def __str__(self):
+        if self._expr is None:
+            return "%s()" % self._op
+        if self._param is None:
+            return "%s(%s)" % (self._op, self._expr)
+        return "%s(%s, %r)" % (self._op, self._expr, self._param)
+
+    def _core(self):
+        return core.base_expr(BASEEXPR_OPCODE_WINDOW,
+                              window_opcodes[self._op],
+                              None if self._expr is None else
+                              self._expr._core(),
+                              self._param)
+
+
+# Synchronize with c/expr/base_expr.h
+window_opcodes = {
+    "cumsum": 1,
+    "cumcount": 2,
+    "shift": 3,
+    "rolling_sum": 4,
+    "rolling_mean": 5,
+    "rolling_min": 6,
+    "rolling_max": 7,
+}
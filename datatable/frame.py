@@ -44,6 +44,19 @@ class Frame(core.Frame):
     This is a primary data structure for datatable module.
     """
 
+    @staticmethod
+    def from_arrow(data):
+        """
+        Create a Frame from an Arrow object (such as `pyarrow.Table`,
+        `pyarrow.RecordBatch` or `pyarrow.Array`), or from any other object
+        implementing the Arrow PyCapsule interface.
+
+        The data is shared with the Arrow object rather than copied whenever
+        the memory layouts of datatable and Arrow agree.
+        """
+        return core.from_arrow(data)
+
+
     #---------------------------------------------------------------------------
     # Deprecated
     #---------------------------------------------------------------------------
@@ -10,6 +10,7 @@ import os
 import pathlib
 import re
 import shutil
+import struct
 import tempfile
 import warnings
 from typing import List, Union, Optional
@@ -64,6 +65,63 @@ def fread(
     return freader.read()
 
 
+def iread(
+        anysource=None, *,
+        file=None,
+        text=None,
+        cmd=None,
+        url=None,
+
+        columns=None,
+        sep: str = None,
+        dec: str = ".",
+        max_nrows: int = None,
+        header: bool = None,
+        na_strings: List[str] = None,
+        verbose: bool = False,
+        fill: bool = False,
+        encoding: str = None,
+        skip_to_string: str = None,
+        skip_to_line: int = None,
+        skip_blank_lines: bool = False,
+        strip_whitespace: bool = True,
+        quotechar: Optional[str] = '"',
+        nthreads: int = None,
+        logger=None,
+        chunk_rows: int = 1000000,
+        **extra):
+    """
+    Read the input in chunks of at most `chunk_rows` rows each, and return an
+    iterator over the resulting Frames.
+
+    The parameters are the same as in :func:`fread`. The parse settings and
+    the column types are detected once, from the beginning of the input, and
+    then used for all chunks. Only the current chunk is kept in memory, so
+    this function can be used to process inputs that are larger than RAM.
+
+    The column types are not guaranteed to be the same in all chunks: if a
+    chunk contains a value that does not fit the detected type of its
+    column (for example a float in a column of integers), then that column
+    is bumped to a wider type in this chunk and in all the chunks after it,
+    while the chunks already returned keep their types. Use the `columns`
+    parameter to request the types upfront if they must stay fixed.
+    """
+    params = {**locals(), **extra}
+    del params["extra"]
+    del params["chunk_rows"]
+    if not isinstance(chunk_rows, int) or isinstance(chunk_rows, bool):
+        raise TTypeError("Parameter `chunk_rows` should be an integer, "
+                         "instead got %r" % type(chunk_rows))
+    if chunk_rows <= 0:
+        raise TValueError("Parameter `chunk_rows` should be positive, "
+                          "instead got %d" % chunk_rows)
+    freader = GenericReader(**params)
+    if freader._files:
+        freader._clear_temporary_files()
+        raise TValueError("iread() cannot read multiple files at once")
+    return freader.read_chunks(chunk_rows)
+
+
 
 class GenericReader(object):
     """
@@ -85,6 +143,8 @@ class GenericReader(object):
         self._tempdir = None        # type: str
         self._tempdir_own = False   # type: bool
         self._text = None           # type: Union[str, bytes]
+        self._compression = None    # type: str
+        self._compression_range = None  # type: Tuple[int, int]
         self._sep = None            # type: str
         self._dec = None            # type: str
         self._maxnrows = None       # type: int
@@ -301,7 +361,8 @@ class GenericReader(object):
         self._files = []
         for s in files_list:
             self._resolve_source_file(s)
-            entry = (self._src, self._file, self._fileno, self._text)
+            entry = (self._src, self._file, self._fileno, self._text,
+                     self._compression, self._compression_range)
             self._files.append(entry)
 
 
@@ -352,39 +413,37 @@ class GenericReader(object):
                                     "used." % (filename, zff))
             if len(zff) == 0:
                 raise TValueError("Zip file %s is empty" % filename)
-            self._tempdir = tempfile.mkdtemp()
-            if self._verbose:
-                self.logger.debug("Extracting %s to temporary directory %s"
-                                  % (filename, self._tempdir))
-            self._tempfiles.append(zf.extract(zff[0], path=self._tempdir))
-            self._file = self._tempfiles[-1]
-
-        elif ext == ".gz":
-            import gzip
-            zf = gzip.GzipFile(filename, mode="rb")
-            if self._verbose:
-                self.logger.debug("Extracting %s into memory" % filename)
-            self._text = zf.read()
-            if self._verbose:
-                self.logger.debug("Extracted: size = %d" % len(self._text))
-
-        elif ext == ".bz2":
-            import bz2
-            zf = bz2.open(filename, mode="rb")
-            if self._verbose:
-                self.logger.debug("Extracting %s into memory" % filename)
-            self._text = zf.read()
-            if self._verbose:
-                self.logger.debug("Extracted: size = %d" % len(self._text))
-
-        elif ext == ".xz":
-            import lzma
-            zf = lzma.open(filename, mode="rb")
-            if self._verbose:
-                self.logger.debug("Extracting %s into memory" % filename)
-            self._text = zf.read()
-            if self._verbose:
-                self.logger.debug("Extracted: size = %d" % len(self._text))
+            zinfo = zf.getinfo(zff[0])
+            codec = {zipfile.ZIP_STORED: "stored",
+                     zipfile.ZIP_DEFLATED: "deflate"}.get(zinfo.compress_type)
+            if codec and not (zinfo.flag_bits & 1):
+                # The member's data is decompressed by the C reader directly
+                # from the archive; here we only locate the data, which starts
+                # right after the member's local file header.
+                with open(filename, "rb") as inp:
+                    inp.seek(zinfo.header_offset)
+                    header = inp.read(30)
+                fnlen, extralen = struct.unpack("<HH", header[26:30])
+                offset = zinfo.header_offset + 30 + fnlen + extralen
+                if self._verbose:
+                    self.logger.debug("Reading member %s of zip file %s"
+                                      % (zff[0], filename))
+                self._file = filename
+                self._compression = codec
+                self._compression_range = (offset, zinfo.compress_size)
+            else:
+                self._tempdir = tempfile.mkdtemp()
+                if self._verbose:
+                    self.logger.debug("Extracting %s to temporary directory %s"
+                                      % (filename, self._tempdir))
+                self._tempfiles.append(zf.extract(zff[0], path=self._tempdir))
+                self._file = self._tempfiles[-1]
+
+        elif ext in (".gz", ".bz2", ".xz"):
+            # These files are decompressed by the C reader, in a streaming
+            # fashion (see `GenericReader::open_input()`)
+            self._file = filename
+            self._compression = {".gz": "gzip", ".bz2": "bz2", ".xz": "xz"}[ext]
 
         elif ext == ".xlsx" or ext == ".xls":
             self._result = read_xls_workbook(filename, subpath)
@@ -663,11 +722,14 @@ class GenericReader(object):
                 return self._result
             if self._files:
                 res = {}
-                for src, filename, fileno, txt in self._files:
+                for src, filename, fileno, txt, cmpr, cmpr_range \
+                        in self._files:
                     self._src = src
                     self._file = filename
                     self._fileno = fileno
                     self._txt = txt
+                    self._compression = cmpr
+                    self._compression_range = cmpr_range
                     self._colnames = None
                     try:
                         res[src] = core.gread(self)
@@ -680,6 +742,21 @@ class GenericReader(object):
             self._clear_temporary_files()
 
 
+    def read_chunks(self, chunk_rows):
+        try:
+            if self._result:
+                yield self._result
+                return
+            reader = core.ChunkedReader(self, chunk_rows)
+            while True:
+                frame = reader.read_next()
+                if frame is None:
+                    break
+                yield frame
+        finally:
+            self._clear_temporary_files()
+
+
     #---------------------------------------------------------------------------
 
     def _get_destination(self, estimated_size):
@@ -981,6 +1058,10 @@ class rtype(enum.Enum):
     rstr     = 9
     rstr32   = 10
     rstr64   = 11
+    rdate32  = 12
+    rdate64  = 13
+    rtime32  = 14
+    rdec64   = 15
 
 
 _rtypes_map = {
@@ -1005,6 +1086,10 @@ _rtypes_map = {
     "str":         rtype.rstr,
     "str32":       rtype.rstr32,
     "str64":       rtype.rstr64,
+    "date32":      rtype.rdate32,
+    "date64":      rtype.rdate64,
+    "time32":      rtype.rtime32,
+    "dec64":       rtype.rdec64,
     stype.bool8:   rtype.rbool,
     stype.int32:   rtype.rint32,
     stype.int64:   rtype.rint64,
@@ -1012,8 +1097,13 @@ _rtypes_map = {
     stype.float64: rtype.rfloat64,
     stype.str32:   rtype.rstr32,
     stype.str64:   rtype.rstr64,
+    stype.date32:  rtype.rdate32,
+    stype.date64:  rtype.rdate64,
+    stype.time32:  rtype.rtime32,
+    stype.dec64:   rtype.rdec64,
     ltype.bool:    rtype.rbool,
     ltype.int:     rtype.rint,
     ltype.real:    rtype.rfloat,
     ltype.str:     rtype.rstr,
+    ltype.time:    rtype.rdate64,
 }
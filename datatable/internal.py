@@ -23,18 +23,22 @@
 
 from .lib._datatable import (
     frame_column_data_r,
+    frame_column_encoding,
     frame_column_rowindex,
     frame_integrity_check,
     get_thread_ids,
     in_debug_mode,
+    mmap_resident_size,
     RowIndex
 )
 
 __all__ = [
     "frame_column_data_r",
+    "frame_column_encoding",
     "frame_column_rowindex",
     "frame_integrity_check",
     "get_thread_ids",
     "in_debug_mode",
+    "mmap_resident_size",
     "RowIndex",
 ]
@@ -5,6 +5,8 @@
 #   file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #-------------------------------------------------------------------------------
 import ctypes
+import datetime
+import decimal
 import enum
 import datatable
 from datatable.lib import core
@@ -65,8 +67,18 @@ class stype(enum.Enum):
     int64 = 5
     float32 = 6
     float64 = 7
+    dec16 = 8
+    dec32 = 9
+    dec64 = 10
     str32 = 11
     str64 = 12
+    fstr = 13
+    cat8 = 14
+    cat16 = 15
+    cat32 = 16
+    date64 = 17
+    time32 = 18
+    date32 = 19
     obj64 = 21
 
     def __repr__(self):
@@ -159,9 +171,9 @@ class ltype(enum.Enum):
     For each ltype, you can find the set of stypes that correspond to it:
 
     >>> dt.ltype.real.stypes
-    [stype.float32, stype.float64]
+    [stype.float32, stype.float64, stype.dec16, stype.dec32, stype.dec64]
     >>> dt.ltype.time.stypes
-    []
+    [stype.date64, stype.time32, stype.date32]
     """
     bool = 1
     int = 2
@@ -214,8 +226,18 @@ _stype_2_short = {
     stype.int64: "i8",
     stype.float32: "r4",
     stype.float64: "r8",
+    stype.dec16: "d2",
+    stype.dec32: "d4",
+    stype.dec64: "d8",
     stype.str32: "s4",
     stype.str64: "s8",
+    stype.fstr: "sx",
+    stype.cat8: "e1",
+    stype.cat16: "e2",
+    stype.cat32: "e4",
+    stype.date64: "t8",
+    stype.time32: "T4",
+    stype.date32: "t4",
     stype.obj64: "o8",
 }
 
@@ -227,8 +249,18 @@ _stype_2_ltype = {
     stype.int64: ltype.int,
     stype.float32: ltype.real,
     stype.float64: ltype.real,
+    stype.dec16: ltype.real,
+    stype.dec32: ltype.real,
+    stype.dec64: ltype.real,
     stype.str32: ltype.str,
     stype.str64: ltype.str,
+    stype.fstr: ltype.str,
+    stype.cat8: ltype.str,
+    stype.cat16: ltype.str,
+    stype.cat32: ltype.str,
+    stype.date64: ltype.time,
+    stype.time32: ltype.time,
+    stype.date32: ltype.time,
     stype.obj64: ltype.obj,
 }
 
@@ -240,8 +272,18 @@ _stype_2_ctype = {
     stype.int64: ctypes.c_int64,
     stype.float32: ctypes.c_float,
     stype.float64: ctypes.c_double,
+    stype.dec16: ctypes.c_int16,
+    stype.dec32: ctypes.c_int32,
+    stype.dec64: ctypes.c_int64,
     stype.str32: ctypes.c_int32,
     stype.str64: ctypes.c_int64,
+    stype.fstr: ctypes.c_char,
+    stype.cat8: ctypes.c_uint8,
+    stype.cat16: ctypes.c_uint16,
+    stype.cat32: ctypes.c_uint32,
+    stype.date64: ctypes.c_int64,
+    stype.time32: ctypes.c_int32,
+    stype.date32: ctypes.c_int32,
     stype.obj64: ctypes.py_object,
 }
 
@@ -274,8 +316,18 @@ def _init_numpy_transforms():
             stype.int64: np.dtype("int64"),
             stype.float32: np.dtype("float32"),
             stype.float64: np.dtype("float64"),
+            stype.dec16: np.dtype("object"),
+            stype.dec32: np.dtype("object"),
+            stype.dec64: np.dtype("object"),
             stype.str32: np.dtype("object"),
             stype.str64: np.dtype("object"),
+            stype.fstr: np.dtype("object"),
+            stype.cat8: np.dtype("object"),
+            stype.cat16: np.dtype("object"),
+            stype.cat32: np.dtype("object"),
+            stype.date64: np.dtype("object"),
+            stype.time32: np.dtype("object"),
+            stype.date32: np.dtype("object"),
             stype.obj64: np.dtype("object"),
         }
         _init_value2members_from([
@@ -301,8 +353,18 @@ _stype_2_struct = {
     stype.int64: "=q",
     stype.float32: "=f",
     stype.float64: "=d",
+    stype.dec16: "=h",
+    stype.dec32: "=i",
+    stype.dec64: "=q",
     stype.str32: "=i",
     stype.str64: "=q",
+    stype.fstr: "s",
+    stype.cat8: "B",
+    stype.cat16: "=H",
+    stype.cat32: "=I",
+    stype.date64: "=q",
+    stype.time32: "=i",
+    stype.date32: "=i",
     stype.obj64: "O",
 }
 
@@ -321,6 +383,8 @@ def _additional_stype_members():
     yield (float, stype.float64)
     yield ("float", stype.float64)
     yield ("real", stype.float64)
+    yield (decimal.Decimal, stype.dec64)
+    yield ("decimal", stype.dec64)
     yield (str, stype.str64)
     yield ("str", stype.str64)
     yield ("string", stype.str64)
@@ -328,6 +392,14 @@ def _additional_stype_members():
     yield ("obj", stype.obj64)
     yield ("object", stype.obj64)
     yield ("object64", stype.obj64)
+    yield ("cat", stype.cat8)
+    yield ("categorical", stype.cat8)
+    yield (datetime.datetime, stype.date64)
+    yield ("datetime", stype.date64)
+    yield (datetime.time, stype.time32)
+    yield ("time", stype.time32)
+    yield (datetime.date, stype.date32)
+    yield ("date", stype.date32)
 
     # "old"-style stypes
     yield ("i1b", stype.bool8)
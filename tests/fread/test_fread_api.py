@@ -207,7 +207,7 @@ def test_fread_xz_file(tempfile, capsys):
     frame_integrity_check(d0)
     assert d0.to_list() == [[1, 2, 3]]
     assert not err
-    assert ("Extracting %s into memory" % xzfile) in out
+    assert ("Decompressing %s data from file %s" % ('xz', xzfile)) in out
     os.unlink(xzfile)
 
 
@@ -221,10 +221,82 @@ def test_fread_gz_file(tempfile, capsys):
     frame_integrity_check(d0)
     assert d0.to_list() == [[10, 20, 30]]
     assert not err
-    assert ("Extracting %s into memory" % gzfile) in out
+    assert ("Decompressing %s data from file %s" % ('gzip', gzfile)) in out
     os.unlink(gzfile)
 
 
+def test_fread_gz_file_multistream(tempfile):
+    import gzip
+    gzfile = tempfile + ".gz"
+    with open(gzfile, "wb") as f:
+        f.write(gzip.compress(b"A,B\n1,2\n"))
+        f.write(gzip.compress(b"3,4\n5,6\n"))
+    try:
+        d0 = dt.fread(gzfile)
+        frame_integrity_check(d0)
+        assert d0.names == ("A", "B")
+        assert d0.to_list() == [[1, 3, 5], [2, 4, 6]]
+    finally:
+        os.remove(gzfile)
+
+
+def test_fread_gz_file_truncated(tempfile):
+    import gzip
+    gzfile = tempfile + ".gz"
+    with open(gzfile, "wb") as f:
+        f.write(gzip.compress(b"A\n" + b"12345\n" * 1000)[:-20])
+    try:
+        with pytest.raises(IOError) as e:
+            dt.fread(gzfile)
+        assert "ended before the end-of-stream marker" in str(e.value)
+    finally:
+        os.remove(gzfile)
+
+
+def test_fread_gz_file_removes_tempfile(tempfile, tempdir):
+    import gzip
+    gzfile = tempfile + ".gz"
+    with open(gzfile, "wb") as f:
+        f.write(gzip.compress(b"A\n" + b"12345\n" * 1000))
+    try:
+        d0 = dt.fread(gzfile, _tempdir=tempdir)
+        assert d0.shape == (1000, 1)
+        assert os.listdir(tempdir) == []
+        with open(gzfile, "r+b") as f:
+            f.truncate(os.path.getsize(gzfile) - 20)
+        with pytest.raises(IOError):
+            dt.fread(gzfile, _tempdir=tempdir)
+        assert os.listdir(tempdir) == []
+    finally:
+        os.remove(gzfile)
+
+
+@pytest.mark.parametrize("codec", ["gzip", "lzma"])
+def test_fread_compressed_high_ratio(tempfile, codec):
+    # The whole input fits into a single block of compressed data, yet the
+    # decompressed text must not be materialized in memory all at once
+    import importlib
+    import tracemalloc
+    mod = importlib.import_module(codec)
+    n = 1 << 24
+    cfile = tempfile + (".gz" if codec == "gzip" else ".xz")
+    with open(cfile, "wb") as f:
+        f.write(mod.compress(b"A\n" + b"7\n" * n))
+    try:
+        assert os.path.getsize(cfile) < 100000
+        tracemalloc.start()
+        try:
+            d0 = dt.fread(cfile)
+            peak = tracemalloc.get_traced_memory()[1]
+        finally:
+            tracemalloc.stop()
+        assert d0.shape == (n, 1)
+        assert d0.sum1() == 7 * n
+        assert peak < n
+    finally:
+        os.remove(cfile)
+
+
 def test_fread_bz2_file(tempfile, capsys):
     import bz2
     bzfile = tempfile + ".bz2"
@@ -236,7 +308,7 @@ def test_fread_bz2_file(tempfile, capsys):
         frame_integrity_check(d0)
         assert d0.to_list() == [[11, 22, 33]]
         assert not err
-        assert ("Extracting %s into memory" % bzfile) in out
+        assert ("Decompressing %s data from file %s" % ('bz2', bzfile)) in out
     finally:
         os.remove(bzfile)
 
@@ -252,7 +324,8 @@ def test_fread_zip_file_1(tempfile, capsys):
     assert d0.names == ("a", "b", "c")
     assert d0.to_list() == [[10, 5], [20, 7], [30, 12]]
     assert not err
-    assert ("Extracting %s to temporary directory" % zfname) in out
+    assert ("Reading member data1.csv of zip file %s" % zfname) in out
+    assert ("Decompressing deflate data from file %s" % zfname) in out
     os.unlink(zfname)
 
 
@@ -995,3 +1068,110 @@ def test_anonymize2(capsys):
         assert "Column 1 (aaaaaa aaaa)" in out
     finally:
         dt.options.fread.anonymize = False
+
+
+
+#-------------------------------------------------------------------------------
+# iread()
+#-------------------------------------------------------------------------------
+
+def test_iread_simple():
+    src = "A,B\n" + "".join("%d,%s\n" % (i, "x" * (i % 5)) for i in range(1000))
+    frames = list(dt.iread(text=src, chunk_rows=300))
+    assert [f.nrows for f in frames] == [300, 300, 300, 100]
+    for f in frames:
+        frame_integrity_check(f)
+        assert f.names == ("A", "B")
+        assert f.stypes == (dt.int32, dt.str32)
+    d0 = dt.rbind(*frames)
+    assert d0.to_list() == dt.fread(text=src).to_list()
+
+
+@pytest.mark.parametrize("chunk_rows", [1, 3, 10, 100])
+def test_iread_quoted_fields(chunk_rows):
+    src = ('A,B\n1,"a,b"\n2,"multi\nline"\n3,""""\n4,\n5,"x"\n'
+           '6,"y\n\nz"\n7,w\n')
+    frames = list(dt.iread(text=src, chunk_rows=chunk_rows))
+    assert all(f.nrows <= chunk_rows for f in frames)
+    d0 = dt.rbind(*frames)
+    frame_integrity_check(d0)
+    assert d0.to_list() == dt.fread(text=src).to_list()
+
+
+def test_iread_max_nrows():
+    src = "A\n" + "".join("%d\n" % i for i in range(100))
+    frames = list(dt.iread(text=src, chunk_rows=30, max_nrows=75))
+    assert [f.nrows for f in frames] == [30, 30, 15]
+    assert dt.rbind(*frames).to_list() == [list(range(75))]
+
+
+def test_iread_type_bump():
+    # A value in the middle of the file bumps the column types starting
+    # from the chunk that contains it; earlier chunks keep their types
+    lines = ["%d,%d" % (i, i) for i in range(10000)]
+    lines[5000] = "1.5,abc"
+    src = "A,B\n" + "\n".join(lines) + "\n"
+    frames = list(dt.iread(text=src, chunk_rows=1000))
+    assert len(frames) == 10
+    for i, frame in enumerate(frames):
+        frame_integrity_check(frame)
+        assert frame.nrows == 1000
+        if i < 5:
+            assert frame.stypes == (dt.int32, dt.int32)
+        else:
+            assert frame.stypes == (dt.float64, dt.str32)
+    assert frames[4].to_list() == [list(range(4000, 5000))] * 2
+    assert frames[5][0, :].to_list() == [[1.5], ["abc"]]
+
+
+def test_fread_max_nrows_no_bump():
+    # rows past `max_nrows` do not affect the column types
+    src = "A\n" + "".join("%d\n" % i for i in range(100)) + "x\n"
+    d0 = dt.fread(text=src, max_nrows=100)
+    frame_integrity_check(d0)
+    assert d0.stypes == (dt.int32,)
+    assert d0.to_list() == [list(range(100))]
+
+
+def test_iread_empty():
+    frames = list(dt.iread(text="", chunk_rows=10))
+    assert len(frames) == 1
+    assert frames[0].shape == (0, 0)
+    frames = list(dt.iread(text="A,B,C\n", chunk_rows=10))
+    assert len(frames) == 1
+    assert frames[0].shape == (0, 3)
+    assert frames[0].names == ("A", "B", "C")
+
+
+def test_iread_columns():
+    src = "A,B,C\n" + "".join("%d,%d,%d\n" % (i, -i, 2 * i) for i in range(10))
+    frames = list(dt.iread(text=src, chunk_rows=4, columns={"A": "X", "B": None}))
+    assert [f.nrows for f in frames] == [4, 4, 2]
+    for f in frames:
+        assert f.names == ("X", "C")
+    assert dt.rbind(*frames).to_list() == [list(range(10)),
+                                           list(range(0, 20, 2))]
+
+
+def test_iread_gz_file(tempfile):
+    import gzip
+    gzfile = tempfile + ".gz"
+    src = "A,B\n" + "".join("%d,%.1f\n" % (i, i / 2) for i in range(5000))
+    with gzip.open(gzfile, "wb") as f:
+        f.write(src.encode())
+    try:
+        frames = list(dt.iread(gzfile, chunk_rows=2000))
+        assert [f.nrows for f in frames] == [2000, 2000, 1000]
+        assert dt.rbind(*frames).to_list() == dt.fread(text=src).to_list()
+    finally:
+        os.remove(gzfile)
+
+
+def test_iread_bad_chunk_rows():
+    with pytest.raises(ValueError) as e:
+        dt.iread(text="A\n1\n", chunk_rows=0)
+    assert ("Parameter `chunk_rows` should be positive, instead got 0"
+            in str(e.value))
+    with pytest.raises(TypeError) as e:
+        dt.iread(text="A\n1\n", chunk_rows=2.5)
+    assert "Parameter `chunk_rows` should be an integer" in str(e.value)
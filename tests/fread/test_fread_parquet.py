@@ -0,0 +1,512 @@
+#!/usr/bin/env python
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+# Tests for reading Parquet files with `fread`. The test files are produced
+# by a minimal Parquet writer below, so that the tests do not depend on
+# pyarrow; the writer is able to vary the encodings, compression codecs and
+# page formats used in the file.
+#-------------------------------------------------------------------------------
+import ctypes
+import ctypes.util
+import gzip
+import math
+import pytest
+import struct
+import datatable as dt
+from datetime import date, datetime
+from datatable import f, stype, DatatableWarning
+from datatable.internal import frame_integrity_check
+
+
+
+#-------------------------------------------------------------------------------
+# Minimal Parquet writer
+#-------------------------------------------------------------------------------
+
+# Physical types
+BOOLEAN, INT32, INT64, FLOAT, DOUBLE, BYTE_ARRAY = 0, 1, 2, 4, 5, 6
+# Converted types
+UTF8, DECIMAL, DATE, INT_8, INT_16 = 0, 5, 6, 15, 16
+TIMESTAMP_MILLIS, TIMESTAMP_MICROS = 9, 10
+# Codecs
+UNCOMPRESSED, SNAPPY, GZIP, ZSTD = 0, 1, 2, 6
+
+
+def _varint(n):
+    out = bytearray()
+    while True:
+        b = n & 0x7F
+        n >>= 7
+        if n:
+            out.append(b | 0x80)
+        else:
+            out.append(b)
+            return bytes(out)
+
+
+def _thrift(fields):
+    """
+    Encode a struct in Thrift compact protocol. `fields` is a list of tuples
+    (field_id, type, value), where type is one of "i32", "i64", "bool",
+    "bin", "struct", or "list:<elemtype>".
+    """
+    out = bytearray()
+    last = 0
+    codes = {"bool": 1, "i32": 5, "i64": 6, "bin": 8, "struct": 12}
+    for fid, ftype, value in fields:
+        if value is None:
+            continue
+        code = 9 if ftype.startswith("list") else codes[ftype]
+        if ftype == "bool":
+            code = 1 if value else 2
+        out.append(((fid - last) << 4) | code)
+        last = fid
+        if ftype.startswith("list"):
+            etype = ftype[5:]
+            n = len(value)
+            out.append((n << 4 | codes[etype]) if n < 15
+                       else (0xF0 | codes[etype]))
+            if n >= 15:
+                out += _varint(n)
+            for v in value:
+                out += _thrift_value(etype, v)
+        elif ftype != "bool":
+            out += _thrift_value(ftype, value)
+    out.append(0)
+    return bytes(out)
+
+
+def _thrift_value(ftype, value):
+    if ftype in ("i32", "i64"):
+        return _varint((value << 1) ^ (value >> 63))
+    if ftype == "bin":
+        if isinstance(value, str):
+            value = value.encode()
+        return _varint(len(value)) + value
+    assert ftype == "struct"
+    return _thrift(value)
+
+
+def _rle_runs(values, width):
+    """RLE / bit-packed hybrid encoding, using RLE runs only."""
+    out = bytearray()
+    nbytes = (width + 7) // 8
+    i = 0
+    while i < len(values):
+        j = i
+        while j < len(values) and values[j] == values[i]:
+            j += 1
+        out += _varint((j - i) << 1)
+        out += values[i].to_bytes(nbytes, "little")
+        i = j
+    return bytes(out)
+
+
+def _bit_packed(values, width):
+    """RLE / bit-packed hybrid encoding, using a single bit-packed run."""
+    ngroups = (len(values) + 7) // 8
+    acc = 0
+    for i, v in enumerate(values):
+        acc |= v << (i * width)
+    return _varint((ngroups << 1) | 1) + acc.to_bytes(ngroups * width,
+                                                      "little")
+
+
+def _snappy(data):
+    """Simple snappy compressor: 4-byte matches via a hash table."""
+    out = bytearray(_varint(len(data)))
+    table = {}
+    lit_start = 0
+    i = 0
+
+    def emit_literal(start, end):
+        while start < end:
+            n = min(end - start, 65536)
+            if n <= 60:
+                out.append((n - 1) << 2)
+            else:
+                out.append(61 << 2)
+                out.extend((n - 1).to_bytes(2, "little"))
+            out.extend(data[start:start + n])
+            start += n
+
+    while i + 4 <= len(data):
+        key = data[i:i + 4]
+        j = table.get(key)
+        table[key] = i
+        if j is not None and i - j < 65536:
+            emit_literal(lit_start, i)
+            length = 4
+            while (i + length < len(data) and length < 64 and
+                   data[j + length] == data[i + length]):
+                length += 1
+            out.append(((length - 1) << 2) | 2)
+            out.extend((i - j).to_bytes(2, "little"))
+            i += length
+            lit_start = i
+        else:
+            i += 1
+    emit_literal(lit_start, len(data))
+    return bytes(out)
+
+
+def _zstd_compress(data):
+    libname = ctypes.util.find_library("zstd")
+    if not libname:
+        pytest.skip("libzstd is not available")
+    lib = ctypes.CDLL(libname)
+    lib.ZSTD_compressBound.restype = ctypes.c_size_t
+    lib.ZSTD_compress.restype = ctypes.c_size_t
+    cap = lib.ZSTD_compressBound(ctypes.c_size_t(len(data)))
+    buf = ctypes.create_string_buffer(cap)
+    n = lib.ZSTD_compress(buf, ctypes.c_size_t(cap), data,
+                          ctypes.c_size_t(len(data)), 3)
+    return buf.raw[:n]
+
+
+def _compress(codec, data):
+    if codec == UNCOMPRESSED: return data
+    if codec == SNAPPY: return _snappy(data)
+    if codec == GZIP: return gzip.compress(data)
+    if codec == ZSTD: return _zstd_compress(data)
+
+
+def _plain(ptype, values):
+    if ptype == BOOLEAN:
+        acc = 0
+        for i, v in enumerate(values):
+            acc |= int(v) << i
+        return acc.to_bytes((len(values) + 7) // 8, "little")
+    if ptype == BYTE_ARRAY:
+        out = bytearray()
+        for v in values:
+            v = v.encode()
+            out += struct.pack("<I", len(v)) + v
+        return bytes(out)
+    fmt = {INT32: "i", INT64: "q", FLOAT: "f", DOUBLE: "d"}[ptype]
+    return struct.pack("<%d%s" % (len(values), fmt), *values)
+
+
+def write_parquet(path, columns, rowgroup_size=None, codec=UNCOMPRESSED,
+                  dictionary=False, page_version=1, page_size=None):
+    """
+    Write a Parquet file with the given `columns`: a list of tuples
+    (name, physical_type, values[, converted_type[, scale[, logical]]]),
+    where `logical` is the list of fields of the LogicalType union. Columns
+    that contain None values are written as OPTIONAL. Names of the form "g.x"
+    place the column into an (optional) group "g".
+    """
+    nrows = len(columns[0][2])
+    rowgroup_size = rowgroup_size or max(nrows, 1)
+    page_size = page_size or rowgroup_size
+    out = bytearray(b"PAR1")
+    row_groups = []
+    for r0 in range(0, nrows, rowgroup_size):
+        r1 = min(r0 + rowgroup_size, nrows)
+        chunks = []
+        for col in columns:
+            name, ptype, values = col[:3]
+            optional = any(v is None for v in values)
+            max_def = int(optional) + int("." in name)
+            use_dict = dictionary and ptype != BOOLEAN
+            allvalues = [v for v in values if v is not None]
+            dictvalues = sorted(set(allvalues))
+            start = len(out)
+            dict_offset = None
+            if use_dict:
+                payload = _plain(ptype, dictvalues)
+                comp = _compress(codec, payload)
+                header = _thrift([
+                    (1, "i32", 2), (2, "i32", len(payload)),
+                    (3, "i32", len(comp)),
+                    (7, "struct", [(1, "i32", len(dictvalues)),
+                                   (2, "i32", 0)])])
+                dict_offset = len(out)
+                out += header + comp
+            data_offset = len(out)
+            for p0 in range(r0, r1, page_size):
+                p1 = min(p0 + page_size, r1)
+                chunk = values[p0:p1]
+                present = [v for v in chunk if v is not None]
+                if use_dict:
+                    idx = {v: i for i, v in enumerate(dictvalues)}
+                    width = max(1, (len(dictvalues) - 1).bit_length())
+                    vals = bytes([width]) + _bit_packed(
+                        [idx[v] for v in present], width)
+                    encoding = 8  # RLE_DICTIONARY
+                else:
+                    vals = _plain(ptype, present)
+                    encoding = 0
+                levels = b""
+                if max_def:
+                    levels = _rle_runs([max_def if v is not None else 0
+                                        for v in chunk],
+                                       max_def.bit_length())
+                if page_version == 1:
+                    if max_def:
+                        levels = struct.pack("<I", len(levels)) + levels
+                    payload = levels + vals
+                    comp = _compress(codec, payload)
+                    header = _thrift([
+                        (1, "i32", 0), (2, "i32", len(payload)),
+                        (3, "i32", len(comp)),
+                        (5, "struct", [(1, "i32", len(chunk)),
+                                       (2, "i32", encoding),
+                                       (3, "i32", 3), (4, "i32", 3)])])
+                else:
+                    comp = levels + _compress(codec, vals)
+                    header = _thrift([
+                        (1, "i32", 3), (2, "i32", len(levels) + len(vals)),
+                        (3, "i32", len(comp)),
+                        (8, "struct", [(1, "i32", len(chunk)),
+                                       (2, "i32", len(chunk) - len(present)),
+                                       (3, "i32", len(chunk)),
+                                       (4, "i32", encoding),
+                                       (5, "i32", len(levels)),
+                                       (6, "i32", 0),
+                                       (7, "bool", codec != UNCOMPRESSED)])])
+                out += header + comp
+            chunks.append([
+                (2, "i64", start),
+                (3, "struct", [
+                    (1, "i32", ptype),
+                    (2, "list:i32", [0, 3]),
+                    (3, "list:bin", name.split(".")),
+                    (4, "i32", codec),
+                    (5, "i64", r1 - r0),
+                    (6, "i64", len(out) - start),
+                    (7, "i64", len(out) - start),
+                    (9, "i64", data_offset),
+                    (11, "i64", dict_offset)])])
+        row_groups.append([(1, "list:struct", chunks),
+                           (2, "i64", len(out)),
+                           (3, "i64", r1 - r0)])
+    schema = [[(4, "bin", "schema"), (5, "i32", 0)]]
+    nroot = 0
+    for i, col in enumerate(columns):
+        name, ptype, values = col[:3]
+        ctype = col[3] if len(col) > 3 else None
+        scale = col[4] if len(col) > 4 else None
+        logical = col[5] if len(col) > 5 else None
+        optional = any(v is None for v in values)
+        if "." in name:
+            group, name = name.split(".")
+            if i == 0 or columns[i - 1][0].split(".")[0] != group:
+                nchildren = sum(c[0].startswith(group + ".") for c in columns)
+                schema.append([(3, "i32", 1), (4, "bin", group),
+                               (5, "i32", nchildren)])
+                nroot += 1
+        else:
+            nroot += 1
+        schema.append([(1, "i32", ptype), (3, "i32", int(optional)),
+                       (4, "bin", name), (6, "i32", ctype),
+                       (7, "i32", scale), (10, "struct", logical)])
+    schema[0][1] = (5, "i32", nroot)
+    meta = _thrift([(1, "i32", 1),
+                    (2, "list:struct", schema),
+                    (3, "i64", nrows),
+                    (4, "list:struct", row_groups),
+                    (6, "bin", "datatable tests")])
+    out += meta + struct.pack("<I", len(meta)) + b"PAR1"
+    with open(path, "wb") as f:
+        f.write(out)
+
+
+
+#-------------------------------------------------------------------------------
+# Tests
+#-------------------------------------------------------------------------------
+
+def sample_columns(n):
+    return [
+        ("A", INT32, list(range(n))),
+        ("B", INT64, [i * 10**10 if i % 7 else None for i in range(n)]),
+        ("C", DOUBLE, [i / 4 for i in range(n)]),
+        ("D", FLOAT, [None if i % 5 == 1 else i * 0.5 for i in range(n)]),
+        ("E", BOOLEAN, [None if i % 3 == 2 else bool(i % 2)
+                        for i in range(n)]),
+        ("F", BYTE_ARRAY, [None if i % 4 == 3 else "s%d" % (i % 13) * (i % 3)
+                           for i in range(n)], UTF8),
+    ]
+
+
+def check_frame(DT, columns):
+    frame_integrity_check(DT)
+    assert DT.names == tuple(col[0] for col in columns)
+    assert DT.stypes == (stype.int32, stype.int64, stype.float64,
+                         stype.float32, stype.bool8, stype.str32)
+    assert DT.to_list() == [col[2] for col in columns]
+
+
+@pytest.mark.parametrize("codec", [UNCOMPRESSED, SNAPPY, GZIP, ZSTD])
+@pytest.mark.parametrize("dictionary", [False, True])
+@pytest.mark.parametrize("page_version", [1, 2])
+def test_parquet_read(tempfile, codec, dictionary, page_version):
+    cols = sample_columns(1000)
+    write_parquet(tempfile, cols, rowgroup_size=300, codec=codec,
+                  dictionary=dictionary, page_version=page_version,
+                  page_size=128)
+    DT = dt.fread(tempfile)
+    check_frame(DT, cols)
+
+
+def test_parquet_read_empty(tempfile):
+    cols = sample_columns(0)
+    write_parquet(tempfile, cols)
+    DT = dt.fread(tempfile)
+    assert DT.shape == (0, 6)
+    assert DT.names == ("A", "B", "C", "D", "E", "F")
+
+
+def test_parquet_projection(tempfile):
+    cols = sample_columns(100)
+    write_parquet(tempfile, cols, rowgroup_size=40, codec=SNAPPY)
+    DT = dt.fread(tempfile, columns={"A", "F"})
+    frame_integrity_check(DT)
+    assert DT.names == ("A", "F")
+    assert DT.to_list() == [cols[0][2], cols[5][2]]
+    DT = dt.fread(tempfile, columns=lambda cols: [c.name in "CE"
+                                                  for c in cols])
+    assert DT.names == ("C", "E")
+    assert DT.to_list() == [cols[2][2], cols[4][2]]
+    DT = dt.fread(tempfile, columns={"B": "bee", "D": "dee", ...: None})
+    assert DT.names == ("bee", "dee")
+    assert DT.to_list() == [cols[1][2], cols[3][2]]
+
+
+def test_parquet_max_nrows(tempfile):
+    cols = sample_columns(100)
+    write_parquet(tempfile, cols, rowgroup_size=30, dictionary=True)
+    DT = dt.fread(tempfile, max_nrows=45)
+    frame_integrity_check(DT)
+    assert DT.to_list() == [col[2][:45] for col in cols]
+
+
+def test_parquet_converted_types(tempfile):
+    cols = [("i8", INT32, [1, -5, None, 127], INT_8),
+            ("i16", INT32, [1000, None, -32000, 7], INT_16),
+            ("dec", INT64, [12345, -1, None, 100], DECIMAL, 2),
+            ("raw", BYTE_ARRAY, ["a", "", None, "é"])]
+    write_parquet(tempfile, cols)
+    DT = dt.fread(tempfile)
+    frame_integrity_check(DT)
+    assert DT.stypes == (stype.int8, stype.int16, stype.float64, stype.str32)
+    assert DT.to_list() == [[1, -5, None, 127], [1000, None, -32000, 7],
+                            [123.45, -0.01, None, 1.0],
+                            ["a", "", None, "é"]]
+
+
+def test_parquet_temporal_types(tempfile):
+    # TIMESTAMP(unit=NANOS) logical type, without a converted type
+    nanos = [(8, "struct", [(1, "bool", True),
+                            (2, "struct", [(3, "struct", [])])])]
+    cols = [("d", INT32, [17591, None, -1, 0], DATE),
+            ("ms", INT64, [1519907415500, -1, None, 0], TIMESTAMP_MILLIS),
+            ("us", INT64, [None, -1, 1, 946684800000000], TIMESTAMP_MICROS),
+            ("ns", INT64, [1500, -1, -1000, None], None, None, nanos)]
+    write_parquet(tempfile, cols)
+    DT = dt.fread(tempfile)
+    frame_integrity_check(DT)
+    assert DT.stypes == (stype.date32, stype.date64, stype.date64,
+                         stype.date64)
+    assert DT[:, [dt.int32(f.d), dt.int64(f.ms), dt.int64(f.us),
+                  dt.int64(f.ns)]].to_list() == [
+        [17591, None, -1, 0],
+        [1519907415500000, -1000, None, 0],
+        [None, -1, 1, 946684800000000],
+        [1, -1, -1, None]]
+
+
+def test_parquet_temporal_pyarrow(tempfile, pyarrow):
+    import pyarrow.parquet as pq
+    dates = [date(2018, 3, 1), None, date(1969, 12, 31), date(1, 1, 1)]
+    times = [datetime(2018, 3, 1, 12, 30, 15, 500000), None,
+             datetime(1969, 12, 31, 23, 59, 59), datetime(2000, 1, 1)]
+    table = pyarrow.table({
+        "d": pyarrow.array(dates, pyarrow.date32()),
+        "ms": pyarrow.array(times, pyarrow.timestamp("ms")),
+        "us": pyarrow.array(times, pyarrow.timestamp("us")),
+        "ns": pyarrow.array(times, pyarrow.timestamp("ns")),
+        "nsneg": pyarrow.array([-1, 999, None, -1001],
+                               pyarrow.timestamp("ns")),
+    })
+    pq.write_table(table, tempfile)
+    DT = dt.fread(tempfile)
+    frame_integrity_check(DT)
+    assert DT.names == ("d", "ms", "us", "ns", "nsneg")
+    assert DT.stypes == (stype.date32,) + (stype.date64,) * 4
+    assert DT.to_list()[:4] == [dates, times, times, times]
+    assert DT[:, dt.int64(f.nsneg)].to_list() == [[-1, 0, None, -2]]
+
+    cols = [("id", INT32, [1, 2, 3]),
+            ("g.x", DOUBLE, [0.5, None, 1.5]),
+            ("g.y", BYTE_ARRAY, ["p", "q", None], UTF8)]
+    write_parquet(tempfile, cols, codec=GZIP, page_version=2)
+    DT = dt.fread(tempfile)
+    frame_integrity_check(DT)
+    assert DT.names == ("id", "g.x", "g.y")
+    assert DT.to_list() == [[1, 2, 3], [0.5, None, 1.5], ["p", "q", None]]
+
+
+def test_parquet_large_strings(tempfile):
+    n = 20000
+    words = ["alpha", "beta", "gamma", "delta", None, ""]
+    cols = [("W", BYTE_ARRAY, [words[i % 6] if i % 11 else "x" * (i % 97)
+                               for i in range(n)], UTF8)]
+    write_parquet(tempfile, cols, rowgroup_size=3000, codec=SNAPPY)
+    DT = dt.fread(tempfile, nthreads=4)
+    frame_integrity_check(DT)
+    assert DT.to_list() == [cols[0][2]]
+
+
+def test_parquet_type_override_warning(tempfile):
+    cols = sample_columns(10)
+    write_parquet(tempfile, cols)
+    with pytest.warns(DatatableWarning, match="type overrides are not "
+                                              "supported"):
+        DT = dt.fread(tempfile, columns={"A": str, ...: None})
+    assert DT.names == ("A",)
+    assert DT.stypes == (stype.int32,)
+
+
+def test_parquet_corrupted(tempfile):
+    cols = sample_columns(50)
+    write_parquet(tempfile, cols, codec=SNAPPY)
+    with open(tempfile, "rb") as f:
+        data = bytearray(f.read())
+    # Damage the compressed data, but keep the metadata intact
+    for i in range(8, 200):
+        data[i] = 0xFF
+    with open(tempfile, "wb") as f:
+        f.write(data)
+    with pytest.raises(IOError) as e:
+        dt.fread(tempfile)
+    assert "Invalid Parquet file" in str(e.value)
+
+
+def test_parquet_unsupported_codec(tempfile):
+    cols = sample_columns(5)
+    write_parquet(tempfile, cols)
+    with open(tempfile, "rb") as f:
+        data = f.read()
+    # Change the codec of all columns chunks from UNCOMPRESSED to LZO: the
+    # codec is the field 4 of ColumnMetaData, encoded as byte 0x15 (field
+    # delta 1, type i32) followed by zigzag-encoded value
+    metalen = struct.unpack("<I", data[-8:-4])[0]
+    meta = data[-8 - metalen:-8]
+    meta = meta.replace(b"\x15\x00\x16", b"\x15\x06\x16")
+    with open(tempfile, "wb") as f:
+        f.write(data[:-8 - metalen] + meta + data[-8:])
+    with pytest.raises(NotImplementedError) as e:
+        dt.fread(tempfile)
+    assert "Compression codec `lzo`" in str(e.value)
+
+
+def test_parquet_iread(tempfile):
+    write_parquet(tempfile, sample_columns(10))
+    with pytest.raises(NotImplementedError) as e:
+        list(dt.iread(tempfile, chunk_rows=5))
+    assert "Parquet files cannot be read in chunks" in str(e.value)
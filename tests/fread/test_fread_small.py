@@ -151,32 +151,86 @@ def test_float_decimal0(noppc64):
 
 def test_float_precision():
     """
-    This is a collection of numbers that fread is known to read with up to
-    ±1 ulp difference.
+    This is a collection of numbers that fread used to read with up to ±1 ulp
+    difference (before the conversion into doubles became correctly rounded).
     """
     src = [
-        0.2396234748320447,  # reads as 0.23962347483204471 (+1 ulp)
-        1.378139026373428,   # reads as 1.3781390263734279  (-1 ulp)
-        2.543666492383583,   # reads as 2.5436664923835828  (-1 ulp)
-        3.656561722844758,   # reads as 3.6565617228447582  (+1 ulp)
-        4.018175023192327,   # reads as 4.0181750231923274  (+1 ulp)
-        4.04715454502159,    # reads as 4.0471545450215896  (-1 ulp)
-        4.413672796373175,   # reads as 4.4136727963731754  (+1 ulp)
-        4.909681284908054,   # reads as 4.9096812849080536  (-1 ulp)
-        5.66862328123907,    # reads as 5.6686232812390696  (-1 ulp)
-        6.712919901967767,   # reads as 6.7129199019677674  (+1 ulp)
-        7.304360333549758,   # reads as 7.3043603335497576  (-1 ulp)
-        7.58971840634146,    # reads as 7.5897184063414596  (-1 ulp)
-        7.964328507593605,   # reads as 7.9643285075936046  (-1 ulp)
-        8.65026955243522,    # reads as 8.650269552435219   (-1 ulp)
-        10.48519326055973,   # reads as 10.485193260559729  (-1 ulp)
-        20.77288912176836,   # reads as 20.772889121768358  (-1 ulp)
+        0.2396234748320447,  # was read as 0.23962347483204471 (+1 ulp)
+        1.378139026373428,   # was read as 1.3781390263734279  (-1 ulp)
+        2.543666492383583,   # was read as 2.5436664923835828  (-1 ulp)
+        3.656561722844758,   # was read as 3.6565617228447582  (+1 ulp)
+        4.018175023192327,   # was read as 4.0181750231923274  (+1 ulp)
+        4.04715454502159,    # was read as 4.0471545450215896  (-1 ulp)
+        4.413672796373175,   # was read as 4.4136727963731754  (+1 ulp)
+        4.909681284908054,   # was read as 4.9096812849080536  (-1 ulp)
+        5.66862328123907,    # was read as 5.6686232812390696  (-1 ulp)
+        6.712919901967767,   # was read as 6.7129199019677674  (+1 ulp)
+        7.304360333549758,   # was read as 7.3043603335497576  (-1 ulp)
+        7.58971840634146,    # was read as 7.5897184063414596  (-1 ulp)
+        7.964328507593605,   # was read as 7.9643285075936046  (-1 ulp)
+        8.65026955243522,    # was read as 8.650269552435219   (-1 ulp)
+        10.48519326055973,   # was read as 10.485193260559729  (-1 ulp)
+        20.77288912176836,   # was read as 20.772889121768358  (-1 ulp)
     ]
     text = "A\n" + "\n".join(str(x) for x in src)
     d0 = dt.fread(text)
     frame_integrity_check(d0)
     assert d0.ltypes == (ltype.real, )
-    assert list_equals(d0.to_list()[0], src)
+    assert d0.to_list()[0] == src
+
+
+@pytest.mark.parametrize("seed", [random.getrandbits(32)])
+def test_float_random_exact(seed):
+    # Doubles written with repr() must be read back exactly
+    random.seed(seed)
+    src = []
+    for _ in range(1000):
+        x = random.random() * 10**random.randint(-30, 30)
+        if random.random() < 0.2:
+            x = round(x, random.randint(0, 6))
+        src.append(x)
+    text = "A\n" + "\n".join(repr(x) for x in src) + "\n"
+    d0 = dt.fread(text)
+    frame_integrity_check(d0)
+    assert d0.ltypes == (ltype.real, )
+    assert d0.to_list()[0] == src
+
+
+@pytest.mark.parametrize("seed", [random.getrandbits(32)])
+def test_float_long_mantissa(seed):
+    # Numbers with more than 18 significant digits, including those that are
+    # very close to the midpoint between two doubles, are read exactly
+    random.seed(seed)
+    src = ["9007199254740993.00000000000000000001",
+           "2.4703282292062327208828439643411068618252990130716238221279e-324",
+           "1.00000000000000011102230246251565404236316680908203125",
+           "1.00000000000000011102230246251565404236316680908203124",
+           "17976931348623158079372897140530.1e277"]
+    for _ in range(1000):
+        digits = "".join(random.choice("0123456789")
+                         for _ in range(random.randint(19, 40)))
+        k = random.randint(0, len(digits))
+        x = digits[:k] + "." + digits[k:]
+        if random.random() < 0.5:
+            x += "e%d" % random.randint(-300, 280)
+        src.append(x)
+    d0 = dt.fread("A\n" + "\n".join(src) + "\n")
+    frame_integrity_check(d0)
+    assert d0.ltypes == (ltype.real, )
+    assert d0.to_list()[0] == [float(x) for x in src]
+    d1 = dt.fread("A\n" + "\n".join(x.replace(".", ",") for x in src),
+                  sep=";", dec=",")
+    assert d1.to_list() == d0.to_list()
+
+
+def test_float_boundaries():
+    src = ["1.7976931348623157e308", "2.2250738585072014e-308",
+           "4.9e-324", "9007199254740993.0", "1e23", "0.1",
+           "123456789012345678.5", "0.30000000000000004"]
+    d0 = dt.fread("A\n" + "\n".join(src))
+    frame_integrity_check(d0)
+    assert d0.ltypes == (ltype.real, )
+    assert d0.to_list()[0] == [float(x) for x in src]
 
 
 def test_float_overflow():
@@ -208,6 +262,21 @@ def test_int():
                             [0, 9999, -1000, 99, None]]
 
 
+def test_int_various_lengths():
+    # Integers with the number of digits around the multiples of 8, with and
+    # without the trailing newline
+    src = [int("9876543210123456789"[:n]) for n in range(1, 19)]
+    src += [-x for x in src]
+    for eol in ["", "\n"]:
+        d0 = dt.fread("A\n" + "\n".join(str(x) for x in src) + eol)
+        frame_integrity_check(d0)
+        assert d0.stypes == (stype.int64, )
+        assert d0.to_list() == [src]
+        d1 = dt.fread("A\n" + "\n".join("00000000" + str(x) for x in src
+                                          if x > 0) + eol)
+        assert d1.to_list() == [[x for x in src if x > 0]]
+
+
 def test_leading0s():
     src = "\n".join("%03d" % i for i in range(1000))
     d0 = dt.fread(src)
@@ -701,6 +770,35 @@ def test_fread_quoting():
     assert d3.to_list() == [[1, 2], [3, 4], ["foo", "ba,\"r,"], [5, 6]]
 
 
+def test_fread_long_string_fields():
+    # Fields longer than the block size of the vectorized scanner, with the
+    # separators / quotes / newlines at every possible offset within a block
+    words = ["x" * k for k in range(40)]
+    src = "A,B\n" + "".join("%s,%d\n" % (w, i) for i, w in enumerate(words))
+    d0 = dt.fread(src)
+    frame_integrity_check(d0)
+    assert d0.to_list() == [words, list(range(40))]
+    d1 = dt.fread(src.replace("\n", "\r\n"))
+    assert d1.to_list() == d0.to_list()
+    d2 = dt.fread(src.strip())
+    assert d2.to_list() == d0.to_list()
+
+
+def test_fread_long_quoted_fields():
+    vals = ['a' * k + '""' + 'b' * (30 - k) for k in range(31)]
+    src = "A,B\n" + "".join('"%s",%d\n' % (v, i) for i, v in enumerate(vals))
+    d0 = dt.fread(src)
+    frame_integrity_check(d0)
+    assert d0.to_list() == [[v.replace('""', '"') for v in vals],
+                            list(range(31))]
+    vals = ['a\\"' * k + 'b\r\nc' * (20 - k) for k in range(21)]
+    src = "A,B\n" + "".join('"%s",%d\n' % (v, i) for i, v in enumerate(vals))
+    d1 = dt.fread(src)
+    frame_integrity_check(d1)
+    assert d1.to_list() == [[v.replace('\\"', '"') for v in vals],
+                            list(range(21))]
+
+
 def test_fread_default_colnames():
     """Check that columns with missing headers get assigned proper names."""
     f0 = dt.fread('A,B,,D\n1,3,foo,5\n2,4,bar,6\n')
@@ -35,6 +35,7 @@ from tests import noop, assert_equals
 
 
 numeric_stypes = ltype.bool.stypes + ltype.int.stypes + ltype.real.stypes
+float_stypes = [stype.float32, stype.float64]
 all_stypes = numeric_stypes + ltype.str.stypes + ltype.obj.stypes
 
 valid_stype_pairs = []
@@ -75,7 +76,7 @@ def test_cast_m127_to_bool():
     assert RES.to_list()[0] == [True, True, False, True, True]
 
 
-@pytest.mark.parametrize("source_stype", ltype.real.stypes)
+@pytest.mark.parametrize("source_stype", float_stypes)
 def test_cast_float_to_bool(source_stype):
     DT = dt.Frame(G=[-math.inf, math.inf, math.nan, 0.0, 13.4, 1.0, -1.0, -128],
                   stype=source_stype)
@@ -124,7 +125,7 @@ def test_cast_large_to_int(target_stype):
     assert RES.to_list() == DT.to_list()
 
 
-@pytest.mark.parametrize("source_stype", ltype.real.stypes)
+@pytest.mark.parametrize("source_stype", float_stypes)
 @pytest.mark.parametrize("target_stype", ltype.int.stypes)
 def test_cast_float_to_int(source_stype, target_stype):
     DT = dt.Frame(F=[0.1, math.nan, 7.500, -4.8, 1.111111e2, 28.99999],
@@ -135,8 +136,10 @@ def test_cast_float_to_int(source_stype, target_stype):
     assert RES.to_list()[0] == [0, None, 7, -4, 111, 28]
 
 
+# Strings can only be cast into decimals (see test_decimal.py)
 @pytest.mark.parametrize("source_stype", ltype.str.stypes + [stype.obj64])
-@pytest.mark.parametrize("target_stype", numeric_stypes)
+@pytest.mark.parametrize("target_stype",
+                         ltype.bool.stypes + ltype.int.stypes + float_stypes)
 def test_cast_other_to_numeric(source_stype, target_stype):
     DT = dt.Frame(W=[0, 1, 2], stype=source_stype)
     assert DT.stypes == (source_stype,)
@@ -210,7 +213,7 @@ def test_cast_int_to_str(source_stype):
     assert RES.to_list()[0] == ans
 
 
-@pytest.mark.parametrize("source_stype", ltype.real.stypes)
+@pytest.mark.parametrize("source_stype", float_stypes)
 def test_cast_float_to_str(source_stype):
     DT = dt.Frame(J=[3.5, 7.049, -3.18, math.inf, math.nan, 1.0, -math.inf,
                      1e16, 0],
@@ -0,0 +1,150 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#-------------------------------------------------------------------------------
+# Copyright 2018 H2O.ai
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+#-------------------------------------------------------------------------------
+import pytest
+import datatable as dt
+from datatable import stype
+from datatable.internal import frame_integrity_check
+from datatable.lib import core
+from tests import assert_equals
+
+
+def column_ptr(frame, i):
+    return core.frame_column_data_r(frame, i).value
+
+
+#-------------------------------------------------------------------------------
+# Round-trip via the Arrow PyCapsule interface
+#-------------------------------------------------------------------------------
+
+def test_arrow_c_array_capsules():
+    DT = dt.Frame(A=[1, 2, 3])
+    res = DT.__arrow_c_array__()
+    assert isinstance(res, tuple)
+    assert len(res) == 2
+    assert "arrow_schema" in repr(res[0])
+    assert "arrow_array" in repr(res[1])
+
+
+@pytest.mark.parametrize("st", [stype.bool8, stype.int8, stype.int16,
+                                stype.int32, stype.int64, stype.float32,
+                                stype.float64, stype.str32, stype.str64])
+def test_arrow_roundtrip(st):
+    src = [1, 0, None, 1, 1, None, 0]
+    if st in (stype.str32, stype.str64):
+        src = ["alpha", "", None, "beta", "∀x", None, "gamma"]
+    DT = dt.Frame(A=src, stype=st)
+    RES = dt.Frame.from_arrow(DT)
+    frame_integrity_check(RES)
+    assert RES.stypes == (st,)
+    assert_equals(RES, DT)
+
+
+def test_arrow_roundtrip_multiple_columns():
+    DT = dt.Frame(A=range(10), B=[i / 3 for i in range(10)],
+                  C=["a" * i for i in range(10)], D=[True, False] * 5)
+    RES = dt.Frame.from_arrow(DT)
+    frame_integrity_check(RES)
+    assert_equals(RES, DT)
+
+
+def test_arrow_roundtrip_view():
+    DT = dt.Frame(A=range(20), B=[str(i) if i % 3 else None
+                                  for i in range(20)])
+    view = DT[::-3, :]
+    RES = dt.Frame.from_arrow(view)
+    frame_integrity_check(RES)
+    assert RES.to_list() == view.to_list()
+
+
+def test_arrow_roundtrip_empty():
+    DT = dt.Frame(A=[], B=[], stypes=[stype.int32, stype.str32])
+    RES = dt.Frame.from_arrow(DT)
+    frame_integrity_check(RES)
+    assert RES.shape == (0, 2)
+    assert RES.names == ("A", "B")
+    assert RES.stypes == (stype.int32, stype.str32)
+
+
+def test_arrow_zero_copy():
+    DT = dt.Frame(A=list(range(1000)), B=["x%d" % i for i in range(1000)])
+    RES = dt.Frame.from_arrow(DT)
+    assert column_ptr(RES, 0) == column_ptr(DT, 0)
+    assert column_ptr(RES, 1) == column_ptr(DT, 1)
+    # the imported frame keeps the data alive
+    del DT
+    assert RES[999, 0] == 999
+    assert RES[999, 1] == "x999"
+
+
+def test_arrow_export_obj_column():
+    DT = dt.Frame(A=[1, "two", 3.0], stype=stype.obj64)
+    with pytest.raises(TypeError) as e:
+        DT.__arrow_c_array__()
+    assert ("Column `A` of type `obj64` cannot be converted into Arrow "
+            "format" in str(e.value))
+
+
+def test_arrow_import_bad_source():
+    with pytest.raises(TypeError) as e:
+        dt.Frame.from_arrow([1, 2, 3])
+    assert "does not support the Arrow PyCapsule interface" in str(e.value)
+
+
+
+#-------------------------------------------------------------------------------
+# Interoperability with pyarrow
+#-------------------------------------------------------------------------------
+
+def test_to_arrow(pyarrow):
+    DT = dt.Frame(A=[1, None, 3], B=[1.5, 2.5, None], C=["a", None, "cde"],
+                  D=[True, None, False])
+    tbl = DT.to_arrow()
+    assert isinstance(tbl, pyarrow.Table)
+    assert tbl.column_names == ["A", "B", "C", "D"]
+    assert tbl.to_pydict() == DT.to_dict()
+
+
+def test_from_arrow_table(pyarrow):
+    tbl = pyarrow.table({"A": [1, None, 3], "B": ["x", "yy", None],
+                         "C": pyarrow.array([7, 8, 9], pyarrow.uint32())})
+    DT = dt.Frame.from_arrow(tbl)
+    frame_integrity_check(DT)
+    assert DT.names == ("A", "B", "C")
+    assert DT.stypes == (stype.int64, stype.str32, stype.int64)
+    assert DT.to_list() == [[1, None, 3], ["x", "yy", None], [7, 8, 9]]
+
+
+def test_from_arrow_chunked(pyarrow):
+    batch = pyarrow.record_batch({"A": [1, 2, 3], "B": ["a", "b", None]})
+    tbl = pyarrow.Table.from_batches([batch, batch.slice(1)])
+    DT = dt.Frame.from_arrow(tbl)
+    frame_integrity_check(DT)
+    assert DT.to_list() == [[1, 2, 3, 2, 3], ["a", "b", None, "b", None]]
+
+
+def test_from_arrow_sliced_array(pyarrow):
+    arr = pyarrow.array(["a", "bb", None, "dddd", "e"]).slice(1, 3)
+    DT = dt.Frame.from_arrow(arr)
+    frame_integrity_check(DT)
+    assert DT.to_list() == [["bb", None, "dddd"]]
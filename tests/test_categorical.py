@@ -0,0 +1,288 @@
+#!/usr/bin/env python
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+# Tests for the categorical stypes `cat8`, `cat16` and `cat32`.
+#-------------------------------------------------------------------------------
+import pytest
+import random
+import datatable as dt
+from datatable import f, join, stype, ltype
+from datatable.internal import frame_integrity_check
+
+cat_stypes = [stype.cat8, stype.cat16, stype.cat32]
+
+
+def random_strings(n, nlevels, seed=None):
+    rnd = random.Random(seed)
+    levels = ["%s%d" % (rnd.choice("abcxyz"), i) for i in range(nlevels)]
+    return [rnd.choice(levels) if rnd.random() < 0.9 else None
+            for _ in range(n)]
+
+
+
+#-------------------------------------------------------------------------------
+# Creation & conversion
+#-------------------------------------------------------------------------------
+
+@pytest.mark.parametrize("st", cat_stypes)
+def test_create_from_list(st):
+    src = ["dog", "cat", None, "dog", "", "mouse", "cat"]
+    DT = dt.Frame(A=src, stype=st)
+    frame_integrity_check(DT)
+    assert DT.stypes == (st,)
+    assert DT.ltypes == (ltype.str,)
+    assert DT.to_list() == [src]
+
+
+def test_create_wide():
+    src = [str(i) for i in range(1000)]
+    DT = dt.Frame(src, stype=stype.cat8)
+    frame_integrity_check(DT)
+    # Too many levels for cat8: the column is created as cat16
+    assert DT.stypes == (stype.cat16,)
+    assert DT.to_list() == [src]
+
+
+@pytest.mark.parametrize("st", cat_stypes)
+def test_cast_str_to_cat_and_back(st):
+    src = random_strings(1000, 30, seed=st.value)
+    DT = dt.Frame(src)
+    cast = {stype.cat8: dt.cat8, stype.cat16: dt.cat16, stype.cat32: dt.cat32}
+    RES = DT[:, cast[st](f[0])]
+    frame_integrity_check(RES)
+    assert RES.stypes == (st,)
+    assert RES.to_list() == [src]
+    BACK = RES[:, dt.str32(f[0])]
+    frame_integrity_check(BACK)
+    assert BACK.stypes == (stype.str32,)
+    assert BACK.to_list() == [src]
+
+
+def test_cast_int_to_cat():
+    DT = dt.Frame([5, 3, None, 5, 10])
+    RES = DT[:, dt.cat8(f[0])]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [["5", "3", None, "5", "10"]]
+
+
+def test_view():
+    src = ["a", "b", None, "c", "a", "b"]
+    DT = dt.Frame(src, stype=stype.cat8)
+    RES = DT[::-2, :]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [src[::-2]]
+    RES.materialize()
+    frame_integrity_check(RES)
+    assert RES.to_list() == [src[::-2]]
+
+
+
+#-------------------------------------------------------------------------------
+# Operations
+#-------------------------------------------------------------------------------
+
+def test_rbind():
+    DT1 = dt.Frame(A=["x", "y", None, "x"], stype=stype.cat8)
+    DT2 = dt.Frame(A=["z", "a", "x"], stype=stype.cat8)
+    DT3 = dt.Frame(A=["w", None])
+    RES = dt.rbind(DT1, DT2, DT3)
+    frame_integrity_check(RES)
+    assert RES.stypes == (stype.cat8,)
+    assert RES.to_list() == [["x", "y", None, "x", "z", "a", "x", "w", None]]
+
+
+def test_rbind_widen():
+    DT1 = dt.Frame(A=["p%d" % i for i in range(200)], stype=stype.cat8)
+    DT2 = dt.Frame(A=["q%d" % i for i in range(200)], stype=stype.cat8)
+    RES = dt.rbind(DT1, DT2)
+    frame_integrity_check(RES)
+    assert RES.stypes == (stype.cat16,)
+    assert RES.to_list() == [DT1.to_list()[0] + DT2.to_list()[0]]
+
+
+@pytest.mark.parametrize("nlevels", [5, 300])
+def test_sort(nlevels):
+    src = random_strings(500, nlevels, seed=nlevels)
+    DT = dt.Frame(src, stype=stype.cat8)
+    RES = DT.sort(0)
+    frame_integrity_check(RES)
+    assert RES.to_list() == dt.Frame(src).sort(0).to_list()
+
+
+def test_groupby():
+    src = random_strings(200, 7, seed=1)
+    DT = dt.Frame(A=src, stype=stype.cat8)
+    RES = DT[:, dt.count(), f.A]
+    EXP = dt.Frame(A=src)[:, dt.count(), f.A]
+    frame_integrity_check(RES)
+    assert RES.to_list() == EXP.to_list()
+
+
+def test_equality():
+    A = ["a", "b", None, "c", "b"]
+    B = ["b", "b", None, None, "d"]
+    DT = dt.Frame(A=A, B=B, stypes={"A": stype.cat8, "B": stype.cat16})
+    assert DT[:, f.A == f.B].to_list() == [[False, True, True, False, False]]
+    assert DT[:, f.A != f.B].to_list() == [[True, False, False, True, True]]
+    assert DT[:, f.A == "b"].to_list() == [[False, True, False, False, True]]
+    assert DT[:, f.A == "zzz"].to_list() == [[False] * 5]
+    assert DT[f.A == "b", :].nrows == 2
+    assert DT[:, dt.isna(f.A)].to_list() == [[False, False, True, False,
+                                              False]]
+
+
+@pytest.mark.parametrize("st", cat_stypes)
+def test_equality_none(st):
+    DT = dt.Frame(["a", None, "b", None], stype=st)
+    assert DT[:, f[0] == None].to_list() == [[False, True, False, True]]
+    assert DT[:, f[0] != None].to_list() == [[True, False, True, False]]
+    assert DT[:, None == f[0]].to_list() == [[False, True, False, True]]
+    assert DT[f[0] != None, :].to_list() == [["a", "b"]]
+    with pytest.raises(TypeError):
+        DT[:, f[0] == False]
+
+
+def test_ordered_comparisons():
+    A = ["b", "a", None, "c", "ab"]
+    B = ["a", "a", None, "bb", None]
+    DT = dt.Frame(A=A, B=B, stypes={"A": stype.cat8, "B": stype.str32})
+    assert DT[:, f.A < "b"].to_list() == [[False, True, False, False, True]]
+    assert DT[:, f.A >= "b"].to_list() == [[True, False, False, True, False]]
+    assert DT[:, "b" > f.A].to_list() == [[False, True, False, False, True]]
+    assert DT[:, f.A > f.B].to_list() == [[True, False, False, True, False]]
+    assert DT[:, f.A <= f.B].to_list() == [[False, True, True, False, False]]
+    DT[:, "B"] = dt.Frame(B, stype=stype.cat16)
+    assert DT[:, f.A > f.B].to_list() == [[True, False, False, True, False]]
+    assert DT[:, f.A <= f.B].to_list() == [[False, True, True, False, False]]
+
+
+@pytest.mark.parametrize("st", cat_stypes)
+def test_len(st):
+    DT = dt.Frame(["abc", "", None, "de", "abc"], stype=st)
+    RES = DT[:, f[0].len()]
+    frame_integrity_check(RES)
+    assert RES.stypes == (stype.int32,)
+    assert RES.to_list() == [[3, 0, None, 2, 3]]
+
+
+def test_join():
+    DT = dt.Frame(A=list("cabdabe"), stype=stype.cat8)
+    J = dt.Frame(A=list("dcba"), V=range(4), stypes={"A": stype.cat16})
+    J.key = "A"
+    RES = DT[:, :, join(J)]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [list("cabdabe"), [1, 3, 2, 0, 3, 2, None]]
+
+
+@pytest.mark.parametrize("st", [stype.str32, stype.str64])
+def test_join_to_string_key(st):
+    DT = dt.Frame(A=["c", "a", None, "z", "", "a"], stype=stype.cat8)
+    J = dt.Frame(A=["", "a", "b", "c"], V=range(4), stypes={"A": st})
+    J.key = "A"
+    RES = DT[:, :, join(J)]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [["c", "a", None, "z", "", "a"],
+                             [3, 1, None, None, 0, 1]]
+
+
+@pytest.mark.parametrize("st", [stype.str32, stype.str64])
+def test_join_string_to_categorical_key(st):
+    DT = dt.Frame(A=["c", "a", None, "z", "", "a"], stype=st)
+    J = dt.Frame(A=["", "a", "b", "c"], V=range(4), stypes={"A": stype.cat16})
+    J.key = "A"
+    RES = DT[:, :, join(J)]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [["c", "a", None, "z", "", "a"],
+                             [3, 1, None, None, 0, 1]]
+
+
+def test_stats():
+    src = ["b", "a", None, "b", "c", "b"]
+    DT = dt.Frame(src, stype=stype.cat8)
+    assert DT.countna1() == 1
+    assert DT.mode1() == "b"
+    assert DT.nmodal1() == 3
+    assert DT.nunique1() == 3
+
+
+def test_replace_values():
+    DT = dt.Frame(A=["a", "b", "a"], stype=stype.cat8)
+    DT[1, "A"] = "new"
+    DT[2, "A"] = None
+    frame_integrity_check(DT)
+    assert DT.stypes == (stype.cat8,)
+    assert DT.to_list() == [["a", "new", None]]
+
+
+@pytest.mark.parametrize("st", [stype.cat8, stype.cat16, stype.cat32])
+def test_frame_replace(st):
+    DT = dt.Frame(A=["a", "b", None, "a", "c"], stype=st)
+    DT.replace("a", "zz")
+    frame_integrity_check(DT)
+    assert DT.stypes == (st,)
+    assert DT.to_list() == [["zz", "b", None, "zz", "c"]]
+    # levels may merge, become NA, and NAs may be replaced
+    DT.replace({"zz": "b", "c": None, None: "n"})
+    frame_integrity_check(DT)
+    assert DT.stypes == (st,)
+    assert DT.to_list() == [["b", "b", "n", "b", None]]
+    assert DT.nunique1() == 2
+
+
+def test_frame_replace_upcast():
+    DT = dt.Frame(A=[str(i) for i in range(255)] + [None], stype=stype.cat8)
+    DT.replace(None, "new")
+    frame_integrity_check(DT)
+    assert DT.stypes == (stype.cat16,)
+    assert DT[-2:, :].to_list() == [["254", "new"]]
+
+
+def test_to_csv():
+    DT = dt.Frame(A=["a", "b,c", None, 'q"x'], stype=stype.cat8)
+    assert DT.to_csv() == 'A\na\n"b,c"\n\n"q""x"\n'
+
+
+
+#-------------------------------------------------------------------------------
+# Persistence
+#-------------------------------------------------------------------------------
+
+@pytest.mark.parametrize("compression", [None, "zstd"])
+def test_jay_roundtrip(compression):
+    src = random_strings(1000, 300, seed=7)
+    DT = dt.Frame(A=src, B=list(range(1000)), stypes={"A": stype.cat8})
+    kw = {"rowgroup_size": 100}
+    if compression:
+        kw["compression"] = compression
+    RES = dt.open(DT.to_jay(**kw))
+    frame_integrity_check(RES)
+    assert RES.stypes == DT.stypes
+    assert RES.to_list() == DT.to_list()
+    SUB = RES[f.B >= 950, :]
+    frame_integrity_check(SUB)
+    assert SUB.to_list() == DT[f.B >= 950, :].to_list()
+
+
+def test_jay_append_categorical(tempfile):
+    DT = dt.Frame(A=["a", "b"], stype=stype.cat8)
+    DT.to_jay(tempfile)
+    with pytest.raises(ValueError) as e:
+        DT.to_jay(tempfile, append=True)
+    assert "cannot be appended" in str(e.value)
+
+
+def test_fread_categorical_threshold():
+    text = "A,B\n" + "\n".join("%s,s%d" % ("xyz"[i % 3], i)
+                               for i in range(100))
+    try:
+        dt.options.fread.categorical_threshold = 0.1
+        DT = dt.fread(text=text)
+    finally:
+        dt.options.fread.categorical_threshold = 0
+    frame_integrity_check(DT)
+    assert DT.stypes == (stype.cat8, stype.str32)
+    assert DT[:3, :].to_list() == [["x", "y", "z"], ["s0", "s1", "s2"]]
+    assert dt.fread(text=text).stypes == (stype.str32, stype.str32)
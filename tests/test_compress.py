@@ -0,0 +1,262 @@
+#!/usr/bin/env python
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+# Tests for the in-memory compression of columns, `Frame.compress()`.
+#-------------------------------------------------------------------------------
+import pytest
+import random
+import sys
+import datatable as dt
+from datatable import f, stype
+from datatable.internal import frame_integrity_check, frame_column_encoding
+
+methods = ["for", "rle", "dict"]
+
+
+def encodings(DT):
+    return [frame_column_encoding(DT, i) for i in range(DT.ncols)]
+
+
+def make_data(n=10000, seed=1):
+    random.seed(seed)
+    return dict(
+        S=sorted(random.randint(0, 20) for _ in range(n)),
+        R=[random.randint(-1000, 1000) if random.random() > 0.1 else None
+           for _ in range(n)],
+        D=[random.choice([1.5, -0.5, 0.0, None, 3.25]) for _ in range(n)],
+        B=[random.choice([True, False, None]) for _ in range(n)])
+
+
+
+#-------------------------------------------------------------------------------
+# Creation & conversion
+#-------------------------------------------------------------------------------
+
+def test_compress_auto():
+    data = make_data()
+    DT = dt.Frame(**data)
+    size0 = sys.getsizeof(DT)
+    DT.compress()
+    frame_integrity_check(DT)
+    assert encodings(DT) == ["rle", "for", "dict", "for"]
+    assert sys.getsizeof(DT) < size0 / 2
+    assert DT.to_list() == list(data.values())
+
+
+@pytest.mark.parametrize("method", methods)
+def test_compress_method(method):
+    data = make_data()
+    DT = dt.Frame(**data)
+    DT.compress(method)
+    frame_integrity_check(DT)
+    expected = ["for", "for", None, "for"] if method == "for" else [method] * 4
+    assert encodings(DT) == expected
+    assert DT.to_list() == list(data.values())
+
+
+@pytest.mark.parametrize("st", [stype.int8, stype.int16, stype.int32,
+                                stype.int64, stype.float32, stype.float64])
+@pytest.mark.parametrize("method", methods)
+def test_compress_stypes(st, method):
+    src = [3, None, 3, 3, 0, 7, None, 7, 120] * 1000
+    DT = dt.Frame(A=src, stype=st)
+    ref = DT.to_list()
+    DT.compress(method)
+    frame_integrity_check(DT)
+    assert DT.stypes == (st,)
+    assert DT.to_list() == ref
+
+
+@pytest.mark.parametrize("method", methods)
+def test_compress_special(method):
+    DT = dt.Frame(A=[None] * 5000, B=[5] * 5000,
+                  C=[-0.0, 0.0, None, 2.5] * 1250,
+                  stypes=[stype.int32, stype.int64, stype.float64])
+    ref = DT.to_list()
+    DT.compress(method)
+    frame_integrity_check(DT)
+    assert DT.to_list() == ref
+    assert str(DT[0, "C"]) == "-0.0"
+
+
+def test_compress_incompressible():
+    DT = dt.Frame(A=[random.random() for _ in range(1000)],
+                  S=["a", "b"] * 500)
+    DT.compress()
+    assert encodings(DT) == [None, None]
+    DT.compress("rle")
+    assert encodings(DT) == ["rle", None]
+
+
+def test_compress_view():
+    DT = dt.Frame(A=list(range(1000)))[::-1, :]
+    DT.compress("for")
+    frame_integrity_check(DT)
+    assert encodings(DT) == ["for"]
+    assert DT.to_list() == [list(range(999, -1, -1))]
+
+
+def test_compress_empty():
+    DT = dt.Frame(A=[], stype=stype.int32)
+    DT.compress()
+    assert encodings(DT) == [None]
+    assert DT.shape == (0, 1)
+
+
+def test_compress_bad_method():
+    DT = dt.Frame(A=[1, 2, 3])
+    with pytest.raises(ValueError):
+        DT.compress("zip")
+
+
+
+#-------------------------------------------------------------------------------
+# Operations
+#-------------------------------------------------------------------------------
+
+@pytest.mark.parametrize("method", methods)
+def test_reducers(method):
+    data = make_data()
+    DT0 = dt.Frame(**data)
+    DT = dt.Frame(**data)
+    DT.compress(method)
+    for col in "SRDB":
+        for red in [dt.count, dt.sum, dt.mean, dt.sd, dt.min, dt.max]:
+            exp = DT0[:, red(f[col])]
+            res = DT[:, red(f[col])]
+            assert res.stypes == exp.stypes
+            assert res[0, 0] == pytest.approx(exp[0, 0])
+    assert encodings(DT)[:2] == [method, method]
+
+
+@pytest.mark.parametrize("method", methods)
+def test_reducers_groupby(method):
+    DT = dt.Frame(K=[1, 2, 1, 2, 1], V=[10, 20, 30, 40, None])
+    DT.compress(method)
+    RES = DT[:, dt.sum(f.V), dt.by(f.K)]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [[1, 2], [40, 60]]
+
+
+@pytest.mark.parametrize("method", methods)
+def test_comparisons(method):
+    data = make_data()
+    DT0 = dt.Frame(**data)
+    DT = dt.Frame(**data)
+    DT.compress(method)
+    for col in "SRDB":
+        for val in [-2000, -1, 0, 1, 1.5, 10, 2000]:
+            exprs = [f[col] == val, f[col] != val, f[col] < val,
+                     f[col] <= val, f[col] > val, val >= f[col]]
+            RES = DT[:, exprs]
+            frame_integrity_check(RES)
+            assert RES.to_list() == DT0[:, exprs].to_list()
+
+
+@pytest.mark.parametrize("method", methods)
+def test_filter(method):
+    data = make_data()
+    DT = dt.Frame(**data)
+    DT.compress(method)
+    RES = DT[(f.S > 10) & (f.R < 0), :]
+    frame_integrity_check(RES)
+    assert RES.to_list() == dt.Frame(**data)[(f.S > 10) & (f.R < 0), :] \
+                                .to_list()
+
+
+@pytest.mark.parametrize("method", methods)
+def test_expressions(method):
+    data = make_data()
+    DT = dt.Frame(**data)
+    DT.compress(method)
+    exprs = [f.S * 2 + f.R, f.D - 1, f.R / 3]
+    assert DT[:, exprs].to_list() == dt.Frame(**data)[:, exprs].to_list()
+    assert DT[100:5000:7, exprs].to_list() == \
+           dt.Frame(**data)[100:5000:7, exprs].to_list()
+
+
+@pytest.mark.parametrize("method", methods)
+def test_sort(method):
+    DT = dt.Frame(A=[5, None, 3, 5, -1] * 100)
+    DT.compress(method)
+    RES = DT.sort("A")
+    frame_integrity_check(RES)
+    assert RES.to_list() == [[None] * 100 + [-1] * 100 + [3] * 100 +
+                             [5] * 200]
+
+
+@pytest.mark.parametrize("method", methods)
+def test_decompress_releases_encoding(method):
+    src = make_data()["S"]
+    DT0 = dt.Frame(S=src, stype=stype.int32)
+    DT = dt.Frame(S=src, stype=stype.int32)
+    DT.compress(method)
+    assert sys.getsizeof(DT) < sys.getsizeof(DT0) / 4
+    RES = DT.sort("S")
+    frame_integrity_check(DT)
+    DT0.sort("S")
+    assert encodings(DT) == [None]
+    # Only the decoded data is kept, the codec is released
+    assert sys.getsizeof(DT) < sys.getsizeof(DT0) + 500
+    assert RES.to_list() == DT.to_list() == [src]
+    DT.compress(method)
+    assert encodings(DT) == [method]
+    assert sys.getsizeof(DT) < sys.getsizeof(DT0) / 4
+
+
+@pytest.mark.parametrize("method", methods)
+def test_modify(method):
+    DT = dt.Frame(A=[1, 2, 1, 2] * 100, B=[7] * 400)
+    DT.compress(method)
+    DT[f.A == 1, "A"] = 5
+    frame_integrity_check(DT)
+    assert encodings(DT) == [None, method]
+    assert DT[:, dt.sum(f.A)][0, 0] == 1400
+    assert DT[:, [dt.sum(f.B), dt.min(f.B)]].to_list() == [[2800], [7]]
+
+
+def test_recompress():
+    DT = dt.Frame(A=[1, 2] * 500)
+    DT.compress("rle")
+    DT.compress()
+    assert encodings(DT) == ["rle"]
+    DT.compress("dict")
+    frame_integrity_check(DT)
+    assert encodings(DT) == ["dict"]
+    assert DT.to_list() == [[1, 2] * 500]
+
+
+def test_copy():
+    DT = dt.Frame(A=[1, 2, 3] * 100)
+    DT.compress("dict")
+    DT2 = DT.copy()
+    assert encodings(DT2) == ["dict"]
+    DT2[0, "A"] = 10
+    assert encodings(DT2) == [None]
+    assert DT.to_list() == [[1, 2, 3] * 100]
+
+
+
+#-------------------------------------------------------------------------------
+# Reading & writing
+#-------------------------------------------------------------------------------
+
+@pytest.mark.parametrize("method", methods)
+def test_to_csv(method):
+    DT = dt.Frame(A=[1, None, 3, 3], B=[0.5, 0.5, None, 2.0])
+    DT.compress(method)
+    assert DT.to_csv() == "A,B\n1,0.5\n,0.5\n3,\n3,2.0\n"
+
+
+@pytest.mark.parametrize("method", methods)
+def test_to_jay(method):
+    data = make_data(n=1000)
+    DT = dt.Frame(**data)
+    DT.compress(method)
+    RES = dt.open(DT.to_jay())
+    frame_integrity_check(RES)
+    assert encodings(RES) == [None] * 4
+    assert RES.to_list() == list(data.values())
@@ -0,0 +1,237 @@
+#!/usr/bin/env python
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+# Tests for the temporal stypes `date32`, `date64` and `time32`.
+#-------------------------------------------------------------------------------
+import pytest
+import datatable as dt
+from datetime import date, datetime, time, timedelta, timezone
+from datatable import f, stype, ltype
+from datatable.internal import frame_integrity_check
+
+src_date32 = [date(2018, 3, 1), None, date(1969, 12, 31), date(2020, 2, 29),
+              date(1, 1, 1), date(9999, 12, 31)]
+src_date64 = [datetime(2018, 3, 1, 12, 30, 15, 500000), None,
+              datetime(1969, 12, 31, 23, 59, 59), datetime(2000, 1, 1),
+              datetime(1, 1, 1, 0, 0, 0, 1)]
+src_time32 = [time(1, 2, 3, 4000), time(23, 59), None, time(0),
+              time(12, 0, 0, 999000)]
+
+
+
+#-------------------------------------------------------------------------------
+# Creation & conversion
+#-------------------------------------------------------------------------------
+
+@pytest.mark.parametrize("st, src", [(stype.date32, src_date32),
+                                     (stype.date64, src_date64),
+                                     (stype.time32, src_time32)])
+def test_create_from_list(st, src):
+    DT = dt.Frame(A=src)
+    frame_integrity_check(DT)
+    assert DT.stypes == (st,)
+    assert DT.ltypes == (ltype.time,)
+    assert DT.to_list() == [src]
+    assert DT[2, 0] == src[2]
+
+
+def test_create_forced_stype():
+    DT = dt.Frame([date(2018, 5, 17), "2018-05-18", None], stype=stype.date64)
+    frame_integrity_check(DT)
+    assert DT.stypes == (stype.date64,)
+    assert DT.to_list() == [[datetime(2018, 5, 17), datetime(2018, 5, 18),
+                             None]]
+
+
+def test_create_tz_aware():
+    tz = timezone(timedelta(hours=3))
+    DT = dt.Frame([datetime(2018, 1, 1, 3, 0, tzinfo=tz)])
+    assert DT.stypes == (stype.date64,)
+    assert DT.to_list() == [[datetime(2018, 1, 1, 0, 0)]]
+
+
+def test_casts():
+    DT = dt.Frame(A=[date(2018, 3, 1), None, date(1970, 1, 2)])
+    assert DT[:, dt.int32(f.A)].to_list() == [[17591, None, 1]]
+    assert DT[:, dt.str32(f.A)].to_list() == [["2018-03-01", None,
+                                               "1970-01-02"]]
+    assert DT[:, dt.date64(f.A)].to_list() == [[datetime(2018, 3, 1), None,
+                                                datetime(1970, 1, 2)]]
+    S = dt.Frame(["2001-02-03", "bad", None, "1999-12-31"])
+    assert S[:, dt.date32(f[0])].to_list() == [[date(2001, 2, 3), None, None,
+                                                date(1999, 12, 31)]]
+    T = dt.Frame([datetime(2018, 3, 1, 12, 30, 15, 500000)])
+    assert T[:, dt.time32(f[0])].to_list() == [[time(12, 30, 15, 500000)]]
+    assert T[:, dt.date32(f[0])].to_list() == [[date(2018, 3, 1)]]
+    assert T[:, dt.str32(f[0])].to_list() == [["2018-03-01T12:30:15.5"]]
+
+
+
+#-------------------------------------------------------------------------------
+# Operations
+#-------------------------------------------------------------------------------
+
+def test_datetime_parts():
+    DT = dt.Frame(A=src_date64[:4], B=src_date32[:4], C=src_time32[:4])
+    RES = DT[:, [f.A.year(), f.A.month(), f.A.day(),
+                 f.A.hour(), f.A.minute(), f.A.second(),
+                 f.B.year(), f.B.month(), f.B.day(),
+                 f.C.hour(), f.C.minute(), f.C.second()]]
+    frame_integrity_check(RES)
+    assert RES.stypes == (stype.int32,) * 12
+    assert RES.to_list() == [
+        [2018, None, 1969, 2000], [3, None, 12, 1], [1, None, 31, 1],
+        [12, None, 23, 0], [30, None, 59, 0], [15, None, 59, 0],
+        [2018, None, 1969, 2020], [3, None, 12, 2], [1, None, 31, 29],
+        [1, 23, None, 0], [2, 59, None, 0], [3, 0, None, 0]]
+
+
+def test_arithmetic():
+    DT = dt.Frame(A=[date(2018, 2, 28), None], B=[date(2018, 1, 1)] * 2)
+    assert DT[:, f.A + 1].to_list() == [[date(2018, 3, 1), None]]
+    assert DT[:, 1 + f.A].to_list() == [[date(2018, 3, 1), None]]
+    assert DT[:, f.A - 365].to_list() == [[date(2017, 2, 28), None]]
+    RES = DT[:, f.A - f.B]
+    assert RES.stypes == (stype.int32,)
+    assert RES.to_list() == [[58, None]]
+
+
+def test_out_of_python_range():
+    # Dates beyond the year 9999 are valid, but python cannot represent them
+    DT = dt.Frame(A=[date(9999, 12, 31), date(1, 1, 1), None])
+    RES = DT[:, [f.A + 1, f.A - 1, dt.date64(f.A + 1), dt.str32(f.A + 1)]]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [[None, date(1, 1, 2), None],
+                             [date(9999, 12, 30), None, None],
+                             [None, datetime(1, 1, 2), None],
+                             ["10000-01-01", "0001-01-02", None]]
+    assert RES[0, 0] is None
+    assert RES[:, 0].max1() is None
+    assert RES[:, 0].countna1() == 1
+
+
+def test_comparisons():
+    DT = dt.Frame(A=src_date32[:4])
+    assert DT[f.A > date(2000, 1, 1), :].to_list() == [[date(2018, 3, 1),
+                                                       date(2020, 2, 29)]]
+    assert DT[:, f.A == date(1969, 12, 31)].to_list() == [[False, False,
+                                                           True, False]]
+    assert DT[:, dt.isna(f.A)].to_list() == [[False, True, False, False]]
+
+
+@pytest.mark.parametrize("st, src", [(stype.date32, src_date32),
+                                     (stype.date64, src_date64),
+                                     (stype.time32, src_time32)])
+def test_compare_with_none(st, src):
+    DT = dt.Frame(A=src[:4], stype=st)
+    isna = [x is None for x in src[:4]]
+    assert DT[:, f.A == None].to_list() == [isna]
+    assert DT[:, f.A != None].to_list() == [[not x for x in isna]]
+    assert DT[:, None == f.A].to_list() == [isna]
+    assert DT[f.A != None, :].nrows == 3
+    with pytest.raises(TypeError):
+        DT[:, f.A == True]
+
+
+def test_stats():
+    DT = dt.Frame(A=src_date64[:4])
+    assert DT.min1() == datetime(1969, 12, 31, 23, 59, 59)
+    assert DT.max1() == datetime(2018, 3, 1, 12, 30, 15, 500000)
+    assert DT.countna1() == 1
+    assert DT.nunique1() == 3
+    assert DT.sum1() is None
+    assert DT.min().stypes == (stype.date64,)
+
+
+def test_sort_and_groupby():
+    DT = dt.Frame(A=[date(2018, 1, 3), date(2018, 1, 1), None,
+                     date(2018, 1, 3)])
+    assert DT.sort(0).to_list() == [[None, date(2018, 1, 1), date(2018, 1, 3),
+                                     date(2018, 1, 3)]]
+    RES = DT[:, dt.count(), dt.by(f.A)]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [[None, date(2018, 1, 1), date(2018, 1, 3)],
+                             [1, 1, 2]]
+
+
+def test_rbind():
+    A = dt.Frame(A=[date(2018, 1, 1)])
+    B = dt.Frame(A=[datetime(2018, 1, 1, 12, 0)])
+    RES = dt.rbind(A, B)
+    frame_integrity_check(RES)
+    assert RES.stypes == (stype.date64,)
+    assert RES.to_list() == [[datetime(2018, 1, 1), datetime(2018, 1, 1, 12)]]
+    RES = dt.rbind(dt.Frame(A=["x"]), A)
+    assert RES.stypes == (stype.str32,)
+    assert RES.to_list() == [["x", "2018-01-01"]]
+
+
+def test_frame_replace():
+    DT = dt.Frame(D=[date(2000, 1, 1), None, date(2001, 2, 3)],
+                  X=[datetime(2000, 1, 1, 5), None, datetime(2020, 1, 1)],
+                  T=[time(1, 2), time(3, 4), None])
+    assert DT.stypes == (stype.date32, stype.date64, stype.time32)
+    DT.replace({date(2000, 1, 1): date(1999, 12, 31), time(1, 2): None,
+                None: time(0, 0)})
+    frame_integrity_check(DT)
+    assert DT.to_list() == [
+        [date(1999, 12, 31), None, date(2001, 2, 3)],
+        [datetime(2000, 1, 1, 5), None, datetime(2020, 1, 1)],
+        [None, time(3, 4), time(0, 0)]]
+    DT.replace(None, datetime(1970, 1, 1))
+    assert DT[1, "X"] == datetime(1970, 1, 1)
+    assert DT[1, "D"] is None
+    with pytest.raises(TypeError):
+        DT.replace(date(2001, 2, 3), 5)
+
+
+
+#-------------------------------------------------------------------------------
+# Reading & writing
+#-------------------------------------------------------------------------------
+
+def test_fread_iso():
+    DT = dt.fread(text="A,B,C,D\n"
+                       "2018-03-01,2018-03-01T12:30:15.5,01:02:03,2018-02-30\n"
+                       "1969-12-31,1969-12-31 23:59:59Z,23:59,2018-01-01\n")
+    frame_integrity_check(DT)
+    assert DT.stypes == (stype.date32, stype.date64, stype.time32,
+                         stype.str32)
+    assert DT.to_list() == [
+        [date(2018, 3, 1), date(1969, 12, 31)],
+        [datetime(2018, 3, 1, 12, 30, 15, 500000),
+         datetime(1969, 12, 31, 23, 59, 59)],
+        [time(1, 2, 3), time(23, 59)],
+        ["2018-02-30", "2018-01-01"]]
+
+
+def test_fread_override():
+    DT = dt.fread(text="A\n2018-03-01\n", columns={"A": stype.date64})
+    assert DT.stypes == (stype.date64,)
+    assert DT.to_list() == [[datetime(2018, 3, 1)]]
+
+
+def test_to_csv_roundtrip():
+    DT = dt.Frame(A=src_date32, B=src_date64 + [None], C=src_time32 + [None])
+    text = DT.to_csv()
+    assert text.split("\n")[1] == \
+        "2018-03-01,2018-03-01T12:30:15.5,01:02:03.004"
+    RES = dt.fread(text=text)
+    frame_integrity_check(RES)
+    assert RES.stypes == DT.stypes
+    assert RES.to_list() == DT.to_list()
+
+
+@pytest.mark.parametrize("compression", [None, "zstd"])
+def test_jay_roundtrip(compression):
+    DT = dt.Frame(A=src_date32[:5], B=src_date64, C=src_time32)
+    kw = {"rowgroup_size": 2}
+    if compression:
+        kw["compression"] = compression
+    RES = dt.open(DT.to_jay(**kw))
+    frame_integrity_check(RES)
+    assert RES.stypes == DT.stypes
+    assert RES.to_list() == DT.to_list()
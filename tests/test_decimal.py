@@ -0,0 +1,321 @@
+#!/usr/bin/env python
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+# Tests for the decimal stypes `dec16`, `dec32` and `dec64`.
+#-------------------------------------------------------------------------------
+import pytest
+import datatable as dt
+from decimal import Decimal as D
+from datatable import f, stype, ltype
+from datatable.internal import frame_integrity_check
+
+dec_stypes = [stype.dec16, stype.dec32, stype.dec64]
+src = [D("1.50"), None, D("2.25"), D("-3.00"), D("0.05")]
+
+
+
+#-------------------------------------------------------------------------------
+# Creation & conversion
+#-------------------------------------------------------------------------------
+
+def test_create_auto():
+    DT = dt.Frame(A=[D("1.5"), None, 3, D("-0.25")])
+    frame_integrity_check(DT)
+    assert DT.stypes == (stype.dec64,)
+    assert DT.ltypes == (ltype.real,)
+    assert DT.to_list() == [[D("1.50"), None, D("3.00"), D("-0.25")]]
+    assert str(DT[0, 0]) == "1.50"
+
+
+def test_create_mixed_with_float():
+    DT = dt.Frame(A=[D("1.5"), 2.5])
+    assert DT.stypes == (stype.obj64,)
+
+
+@pytest.mark.parametrize("st", dec_stypes)
+def test_create_forced(st):
+    DT = dt.Frame(A=[1.5, "2.25", None, "x", D("3"), 7], stype=st)
+    frame_integrity_check(DT)
+    assert DT.stypes == (st,)
+    assert DT.to_list() == [[D("1.50"), D("2.25"), None, None, D("3.00"),
+                             D("7.00")]]
+
+
+@pytest.mark.parametrize("st", dec_stypes)
+def test_casts_from(st):
+    DT = dt.Frame(A=src)
+    RES = DT[:, st(f.A)]
+    frame_integrity_check(RES)
+    assert RES.stypes == (st,)
+    RES = RES[:, [dt.float64(f[0]), dt.int32(f[0]), dt.str32(f[0]),
+                  dt.bool8(f[0]), dt.obj64(f[0])]]
+    assert RES.to_list() == [
+        [1.5, None, 2.25, -3.0, 0.05],
+        [1, None, 2, -3, 0],
+        ["1.50", None, "2.25", "-3.00", "0.05"],
+        [True, None, True, True, True],
+        src]
+
+
+def test_casts_into():
+    DT = dt.Frame(I=[1, None, -7], F=[0.1, 2.125, None],
+                  S=["1.005", "bad", "-12.5e1"])
+    RES = DT[:, [dt.dec32(f.I), dt.dec64(f.F), dt.dec64(f.S)]]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [[D("1"), None, D("-7")],
+                             [D("0.100"), D("2.125"), None],
+                             [D("1.005"), None, D("-125.000")]]
+
+
+def test_cast_rounds_to_scale():
+    DT = dt.Frame(A=[D("1.005"), D("-2.5")])
+    assert DT[:, dt.dec16(f.A)].to_list() == [[D("1.005"), D("-2.500")]]
+    # dec16 values are limited to +-32767
+    DT = dt.Frame(A=[D("40.0"), D("3.0")])
+    assert DT[:, dt.dec16(f.A)].to_list() == [[D("40.0"), D("3.0")]]
+    DT = dt.Frame(A=[D("4000.0"), D("3.0")])
+    assert DT[:, dt.dec16(f.A)].to_list() == [[None, D("3.0")]]
+
+
+def test_view():
+    DT = dt.Frame(A=src)
+    RES = DT[::-1, :]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [src[::-1]]
+    RES.materialize()
+    frame_integrity_check(RES)
+    assert RES.stypes == (stype.dec64,)
+    assert RES.to_list() == [src[::-1]]
+
+
+
+#-------------------------------------------------------------------------------
+# Operations
+#-------------------------------------------------------------------------------
+
+def test_arithmetic():
+    DT = dt.Frame(A=[D("1.50"), None, D("2.25"), D("-3.00")],
+                  B=[D("0.100"), D("1.000"), D("2.250"), D("7.000")])
+    RES = DT[:, [f.A + f.B, f.A - f.B, f.A * f.B, f.A + 1, -f.A]]
+    frame_integrity_check(RES)
+    assert RES.stypes == (stype.dec64,) * 5
+    assert RES.to_list() == [
+        [D("1.600"), None, D("4.500"), D("4.000")],
+        [D("1.400"), None, D("0.000"), D("-10.000")],
+        [D("0.15000"), None, D("5.06250"), D("-21.00000")],
+        [D("2.50"), None, D("3.25"), D("-2.00")],
+        [D("-1.50"), None, D("-2.25"), D("3.00")]]
+
+
+def test_arithmetic_float():
+    DT = dt.Frame(A=[D("1.50"), None, D("-3.00")], B=[D("2"), D("1"), D("4")])
+    RES = DT[:, [f.A / f.B, f.A * 2.0]]
+    assert RES.stypes == (stype.float64,) * 2
+    assert RES.to_list() == [[0.75, None, -0.75], [3.0, None, -6.0]]
+
+
+def test_compare():
+    DT = dt.Frame(A=[D("1.5"), None, D("2.25")], B=[D("1.50"), D("1"), D("3")])
+    RES = DT[:, [f.A == f.B, f.A < f.B, f.A != 2, dt.isna(f.A)]]
+    assert RES.stypes == (stype.bool8,) * 4
+    assert RES.to_list() == [[True, False, False], [False, False, True],
+                             [True, True, True], [False, True, False]]
+
+
+def test_multiply_large():
+    DT = dt.Frame(A=[D("5.000000000"), D("-3.000000001"), None])
+    RES = DT[:, [f.A * f.A, f.A * 10**9]]
+    frame_integrity_check(RES)
+    # the scale of the product is reduced, so that the values fit into dec64
+    assert RES.to_list() == [[D("25"), D("9.000000006"), None],
+                             [D("5000000000"), D("-3000000001"), None]]
+    RES = dt.Frame(A=[D("1.50"), D("-2.25")])[:, f.A * 10**17]
+    assert RES.to_list() == [[D("150000000000000000"),
+                              D("-225000000000000000")]]
+
+
+def test_add_rescale_large():
+    DT = dt.Frame(A=[D("1.50"), D("-2.25")])
+    RES = DT[:, [f.A + 10**17, 10**17 - f.A]]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [[D("100000000000000001.5"),
+                              D("99999999999999997.8")],
+                             [D("99999999999999998.5"),
+                              D("100000000000000002.3")]]
+
+
+def test_arithmetic_overflow():
+    # results that do not fit into dec64 even with scale 0 become NAs
+    DT = dt.Frame(A=[D("123456789012345.678"), D("1.000")])
+    RES = DT[:, [f.A * f.A, f.A * 10**7]]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [[None, D("1")], [None, D("10000000")]]
+
+
+def test_compare_large_scale():
+    DT = dt.Frame(A=[D("0.000000000000000001"), D("0.5"), None])
+    RES = DT[:, [f.A < 10, f.A > 10, f.A != 10, f.A >= -10,
+                 f.A == 10**18, 10 > f.A]]
+    assert RES.to_list() == [[True, True, False], [False, False, False],
+                             [True, True, True], [True, True, False],
+                             [False, False, False], [True, True, False]]
+    assert DT[f.A < 10, :].to_list() == [[D("1e-18"), D("0.5")]]
+
+
+def test_reducers():
+    DT = dt.Frame(A=src)
+    RES = DT[:, [dt.sum(f.A), dt.mean(f.A), dt.min(f.A), dt.max(f.A),
+                 dt.count(f.A)]]
+    frame_integrity_check(RES)
+    assert RES.stypes == (stype.dec64, stype.float64, stype.dec64,
+                          stype.dec64, stype.int64)
+    assert RES.to_list() == [[D("0.80")], [0.2], [D("-3.00")], [D("2.25")],
+                             [4]]
+
+
+def test_reducers_by():
+    DT = dt.Frame(K=[D("1.5"), D("0.5"), D("1.5"), None], V=[1, 2, 3, 4])
+    RES = DT[:, dt.sum(f.V), dt.by(f.K)]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [[None, D("0.5"), D("1.5")], [4, 2, 4]]
+
+
+def test_reducers_large():
+    # the sum is accumulated exactly, and becomes NA only if the result
+    # itself does not fit into dec64
+    big = D("900000000000000000")
+    DT = dt.Frame(A=[big] * 100 + [-big] * 100 + [D("1")])
+    RES = DT[:, [dt.sum(f.A), dt.mean(f.A)]]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [[D("1")], [pytest.approx(1 / 201)]]
+    RES = DT[:100, [dt.sum(f.A), dt.mean(f.A), dt.sd(f.A)]]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [[None], [9e17], [0.0]]
+    assert DT[:100, :].sum1() is None
+    assert DT[:100, :].mean1() == 9e17
+
+
+def test_reducers_large_by():
+    big = D("900000000000000000")
+    DT = dt.Frame(K=[0, 1, 0, 1] * 50, V=[big, big, big, -big] * 50)
+    RES = DT[:, [dt.sum(f.V), dt.mean(f.V)], dt.by(f.K)]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [[0, 1], [None, D("0")], [9e17, 0.0]]
+
+
+@pytest.mark.parametrize("st", dec_stypes)
+def test_sort(st):
+    DT = dt.Frame(A=src, stype=st)
+    RES = DT.sort(0)
+    frame_integrity_check(RES)
+    assert RES.stypes == (st,)
+    assert RES.to_list() == [[None, D("-3.00"), D("0.05"), D("1.50"),
+                              D("2.25")]]
+
+
+def test_stats():
+    DT = dt.Frame(A=src + [D("2.25")])
+    assert DT.countna1() == 1
+    assert DT.sum1() == D("3.05")
+    assert DT.min1() == D("-3.00")
+    assert DT.max1() == D("2.25")
+    assert DT.mode1() == D("2.25")
+    assert DT.nunique1() == 4
+    assert DT.mean1() == pytest.approx(0.61)
+    assert DT.min().stypes == (stype.dec64,)
+    assert DT.sum().to_list() == [[D("3.05")]]
+
+
+def test_rbind():
+    A = dt.Frame(A=[D("1.5")], stype=stype.dec16)
+    B = dt.Frame(A=[D("0.125"), None])
+    RES = dt.rbind(A, B)
+    frame_integrity_check(RES)
+    assert RES.stypes == (stype.dec64,)
+    assert RES.to_list() == [[D("1.500"), D("0.125"), None]]
+    RES = dt.rbind(A, dt.Frame(A=[2.5]))
+    assert RES.stypes == (stype.float64,)
+    assert RES.to_list() == [[1.5, 2.5]]
+
+
+def test_replace_rows():
+    DT = dt.Frame(A=[D("1.50"), D("2.00"), D("1.50")])
+    DT[f.A == 1.5, "A"] = D("0.255")
+    frame_integrity_check(DT)
+    assert DT.stypes == (stype.dec64,)
+    assert DT.to_list() == [[D("0.26"), D("2.00"), D("0.26")]]
+
+
+def test_frame_replace():
+    DT = dt.Frame(A=[D("1.5"), None, D("2.25"), D("1.5")], stype=stype.dec16)
+    DT.replace({D("1.5"): D("0.5"), 2.25: 1000.0, 1.125: 0.0, None: 7.0})
+    frame_integrity_check(DT)
+    # 1000.00 does not fit into dec16, so the column is upcast
+    assert DT.stypes == (stype.dec64,)
+    assert DT.to_list() == [[D("0.50"), D("7.00"), D("1000.00"), D("0.50")]]
+
+
+def test_join():
+    J = dt.Frame(K=[D("1.50"), D("2")], W=["x", "y"])
+    J.key = "K"
+    DT = dt.Frame(K=[D("1.5"), D("2.0"), D("1.55"), None])
+    RES = DT[:, :, dt.join(J)]
+    frame_integrity_check(RES)
+    assert RES.to_list()[1] == ["x", "y", None, None]
+    DT = dt.Frame(K=[2, 1])
+    assert DT[:, :, dt.join(J)].to_list()[1] == ["y", None]
+
+
+def test_repeat():
+    DT = dt.Frame(A=[D("1.5"), None])
+    RES = dt.repeat(DT, 2)
+    frame_integrity_check(RES)
+    assert RES.to_list() == [[D("1.5"), None] * 2]
+
+
+
+#-------------------------------------------------------------------------------
+# Reading & writing
+#-------------------------------------------------------------------------------
+
+def test_to_csv():
+    DT = dt.Frame(A=[D("1.50"), None, D("-0.05"), D("100")])
+    assert DT.to_csv() == "A\n1.50\n\n-0.05\n100.00\n"
+
+
+@pytest.mark.parametrize("st", dec_stypes)
+def test_to_jay(st):
+    DT = dt.Frame(A=src, stype=st)
+    RES = dt.open(DT.to_jay())
+    frame_integrity_check(RES)
+    assert RES.stypes == (st,)
+    assert RES.to_list() == [src]
+
+
+def test_fread_default():
+    DT = dt.fread("A\n1.50\n-2.125\n")
+    assert DT.stypes == (stype.float64,)
+
+
+def test_fread_decimals():
+    with dt.options.context(**{"fread.decimals": True}):
+        DT = dt.fread("A,B,C,D\n1.50,x,1,1e-30\n-2.125,y,2,2\n,z,3,3\n")
+    frame_integrity_check(DT)
+    assert DT.stypes == (stype.dec64, stype.str32, stype.int32, stype.float64)
+    assert DT.to_list()[0] == [D("1.500"), D("-2.125"), None]
+
+
+def test_fread_decimals_bump():
+    text = "A\n" + "1.5\n" * 5000 + "abc\n"
+    with dt.options.context(**{"fread.decimals": True}):
+        DT = dt.fread(text)
+    assert DT.stypes == (stype.str32,)
+
+
+def test_fread_requested():
+    DT = dt.fread("A\n1.5\n2.25\n", columns=stype.dec64)
+    frame_integrity_check(DT)
+    assert DT.to_list() == [[D("1.50"), D("2.25")]]
@@ -22,6 +22,8 @@
 # IN THE SOFTWARE.
 #-------------------------------------------------------------------------------
 import datatable as dt
+import datetime
+import decimal
 import math
 import pytest
 import random
@@ -1006,13 +1008,23 @@ def test_single_element_extraction_from_view(dt0):
 def test_single_element_all_stypes(st):
     pt = (bool if st == dt.stype.bool8 else
           int if st.ltype == dt.ltype.int else
+          decimal.Decimal if st.name.startswith("dec") else
           float if st.ltype == dt.ltype.real else
           str if st.ltype == dt.ltype.str else
+          datetime.datetime if st == dt.stype.date64 else
+          datetime.time if st == dt.stype.time32 else
+          datetime.date if st == dt.stype.date32 else
           object)
     src = [True, False, True, None] if pt is bool else \
           [1, 7, -99, 214, None, 3333] if pt is int else \
           [2.5, 3.4e15, -7.909, None] if pt is float else \
+          [decimal.Decimal("2.5"), None, decimal.Decimal("-7.9")] \
+              if pt is decimal.Decimal else \
           ['Oh', 'gobbly', None, 'sproo'] if pt is str else \
+          [datetime.datetime(2018, 11, 5, 14, 3), None,
+           datetime.datetime(1900, 1, 1)] if pt is datetime.datetime else \
+          [datetime.time(9, 15, 0, 250000), None] if pt is datetime.time else \
+          [datetime.date(1999, 12, 31), None] if pt is datetime.date else \
           [dt, st, list, None, {3, 2, 1}]
     df = dt.Frame(A=src, stype=st)
     frame_integrity_check(df)
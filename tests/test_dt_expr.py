@@ -25,7 +25,7 @@ import math
 import pytest
 import random
 import datatable as dt
-from datatable import f, stype, ltype
+from datatable import f, g, stype, ltype
 from datatable.internal import frame_integrity_check
 from tests import list_equals, assert_equals, noop
 
@@ -425,6 +425,38 @@ def test_equal_strings(st1, st2):
     assert df2.to_list() == [[False, True, False, False, True, True]]
 
 
+@pytest.mark.parametrize("st", [dt.str32, dt.str64])
+def test_equal_strings_none(st):
+    df0 = dt.Frame(A=["foo", None, "", None], stype=st)
+    assert df0[:, f.A == None].to_list() == [[False, True, False, True]]
+    assert df0[:, f.A != None].to_list() == [[True, False, True, False]]
+    assert df0[:, None == f.A].to_list() == [[False, True, False, True]]
+    with pytest.raises(TypeError):
+        df0[:, f.A == True]
+
+
+@pytest.mark.parametrize("st1, st2", [(dt.str32, dt.str32),
+                                      (dt.str32, dt.str64),
+                                      (dt.str64, dt.str32),
+                                      (dt.str64, dt.str64)])
+def test_compare_strings(st1, st2):
+    df0 = dt.Frame([["foo", "ab", None, "b",  "",  None, "\xff"],
+                    ["fo",  "ab", None, "ba", "a", "x",  "z"]],
+                   names=["A", "B"], stypes=[st1, st2])
+    assert df0[:, f.A < f.B].to_list() == \
+        [[False, False, False, True, True, False, False]]
+    assert df0[:, f.A <= f.B].to_list() == \
+        [[False, True, True, True, True, False, False]]
+    assert df0[:, f.A > f.B].to_list() == \
+        [[True, False, False, False, False, False, True]]
+    assert df0[:, f.A >= f.B].to_list() == \
+        [[True, True, True, False, False, False, True]]
+    assert df0[:, f.A < "b"].to_list() == \
+        [[False, True, False, False, True, False, False]]
+    assert df0[:, "b" <= f.A].to_list() == \
+        [[True, False, False, True, False, False, True]]
+
+
 
 
 #-------------------------------------------------------------------------------
@@ -453,6 +485,134 @@ def test_issue1562():
 
 
 
+#-------------------------------------------------------------------------------
+# Vectorized (SIMD) kernels
+#-------------------------------------------------------------------------------
+
+def supported_simd_levels():
+    levels = ["none", "avx2", "avx512"]
+    return levels[:levels.index(dt.options.simd) + 1]
+
+
+@pytest.mark.parametrize("st", [stype.int32, stype.int64, stype.float32,
+                                stype.float64])
+def test_simd_levels_consistent(st):
+    random.seed(st.value)
+    n = 1003
+    if st.ltype == ltype.int:
+        src1 = [random.randint(-100, 100) for _ in range(n)]
+        src2 = [random.randint(-100, 100) for _ in range(n)]
+    else:
+        src1 = [random.random() * 100 - 50 for _ in range(n)]
+        src2 = [random.choice([src1[i], 0.5, -7.0]) for i in range(n)]
+    for i in range(0, n, 7):
+        src1[i] = None
+    for i in range(0, n, 11):
+        src2[i] = None
+    DT = dt.Frame([src1, src2], names=["A", "B"], stypes=[st, st])
+    exprs = [f.A + f.B, f.A - f.B, f.A * f.B, f.A / f.B,
+             f.A == f.B, f.A != f.B, f.A < f.B, f.A > f.B,
+             f.A <= f.B, f.A >= f.B, f.A + 3, 3 - f.A, f.A < 2, 5 >= f.B,
+             # the sum() is not fusable, which forces the n-to-1 mappers
+             f.A * dt.sum(f.B), dt.sum(f.B) <= f.A]
+    if st.ltype == ltype.int:
+        exprs += [f.A // f.B, f.A % f.B]
+    levels = supported_simd_levels()
+    old_level = dt.options.simd
+    try:
+        results = []
+        for level in levels:
+            dt.options.simd = level
+            RES = DT[:, exprs]
+            frame_integrity_check(RES)
+            results.append(RES.to_list())
+        for res in results[1:]:
+            assert list_equals(res, results[0])
+    finally:
+        dt.options.simd = old_level
+
+
+def test_simd_option():
+    old_level = dt.options.simd
+    assert old_level in ["none", "avx2", "avx512"]
+    try:
+        dt.options.simd = "none"
+        assert dt.options.simd == "none"
+        DT = dt.Frame(A=[1, 2, None], B=[1.5, None, 3.0])
+        assert DT[:, f.A < f.B].to_list() == [[True, False, False]]
+        with pytest.raises(ValueError):
+            dt.options.simd = "sse9"
+    finally:
+        dt.options.simd = old_level
+    assert dt.options.simd == old_level
+
+
+
+#-------------------------------------------------------------------------------
+# Fused evaluation of expression trees
+#-------------------------------------------------------------------------------
+
+@pytest.mark.parametrize("seed", [random.getrandbits(63)])
+def test_fused_expr_large(seed):
+    # Large enough to span multiple evaluation blocks
+    random.seed(seed)
+    n = 20000 + random.randint(0, 10000)
+    src1 = [random.randint(-1000, 1000) for _ in range(n)]
+    src2 = [random.random() * 100 for _ in range(n)]
+    src3 = [random.choice([True, False, None]) for _ in range(n)]
+    DT = dt.Frame([src1, src2, src3], names=["A", "B", "C"],
+                  stypes=[stype.int32, stype.float64, stype.bool8])
+    RES = DT[:, [(f.A + f.B) * f.A - 1,
+                 -(f.A * 2) + 7,
+                 (f.A > 0) & f.C,
+                 dt.abs(f.A - 3) % 7]]
+    frame_integrity_check(RES)
+    assert RES.stypes == (stype.float64, stype.int32, stype.bool8,
+                          stype.int32)
+    assert RES.to_list() == [
+        [(src1[i] + src2[i]) * src1[i] - 1 for i in range(n)],
+        [-(src1[i] * 2) + 7 for i in range(n)],
+        [None if src3[i] is None else (src1[i] > 0 and src3[i])
+         for i in range(n)],
+        [abs(src1[i] - 3) % 7 for i in range(n)]
+    ]
+
+
+def test_fused_expr_views():
+    src = [5, None, 3, -2, 8, 0, 11, None, 7, 4]
+    DT = dt.Frame(A=src, B=[float(i) for i in range(10)])
+
+    def expected(rows):
+        return [[None if src[i] is None else (src[i] + i) * 2 - src[i]
+                 for i in rows]]
+
+    expr = (f.A + f.B) * 2 - f.A
+    assert DT[2:7, expr].to_list() == expected(range(2, 7))
+    assert DT[::-3, expr].to_list() == expected(range(9, -1, -3))
+    assert DT[[0, 9, 4, 4], expr].to_list() == expected([0, 9, 4, 4])
+    assert DT[f.B > 4, expr].to_list() == expected(range(5, 10))
+    view = DT[3:, :]
+    assert view[:, expr].to_list() == expected(range(3, 10))
+    assert view[::2, expr].to_list() == expected(range(3, 10, 2))
+
+
+def test_fused_expr_with_join():
+    X = dt.Frame(K=[1, 2, 3, 4], V=[10, 20, 30, 40])
+    J = dt.Frame(K=[4, 1, 3], W=[0.5, 1.5, 2.5])
+    J.key = "K"
+    RES = X[:, (f.V + g.W) * 2, dt.join(J)]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [[23.0, None, 65.0, 81.0]]
+
+
+def test_fused_expr_literals():
+    DT = dt.Frame(A=[1, 2, 3])
+    assert DT[:, (1 + f.A) * (2 - f.A)].to_list() == [[2, 0, -4]]
+    assert DT[:, 10 / (f.A + 1)].to_list() == [[5.0, 10 / 3, 2.5]]
+    assert DT[:, (f.A > 1) == True].to_list() == [[False, True, True]]
+
+
+
 #-------------------------------------------------------------------------------
 # Misc
 #-------------------------------------------------------------------------------
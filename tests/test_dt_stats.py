@@ -290,6 +290,104 @@ def test_dt_n_unique(src):
     assert dtr[0, 0] == dt0.nunique1()
 
 
+@pytest.mark.parametrize("src", srcs_all)
+def test_dt_n_unique_approx(src):
+    if isinstance(src, tuple):
+        dt0 = dt.Frame(src[1], stype=src[0])
+        ans = n_unique(src[1])
+    else:
+        dt0 = dt.Frame(src)
+        ans = n_unique(src)
+    dtr = dt0.nunique(approx=True)
+    frame_integrity_check(dtr)
+    assert dtr.stypes == (stype.int64, )
+    assert dtr.shape == (1, 1)
+    assert dtr.names == dt0.names
+    assert dtr[0, 0] == ans
+    assert dt0.nunique1(approx=True) == ans
+
+
+@pytest.mark.parametrize("seed", [random.getrandbits(32)])
+def test_dt_n_unique_approx_large(seed):
+    random.seed(seed)
+    n = 200000
+    src = [random.getrandbits(40) for _ in range(n)]
+    strs = ["%x" % x for x in src]
+    dt0 = dt.Frame(A=src, B=[x / 7 for x in src], C=strs)
+    ans = n_unique(src)
+    for est in dt0.nunique(approx=True).to_list():
+        assert abs(est[0] - ans) < 0.03 * ans
+
+
+@pytest.mark.parametrize("st", [stype.float32, stype.float64])
+def test_dt_n_unique_approx_negative_zero(st):
+    dt0 = dt.Frame([0.0, -0.0, 1.0, -0.0], stype=st)
+    assert dt0.nunique1() == 3
+    assert dt0.nunique1(approx=True) == 3
+
+
+
+#-------------------------------------------------------------------------------
+# Quantiles
+#-------------------------------------------------------------------------------
+
+def t_quantile(arr, q):
+    arr = sorted(x for x in arr if x is not None and not isnan(x))
+    if not arr:
+        return None
+    h = q * (len(arr) - 1)
+    lo = int(h)
+    hi = min(lo + 1, len(arr) - 1)
+    return arr[lo] + (h - lo) * (arr[hi] - arr[lo])
+
+
+@pytest.mark.parametrize("src", [s for s in srcs_numeric if inf not in s])
+@pytest.mark.parametrize("q", [0, 0.1, 0.5, 0.75, 1])
+def test_dt_quantile(src, q):
+    dt0 = dt.Frame(src)
+    ans = t_quantile(src, q)
+    for approx in [False, True]:
+        dtr = dt0.quantile(q, approx=approx)
+        frame_integrity_check(dtr)
+        assert dtr.stypes == (stype.float64, )
+        assert dtr.shape == (1, 1)
+        assert dtr.names == dt0.names
+        assert list_equals(dtr.to_list(), [[ans]])
+        assert list_equals([[dt0.quantile1(q, approx=approx)]], [[ans]])
+
+
+def test_dt_quantile_str():
+    dt0 = dt.Frame(A=[1, 5, 2], B=["a", "b", "c"])
+    assert dt0.quantile(approx=True).to_list() == [[2.0], [None]]
+    assert dt0.quantile().to_list() == [[2.0], [None]]
+    assert dt0[:, "B"].quantile1() is None
+
+
+@pytest.mark.parametrize("q", [-0.1, 1.5, nan])
+def test_dt_quantile_bad_q(q):
+    dt0 = dt.Frame([1, 2, 3])
+    with pytest.raises(ValueError) as e:
+        dt0.quantile(q)
+    assert "Parameter `q` in quantile() should be in the range [0; 1]" \
+           in str(e.value)
+
+
+@pytest.mark.parametrize("seed", [2720178749, random.getrandbits(32)])
+def test_dt_quantile_approx_large(seed):
+    random.seed(seed)
+    n = 300000
+    src = [random.random() for _ in range(n)]
+    dt0 = dt.Frame(src)
+    srt = sorted(src)
+    for q in [0.01, 0.25, 0.5, 0.9, 0.999]:
+        est = dt0.quantile1(q, approx=True)
+        # Compare the rank of the estimate against the requested quantile
+        rank = sum(1 for x in srt if x <= est) / n
+        assert abs(rank - q) < 0.005
+    assert dt0.quantile1(0, approx=True) == srt[0]
+    assert dt0.quantile1(1, approx=True) == srt[-1]
+
+
 
 #-------------------------------------------------------------------------------
 # Mode function
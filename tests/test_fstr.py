@@ -0,0 +1,259 @@
+#!/usr/bin/env python
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+# Tests for the fixed-width string stype `fstr`.
+#-------------------------------------------------------------------------------
+import pytest
+import datatable as dt
+from datatable import f, stype, ltype
+from datatable.internal import frame_integrity_check
+
+src_short = ["AB", "C", None, "", "ABC", "DDDD", "B"]
+src_long = ["tuesday", "monday", "monday-to-friday", None, "mon",
+            "monday-to-fridax", "é", ""]
+
+
+
+#-------------------------------------------------------------------------------
+# Creation & conversion
+#-------------------------------------------------------------------------------
+
+@pytest.mark.parametrize("src", [src_short, src_long])
+def test_create(src):
+    DT = dt.Frame(A=src, stype=stype.fstr)
+    frame_integrity_check(DT)
+    assert DT.stypes == (stype.fstr,)
+    assert DT.ltypes == (ltype.str,)
+    assert DT.to_list() == [src]
+    assert DT[0, 0] == src[0]
+    assert DT[2, 0] == src[2]
+
+
+def test_create_all_empty():
+    DT = dt.Frame(A=["", None, ""], stype=stype.fstr)
+    frame_integrity_check(DT)
+    assert DT.to_list() == [["", None, ""]]
+
+
+def test_casts():
+    DT = dt.Frame(A=src_long)
+    RES = DT[:, [dt.fstr(f.A), dt.str32(dt.fstr(f.A)),
+                 dt.str64(dt.fstr(f.A))]]
+    frame_integrity_check(RES)
+    assert RES.stypes == (stype.fstr, stype.str32, stype.str64)
+    assert RES.to_list() == [src_long] * 3
+    N = dt.Frame(A=[1, None, -25])
+    assert N[:, dt.fstr(f.A)].to_list() == [["1", None, "-25"]]
+
+
+def test_nul_characters():
+    # \0s inside a string are preserved, but not at its end, where they would
+    # be indistinguishable from the padding
+    DT = dt.Frame(A=["a\x00b", "\x00c", None], stype=stype.fstr)
+    frame_integrity_check(DT)
+    assert DT.to_list() == [["a\x00b", "\x00c", None]]
+    with pytest.raises(ValueError) as e:
+        dt.Frame(A=["x", "ab\x00"], stype=stype.fstr)
+    assert ("Value in row 1 ends with a \\0 character, and cannot be stored "
+            "in an fstr column" in str(e.value))
+    S = dt.Frame(A=["\x00", "abc"])
+    with pytest.raises(ValueError):
+        S[:, dt.fstr(f.A)]
+    assert S.to_list() == [["\x00", "abc"]]
+
+
+def test_view():
+    DT = dt.Frame(A=src_long, stype=stype.fstr)
+    RES = DT[::-2, :]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [src_long[::-2]]
+    RES.materialize()
+    frame_integrity_check(RES)
+    assert RES.stypes == (stype.fstr,)
+    assert RES.to_list() == [src_long[::-2]]
+
+
+
+#-------------------------------------------------------------------------------
+# Operations
+#-------------------------------------------------------------------------------
+
+@pytest.mark.parametrize("src", [src_short, src_long])
+def test_sort(src):
+    DT = dt.Frame(A=src, stype=stype.fstr)
+    expected = sorted(src, key=lambda x: (x is not None, (x or "").encode()))
+    RES = DT.sort(0)
+    frame_integrity_check(RES)
+    assert RES.stypes == (stype.fstr,)
+    assert RES.to_list() == [expected]
+
+
+def test_sort_multi():
+    DT = dt.Frame(A=["bb", "a", "bb", "a", None], B=[1, 2, 0, 1, 5])
+    DT[:, "A"] = dt.fstr(f.A)
+    RES = DT.sort("A", "B")
+    assert RES.to_list() == [[None, "a", "a", "bb", "bb"], [5, 1, 2, 0, 1]]
+
+
+@pytest.mark.parametrize("src", [src_short, src_long])
+def test_groupby(src):
+    DT = dt.Frame(A=src + src[::-1], stype=stype.fstr)
+    RES = DT[:, dt.count(), dt.by(f.A)]
+    frame_integrity_check(RES)
+    keys = sorted(set(src), key=lambda x: (x is not None, (x or "").encode()))
+    assert RES.to_list() == [keys, [2] * len(keys)]
+
+
+def test_compare():
+    DT = dt.Frame(A=src_short, stype=stype.fstr)
+    DT[:, "B"] = dt.Frame(src_short[::-1], stype=stype.fstr)
+    DT[:, "C"] = dt.Frame(src_long[:7], stype=stype.fstr)
+    DT[:, "S"] = dt.Frame(src_short)
+    RES = DT[:, [f.A == f.B, f.A != f.B, f.A == f.S, f.A == "AB",
+                 f.A != "", f.A == f.C, "ABC" == f.A]]
+    frame_integrity_check(RES)
+    assert RES.stypes == (stype.bool8,) * 7
+    rev = src_short[::-1]
+    assert RES.to_list() == [
+        [x == y for x, y in zip(src_short, rev)],
+        [x != y for x, y in zip(src_short, rev)],
+        [True] * 7,
+        [x == "AB" for x in src_short],
+        [x != "" for x in src_short],
+        [x == y for x, y in zip(src_short, src_long)],
+        [x == "ABC" for x in src_short]]
+
+
+def test_compare_ordered():
+    DT = dt.Frame(A=src_short, stype=stype.fstr)
+    DT[:, "B"] = dt.Frame(src_short[::-1], stype=stype.fstr)
+    DT[:, "C"] = dt.Frame(src_long[:7], stype=stype.fstr)
+    DT[:, "S"] = dt.Frame(src_short[::-1])
+    RES = DT[:, [f.A < f.B, f.A >= f.S, f.A > f.C, f.A <= f.C,
+                 f.A < "B", f.A >= "ABC", "B" > f.A, f.S < f.A]]
+    frame_integrity_check(RES)
+    assert RES.stypes == (stype.bool8,) * 8
+
+    def cmp(x, y, op):
+        if x is None or y is None:
+            return x is None and y is None and op in ("<=", ">=")
+        return {"<": x < y, "<=": x <= y, ">": x > y, ">=": x >= y}[op]
+
+    rev = src_short[::-1]
+    lng = src_long[:7]
+    assert RES.to_list() == [
+        [cmp(x, y, "<") for x, y in zip(src_short, rev)],
+        [cmp(x, y, ">=") for x, y in zip(src_short, rev)],
+        [cmp(x, y, ">") for x, y in zip(src_short, lng)],
+        [cmp(x, y, "<=") for x, y in zip(src_short, lng)],
+        [cmp(x, "B", "<") for x in src_short],
+        [cmp(x, "ABC", ">=") for x in src_short],
+        [cmp("B", x, ">") for x in src_short],
+        [cmp(y, x, "<") for x, y in zip(src_short, rev)]]
+
+
+def test_compare_ordered_nul_characters():
+    DT = dt.Frame(A=["ab", "ab\x00c", "a\x00b", None], stype=stype.fstr)
+    assert DT[:, f.A < "ab\x00c"].to_list() == [[True, False, True, False]]
+    assert DT[:, f.A > "ab"].to_list() == [[False, True, False, False]]
+
+
+def test_compare_with_none():
+    DT = dt.Frame(A=src_short, stype=stype.fstr)
+    isna = [x is None for x in src_short]
+    assert DT[:, f.A == None].to_list() == [isna]
+    assert DT[:, f.A != None].to_list() == [[not x for x in isna]]
+    assert DT[:, None == f.A].to_list() == [isna]
+    assert DT[f.A != None, :].nrows == len(src_short) - sum(isna)
+    with pytest.raises(TypeError):
+        DT[:, f.A == True]
+
+
+def test_isna_len():
+    DT = dt.Frame(A=src_long, stype=stype.fstr)
+    RES = DT[:, [dt.isna(f.A), f.A.len()]]
+    assert RES.stypes == (stype.bool8, stype.int32)
+    assert RES.to_list() == [
+        [x is None for x in src_long],
+        [None if x is None else len(x.encode()) for x in src_long]]
+
+
+def test_stats():
+    DT = dt.Frame(A=src_short + ["AB"], stype=stype.fstr)
+    assert DT.countna1() == 1
+    assert DT.nunique1() == 6
+    assert DT.mode1() == "AB"
+    assert DT.nmodal1() == 2
+    assert DT.min1() is None
+    assert DT.mode().stypes == (stype.fstr,)
+
+
+def test_rbind():
+    A = dt.Frame(A=["a", "bb"], stype=stype.fstr)
+    B = dt.Frame(A=["cccccc", None], stype=stype.fstr)
+    RES = dt.rbind(A, B)
+    frame_integrity_check(RES)
+    assert RES.stypes == (stype.fstr,)
+    assert RES.to_list() == [["a", "bb", "cccccc", None]]
+    RES = dt.rbind(A, dt.Frame(A=["xyz"]))
+    frame_integrity_check(RES)
+    assert RES.stypes == (stype.str32,)
+    assert RES.to_list() == [["a", "bb", "xyz"]]
+    RES = dt.rbind(A, dt.Frame(B=[1]), force=True)
+    frame_integrity_check(RES)
+    assert RES.to_list() == [["a", "bb", None], [None, None, 1]]
+
+
+def test_replace_rows():
+    DT = dt.Frame(A=["a", "bb", "a"], stype=stype.fstr)
+    DT[f.A == "a", "A"] = "longer"
+    frame_integrity_check(DT)
+    assert DT.stypes == (stype.fstr,)
+    assert DT.to_list() == [["longer", "bb", "longer"]]
+    DT[1, "A"] = None
+    frame_integrity_check(DT)
+    assert DT.to_list() == [["longer", None, "longer"]]
+
+
+def test_frame_replace():
+    DT = dt.Frame(A=["ab", None, "c", "ab"], stype=stype.fstr)
+    DT.replace("ab", "x")
+    frame_integrity_check(DT)
+    assert DT.stypes == (stype.fstr,)
+    assert DT.to_list() == [["x", None, "c", "x"]]
+    DT.replace({"c": "longer", None: "na"})
+    frame_integrity_check(DT)
+    assert DT.stypes == (stype.fstr,)
+    assert DT.to_list() == [["x", "na", "longer", "x"]]
+
+
+def test_join():
+    DT = dt.Frame(A=["mon", "tue", "wed", None, "mon"], stype=stype.fstr)
+    J = dt.Frame(A=["tue", "mon", "sun"], B=[2, 1, 7])
+    J[:, "A"] = J[:, dt.fstr(f.A)]
+    J.key = "A"
+    RES = DT[:, :, dt.join(J)]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [["mon", "tue", "wed", None, "mon"],
+                             [1, 2, None, None, 1]]
+
+
+
+#-------------------------------------------------------------------------------
+# Writing
+#-------------------------------------------------------------------------------
+
+def test_to_csv():
+    DT = dt.Frame(A=["a,b", None, "", " x", 'q"q'], stype=stype.fstr)
+    assert DT.to_csv() == 'A\n"a,b"\n\n""\n" x"\n"q""q"\n'
+
+
+def test_to_jay():
+    DT = dt.Frame(A=src_long, stype=stype.fstr)
+    RES = dt.open(DT.to_jay())
+    frame_integrity_check(RES)
+    assert RES.stypes == (stype.str32,)
+    assert RES.to_list() == [src_long]
@@ -24,7 +24,7 @@
 import datatable as dt
 import pytest
 import random
-from datatable import f, mean, min, max, sum, count, by, sort
+from datatable import f, mean, min, max, sum, count, first, by, sort
 from datatable.internal import frame_integrity_check
 from tests import same_iterables, assert_equals, isview
 
@@ -307,3 +307,52 @@ def test_groupby_with_sort():
                   C0=[2] * 6, stypes={"C0": dt.int32})
     assert_equals(R1, R0)
     assert_equals(R2, R0)
+
+
+
+#-------------------------------------------------------------------------------
+# Hash-based grouping
+#-------------------------------------------------------------------------------
+
+@pytest.mark.parametrize("seed", [random.getrandbits(32)])
+def test_groupby_hash_random(seed):
+    random.seed(seed)
+    n = random.randint(1, 2000)
+    DT = dt.Frame(A=[random.choice([None, "a", "bb", "", "ccc"])
+                     for _ in range(n)],
+                  B=[random.choice([None, 0.0, -0.0, 1.5, 1e10])
+                     for _ in range(n)],
+                  C=[random.choice([None, 1, 2, -3]) for _ in range(n)],
+                  D=range(n))
+    DT.nunique()
+    for keys in [["A"], ["B"], ["A", "B"], ["B", "C", "A"]]:
+        with dt.options.sort.context(groupby_hash_ratio=0):
+            R0 = DT[:, [count(), sum(f.D), first(f.D)], by(*keys)]
+            S0 = DT[:, :, by(*keys)]
+        with dt.options.sort.context(groupby_hash_ratio=1):
+            R1 = DT[:, [count(), sum(f.D), first(f.D)], by(*keys)]
+            S1 = DT[:, :, by(*keys)]
+        frame_integrity_check(R1)
+        frame_integrity_check(S1)
+        assert_equals(R0, R1)
+        assert_equals(S0, S1)
+
+
+def test_groupby_hash_strings():
+    DT = dt.Frame(A=["x", "y", None, "x", "", "y", None, "x"], B=range(8))
+    DT.nunique()
+    with dt.options.sort.context(groupby_hash_ratio=1):
+        RES = DT[:, [count(), first(f.B)], by(f.A)]
+    assert RES.to_list() == [[None, "", "x", "y"], [2, 1, 3, 2], [2, 4, 0, 1]]
+
+
+def test_groupby_hash_view():
+    DT0 = dt.Frame(A=[3, 1, None, 3, 2, 1, 3, None] * 3, B=range(24))
+    DT = DT0[::-2, :]
+    DT.nunique()
+    assert isview(DT)
+    with dt.options.sort.context(groupby_hash_ratio=1):
+        RES = DT[:, [count(), first(f.B)], by(f.A)]
+    frame_integrity_check(RES)
+    assert isview(DT)
+    assert RES.to_list() == [[None, 1, 3], [3, 6, 3], [23, 21, 19]]
@@ -154,6 +154,19 @@ def test_jay_view(tempfile, seed):
     assert dt1.to_list() == dt2.to_list()
 
 
+def test_jay_approx_stats(tempfile):
+    dt0 = dt.Frame(A=[i * 7 % 1000 for i in range(5000)],
+                   B=["x%d" % (i % 300) for i in range(5000)])
+    nunique = dt0.nunique(approx=True).to_list()
+    qts = dt0.quantile(0.3, approx=True).to_list()
+    dt0.to_jay(tempfile)
+    dt1 = dt.open(tempfile)
+    frame_integrity_check(dt1)
+    assert_equals(dt0, dt1)
+    assert dt1.nunique(approx=True).to_list() == nunique
+    assert dt1.quantile(0.3, approx=True).to_list() == qts
+
+
 def test_jay_unicode_names(tempfile):
     dt0 = dt.Frame({"py": [1], "ру": [2], "рy": [3], "pу": [4]})
     assert len(set(dt0.names)) == 4
@@ -227,6 +240,288 @@ def test_jay_keys(tempfile):
 
 
 
+def jay_all_types_frame():
+    n = 1000
+    return dt.Frame([[(i % 3 == 1) if i % 7 else None for i in range(n)],
+                     [i % 100 if i % 11 else None for i in range(n)],
+                     [i * 7 - 3000 if i % 13 else None for i in range(n)],
+                     [i * 1000003 for i in range(n)],
+                     [i ** 3 if i % 17 else None for i in range(n)],
+                     [i / 8 if i % 5 else None for i in range(n)],
+                     [math.sqrt(i) if i % 6 else None for i in range(n)],
+                     ["x" * (i % 9) if i % 4 else None for i in range(n)],
+                     ["%d" % i if i < 500 else None for i in range(n)]],
+                    stypes=[dt.bool8, dt.int8, dt.int16, dt.int32, dt.int64,
+                            dt.float32, dt.float64, dt.str32, dt.str64],
+                    names=["b8", "i8", "i16", "i32", "i64", "f32", "f64",
+                           "s32", "s64"])
+
+
+@pytest.mark.parametrize("rowgroup_size", [1, 7, 256, 5000])
+def test_jay_rowgroups(tempfile, rowgroup_size):
+    d0 = jay_all_types_frame()
+    d0.to_jay(tempfile, rowgroup_size=rowgroup_size)
+    with open(tempfile, "rb") as inp:
+        assert inp.read(8) == b"JAY1\x00\x00\x00\x00"
+    d1 = dt.open(tempfile)
+    assert_equals(d0, d1)
+
+
+@pytest.mark.parametrize("compression", ["lz4", "zstd"])
+@pytest.mark.parametrize("rowgroup_size", [7, 256, 5000])
+def test_jay_compression(tempfile, compression, rowgroup_size):
+    d0 = jay_all_types_frame()
+    try:
+        d0.to_jay(tempfile, compression=compression,
+                  rowgroup_size=rowgroup_size)
+    except ImportError:
+        pytest.skip("Compression library %s is not available" % compression)
+    with open(tempfile, "rb") as inp:
+        assert inp.read(8) == b"JAY2\x00\x00\x00\x00"
+    d1 = dt.open(tempfile)
+    assert_equals(d0, d1)
+
+
+@pytest.mark.parametrize("compression", ["lz4", "zstd"])
+def test_jay_compression_is_lazy(tempfile, compression):
+    import sys
+    d0 = dt.Frame(A=[i % 1000 for i in range(100000)],
+                  B=[i % 7 for i in range(100000)],
+                  stypes=[dt.int32, dt.int8])
+    try:
+        d0.to_jay(tempfile, compression=compression)
+    except ImportError:
+        pytest.skip("Compression library %s is not available" % compression)
+    assert os.path.getsize(tempfile) < 400000
+    d1 = dt.open(tempfile)
+    size0 = sys.getsizeof(d1)
+    assert size0 < 100000
+    # Accessing the data in column A decompresses that column only
+    assert d1[-1, "A"] == 999
+    assert size0 + 400000 <= sys.getsizeof(d1) < size0 + 500000
+    assert_equals(d0, d1)
+
+
+def test_jay_compression_empty(tempfile):
+    d0 = dt.Frame(A=[], B=[], stypes=[dt.int32, dt.str32])
+    try:
+        d0.to_jay(tempfile, compression="zstd")
+    except ImportError:
+        pytest.skip("Compression library zstd is not available")
+    d1 = dt.open(tempfile)
+    frame_integrity_check(d1)
+    assert d1.shape == (0, 2)
+    assert d1.stypes == d0.stypes
+
+
+def test_jay_compression_invalid(tempfile):
+    d0 = dt.Frame(A=range(5))
+    with pytest.raises(TypeError) as e:
+        d0.to_jay(tempfile, compression=5)
+    assert ("Parameter `compression` in Frame.to_jay() should be a string"
+            in str(e.value))
+    with pytest.raises(ValueError) as e:
+        d0.to_jay(tempfile, compression="gzip")
+    assert ("Unsupported compression method `gzip` for a Jay file"
+            in str(e.value))
+    with pytest.raises(ValueError) as e:
+        d0.to_jay(tempfile, rowgroup_size=0)
+    assert ("Parameter `rowgroup_size` in Frame.to_jay() should be positive"
+            in str(e.value))
+
+
+@pytest.mark.parametrize("compression", [None, "zstd"])
+def test_jay_filter_pruning(tempfile, compression):
+    from datatable import f
+    d0 = jay_all_types_frame()
+    try:
+        d0.to_jay(tempfile, compression=compression, rowgroup_size=64)
+    except ImportError:
+        pytest.skip("Compression library %s is not available" % compression)
+    d1 = dt.open(tempfile)
+    filters = [f.i32 > 500 * 1000003, f.i32 < 3, f.i32 == 12 * 1000003,
+               f.i16 != 3000, 2000 <= f.i16, (f.i8 < 5) | (f.i64 >= 10**8),
+               (f.f32 > 100) & (f.s32 == "xx"), f.f64 <= 5.5, f.b8 == 0,
+               f.f32 > 120, f.i64 < 0.5, f.i8 == None]
+    for flt in filters:
+        assert_equals(d1[flt, :], d0[flt, :])
+        assert_equals(d1[flt, ["s64", "i32"]], d0[flt, ["s64", "i32"]])
+    frame_integrity_check(d1)
+
+
+def test_jay_filter_pruning_is_lazy(tempfile):
+    import sys
+    from datatable import f
+    n = 100000
+    d0 = dt.Frame(A=range(n), B=[str(i % 1000) for i in range(n)],
+                  C=[i % 7 for i in range(n)])
+    try:
+        d0.to_jay(tempfile, compression="zstd", rowgroup_size=1000)
+    except ImportError:
+        pytest.skip("Compression library zstd is not available")
+    d1 = dt.open(tempfile)
+    size0 = sys.getsizeof(d1)
+    res = d1[(f.A >= 50500) & (f.A < 50510), ["A", "B"]]
+    assert res.to_list() == [list(range(50500, 50510)),
+                             [str(i) for i in range(500, 510)]]
+    # Only the blocks that may contain the matching rows were loaded, and
+    # only into the result frame
+    assert sys.getsizeof(d1) == size0
+    assert sys.getsizeof(res) < size0 + 100000
+
+
+def test_jay_slice_is_lazy(tempfile):
+    import sys
+    n = 100000
+    d0 = dt.Frame(A=range(n), B=[str(i % 1000) for i in range(n)])
+    try:
+        d0.to_jay(tempfile, compression="zstd", rowgroup_size=1000)
+    except ImportError:
+        pytest.skip("Compression library zstd is not available")
+    d1 = dt.open(tempfile)
+    size0 = sys.getsizeof(d1)
+    res = [d1[:10, :], d1[51500:50490:-3, "B"], d1[-1, :], d1[7:7, :]]
+    assert res[0].to_list() == d0[:10, :].to_list()
+    assert res[1].to_list() == d0[51500:50490:-3, "B"].to_list()
+    assert res[2].to_list() == [[n - 1], ["999"]]
+    assert res[3].shape == (0, 2)
+    # Only the blocks touched by the slices were loaded, and only into the
+    # result frames
+    assert sys.getsizeof(d1) == size0
+    assert sum(sys.getsizeof(r) for r in res) < size0 + 100000
+    for r in res:
+        frame_integrity_check(r)
+
+
+def test_jay_filter_pruning_update(tempfile):
+    from datatable import f
+    d0 = dt.Frame(A=range(1000), B=[i % 3 for i in range(1000)])
+    d0.to_jay(tempfile, rowgroup_size=100)
+    d1 = dt.open(tempfile)
+    d1[f.A >= 950, "B"] = -1
+    del d1[f.A < 20, :]
+    assert d1.shape == (980, 2)
+    assert d1[:, dt.sum(f.B)].to_list() == [[sum(i % 3 for i in range(20, 950))
+                                             - 50]]
+    # The data was modified, so the block stats no longer apply
+    assert d1[f.B == -1, :].nrows == 50
+    frame_integrity_check(d1)
+
+
+@pytest.mark.parametrize("compression", [None, "lz4", "zstd"])
+def test_jay_append(tempfile, compression):
+    d0 = jay_all_types_frame()
+    parts = [d0[:300, :], d0[300:310, :], d0[310:310, :], d0[310:, :]]
+    parts[0].to_jay(tempfile, rowgroup_size=100)
+    with open(tempfile, "rb") as inp:
+        head = inp.read()
+    # Strip the meta record and the footer
+    head = head[:len(head) - 16 - int.from_bytes(head[-16:-8], "little")]
+    try:
+        for part in parts[1:]:
+            part.to_jay(tempfile, append=True, compression=compression,
+                        rowgroup_size=256)
+    except ImportError:
+        pytest.skip("Compression library %s is not available" % compression)
+    with open(tempfile, "rb") as inp:
+        data = inp.read()
+    # The data that was already in the file was not modified
+    assert data[:4] == b"JAY2"
+    assert data[4:len(head)] == head[4:]
+    d1 = dt.open(tempfile)
+    frame_integrity_check(d1)
+    assert_equals(d1, d0)
+    assert d1.countna().to_list() == d0.countna().to_list()
+
+
+def test_jay_append_new_file(tempfile):
+    os.remove(tempfile)
+    d0 = dt.Frame(A=range(5), B=list("abcde"))
+    d0.to_jay(tempfile, append=True)
+    d0.to_jay(tempfile, append=True)
+    d1 = dt.open(tempfile)
+    assert_equals(d1, dt.rbind(d0, d0))
+
+
+def test_jay_append_invalid(tempfile):
+    d0 = dt.Frame(A=range(5), B=list("abcde"))
+    d0.to_jay(tempfile)
+    size0 = os.path.getsize(tempfile)
+    with pytest.raises(ValueError) as e:
+        dt.Frame(A=range(3)).to_jay(tempfile, append=True)
+    assert ("Cannot append a frame with 1 column to a Jay file with 2 columns"
+            in str(e.value))
+    with pytest.raises(ValueError) as e:
+        dt.Frame(A=range(3), C=list("xyz")).to_jay(tempfile, append=True)
+    assert ("Column 1 in the Jay file is named `B`, whereas in the frame "
+            "being appended it is named `C`" in str(e.value))
+    with pytest.raises(ValueError) as e:
+        dt.Frame(A=[0.5], B=["x"]).to_jay(tempfile, append=True)
+    assert ("Column `A` of stype float64 cannot be appended to a Jay file"
+            in str(e.value))
+    with pytest.raises(ValueError) as e:
+        d0.to_jay(append=True)
+    assert ("Parameter `append` in Frame.to_jay() cannot be used when the "
+            "`path` is not given" in str(e.value))
+    # The file was not modified
+    assert os.path.getsize(tempfile) == size0
+    assert_equals(dt.open(tempfile), d0)
+
+
+def test_jay_mmap_budget(tempdir):
+    from datatable.internal import mmap_resident_size
+    n = 100000
+    frames = []
+    for i in range(8):
+        filename = os.path.join(tempdir, "f%d.jay" % i)
+        dt.Frame(A=range(i, n + i), B=[i + 0.5] * n,
+                 C=["x%d" % i] * n).to_jay(filename)
+        frames.append(dt.open(filename))
+    # The budget is smaller than the data of a single frame, so that the
+    # columns are constantly evicted and then re-read from the files
+    with dt.options.context(**{"memory.mmap_budget": 500000}):
+        for _ in range(2):
+            for i, DT in enumerate(frames):
+                frame_integrity_check(DT)
+                assert DT[:, dt.sum(dt.f.A)][0, 0] == n * (n - 1) // 2 + n * i
+                assert DT[-1, :].to_tuples()[0] == (n - 1 + i, i + 0.5,
+                                                    "x%d" % i)
+                assert DT[:, dt.count(dt.f.C)][0, 0] == n
+                # The budget may only be exceeded by the column accessed
+                # last (the largest one is B, of 8n bytes)
+                assert 0 < mmap_resident_size() <= 500000 + 8 * n
+    assert dt.options.memory.mmap_budget == 0
+    assert mmap_resident_size() == 0
+    assert frames[3][5, "A"] == 8
+
+
+def test_jay_mmap_budget_release(tempdir):
+    from datatable.internal import mmap_resident_size
+    n = 100000
+    frames = []
+    for i in range(4):
+        filename = os.path.join(tempdir, "f%d.jay" % i)
+        dt.Frame(A=range(i, n + i), stype=dt.int32).to_jay(filename)
+        frames.append(dt.open(filename))
+    colsize = 4 * n
+    # Without a budget the resident size is not tracked
+    assert frames[0][:, dt.sum(dt.f.A)][0, 0] == n * (n - 1) // 2
+    assert mmap_resident_size() == 0
+    with dt.options.context(**{"memory.mmap_budget": 2 * colsize + 100}):
+        assert mmap_resident_size() == 0
+        for i, DT in enumerate(frames):
+            assert DT[:, dt.sum(dt.f.A)][0, 0] == n * (n - 1) // 2 + n * i
+            # Once the third column is accessed the budget is exceeded, and
+            # the least recently used columns are released
+            assert mmap_resident_size() == min(i + 1, 2) * colsize
+        # The released column is read back from the file
+        assert frames[0][:, dt.sum(dt.f.A)][0, 0] == n * (n - 1) // 2
+        assert mmap_resident_size() == 2 * colsize
+        frame_integrity_check(frames[1])
+        assert mmap_resident_size() == 2 * colsize
+    assert mmap_resident_size() == 0
+
+
 #-------------------------------------------------------------------------------
 # pickling
 #-------------------------------------------------------------------------------
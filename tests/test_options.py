@@ -20,9 +20,12 @@ def test_options_all():
         "display",
         "frame",
         "fread",
+        "memory",
         "progress",
+        "simd",
     }
     assert set(dir(dt.options.sort)) == {
+        "groupby_hash_ratio",
         "insert_method_threshold",
         "max_chunk_length",
         "max_radix_bits",
@@ -42,8 +45,13 @@ def test_options_all():
     }
     assert set(dir(dt.options.fread)) == {
         "anonymize",
+        "categorical_threshold",
+        "decimals",
         "log",
     }
+    assert set(dir(dt.options.memory)) == {
+        "mmap_budget",
+    }
     assert set(dir(dt.options.progress)) == {
         "callback",
         "enabled",
@@ -218,3 +226,15 @@ def test_frame_names_auto_prefix():
     assert f2.names == ("C0", "C1", "C2", "C3")
     with pytest.raises(TypeError):
         dt.options.frame.names_auto_prefix = 0
+
+
+def test_memory_mmap_budget():
+    assert dt.options.memory.mmap_budget == 0
+    dt.options.memory.mmap_budget = 1000000
+    assert dt.options.memory.mmap_budget == 1000000
+    del dt.options.memory.mmap_budget
+    assert dt.options.memory.mmap_budget == 0
+    with pytest.raises(ValueError):
+        dt.options.memory.mmap_budget = -1
+    with pytest.raises(TypeError):
+        dt.options.memory.mmap_budget = "1G"
@@ -351,3 +351,119 @@ def test_median_wrong_stype():
         noop(DT[:, median(f.B)])
     assert ("Unable to apply reduce function `median()` to a column of "
             "type `str64`" in str(e.value))
+
+
+
+
+#-------------------------------------------------------------------------------
+# Reducers over NA-free columns
+#-------------------------------------------------------------------------------
+
+def reduce_all(DT):
+    return DT[:, [count(f.A), dt.sum(f.A), dt.mean(f.A), dt.sd(f.A),
+                  dt.min(f.A), dt.max(f.A)]].to_list()
+
+
+@pytest.mark.parametrize("st", dt.ltype.int.stypes + dt.ltype.real.stypes)
+def test_reduce_na_free(st):
+    # Once the NA count is computed, the reducers switch to the versions that
+    # skip the NA checks. The results should not change.
+    DT = dt.Frame(A=[5, 17, 0, 3, 99, 2, 1, 1, 8], stype=st)
+    res0 = reduce_all(DT)
+    assert DT.countna().to_list() == [[0]]
+    res1 = reduce_all(DT)
+    assert res0 == res1
+    assert DT[2:5, count(f.A)].to_list() == [[3]]
+    assert DT[2:5, dt.max(f.A)].to_list() == [[99]]
+
+
+@pytest.mark.parametrize("st", dt.ltype.int.stypes + dt.ltype.real.stypes)
+def test_reduce_na_free_empty(st):
+    DT = dt.Frame(A=[], stype=st)
+    assert DT.countna().to_list() == [[0]]
+    assert reduce_all(DT) == [[0], [0], [None], [None], [None], [None]]
+
+
+def test_reduce_na_free_modified():
+    DT = dt.Frame(A=[3, 4, 5, 6])
+    assert DT.countna().to_list() == [[0]]
+    DT[1, "A"] = None
+    res = reduce_all(DT)
+    assert res[:2] == [[3], [14]]
+    assert res[4:] == [[3], [6]]
+    assert math.isclose(res[2][0], 14/3)
+    assert math.isclose(res[3][0], math.sqrt(7/3))
+    assert DT.countna().to_list() == [[1]]
+
+
+def test_reduce_na_free_range():
+    DT = dt.Frame(A=range(1, 101))
+    assert reduce_all(DT) == [[100], [5050], [50.5], [29.011491975882016],
+                              [1], [100]]
+    DT = dt.Frame(A=range(-200, 200, 3), stype=dt.int8)
+    assert DT.countna().to_list() == [[1]]
+    frame_integrity_check(DT)
+
+
+def test_reduce_na_free_cast():
+    DT = dt.Frame(A=range(10))
+    RES = DT[:, [dt.sum(dt.float64(f.A)), dt.min(dt.int8(f.A)),
+                 count(f.A > 4), dt.sum(f.A > 4)]]
+    assert RES.to_list() == [[45.0], [0], [10], [5]]
+
+
+
+#-------------------------------------------------------------------------------
+# Several reducers in a grouped query
+#-------------------------------------------------------------------------------
+
+def test_reduce_multiple_grouped():
+    n = 300
+    DT = dt.Frame(K=[(i * 7) % 13 for i in range(n)],
+                  A=[i if i % 5 else None for i in range(n)],
+                  B=[i / 4 for i in range(n)],
+                  C=["s%d" % i if i % 3 else None for i in range(n)])
+    exprs = [dt.sum(f.A), dt.mean(f.B), dt.min(f.A), dt.max(f.B),
+             dt.sd(f.A), first(f.C), count(f.C), median(f.B), count()]
+    RES = DT[:, exprs, by(f.K)]
+    frame_integrity_check(RES)
+    assert RES.shape == (13, 1 + len(exprs))
+    for i, expr in enumerate(exprs):
+        RESi = DT[:, expr, by(f.K)]
+        assert RES[:, i + 1].to_list() == RESi[:, 1].to_list()
+
+
+
+def test_reduce_large_ungrouped():
+    # Large enough to be split into several chunks that are reduced in
+    # parallel and then combined
+    n = 300007
+    src = [(i * 7919) % 1000 / 8 if i % 11 else None for i in range(n)]
+    vals = [x for x in src if x is not None]
+    DT = dt.Frame(A=src, B=range(n))
+    RES = DT[:, [dt.sum(f.A), dt.mean(f.A), dt.sd(f.A), dt.min(f.A),
+                 dt.max(f.A), count(f.A), dt.sum(f.B), dt.sd(f.B)]]
+    frame_integrity_check(RES)
+    res = RES.to_list()
+    mean = math.fsum(vals) / len(vals)
+    sd = math.sqrt(math.fsum((x - mean)**2 for x in vals) / (len(vals) - 1))
+    assert math.isclose(res[0][0], math.fsum(vals), rel_tol=1e-12)
+    assert math.isclose(res[1][0], mean, rel_tol=1e-12)
+    assert math.isclose(res[2][0], sd, rel_tol=1e-12)
+    assert res[3:6] == [[min(vals)], [max(vals)], [len(vals)]]
+    assert res[6] == [n * (n - 1) // 2]
+    assert math.isclose(res[7][0], math.sqrt(n * (n + 1) / 12), rel_tol=1e-12)
+
+
+def test_reduce_large_ungrouped_nthreads():
+    n = 500000
+    DT = dt.Frame(A=[math.sin(i) for i in range(n)])
+    nthreads = dt.options.nthreads
+    try:
+        dt.options.nthreads = 1
+        RES1 = DT[:, [dt.sum(f.A), dt.mean(f.A), dt.sd(f.A)]]
+        dt.options.nthreads = nthreads
+        RES2 = DT[:, [dt.sum(f.A), dt.mean(f.A), dt.sd(f.A)]]
+    finally:
+        dt.options.nthreads = nthreads
+    assert RES1.to_list() == RES2.to_list()
@@ -22,9 +22,12 @@
 # IN THE SOFTWARE.
 #-------------------------------------------------------------------------------
 import datatable as dt
+import os
 import random
 import re
 import pytest
+import shutil
+import subprocess
 from datatable import stype
 from datatable.internal import frame_integrity_check
 from tests import assert_equals
@@ -385,3 +388,85 @@ def test_issue1615():
     DT.cbind(dt.Frame(B=range(500)))
     RES = dt.fread(DT.to_csv())
     assert_equals(RES, DT)
+
+
+
+#-------------------------------------------------------------------------------
+# Test compression
+#-------------------------------------------------------------------------------
+
+def compression_test_frame():
+    n = 100000
+    return dt.Frame(A=range(n),
+                    B=["str%d" % (i * 7) for i in range(n)],
+                    C=[i / 3 for i in range(n)])
+
+
+@pytest.mark.parametrize("nthreads", [1, 4])
+def test_save_gzip(nthreads):
+    import gzip
+    DT = compression_test_frame()
+    plain = DT.to_csv(nthreads=nthreads)
+    out = DT.to_csv(compression="gzip", nthreads=nthreads)
+    assert isinstance(out, bytes)
+    assert len(out) < len(plain)
+    assert gzip.decompress(out).decode() == plain
+
+
+def test_save_gzip_to_file(tempfile):
+    import gzip
+    DT = compression_test_frame()
+    filename = tempfile + ".gz"
+    try:
+        DT.to_csv(filename, compression="gzip")
+        with gzip.open(filename, "rt") as inp:
+            assert inp.read() == DT.to_csv()
+        RES = dt.fread(filename)
+        assert_equals(RES, DT)
+    finally:
+        os.remove(filename)
+
+
+def test_save_gzip_empty():
+    import gzip
+    assert gzip.decompress(dt.Frame().to_csv(compression="gzip")) == b""
+    assert gzip.decompress(dt.Frame(A=[]).to_csv(compression="gzip")) == b"A\n"
+
+
+def test_save_zstd():
+    zstd = shutil.which("zstd")
+    if not zstd:
+        pytest.skip("zstd command-line tool is not available")
+    DT = compression_test_frame()
+    try:
+        out = DT.to_csv(compression="zstd")
+    except ImportError:
+        pytest.skip("libzstd is not available")
+    res = subprocess.run([zstd, "-dcq"], input=out, stdout=subprocess.PIPE,
+                         check=True)
+    assert res.stdout.decode() == DT.to_csv()
+
+
+def test_save_lz4():
+    lz4 = shutil.which("lz4")
+    if not lz4:
+        pytest.skip("lz4 command-line tool is not available")
+    DT = compression_test_frame()
+    try:
+        out = DT.to_csv(compression="lz4")
+    except ImportError:
+        pytest.skip("liblz4 is not available")
+    res = subprocess.run([lz4, "-dcq"], input=out, stdout=subprocess.PIPE,
+                         check=True)
+    assert res.stdout.decode() == DT.to_csv()
+
+
+def test_save_compression_invalid():
+    DT = dt.Frame(A=[1, 2, 3])
+    with pytest.raises(TypeError) as e:
+        DT.to_csv(compression=1)
+    assert ("Parameter `compression` in Frame.to_csv() should be a string"
+            in str(e.value))
+    with pytest.raises(ValueError) as e:
+        DT.to_csv(compression="brotli")
+    assert "Unsupported compression method `brotli`" in str(e.value)
@@ -93,11 +93,21 @@ def test_stype():
     assert stype.int64
     assert stype.float32
     assert stype.float64
+    assert stype.dec16
+    assert stype.dec32
+    assert stype.dec64
     assert stype.str32
     assert stype.str64
+    assert stype.fstr
+    assert stype.cat8
+    assert stype.cat16
+    assert stype.cat32
+    assert stype.date64
+    assert stype.time32
+    assert stype.date32
     assert stype.obj64
     # When new stypes are added, don't forget to update this test suite
-    assert len(stype) == 10
+    assert len(stype) == 20
 
 
 def test_stype_names():
@@ -109,8 +119,15 @@ def test_stype_names():
     assert stype.int64.name == "int64"
     assert stype.float32.name == "float32"
     assert stype.float64.name == "float64"
+    assert stype.dec16.name == "dec16"
+    assert stype.dec32.name == "dec32"
+    assert stype.dec64.name == "dec64"
     assert stype.str32.name == "str32"
     assert stype.str64.name == "str64"
+    assert stype.fstr.name == "fstr"
+    assert stype.cat8.name == "cat8"
+    assert stype.cat16.name == "cat16"
+    assert stype.cat32.name == "cat32"
     assert stype.obj64.name == "obj64"
 
 
@@ -129,8 +146,15 @@ def test_stype_codes():
     assert stype.int64.code == "i8"
     assert stype.float32.code == "r4"
     assert stype.float64.code == "r8"
+    assert stype.dec16.code == "d2"
+    assert stype.dec32.code == "d4"
+    assert stype.dec64.code == "d8"
     assert stype.str32.code == "s4"
     assert stype.str64.code == "s8"
+    assert stype.fstr.code == "sx"
+    assert stype.cat8.code == "e1"
+    assert stype.cat16.code == "e2"
+    assert stype.cat32.code == "e4"
     assert stype.obj64.code == "o8"
 
 
@@ -143,7 +167,11 @@ def test_stype_values(c_stypes):
 def test_stype_sizes(c_stypes):
     from datatable import stype
     for st in stype:
-        assert int(st.code[1:]) == c_stypes[st.code]["elemsize"]
+        if st == stype.fstr:
+            # the width of fstr columns varies
+            assert c_stypes[st.code]["elemsize"] == 0
+        else:
+            assert int(st.code[1:]) == c_stypes[st.code]["elemsize"]
 
 
 def test_stype_ctypes():
@@ -158,6 +186,10 @@ def test_stype_ctypes():
     assert stype.float64.ctype == ctypes.c_double
     assert stype.str32.ctype == ctypes.c_int32
     assert stype.str64.ctype == ctypes.c_int64
+    assert stype.fstr.ctype == ctypes.c_char
+    assert stype.cat8.ctype == ctypes.c_uint8
+    assert stype.cat16.ctype == ctypes.c_uint16
+    assert stype.cat32.ctype == ctypes.c_uint32
     assert stype.obj64.ctype == ctypes.py_object
 
 
@@ -172,6 +204,10 @@ def test_stype_struct():
     assert stype.float64.struct == "=d"
     assert stype.str32.struct == "=i"
     assert stype.str64.struct == "=q"
+    assert stype.fstr.struct == "s"
+    assert stype.cat8.struct == "B"
+    assert stype.cat16.struct == "=H"
+    assert stype.cat32.struct == "=I"
     assert stype.obj64.struct == "O"
 
 
@@ -202,6 +238,8 @@ def test_stype_instantiate():
     assert stype("str") is stype.str64
     assert stype("str32") is stype.str32
     assert stype("str64") is stype.str64
+    assert stype("cat") is stype.cat8
+    assert stype("categorical") is stype.cat8
     assert stype(object) is stype.obj64
     assert stype("obj") is stype.obj64
     assert stype("object") is stype.obj64
@@ -238,7 +276,9 @@ def test_stype_instantiate_bad():
 @pytest.mark.parametrize("st", list(dt.stype))
 def test_stype_minmax(st):
     from datatable import stype, ltype
-    if st in (stype.str32, stype.str64, stype.obj64):
+    if (st.ltype in (ltype.str, ltype.obj, ltype.time) or
+            st in (stype.dec16, stype.dec32, stype.dec64)):
+        # the range of a decimal stype depends on the column's scale
         assert st.min is None
         assert st.max is None
     else:
@@ -304,7 +344,10 @@ def test_ltype_stypes():
     assert ltype.bool.stypes == [stype.bool8]
     assert set(ltype.int.stypes) == {stype.int8, stype.int16, stype.int32,
                                      stype.int64}
-    assert set(ltype.real.stypes) == {stype.float32, stype.float64}
-    assert set(ltype.str.stypes) == {stype.str32, stype.str64}
-    assert set(ltype.time.stypes) == set()
+    assert set(ltype.real.stypes) == {stype.float32, stype.float64,
+                                      stype.dec16, stype.dec32, stype.dec64}
+    assert set(ltype.str.stypes) == {stype.str32, stype.str64, stype.fstr,
+                                     stype.cat8, stype.cat16, stype.cat32}
+    assert set(ltype.time.stypes) == {stype.date64, stype.time32,
+                                      stype.date32}
     assert set(ltype.obj.stypes) == {stype.obj64}
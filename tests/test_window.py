@@ -0,0 +1,214 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#-------------------------------------------------------------------------------
+# Copyright 2018 H2O.ai
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+#-------------------------------------------------------------------------------
+import math
+import pytest
+import random
+import datatable as dt
+from datatable import f, by, stype
+from datatable.internal import frame_integrity_check
+
+
+#-------------------------------------------------------------------------------
+# Reference implementations
+#-------------------------------------------------------------------------------
+
+def ref_grouped(keys, values, fn):
+    """
+    Apply `fn` to the values within each group (groups ordered by key), and
+    return the concatenation of the results.
+    """
+    res = []
+    for k in sorted(set(keys)):
+        res += fn([v for kk, v in zip(keys, values) if kk == k])
+    return res
+
+
+def ref_cumsum(vals):
+    res, s = [], 0
+    for v in vals:
+        if v is None:
+            res.append(None)
+        else:
+            s += v
+            res.append(s)
+    return res
+
+
+def ref_rolling(fn, window):
+    def rolling(vals):
+        res = []
+        for i in range(len(vals)):
+            w = [v for v in vals[max(0, i - window + 1):i + 1] if v is not None]
+            res.append(fn(w) if w else None)
+        return res
+    return rolling
+
+
+def ref_shift(n):
+    def shift(vals):
+        return [vals[i - n] if 0 <= i - n < len(vals) else None
+                for i in range(len(vals))]
+    return shift
+
+
+
+#-------------------------------------------------------------------------------
+# Tests
+#-------------------------------------------------------------------------------
+
+def test_cumsum():
+    DT = dt.Frame(A=[1, 2, None, 4, 5])
+    RES = DT[:, dt.cumsum(f.A)]
+    frame_integrity_check(RES)
+    assert RES.stypes == (stype.int64,)
+    assert RES.to_list() == [[1, 3, None, 7, 12]]
+
+
+def test_cumsum_float():
+    DT = dt.Frame(A=[0.5, 1.5, None, 2.0], stype=stype.float32)
+    RES = DT[:, dt.cumsum(f.A)]
+    assert RES.stypes == (stype.float32,)
+    assert RES.to_list() == [[0.5, 2.0, None, 4.0]]
+
+
+def test_cumcount():
+    DT = dt.Frame(K=[3, 1, 3, 3, 1])
+    RES = DT[:, [dt.cumcount(), dt.cumcount()], by(f.K)]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [[1, 1, 3, 3, 3], [0, 1, 0, 1, 2], [0, 1, 0, 1, 2]]
+    assert DT[:, dt.cumcount()].to_list() == [[0, 1, 2, 3, 4]]
+
+
+def test_shift():
+    DT = dt.Frame(A=[1, 2, 3, 4], B=["a", "b", None, "d"])
+    RES = DT[:, [dt.shift(f.A), dt.shift(f.A, -2), dt.shift(f.B, 1),
+                 dt.shift(f.A, 0), dt.shift(f.A, 5)]]
+    frame_integrity_check(RES)
+    assert RES.stypes == (stype.int8, stype.int8, stype.str32, stype.int8,
+                          stype.int8)
+    assert RES.to_list() == [[None, 1, 2, 3], [3, 4, None, None],
+                             [None, "a", "b", None], [1, 2, 3, 4],
+                             [None] * 4]
+
+
+def test_shift_view():
+    DT = dt.Frame(A=range(10))
+    RES = DT[::3, dt.shift(f.A)]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [[None, 0, 3, 6]]
+
+
+@pytest.mark.parametrize("seed", [random.getrandbits(32) for _ in range(5)])
+def test_window_functions_grouped(seed):
+    random.seed(seed)
+    n = random.randint(1, 500)
+    window = random.randint(1, 10)
+    nshift = random.randint(-5, 5)
+    keys = [random.randint(0, 7) for _ in range(n)]
+    vals = [random.randint(-100, 100) if random.random() < 0.8 else None
+            for _ in range(n)]
+    DT = dt.Frame(K=keys, A=vals, stypes={"A": stype.int32})
+    RES = DT[:, [dt.cumsum(f.A), dt.shift(f.A, nshift),
+                 dt.rolling_sum(f.A, window), dt.rolling_mean(f.A, window),
+                 dt.rolling_min(f.A, window), dt.rolling_max(f.A, window)],
+             by(f.K)]
+    frame_integrity_check(RES)
+    assert RES.stypes == (stype.int8, stype.int64, stype.int32, stype.int64,
+                          stype.float64, stype.int32, stype.int32)
+    res = RES.to_list()
+    assert res[1] == ref_grouped(keys, vals, ref_cumsum)
+    assert res[2] == ref_grouped(keys, vals, ref_shift(nshift))
+    assert res[3] == ref_grouped(keys, vals, ref_rolling(sum, window))
+    means = ref_grouped(keys, vals, ref_rolling(lambda w: sum(w) / len(w),
+                                                window))
+    assert len(res[4]) == len(means)
+    for x, y in zip(res[4], means):
+        assert x == y or math.isclose(x, y, rel_tol=1e-12)
+    assert res[5] == ref_grouped(keys, vals, ref_rolling(min, window))
+    assert res[6] == ref_grouped(keys, vals, ref_rolling(max, window))
+
+
+def test_rolling_float():
+    DT = dt.Frame(A=[3.5, None, -1.0, 2.0, 7.25, None, None, 0.0])
+    RES = DT[:, [dt.rolling_sum(f.A, 2), dt.rolling_min(f.A, 3),
+                 dt.rolling_max(f.A, 2)]]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [[3.5, 3.5, -1.0, 1.0, 9.25, 7.25, None, 0.0],
+                             [3.5, 3.5, -1.0, -1.0, -1.0, 2.0, 7.25, 0.0],
+                             [3.5, 3.5, -1.0, 2.0, 7.25, 7.25, None, 0.0]]
+
+
+def test_rolling_minmax_monotonic():
+    n = 10000
+    DT = dt.Frame(A=range(n), B=range(n, 0, -1))
+    RES = DT[:, [dt.rolling_min(f.A, 3), dt.rolling_max(f.B, 3)]]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [[max(i - 2, 0) for i in range(n)],
+                             [min(n - i + 2, n) for i in range(n)]]
+    # Check that the scratch deque stays O(window) on monotonic input
+    from datatable.lib import core
+    if hasattr(core, "test_rolling_minmax"):
+        core.test_rolling_minmax(n)
+
+    inf = math.inf
+    DT = dt.Frame(A=[1.0, inf, 2.0, 3.0, -inf, 4.0, 5.0, 6.0, 7.0])
+    RES = DT[:, [dt.rolling_sum(f.A, 4), dt.rolling_mean(f.A, 4)]]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [
+        [1.0, inf, inf, inf, None, -inf, -inf, -inf, 22.0],
+        [1.0, inf, inf, inf, None, -inf, -inf, -inf, 5.5]]
+
+
+def test_rolling_float_large_magnitudes():
+    DT = dt.Frame(A=[1e17, 1.0, 1.0, 1.0, None, 3.0, -1e20, 1e20, 0.5, 0.25])
+    RES = DT[:, [dt.rolling_sum(f.A, 1), dt.rolling_sum(f.A, 2),
+                 dt.rolling_mean(f.A, 2)]]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [
+        [1e17, 1.0, 1.0, 1.0, None, 3.0, -1e20, 1e20, 0.5, 0.25],
+        [1e17, 1e17, 2.0, 2.0, 1.0, 3.0, -1e20, 0.0, 1e20, 0.75],
+        [1e17, 5e16, 1.0, 1.0, 1.0, 3.0, -5e19, 0.0, 5e19, 0.375]]
+
+
+def test_window_with_reducer():
+    DT = dt.Frame(K=[1, 2, 1, 2], A=[1, 2, 3, 4])
+    RES = DT[:, [dt.sum(f.A), dt.cumsum(f.A)], by(f.K)]
+    frame_integrity_check(RES)
+    assert RES.to_list() == [[1, 1, 2, 2], [4, 4, 6, 6], [1, 4, 2, 6]]
+
+
+def test_window_bad_arguments():
+    DT = dt.Frame(A=[1, 2, 3], B=["x", "y", "z"])
+    with pytest.raises(ValueError) as e:
+        DT[:, dt.rolling_mean(f.A, 0)]
+    assert ("The window size in function `rolling_mean()` should be "
+            "positive, instead got 0" in str(e.value))
+    with pytest.raises(TypeError) as e:
+        DT[:, dt.rolling_max(f.A, 1.5)]
+    assert ("The window size in function `rolling_max()` should be an "
+            "integer" in str(e.value))
+    with pytest.raises(TypeError) as e:
+        DT[:, dt.cumsum(f.B)]
+    assert ("Function `cumsum()` cannot be applied to a column of type "
+            "`str32`" in str(e.value))